@@ -1,17 +1,15 @@
 #pragma once
 
+#include "FuelNetwork.h"
 #include "RegPolynomials.h"
 #include "SimVars.h"
 #include "Tables.h"
 #include "ThrustLimits.h"
 #include "common.h"
 
+#include "EngineControlCore.h"
 #include "ini_type_conversion.h"
 
-#define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
-#define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
-#define CONFIGURATION_SECTION_FUEL "FUEL"
-
 #define CONFIGURATION_SECTION_FUEL_CENTER_QUANTITY "FUEL_CENTER_QUANTITY"
 #define CONFIGURATION_SECTION_FUEL_LEFT_QUANTITY "FUEL_LEFT_QUANTITY"
 #define CONFIGURATION_SECTION_FUEL_RIGHT_QUANTITY "FUEL_RIGHT_QUANTITY"
@@ -27,23 +25,85 @@ struct Configuration {
   double fuelRightAux = fuelLeftAux;
 };
 
-class EngineControl {
+/// Fuel tanks in FUELSYSTEM TANK QUANTITY index order (index + 1)
+enum FuelTank { FuelTankCenter, FuelTankLeft, FuelTankRight, FuelTankLeftAux, FuelTankRightAux, FuelTankCount };
+
+/// <summary>
+/// A32NX specifics of the shared engine control
+/// </summary>
+struct A32nxEngineTraits {
+  static constexpr int ENGINE_COUNT = 2;
+  static constexpr int TANK_COUNT = FuelTankCount;
+
+  using SimVarsType = SimVars;
+  using PolynomialType = Polynomial;
+  using ConfigurationType = Configuration;
+
+  static constexpr ConfigurationEntry<Configuration> CONFIGURATION_ENTRIES[] = {
+      {CONFIGURATION_SECTION_FUEL_CENTER_QUANTITY, &Configuration::fuelCenter},
+      {CONFIGURATION_SECTION_FUEL_LEFT_QUANTITY, &Configuration::fuelLeft},
+      {CONFIGURATION_SECTION_FUEL_RIGHT_QUANTITY, &Configuration::fuelRight},
+      {CONFIGURATION_SECTION_FUEL_LEFT_AUX_QUANTITY, &Configuration::fuelLeftAux},
+      {CONFIGURATION_SECTION_FUEL_RIGHT_AUX_QUANTITY, &Configuration::fuelRightAux},
+  };
+
+  static constexpr FuelTankEntry<SimVars, DataTypesID> TANKS[] = {
+      {DataTypesID::FuelCenterMain, &SimVars::getFuelCenterPre, &SimVars::setFuelCenterPre},
+      {DataTypesID::FuelLeftMain, &SimVars::getFuelLeftPre, &SimVars::setFuelLeftPre},
+      {DataTypesID::FuelRightMain, &SimVars::getFuelRightPre, &SimVars::setFuelRightPre},
+      {DataTypesID::FuelLeftAux, &SimVars::getFuelAuxLeftPre, &SimVars::setFuelAuxLeftPre},
+      {DataTypesID::FuelRightAux, &SimVars::getFuelAuxRightPre, &SimVars::setFuelAuxRightPre},
+  };
+
+  /// Engines are fed from their inner tanks
+  static constexpr std::array<int, ENGINE_COUNT> FEED_TANKS = {FuelTankLeft, FuelTankRight};
+  /// Both outer tanks and the center tank into both inner tanks, the APU from both inner tanks
+  static constexpr std::size_t FUEL_LINES = 4;
+  static constexpr std::size_t FUEL_DRAWS = 2;
+
+  static constexpr std::array<DataTypesID, ENGINE_COUNT> START_CORE_SPEED = {DataTypesID::StartCN2Left, DataTypesID::StartCN2Right};
+  static constexpr std::array<DataTypesID, ENGINE_COUNT> OIL_TEMPERATURE = {DataTypesID::OilTempLeft, DataTypesID::OilTempRight};
+  static constexpr std::array<DataTypesID, ENGINE_COUNT> OIL_PRESSURE = {DataTypesID::OilPsiLeft, DataTypesID::OilPsiRight};
+
+  static double tankQuantity(SimVars* simVars, int index) { return simVars->getFuelTankQuantity(index); }
+
+  static double idleCoreSpeed(double pressAltitude, double mach) { return iCN2(pressAltitude, mach); }
+  static double engineIdleCoreSpeed(SimVars* simVars) { return simVars->getEngineIdleN2(); }
+  static void setEngineIdleCoreSpeed(SimVars* simVars, double value) { simVars->setEngineIdleN2(value); }
+
+  static double engineCoreSpeed(SimVars* simVars, int engine) { return simVars->getEngineN2(engine); }
+  static void setEngineCoreSpeed(SimVars* simVars, int engine, double value) { simVars->setEngineN2(engine, value); }
+  static double startCoreSpeed(Polynomial* poly, double simN2, double preN2, double idleN2) { return poly->startN2(simN2, preN2, idleN2); }
+  static double shutdownCoreSpeed(Polynomial* poly, double preN2, double deltaTime) { return poly->shutdownN2(preN2, deltaTime); }
+
+  /// <summary>
+  /// Decodes the imbalance of an engine from the engine imbalance coded digital word, see generateEngineImbalance
+  /// </summary>
+  static EngineImbalance engineImbalance(SimVars* simVars, int engine) {
+    double imbalance = simVars->getEngineImbalance();
+    EngineImbalance decoded;
+
+    if (imbalanceExtractor(imbalance, 1) == engine) {
+      decoded.egt = imbalanceExtractor(imbalance, 2);
+      decoded.fuelFlow = imbalanceExtractor(imbalance, 3);
+      decoded.coreSpeed = imbalanceExtractor(imbalance, 4) / 100;
+      decoded.oilPressure = imbalanceExtractor(imbalance, 6) / 10;
+    }
+    decoded.oilIdleRandom = imbalanceExtractor(imbalance, 7) - 6;
+
+    return decoded;
+  }
+};
+
+class EngineControl : public EngineControlCore<A32nxEngineTraits> {
  private:
-  SimVars* simVars;
-  EngineRatios* ratios;
-  Polynomial* poly;
   Timer timerLeft;
   Timer timerRight;
   Timer timerFuel;
 
-  std::string confFilename = FILENAME_FADEC_CONF_DIRECTORY;
-
-  bool simPaused;
   double animationDeltaTime;
-  double timer;
   double ambientTemp;
   double ambientPressure;
-  double simOnGround;
   double devState;
   double isReady;
 
@@ -51,76 +111,20 @@ class EngineControl {
   int egtImbalance;
   int ffImbalance;
   int n2Imbalance;
-  double engineState;
-  double engineStarter;
-  double engineIgniter;
 
   double packs;
   double nai;
   double wai;
 
-  double simCN1;
-  double simN1;
-  double simN2;
-  double thrust;
-  double simN2LeftPre;
-  double simN2RightPre;
-  double deltaN2;
-  double thermalEnergy1;
-  double thermalEnergy2;
-  double oilTemperature;
-  double oilTemperatureLeftPre;
-  double oilTemperatureRightPre;
-  double oilTemperatureMax;
-  double idleN1;
-  double idleN2;
-  double idleFF;
-  double idleEGT;
   double idleOil;
   double mach;
   double pressAltitude;
-  double correctedEGT;
-  double correctedFuelFlow;
-  double cFbwFF;
   double imbalance;
   int engineImbalanced;
   double paramImbalance;
 
-  const double LBS_TO_KGS = 0.4535934;
-  const double KGS_TO_LBS = 1 / 0.4535934;
   const double FUEL_THRESHOLD = 661;  // lbs/sec
 
-  bool isFlexActive = false;
-  double prevThrustLimitType = 0;
-  double prevFlexTemperature = 0;
-
-  const double waitTime = 10;
-  const double transitionTime = 30;
-
-  bool isTransitionActive = false;
-  double transitionFactor = 0;
-  double transitionStartTime = 0;
-
-  /// <summary>
-  /// Generate Idle/ Initial Engine Parameters (non-imbalanced)
-  /// </summary>
-  void generateIdleParameters(double pressAltitude, double mach, double ambientTemp, double ambientPressure) {
-    double idleCN1;
-    double idleCFF;
-
-    idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
-    idleN1 = idleCN1 * sqrt(ratios->theta2(0, ambientTemp));
-    idleN2 = iCN2(pressAltitude, mach) * sqrt(ratios->theta(ambientTemp));
-    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
-    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
-    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
-
-    simVars->setEngineIdleN1(idleN1);
-    simVars->setEngineIdleN2(idleN2);
-    simVars->setEngineIdleFF(idleFF);
-    simVars->setEngineIdleEGT(idleEGT);
-  }
-
   double initOil(int minOil, int maxOil) {
     double idleOil = (rand() % (maxOil - minOil + 1) + minOil) / 10;
     return idleOil;
@@ -176,499 +180,10 @@ class EngineControl {
     }
   }
 
-  /// <summary>
-  /// Engine State Machine
-  /// 0 - Engine OFF, 1 - Engine ON, 2 - Engine Starting, 3 - Engine Re-starting & 4 - Engine Shutting
-  /// </summary>
-  void engineStateMachine(int engine,
-                          double engineIgniter,
-                          double engineStarter,
-                          double simN2,
-                          double idleN2,
-                          double pressAltitude,
-                          double ambientTemp,
-                          double deltaTimeDiff) {
-    int resetTimer = 0;
-    double egtFbw = 0;
-
-    switch (engine) {
-      case 1:
-        engineState = simVars->getEngine1State();
-        egtFbw = simVars->getEngine1EGT();
-        break;
-      case 2:
-        engineState = simVars->getEngine2State();
-        egtFbw = simVars->getEngine2EGT();
-        break;
-    }
-    // Present State PAUSED
-    if (deltaTimeDiff == 0 && engineState < 10) {
-      engineState = engineState + 10;
-      simPaused = true;
-    } else if (deltaTimeDiff == 0 && engineState >= 10) {
-      simPaused = true;
-    } else {
-      simPaused = false;
-
-      // Present State OFF
-      if (engineState == 0 || engineState == 10) {
-        if (engineIgniter == 1 && engineStarter == 1 && simN2 > 20) {
-          engineState = 1;
-        } else if (engineIgniter == 2 && engineStarter == 1) {
-          engineState = 2;
-        } else {
-          engineState = 0;
-        }
-      }
-
-      // Present State ON
-      if (engineState == 1 || engineState == 11) {
-        if (engineStarter == 1) {
-          engineState = 1;
-        } else {
-          engineState = 4;
-        }
-      }
-
-      // Present State Starting.
-      if (engineState == 2 || engineState == 12) {
-        if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
-          engineState = 1;
-          resetTimer = 1;
-        } else if (engineStarter == 0) {
-          engineState = 4;
-          resetTimer = 1;
-        } else {
-          engineState = 2;
-        }
-      }
-
-      // Present State Re-Starting.
-      if (engineState == 3 || engineState == 13) {
-        if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
-          engineState = 1;
-          resetTimer = 1;
-        } else if (engineStarter == 0) {
-          engineState = 4;
-          resetTimer = 1;
-        } else {
-          engineState = 3;
-        }
-      }
-
-      // Present State Shutting
-      if (engineState == 4 || engineState == 14) {
-        if (engineIgniter == 2 && engineStarter == 1) {
-          engineState = 3;
-          resetTimer = 1;
-        } else if (engineStarter == 0 && simN2 < 0.05 && egtFbw <= ambientTemp) {
-          engineState = 0;
-          resetTimer = 1;
-        } else if (engineStarter == 1 && simN2 > 50) {
-          engineState = 3;
-          resetTimer = 1;
-        } else {
-          engineState = 4;
-        }
-      }
-    }
-
-    switch (engine) {
-      case 1:
-        simVars->setEngine1State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine1Timer(0);
-        }
-        break;
-      case 2:
-        simVars->setEngine2State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine2Timer(0);
-        }
-        break;
-    }
-  }
-
-  /// <summary>
-  /// Engine Start Procedure
-  /// </summary>TIT
-  void engineStartProcedure(int engine,
-                            double engineState,
-                            double imbalance,
-                            double deltaTime,
-                            double timer,
-                            double simN2,
-                            double pressAltitude,
-                            double ambientTemp) {
-    double startCN2Left;
-    double startCN2Right;
-    double preN2Fbw;
-    double newN2Fbw;
-    double preEgtFbw;
-    double startEgtFbw;
-    double shutdownEgtFbw;
-
-    n2Imbalance = 0;
-    ffImbalance = 0;
-    egtImbalance = 0;
-    idleN2 = simVars->getEngineIdleN2();
-    idleN1 = simVars->getEngineIdleN1();
-    idleFF = simVars->getEngineIdleFF();
-    idleEGT = simVars->getEngineIdleEGT();
-
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-
-    // Checking engine imbalance
-    if (engineImbalanced == engine) {
-      ffImbalance = imbalanceExtractor(imbalance, 3);
-      egtImbalance = imbalanceExtractor(imbalance, 2);
-      n2Imbalance = imbalanceExtractor(imbalance, 4) / 100;
-    }
-
-    if (engine == 1) {
-      // Delay between Engine Master ON and Start Valve Open
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedLeft(0);
-        }
-        simVars->setEngine1Timer(timer + deltaTime);
-        startCN2Left = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Left, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Left);
-      } else {
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1N1(poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
-        simVars->setEngine1FF(poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine1EGT(startEgtFbw);
-            simVars->setEngine1State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine1EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine1EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine1EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureLeftPre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    } else {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedRight(0);
-        }
-        simVars->setEngine2Timer(timer + deltaTime);
-        startCN2Right = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Right, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Right);
-      } else {
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2N1(poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
-        simVars->setEngine2FF(poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine2EGT(startEgtFbw);
-            simVars->setEngine2State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine2EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine2EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine2EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureRightPre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    }
-  }
-
-  /// <summary>
-  /// Engine Shutdown Procedure - TEMPORAL SOLUTION
-  /// </summary>
-  void engineShutdownProcedure(int engine, double ambientTemp, double simN1, double deltaTime, double timer) {
-    double preN1Fbw;
-    double preN2Fbw;
-    double preEgtFbw;
-    double newN1Fbw;
-    double newN2Fbw;
-    double newEgtFbw;
-
-    if (engine == 1) {
-      if (timer < 1.8) {
-        simVars->setEngine1Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine1N1();
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine1N1(newN1Fbw);
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1EGT(newEgtFbw);
-      }
-
-    } else {
-      if (timer < 1.8) {
-        simVars->setEngine2Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine2N1();
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine2N1(newN1Fbw);
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2EGT(newEgtFbw);
-      }
-    }
-  }
-  /// <summary>
-  /// FBW Engine RPM (N1 and N2)
-  /// Updates Engine N1 and N2 with our own algorithm for start-up and shutdown
-  /// </summary>
-  void updatePrimaryParameters(int engine, double imbalance, double simN1, double simN2) {
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 4) / 100;
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine) {
-      paramImbalance = 0;
-    }
-
-    if (engine == 1) {
-      simVars->setEngine1N1(simN1);
-      simVars->setEngine1N2(max(0, simN2 - paramImbalance));
-    } else {
-      simVars->setEngine2N1(simN1);
-      simVars->setEngine2N2(max(0, simN2 - paramImbalance));
-    }
-  }
-
-  /// <summary>
-  /// FBW Exhaust Gas Temperature (in degree Celsius)
-  /// Updates EGT with realistic values visualized in the ECAM
-  /// </summary>
-  void updateEGT(int engine,
-                 double imbalance,
-                 double deltaTime,
-                 double simOnGround,
-                 double engineState,
-                 double simCN1,
-                 double cFbwFF,
-                 double mach,
-                 double pressAltitude,
-                 double ambientTemp) {
-    double egtFbwPreviousEng1;
-    double egtFbwActualEng1;
-    double egtFbwPreviousEng2;
-    double egtFbwActualEng2;
-
-    // Engine imbalance timer
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 2);
-
-    correctedEGT = poly->correctedEGT(simCN1, cFbwFF, mach, pressAltitude);
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine) {
-      paramImbalance = 0;
-    }
-
-    if (engine == 1) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine1EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng1 = simVars->getEngine1EGT();
-        egtFbwActualEng1 = (correctedEGT * ratios->theta2(mach, ambientTemp)) - paramImbalance;
-        egtFbwActualEng1 = egtFbwActualEng1 + (egtFbwPreviousEng1 - egtFbwActualEng1) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine1EGT(egtFbwActualEng1);
-      }
-    } else {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine2EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng2 = simVars->getEngine2EGT();
-        egtFbwActualEng2 = (correctedEGT * ratios->theta2(mach, ambientTemp)) - paramImbalance;
-        egtFbwActualEng2 = egtFbwActualEng2 + (egtFbwPreviousEng2 - egtFbwActualEng2) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine2EGT(egtFbwActualEng2);
-      }
-    }
-  }
-
-  /// <summary>
-  /// FBW Fuel FLow (in Kg/h)
-  /// Updates Fuel Flow with realistic values
-  /// </summary>
-  double
-  updateFF(int engine, double imbalance, double simCN1, double mach, double pressAltitude, double ambientTemp, double ambientPressure) {
-    double outFlow = 0;
-
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 3);
-
-    correctedFuelFlow = poly->correctedFuelFlow(simCN1, mach, pressAltitude);  // in lbs/hr.
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine || correctedFuelFlow < 1) {
-      paramImbalance = 0;
-    }
-
-    // Checking Fuel Logic and final Fuel Flow
-    if (correctedFuelFlow < 1) {
-      outFlow = 0;
-    } else {
-      outFlow = max(0, (correctedFuelFlow * LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * sqrt(ratios->theta2(mach, ambientTemp))) -
-                           paramImbalance);
-    }
-
-    if (engine == 1) {
-      simVars->setEngine1FF(outFlow);
-    } else {
-      simVars->setEngine2FF(outFlow);
-    }
-
-    return correctedFuelFlow;
-  }
-
-  /// <summary>
-  /// FBW Oil Qty, Pressure and Temperature (in Quarts, PSI and degree Celsius)
-  /// Updates Oil with realistic values visualized in the SD
-  /// </summary>
-  void updateOil(int engine, double imbalance, double thrust, double simN2, double deltaN2, double deltaTime, double ambientTemp) {
-    double steadyTemperature;
-    double thermalEnergy;
-    double oilTemperaturePre;
-    double oilQtyActual;
-    double oilTotalActual;
-    double oilQtyObjective;
-    double oilBurn;
-    double oilIdleRandom;
-    double oilPressure;
-
-    //--------------------------------------------
-    // Engine Reading
-    //--------------------------------------------
-    if (engine == 1) {
-      steadyTemperature = simVars->getEngine1EGT();
-      thermalEnergy = thermalEnergy1;
-      oilTemperaturePre = oilTemperatureLeftPre;
-      oilQtyActual = simVars->getEngine1Oil();
-      oilTotalActual = simVars->getEngine1OilTotal();
-    } else {
-      steadyTemperature = simVars->getEngine2EGT();
-      thermalEnergy = thermalEnergy2;
-      oilTemperaturePre = oilTemperatureRightPre;
-      oilQtyActual = simVars->getEngine2Oil();
-      oilTotalActual = simVars->getEngine2OilTotal();
-    }
-
-    //--------------------------------------------
-    // Oil Temperature
-    //--------------------------------------------
-    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePre - 10) {
-      oilTemperature = ambientTemp;
-    } else {
-      if (steadyTemperature > oilTemperatureMax) {
-        steadyTemperature = oilTemperatureMax;
-      }
-      thermalEnergy = (0.995 * thermalEnergy) + (deltaN2 / deltaTime);
-      oilTemperature = poly->oilTemperature(thermalEnergy, oilTemperaturePre, steadyTemperature, deltaTime);
-    }
-
-    //--------------------------------------------
-    // Oil Quantity
-    //--------------------------------------------
-    // Calculating Oil Qty as a function of thrust
-    oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(thrust));
-    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePre);
-
-    // Oil burnt taken into account for tank and total oil
-    oilBurn = (0.00011111 * deltaTime);
-    oilQtyActual = oilQtyActual - oilBurn;
-    oilTotalActual = oilTotalActual - oilBurn;
-
-    //--------------------------------------------
-    // Oil Pressure
-    //--------------------------------------------
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 6) / 10;
-    oilIdleRandom = imbalanceExtractor(imbalance, 7) - 6;
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine) {
-      paramImbalance = 0;
-    }
-
-    oilPressure = poly->oilPressure(simN2) - paramImbalance + oilIdleRandom;
-
-    //--------------------------------------------
-    // Engine Writing
-    //--------------------------------------------
-    if (engine == 1) {
-      thermalEnergy1 = thermalEnergy;
-      oilTemperatureLeftPre = oilTemperature;
-      simVars->setEngine1Oil(oilQtyActual);
-      simVars->setEngine1OilTotal(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else {
-      thermalEnergy2 = thermalEnergy;
-      oilTemperatureRightPre = oilTemperature;
-      simVars->setEngine2Oil(oilQtyActual);
-      simVars->setEngine2OilTotal(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    }
-  }
-
   /// @brief FBW Fuel Consumption and Tankering
   /// Updates Fuel Consumption with realistic values
   /// @param deltaTimeSeconds Frame delta time in seconds
   void updateFuel(double deltaTimeSeconds) {
-    double m = 0;
-    double b = 0;
-    double fuelBurn1 = 0;
-    double fuelBurn2 = 0;
-    double apuBurn1 = 0;
-    double apuBurn2 = 0;
-
     double refuelRate = simVars->getRefuelRate();
     double refuelStartedByUser = simVars->getRefuelStartedByUser();
     bool uiFuelTamper = false;
@@ -680,58 +195,34 @@ class EngineControl {
     bool xfrCenterRightAuto = simVars->getValve(12) > 0.0 && !xfrCenterRightManual;
     bool xfrValveCenterLeftOpen = simVars->getValve(9) > 0.0 && (xfrCenterLeftAuto || xfrCenterLeftManual);
     bool xfrValveCenterRightOpen = simVars->getValve(10) > 0.0 && (xfrCenterRightAuto || xfrCenterRightManual);
-    double xfrValveOuterLeft1 = simVars->getValve(6);
-    double xfrValveOuterLeft2 = simVars->getValve(4);
-    double xfrValveOuterRight1 = simVars->getValve(7);
-    double xfrValveOuterRight2 = simVars->getValve(5);
+    bool xfrValveOuterLeftOpen = simVars->getValve(6) > 0.0 || simVars->getValve(4) > 0.0;
+    bool xfrValveOuterRightOpen = simVars->getValve(7) > 0.0 || simVars->getValve(5) > 0.0;
     double lineLeftToCenterFlow = simVars->getLineFlow(27);
     double lineRightToCenterFlow = simVars->getLineFlow(28);
     double lineFlowRatio = 0;
 
-    double engine1PreFF = simVars->getEngine1PreFF();  // KG/H
-    double engine2PreFF = simVars->getEngine2PreFF();  // KG/H
-    double engine1FF = simVars->getEngine1FF();        // KG/H
-    double engine2FF = simVars->getEngine2FF();        // KG/H
+    std::array<double, ENGINE_COUNT> enginePreFF = {simVars->getEngine1PreFF(), simVars->getEngine2PreFF()};  // KG/H
+    std::array<double, ENGINE_COUNT> engineFF = {simVars->getEngine1FF(), simVars->getEngine2FF()};           // KG/H
 
     /// weight of one gallon of fuel in pounds
     double fuelWeightGallon = simVars->getFuelWeightGallon();
     double fuelUsedLeft = simVars->getFuelUsedLeft();    // Kg
     double fuelUsedRight = simVars->getFuelUsedRight();  // Kg
 
-    double fuelLeftPre = simVars->getFuelLeftPre();                                // LBS
-    double fuelRightPre = simVars->getFuelRightPre();                              // LBS
-    double fuelAuxLeftPre = simVars->getFuelAuxLeftPre();                          // LBS
-    double fuelAuxRightPre = simVars->getFuelAuxRightPre();                        // LBS
-    double fuelCenterPre = simVars->getFuelCenterPre();                            // LBS
-    double leftQuantity = simVars->getFuelTankQuantity(2) * fuelWeightGallon;      // LBS
-    double rightQuantity = simVars->getFuelTankQuantity(3) * fuelWeightGallon;     // LBS
-    double leftAuxQuantity = simVars->getFuelTankQuantity(4) * fuelWeightGallon;   // LBS
-    double rightAuxQuantity = simVars->getFuelTankQuantity(5) * fuelWeightGallon;  // LBS
-    double centerQuantity = simVars->getFuelTankQuantity(1) * fuelWeightGallon;    // LBS
-    /// Left inner tank fuel quantity in pounds
-    double fuelLeft = 0;
-    /// Right inner tank fuel quantity in pounds
-    double fuelRight = 0;
-    double fuelLeftAux = 0;
-    double fuelRightAux = 0;
-    double fuelCenter = 0;
-    double xfrCenterToLeft = 0;
-    double xfrCenterToRight = 0;
-    double xfrAuxLeft = 0;
-    double xfrAuxRight = 0;
-    double fuelTotalActual = leftQuantity + rightQuantity + leftAuxQuantity + rightAuxQuantity + centerQuantity;  // LBS
-    double fuelTotalPre = fuelLeftPre + fuelRightPre + fuelAuxLeftPre + fuelAuxRightPre + fuelCenterPre;          // LBS
-    double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTimeSeconds);           // LBS/ sec
+    FuelTanks& fuelPre = fuelNetwork.pre;
+    FuelTanks& fuelActual = fuelNetwork.actual;
+    readFuelTanks(fuelWeightGallon);
+
+    double fuelTotalActual = fuelNetwork.totalActual();                                                  // LBS
+    double fuelTotalPre = fuelNetwork.totalPre();                                                        // LBS
+    double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTimeSeconds);  // LBS/ sec
 
     double engine1State = simVars->getEngine1State();
     double engine2State = simVars->getEngine2State();
 
-    int isTankClosed = 0;
     double xFeedValve = simVars->getValve(3);
-    double leftPump1 = simVars->getPump(2);
-    double leftPump2 = simVars->getPump(5);
-    double rightPump1 = simVars->getPump(3);
-    double rightPump2 = simVars->getPump(6);
+    bool leftPumpsOff = simVars->getPump(2) == 0 && simVars->getPump(5) == 0;
+    bool rightPumpsOff = simVars->getPump(3) == 0 && simVars->getPump(6) == 0;
 
     // Check Ready & Development State for UI
     isReady = simVars->getIsReady();
@@ -742,10 +233,10 @@ class EngineControl {
 
     // Pump State Logic for Left Wing
     if (pumpStateLeft == 0 && (timerLeft.elapsed() == 0 || timerLeft.elapsed() >= 1000)) {
-      if (fuelLeftPre - leftQuantity > 0 && leftQuantity == 0) {
+      if (fuelPre[FuelTankLeft] - fuelActual[FuelTankLeft] > 0 && fuelActual[FuelTankLeft] == 0) {
         timerLeft.reset();
         simVars->setPumpStateLeft(1);
-      } else if (fuelLeftPre == 0 && leftQuantity - fuelLeftPre > 0) {
+      } else if (fuelPre[FuelTankLeft] == 0 && fuelActual[FuelTankLeft] - fuelPre[FuelTankLeft] > 0) {
         timerLeft.reset();
         simVars->setPumpStateLeft(2);
       } else {
@@ -761,10 +252,10 @@ class EngineControl {
 
     // Pump State Logic for Right Wing
     if (pumpStateRight == 0 && (timerRight.elapsed() == 0 || timerRight.elapsed() >= 1000)) {
-      if (fuelRightPre - rightQuantity > 0 && rightQuantity == 0) {
+      if (fuelPre[FuelTankRight] - fuelActual[FuelTankRight] > 0 && fuelActual[FuelTankRight] == 0) {
         timerRight.reset();
         simVars->setPumpStateRight(1);
-      } else if (fuelRightPre == 0 && rightQuantity - fuelRightPre > 0) {
+      } else if (fuelPre[FuelTankRight] == 0 && fuelActual[FuelTankRight] - fuelPre[FuelTankRight] > 0) {
         timerRight.reset();
         simVars->setPumpStateRight(2);
       } else {
@@ -785,127 +276,67 @@ class EngineControl {
     }
 
     if (simPaused || uiFuelTamper && devState == 0) {  // Detects whether the Sim is paused or the Fuel UI is being tampered with
-      simVars->setFuelLeftPre(fuelLeftPre);            // in LBS
-      simVars->setFuelRightPre(fuelRightPre);          // in LBS
-      simVars->setFuelAuxLeftPre(fuelAuxLeftPre);      // in LBS
-      simVars->setFuelAuxRightPre(fuelAuxRightPre);    // in LBS
-      simVars->setFuelCenterPre(fuelCenterPre);        // in LBS
-
-      fuelLeft = (fuelLeftPre / fuelWeightGallon);          // USG
-      fuelRight = (fuelRightPre / fuelWeightGallon);        // USG
-      fuelCenter = (fuelCenterPre / fuelWeightGallon);      // USG
-      fuelLeftAux = (fuelAuxLeftPre / fuelWeightGallon);    // USG
-      fuelRightAux = (fuelAuxRightPre / fuelWeightGallon);  // USG
-
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelCenter);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeftAux);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRightAux);
+      setFuelPre(fuelPre);
+      setFuelTanks(fuelPre, fuelWeightGallon);
     } else if (!uiFuelTamper && refuelStartedByUser == 1) {  // Detects refueling from the EFB
-      simVars->setFuelLeftPre(leftQuantity);                 // in LBS
-      simVars->setFuelRightPre(rightQuantity);               // in LBS
-      simVars->setFuelAuxLeftPre(leftAuxQuantity);           // in LBS
-      simVars->setFuelAuxRightPre(rightAuxQuantity);         // in LBS
-      simVars->setFuelCenterPre(centerQuantity);             // in LBS
+      setFuelPre(fuelActual);
     } else {
       if (uiFuelTamper == 1) {
-        fuelLeftPre = leftQuantity;          // LBS
-        fuelRightPre = rightQuantity;        // LBS
-        fuelAuxLeftPre = leftAuxQuantity;    // LBS
-        fuelAuxRightPre = rightAuxQuantity;  // LBS
-        fuelCenterPre = centerQuantity;      // LBS
-      }
-      //-----------------------------------------------------------
-      // Cross-feed Logic
-      // isTankClosed = 0, x-feed valve closed
-      // isTankClosed = 1, left tank does not supply fuel
-      // isTankClosed = 2, right tank does not supply fuel
-      // isTankClosed = 3, left & right tanks do not supply fuel
-      // isTankClosed = 4, both tanks supply fuel
-      if (xFeedValve > 0.0) {
-        if (leftPump1 == 0 && leftPump2 == 0 && rightPump1 == 0 && rightPump2 == 0)
-          isTankClosed = 3;
-        else if (leftPump1 == 0 && leftPump2 == 0)
-          isTankClosed = 1;
-        else if (rightPump1 == 0 && rightPump2 == 0)
-          isTankClosed = 2;
-        else
-          isTankClosed = 4;
+        fuelPre = fuelActual;  // LBS
       }
 
       //--------------------------------------------
-      // Left Engine and Wing routine
-      if (fuelLeftPre > 0) {
-        // Cycle Fuel Burn for Engine 1
-        if (devState != 2) {
-          m = (engine1FF - engine1PreFF) / deltaTime;
-          b = engine1PreFF;
-          fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+      // Engine burns, an empty inner tank burns nothing
+      forEachEngine([&](auto i) {
+        int feedTank = A32nxEngineTraits::FEED_TANKS[i];
+        if (fuelPre[feedTank] > 0) {
+          // Cycle Fuel Burn
+          if (devState != 2) {
+            fuelNetwork.burn[i] = fuelNetwork.integrateBurn(enginePreFF[i], engineFF[i], deltaTime);  // KG
+          }
+        } else {
+          fuelPre[feedTank] = 0;
         }
+      });
 
-        // Fuel transfer routine for Left Wing
-        if (xfrValveOuterLeft1 > 0.0 || xfrValveOuterLeft2 > 0.0)
-          xfrAuxLeft = fuelAuxLeftPre - leftAuxQuantity;
-      } else {
-        fuelBurn1 = 0;
-        fuelLeftPre = 0;
+      //--------------------------------------------
+      // Outer tank transfer routine, only into inner tanks holding fuel
+      if (fuelPre[FuelTankLeft] > 0 && xfrValveOuterLeftOpen) {
+        fuelNetwork.addLine(FuelTankLeftAux, FuelTankLeft, 1);
+      }
+      if (fuelPre[FuelTankRight] > 0 && xfrValveOuterRightOpen) {
+        fuelNetwork.addLine(FuelTankRightAux, FuelTankRight, 1);
       }
 
       //--------------------------------------------
-      // Right Engine and Wing routine
-      if (fuelRightPre > 0) {
-        // Cycle Fuel Burn for Engine 2
-        if (devState != 2) {
-          m = (engine2FF - engine2PreFF) / deltaTime;
-          b = engine2PreFF;
-          fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
-        }
-        // Fuel transfer routine for Right Wing
-        if (xfrValveOuterRight1 > 0.0 || xfrValveOuterRight2 > 0.0)
-          xfrAuxRight = fuelAuxRightPre - rightAuxQuantity;
-      } else {
-        fuelBurn2 = 0;
-        fuelRightPre = 0;
-      }
+      // Fuel used accumulators
+      fuelUsedLeft += fuelNetwork.burn[0];
+      fuelUsedRight += fuelNetwork.burn[1];
 
       /// apu fuel consumption for this frame in pounds
       double apuFuelConsumption = simVars->getLineFlow(18) * fuelWeightGallon * deltaTime;
-      apuBurn1 = apuFuelConsumption;
-      apuBurn2 = 0;
 
       //--------------------------------------------
-      // Fuel used accumulators
-      fuelUsedLeft += fuelBurn1;
-      fuelUsedRight += fuelBurn2;
-
-      //--------------------------------------------
-      // Cross-feed fuel burn routine
-      // If fuel pumps for a given tank are closed,
-      // all fuel will be burnt on the other tank
-      switch (isTankClosed) {
-        case 1:
-          fuelBurn2 = fuelBurn1 + fuelBurn2;
-          fuelBurn1 = 0;
-          apuBurn1 = 0;
-          apuBurn2 = apuFuelConsumption;
-          break;
-        case 2:
-          fuelBurn1 = fuelBurn1 + fuelBurn2;
-          fuelBurn2 = 0;
-          break;
-        case 3:
-          fuelBurn1 = 0;
-          fuelBurn2 = 0;
-          apuBurn1 = apuFuelConsumption * 0.5;
-          apuBurn2 = apuFuelConsumption * 0.5;
-          break;
-        case 4:
-          apuBurn1 = apuFuelConsumption*0.5;
-          apuBurn2 = apuFuelConsumption*0.5;
-          break;
-        default:
-          break;
+      // Cross-feed routine
+      // If fuel pumps for a given tank are off with the
+      // x-feed valve open, all fuel is burnt from the other tank
+      if (xFeedValve > 0.0) {
+        if (leftPumpsOff && rightPumpsOff) {
+          fuelNetwork.feedTank = {fuelNetwork.NO_TANK, fuelNetwork.NO_TANK};
+          fuelNetwork.addDraw(FuelTankLeft, apuFuelConsumption * 0.5);
+          fuelNetwork.addDraw(FuelTankRight, apuFuelConsumption * 0.5);
+        } else if (leftPumpsOff) {
+          fuelNetwork.feedTank = {FuelTankRight, FuelTankRight};
+          fuelNetwork.addDraw(FuelTankRight, apuFuelConsumption);
+        } else if (rightPumpsOff) {
+          fuelNetwork.feedTank = {FuelTankLeft, FuelTankLeft};
+          fuelNetwork.addDraw(FuelTankLeft, apuFuelConsumption);
+        } else {
+          fuelNetwork.addDraw(FuelTankLeft, apuFuelConsumption * 0.5);
+          fuelNetwork.addDraw(FuelTankRight, apuFuelConsumption * 0.5);
+        }
+      } else {
+        fuelNetwork.addDraw(FuelTankLeft, apuFuelConsumption);
       }
 
       //--------------------------------------------
@@ -916,160 +347,49 @@ class EngineControl {
         else
           lineFlowRatio = lineLeftToCenterFlow / (lineLeftToCenterFlow + lineRightToCenterFlow);
 
-        xfrCenterToLeft = (fuelCenterPre - centerQuantity) * lineFlowRatio;
-        xfrCenterToRight = (fuelCenterPre - centerQuantity) * (1 - lineFlowRatio);
+        fuelNetwork.addLine(FuelTankCenter, FuelTankLeft, lineFlowRatio);
+        fuelNetwork.addLine(FuelTankCenter, FuelTankRight, 1 - lineFlowRatio);
       } else if (xfrValveCenterLeftOpen)
-        xfrCenterToLeft = fuelCenterPre - centerQuantity;
+        fuelNetwork.addLine(FuelTankCenter, FuelTankLeft, 1);
       else if (xfrValveCenterRightOpen)
-        xfrCenterToRight = fuelCenterPre - centerQuantity;
+        fuelNetwork.addLine(FuelTankCenter, FuelTankRight, 1);
 
       //--------------------------------------------
       // Final Fuel levels for left and right inner tanks
-      fuelLeft = (fuelLeftPre - (fuelBurn1 * KGS_TO_LBS)) + xfrAuxLeft + xfrCenterToLeft - apuBurn1;  // LBS
-      fuelRight = (fuelRightPre - (fuelBurn2 * KGS_TO_LBS)) + xfrAuxRight + xfrCenterToRight - apuBurn2;                   // LBS
+      fuelNetwork.step(KGS_TO_LBS);
+      double fuelLeft = fuelNetwork.quantity[FuelTankLeft];    // LBS
+      double fuelRight = fuelNetwork.quantity[FuelTankRight];  // LBS
 
       //--------------------------------------------
       // Setting new pre-cycle conditions
-      simVars->setEngine1PreFF(engine1FF);
-      simVars->setEngine2PreFF(engine2FF);
-      simVars->setFuelUsedLeft(fuelUsedLeft);         // in KG
-      simVars->setFuelUsedRight(fuelUsedRight);       // in KG
-      simVars->setFuelAuxLeftPre(leftAuxQuantity);    // in LBS
-      simVars->setFuelAuxRightPre(rightAuxQuantity);  // in LBS
-      simVars->setFuelCenterPre(centerQuantity);      // in LBS
+      simVars->setEngine1PreFF(engineFF[0]);
+      simVars->setEngine2PreFF(engineFF[1]);
+      simVars->setFuelUsedLeft(fuelUsedLeft);                     // in KG
+      simVars->setFuelUsedRight(fuelUsedRight);                   // in KG
+      simVars->setFuelAuxLeftPre(fuelActual[FuelTankLeftAux]);    // in LBS
+      simVars->setFuelAuxRightPre(fuelActual[FuelTankRightAux]);  // in LBS
+      simVars->setFuelCenterPre(fuelActual[FuelTankCenter]);      // in LBS
 
       simVars->setFuelLeftPre(fuelLeft);    // in LBS
       simVars->setFuelRightPre(fuelRight);  // in LBS
 
-      fuelLeft = (fuelLeft / fuelWeightGallon);    // USG
-      fuelRight = (fuelRight / fuelWeightGallon);  // USG
-
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
+      setFuelTank(FuelTankLeft, fuelLeft, fuelWeightGallon);
+      setFuelTank(FuelTankRight, fuelRight, fuelWeightGallon);
     }
 
     //--------------------------------------------
     // Will save the current fuel quantities if on
-    // the ground AND engines being shutdown
-    if (timerFuel.elapsed() >= 1000 && simVars->getSimOnGround() &&
+    // the ground AND engines being shutdown, the
+    // clock is only read once the rest holds
+    if (simVars->getSimOnGround() &&
         (engine1State == 0 || engine1State == 10 || engine1State == 4 || engine1State == 14 || engine2State == 0 || engine2State == 10 ||
-         engine2State == 4 || engine2State == 14)) {
-      Configuration configuration;
-
-      configuration.fuelLeft = simVars->getFuelLeftPre() / simVars->getFuelWeightGallon();
-      configuration.fuelRight = simVars->getFuelRightPre() / simVars->getFuelWeightGallon();
-      configuration.fuelCenter = simVars->getFuelCenterPre() / simVars->getFuelWeightGallon();
-      configuration.fuelLeftAux = simVars->getFuelAuxLeftPre() / simVars->getFuelWeightGallon();
-      configuration.fuelRightAux = simVars->getFuelAuxRightPre() / simVars->getFuelWeightGallon();
-
-      saveFuelInConfiguration(configuration);
-      timerFuel.reset();
-    }
-  }
-
-  void updateThrustLimits(double simulationTime,
-                          double altitude,
-                          double ambientTemp,
-                          double ambientPressure,
-                          double mach,
-                          double simN1highest,
-                          double packs,
-                          double nai,
-                          double wai) {
-    double idle = simVars->getEngineIdleN1();
-    double flexTemp = simVars->getFlexTemp();
-    double thrustLimitType = simVars->getThrustLimitType();
-    double to = 0;
-    double ga = 0;
-    double toga = 0;
-    double clb = 0;
-    double mct = 0;
-    double flex_to = 0;
-    double flex_ga = 0;
-    double flex = 0;
-
-    // Write all N1 Limits
-    to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    if (flexTemp > 0) {
-      flex_to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-      flex_ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-    }
-    clb = limitN1(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
-    mct = limitN1(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
-
-    // transition between TO and GA limit -----------------------------------------------------------------------------
-    double machFactorLow = max(0.0, min(1.0, (mach - 0.04) / 0.04));
-    toga = to + (ga - to) * machFactorLow;
-    flex = flex_to + (flex_ga - flex_to) * machFactorLow;
-
-    // adaption of CLB due to FLX limit if necessary ------------------------------------------------------------------
-
-    if ((prevThrustLimitType != 3 && thrustLimitType == 3) || (prevFlexTemperature == 0 && flexTemp > 0)) {
-      isFlexActive = true;
-    } else if ((flexTemp == 0) || (thrustLimitType == 4)) {
-      isFlexActive = false;
-    }
-
-    if (isFlexActive && !isTransitionActive && thrustLimitType == 1) {
-      isTransitionActive = true;
-      transitionStartTime = simulationTime;
-      transitionFactor = 0.2;
-      // transitionFactor = (clb - flex) / transitionTime;
-    } else if (!isFlexActive) {
-      isTransitionActive = false;
-      transitionStartTime = 0;
-      transitionFactor = 0;
-    }
-
-    double deltaThrust = 0;
-
-    if (isTransitionActive) {
-      double timeDifference = max(0, (simulationTime - transitionStartTime) - waitTime);
-
-      if (timeDifference > 0 && clb > flex) {
-        deltaThrust = min(clb - flex, timeDifference * transitionFactor);
-      }
-
-      if (flex + deltaThrust >= clb) {
-        isFlexActive = false;
-        isTransitionActive = false;
-      }
-    }
-
-    if (isFlexActive) {
-      clb = min(clb, flex) + deltaThrust;
-    }
-
-    prevThrustLimitType = thrustLimitType;
-    prevFlexTemperature = flexTemp;
-
-    // thrust transitions for MCT and TOGA ----------------------------------------------------------------------------
-
-    // get factors
-    double machFactor = max(0.0, min(1.0, ((mach - 0.37) / 0.05)));
-    double altitudeFactorLow = max(0.0, min(1.0, ((altitude - 16600) / 500)));
-    double altitudeFactorHigh = max(0.0, min(1.0, ((altitude - 25000) / 500)));
-
-    // adapt thrust limits
-    if (altitude >= 25000) {
-      mct = max(clb, mct + (clb - mct) * altitudeFactorHigh);
-      toga = mct;
-    } else {
-      if (mct > toga) {
-        mct = toga + (mct - toga) * min(1.0, altitudeFactorLow + machFactor);
-        toga = mct;
-      } else {
-        toga = toga + (mct - toga) * min(1.0, altitudeFactorLow + machFactor);
+         engine2State == 4 || engine2State == 14) &&
+        timerFuel.elapsed() >= 1000) {
+      if (fuelStateSaving) {
+        saveFuelState(fuelConfiguration());
       }
+      timerFuel.reset();
     }
-
-    // write limits ---------------------------------------------------------------------------------------------------
-    simVars->setThrustLimitIdle(idle);
-    simVars->setThrustLimitToga(toga);
-    simVars->setThrustLimitFlex(flex);
-    simVars->setThrustLimitClimb(clb);
-    simVars->setThrustLimitMct(mct);
   }
 
  public:
@@ -1084,13 +404,9 @@ class EngineControl {
     simVars = new SimVars();
     double engTime = 0;
     ambientTemp = simVars->getAmbientTemperature();
-    simN2LeftPre = simVars->getN2(1);
-    simN2RightPre = simVars->getN2(2);
-
-    confFilename += acftRegistration;
-    confFilename += FILENAME_FADEC_CONF_FILE_EXTENSION;
+    simNCorePre = {simVars->getN2(1), simVars->getN2(2)};
 
-    Configuration configuration = getConfigurationFromFile();
+    Configuration configuration = initializeFuelState(acftRegistration);
 
     // One-off Engine imbalance
     generateEngineImbalance(1);
@@ -1102,7 +418,8 @@ class EngineControl {
       paramImbalance = 0;
     }
 
-    for (engine = 1; engine <= 2; engine++) {
+    forEachEngine([&](auto i) {
+      int engine = i + 1;
       // Obtain Engine Time
       engTime = simVars->getEngineTime(engine) + engTime;
 
@@ -1117,37 +434,28 @@ class EngineControl {
       idleOil = initOil(140, 200);
 
       // Setting initial Oil
-      if (engine == 1) {
-        simVars->setEngine1OilTotal(idleOil - paramImbalance);
-      } else {
-        simVars->setEngine2OilTotal(idleOil - paramImbalance);
-      }
-    }
+      simVars->setEngineOilTotal(engine, idleOil - paramImbalance);
+    });
 
     // Setting initial Oil Temperature
-    thermalEnergy1 = 0;
-    thermalEnergy2 = 0;
+    thermalEnergy = {0, 0};
     oilTemperatureMax = imbalanceExtractor(imbalance, 8);
     simOnGround = simVars->getSimOnGround();
     double engine1Combustion = simVars->getEngineCombustion(1);
     double engine2Combustion = simVars->getEngineCombustion(2);
 
     if (simOnGround == 1 && engine1Combustion == 1 && engine2Combustion == 1) {
-      oilTemperatureLeftPre = 75;
-      oilTemperatureRightPre = 75;
+      oilTemperaturePre = {75, 75};
     } else if (simOnGround == 0 && engine1Combustion == 1 && engine2Combustion == 1) {
-      oilTemperatureLeftPre = 85;
-      oilTemperatureRightPre = 85;
-
+      oilTemperaturePre = {85, 85};
     } else {
-      oilTemperatureLeftPre = ambientTemp;
-      oilTemperatureRightPre = ambientTemp;
+      oilTemperaturePre = {ambientTemp, ambientTemp};
     }
 
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureLeftPre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureRightPre);
+    forEachEngine([&](auto i) {
+      SimConnect_SetDataOnSimObject(hSimConnect, A32nxEngineTraits::OIL_TEMPERATURE[i], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &oilTemperaturePre[i]);
+    });
 
     // Initialize Engine State
     simVars->setEngine1State(10);
@@ -1181,7 +489,6 @@ class EngineControl {
   /// </summary>
   void update(double deltaTime, double simulationTime) {
     double prevAnimationDeltaTime;
-    double simN1highest = 0;
 
     // animationDeltaTimes being used to detect a Paused situation
     prevAnimationDeltaTime = animationDeltaTime;
@@ -1192,7 +499,6 @@ class EngineControl {
     ambientTemp = simVars->getAmbientTemperature();
     ambientPressure = simVars->getAmbientPressure();
     simOnGround = simVars->getSimOnGround();
-    imbalance = simVars->getEngineImbalance();
     packs = 0;
     nai = 0;
     wai = 0;
@@ -1208,103 +514,13 @@ class EngineControl {
 
     generateIdleParameters(pressAltitude, mach, ambientTemp, ambientPressure);
 
-    // Timer timer;
-    for (engine = 1; engine <= 2; engine++) {
-      engineStarter = simVars->getEngineStarter(engine);
-      engineIgniter = simVars->getEngineIgniter(engine);
-      simCN1 = simVars->getCN1(engine);
-      simN1 = simVars->getN1(engine);
-      simN2 = simVars->getN2(engine);
-      thrust = simVars->getThrust(engine);
-
-      // Set & Check Engine Status for this Cycle
-      engineStateMachine(engine, engineIgniter, engineStarter, simN2, idleN2, pressAltitude, ambientTemp,
-                         animationDeltaTime - prevAnimationDeltaTime);
-      if (engine == 1) {
-        engineState = simVars->getEngine1State();
-        deltaN2 = simN2 - simN2LeftPre;
-        simN2LeftPre = simN2;
-        timer = simVars->getEngine1Timer();
-      } else {
-        engineState = simVars->getEngine2State();
-        deltaN2 = simN2 - simN2RightPre;
-        simN2RightPre = simN2;
-        timer = simVars->getEngine2Timer();
-      }
-
-      switch (int(engineState)) {
-        case 2:
-        case 3:
-          engineStartProcedure(engine, engineState, imbalance, deltaTime, timer, simN2, pressAltitude, ambientTemp);
-          break;
-        case 4:
-          engineShutdownProcedure(engine, ambientTemp, simN1, deltaTime, timer);
-          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
-          break;
-        default:
-          updatePrimaryParameters(engine, imbalance, simN1, simN2);
-          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
-          updateEGT(engine, imbalance, deltaTime, simOnGround, engineState, simCN1, cFbwFF, mach, pressAltitude, ambientTemp);
-          // updateOil(engine, imbalance, thrust, simN2, deltaN2, deltaTime, ambientTemp);
-      }
-
-      // set highest N1 from either engine
-      simN1highest = max(simN1highest, simN1);
-    }
+    updateEngines(deltaTime, animationDeltaTime - prevAnimationDeltaTime, mach, pressAltitude, ambientTemp, ambientPressure);
 
     updateFuel(deltaTime);
 
-    updateThrustLimits(simulationTime, pressAltitude, ambientTemp, ambientPressure, mach, simN1highest, packs, nai, wai);
-    // timer.elapsed();
+    updateThrustLimits(simulationTime, pressAltitude, ambientTemp, ambientPressure, mach, packs, nai, wai);
   }
 
-  void terminate() {}
-
-  Configuration getConfigurationFromFile() {
-    Configuration configuration;
-    mINI::INIStructure stInitStructure;
-
-    mINI::INIFile iniFile(confFilename);
-
-    if (!iniFile.read(stInitStructure)) {
-      std::cout << "EngineControl: failed to read configuration file " << confFilename << " due to error \"" << strerror(errno)
-                << "\" -> use default main/aux/center: " << configuration.fuelLeft << "/" << configuration.fuelLeftAux << "/"
-                << configuration.fuelCenter << std::endl;
-    } else {
-      configuration = loadConfiguration(stInitStructure);
-    }
-
-    return configuration;
-  }
-
-  Configuration loadConfiguration(const mINI::INIStructure& structure) {
-    return {
-        mINI::INITypeConversion::getDouble(structure, CONFIGURATION_SECTION_FUEL, CONFIGURATION_SECTION_FUEL_CENTER_QUANTITY, 0),
-        mINI::INITypeConversion::getDouble(structure, CONFIGURATION_SECTION_FUEL, CONFIGURATION_SECTION_FUEL_LEFT_QUANTITY, 400.0),
-        mINI::INITypeConversion::getDouble(structure, CONFIGURATION_SECTION_FUEL, CONFIGURATION_SECTION_FUEL_RIGHT_QUANTITY, 400.0),
-        mINI::INITypeConversion::getDouble(structure, CONFIGURATION_SECTION_FUEL, CONFIGURATION_SECTION_FUEL_LEFT_AUX_QUANTITY, 228.0),
-        mINI::INITypeConversion::getDouble(structure, CONFIGURATION_SECTION_FUEL, CONFIGURATION_SECTION_FUEL_RIGHT_AUX_QUANTITY, 228.0),
-    };
-  }
-
-  void saveFuelInConfiguration(Configuration configuration) {
-    mINI::INIStructure stInitStructure;
-    mINI::INIFile iniFile(confFilename);
-
-    // Do not check a possible error since the file may not exist yet
-    iniFile.read(stInitStructure);
-
-    stInitStructure[CONFIGURATION_SECTION_FUEL][CONFIGURATION_SECTION_FUEL_CENTER_QUANTITY] = std::to_string(configuration.fuelCenter);
-    stInitStructure[CONFIGURATION_SECTION_FUEL][CONFIGURATION_SECTION_FUEL_LEFT_QUANTITY] = std::to_string(configuration.fuelLeft);
-    stInitStructure[CONFIGURATION_SECTION_FUEL][CONFIGURATION_SECTION_FUEL_RIGHT_QUANTITY] = std::to_string(configuration.fuelRight);
-    stInitStructure[CONFIGURATION_SECTION_FUEL][CONFIGURATION_SECTION_FUEL_LEFT_AUX_QUANTITY] = std::to_string(configuration.fuelLeftAux);
-    stInitStructure[CONFIGURATION_SECTION_FUEL][CONFIGURATION_SECTION_FUEL_RIGHT_AUX_QUANTITY] = std::to_string(configuration.fuelRightAux);
-
-    if (!iniFile.write(stInitStructure, true)) {
-      std::cout << "EngineControl: failed to write engine conf " << confFilename << " due to error \"" << strerror(errno) << "\""
-                << std::endl;
-    }
-  }
 };
 
 EngineControl EngineControlInstance;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 /// <summary>
 /// SimConnect data types to send to Sim Updated
 /// </summary>
@@ -155,6 +157,19 @@ class SimVars {
   ID PacksState1;
   ID PacksState2;
 
+  /// <summary>
+  /// Per-engine LVars in engine order, read and written by the indexed accessors
+  /// </summary>
+  std::array<ID, 2> EngineStates;
+  std::array<ID, 2> EngineTimers;
+  std::array<ID, 2> EnginesN1;
+  std::array<ID, 2> EnginesN2;
+  std::array<ID, 2> EngineEGTs;
+  std::array<ID, 2> EngineFFs;
+  std::array<ID, 2> EngineOils;
+  std::array<ID, 2> EngineOilTotals;
+  std::array<ID, 2> EngineFuelUsed;
+
   SimVars() { this->initializeVars(); }
 
   void initializeVars() {
@@ -211,6 +226,16 @@ class SimVars {
     PacksState1 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_1_IS_OPEN");
     PacksState2 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_2_IS_OPEN");
 
+    EngineStates = {Engine1State, Engine2State};
+    EngineTimers = {Engine1Timer, Engine2Timer};
+    EnginesN1 = {Engine1N1, Engine2N1};
+    EnginesN2 = {Engine1N2, Engine2N2};
+    EngineEGTs = {Engine1EGT, Engine2EGT};
+    EngineFFs = {Engine1FF, Engine2FF};
+    EngineOils = {Engine1Oil, Engine2Oil};
+    EngineOilTotals = {Engine1OilTotal, Engine2OilTotal};
+    EngineFuelUsed = {FuelUsedLeft, FuelUsedRight};
+
     this->setDeveloperState(0);
     this->setEngine1N2(0);
     this->setEngine2N2(0);
@@ -301,6 +326,17 @@ class SimVars {
   void setThrustLimitClimb(FLOAT64 value) { set_named_variable_value(ThrustLimitClimb, value); }
   void setThrustLimitMct(FLOAT64 value) { set_named_variable_value(ThrustLimitMct, value); }
 
+  // Collection of per-engine LVar 'set' Functions, the engine index starts at 1
+  void setEngineState(int engine, FLOAT64 value) { set_named_variable_value(EngineStates[engine - 1], value); }
+  void setEngineTimer(int engine, FLOAT64 value) { set_named_variable_value(EngineTimers[engine - 1], value); }
+  void setEngineN1(int engine, FLOAT64 value) { set_named_variable_value(EnginesN1[engine - 1], value); }
+  void setEngineN2(int engine, FLOAT64 value) { set_named_variable_value(EnginesN2[engine - 1], value); }
+  void setEngineEGT(int engine, FLOAT64 value) { set_named_variable_value(EngineEGTs[engine - 1], value); }
+  void setEngineFF(int engine, FLOAT64 value) { set_named_variable_value(EngineFFs[engine - 1], value); }
+  void setEngineOil(int engine, FLOAT64 value) { set_named_variable_value(EngineOils[engine - 1], value); }
+  void setEngineOilTotal(int engine, FLOAT64 value) { set_named_variable_value(EngineOilTotals[engine - 1], value); }
+  void setEngineFuelUsed(int engine, FLOAT64 value) { set_named_variable_value(EngineFuelUsed[engine - 1], value); }
+
   // Collection of SimVar/LVar 'get' Functions
   FLOAT64 getDeveloperState() { return get_named_variable_value(DevVar); }
   FLOAT64 getIsReady() { return get_named_variable_value(IsReady); }
@@ -344,6 +380,15 @@ class SimVars {
   FLOAT64 getPacksState2() { return get_named_variable_value(PacksState2); }
   FLOAT64 getThrustLimitType() { return get_named_variable_value(ThrustLimitType); }
 
+  // Collection of per-engine LVar 'get' Functions, the engine index starts at 1
+  FLOAT64 getEngineState(int engine) { return get_named_variable_value(EngineStates[engine - 1]); }
+  FLOAT64 getEngineTimer(int engine) { return get_named_variable_value(EngineTimers[engine - 1]); }
+  FLOAT64 getEngineN1(int engine) { return get_named_variable_value(EnginesN1[engine - 1]); }
+  FLOAT64 getEngineN2(int engine) { return get_named_variable_value(EnginesN2[engine - 1]); }
+  FLOAT64 getEngineEGT(int engine) { return get_named_variable_value(EngineEGTs[engine - 1]); }
+  FLOAT64 getEngineOil(int engine) { return get_named_variable_value(EngineOils[engine - 1]); }
+  FLOAT64 getEngineOilTotal(int engine) { return get_named_variable_value(EngineOilTotals[engine - 1]); }
+
   FLOAT64 getCN1(int index) { return aircraft_varget(CorrectedN1, m_Units->Percent, index); }
   FLOAT64 getCN2(int index) { return aircraft_varget(CorrectedN2, m_Units->Percent, index); }
   FLOAT64 getN1(int index) { return aircraft_varget(N1, m_Units->Percent, index); }
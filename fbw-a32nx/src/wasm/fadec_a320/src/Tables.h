@@ -3,20 +3,44 @@
 #include "SimVars.h"
 #include "common.h"
 
-EngineRatios* ratios;
-
 /// <summary>
 /// Table 1502 (CN2 vs correctedN1) representations with FSX nomenclature
+/// Columns: CN2, correctedN1 at M0.2 (x2), correctedN1 at M0.9
+/// </summary>
+constexpr int TABLE1502_ROWS = 13;
+constexpr double TABLE1502[TABLE1502_ROWS][4] = {
+    {18.20, 0.00, 0.00, 17.00}, {22.00, 1.90, 1.90, 17.40}, {26.00, 2.50, 2.50, 18.20},
+    {57.00, 12.80, 12.80, 27.00}, {68.20, 19.60, 19.60, 34.83}, {77.00, 26.00, 26.00, 40.84},
+    {83.00, 31.42, 31.42, 44.77}, {89.00, 40.97, 40.97, 50.09}, {92.80, 51.00, 51.00, 55.04},
+    {97.00, 65.00, 65.00, 65.00}, {100.00, 77.00, 77.00, 77.00}, {104.00, 85.00, 85.00, 85.50},
+    {116.50, 101.00, 101.00, 101.00}};
+
+/// <summary>
+/// Table 1502 lookup
 /// </summary>
 /// <returns>Returns CN2 - correctedN1 pair.</returns>
 double table1502(int i, int j) {
-  double t[13][4] = {{18.20, 0.00, 0.00, 17.00},      {22.00, 1.90, 1.90, 17.40},    {26.00, 2.50, 2.50, 18.20},
-                     {57.00, 12.80, 12.80, 27.00},    {68.20, 19.60, 19.60, 34.83},  {77.00, 26.00, 26.00, 40.84},
-                     {83.00, 31.42, 31.42, 44.77},    {89.00, 40.97, 40.97, 50.09},  {92.80, 51.00, 51.00, 55.04},
-                     {97.00, 65.00, 65.00, 65.00},    {100.00, 77.00, 77.00, 77.00}, {104.00, 85.00, 85.00, 85.50},
-                     {116.50, 101.00, 101.00, 101.00}};
+  return TABLE1502[i][j];
+}
+
+/// <summary>
+/// Binary search for the table 1502 interval containing the given CN2
+/// </summary>
+/// <returns>Returns the upper row of the interval, clamped to [1, TABLE1502_ROWS - 1].</returns>
+int table1502Row(double cn2) {
+  int lo = 1;
+  int hi = TABLE1502_ROWS - 1;
+
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (TABLE1502[mid][0] > cn2) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
 
-  return t[i][j];
+  return lo;
 }
 
 /// <summary>
@@ -37,16 +61,10 @@ double iCN1(double pressAltitude, double mach, double ambientTemp) {
   int i;
   double cn1_lo = 0, cn1_hi = 0, cn1 = 0;
   double cn2 = iCN2(pressAltitude, mach);
-  double cell = 0;
   double cn2lo = 0, cn2hi = 0;
   double cn1lolo = 0, cn1hilo = 0, cn1lohi = 0, cn1hihi = 0;
 
-  for (i = 0; i < 13; i++) {
-    cell = table1502(i, 0);
-    if (cell > cn2) {
-      break;
-    }
-  }
+  i = table1502Row(cn2);
 
   cn2lo = table1502(i - 1, 0);
   cn2hi = table1502(i, 0);
@@ -66,4 +84,4 @@ double iCN1(double pressAltitude, double mach, double ambientTemp) {
   }
 
   return cn1;
-}
\ No newline at end of file
+}
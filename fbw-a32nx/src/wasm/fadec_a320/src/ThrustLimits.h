@@ -248,9 +248,9 @@ limitN1(int type, double altitude, double ambientTemp, double ambientPressure, d
   bleed = bleedTotal(type, altitude, ambientTemp, cp, lp, flexTemp, ac, nacelle, wing);
 
   // Setting N1
-  n1 = (cn1 * sqrt(ratios->theta2(mach, ambientTemp))) + bleed;
+  n1 = (cn1 * sqrt(EngineRatios::theta2(mach, ambientTemp))) + bleed;
   /*if (type == 3) {
-    std::cout << "FADEC: bleed= " << bleed << " cn1= " << cn1 << " theta2= " << sqrt(ratios->theta2(mach, ambientTemp))
+    std::cout << "FADEC: bleed= " << bleed << " cn1= " << cn1 << " theta2= " << sqrt(EngineRatios::theta2(mach, ambientTemp))
               << " n1= " << n1 << std::endl;
   }*/
   return n1;
@@ -1,7 +1,7 @@
 #include "Arinc429.h"
 
 template <typename T>
-Arinc429Word<T>::Arinc429Word() {}
+Arinc429Word<T>::Arinc429Word() : rawSsm(0), rawData(0) {}
 
 template <typename T>
 void Arinc429Word<T>::setFromSimVar(double simVar) {
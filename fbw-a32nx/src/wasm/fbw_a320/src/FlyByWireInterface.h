@@ -13,6 +13,7 @@
 #include "FlightDataRecorder.h"
 #include "InterpolatingLookupTable.h"
 #include "LocalVariable.h"
+#include "ModelSnapshot.h"
 #include "RateLimiter.h"
 #include "SimConnectInterface.h"
 #include "SpoilersHandler.h"
@@ -35,7 +36,14 @@ class FlyByWireInterface {
 
   bool update(double sampleTime);
 
+  void snapshot(std::vector<uint8_t>& blob) const;
+
+  bool restore(const std::vector<uint8_t>& blob);
+
  private:
+  static constexpr uint32_t SNAPSHOT_MAGIC = 0x53574246;  // "FBWS"
+  static constexpr uint32_t SNAPSHOT_VERSION = 2;
+
   const std::string CONFIGURATION_FILEPATH = "\\work\\ModelConfiguration.ini";
 
   static constexpr double MAX_ACCEPTABLE_SAMPLE_TIME = 0.11;
@@ -620,6 +628,10 @@ class FlyByWireInterface {
 
   bool updateAltimeterSetting(double sampleTime);
 
+  void writeComputerStates(ModelSnapshotWriter& writer) const;
+
+  bool readComputerStates(ModelSnapshotReader& reader);
+
   double getTcasModeAvailable();
 
   double getTcasAdvisoryState();
@@ -3,10 +3,12 @@
 
 Elac::Elac(bool isUnit1) : isUnit1(isUnit1) {
   elacComputer.initialize();
+  modelOutputs = elacComputer.getExternalOutputs().out;
 }
 
 Elac::Elac(const Elac& obj) : isUnit1(obj.isUnit1) {
   elacComputer.initialize();
+  modelOutputs = elacComputer.getExternalOutputs().out;
 }
 
 void Elac::clearMemory() {}
@@ -36,10 +38,16 @@ void Elac::update(double deltaTime, double simulationTime, bool faultActive, boo
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  elacComputer.setExternalInputs(&modelInputs);
+  // The model only latches its stopped state while the computer is not running, so it is stepped once when the computer
+  // stops and skipped while it is dormant (unpowered or failed). Its outputs stay frozen like on the real unit, the
+  // getters report them as failed where applicable.
+  if (modelInputs.in.sim_data.computer_running || modelRunning) {
+    elacComputer.setExternalInputs(&modelInputs);
+    modelRunning = modelInputs.in.sim_data.computer_running;
+    elacComputer.step();
+    modelOutputs = elacComputer.getExternalOutputs().out;
+  }
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
-  elacComputer.step();
-  modelOutputs = elacComputer.getExternalOutputs().out;
 }
 
 // Perform self monitoring
@@ -159,3 +167,24 @@ base_elac_analog_outputs Elac::getAnalogOutputs() {
 
   return output;
 }
+
+// Write the computer state (monitoring and model) to a snapshot.
+void Elac::snapshot(ModelSnapshotWriter& writer) const {
+  writer.write(modelInputs);
+  elacComputer.snapshot(writer);
+  writer.write(modelOutputs);
+  writer.write(modelRunning);
+  writer.write(monitoringHealthy);
+  writer.write(prevEngageButtonWasPressed);
+  writer.write(powerSupplyOutageTime);
+  writer.write(powerSupplyFault);
+  writer.write(selfTestTimer);
+  writer.write(selfTestComplete);
+}
+
+// Read the computer state back from a snapshot.
+bool Elac::restore(ModelSnapshotReader& reader) {
+  return reader.read(modelInputs) && elacComputer.restore(reader) && reader.read(modelOutputs) && reader.read(modelRunning) &&
+         reader.read(monitoringHealthy) && reader.read(prevEngageButtonWasPressed) && reader.read(powerSupplyOutageTime) &&
+         reader.read(powerSupplyFault) && reader.read(selfTestTimer) && reader.read(selfTestComplete);
+}
@@ -23,6 +23,10 @@ class Elac {
 
   base_elac_analog_outputs getAnalogOutputs();
 
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+
   ElacComputer::ExternalInputs_ElacComputer_T modelInputs = {};
 
  private:
@@ -41,6 +45,8 @@ class Elac {
   // Model
   ElacComputer elacComputer;
   elac_outputs modelOutputs;
+  // true if the computer was running during the last model step
+  bool modelRunning = false;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -20,6 +20,10 @@ class Fac {
 
   base_fac_analog_outputs getAnalogOutputs();
 
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+
   FacComputer::ExternalInputs_FacComputer_T modelInputs = {};
 
  private:
@@ -36,6 +40,8 @@ class Fac {
   // Model
   FacComputer facComputer;
   fac_outputs modelOutputs;
+  // true if the computer was running during the last model step
+  bool modelRunning = false;
 
   // Computer Self-monitoring vars
   bool facHealthy;
@@ -389,14 +389,14 @@ void Fcdc::computeActiveSystemLaws() {
 }
 
 void Fcdc::computeSidestickPriorityLights(double deltaTime) {
-  bool leftSidestickDisabledRoll;
-  bool rightSidestickDisabledRoll;
-  bool leftSidestickDisabledPitch;
-  bool rightSidestickDisabledPitch;
-  bool leftSidestickPriorityLockedRoll;
-  bool rightSidestickPriorityLockedRoll;
-  bool leftSidestickPriorityLockedPitch;
-  bool rightSidestickPriorityLockedPitch;
+  bool leftSidestickDisabledRoll = false;
+  bool rightSidestickDisabledRoll = false;
+  bool leftSidestickDisabledPitch = false;
+  bool rightSidestickDisabledPitch = false;
+  bool leftSidestickPriorityLockedRoll = false;
+  bool rightSidestickPriorityLockedRoll = false;
+  bool leftSidestickPriorityLockedPitch = false;
+  bool rightSidestickPriorityLockedPitch = false;
 
   // Compute if a sidestick has lost priority (per computer). Use the computer that is engaged in the respective axis.
   if (elac1EngagedInRoll) {
@@ -795,3 +795,73 @@ FcdcDiscreteOutputs Fcdc::getDiscreteOutputs() {
 
   return output;
 }
+
+// Write the computer state (monitoring, sidestick priority and the consolidated data kept while unhealthy) to a snapshot.
+void Fcdc::snapshot(ModelSnapshotWriter& writer) const {
+  writer.write(discreteInputs);
+  writer.write(busInputs);
+  writer.write(elac1EngagedInRoll);
+  writer.write(elac2EngagedInRoll);
+  writer.write(sec1EngagedInRoll);
+  writer.write(sec2EngagedInRoll);
+  writer.write(sec3EngagedInRoll);
+  writer.write(elac1EngagedInPitch);
+  writer.write(elac2EngagedInPitch);
+  writer.write(sec1EngagedInPitch);
+  writer.write(sec2EngagedInPitch);
+  writer.write(systemPitchLaw);
+  writer.write(systemLateralLaw);
+  writer.write(leftAileronPos);
+  writer.write(leftAileronPosValid);
+  writer.write(rightAileronPos);
+  writer.write(rightAileronPosValid);
+  writer.write(leftElevatorPos);
+  writer.write(leftElevatorPosValid);
+  writer.write(rightElevatorPos);
+  writer.write(rightElevatorPosValid);
+  writer.write(thsPos);
+  writer.write(thsPosValid);
+  writer.write(rollSidestickPosCapt);
+  writer.write(rollSidestickPosCaptValid);
+  writer.write(rollSidestickPosFo);
+  writer.write(rollSidestickPosFoValid);
+  writer.write(pitchSidestickPosCapt);
+  writer.write(pitchSidestickPosCaptValid);
+  writer.write(pitchSidestickPosFo);
+  writer.write(pitchSidestickPosFoValid);
+  writer.write(rudderPedalPos);
+  writer.write(rudderPedalPosValid);
+  writer.write(leftSidestickDisabled);
+  writer.write(rightSidestickDisabled);
+  writer.write(leftSidestickPriorityLocked);
+  writer.write(rightSidestickPriorityLocked);
+  writer.write(leftRedPriorityLightOn);
+  writer.write(rightRedPriorityLightOn);
+  writer.write(leftGreenPriorityLightOn);
+  writer.write(rightGreenPriorityLightOn);
+  writer.write(priorityLightFlashingClock);
+  writer.write(monitoringHealthy);
+  writer.write(powerSupplyOutageTime);
+  writer.write(powerSupplyFault);
+  writer.write(selfTestTimer);
+  writer.write(selfTestComplete);
+}
+
+// Read the computer state back from a snapshot.
+bool Fcdc::restore(ModelSnapshotReader& reader) {
+  return reader.read(discreteInputs) && reader.read(busInputs) && reader.read(elac1EngagedInRoll) && reader.read(elac2EngagedInRoll) &&
+         reader.read(sec1EngagedInRoll) && reader.read(sec2EngagedInRoll) && reader.read(sec3EngagedInRoll) &&
+         reader.read(elac1EngagedInPitch) && reader.read(elac2EngagedInPitch) && reader.read(sec1EngagedInPitch) &&
+         reader.read(sec2EngagedInPitch) && reader.read(systemPitchLaw) && reader.read(systemLateralLaw) && reader.read(leftAileronPos) &&
+         reader.read(leftAileronPosValid) && reader.read(rightAileronPos) && reader.read(rightAileronPosValid) &&
+         reader.read(leftElevatorPos) && reader.read(leftElevatorPosValid) && reader.read(rightElevatorPos) &&
+         reader.read(rightElevatorPosValid) && reader.read(thsPos) && reader.read(thsPosValid) && reader.read(rollSidestickPosCapt) &&
+         reader.read(rollSidestickPosCaptValid) && reader.read(rollSidestickPosFo) && reader.read(rollSidestickPosFoValid) &&
+         reader.read(pitchSidestickPosCapt) && reader.read(pitchSidestickPosCaptValid) && reader.read(pitchSidestickPosFo) &&
+         reader.read(pitchSidestickPosFoValid) && reader.read(rudderPedalPos) && reader.read(rudderPedalPosValid) &&
+         reader.read(leftSidestickDisabled) && reader.read(rightSidestickDisabled) && reader.read(leftSidestickPriorityLocked) &&
+         reader.read(rightSidestickPriorityLocked) && reader.read(leftRedPriorityLightOn) && reader.read(rightRedPriorityLightOn) &&
+         reader.read(leftGreenPriorityLightOn) && reader.read(rightGreenPriorityLightOn) && reader.read(priorityLightFlashingClock) &&
+         reader.read(monitoringHealthy) && reader.read(powerSupplyOutageTime) && reader.read(powerSupplyFault) &&
+         reader.read(selfTestTimer) && reader.read(selfTestComplete);
+}
@@ -2,6 +2,8 @@
 
 #include "FcdcIO.h"
 
+#include "ModelSnapshot.h"
+
 const double LIGHT_FLASHING_PERIOD = 0.25;
 
 class Fcdc {
@@ -14,6 +16,10 @@ class Fcdc {
 
   FcdcDiscreteOutputs getDiscreteOutputs();
 
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+
   FcdcDiscreteInputs discreteInputs;
 
   FcdcBusInputs busInputs;
@@ -2,6 +2,7 @@
 #define RTW_HEADER_AutopilotStateMachine_h_
 #include <cmath>
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "AutopilotStateMachine_types.h"
 
 #include "multiword_types.h"
@@ -42,6 +43,14 @@ class AutopilotStateMachineModelClass
     real_T eventTimeMR;
     real_T lastVsTarget;
     real_T nav_gs_deg;
+    real_T nav_loc_lat_deg;
+    real_T nav_loc_magvar_deg;
+    real_T nav_loc_cos_lat;
+    real_T nav_loc_sin_lat;
+    real_T nav_loc_magvar_correction_deg;
+    real_T nav_gs_lat_deg;
+    real_T nav_gs_cos_lat;
+    real_T nav_gs_sin_lat;
     real_T eventTime;
     real_T eventTime_n;
     real_T eventTime_m;
@@ -108,6 +117,8 @@ class AutopilotStateMachineModelClass
     boolean_T sRollOutActive;
     boolean_T sGoAroundModeActive;
     boolean_T nav_gs_deg_not_empty;
+    boolean_T nav_loc_terms_not_empty;
+    boolean_T nav_gs_terms_not_empty;
     boolean_T prev_FDES_active;
     boolean_T prev_FDES_armed;
     boolean_T eventTime_not_empty;
@@ -265,6 +276,8 @@ class AutopilotStateMachineModelClass
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   AutopilotStateMachineModelClass();
   ~AutopilotStateMachineModelClass();
  private:
@@ -272,9 +285,7 @@ class AutopilotStateMachineModelClass
   ExternalOutputs_AutopilotStateMachine_T AutopilotStateMachine_Y;
   BlockIO_AutopilotStateMachine_T AutopilotStateMachine_B;
   D_Work_AutopilotStateMachine_T AutopilotStateMachine_DWork;
-  static Parameters_AutopilotStateMachine_T AutopilotStateMachine_P;
-  static void AutopilotStateMachine_BitShift(real_T rtu_u, real_T *rty_y);
-  static void AutopilotStateMachine_BitShift1(real_T rtu_u, real_T *rty_y);
+  static const Parameters_AutopilotStateMachine_T AutopilotStateMachine_P;
   boolean_T AutopilotStateMachine_X_TO_OFF(const ap_sm_output *BusAssignment);
   boolean_T AutopilotStateMachine_X_TO_GA_TRK(const ap_sm_output *BusAssignment);
   boolean_T AutopilotStateMachine_ON_TO_HDG(const ap_sm_output *BusAssignment);
@@ -1,6 +1,7 @@
 #include "Autothrust.h"
 #include "Autothrust_private.h"
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T Autothrust_IN_InAir{ 1U };
 
@@ -676,8 +677,8 @@ void AutothrustModelClass::step()
   Autothrust_LeadLagFilter(Autothrust_P.ktstomps_Gain_h * rtb_Switch_m, Autothrust_P.LowPassFilter_C1,
     Autothrust_P.LowPassFilter_C2, Autothrust_P.LowPassFilter_C3, Autothrust_P.LowPassFilter_C4, Autothrust_U.in.time.dt,
     &rtb_Switch_m, &Autothrust_DWork.sf_LeadLagFilter_h);
-  rtb_Cos1 = (rtb_Switch_dx + rtb_Switch_m) * Autothrust_P.mpstokts_Gain * Autothrust_P.Gain4_Gain * look1_binlxpw
-    (rtb_Y_m, Autothrust_P.ScheduledGain1_BreakpointsForDimension1, Autothrust_P.ScheduledGain1_Table, 4U) + rtb_Y_m;
+  rtb_Cos1 = (rtb_Switch_dx + rtb_Switch_m) * Autothrust_P.mpstokts_Gain * Autothrust_P.Gain4_Gain * look1_binlxpw<4U>
+    (rtb_Y_m, Autothrust_P.ScheduledGain1_BreakpointsForDimension1, Autothrust_P.ScheduledGain1_Table) + rtb_Y_m;
   rtb_Cos = Autothrust_P.DiscreteDerivativeVariableTs_Gain * rtb_Cos1;
   Autothrust_LagFilter((rtb_Cos - Autothrust_DWork.Delay_DSTATE) / Autothrust_U.in.time.dt, Autothrust_P.LagFilter_C1,
                        Autothrust_U.in.time.dt, &rtb_Y_m, &Autothrust_DWork.sf_LagFilter);
@@ -710,10 +711,10 @@ void AutothrustModelClass::step()
 
    case 1:
     rtb_Switch_m = ((Autothrust_P.Gain_Gain * rtb_Cos1 + rtb_Y_m) + (Autothrust_P.Gain1_Gain * rtb_Gain2 +
-      Autothrust_P.Gain3_Gain * rtb_Switch_dx)) * look1_binlxpw(std::fmin
+      Autothrust_P.Gain3_Gain * rtb_Switch_dx)) * look1_binlxpw<3U>(std::fmin
       (rtb_BusAssignment_n.data.commanded_engine_N1_1_percent, rtb_BusAssignment_n.data.commanded_engine_N1_1_percent),
-      Autothrust_P.ScheduledGain2_BreakpointsForDimension1, Autothrust_P.ScheduledGain2_Table, 3U) * look1_binlxpw
-      (Autothrust_DWork.pY, Autothrust_P.ScheduledGain4_BreakpointsForDimension1, Autothrust_P.ScheduledGain4_Table, 1U);
+      Autothrust_P.ScheduledGain2_BreakpointsForDimension1, Autothrust_P.ScheduledGain2_Table) * look1_binlxpw<1U>
+      (Autothrust_DWork.pY, Autothrust_P.ScheduledGain4_BreakpointsForDimension1, Autothrust_P.ScheduledGain4_Table);
     if (rtb_Switch_m > Autothrust_P.Saturation1_UpperSat) {
       rtb_Switch_m = Autothrust_P.Saturation1_UpperSat;
     } else if (rtb_Switch_m < Autothrust_P.Saturation1_LowerSat) {
@@ -722,9 +723,9 @@ void AutothrustModelClass::step()
     break;
 
    case 2:
-    rtb_Switch_m = Autothrust_P.Gain1_Gain_p * look1_binlxpw(std::fmin
+    rtb_Switch_m = Autothrust_P.Gain1_Gain_p * look1_binlxpw<6U>(std::fmin
       (rtb_BusAssignment_n.data.commanded_engine_N1_1_percent, rtb_BusAssignment_n.data.commanded_engine_N1_1_percent),
-      Autothrust_P.uDLookupTable_bp01Data, Autothrust_P.uDLookupTable_tableData, 6U);
+      Autothrust_P.uDLookupTable_bp01Data, Autothrust_P.uDLookupTable_tableData);
     if (rtb_Switch_m > Autothrust_P.Saturation_UpperSat) {
       rtb_Switch_m = Autothrust_P.Saturation_UpperSat;
     } else if (rtb_Switch_m < Autothrust_P.Saturation_LowerSat) {
@@ -733,9 +734,9 @@ void AutothrustModelClass::step()
     break;
 
    case 3:
-    rtb_Switch_m = Autothrust_P.Gain1_Gain_o * look1_binlxpw(std::fmin
+    rtb_Switch_m = Autothrust_P.Gain1_Gain_o * look1_binlxpw<6U>(std::fmin
       (rtb_BusAssignment_n.data.commanded_engine_N1_1_percent, rtb_BusAssignment_n.data.commanded_engine_N1_1_percent),
-      Autothrust_P.uDLookupTable_bp01Data_b, Autothrust_P.uDLookupTable_tableData_o, 6U);
+      Autothrust_P.uDLookupTable_bp01Data_b, Autothrust_P.uDLookupTable_tableData_o);
     if (rtb_Switch_m > Autothrust_P.Saturation_UpperSat_a) {
       rtb_Switch_m = Autothrust_P.Saturation_UpperSat_a;
     } else if (rtb_Switch_m < Autothrust_P.Saturation_LowerSat_a) {
@@ -974,6 +975,20 @@ void AutothrustModelClass::terminate()
 {
 }
 
+void AutothrustModelClass::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(Autothrust_U);
+  writer.write(Autothrust_Y);
+  writer.write(Autothrust_DWork);
+}
+
+boolean_T AutothrustModelClass::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(Autothrust_U) &&
+    reader.read(Autothrust_Y) &&
+    reader.read(Autothrust_DWork);
+}
+
 AutothrustModelClass::AutothrustModelClass():
   Autothrust_U(),
   Autothrust_Y(),
@@ -2,6 +2,7 @@
 #define RTW_HEADER_Autothrust_h_
 #include <cmath>
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "Autothrust_types.h"
 
 class AutothrustModelClass
@@ -243,13 +244,15 @@ class AutothrustModelClass
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   AutothrustModelClass();
   ~AutothrustModelClass();
  private:
   ExternalInputs_Autothrust_T Autothrust_U;
   ExternalOutputs_Autothrust_T Autothrust_Y;
   D_Work_Autothrust_T Autothrust_DWork;
-  static Parameters_Autothrust_T Autothrust_P;
+  static const Parameters_Autothrust_T Autothrust_P;
   static void Autothrust_TimeSinceCondition(real_T rtu_time, boolean_T rtu_condition, real_T *rty_y,
     rtDW_TimeSinceCondition_Autothrust_T *localDW);
   static void Autothrust_LeadLagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_C2, real_T rtu_C3, real_T rtu_C4, real_T
@@ -1,8 +0,0 @@
-#ifndef RTW_HEADER_Double2MultiWord_h_
-#define RTW_HEADER_Double2MultiWord_h_
-#include "rtwtypes.h"
-
-extern void Double2MultiWord(real_T u1, uint32_T y[], int32_T n);
-
-#endif
-
@@ -4,6 +4,7 @@
 #include <cmath>
 #include "look2_binlxpw.h"
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 #include "LateralNormalLaw.h"
 #include "LateralDirectLaw.h"
 #include "PitchNormalLaw.h"
@@ -1092,9 +1093,9 @@ void ElacComputer::step()
       ElacComputer_P.BitfromLabel5_bit_a, &rtb_y_h);
     ElacComputer_MATLABFunction_o(rtb_DataTypeConversion_by, rtb_y_l, rtb_OR1_hu, rtb_y_a, rtb_AND1_h, rtb_y_h != 0U,
       &rtb_handleIndex);
-    ElacComputer_RateLimiter_n(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
+    ElacComputer_RateLimiter_n(look2_binlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_handleIndex,
       ElacComputer_P.alphamax_bp01Data, ElacComputer_P.alphamax_bp02Data, ElacComputer_P.alphamax_tableData,
-      ElacComputer_P.alphamax_maxIndex, 4U), ElacComputer_P.RateLimiterGenericVariableTs_up,
+      ElacComputer_P.alphamax_maxIndex), ElacComputer_P.RateLimiterGenericVariableTs_up,
       ElacComputer_P.RateLimiterGenericVariableTs_lo, ElacComputer_U.in.time.dt, ElacComputer_P.reset_Value,
       &rtb_Switch3_p, &ElacComputer_DWork.sf_RateLimiter_n);
     if (!ElacComputer_DWork.eventTime_not_empty_a) {
@@ -1106,9 +1107,9 @@ void ElacComputer::step()
       ElacComputer_DWork.eventTime_g = ElacComputer_U.in.time.simulation_time;
     }
 
-    ElacComputer_RateLimiter_n(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
+    ElacComputer_RateLimiter_n(look2_binlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_handleIndex,
       ElacComputer_P.alphaprotection_bp01Data, ElacComputer_P.alphaprotection_bp02Data,
-      ElacComputer_P.alphaprotection_tableData, ElacComputer_P.alphaprotection_maxIndex, 4U),
+      ElacComputer_P.alphaprotection_tableData, ElacComputer_P.alphaprotection_maxIndex),
       ElacComputer_P.RateLimiterGenericVariableTs1_up, ElacComputer_P.RateLimiterGenericVariableTs1_lo,
       ElacComputer_U.in.time.dt, ElacComputer_P.reset_Value_j, &rtb_handleIndex_f, &ElacComputer_DWork.sf_RateLimiter_m);
     if (ElacComputer_U.in.time.simulation_time - ElacComputer_DWork.eventTime_g <=
@@ -1185,8 +1186,8 @@ void ElacComputer::step()
     }
 
     rtb_BusAssignment_p_logic_high_speed_prot_hi_thresh_kn = static_cast<real_T>(rtb_V_ias) / rtb_mach;
-    if ((rtb_V_ias <= std::fmin(365.0, (look1_binlxpw(rtb_handleIndex_f, ElacComputer_P.uDLookupTable_bp01Data,
-            ElacComputer_P.uDLookupTable_tableData, 3U) + 0.01) * rtb_BusAssignment_p_logic_high_speed_prot_hi_thresh_kn))
+    if ((rtb_V_ias <= std::fmin(365.0, (look1_binlxpw<3U>(rtb_handleIndex_f, ElacComputer_P.uDLookupTable_bp01Data,
+            ElacComputer_P.uDLookupTable_tableData) + 0.01) * rtb_BusAssignment_p_logic_high_speed_prot_hi_thresh_kn))
         || ((priorityPitchPitchLawCap != pitch_efcs_law::NormalLaw) && (rtb_activeLateralLaw != lateral_efcs_law::
           NormalLaw)) || (ElacComputer_DWork.eventTime == 0.0)) {
       ElacComputer_DWork.eventTime = ElacComputer_U.in.time.simulation_time;
@@ -1195,10 +1196,10 @@ void ElacComputer::step()
     rtb_NOT_k = ((priorityPitchPitchLawCap == pitch_efcs_law::NormalLaw) || (rtb_activeLateralLaw == lateral_efcs_law::
       NormalLaw));
     if (ElacComputer_U.in.discrete_inputs.ap_1_disengaged && ElacComputer_U.in.discrete_inputs.ap_2_disengaged &&
-        (rtb_V_ias > std::fmin(look1_binlxpw(rtb_handleIndex_f, ElacComputer_P.uDLookupTable1_bp01Data,
-           ElacComputer_P.uDLookupTable1_tableData, 3U), rtb_BusAssignment_p_logic_high_speed_prot_hi_thresh_kn *
-          look1_binlxpw(rtb_handleIndex_f, ElacComputer_P.uDLookupTable2_bp01Data,
-                        ElacComputer_P.uDLookupTable2_tableData, 3U)))) {
+        (rtb_V_ias > std::fmin(look1_binlxpw<3U>(rtb_handleIndex_f, ElacComputer_P.uDLookupTable1_bp01Data,
+           ElacComputer_P.uDLookupTable1_tableData), rtb_BusAssignment_p_logic_high_speed_prot_hi_thresh_kn *
+          look1_binlxpw<3U>(rtb_handleIndex_f, ElacComputer_P.uDLookupTable2_bp01Data,
+                        ElacComputer_P.uDLookupTable2_tableData)))) {
       ElacComputer_DWork.sProtActive = (rtb_NOT_k || ElacComputer_DWork.sProtActive);
     }
 
@@ -1554,8 +1555,8 @@ void ElacComputer::step()
       }
     }
 
-    rtb_NOT_kl = ((look1_binlxpw(static_cast<real_T>(rtb_V_ias), ElacComputer_P.uDLookupTable_bp01Data_h,
-      ElacComputer_P.uDLookupTable_tableData_j, 6U) < std::abs(rtb_handleIndex_f)) && rtb_isEngagedInPitch);
+    rtb_NOT_kl = ((look1_binlxpw<6U>(static_cast<real_T>(rtb_V_ias), ElacComputer_P.uDLookupTable_bp01Data_h,
+      ElacComputer_P.uDLookupTable_tableData_j) < std::abs(rtb_handleIndex_f)) && rtb_isEngagedInPitch);
     rtb_eta_trim_limit_lo_d = rtb_handleIndex_f;
     ElacComputer_MATLABFunction(&ElacComputer_U.in.bus_inputs.elac_opp_bus.elevator_double_pressurization_command_deg,
       &rtb_y_a);
@@ -1910,6 +1911,32 @@ void ElacComputer::terminate()
 {
 }
 
+void ElacComputer::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(ElacComputer_U);
+  writer.write(ElacComputer_Y);
+  writer.write(ElacComputer_B);
+  writer.write(ElacComputer_DWork);
+  LawMDLOBJ1.snapshot(writer);
+  LawMDLOBJ2.snapshot(writer);
+  LawMDLOBJ3.snapshot(writer);
+  LawMDLOBJ4.snapshot(writer);
+  LawMDLOBJ5.snapshot(writer);
+}
+
+boolean_T ElacComputer::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(ElacComputer_U) &&
+    reader.read(ElacComputer_Y) &&
+    reader.read(ElacComputer_B) &&
+    reader.read(ElacComputer_DWork) &&
+    LawMDLOBJ1.restore(reader) &&
+    LawMDLOBJ2.restore(reader) &&
+    LawMDLOBJ3.restore(reader) &&
+    LawMDLOBJ4.restore(reader) &&
+    LawMDLOBJ5.restore(reader);
+}
+
 ElacComputer::ElacComputer():
   ElacComputer_U(),
   ElacComputer_Y(),
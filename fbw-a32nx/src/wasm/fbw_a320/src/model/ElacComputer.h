@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_ElacComputer_h_
 #define RTW_HEADER_ElacComputer_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "ElacComputer_types.h"
 #include "LateralNormalLaw.h"
 #include "LateralDirectLaw.h"
@@ -330,6 +331,8 @@ class ElacComputer final
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   ElacComputer();
   ~ElacComputer();
  private:
@@ -337,7 +340,7 @@ class ElacComputer final
   ExternalOutputs_ElacComputer_T ElacComputer_Y;
   BlockIO_ElacComputer_T ElacComputer_B;
   D_Work_ElacComputer_T ElacComputer_DWork;
-  static Parameters_ElacComputer_T ElacComputer_P;
+  static const Parameters_ElacComputer_T ElacComputer_P;
   static void ElacComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void ElacComputer_MATLABFunction_j(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void ElacComputer_RateLimiter_Reset(rtDW_RateLimiter_ElacComputer_T *localDW);
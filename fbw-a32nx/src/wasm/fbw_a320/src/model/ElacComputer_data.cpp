@@ -96,7 +96,7 @@ base_elac_discrete_outputs rtP_elac_discrete_output_MATLABStruct{
   false
 } ;
 
-ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{
+const ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{
 
   0.5,
 
@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_FacComputer_h_
 #define RTW_HEADER_FacComputer_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "FacComputer_types.h"
 
 class FacComputer final
@@ -78,6 +79,7 @@ class FacComputer final
     rtDW_RateLimiter_FacComputer_T sf_RateLimiter_c;
     rtDW_RateLimiter_FacComputer_T sf_RateLimiter;
     rtDW_LagFilter_FacComputer_T sf_LagFilter;
+    uint32_T lookupIndex[19];
   };
 
   struct ExternalInputs_FacComputer_T {
@@ -338,13 +340,15 @@ class FacComputer final
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   FacComputer();
   ~FacComputer();
  private:
   ExternalInputs_FacComputer_T FacComputer_U;
   ExternalOutputs_FacComputer_T FacComputer_Y;
   D_Work_FacComputer_T FacComputer_DWork;
-  static Parameters_FacComputer_T FacComputer_P;
+  static const Parameters_FacComputer_T FacComputer_P;
   static void FacComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void FacComputer_MATLABFunction_f(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void FacComputer_LagFilter_Reset(rtDW_LagFilter_FacComputer_T *localDW);
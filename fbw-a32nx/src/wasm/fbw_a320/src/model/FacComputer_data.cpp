@@ -1,6 +1,6 @@
 #include "FacComputer.h"
 
-FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
+const FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   {
     false,
     false,
@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw::LateralDirectLaw_rtP{
+const LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw::LateralDirectLaw_rtP{
 
   0.0,
 
@@ -37,6 +37,16 @@ void LateralDirectLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_d
   *rty_Out_xi_deg = LateralDirectLaw_DWork.pY;
 }
 
+void LateralDirectLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(LateralDirectLaw_DWork);
+}
+
+boolean_T LateralDirectLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(LateralDirectLaw_DWork);
+}
+
 LateralDirectLaw::LateralDirectLaw():
   LateralDirectLaw_DWork()
 {
@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_LateralDirectLaw_h_
 #define RTW_HEADER_LateralDirectLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "LateralDirectLaw_types.h"
 #include <cstring>
 
@@ -27,14 +28,16 @@ class LateralDirectLaw final
   void step(const real_T *rtu_In_time_dt, const real_T *rtu_In_delta_xi_pos, real_T *rty_Out_xi_deg, real_T
             *rty_Out_zeta_deg);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   LateralDirectLaw();
   ~LateralDirectLaw();
  private:
   D_Work_LateralDirectLaw_T LateralDirectLaw_DWork;
-  static Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
+  static const Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
 };
 
-extern LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
+extern const LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
 
 #endif
 
@@ -2,6 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T LateralNormalLaw_IN_FlightMode{ 1U };
 
@@ -9,7 +10,7 @@ const uint8_T LateralNormalLaw_IN_GroundMode{ 2U };
 
 const uint8_T LateralNormalLaw_IN_NO_ACTIVE_CHILD{ 0U };
 
-LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalLaw_rtP{
+const LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalLaw_rtP{
 
   { 0.0, 120.0, 150.0, 380.0 },
 
@@ -360,14 +361,14 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
   rtb_beDot = *rtu_In_delta_zeta_pos;
   rtb_Gain1 = LateralNormalLaw_rtP.Gain1_Gain * *rtu_In_delta_xi_pos;
   if (*rtu_In_high_speed_prot_active) {
-    Vias = look1_binlxpw(*rtu_In_Phi_deg, LateralNormalLaw_rtP.BankAngleProtection2_bp01Data,
-                         LateralNormalLaw_rtP.BankAngleProtection2_tableData, 4U);
+    Vias = look1_pbinlxpw<4U>(*rtu_In_Phi_deg, LateralNormalLaw_rtP.BankAngleProtection2_bp01Data,
+                         LateralNormalLaw_rtP.BankAngleProtection2_tableData, &LateralNormalLaw_DWork.lookupIndex[0]);
   } else if (*rtu_In_high_aoa_prot_active) {
-    Vias = look1_binlxpw(*rtu_In_Phi_deg, LateralNormalLaw_rtP.BankAngleProtection_bp01Data,
-                         LateralNormalLaw_rtP.BankAngleProtection_tableData, 8U);
+    Vias = look1_pbinlxpw<8U>(*rtu_In_Phi_deg, LateralNormalLaw_rtP.BankAngleProtection_bp01Data,
+                         LateralNormalLaw_rtP.BankAngleProtection_tableData, &LateralNormalLaw_DWork.lookupIndex[1]);
   } else {
-    Vias = look1_binlxpw(*rtu_In_Phi_deg, LateralNormalLaw_rtP.BankAngleProtection1_bp01Data,
-                         LateralNormalLaw_rtP.BankAngleProtection1_tableData, 8U);
+    Vias = look1_pbinlxpw<8U>(*rtu_In_Phi_deg, LateralNormalLaw_rtP.BankAngleProtection1_bp01Data,
+                         LateralNormalLaw_rtP.BankAngleProtection1_tableData, &LateralNormalLaw_DWork.lookupIndex[2]);
   }
 
   rtb_Sum_x0 = 15.0;
@@ -432,20 +433,20 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
 
   LateralNormalLaw_LagFilter(rtb_beDot, LateralNormalLaw_rtP.LagFilter_C1, rtu_In_time_dt, &r,
     &LateralNormalLaw_DWork.sf_LagFilter);
-  Vias = look1_binlxpw(*rtu_In_V_ias_kn, LateralNormalLaw_rtP.ScheduledGain2_BreakpointsForDimension1,
-                       LateralNormalLaw_rtP.ScheduledGain2_Table, 3U);
+  Vias = look1_pbinlxpw<3U>(*rtu_In_V_ias_kn, LateralNormalLaw_rtP.ScheduledGain2_BreakpointsForDimension1,
+                       LateralNormalLaw_rtP.ScheduledGain2_Table, &LateralNormalLaw_DWork.lookupIndex[3]);
   if (*rtu_In_any_ap_engaged) {
     rtb_Y_j = *rtu_In_ap_beta_c_deg;
   } else {
     rtb_Y_j = *rtu_In_delta_zeta_pos * Vias;
   }
 
-  Vias = look1_binlxpw(*rtu_In_V_ias_kn, LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
-                       LateralNormalLaw_rtP.ScheduledGain1_Table, 4U);
+  Vias = look1_pbinlxpw<4U>(*rtu_In_V_ias_kn, LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
+                       LateralNormalLaw_rtP.ScheduledGain1_Table, &LateralNormalLaw_DWork.lookupIndex[4]);
   LateralNormalLaw_LagFilter((rtb_Y_j - r) * Vias - rtb_beDot, LateralNormalLaw_rtP.LagFilter_C1_d, rtu_In_time_dt, &r,
     &LateralNormalLaw_DWork.sf_LagFilter_m);
-  Vtas = look1_binlxpw(*rtu_In_V_ias_kn, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-                       LateralNormalLaw_rtP.ScheduledGain_Table, 8U);
+  Vtas = look1_pbinlxpw<8U>(*rtu_In_V_ias_kn, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+                       LateralNormalLaw_rtP.ScheduledGain_Table, &LateralNormalLaw_DWork.lookupIndex[5]);
   if (!LateralNormalLaw_DWork.pY_not_empty_h) {
     LateralNormalLaw_DWork.pY_p = LateralNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_d;
     LateralNormalLaw_DWork.pY_not_empty_h = true;
@@ -486,8 +487,8 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
 
   r = *rtu_In_r_deg_s - std::sin(LateralNormalLaw_rtP.Gain1_Gain_f * rtb_Sum_x0) * LateralNormalLaw_rtP.Constant2_Value *
     std::cos(r) / (LateralNormalLaw_rtP.Gain6_Gain * rtb_Gain1) * LateralNormalLaw_rtP.Gain_Gain_i;
-  rtb_Y_j = look1_binlxpw(*rtu_In_V_tas_kn, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_a,
-    LateralNormalLaw_rtP.ScheduledGain_Table_e, 6U);
+  rtb_Y_j = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_a,
+    LateralNormalLaw_rtP.ScheduledGain_Table_e, &LateralNormalLaw_DWork.lookupIndex[6]);
   rtb_beDot = r * rtb_Y_j;
   rtb_OR = !*rtu_In_on_ground;
   if (!LateralNormalLaw_DWork.pY_not_empty) {
@@ -506,8 +507,8 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
     r = LateralNormalLaw_DWork.pY;
   }
 
-  rtb_Y_j = look1_binlxpw(*rtu_In_V_tas_kn, LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_j,
-    LateralNormalLaw_rtP.ScheduledGain1_Table_m, 6U);
+  rtb_Y_j = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_j,
+    LateralNormalLaw_rtP.ScheduledGain1_Table_m, &LateralNormalLaw_DWork.lookupIndex[7]);
   rtb_Y_j *= *rtu_In_r_deg_s;
   if (rtb_beDot > LateralNormalLaw_rtP.Saturation1_UpperSat) {
     rtb_beDot = LateralNormalLaw_rtP.Saturation1_UpperSat;
@@ -555,8 +556,8 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
   rtb_Gain1 = -(Vtas * Vtas) / rtb_beDot;
   rtb_Gain1_l = LateralNormalLaw_rtP.Gain1_Gain_b * *rtu_In_Phi_deg;
   rtb_Gain1_c = LateralNormalLaw_rtP.Gain1_Gain_c * *rtu_In_pk_deg_s;
-  r = look1_binlxpw(*rtu_In_time_dt, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_j,
-                    LateralNormalLaw_rtP.ScheduledGain_Table_i, 4U);
+  r = look1_pbinlxpw<4U>(*rtu_In_time_dt, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_j,
+                    LateralNormalLaw_rtP.ScheduledGain_Table_i, &LateralNormalLaw_DWork.lookupIndex[8]);
   LateralNormalLaw_DWork.Delay_DSTATE = ((-(rtb_Y_j / Vias * 122.0 * 320.40999999999997 * -0.487 / 1.0E+6 + 1.414 * Vtas)
     / rtb_beDot * rtb_Gain1_c + rtb_Gain1 * rtb_Gain1_l) + LateralNormalLaw_rtP.Gain1_Gain_n * rtb_Sum_x0 * -rtb_Gain1) *
     r * LateralNormalLaw_rtP.Gain_Gain_p;
@@ -589,6 +590,16 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
   LateralNormalLaw_DWork.icLoad = false;
 }
 
+void LateralNormalLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(LateralNormalLaw_DWork);
+}
+
+boolean_T LateralNormalLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(LateralNormalLaw_DWork);
+}
+
 LateralNormalLaw::LateralNormalLaw():
   LateralNormalLaw_DWork()
 {
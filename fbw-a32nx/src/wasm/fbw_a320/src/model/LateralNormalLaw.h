@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_LateralNormalLaw_h_
 #define RTW_HEADER_LateralNormalLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "LateralNormalLaw_types.h"
 #include <cstring>
 
@@ -35,6 +36,7 @@ class LateralNormalLaw final
     rtDW_RateLimiter_LateralNormalLaw_T sf_RateLimiter_n;
     rtDW_LagFilter_LateralNormalLaw_T sf_LagFilter;
     rtDW_RateLimiter_LateralNormalLaw_T sf_RateLimiter;
+    uint32_T lookupIndex[9];
   };
 
   struct Parameters_LateralNormalLaw_T {
@@ -136,11 +138,13 @@ class LateralNormalLaw final
             *rtu_In_ap_phi_c_deg, const real_T *rtu_In_ap_beta_c_deg, const boolean_T *rtu_In_any_ap_engaged, real_T
             *rty_Out_xi_deg, real_T *rty_Out_zeta_deg);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   LateralNormalLaw();
   ~LateralNormalLaw();
  private:
   D_Work_LateralNormalLaw_T LateralNormalLaw_DWork;
-  static Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
+  static const Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
   static void LateralNormalLaw_RateLimiter_Reset(rtDW_RateLimiter_LateralNormalLaw_T *localDW);
   static void LateralNormalLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_LateralNormalLaw_T *localDW);
@@ -149,7 +153,7 @@ class LateralNormalLaw final
     rtDW_LagFilter_LateralNormalLaw_T *localDW);
 };
 
-extern LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
+extern const LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
 
 #endif
 
@@ -2,6 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T PitchAlternateLaw_IN_NO_ACTIVE_CHILD{ 0U };
 
@@ -23,7 +24,7 @@ const uint8_T PitchAlternateLaw_IN_flight_flaps{ 2U };
 
 const uint8_T PitchAlternateLaw_IN_ground{ 3U };
 
-PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw::PitchAlternateLaw_rtP{
+const PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw::PitchAlternateLaw_rtP{
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
 
@@ -608,8 +609,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Cos = std::cos(rtb_Gain1);
   rtb_Gain1 = PitchAlternateLaw_rtP.Gain1_Gain_l * *rtu_In_Phi_deg;
   rtb_Divide1_e = rtb_Cos / std::cos(rtb_Gain1);
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o,
-    PitchAlternateLaw_rtP.uDLookupTable_tableData_e, 6U);
+  rtb_Switch_i = look1_binlxpw<6U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o,
+    PitchAlternateLaw_rtP.uDLookupTable_tableData_e);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   rtb_Gain1 = PitchAlternateLaw_rtP.Gain1_Gain_o * *rtu_In_qk_deg_s;
   rtb_Gain_m = *rtu_In_nz_g - rtb_Divide1_e;
@@ -622,13 +623,13 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Switch_c = (PitchAlternateLaw_rtP.Gain_Gain_a * PitchAlternateLaw_rtP.Vm_currentms_Value * rtb_Gain1 + rtb_Gain_m)
     - (rtb_Switch_i / (PitchAlternateLaw_rtP.Gain5_Gain * rtb_Product1_d) + PitchAlternateLaw_rtP.Bias_Bias) * (rtb_Y_g
     - rtb_Divide1_e);
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.PLUT_bp01Data,
-    PitchAlternateLaw_rtP.PLUT_tableData, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.PLUT_bp01Data,
+    PitchAlternateLaw_rtP.PLUT_tableData);
   rtb_Product1_f = rtb_Switch_c * rtb_Switch_i;
   rtb_Y_g = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain * *rtu_In_qk_deg_s;
   rtb_Divide = (rtb_Y_g - PitchAlternateLaw_DWork.Delay_DSTATE) / *rtu_In_time_dt;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.DLUT_bp01Data,
-    PitchAlternateLaw_rtP.DLUT_tableData, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.DLUT_bp01Data,
+    PitchAlternateLaw_rtP.DLUT_tableData);
   rtb_Gain1 = rtb_Switch_c * rtb_Switch_i * PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs_Gain;
   rtb_Divide_c = (rtb_Gain1 - PitchAlternateLaw_DWork.Delay_DSTATE_k) / *rtu_In_time_dt;
   rtb_Gain_j = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs2_Gain * *rtu_In_V_tas_kn;
@@ -658,8 +659,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Product1_f = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain_m * *rtu_In_qk_deg_s;
   rtb_Divide_n = (rtb_Product1_f - PitchAlternateLaw_DWork.Delay_DSTATE_kd) / *rtu_In_time_dt;
   rtb_Divide = PitchAlternateLaw_rtP.Gain1_Gain_e * *rtu_In_qk_deg_s;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b,
-    PitchAlternateLaw_rtP.uDLookupTable_tableData_h, 6U);
+  rtb_Switch_c = look1_binlxpw<6U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b,
+    PitchAlternateLaw_rtP.uDLookupTable_tableData_h);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   if (rtb_Product1_d > PitchAlternateLaw_rtP.Saturation3_UpperSat_b) {
     rtb_Product1_d = PitchAlternateLaw_rtP.Saturation3_UpperSat_b;
@@ -677,8 +678,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
     (PitchAlternateLaw_rtP.RateLimiterVariableTs_up) * *rtu_In_time_dt), -std::abs
     (PitchAlternateLaw_rtP.RateLimiterVariableTs_lo) * *rtu_In_time_dt);
   if (*rtu_In_stabilities_available) {
-    rtb_Switch_c = look1_binlxpw(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.uDLookupTable_bp01Data,
-      PitchAlternateLaw_rtP.uDLookupTable_tableData, 5U);
+    rtb_Switch_c = look1_binlxpw<5U>(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.uDLookupTable_bp01Data,
+      PitchAlternateLaw_rtP.uDLookupTable_tableData);
     rtb_Switch_c -= *rtu_In_V_ias_kn;
     rtb_Switch_i = PitchAlternateLaw_rtP.Gain1_Gain * rtb_Switch_c;
   } else {
@@ -713,14 +714,14 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   }
 
   rtb_Switch_c = (PitchAlternateLaw_rtP.Gain_Gain_b * PitchAlternateLaw_rtP.Vm_currentms_Value_h * rtb_Divide +
-                  rtb_Gain_m) - ((((look1_binlxpw(PitchAlternateLaw_DWork.pY, PitchAlternateLaw_rtP.Loaddemand_bp01Data,
-    PitchAlternateLaw_rtP.Loaddemand_tableData, 2U) + rtb_Switch_i) + rtb_Switch_c) + rtb_Cos / std::cos
+                  rtb_Gain_m) - ((((look1_binlxpw<2U>(PitchAlternateLaw_DWork.pY, PitchAlternateLaw_rtP.Loaddemand_bp01Data,
+    PitchAlternateLaw_rtP.Loaddemand_tableData) + rtb_Switch_i) + rtb_Switch_c) + rtb_Cos / std::cos
     (PitchAlternateLaw_rtP.Gain1_Gain_lm * rtb_Product1_d)) - rtb_Divide1_e) * rtb_Bias_o;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.PLUT_bp01Data_f,
-    PitchAlternateLaw_rtP.PLUT_tableData_k, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.PLUT_bp01Data_f,
+    PitchAlternateLaw_rtP.PLUT_tableData_k);
   rtb_Product1_d = rtb_Switch_c * rtb_Switch_i;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.DLUT_bp01Data_m,
-    PitchAlternateLaw_rtP.DLUT_tableData_a, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.DLUT_bp01Data_m,
+    PitchAlternateLaw_rtP.DLUT_tableData_a);
   rtb_Cos = rtb_Switch_c * rtb_Switch_i * PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs_Gain_b;
   rtb_Switch_i = (rtb_Cos - PitchAlternateLaw_DWork.Delay_DSTATE_j) / *rtu_In_time_dt;
   rtb_Divide = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs2_Gain_c * *rtu_In_V_tas_kn;
@@ -749,8 +750,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Divide_n = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain_c * *rtu_In_qk_deg_s;
   rtb_Divide_i = (rtb_Divide_n - PitchAlternateLaw_DWork.Delay_DSTATE_e) / *rtu_In_time_dt;
   rtb_Switch_i = PitchAlternateLaw_rtP.Gain1_Gain_b * *rtu_In_qk_deg_s;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a,
-    PitchAlternateLaw_rtP.uDLookupTable_tableData_p, 6U);
+  rtb_Switch_c = look1_binlxpw<6U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a,
+    PitchAlternateLaw_rtP.uDLookupTable_tableData_p);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   if (rtb_Product1_d > PitchAlternateLaw_rtP.Saturation3_UpperSat_n) {
     rtb_Product1_d = PitchAlternateLaw_rtP.Saturation3_UpperSat_n;
@@ -766,11 +767,11 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
     &PitchAlternateLaw_DWork.sf_RateLimiter_n);
   rtb_Switch_c = (PitchAlternateLaw_rtP.Gain_Gain_p * PitchAlternateLaw_rtP.Vm_currentms_Value_p * rtb_Switch_i +
                   rtb_Gain_m) - (rtb_Switch_c - rtb_Divide1_e) * rtb_Product1_d;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.PLUT_bp01Data_a,
-    PitchAlternateLaw_rtP.PLUT_tableData_o, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.PLUT_bp01Data_a,
+    PitchAlternateLaw_rtP.PLUT_tableData_o);
   rtb_Product1_b = rtb_Switch_c * rtb_Switch_i;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.DLUT_bp01Data_k,
-    PitchAlternateLaw_rtP.DLUT_tableData_e, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.DLUT_bp01Data_k,
+    PitchAlternateLaw_rtP.DLUT_tableData_e);
   rtb_Divide1_e = rtb_Switch_c * rtb_Switch_i * PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs_Gain_p;
   rtb_Switch_i = (rtb_Divide1_e - PitchAlternateLaw_DWork.Delay_DSTATE_g) / *rtu_In_time_dt;
   rtb_Gain_m = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs2_Gain_a * *rtu_In_V_tas_kn;
@@ -821,8 +822,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
     rtb_TmpSignalConversionAtSFunctionInport1[2] = rtb_Product1_d;
   }
 
-  rtb_Switch_c = look1_binlxpw(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-    PitchAlternateLaw_rtP.ScheduledGain_Table, 5U);
+  rtb_Switch_c = look1_binlxpw<5U>(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+    PitchAlternateLaw_rtP.ScheduledGain_Table);
   if (rtb_TmpSignalConversionAtSFunctionInport1[0] < rtb_TmpSignalConversionAtSFunctionInport1[1]) {
     if (rtb_TmpSignalConversionAtSFunctionInport1[1] < rtb_TmpSignalConversionAtSFunctionInport1[2]) {
       rtb_TmpSignalConversionAtSFunct = 1;
@@ -840,8 +841,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   }
 
   rtb_Divide_c = rtb_TmpSignalConversionAtSFunctionInport1[rtb_TmpSignalConversionAtSFunct] * rtb_Switch_c;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_time_dt, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
-    PitchAlternateLaw_rtP.ScheduledGain_Table_h, 4U);
+  rtb_Switch_c = look1_binlxpw<4U>(*rtu_In_time_dt, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
+    PitchAlternateLaw_rtP.ScheduledGain_Table_h);
   rtb_Switch_c = rtb_Divide_c * rtb_Switch_c * PitchAlternateLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain *
     *rtu_In_time_dt;
   if (*rtu_In_in_flight > PitchAlternateLaw_rtP.Switch_Threshold) {
@@ -897,6 +898,16 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   PitchAlternateLaw_DWork.icLoad = false;
 }
 
+void PitchAlternateLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(PitchAlternateLaw_DWork);
+}
+
+boolean_T PitchAlternateLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(PitchAlternateLaw_DWork);
+}
+
 PitchAlternateLaw::PitchAlternateLaw():
   PitchAlternateLaw_DWork()
 {
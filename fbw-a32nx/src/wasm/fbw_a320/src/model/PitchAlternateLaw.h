@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_PitchAlternateLaw_h_
 #define RTW_HEADER_PitchAlternateLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "PitchAlternateLaw_types.h"
 #include <cstring>
 
@@ -209,11 +210,13 @@ class PitchAlternateLaw final
             boolean_T *rtu_In_tracking_mode_on, const boolean_T *rtu_In_stabilities_available, real_T *rty_Out_eta_deg,
             real_T *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   PitchAlternateLaw();
   ~PitchAlternateLaw();
  private:
   D_Work_PitchAlternateLaw_T PitchAlternateLaw_DWork;
-  static Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
+  static const Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
   static void PitchAlternateLaw_RateLimiter_Reset(rtDW_RateLimiter_PitchAlternateLaw_T *localDW);
   static void PitchAlternateLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_PitchAlternateLaw_T *localDW);
@@ -225,7 +228,7 @@ class PitchAlternateLaw final
     rtDW_WashoutFilter_PitchAlternateLaw_T *localDW);
 };
 
-extern PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
+extern const PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
 
 #endif
 
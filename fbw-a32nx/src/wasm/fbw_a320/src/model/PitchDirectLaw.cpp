@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw::PitchDirectLaw_rtP{
+const PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw::PitchDirectLaw_rtP{
 
   0.0,
 
@@ -53,6 +53,16 @@ void PitchDirectLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_del
   *rty_Out_eta_deg = PitchDirectLaw_DWork.pY;
 }
 
+void PitchDirectLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(PitchDirectLaw_DWork);
+}
+
+boolean_T PitchDirectLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(PitchDirectLaw_DWork);
+}
+
 PitchDirectLaw::PitchDirectLaw():
   PitchDirectLaw_DWork()
 {
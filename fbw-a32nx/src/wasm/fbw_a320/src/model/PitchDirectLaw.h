@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_PitchDirectLaw_h_
 #define RTW_HEADER_PitchDirectLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "PitchDirectLaw_types.h"
 #include <cstring>
 
@@ -31,14 +32,16 @@ class PitchDirectLaw final
   void step(const real_T *rtu_In_time_dt, const real_T *rtu_In_delta_eta_pos, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   PitchDirectLaw();
   ~PitchDirectLaw();
  private:
   D_Work_PitchDirectLaw_T PitchDirectLaw_DWork;
-  static Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
+  static const Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
 };
 
-extern PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
+extern const PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
 
 #endif
 
@@ -3,6 +3,7 @@
 #include <cmath>
 #include "look1_binlxpw.h"
 #include "look2_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T PitchNormalLaw_IN_Flare_Reduce_Theta_c{ 1U };
 
@@ -40,7 +41,7 @@ const uint8_T PitchNormalLaw_IN_OFF{ 1U };
 
 const uint8_T PitchNormalLaw_IN_ON{ 2U };
 
-PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
+const PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 0.0, 50.0, 100.0, 200.0 },
 
@@ -1454,8 +1455,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Cos = std::cos(rtb_Loaddemand2_l);
   rtb_Loaddemand2_l = PitchNormalLaw_rtP.Gain1_Gain_l * *rtu_In_Phi_deg;
   rtb_Y_cm = rtb_Cos / std::cos(rtb_Loaddemand2_l);
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data,
-    PitchNormalLaw_rtP.uDLookupTable_tableData, 6U);
+  rtb_Y_n = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data,
+    PitchNormalLaw_rtP.uDLookupTable_tableData, &PitchNormalLaw_DWork.lookupIndex[0]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   rtb_Loaddemand2_l = PitchNormalLaw_rtP.Gain1_Gain_e * *rtu_In_qk_deg_s;
   rtb_Gain_g = *rtu_In_nz_g - rtb_Y_cm;
@@ -1474,13 +1475,13 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   rtb_Saturation3 = (PitchNormalLaw_rtP.Gain_Gain_c * PitchNormalLaw_rtP.Vm_currentms_Value * rtb_Loaddemand2_l +
                      rtb_Gain_g) - (rtb_Y_n / (PitchNormalLaw_rtP.Gain5_Gain * rtb_uDLookupTable) +
-    PitchNormalLaw_rtP.Bias_Bias) * ((rtb_Y_cm + look1_binlxpw(rtb_Divide_kq, PitchNormalLaw_rtP.Loaddemand1_bp01Data,
-    PitchNormalLaw_rtP.Loaddemand1_tableData, 2U)) - rtb_Y_cm);
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data, PitchNormalLaw_rtP.PLUT_tableData, 1U);
+    PitchNormalLaw_rtP.Bias_Bias) * ((rtb_Y_cm + look1_pbinlxpw<2U>(rtb_Divide_kq, PitchNormalLaw_rtP.Loaddemand1_bp01Data,
+    PitchNormalLaw_rtP.Loaddemand1_tableData, &PitchNormalLaw_DWork.lookupIndex[1])) - rtb_Y_cm);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data, PitchNormalLaw_rtP.PLUT_tableData, &PitchNormalLaw_DWork.lookupIndex[2]);
   rtb_Product1_dm = rtb_Saturation3 * rtb_Y_n;
   rtb_Loaddemand2_l = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain * *rtu_In_qk_deg_s;
   rtb_Divide = (rtb_Loaddemand2_l - PitchNormalLaw_DWork.Delay_DSTATE_h) / *rtu_In_time_dt;
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data, PitchNormalLaw_rtP.DLUT_tableData, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data, PitchNormalLaw_rtP.DLUT_tableData, &PitchNormalLaw_DWork.lookupIndex[3]);
   rtb_Gain_px = rtb_Saturation3 * rtb_Y_n * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain;
   rtb_Divide_o = (rtb_Gain_px - PitchNormalLaw_DWork.Delay_DSTATE_n) / *rtu_In_time_dt;
   rtb_Gain_ot = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain * *rtu_In_V_tas_kn;
@@ -1498,8 +1499,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain5_gq = std::fmin(*rtu_In_spoilers_left_pos, *rtu_In_spoilers_right_pos);
   PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, PitchNormalLaw_rtP.WashoutFilter_C1, rtu_In_time_dt, &rtb_Y_am,
     &PitchNormalLaw_DWork.sf_WashoutFilter_k);
-  rtb_Y_n = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-    PitchNormalLaw_rtP.ScheduledGain_Table, 3U);
+  rtb_Y_n = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+    PitchNormalLaw_rtP.ScheduledGain_Table, &PitchNormalLaw_DWork.lookupIndex[4]);
   if (rtb_Y_am > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat) {
     rtb_Y_am = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat;
   } else if (rtb_Y_am < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat) {
@@ -1510,8 +1511,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_an = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_i * *rtu_In_qk_deg_s;
   rtb_Divide_cq = (rtb_Divide_an - PitchNormalLaw_DWork.Delay_DSTATE_l) / *rtu_In_time_dt;
   rtb_Gain1_ft = PitchNormalLaw_rtP.Gain1_Gain_o * *rtu_In_qk_deg_s;
-  rtb_Saturation3 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_o,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_e, 6U);
+  rtb_Saturation3 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_o,
+    PitchNormalLaw_rtP.uDLookupTable_tableData_e, &PitchNormalLaw_DWork.lookupIndex[5]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   if (rtb_uDLookupTable > PitchNormalLaw_rtP.Saturation3_UpperSat_a) {
     rtb_uDLookupTable = PitchNormalLaw_rtP.Saturation3_UpperSat_a;
@@ -1522,9 +1523,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Saturation3 = (PitchNormalLaw_rtP.Gain_Gain_al * PitchNormalLaw_rtP.Vm_currentms_Value_e * rtb_Gain1_ft +
                      rtb_Gain_g) - (rtb_Saturation3 / (PitchNormalLaw_rtP.Gain5_Gain_d * rtb_uDLookupTable) +
     PitchNormalLaw_rtP.Bias_Bias_a) * (rtb_Y_p - rtb_Y_cm);
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_b, PitchNormalLaw_rtP.PLUT_tableData_b, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_b, PitchNormalLaw_rtP.PLUT_tableData_b, &PitchNormalLaw_DWork.lookupIndex[6]);
   rtb_Product1_ck = rtb_Saturation3 * rtb_Y_n;
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_h, PitchNormalLaw_rtP.DLUT_tableData_p, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_h, PitchNormalLaw_rtP.DLUT_tableData_p, &PitchNormalLaw_DWork.lookupIndex[7]);
   rtb_Gain1_ft = rtb_Saturation3 * rtb_Y_n * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_j;
   rtb_Divide_l = (rtb_Gain1_ft - PitchNormalLaw_DWork.Delay_DSTATE_k) / *rtu_In_time_dt;
   rtb_Gain_bs = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_e * *rtu_In_V_tas_kn;
@@ -1541,8 +1542,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, PitchNormalLaw_rtP.WashoutFilter_C1_n, rtu_In_time_dt, &rtb_Y_am,
     &PitchNormalLaw_DWork.sf_WashoutFilter_c);
-  rtb_Y_n = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_n,
-    PitchNormalLaw_rtP.ScheduledGain_Table_b, 3U);
+  rtb_Y_n = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_n,
+    PitchNormalLaw_rtP.ScheduledGain_Table_b, &PitchNormalLaw_DWork.lookupIndex[8]);
   if (rtb_Y_am > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_g) {
     rtb_Y_am = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_g;
   } else if (rtb_Y_am < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_j) {
@@ -1604,8 +1605,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_alpha_err_gain = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_m * *rtu_In_qk_deg_s;
   rtb_Divide_kq = (rtb_alpha_err_gain - PitchNormalLaw_DWork.Delay_DSTATE_kd) / *rtu_In_time_dt;
   rtb_Gain1_e = PitchNormalLaw_rtP.Gain1_Gain_en * *rtu_In_qk_deg_s;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_b,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_h, 6U);
+  rtb_Sum_j4 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_b,
+    PitchNormalLaw_rtP.uDLookupTable_tableData_h, &PitchNormalLaw_DWork.lookupIndex[9]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   if (rtb_uDLookupTable > PitchNormalLaw_rtP.Saturation3_UpperSat_b) {
     rtb_uDLookupTable = PitchNormalLaw_rtP.Saturation3_UpperSat_b;
@@ -1617,8 +1618,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   PitchNormalLaw_RateLimiter_c(rtu_In_ap_theta_c_deg, PitchNormalLaw_rtP.RateLimiterVariableTs1_up_d,
     PitchNormalLaw_rtP.RateLimiterVariableTs1_lo_g, rtu_In_time_dt,
     PitchNormalLaw_rtP.RateLimiterVariableTs1_InitialCondition_l, &rtb_Y_p, &PitchNormalLaw_DWork.sf_RateLimiter_d);
-  rtb_uDLookupTable = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_h,
-    PitchNormalLaw_rtP.ScheduledGain_Table_j, 6U);
+  rtb_uDLookupTable = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_h,
+    PitchNormalLaw_rtP.ScheduledGain_Table_j, &PitchNormalLaw_DWork.lookupIndex[10]);
   PitchNormalLaw_RateLimiter_c(rtu_In_delta_eta_pos, PitchNormalLaw_rtP.RateLimiterVariableTs_up_n,
     PitchNormalLaw_rtP.RateLimiterVariableTs_lo_c, rtu_In_time_dt,
     PitchNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_o, &rtb_Y_am, &PitchNormalLaw_DWork.sf_RateLimiter_c2);
@@ -1655,8 +1656,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     rtb_Sum_j4 = rtb_Y_p - *rtu_In_Theta_deg;
     rtb_Sum_j4 *= rtb_uDLookupTable;
   } else {
-    rtb_Sum_j4 = look1_binlxpw(rtb_Y_am, PitchNormalLaw_rtP.Loaddemand_bp01Data, PitchNormalLaw_rtP.Loaddemand_tableData,
-      2U);
+    rtb_Sum_j4 = look1_pbinlxpw<2U>(rtb_Y_am, PitchNormalLaw_rtP.Loaddemand_bp01Data, PitchNormalLaw_rtP.Loaddemand_tableData, &PitchNormalLaw_DWork.lookupIndex[11]);
     if (rtb_Y_n > PitchNormalLaw_rtP.Saturation_UpperSat) {
       rtb_Y_n = PitchNormalLaw_rtP.Saturation_UpperSat;
     } else if (rtb_Y_n < PitchNormalLaw_rtP.Saturation_LowerSat) {
@@ -1719,9 +1719,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   rtb_Sum_j4 = (PitchNormalLaw_rtP.Gain_Gain_b * PitchNormalLaw_rtP.Vm_currentms_Value_h * rtb_Gain1_e + rtb_Gain_g) -
     ((rtb_Cos / std::cos(PitchNormalLaw_rtP.Gain1_Gain_lm * rtb_uDLookupTable) + rtb_Sum_j4) - rtb_Y_cm) * rtb_Bias_o;
-  rtb_Y_aj = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_f, PitchNormalLaw_rtP.PLUT_tableData_k, 1U);
+  rtb_Y_aj = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_f, PitchNormalLaw_rtP.PLUT_tableData_k, &PitchNormalLaw_DWork.lookupIndex[12]);
   rtb_Y_n = rtb_Sum_j4 * rtb_Y_aj;
-  rtb_Y_aj = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_m, PitchNormalLaw_rtP.DLUT_tableData_a, 1U);
+  rtb_Y_aj = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_m, PitchNormalLaw_rtP.DLUT_tableData_a, &PitchNormalLaw_DWork.lookupIndex[13]);
   rtb_Cos = rtb_Sum_j4 * rtb_Y_aj * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_b;
   rtb_uDLookupTable = (rtb_Cos - PitchNormalLaw_DWork.Delay_DSTATE_jh) / *rtu_In_time_dt;
   rtb_Y_p = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_c * *rtu_In_V_tas_kn;
@@ -1738,8 +1738,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Y_am = PitchNormalLaw_rtP.Gain_Gain_f * rtb_Sum_j4;
   PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, PitchNormalLaw_rtP.WashoutFilter_C1_l, rtu_In_time_dt, &rtb_Sum_j4,
     &PitchNormalLaw_DWork.sf_WashoutFilter_l);
-  rtb_Y_aj = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_c,
-    PitchNormalLaw_rtP.ScheduledGain_Table_g, 3U);
+  rtb_Y_aj = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_c,
+    PitchNormalLaw_rtP.ScheduledGain_Table_g, &PitchNormalLaw_DWork.lookupIndex[14]);
   if (rtb_Sum_j4 > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_o) {
     rtb_Sum_j4 = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_o;
   } else if (rtb_Sum_j4 < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_jl) {
@@ -1751,8 +1751,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Y_n = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_c * *rtu_In_qk_deg_s;
   rtb_Saturation3 = (rtb_Y_n - PitchNormalLaw_DWork.Delay_DSTATE_e5) / *rtu_In_time_dt;
   rtb_Y_am = PitchNormalLaw_rtP.Gain1_Gain_b * *rtu_In_qk_deg_s;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_a,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_p, 6U);
+  rtb_Sum_j4 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_a,
+    PitchNormalLaw_rtP.uDLookupTable_tableData_p, &PitchNormalLaw_DWork.lookupIndex[15]);
   rtb_Divide_kq = *rtu_In_V_tas_kn;
   if (rtb_Divide_kq > PitchNormalLaw_rtP.Saturation3_UpperSat_n) {
     rtb_Divide_kq = PitchNormalLaw_rtP.Saturation3_UpperSat_n;
@@ -1763,9 +1763,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Sum_j4 = (PitchNormalLaw_rtP.Gain_Gain_p * PitchNormalLaw_rtP.Vm_currentms_Value_p * rtb_Y_am + rtb_Gain_g) -
     (rtb_Sum_j4 / (PitchNormalLaw_rtP.Gain5_Gain_n * rtb_Divide_kq) + PitchNormalLaw_rtP.Bias_Bias_ai) * (rtb_Y_ll -
     rtb_Y_cm);
-  rtb_Y_aj = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_a, PitchNormalLaw_rtP.PLUT_tableData_o, 1U);
+  rtb_Y_aj = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_a, PitchNormalLaw_rtP.PLUT_tableData_o, &PitchNormalLaw_DWork.lookupIndex[16]);
   rtb_Gain1_e = rtb_Sum_j4 * rtb_Y_aj;
-  rtb_Y_aj = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_k, PitchNormalLaw_rtP.DLUT_tableData_e, 1U);
+  rtb_Y_aj = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_k, PitchNormalLaw_rtP.DLUT_tableData_e, &PitchNormalLaw_DWork.lookupIndex[17]);
   rtb_Y_ll = rtb_Sum_j4 * rtb_Y_aj * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_p;
   rtb_Bias_o = (rtb_Y_ll - PitchNormalLaw_DWork.Delay_DSTATE_gz) / *rtu_In_time_dt;
   rtb_Y_am = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_a * *rtu_In_V_tas_kn;
@@ -1782,8 +1782,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_v_target = PitchNormalLaw_rtP.Gain_Gain_k * rtb_Sum_j4;
   PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, PitchNormalLaw_rtP.WashoutFilter_C1_h, rtu_In_time_dt, &rtb_Sum_j4,
     &PitchNormalLaw_DWork.sf_WashoutFilter_d);
-  rtb_Y_aj = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_f,
-    PitchNormalLaw_rtP.ScheduledGain_Table_h, 3U);
+  rtb_Y_aj = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_f,
+    PitchNormalLaw_rtP.ScheduledGain_Table_h, &PitchNormalLaw_DWork.lookupIndex[18]);
   rtb_Divide_kq = (((PitchNormalLaw_rtP.Gain3_Gain_m * rtb_Divide_cq + rtb_Product1_ck) + rtb_Divide_l) +
                    PitchNormalLaw_rtP.Gain_Gain_j * rtb_Gain_f) + rtb_Product_n3;
   if (rtb_Sum_j4 > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_h) {
@@ -1817,8 +1817,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_cq = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_k * *rtu_In_qk_deg_s;
   rtb_Product1_ck = (rtb_Divide_cq - PitchNormalLaw_DWork.Delay_DSTATE_ho) / *rtu_In_time_dt;
   rtb_Divide_l = PitchNormalLaw_rtP.Gain1_Gain_lk * *rtu_In_qk_deg_s;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_m,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_a, 6U);
+  rtb_Sum_j4 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_m,
+    PitchNormalLaw_rtP.uDLookupTable_tableData_a, &PitchNormalLaw_DWork.lookupIndex[19]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   rtb_Divide_kq = PitchNormalLaw_rtP.Gain3_Gain_g * PitchNormalLaw_rtP.Theta_max3_Value - rtb_Loaddemand2;
   if (rtb_uDLookupTable > PitchNormalLaw_rtP.Saturation3_UpperSat_e) {
@@ -1835,12 +1835,11 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   rtb_Sum_j4 = (PitchNormalLaw_rtP.Gain_Gain_jq * PitchNormalLaw_rtP.Vm_currentms_Value_b * rtb_Divide_l + rtb_Gain_g) -
     (rtb_Sum_j4 / (PitchNormalLaw_rtP.Gain5_Gain_m * rtb_uDLookupTable) + PitchNormalLaw_rtP.Bias_Bias_m) * ((rtb_Y_cm +
-    look1_binlxpw(rtb_Divide_kq, PitchNormalLaw_rtP.Loaddemand2_bp01Data, PitchNormalLaw_rtP.Loaddemand2_tableData, 2U))
+    look1_pbinlxpw<2U>(rtb_Divide_kq, PitchNormalLaw_rtP.Loaddemand2_bp01Data, PitchNormalLaw_rtP.Loaddemand2_tableData, &PitchNormalLaw_DWork.lookupIndex[20]))
     - rtb_Y_cm);
-  rtb_Y_aj = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_e, PitchNormalLaw_rtP.PLUT_tableData_g, 1U);
+  rtb_Y_aj = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_e, PitchNormalLaw_rtP.PLUT_tableData_g, &PitchNormalLaw_DWork.lookupIndex[21]);
   rtb_Y_cm = rtb_Sum_j4 * rtb_Y_aj;
-  rtb_Y_aj = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_hw, PitchNormalLaw_rtP.DLUT_tableData_l,
-    1U);
+  rtb_Y_aj = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_hw, PitchNormalLaw_rtP.DLUT_tableData_l, &PitchNormalLaw_DWork.lookupIndex[22]);
   rtb_Loaddemand2 = rtb_Sum_j4 * rtb_Y_aj * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_c;
   rtb_Divide_l = (rtb_Loaddemand2 - PitchNormalLaw_DWork.Delay_DSTATE_ds) / *rtu_In_time_dt;
   rtb_Gain_g = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_p * *rtu_In_V_tas_kn;
@@ -1857,8 +1856,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain_f = PitchNormalLaw_rtP.Gain_Gain_l0 * rtb_Sum_j4;
   PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, PitchNormalLaw_rtP.WashoutFilter_C1_j, rtu_In_time_dt, &rtb_Sum_j4,
     &PitchNormalLaw_DWork.sf_WashoutFilter);
-  rtb_Y_aj = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_b,
-    PitchNormalLaw_rtP.ScheduledGain_Table_e, 3U);
+  rtb_Y_aj = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_b,
+    PitchNormalLaw_rtP.ScheduledGain_Table_e, &PitchNormalLaw_DWork.lookupIndex[23]);
   rtb_uDLookupTable = (((PitchNormalLaw_rtP.Gain3_Gain * rtb_Divide + rtb_Product1_dm) + rtb_Divide_o) +
                        PitchNormalLaw_rtP.Gain_Gain_l * rtb_Divide_a0) + rtb_Product_kz;
   if (rtb_Sum_j4 > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_m) {
@@ -1882,11 +1881,11 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   }
 
   PitchNormalLaw_VoterAttitudeProtection(rtb_uDLookupTable, rtb_Saturation3, rtb_Divide_kq, &rtb_Y_aj);
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
-    PitchNormalLaw_rtP.ScheduledGain1_Table, 4U);
+  rtb_Sum_j4 = look1_pbinlxpw<4U>(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
+    PitchNormalLaw_rtP.ScheduledGain1_Table, &PitchNormalLaw_DWork.lookupIndex[24]);
   rtb_Y_cm = rtb_Y_aj * rtb_Sum_j4;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_time_dt, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
-    PitchNormalLaw_rtP.ScheduledGain_Table_hh, 4U);
+  rtb_Sum_j4 = look1_pbinlxpw<4U>(*rtu_In_time_dt, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
+    PitchNormalLaw_rtP.ScheduledGain_Table_hh, &PitchNormalLaw_DWork.lookupIndex[25]);
   rtb_Sum_j4 = rtb_Y_cm * rtb_Sum_j4 * PitchNormalLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain * *rtu_In_time_dt;
   if (*rtu_In_in_flight > PitchNormalLaw_rtP.Switch_Threshold) {
     rtb_Y_aj = *rtu_In_eta_deg;
@@ -1935,9 +1934,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   PitchNormalLaw_RateLimiter_c(rtu_In_delta_eta_pos, PitchNormalLaw_rtP.RateLimiterVariableTs_up_na,
     PitchNormalLaw_rtP.RateLimiterVariableTs_lo_i, rtu_In_time_dt,
     PitchNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_m, &rtb_Y_cm, &PitchNormalLaw_DWork.sf_RateLimiter_ct);
-  rtb_Sum_j4 = look2_binlxpw(*rtu_In_Theta_deg, *rtu_In_H_radio_ft, PitchNormalLaw_rtP.uDLookupTable_bp01Data_l,
-    PitchNormalLaw_rtP.uDLookupTable_bp02Data, PitchNormalLaw_rtP.uDLookupTable_tableData_e5,
-    PitchNormalLaw_rtP.uDLookupTable_maxIndex, 5U);
+  rtb_Sum_j4 = look2_pbinlxpw<5U>(*rtu_In_Theta_deg, *rtu_In_H_radio_ft, PitchNormalLaw_rtP.uDLookupTable_bp01Data_l,
+    PitchNormalLaw_rtP.uDLookupTable_bp02Data, PitchNormalLaw_rtP.uDLookupTable_tableData_e5, &PitchNormalLaw_DWork.lookupIndex[26],
+    PitchNormalLaw_rtP.uDLookupTable_maxIndex);
   rtb_Y_aj = *rtu_In_tailstrike_protection_on;
   if (rtb_Y_cm > PitchNormalLaw_rtP.Saturation3_UpperSat_l) {
     rtb_eta_trim_deg_rate_limit_up_deg_s = PitchNormalLaw_rtP.Saturation3_UpperSat_l;
@@ -1947,8 +1946,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     rtb_eta_trim_deg_rate_limit_up_deg_s = rtb_Y_cm;
   }
 
-  rtb_Sum_j4 = look1_binlxpw(rtb_Y_aj * rtb_Sum_j4 * rtb_eta_trim_deg_rate_limit_up_deg_s + rtb_Y_cm,
-    PitchNormalLaw_rtP.PitchRateDemand_bp01Data, PitchNormalLaw_rtP.PitchRateDemand_tableData, 2U);
+  rtb_Sum_j4 = look1_pbinlxpw<2U>(rtb_Y_aj * rtb_Sum_j4 * rtb_eta_trim_deg_rate_limit_up_deg_s + rtb_Y_cm,
+    PitchNormalLaw_rtP.PitchRateDemand_bp01Data, PitchNormalLaw_rtP.PitchRateDemand_tableData, &PitchNormalLaw_DWork.lookupIndex[28]);
   rtb_eta_trim_deg_rate_limit_up_deg_s = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_j3 * rtb_Sum_j4;
   rtb_Y_cm = (rtb_eta_trim_deg_rate_limit_up_deg_s - PitchNormalLaw_DWork.Delay_DSTATE_ej) / *rtu_In_time_dt;
   rtb_Y_aj = *rtu_In_qk_deg_s - rtb_Sum_j4;
@@ -1964,8 +1963,8 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain5_gq = PitchNormalLaw_rtP.Gain6_Gain_g * *rtu_In_qk_dot_deg_s2;
   rtb_Y_cm = (((rtb_Divide_o + rtb_Divide_a0) * PitchNormalLaw_rtP.Gain1_Gain_a + PitchNormalLaw_rtP.Gain3_Gain_e *
                rtb_Y_cm) + (rtb_Y_aj - rtb_Sum_j4) * PitchNormalLaw_rtP.Gain4_Gain) + rtb_Gain5_gq;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_h,
-    PitchNormalLaw_rtP.ScheduledGain1_Table_c, 4U);
+  rtb_Sum_j4 = look1_pbinlxpw<4U>(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_h,
+    PitchNormalLaw_rtP.ScheduledGain1_Table_c, &PitchNormalLaw_DWork.lookupIndex[29]);
   rtb_Sum_j4 = (PitchNormalLaw_rtP.Constant2_Value_k - rtb_Y_b) * (rtb_Y_cm * rtb_Sum_j4) *
     PitchNormalLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain_j * *rtu_In_time_dt;
   rtb_eta_trim_deg_should_freeze = (*rtu_In_delta_eta_pos <= PitchNormalLaw_rtP.Constant_Value_o);
@@ -2045,6 +2044,18 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   PitchNormalLaw_DWork.icLoad_p = false;
 }
 
+void PitchNormalLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(PitchNormalLaw_B);
+  writer.write(PitchNormalLaw_DWork);
+}
+
+boolean_T PitchNormalLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(PitchNormalLaw_B) &&
+    reader.read(PitchNormalLaw_DWork);
+}
+
 PitchNormalLaw::PitchNormalLaw():
   PitchNormalLaw_B(),
   PitchNormalLaw_DWork()
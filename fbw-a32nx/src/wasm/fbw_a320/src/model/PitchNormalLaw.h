@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_PitchNormalLaw_h_
 #define RTW_HEADER_PitchNormalLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "PitchNormalLaw_types.h"
 #include <cstring>
 
@@ -123,6 +124,7 @@ class PitchNormalLaw final
     rtDW_RateLimiter_PitchNormalLaw_T sf_RateLimiter_p;
     rtDW_RateLimiter_PitchNormalLaw_T sf_RateLimiter;
     rtDW_LagFilter_PitchNormalLaw_T sf_LagFilter;
+    uint32_T lookupIndex[30];
   };
 
   struct Parameters_PitchNormalLaw_T {
@@ -491,12 +493,14 @@ class PitchNormalLaw final
             *rtu_In_any_ap_engaged, real_T *rty_Out_eta_deg, real_T *rty_Out_eta_trim_dot_deg_s, real_T
             *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   PitchNormalLaw();
   ~PitchNormalLaw();
  private:
   BlockIO_PitchNormalLaw_T PitchNormalLaw_B;
   D_Work_PitchNormalLaw_T PitchNormalLaw_DWork;
-  static Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
+  static const Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
   static void PitchNormalLaw_LagFilter_Reset(rtDW_LagFilter_PitchNormalLaw_T *localDW);
   static void PitchNormalLaw_LagFilter(const real_T *rtu_U, real_T rtu_C1, const real_T *rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_PitchNormalLaw_T *localDW);
@@ -519,7 +523,7 @@ class PitchNormalLaw final
     *rty_vote);
 };
 
-extern PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
+extern const PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
 
 #endif
 
@@ -3,6 +3,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 #include "LateralDirectLaw.h"
 #include "PitchAlternateLaw.h"
 #include "PitchDirectLaw.h"
@@ -849,8 +850,8 @@ void SecComputer::step()
         }
       }
 
-      rtb_Switch3 = look1_binlxpw(rtb_Switch5, SecComputer_P.uDLookupTable_bp01Data,
-        SecComputer_P.uDLookupTable_tableData, 4U);
+      rtb_Switch3 = look1_binlxpw<4U>(rtb_Switch5, SecComputer_P.uDLookupTable_bp01Data,
+        SecComputer_P.uDLookupTable_tableData);
     }
 
     SecComputer_RateLimiter(rtb_Switch3, SecComputer_P.RateLimiterVariableTs1_up,
@@ -1428,6 +1429,28 @@ void SecComputer::terminate()
 {
 }
 
+void SecComputer::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(SecComputer_U);
+  writer.write(SecComputer_Y);
+  writer.write(SecComputer_B);
+  writer.write(SecComputer_DWork);
+  LawMDLOBJ1.snapshot(writer);
+  LawMDLOBJ2.snapshot(writer);
+  LawMDLOBJ3.snapshot(writer);
+}
+
+boolean_T SecComputer::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(SecComputer_U) &&
+    reader.read(SecComputer_Y) &&
+    reader.read(SecComputer_B) &&
+    reader.read(SecComputer_DWork) &&
+    LawMDLOBJ1.restore(reader) &&
+    LawMDLOBJ2.restore(reader) &&
+    LawMDLOBJ3.restore(reader);
+}
+
 SecComputer::SecComputer():
   SecComputer_U(),
   SecComputer_Y(),
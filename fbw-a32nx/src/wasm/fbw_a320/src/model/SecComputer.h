@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_SecComputer_h_
 #define RTW_HEADER_SecComputer_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "SecComputer_types.h"
 #include "LateralDirectLaw.h"
 #include "PitchAlternateLaw.h"
@@ -298,6 +299,8 @@ class SecComputer final
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   SecComputer();
   ~SecComputer();
  private:
@@ -305,7 +308,7 @@ class SecComputer final
   ExternalOutputs_SecComputer_T SecComputer_Y;
   BlockIO_SecComputer_T SecComputer_B;
   D_Work_SecComputer_T SecComputer_DWork;
-  static Parameters_SecComputer_T SecComputer_P;
+  static const Parameters_SecComputer_T SecComputer_P;
   static void SecComputer_MATLABFunction(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void SecComputer_RateLimiter_Reset(rtDW_RateLimiter_SecComputer_T *localDW);
   static void SecComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init, real_T
@@ -19,7 +19,11 @@ typedef int int32_T;
 typedef unsigned int uint32_T;
 typedef float real32_T;
 typedef double real64_T;
+#ifdef FBW_MODEL_SINGLE_PRECISION
+typedef float real_T;
+#else
 typedef double real_T;
+#endif
 typedef double time_T;
 typedef unsigned char boolean_T;
 typedef int int_T;
@@ -22,6 +22,10 @@ class Sec {
 
   base_sec_analog_outputs getAnalogOutputs();
 
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+
   SecComputer::ExternalInputs_SecComputer_T modelInputs = {};
 
  private:
@@ -38,6 +42,8 @@ class Sec {
   // Model
   SecComputer secComputer;
   sec_outputs modelOutputs;
+  // true if the computer was running during the last model step
+  bool modelRunning = false;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -13,6 +13,10 @@ bool SRFlipFlop::update(bool set, bool reset) {
   return output;
 }
 
-bool SRFlipFlop::getOutput() {
+bool SRFlipFlop::getOutput() const {
   return output;
 }
+
+void SRFlipFlop::setOutput(bool value) {
+  output = value;
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 /// <summary>
 /// SimConnect data types to send to Sim Updated
 /// </summary>
@@ -202,6 +204,20 @@ class SimVars {
   ID PacksState1;
   ID PacksState2;
 
+  /// <summary>
+  /// Per-engine LVars in engine order, read and written by the indexed accessors
+  /// </summary>
+  std::array<ID, 4> EngineStates;
+  std::array<ID, 4> EngineTimers;
+  std::array<ID, 4> EnginesN1;
+  std::array<ID, 4> EnginesN2;
+  std::array<ID, 4> EnginesN3;
+  std::array<ID, 4> EngineEGTs;
+  std::array<ID, 4> EngineFFs;
+  std::array<ID, 4> EngineOils;
+  std::array<ID, 4> EngineOilTotals;
+  std::array<ID, 4> EngineFuelUsed;
+
   SimVars() { this->initializeVars(); }
 
   void initializeVars() {
@@ -288,6 +304,17 @@ class SimVars {
     PacksState1 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_1_IS_OPEN");
     PacksState2 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_2_IS_OPEN");
 
+    EngineStates = {Engine1State, Engine2State, Engine3State, Engine4State};
+    EngineTimers = {Engine1Timer, Engine2Timer, Engine3Timer, Engine4Timer};
+    EnginesN1 = {Engine1N1, Engine2N1, Engine3N1, Engine4N1};
+    EnginesN2 = {Engine1N2, Engine2N2, Engine3N2, Engine4N2};
+    EnginesN3 = {Engine1N3, Engine2N3, Engine3N3, Engine4N3};
+    EngineEGTs = {Engine1EGT, Engine2EGT, Engine3EGT, Engine4EGT};
+    EngineFFs = {Engine1FF, Engine2FF, Engine3FF, Engine4FF};
+    EngineOils = {Engine1Oil, Engine2Oil, Engine3Oil, Engine4Oil};
+    EngineOilTotals = {Engine1TotalOil, Engine2TotalOil, Engine3TotalOil, Engine4TotalOil};
+    EngineFuelUsed = {FuelUsedEngine1, FuelUsedEngine2, FuelUsedEngine3, FuelUsedEngine4};
+
     this->setDeveloperState(0);
     this->setEngine1N3(0);
     this->setEngine2N3(0);
@@ -436,6 +463,18 @@ class SimVars {
   void setThrustLimitClimb(FLOAT64 value) { set_named_variable_value(ThrustLimitClimb, value); }
   void setThrustLimitMct(FLOAT64 value) { set_named_variable_value(ThrustLimitMct, value); }
 
+  // Collection of per-engine LVar 'set' Functions, the engine index starts at 1
+  void setEngineState(int engine, FLOAT64 value) { set_named_variable_value(EngineStates[engine - 1], value); }
+  void setEngineTimer(int engine, FLOAT64 value) { set_named_variable_value(EngineTimers[engine - 1], value); }
+  void setEngineN1(int engine, FLOAT64 value) { set_named_variable_value(EnginesN1[engine - 1], value); }
+  void setEngineN2(int engine, FLOAT64 value) { set_named_variable_value(EnginesN2[engine - 1], value); }
+  void setEngineN3(int engine, FLOAT64 value) { set_named_variable_value(EnginesN3[engine - 1], value); }
+  void setEngineEGT(int engine, FLOAT64 value) { set_named_variable_value(EngineEGTs[engine - 1], value); }
+  void setEngineFF(int engine, FLOAT64 value) { set_named_variable_value(EngineFFs[engine - 1], value); }
+  void setEngineOil(int engine, FLOAT64 value) { set_named_variable_value(EngineOils[engine - 1], value); }
+  void setEngineOilTotal(int engine, FLOAT64 value) { set_named_variable_value(EngineOilTotals[engine - 1], value); }
+  void setEngineFuelUsed(int engine, FLOAT64 value) { set_named_variable_value(EngineFuelUsed[engine - 1], value); }
+
   // Collection of SimVar/LVar 'get' Functions
   FLOAT64 getDeveloperState() { return get_named_variable_value(DevVar); }
   FLOAT64 getIsReady() { return get_named_variable_value(IsReady); }
@@ -505,6 +544,16 @@ class SimVars {
   FLOAT64 getPacksState2() { return get_named_variable_value(PacksState2); }
   FLOAT64 getThrustLimitType() { return get_named_variable_value(ThrustLimitType); }
 
+  // Collection of per-engine LVar 'get' Functions, the engine index starts at 1
+  FLOAT64 getEngineState(int engine) { return get_named_variable_value(EngineStates[engine - 1]); }
+  FLOAT64 getEngineTimer(int engine) { return get_named_variable_value(EngineTimers[engine - 1]); }
+  FLOAT64 getEngineN1(int engine) { return get_named_variable_value(EnginesN1[engine - 1]); }
+  FLOAT64 getEngineN2(int engine) { return get_named_variable_value(EnginesN2[engine - 1]); }
+  FLOAT64 getEngineN3(int engine) { return get_named_variable_value(EnginesN3[engine - 1]); }
+  FLOAT64 getEngineEGT(int engine) { return get_named_variable_value(EngineEGTs[engine - 1]); }
+  FLOAT64 getEngineOil(int engine) { return get_named_variable_value(EngineOils[engine - 1]); }
+  FLOAT64 getEngineOilTotal(int engine) { return get_named_variable_value(EngineOilTotals[engine - 1]); }
+
   FLOAT64 getCN1(int index) { return aircraft_varget(CorrectedN1, m_Units->Percent, index); }
   FLOAT64 getCN2(int index) { return aircraft_varget(CorrectedN2, m_Units->Percent, index); }
   FLOAT64 getN1(int index) { return aircraft_varget(N1, m_Units->Percent, index); }
@@ -3,20 +3,44 @@
 #include "SimVars.h"
 #include "common.h"
 
-EngineRatios* ratios;
-
 /// <summary>
 /// Table 1502 (CN3 vs correctedN1) representations with FSX nomenclature
+/// Columns: CN3, correctedN1 at M0.2 (x2), correctedN1 at M0.9
+/// </summary>
+constexpr int TABLE1502_ROWS = 13;
+constexpr double TABLE1502[TABLE1502_ROWS][4] = {
+    {16.012, 0.000, 0.000, 17.000}, {19.355, 1.845, 1.845, 17.345}, {22.874, 2.427, 2.427, 18.127},
+    {50.147, 12.427, 12.427, 26.627}, {60.000, 18.500, 18.500, 33.728}, {67.742, 25.243, 25.243, 40.082},
+    {73.021, 30.505, 30.505, 43.854}, {78.299, 39.779, 39.779, 48.899}, {81.642, 49.515, 49.515, 53.557},
+    {85.337, 63.107, 63.107, 63.107}, {87.977, 74.757, 74.757, 74.757}, {97.800, 97.200, 97.200, 97.200},
+    {118.000, 115.347, 115.347, 115.347}};
+
+/// <summary>
+/// Table 1502 lookup
 /// </summary>
 /// <returns>Returns CN3 - correctedN1 pair.</returns>
 double table1502(int i, int j) {
-  double t[13][4] = {{16.012, 0.000, 0.000, 17.000},      {19.355, 1.845, 1.845, 17.345},   {22.874, 2.427, 2.427, 18.127},
-                     {50.147, 12.427, 12.427, 26.627},    {60.000, 18.500, 18.500, 33.728}, {67.742, 25.243, 25.243, 40.082},
-                     {73.021, 30.505, 30.505, 43.854},    {78.299, 39.779, 39.779, 48.899}, {81.642, 49.515, 49.515, 53.557},
-                     {85.337, 63.107, 63.107, 63.107},    {87.977, 74.757, 74.757, 74.757}, {97.800, 97.200, 97.200, 97.200},
-                     {118.000, 115.347, 115.347, 115.347}};
+  return TABLE1502[i][j];
+}
+
+/// <summary>
+/// Binary search for the table 1502 interval containing the given CN3
+/// </summary>
+/// <returns>Returns the upper row of the interval, clamped to [1, TABLE1502_ROWS - 1].</returns>
+int table1502Row(double cn3) {
+  int lo = 1;
+  int hi = TABLE1502_ROWS - 1;
+
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (TABLE1502[mid][0] > cn3) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
 
-  return t[i][j];
+  return lo;
 }
 
 /// <summary>
@@ -37,16 +61,10 @@ double iCN1(double pressAltitude, double mach, double ambientTemp) {
   int i;
   double cn1_lo = 0, cn1_hi = 0, cn1 = 0;
   double cn3 = iCN3(pressAltitude, mach);
-  double cell = 0;
   double cn3lo = 0, cn3hi = 0;
   double cn1lolo = 0, cn1hilo = 0, cn1lohi = 0, cn1hihi = 0;
 
-  for (i = 0; i < 13; i++) {
-    cell = table1502(i, 0);
-    if (cell > cn3) {
-      break;
-    }
-  }
+  i = table1502Row(cn3);
 
   cn3lo = table1502(i - 1, 0);
   cn3hi = table1502(i, 0);
@@ -66,4 +84,4 @@ double iCN1(double pressAltitude, double mach, double ambientTemp) {
   }
 
   return cn1;
-}
\ No newline at end of file
+}
@@ -4,6 +4,7 @@
 #include "inih/ini.h"
 #include "inih/ini_type_conversion.h"
 
+#include "ArmedModes.h"
 #include "Arinc429Utils.h"
 #include "FlyByWireInterface.h"
 #include "interface/SimConnectData.h"
@@ -169,6 +170,92 @@ bool FlyByWireInterface::update(double sampleTime) {
   return result;
 }
 
+// Writes the state of the flight control and autoflight computers to blob. The sim, local variables and the sensor buses
+// are read again every frame and are not part of a snapshot. The blob is only valid for this build of the module.
+void FlyByWireInterface::snapshot(std::vector<uint8_t>& blob) const {
+  blob.clear();
+  ModelSnapshotWriter writer(blob);
+  writer.write(SNAPSHOT_MAGIC);
+  writer.write(SNAPSHOT_VERSION);
+  writeComputerStates(writer);
+}
+
+// Restores a blob written by snapshot(), returns false and leaves the computers untouched if the blob does not match.
+bool FlyByWireInterface::restore(const std::vector<uint8_t>& blob) {
+  std::vector<uint8_t> current;
+  snapshot(current);
+  if (blob.size() != current.size()) {
+    return false;
+  }
+
+  ModelSnapshotReader reader(blob.data(), blob.size());
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  if (!reader.read(magic) || magic != SNAPSHOT_MAGIC || !reader.read(version) || version != SNAPSHOT_VERSION) {
+    return false;
+  }
+
+  if (!readComputerStates(reader) || !reader.atEnd()) {
+    // a partially read blob would leave the computers in a mixed state
+    ModelSnapshotReader rollback(current.data() + 2 * sizeof(uint32_t), current.size() - 2 * sizeof(uint32_t));
+    readComputerStates(rollback);
+    return false;
+  }
+  return true;
+}
+
+void FlyByWireInterface::writeComputerStates(ModelSnapshotWriter& writer) const {
+  for (int i = 0; i < 3; i++) {
+    prims[i].snapshot(writer);
+    writer.write(primsDiscreteOutputs[i]);
+    writer.write(primsAnalogOutputs[i]);
+    writer.write(primsBusOutputs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    secs[i].snapshot(writer);
+    writer.write(secsDiscreteOutputs[i]);
+    writer.write(secsAnalogOutputs[i]);
+    writer.write(secsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    facs[i].snapshot(writer);
+    writer.write(facsDiscreteOutputs[i]);
+    writer.write(facsAnalogOutputs[i]);
+    writer.write(facsBusOutputs[i]);
+  }
+
+  writer.write(autopilotStateMachineInput);
+  autopilotStateMachine.snapshot(writer);
+  writer.write(autopilotStateMachineOutput);
+  writer.write(autopilotLawsInput);
+  autopilotLaws.snapshot(writer);
+  writer.write(autopilotLawsOutput);
+  writer.write(autoThrustInput);
+  autoThrust.snapshot(writer);
+  writer.write(autoThrustOutput);
+}
+
+bool FlyByWireInterface::readComputerStates(ModelSnapshotReader& reader) {
+  bool result = true;
+  for (int i = 0; i < 3; i++) {
+    result = result && prims[i].restore(reader) && reader.read(primsDiscreteOutputs[i]) && reader.read(primsAnalogOutputs[i]) &&
+             reader.read(primsBusOutputs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    result = result && secs[i].restore(reader) && reader.read(secsDiscreteOutputs[i]) && reader.read(secsAnalogOutputs[i]) &&
+             reader.read(secsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    result = result && facs[i].restore(reader) && reader.read(facsDiscreteOutputs[i]) && reader.read(facsAnalogOutputs[i]) &&
+             reader.read(facsBusOutputs[i]);
+  }
+
+  return result && reader.read(autopilotStateMachineInput) && autopilotStateMachine.restore(reader) &&
+         reader.read(autopilotStateMachineOutput) && reader.read(autopilotLawsInput) && autopilotLaws.restore(reader) &&
+         reader.read(autopilotLawsOutput) && reader.read(autoThrustInput) && autoThrust.restore(reader) &&
+         reader.read(autoThrustOutput);
+}
+
 void FlyByWireInterface::loadConfiguration() {
   // parse from ini file
   INIStructure iniStructure;
@@ -2191,11 +2278,12 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
   idAutopilotActive_1->set(autopilotStateMachineOutput.enabled_AP1);
   idAutopilotActive_2->set(autopilotStateMachineOutput.enabled_AP2);
 
-  bool isLocArmed = static_cast<unsigned long long>(autopilotStateMachineOutput.lateral_mode_armed) >> 1 & 0x01;
+  bool isLocArmed = armed_modes::isLateralArmed(autopilotStateMachineOutput.lateral_mode_armed, armed_modes::LATERAL_LOC);
   bool isLocEngaged = autopilotStateMachineOutput.lateral_mode >= 30 && autopilotStateMachineOutput.lateral_mode <= 34;
-  bool isGsArmed = static_cast<unsigned long long>(autopilotStateMachineOutput.vertical_mode_armed) >> 4 & 0x01;
+  bool isGsArmed = armed_modes::isVerticalArmed(autopilotStateMachineOutput.vertical_mode_armed, armed_modes::VERTICAL_GS);
   bool isGsEngaged = autopilotStateMachineOutput.vertical_mode >= 30 && autopilotStateMachineOutput.vertical_mode <= 34;
-  bool isFinalArmed = static_cast<unsigned long long>(autopilotStateMachineOutput.vertical_mode_armed) >> 5 & 0x01;
+  bool isFinalArmed =
+      armed_modes::isVerticalArmed(autopilotStateMachineOutput.vertical_mode_armed, armed_modes::VERTICAL_FINAL_DES);
   bool isFinalEngaged = autopilotStateMachineOutput.vertical_mode == 24;
   idFcuLocModeActive->set((isLocArmed || isLocEngaged) && !(isGsArmed || isGsEngaged));
   idFcuApprModeActive->set(((isLocArmed || isLocEngaged) && (isGsArmed || isGsEngaged)) || isFinalArmed || isFinalEngaged);
@@ -4,10 +4,12 @@
 
 Fac::Fac(bool isUnit1) : isUnit1(isUnit1) {
   facComputer.initialize();
+  modelOutputs = facComputer.getExternalOutputs().out;
 }
 
 Fac::Fac(const Fac& obj) : isUnit1(obj.isUnit1) {
   facComputer.initialize();
+  modelOutputs = facComputer.getExternalOutputs().out;
 }
 
 // Erase all data in RAM
@@ -20,8 +22,10 @@ void Fac::update(double deltaTime, double simulationTime, bool faultActive, bool
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  if (!shortPowerFailure) {
+  // nothing changes in the model while the computer is not running, it is only stepped once more when it stops
+  if (!shortPowerFailure && (modelInputs.in.sim_data.computer_running || modelRunning)) {
     facComputer.setExternalInputs(&modelInputs);
+    modelRunning = modelInputs.in.sim_data.computer_running;
     facComputer.step();
     modelOutputs = facComputer.getExternalOutputs().out;
   }
@@ -155,3 +159,33 @@ base_fac_analog_outputs Fac::getAnalogOutputs() {
 
   return output;
 }
+
+// Write the computer state (monitoring and model) to a snapshot.
+void Fac::snapshot(ModelSnapshotWriter& writer) const {
+  writer.write(modelInputs);
+  facComputer.snapshot(writer);
+  writer.write(modelOutputs);
+  writer.write(modelRunning);
+  writer.write(facHealthy);
+  writer.write(facHealthyFlipFlop.getOutput());
+  writer.write(pushbuttonPulse);
+  writer.write(powerSupplyOutageTime);
+  writer.write(longPowerFailure);
+  writer.write(shortPowerFailure);
+  writer.write(selfTestTimer);
+  writer.write(selfTestComplete);
+}
+
+// Read the computer state back from a snapshot.
+bool Fac::restore(ModelSnapshotReader& reader) {
+  // the flip flop is restored through its output, the set precedence is fixed at construction
+  bool facHealthyFlipFlopOutput = false;
+  if (!(reader.read(modelInputs) && facComputer.restore(reader) && reader.read(modelOutputs) && reader.read(modelRunning) &&
+        reader.read(facHealthy) && reader.read(facHealthyFlipFlopOutput) && reader.read(pushbuttonPulse) &&
+        reader.read(powerSupplyOutageTime) && reader.read(longPowerFailure) && reader.read(shortPowerFailure) &&
+        reader.read(selfTestTimer) && reader.read(selfTestComplete))) {
+    return false;
+  }
+  facHealthyFlipFlop.setOutput(facHealthyFlipFlopOutput);
+  return true;
+}
@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-A380LateralDirectLaw::Parameters_A380LateralDirectLaw_T A380LateralDirectLaw::A380LateralDirectLaw_rtP{
+const A380LateralDirectLaw::Parameters_A380LateralDirectLaw_T A380LateralDirectLaw::A380LateralDirectLaw_rtP{
 
   0.0,
 
@@ -68,6 +68,16 @@ void A380LateralDirectLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   *rty_Out_zeta_upper_deg = *rty_Out_zeta_lower_deg;
 }
 
+void A380LateralDirectLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380LateralDirectLaw_DWork);
+}
+
+boolean_T A380LateralDirectLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380LateralDirectLaw_DWork);
+}
+
 A380LateralDirectLaw::A380LateralDirectLaw():
   A380LateralDirectLaw_DWork()
 {
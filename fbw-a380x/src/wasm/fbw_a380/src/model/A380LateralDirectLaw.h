@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_A380LateralDirectLaw_h_
 #define RTW_HEADER_A380LateralDirectLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "A380LateralDirectLaw_types.h"
 #include <cstring>
 
@@ -37,17 +38,19 @@ class A380LateralDirectLaw final
             *rty_Out_xi_inboard_deg, real_T *rty_Out_xi_midboard_deg, real_T *rty_Out_xi_outboard_deg, real_T
             *rty_Out_xi_spoiler_deg, real_T *rty_Out_zeta_upper_deg, real_T *rty_Out_zeta_lower_deg);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   A380LateralDirectLaw();
   ~A380LateralDirectLaw();
  private:
   D_Work_A380LateralDirectLaw_T A380LateralDirectLaw_DWork;
-  static Parameters_A380LateralDirectLaw_T A380LateralDirectLaw_rtP;
+  static const Parameters_A380LateralDirectLaw_T A380LateralDirectLaw_rtP;
   static void A380LateralDirectLaw_RateLimiter_Reset(rtDW_RateLimiter_A380LateralDirectLaw_T *localDW);
   static void A380LateralDirectLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_A380LateralDirectLaw_T *localDW);
 };
 
-extern A380LateralDirectLaw::Parameters_A380LateralDirectLaw_T A380LateralDirectLaw_rtP;
+extern const A380LateralDirectLaw::Parameters_A380LateralDirectLaw_T A380LateralDirectLaw_rtP;
 
 #endif
 
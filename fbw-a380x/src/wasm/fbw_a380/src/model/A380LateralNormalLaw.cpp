@@ -3,8 +3,9 @@
 #include <cmath>
 #include <cstring>
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 
-A380LateralNormalLaw::Parameters_A380LateralNormalLaw_T A380LateralNormalLaw::A380LateralNormalLaw_rtP{
+const A380LateralNormalLaw::Parameters_A380LateralNormalLaw_T A380LateralNormalLaw::A380LateralNormalLaw_rtP{
 
   { 0.0, 120.0, 150.0, 380.0 },
 
@@ -456,14 +457,14 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   rtb_Y = *rtu_In_V_tas_kn;
   rtb_Gain1_n = A380LateralNormalLaw_rtP.Gain1_Gain_b * *rtu_In_delta_xi_pos;
   if (*rtu_In_high_speed_prot_active) {
-    r = look1_binlxpw(*rtu_In_Phi_deg, A380LateralNormalLaw_rtP.BankAngleProtection2_bp01Data,
-                      A380LateralNormalLaw_rtP.BankAngleProtection2_tableData, 4U);
+    r = look1_pbinlxpw<4U>(*rtu_In_Phi_deg, A380LateralNormalLaw_rtP.BankAngleProtection2_bp01Data,
+                      A380LateralNormalLaw_rtP.BankAngleProtection2_tableData, &A380LateralNormalLaw_DWork.lookupIndex[0]);
   } else if (*rtu_In_high_aoa_prot_active) {
-    r = look1_binlxpw(*rtu_In_Phi_deg, A380LateralNormalLaw_rtP.BankAngleProtection_bp01Data,
-                      A380LateralNormalLaw_rtP.BankAngleProtection_tableData, 8U);
+    r = look1_pbinlxpw<8U>(*rtu_In_Phi_deg, A380LateralNormalLaw_rtP.BankAngleProtection_bp01Data,
+                      A380LateralNormalLaw_rtP.BankAngleProtection_tableData, &A380LateralNormalLaw_DWork.lookupIndex[1]);
   } else {
-    r = look1_binlxpw(*rtu_In_Phi_deg, A380LateralNormalLaw_rtP.BankAngleProtection1_bp01Data,
-                      A380LateralNormalLaw_rtP.BankAngleProtection1_tableData, 8U);
+    r = look1_pbinlxpw<8U>(*rtu_In_Phi_deg, A380LateralNormalLaw_rtP.BankAngleProtection1_bp01Data,
+                      A380LateralNormalLaw_rtP.BankAngleProtection1_tableData, &A380LateralNormalLaw_DWork.lookupIndex[2]);
   }
 
   rtb_Sum_x0 = 15.0;
@@ -530,16 +531,16 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
     rtb_Gain1_n = 0.0;
   }
 
-  r = look1_binlxpw(*rtu_In_V_ias_kn, A380LateralNormalLaw_rtP.ScheduledGain3_BreakpointsForDimension1,
-                    A380LateralNormalLaw_rtP.ScheduledGain3_Table, 3U);
+  r = look1_pbinlxpw<3U>(*rtu_In_V_ias_kn, A380LateralNormalLaw_rtP.ScheduledGain3_BreakpointsForDimension1,
+                    A380LateralNormalLaw_rtP.ScheduledGain3_Table, &A380LateralNormalLaw_DWork.lookupIndex[3]);
   if (*rtu_In_any_ap_engaged) {
     r = *rtu_In_ap_beta_c_deg + A380LateralNormalLaw_rtP.Constant_Value;
   } else {
     r *= *rtu_In_delta_zeta_pos;
   }
 
-  Vias = look1_binlxpw(*rtu_In_V_ias_kn, A380LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
-                       A380LateralNormalLaw_rtP.ScheduledGain1_Table, 4U);
+  Vias = look1_pbinlxpw<4U>(*rtu_In_V_ias_kn, A380LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
+                       A380LateralNormalLaw_rtP.ScheduledGain1_Table, &A380LateralNormalLaw_DWork.lookupIndex[4]);
   Vias = (r - ca) * Vias - rtb_Gain1_n;
   if ((!A380LateralNormalLaw_DWork.pY_not_empty) || (!A380LateralNormalLaw_DWork.pU_not_empty)) {
     A380LateralNormalLaw_DWork.pU = Vias;
@@ -553,8 +554,8 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   A380LateralNormalLaw_DWork.pY = (2.0 - rtb_Gain1_n) / (rtb_Gain1_n + 2.0) * A380LateralNormalLaw_DWork.pY + (Vias * ca
     + A380LateralNormalLaw_DWork.pU * ca);
   A380LateralNormalLaw_DWork.pU = Vias;
-  Vias = look1_binlxpw(*rtu_In_V_ias_kn, A380LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-                       A380LateralNormalLaw_rtP.ScheduledGain_Table, 8U);
+  Vias = look1_pbinlxpw<8U>(*rtu_In_V_ias_kn, A380LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+                       A380LateralNormalLaw_rtP.ScheduledGain_Table, &A380LateralNormalLaw_DWork.lookupIndex[5]);
   Vias *= r;
   if (!A380LateralNormalLaw_DWork.pY_not_empty_o) {
     A380LateralNormalLaw_DWork.pY_f = A380LateralNormalLaw_rtP.RateLimiterVariableTs2_InitialCondition;
@@ -592,8 +593,8 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   rtb_Gain1_n = *rtu_In_r_deg_s - std::sin(A380LateralNormalLaw_rtP.Gain1_Gain_f * rtb_Sum_x0) *
     A380LateralNormalLaw_rtP.Constant2_Value * std::cos(r) / (A380LateralNormalLaw_rtP.Gain6_Gain * rtb_Gain1_n) *
     A380LateralNormalLaw_rtP.Gain_Gain_i;
-  Vias = look1_binlxpw(*rtu_In_V_tas_kn, A380LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_a,
-                       A380LateralNormalLaw_rtP.ScheduledGain_Table_e, 6U);
+  Vias = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_a,
+                       A380LateralNormalLaw_rtP.ScheduledGain_Table_e, &A380LateralNormalLaw_DWork.lookupIndex[6]);
   if (!A380LateralNormalLaw_DWork.pY_not_empty_l) {
     A380LateralNormalLaw_DWork.pY_h = A380LateralNormalLaw_rtP.RateLimiterVariableTs1_InitialCondition_m;
     A380LateralNormalLaw_DWork.pY_not_empty_l = true;
@@ -611,8 +612,8 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   }
 
   rtb_Gain1_n *= Vias;
-  Vias = look1_binlxpw(*rtu_In_V_tas_kn, A380LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_j,
-                       A380LateralNormalLaw_rtP.ScheduledGain1_Table_m, 6U);
+  Vias = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_j,
+                       A380LateralNormalLaw_rtP.ScheduledGain1_Table_m, &A380LateralNormalLaw_DWork.lookupIndex[7]);
   Vias *= *rtu_In_r_deg_s;
   if (rtb_Gain1_n > A380LateralNormalLaw_rtP.Saturation1_UpperSat) {
     rtb_Gain1_n = A380LateralNormalLaw_rtP.Saturation1_UpperSat;
@@ -718,8 +719,8 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   rtb_Product_k = -(ca * ca) / rtb_Gain1_n;
   rtb_Y = A380LateralNormalLaw_rtP.Gain1_Gain_c * *rtu_In_pk_deg_s;
   rtb_Gain1_l0 = A380LateralNormalLaw_rtP.Gain1_Gain_bq * *rtu_In_Phi_deg;
-  r = look1_binlxpw(*rtu_In_time_dt, A380LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_j,
-                    A380LateralNormalLaw_rtP.ScheduledGain_Table_i, 4U);
+  r = look1_pbinlxpw<4U>(*rtu_In_time_dt, A380LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_j,
+                    A380LateralNormalLaw_rtP.ScheduledGain_Table_i, &A380LateralNormalLaw_DWork.lookupIndex[8]);
   A380LateralNormalLaw_DWork.Delay_DSTATE = ((-(rtb_Y_j5 / rtb_Gain1_h * 845.0 * 1592.01 * -0.5 / 8.5E+7 + 1.414 * ca) /
     rtb_Gain1_n * rtb_Y + rtb_Product_k * rtb_Gain1_l0) + A380LateralNormalLaw_rtP.Gain1_Gain_n * rtb_Sum_x0 *
     -rtb_Product_k) * r * A380LateralNormalLaw_rtP.Gain_Gain_p;
@@ -786,6 +787,16 @@ void A380LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_
   A380LateralNormalLaw_DWork.icLoad = false;
 }
 
+void A380LateralNormalLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380LateralNormalLaw_DWork);
+}
+
+boolean_T A380LateralNormalLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380LateralNormalLaw_DWork);
+}
+
 A380LateralNormalLaw::A380LateralNormalLaw():
   A380LateralNormalLaw_DWork()
 {
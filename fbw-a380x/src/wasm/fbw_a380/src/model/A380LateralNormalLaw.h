@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_A380LateralNormalLaw_h_
 #define RTW_HEADER_A380LateralNormalLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "A380LateralNormalLaw_types.h"
 #include <cstring>
 
@@ -39,6 +40,7 @@ class A380LateralNormalLaw final
     rtDW_RateLimiter_A380LateralNormalLaw_T sf_RateLimiter_dw;
     rtDW_RateLimiter_A380LateralNormalLaw_T sf_RateLimiter_n;
     rtDW_RateLimiter_A380LateralNormalLaw_T sf_RateLimiter;
+    uint32_T lookupIndex[9];
   };
 
   struct Parameters_A380LateralNormalLaw_T {
@@ -173,11 +175,13 @@ class A380LateralNormalLaw final
             *rty_Out_xi_inboard_deg, real_T *rty_Out_xi_midboard_deg, real_T *rty_Out_xi_outboard_deg, real_T
             *rty_Out_xi_spoiler_deg, real_T *rty_Out_zeta_upper_deg, real_T *rty_Out_zeta_lower_deg);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   A380LateralNormalLaw();
   ~A380LateralNormalLaw();
  private:
   D_Work_A380LateralNormalLaw_T A380LateralNormalLaw_DWork;
-  static Parameters_A380LateralNormalLaw_T A380LateralNormalLaw_rtP;
+  static const Parameters_A380LateralNormalLaw_T A380LateralNormalLaw_rtP;
   static void A380LateralNormalLaw_RateLimiter_Reset(rtDW_RateLimiter_A380LateralNormalLaw_T *localDW);
   static void A380LateralNormalLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_A380LateralNormalLaw_T *localDW);
@@ -187,7 +191,7 @@ class A380LateralNormalLaw final
     rtDW_TransportDelay_A380LateralNormalLaw_T *localDW);
 };
 
-extern A380LateralNormalLaw::Parameters_A380LateralNormalLaw_T A380LateralNormalLaw_rtP;
+extern const A380LateralNormalLaw::Parameters_A380LateralNormalLaw_T A380LateralNormalLaw_rtP;
 
 #endif
 
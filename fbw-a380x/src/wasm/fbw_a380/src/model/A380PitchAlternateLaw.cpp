@@ -2,6 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T A380PitchAlternateLaw_IN_NO_ACTIVE_CHILD{ 0U };
 
@@ -21,7 +22,7 @@ const uint8_T A380PitchAlternateLaw_IN_flight_flaps{ 2U };
 
 const uint8_T A380PitchAlternateLaw_IN_ground{ 3U };
 
-A380PitchAlternateLaw::Parameters_A380PitchAlternateLaw_T A380PitchAlternateLaw::A380PitchAlternateLaw_rtP{
+const A380PitchAlternateLaw::Parameters_A380PitchAlternateLaw_T A380PitchAlternateLaw::A380PitchAlternateLaw_rtP{
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
 
@@ -584,8 +585,8 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   rtb_Cos = std::cos(rtb_Gain1);
   rtb_Gain1 = A380PitchAlternateLaw_rtP.Gain1_Gain_l * *rtu_In_Phi_deg;
   rtb_Divide1_e = rtb_Cos / std::cos(rtb_Gain1);
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o,
-    A380PitchAlternateLaw_rtP.uDLookupTable_tableData_e, 6U);
+  rtb_Switch_i = look1_binlxpw<6U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o,
+    A380PitchAlternateLaw_rtP.uDLookupTable_tableData_e);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   rtb_Gain1 = A380PitchAlternateLaw_rtP.Gain1_Gain_o * *rtu_In_qk_deg_s;
   rtb_Gain_m = *rtu_In_nz_g - rtb_Divide1_e;
@@ -598,13 +599,13 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   rtb_Switch_c = (A380PitchAlternateLaw_rtP.Gain_Gain_a * A380PitchAlternateLaw_rtP.Vm_currentms_Value * rtb_Gain1 +
                   rtb_Gain_m) - (rtb_Switch_i / (A380PitchAlternateLaw_rtP.Gain5_Gain * rtb_Product1_d) +
     A380PitchAlternateLaw_rtP.Bias_Bias) * (rtb_Y_g - rtb_Divide1_e);
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.PLUT_bp01Data,
-    A380PitchAlternateLaw_rtP.PLUT_tableData, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.PLUT_bp01Data,
+    A380PitchAlternateLaw_rtP.PLUT_tableData);
   rtb_Product1_f = rtb_Switch_c * rtb_Switch_i;
   rtb_Y_g = A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain * *rtu_In_qk_deg_s;
   rtb_Divide = (rtb_Y_g - A380PitchAlternateLaw_DWork.Delay_DSTATE) / *rtu_In_time_dt;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.DLUT_bp01Data,
-    A380PitchAlternateLaw_rtP.DLUT_tableData, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.DLUT_bp01Data,
+    A380PitchAlternateLaw_rtP.DLUT_tableData);
   rtb_Gain1 = rtb_Switch_c * rtb_Switch_i * A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs_Gain;
   rtb_Divide_c = (rtb_Gain1 - A380PitchAlternateLaw_DWork.Delay_DSTATE_k) / *rtu_In_time_dt;
   rtb_Gain_j = A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs2_Gain * *rtu_In_V_tas_kn;
@@ -634,8 +635,8 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   rtb_Product1_f = A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain_m * *rtu_In_qk_deg_s;
   rtb_Divide_n = (rtb_Product1_f - A380PitchAlternateLaw_DWork.Delay_DSTATE_kd) / *rtu_In_time_dt;
   rtb_Divide = A380PitchAlternateLaw_rtP.Gain1_Gain_e * *rtu_In_qk_deg_s;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b,
-    A380PitchAlternateLaw_rtP.uDLookupTable_tableData_h, 6U);
+  rtb_Switch_c = look1_binlxpw<6U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b,
+    A380PitchAlternateLaw_rtP.uDLookupTable_tableData_h);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   if (rtb_Product1_d > A380PitchAlternateLaw_rtP.Saturation3_UpperSat_b) {
     rtb_Product1_d = A380PitchAlternateLaw_rtP.Saturation3_UpperSat_b;
@@ -654,8 +655,8 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
     (A380PitchAlternateLaw_rtP.RateLimiterVariableTs_up) * *rtu_In_time_dt), -std::abs
     (A380PitchAlternateLaw_rtP.RateLimiterVariableTs_lo) * *rtu_In_time_dt);
   if (*rtu_In_stabilities_available) {
-    rtb_Switch_c = look1_binlxpw(*rtu_In_flaps_handle_index, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data,
-      A380PitchAlternateLaw_rtP.uDLookupTable_tableData, 5U);
+    rtb_Switch_c = look1_binlxpw<5U>(*rtu_In_flaps_handle_index, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data,
+      A380PitchAlternateLaw_rtP.uDLookupTable_tableData);
     rtb_Switch_c -= *rtu_In_V_ias_kn;
     rtb_Switch_i = A380PitchAlternateLaw_rtP.Gain1_Gain * rtb_Switch_c;
   } else {
@@ -690,15 +691,15 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   }
 
   rtb_Switch_c = (A380PitchAlternateLaw_rtP.Gain_Gain_b * A380PitchAlternateLaw_rtP.Vm_currentms_Value_h * rtb_Divide +
-                  rtb_Gain_m) - ((((look1_binlxpw(A380PitchAlternateLaw_DWork.pY,
-    A380PitchAlternateLaw_rtP.Loaddemand_bp01Data, A380PitchAlternateLaw_rtP.Loaddemand_tableData, 2U) + rtb_Switch_i) +
+                  rtb_Gain_m) - ((((look1_binlxpw<2U>(A380PitchAlternateLaw_DWork.pY,
+    A380PitchAlternateLaw_rtP.Loaddemand_bp01Data, A380PitchAlternateLaw_rtP.Loaddemand_tableData) + rtb_Switch_i) +
     rtb_Switch_c) + rtb_Cos / std::cos(A380PitchAlternateLaw_rtP.Gain1_Gain_lm * rtb_Product1_d)) - rtb_Divide1_e) *
     rtb_Bias_o;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.PLUT_bp01Data_f,
-    A380PitchAlternateLaw_rtP.PLUT_tableData_k, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.PLUT_bp01Data_f,
+    A380PitchAlternateLaw_rtP.PLUT_tableData_k);
   rtb_Product1_d = rtb_Switch_c * rtb_Switch_i;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.DLUT_bp01Data_m,
-    A380PitchAlternateLaw_rtP.DLUT_tableData_a, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.DLUT_bp01Data_m,
+    A380PitchAlternateLaw_rtP.DLUT_tableData_a);
   rtb_Cos = rtb_Switch_c * rtb_Switch_i * A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs_Gain_b;
   rtb_Switch_i = (rtb_Cos - A380PitchAlternateLaw_DWork.Delay_DSTATE_j) / *rtu_In_time_dt;
   rtb_Divide = A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs2_Gain_c * *rtu_In_V_tas_kn;
@@ -727,8 +728,8 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   rtb_Divide_n = A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain_c * *rtu_In_qk_deg_s;
   rtb_Divide_i = (rtb_Divide_n - A380PitchAlternateLaw_DWork.Delay_DSTATE_e) / *rtu_In_time_dt;
   rtb_Switch_i = A380PitchAlternateLaw_rtP.Gain1_Gain_b * *rtu_In_qk_deg_s;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a,
-    A380PitchAlternateLaw_rtP.uDLookupTable_tableData_p, 6U);
+  rtb_Switch_c = look1_binlxpw<6U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a,
+    A380PitchAlternateLaw_rtP.uDLookupTable_tableData_p);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   if (rtb_Product1_d > A380PitchAlternateLaw_rtP.Saturation3_UpperSat_n) {
     rtb_Product1_d = A380PitchAlternateLaw_rtP.Saturation3_UpperSat_n;
@@ -744,11 +745,11 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
     &A380PitchAlternateLaw_DWork.sf_RateLimiter_n);
   rtb_Switch_c = (A380PitchAlternateLaw_rtP.Gain_Gain_p * A380PitchAlternateLaw_rtP.Vm_currentms_Value_p * rtb_Switch_i
                   + rtb_Gain_m) - (rtb_Switch_c - rtb_Divide1_e) * rtb_Product1_d;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.PLUT_bp01Data_a,
-    A380PitchAlternateLaw_rtP.PLUT_tableData_o, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.PLUT_bp01Data_a,
+    A380PitchAlternateLaw_rtP.PLUT_tableData_o);
   rtb_Product1_b = rtb_Switch_c * rtb_Switch_i;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.DLUT_bp01Data_k,
-    A380PitchAlternateLaw_rtP.DLUT_tableData_e, 1U);
+  rtb_Switch_i = look1_binlxpw<1U>(*rtu_In_V_tas_kn, A380PitchAlternateLaw_rtP.DLUT_bp01Data_k,
+    A380PitchAlternateLaw_rtP.DLUT_tableData_e);
   rtb_Divide1_e = rtb_Switch_c * rtb_Switch_i * A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs_Gain_p;
   rtb_Switch_i = (rtb_Divide1_e - A380PitchAlternateLaw_DWork.Delay_DSTATE_g) / *rtu_In_time_dt;
   rtb_Gain_m = A380PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs2_Gain_a * *rtu_In_V_tas_kn;
@@ -799,8 +800,8 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
     rtb_TmpSignalConversionAtSFunctionInport1[2] = rtb_Product1_d;
   }
 
-  rtb_Switch_c = look1_binlxpw(*rtu_In_flaps_handle_index,
-    A380PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1, A380PitchAlternateLaw_rtP.ScheduledGain_Table, 5U);
+  rtb_Switch_c = look1_binlxpw<5U>(*rtu_In_flaps_handle_index,
+    A380PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1, A380PitchAlternateLaw_rtP.ScheduledGain_Table);
   if (rtb_TmpSignalConversionAtSFunctionInport1[0] < rtb_TmpSignalConversionAtSFunctionInport1[1]) {
     if (rtb_TmpSignalConversionAtSFunctionInport1[1] < rtb_TmpSignalConversionAtSFunctionInport1[2]) {
       rtb_TmpSignalConversionAtSFunct = 1;
@@ -818,8 +819,8 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   }
 
   rtb_Divide_c = rtb_TmpSignalConversionAtSFunctionInport1[rtb_TmpSignalConversionAtSFunct] * rtb_Switch_c;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_time_dt, A380PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
-    A380PitchAlternateLaw_rtP.ScheduledGain_Table_h, 4U);
+  rtb_Switch_c = look1_binlxpw<4U>(*rtu_In_time_dt, A380PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
+    A380PitchAlternateLaw_rtP.ScheduledGain_Table_h);
   rtb_Switch_c = rtb_Divide_c * rtb_Switch_c * A380PitchAlternateLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain *
     *rtu_In_time_dt;
   if (A380PitchAlternateLaw_rtP.Switch_Threshold < 0.0) {
@@ -871,6 +872,16 @@ void A380PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu
   A380PitchAlternateLaw_DWork.icLoad = false;
 }
 
+void A380PitchAlternateLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380PitchAlternateLaw_DWork);
+}
+
+boolean_T A380PitchAlternateLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380PitchAlternateLaw_DWork);
+}
+
 A380PitchAlternateLaw::A380PitchAlternateLaw():
   A380PitchAlternateLaw_DWork()
 {
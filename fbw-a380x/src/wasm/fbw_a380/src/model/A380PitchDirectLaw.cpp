@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw::A380PitchDirectLaw_rtP{
+const A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw::A380PitchDirectLaw_rtP{
 
   0.0,
 
@@ -53,6 +53,16 @@ void A380PitchDirectLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   *rty_Out_eta_deg = A380PitchDirectLaw_DWork.pY;
 }
 
+void A380PitchDirectLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380PitchDirectLaw_DWork);
+}
+
+boolean_T A380PitchDirectLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380PitchDirectLaw_DWork);
+}
+
 A380PitchDirectLaw::A380PitchDirectLaw():
   A380PitchDirectLaw_DWork()
 {
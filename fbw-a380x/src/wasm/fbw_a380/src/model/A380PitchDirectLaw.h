@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_A380PitchDirectLaw_h_
 #define RTW_HEADER_A380PitchDirectLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "A380PitchDirectLaw_types.h"
 #include <cstring>
 
@@ -31,14 +32,16 @@ class A380PitchDirectLaw final
   void step(const real_T *rtu_In_time_dt, const real_T *rtu_In_delta_eta_pos, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   A380PitchDirectLaw();
   ~A380PitchDirectLaw();
  private:
   D_Work_A380PitchDirectLaw_T A380PitchDirectLaw_DWork;
-  static Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
+  static const Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
 };
 
-extern A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
+extern const A380PitchDirectLaw::Parameters_A380PitchDirectLaw_T A380PitchDirectLaw_rtP;
 
 #endif
 
@@ -3,6 +3,7 @@
 #include <cmath>
 #include "look1_binlxpw.h"
 #include "look2_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T A380PitchNormalLaw_IN_Flare_Reduce_Theta_c{ 1U };
 
@@ -48,7 +49,7 @@ const uint8_T A380PitchNormalLaw_IN_OFF{ 1U };
 
 const uint8_T A380PitchNormalLaw_IN_ON{ 2U };
 
-A380PitchNormalLaw::Parameters_A380PitchNormalLaw_T A380PitchNormalLaw::A380PitchNormalLaw_rtP{
+const A380PitchNormalLaw::Parameters_A380PitchNormalLaw_T A380PitchNormalLaw::A380PitchNormalLaw_rtP{
 
   { 0.0, 50.0, 100.0, 200.0 },
 
@@ -1520,8 +1521,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Cos = std::cos(rtb_Loaddemand2_l);
   rtb_Loaddemand2_l = A380PitchNormalLaw_rtP.Gain1_Gain_l * *rtu_In_Phi_deg;
   rtb_Y_o2 = rtb_Cos / std::cos(rtb_Loaddemand2_l);
-  rtb_Y_a = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data,
-    A380PitchNormalLaw_rtP.uDLookupTable_tableData, 6U);
+  rtb_Y_a = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data,
+    A380PitchNormalLaw_rtP.uDLookupTable_tableData, &A380PitchNormalLaw_DWork.lookupIndex[0]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   rtb_Loaddemand2_l = A380PitchNormalLaw_rtP.Gain1_Gain_e * *rtu_In_qk_deg_s;
   rtb_Gain_g = *rtu_In_nz_g - rtb_Y_o2;
@@ -1540,15 +1541,13 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
 
   rtb_Saturation3 = (A380PitchNormalLaw_rtP.Gain_Gain_c * A380PitchNormalLaw_rtP.Vm_currentms_Value * rtb_Loaddemand2_l
                      + rtb_Gain_g) - (rtb_Y_a / (A380PitchNormalLaw_rtP.Gain5_Gain * rtb_uDLookupTable) +
-    A380PitchNormalLaw_rtP.Bias_Bias) * ((rtb_Y_o2 + look1_binlxpw(rtb_Divide_kq,
-    A380PitchNormalLaw_rtP.Loaddemand1_bp01Data, A380PitchNormalLaw_rtP.Loaddemand1_tableData, 2U)) - rtb_Y_o2);
-  rtb_Y_a = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data, A380PitchNormalLaw_rtP.PLUT_tableData,
-    1U);
+    A380PitchNormalLaw_rtP.Bias_Bias) * ((rtb_Y_o2 + look1_pbinlxpw<2U>(rtb_Divide_kq,
+    A380PitchNormalLaw_rtP.Loaddemand1_bp01Data, A380PitchNormalLaw_rtP.Loaddemand1_tableData, &A380PitchNormalLaw_DWork.lookupIndex[1])) - rtb_Y_o2);
+  rtb_Y_a = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data, A380PitchNormalLaw_rtP.PLUT_tableData, &A380PitchNormalLaw_DWork.lookupIndex[2]);
   rtb_Product1_dm = rtb_Saturation3 * rtb_Y_a;
   rtb_Loaddemand2_l = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain * *rtu_In_qk_deg_s;
   rtb_Divide = (rtb_Loaddemand2_l - A380PitchNormalLaw_DWork.Delay_DSTATE_h) / *rtu_In_time_dt;
-  rtb_Y_a = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data, A380PitchNormalLaw_rtP.DLUT_tableData,
-    1U);
+  rtb_Y_a = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data, A380PitchNormalLaw_rtP.DLUT_tableData, &A380PitchNormalLaw_DWork.lookupIndex[3]);
   rtb_Gain_px = rtb_Saturation3 * rtb_Y_a * A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain;
   rtb_Divide_o = (rtb_Gain_px - A380PitchNormalLaw_DWork.Delay_DSTATE_n) / *rtu_In_time_dt;
   rtb_Gain_ot = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain * *rtu_In_V_tas_kn;
@@ -1566,8 +1565,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Gain5_gq = std::fmin(*rtu_In_spoilers_left_pos, *rtu_In_spoilers_right_pos);
   A380PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, A380PitchNormalLaw_rtP.WashoutFilter_C1, rtu_In_time_dt, &rtb_Y_gw,
     &A380PitchNormalLaw_DWork.sf_WashoutFilter_k);
-  rtb_Y_a = look1_binlxpw(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table, 3U);
+  rtb_Y_a = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table, &A380PitchNormalLaw_DWork.lookupIndex[4]);
   if (rtb_Y_gw > A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat) {
     rtb_Y_gw = A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat;
   } else if (rtb_Y_gw < A380PitchNormalLaw_rtP.SaturationSpoilers_LowerSat) {
@@ -1578,8 +1577,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Divide_an = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_i * *rtu_In_qk_deg_s;
   rtb_Divide_cq = (rtb_Divide_an - A380PitchNormalLaw_DWork.Delay_DSTATE_l) / *rtu_In_time_dt;
   rtb_Gain1_ft = A380PitchNormalLaw_rtP.Gain1_Gain_o * *rtu_In_qk_deg_s;
-  rtb_Saturation3 = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_o,
-    A380PitchNormalLaw_rtP.uDLookupTable_tableData_e, 6U);
+  rtb_Saturation3 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_o,
+    A380PitchNormalLaw_rtP.uDLookupTable_tableData_e, &A380PitchNormalLaw_DWork.lookupIndex[5]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   if (rtb_uDLookupTable > A380PitchNormalLaw_rtP.Saturation3_UpperSat_a) {
     rtb_uDLookupTable = A380PitchNormalLaw_rtP.Saturation3_UpperSat_a;
@@ -1590,11 +1589,11 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Saturation3 = (A380PitchNormalLaw_rtP.Gain_Gain_al * A380PitchNormalLaw_rtP.Vm_currentms_Value_e * rtb_Gain1_ft +
                      rtb_Gain_g) - (rtb_Saturation3 / (A380PitchNormalLaw_rtP.Gain5_Gain_d * rtb_uDLookupTable) +
     A380PitchNormalLaw_rtP.Bias_Bias_a) * (rtb_Y_p - rtb_Y_o2);
-  rtb_Y_a = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_b,
-    A380PitchNormalLaw_rtP.PLUT_tableData_b, 1U);
+  rtb_Y_a = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_b,
+    A380PitchNormalLaw_rtP.PLUT_tableData_b, &A380PitchNormalLaw_DWork.lookupIndex[6]);
   rtb_Product1_ck = rtb_Saturation3 * rtb_Y_a;
-  rtb_Y_a = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_h,
-    A380PitchNormalLaw_rtP.DLUT_tableData_p, 1U);
+  rtb_Y_a = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_h,
+    A380PitchNormalLaw_rtP.DLUT_tableData_p, &A380PitchNormalLaw_DWork.lookupIndex[7]);
   rtb_Gain1_ft = rtb_Saturation3 * rtb_Y_a * A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_j;
   rtb_Divide_l = (rtb_Gain1_ft - A380PitchNormalLaw_DWork.Delay_DSTATE_k) / *rtu_In_time_dt;
   rtb_Gain_bs = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_e * *rtu_In_V_tas_kn;
@@ -1611,8 +1610,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
 
   A380PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, A380PitchNormalLaw_rtP.WashoutFilter_C1_n, rtu_In_time_dt, &rtb_Y_gw,
     &A380PitchNormalLaw_DWork.sf_WashoutFilter_c);
-  rtb_Y_a = look1_binlxpw(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_n,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table_b, 3U);
+  rtb_Y_a = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_n,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table_b, &A380PitchNormalLaw_DWork.lookupIndex[8]);
   if (rtb_Y_gw > A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_g) {
     rtb_Y_gw = A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_g;
   } else if (rtb_Y_gw < A380PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_j) {
@@ -1675,8 +1674,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_alpha_err_gain = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_m * *rtu_In_qk_deg_s;
   rtb_Divide_kq = (rtb_alpha_err_gain - A380PitchNormalLaw_DWork.Delay_DSTATE_kd) / *rtu_In_time_dt;
   rtb_Gain1_e = A380PitchNormalLaw_rtP.Gain1_Gain_en * *rtu_In_qk_deg_s;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_b,
-    A380PitchNormalLaw_rtP.uDLookupTable_tableData_h, 6U);
+  rtb_Sum_j4 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_b,
+    A380PitchNormalLaw_rtP.uDLookupTable_tableData_h, &A380PitchNormalLaw_DWork.lookupIndex[9]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   if (rtb_uDLookupTable > A380PitchNormalLaw_rtP.Saturation3_UpperSat_b) {
     rtb_uDLookupTable = A380PitchNormalLaw_rtP.Saturation3_UpperSat_b;
@@ -1690,8 +1689,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
     A380PitchNormalLaw_rtP.RateLimiterVariableTs1_lo_g, rtu_In_time_dt,
     A380PitchNormalLaw_rtP.RateLimiterVariableTs1_InitialCondition_l, &rtb_Y_p,
     &A380PitchNormalLaw_DWork.sf_RateLimiter_d);
-  rtb_uDLookupTable = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_h,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table_j, 6U);
+  rtb_uDLookupTable = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_h,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table_j, &A380PitchNormalLaw_DWork.lookupIndex[10]);
   A380PitchNormalLaw_RateLimiter_c(rtu_In_delta_eta_pos, A380PitchNormalLaw_rtP.RateLimiterVariableTs_up_n,
     A380PitchNormalLaw_rtP.RateLimiterVariableTs_lo_c, rtu_In_time_dt,
     A380PitchNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_o, &rtb_Y_gw,
@@ -1730,8 +1729,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
     rtb_Sum_j4 = rtb_Y_p - *rtu_In_Theta_deg;
     rtb_Sum_j4 *= rtb_uDLookupTable;
   } else {
-    rtb_Sum_j4 = look1_binlxpw(rtb_Y_gw, A380PitchNormalLaw_rtP.Loaddemand_bp01Data,
-      A380PitchNormalLaw_rtP.Loaddemand_tableData, 2U);
+    rtb_Sum_j4 = look1_pbinlxpw<2U>(rtb_Y_gw, A380PitchNormalLaw_rtP.Loaddemand_bp01Data,
+      A380PitchNormalLaw_rtP.Loaddemand_tableData, &A380PitchNormalLaw_DWork.lookupIndex[11]);
     if (rtb_Y_a > A380PitchNormalLaw_rtP.Saturation_UpperSat) {
       rtb_Y_a = A380PitchNormalLaw_rtP.Saturation_UpperSat;
     } else if (rtb_Y_a < A380PitchNormalLaw_rtP.Saturation_LowerSat) {
@@ -1795,11 +1794,11 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Sum_j4 = (A380PitchNormalLaw_rtP.Gain_Gain_b * A380PitchNormalLaw_rtP.Vm_currentms_Value_h * rtb_Gain1_e +
                 rtb_Gain_g) - ((rtb_Cos / std::cos(A380PitchNormalLaw_rtP.Gain1_Gain_lm * rtb_uDLookupTable) +
     rtb_Sum_j4) - rtb_Y_o2) * rtb_Bias_o;
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_f,
-    A380PitchNormalLaw_rtP.PLUT_tableData_k, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_f,
+    A380PitchNormalLaw_rtP.PLUT_tableData_k, &A380PitchNormalLaw_DWork.lookupIndex[12]);
   rtb_Y_a = rtb_Sum_j4 * rtb_Y_n;
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_m,
-    A380PitchNormalLaw_rtP.DLUT_tableData_a, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_m,
+    A380PitchNormalLaw_rtP.DLUT_tableData_a, &A380PitchNormalLaw_DWork.lookupIndex[13]);
   rtb_Cos = rtb_Sum_j4 * rtb_Y_n * A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_b;
   rtb_uDLookupTable = (rtb_Cos - A380PitchNormalLaw_DWork.Delay_DSTATE_jh) / *rtu_In_time_dt;
   rtb_Y_p = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_c * *rtu_In_V_tas_kn;
@@ -1816,8 +1815,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Y_gw = A380PitchNormalLaw_rtP.Gain_Gain_f * rtb_Sum_j4;
   A380PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, A380PitchNormalLaw_rtP.WashoutFilter_C1_l, rtu_In_time_dt, &rtb_Sum_j4,
     &A380PitchNormalLaw_DWork.sf_WashoutFilter_l);
-  rtb_Y_n = look1_binlxpw(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_c,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table_g, 3U);
+  rtb_Y_n = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_c,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table_g, &A380PitchNormalLaw_DWork.lookupIndex[14]);
   if (rtb_Sum_j4 > A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_o) {
     rtb_Sum_j4 = A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_o;
   } else if (rtb_Sum_j4 < A380PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_jl) {
@@ -1829,8 +1828,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Y_a = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_c * *rtu_In_qk_deg_s;
   rtb_Saturation3 = (rtb_Y_a - A380PitchNormalLaw_DWork.Delay_DSTATE_e5) / *rtu_In_time_dt;
   rtb_Y_gw = A380PitchNormalLaw_rtP.Gain1_Gain_b * *rtu_In_qk_deg_s;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_a,
-    A380PitchNormalLaw_rtP.uDLookupTable_tableData_p, 6U);
+  rtb_Sum_j4 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_a,
+    A380PitchNormalLaw_rtP.uDLookupTable_tableData_p, &A380PitchNormalLaw_DWork.lookupIndex[15]);
   rtb_Divide_kq = *rtu_In_V_tas_kn;
   if (rtb_Divide_kq > A380PitchNormalLaw_rtP.Saturation3_UpperSat_n) {
     rtb_Divide_kq = A380PitchNormalLaw_rtP.Saturation3_UpperSat_n;
@@ -1841,11 +1840,11 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Sum_j4 = (A380PitchNormalLaw_rtP.Gain_Gain_p * A380PitchNormalLaw_rtP.Vm_currentms_Value_p * rtb_Y_gw + rtb_Gain_g)
     - (rtb_Sum_j4 / (A380PitchNormalLaw_rtP.Gain5_Gain_n * rtb_Divide_kq) + A380PitchNormalLaw_rtP.Bias_Bias_ai) *
     (rtb_Y_h - rtb_Y_o2);
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_a,
-    A380PitchNormalLaw_rtP.PLUT_tableData_o, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_a,
+    A380PitchNormalLaw_rtP.PLUT_tableData_o, &A380PitchNormalLaw_DWork.lookupIndex[16]);
   rtb_Gain1_e = rtb_Sum_j4 * rtb_Y_n;
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_k,
-    A380PitchNormalLaw_rtP.DLUT_tableData_e, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_k,
+    A380PitchNormalLaw_rtP.DLUT_tableData_e, &A380PitchNormalLaw_DWork.lookupIndex[17]);
   rtb_Y_h = rtb_Sum_j4 * rtb_Y_n * A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_p;
   rtb_Bias_o = (rtb_Y_h - A380PitchNormalLaw_DWork.Delay_DSTATE_gz) / *rtu_In_time_dt;
   rtb_Y_gw = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_a * *rtu_In_V_tas_kn;
@@ -1862,8 +1861,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_v_target = A380PitchNormalLaw_rtP.Gain_Gain_k * rtb_Sum_j4;
   A380PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, A380PitchNormalLaw_rtP.WashoutFilter_C1_h, rtu_In_time_dt, &rtb_Sum_j4,
     &A380PitchNormalLaw_DWork.sf_WashoutFilter_d);
-  rtb_Y_n = look1_binlxpw(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_f,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table_h, 3U);
+  rtb_Y_n = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_f,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table_h, &A380PitchNormalLaw_DWork.lookupIndex[18]);
   rtb_Divide_kq = (((A380PitchNormalLaw_rtP.Gain3_Gain_m * rtb_Divide_cq + rtb_Product1_ck) + rtb_Divide_l) +
                    A380PitchNormalLaw_rtP.Gain_Gain_j * rtb_Gain_f) + rtb_Product_n3;
   if (rtb_Sum_j4 > A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_h) {
@@ -1897,8 +1896,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Divide_cq = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_k * *rtu_In_qk_deg_s;
   rtb_Product1_ck = (rtb_Divide_cq - A380PitchNormalLaw_DWork.Delay_DSTATE_ho) / *rtu_In_time_dt;
   rtb_Divide_l = A380PitchNormalLaw_rtP.Gain1_Gain_lk * *rtu_In_qk_deg_s;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_m,
-    A380PitchNormalLaw_rtP.uDLookupTable_tableData_a, 6U);
+  rtb_Sum_j4 = look1_pbinlxpw<6U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_m,
+    A380PitchNormalLaw_rtP.uDLookupTable_tableData_a, &A380PitchNormalLaw_DWork.lookupIndex[19]);
   rtb_uDLookupTable = *rtu_In_V_tas_kn;
   rtb_Divide_kq = A380PitchNormalLaw_rtP.Gain3_Gain_g * A380PitchNormalLaw_rtP.Theta_max3_Value - rtb_Loaddemand2;
   if (rtb_uDLookupTable > A380PitchNormalLaw_rtP.Saturation3_UpperSat_e) {
@@ -1915,13 +1914,13 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
 
   rtb_Sum_j4 = (A380PitchNormalLaw_rtP.Gain_Gain_jq * A380PitchNormalLaw_rtP.Vm_currentms_Value_b * rtb_Divide_l +
                 rtb_Gain_g) - (rtb_Sum_j4 / (A380PitchNormalLaw_rtP.Gain5_Gain_m * rtb_uDLookupTable) +
-    A380PitchNormalLaw_rtP.Bias_Bias_m) * ((rtb_Y_o2 + look1_binlxpw(rtb_Divide_kq,
-    A380PitchNormalLaw_rtP.Loaddemand2_bp01Data, A380PitchNormalLaw_rtP.Loaddemand2_tableData, 2U)) - rtb_Y_o2);
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_e,
-    A380PitchNormalLaw_rtP.PLUT_tableData_g, 1U);
+    A380PitchNormalLaw_rtP.Bias_Bias_m) * ((rtb_Y_o2 + look1_pbinlxpw<2U>(rtb_Divide_kq,
+    A380PitchNormalLaw_rtP.Loaddemand2_bp01Data, A380PitchNormalLaw_rtP.Loaddemand2_tableData, &A380PitchNormalLaw_DWork.lookupIndex[20])) - rtb_Y_o2);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.PLUT_bp01Data_e,
+    A380PitchNormalLaw_rtP.PLUT_tableData_g, &A380PitchNormalLaw_DWork.lookupIndex[21]);
   rtb_Y_o2 = rtb_Sum_j4 * rtb_Y_n;
-  rtb_Y_n = look1_binlxpw(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_hw,
-    A380PitchNormalLaw_rtP.DLUT_tableData_l, 1U);
+  rtb_Y_n = look1_pbinlxpw<1U>(*rtu_In_V_tas_kn, A380PitchNormalLaw_rtP.DLUT_bp01Data_hw,
+    A380PitchNormalLaw_rtP.DLUT_tableData_l, &A380PitchNormalLaw_DWork.lookupIndex[22]);
   rtb_Loaddemand2 = rtb_Sum_j4 * rtb_Y_n * A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_c;
   rtb_Divide_l = (rtb_Loaddemand2 - A380PitchNormalLaw_DWork.Delay_DSTATE_ds) / *rtu_In_time_dt;
   rtb_Gain_g = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_p * *rtu_In_V_tas_kn;
@@ -1938,8 +1937,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Gain_f = A380PitchNormalLaw_rtP.Gain_Gain_l0 * rtb_Sum_j4;
   A380PitchNormalLaw_WashoutFilter(rtb_Gain5_gq, A380PitchNormalLaw_rtP.WashoutFilter_C1_j, rtu_In_time_dt, &rtb_Sum_j4,
     &A380PitchNormalLaw_DWork.sf_WashoutFilter);
-  rtb_Y_n = look1_binlxpw(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_b,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table_e, 3U);
+  rtb_Y_n = look1_pbinlxpw<3U>(*rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_b,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table_e, &A380PitchNormalLaw_DWork.lookupIndex[23]);
   rtb_uDLookupTable = (((A380PitchNormalLaw_rtP.Gain3_Gain * rtb_Divide + rtb_Product1_dm) + rtb_Divide_o) +
                        A380PitchNormalLaw_rtP.Gain_Gain_l * rtb_Divide_a0) + rtb_Product_kz;
   if (rtb_Sum_j4 > A380PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_m) {
@@ -1963,11 +1962,11 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   }
 
   A380PitchNormalLaw_VoterAttitudeProtection(rtb_uDLookupTable, rtb_Saturation3, rtb_Divide_kq, &rtb_Y_n);
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_ias_kn, A380PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
-    A380PitchNormalLaw_rtP.ScheduledGain1_Table, 4U);
+  rtb_Sum_j4 = look1_pbinlxpw<4U>(*rtu_In_V_ias_kn, A380PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
+    A380PitchNormalLaw_rtP.ScheduledGain1_Table, &A380PitchNormalLaw_DWork.lookupIndex[24]);
   rtb_Y_o2 = rtb_Y_n * rtb_Sum_j4;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_time_dt, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
-    A380PitchNormalLaw_rtP.ScheduledGain_Table_hh, 4U);
+  rtb_Sum_j4 = look1_pbinlxpw<4U>(*rtu_In_time_dt, A380PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
+    A380PitchNormalLaw_rtP.ScheduledGain_Table_hh, &A380PitchNormalLaw_DWork.lookupIndex[25]);
   rtb_Sum_j4 = rtb_Y_o2 * rtb_Sum_j4 * A380PitchNormalLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain * *rtu_In_time_dt;
   if (A380PitchNormalLaw_B.in_flight > A380PitchNormalLaw_rtP.Switch_Threshold) {
     rtb_Y_n = *rtu_In_eta_deg;
@@ -2018,9 +2017,9 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
     A380PitchNormalLaw_rtP.RateLimiterVariableTs_lo_i, rtu_In_time_dt,
     A380PitchNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_m, &rtb_Y_o2,
     &A380PitchNormalLaw_DWork.sf_RateLimiter_ct);
-  rtb_Sum_j4 = look2_binlxpw(*rtu_In_Theta_deg, *rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_l,
-    A380PitchNormalLaw_rtP.uDLookupTable_bp02Data, A380PitchNormalLaw_rtP.uDLookupTable_tableData_e5,
-    A380PitchNormalLaw_rtP.uDLookupTable_maxIndex, 5U);
+  rtb_Sum_j4 = look2_pbinlxpw<5U>(*rtu_In_Theta_deg, *rtu_In_H_radio_ft, A380PitchNormalLaw_rtP.uDLookupTable_bp01Data_l,
+    A380PitchNormalLaw_rtP.uDLookupTable_bp02Data, A380PitchNormalLaw_rtP.uDLookupTable_tableData_e5, &A380PitchNormalLaw_DWork.lookupIndex[26],
+    A380PitchNormalLaw_rtP.uDLookupTable_maxIndex);
   rtb_Y_n = *rtu_In_tailstrike_protection_on;
   if (rtb_Y_o2 > A380PitchNormalLaw_rtP.Saturation3_UpperSat_l) {
     rtb_eta_trim_deg_rate_limit_up_deg_s = A380PitchNormalLaw_rtP.Saturation3_UpperSat_l;
@@ -2030,8 +2029,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
     rtb_eta_trim_deg_rate_limit_up_deg_s = rtb_Y_o2;
   }
 
-  rtb_Sum_j4 = look1_binlxpw(rtb_Y_n * rtb_Sum_j4 * rtb_eta_trim_deg_rate_limit_up_deg_s + rtb_Y_o2,
-    A380PitchNormalLaw_rtP.PitchRateDemand_bp01Data, A380PitchNormalLaw_rtP.PitchRateDemand_tableData, 2U);
+  rtb_Sum_j4 = look1_pbinlxpw<2U>(rtb_Y_n * rtb_Sum_j4 * rtb_eta_trim_deg_rate_limit_up_deg_s + rtb_Y_o2,
+    A380PitchNormalLaw_rtP.PitchRateDemand_bp01Data, A380PitchNormalLaw_rtP.PitchRateDemand_tableData, &A380PitchNormalLaw_DWork.lookupIndex[28]);
   rtb_eta_trim_deg_rate_limit_up_deg_s = A380PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_j3 * rtb_Sum_j4;
   rtb_Y_o2 = (rtb_eta_trim_deg_rate_limit_up_deg_s - A380PitchNormalLaw_DWork.Delay_DSTATE_ej) / *rtu_In_time_dt;
   rtb_Y_n = *rtu_In_qk_deg_s - rtb_Sum_j4;
@@ -2048,8 +2047,8 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   rtb_Y_o2 = (((rtb_Divide_o + rtb_Divide_a0) * A380PitchNormalLaw_rtP.Gain1_Gain_a +
                A380PitchNormalLaw_rtP.Gain3_Gain_e * rtb_Y_o2) + (rtb_Y_n - rtb_Sum_j4) *
               A380PitchNormalLaw_rtP.Gain4_Gain) + rtb_Gain5_gq;
-  rtb_Sum_j4 = look1_binlxpw(*rtu_In_V_ias_kn, A380PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_h,
-    A380PitchNormalLaw_rtP.ScheduledGain1_Table_c, 4U);
+  rtb_Sum_j4 = look1_pbinlxpw<4U>(*rtu_In_V_ias_kn, A380PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_h,
+    A380PitchNormalLaw_rtP.ScheduledGain1_Table_c, &A380PitchNormalLaw_DWork.lookupIndex[29]);
   rtb_Sum_j4 = (A380PitchNormalLaw_rtP.Constant2_Value_k - rtb_ManualSwitch) * (rtb_Y_o2 * rtb_Sum_j4) *
     A380PitchNormalLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain_j * *rtu_In_time_dt;
   rtb_eta_trim_deg_should_freeze = (*rtu_In_delta_eta_pos <= A380PitchNormalLaw_rtP.Constant_Value_o);
@@ -2129,6 +2128,18 @@ void A380PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In
   A380PitchNormalLaw_DWork.icLoad_p = false;
 }
 
+void A380PitchNormalLaw::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380PitchNormalLaw_B);
+  writer.write(A380PitchNormalLaw_DWork);
+}
+
+boolean_T A380PitchNormalLaw::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380PitchNormalLaw_B) &&
+    reader.read(A380PitchNormalLaw_DWork);
+}
+
 A380PitchNormalLaw::A380PitchNormalLaw():
   A380PitchNormalLaw_B(),
   A380PitchNormalLaw_DWork()
@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_A380PitchNormalLaw_h_
 #define RTW_HEADER_A380PitchNormalLaw_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "A380PitchNormalLaw_types.h"
 #include <cstring>
 
@@ -128,6 +129,7 @@ class A380PitchNormalLaw final
     rtDW_RateLimiter_A380PitchNormalLaw_T sf_RateLimiter_p;
     rtDW_RateLimiter_A380PitchNormalLaw_T sf_RateLimiter;
     rtDW_LagFilter_A380PitchNormalLaw_T sf_LagFilter;
+    uint32_T lookupIndex[30];
   };
 
   struct Parameters_A380PitchNormalLaw_T {
@@ -496,12 +498,14 @@ class A380PitchNormalLaw final
             *rtu_In_ap_theta_c_deg, const boolean_T *rtu_In_any_ap_engaged, real_T *rty_Out_eta_deg, real_T
             *rty_Out_eta_trim_dot_deg_s, real_T *rty_Out_eta_trim_limit_lo, real_T *rty_Out_eta_trim_limit_up);
   void reset();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   A380PitchNormalLaw();
   ~A380PitchNormalLaw();
  private:
   BlockIO_A380PitchNormalLaw_T A380PitchNormalLaw_B;
   D_Work_A380PitchNormalLaw_T A380PitchNormalLaw_DWork;
-  static Parameters_A380PitchNormalLaw_T A380PitchNormalLaw_rtP;
+  static const Parameters_A380PitchNormalLaw_T A380PitchNormalLaw_rtP;
   static void A380PitchNormalLaw_LagFilter_Reset(rtDW_LagFilter_A380PitchNormalLaw_T *localDW);
   static void A380PitchNormalLaw_LagFilter(const real_T *rtu_U, real_T rtu_C1, const real_T *rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_A380PitchNormalLaw_T *localDW);
@@ -525,7 +529,7 @@ class A380PitchNormalLaw final
     real_T *rty_vote);
 };
 
-extern A380PitchNormalLaw::Parameters_A380PitchNormalLaw_T A380PitchNormalLaw_rtP;
+extern const A380PitchNormalLaw::Parameters_A380PitchNormalLaw_T A380PitchNormalLaw_rtP;
 
 #endif
 
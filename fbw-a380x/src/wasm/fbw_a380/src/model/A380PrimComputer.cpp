@@ -4,6 +4,7 @@
 #include <cmath>
 #include "look2_binlxpw.h"
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 #include "A380LateralNormalLaw.h"
 #include "A380LateralDirectLaw.h"
 #include "A380PitchNormalLaw.h"
@@ -1974,9 +1975,9 @@ void A380PrimComputer::step()
       A380PrimComputer_P.BitfromLabel5_bit_a, &rtb_y_c);
     A380PrimComputer_MATLABFunction_o(rtb_y_og, rtb_NOT_k, rtb_AND18_c, rtb_AND11_m, rtb_DataTypeConversion_op, (rtb_y_c
       != 0U), &rtb_handleIndex);
-    A380PrimComputer_RateLimiter_n(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
-      A380PrimComputer_P.alphamax_bp01Data, A380PrimComputer_P.alphamax_bp02Data, A380PrimComputer_P.alphamax_tableData,
-      A380PrimComputer_P.alphamax_maxIndex, 4U), A380PrimComputer_P.RateLimiterGenericVariableTs_up,
+    A380PrimComputer_RateLimiter_n(look2_pbinlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_handleIndex,
+      A380PrimComputer_P.alphamax_bp01Data, A380PrimComputer_P.alphamax_bp02Data, A380PrimComputer_P.alphamax_tableData, &A380PrimComputer_DWork.lookupIndex[0],
+      A380PrimComputer_P.alphamax_maxIndex), A380PrimComputer_P.RateLimiterGenericVariableTs_up,
       A380PrimComputer_P.RateLimiterGenericVariableTs_lo, A380PrimComputer_U.in.time.dt, A380PrimComputer_P.reset_Value,
       &rtb_Switch_h, &A380PrimComputer_DWork.sf_RateLimiter_ne);
     if (!A380PrimComputer_DWork.eventTime_not_empty_a) {
@@ -1988,9 +1989,9 @@ void A380PrimComputer::step()
       A380PrimComputer_DWork.eventTime_g = A380PrimComputer_U.in.time.simulation_time;
     }
 
-    A380PrimComputer_RateLimiter_n(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
+    A380PrimComputer_RateLimiter_n(look2_pbinlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_handleIndex,
       A380PrimComputer_P.alphaprotection_bp01Data, A380PrimComputer_P.alphaprotection_bp02Data,
-      A380PrimComputer_P.alphaprotection_tableData, A380PrimComputer_P.alphaprotection_maxIndex, 4U),
+      A380PrimComputer_P.alphaprotection_tableData, &A380PrimComputer_DWork.lookupIndex[2], A380PrimComputer_P.alphaprotection_maxIndex),
       A380PrimComputer_P.RateLimiterGenericVariableTs1_up, A380PrimComputer_P.RateLimiterGenericVariableTs1_lo,
       A380PrimComputer_U.in.time.dt, A380PrimComputer_P.reset_Value_j, &rtb_Switch4_d,
       &A380PrimComputer_DWork.sf_RateLimiter_mr);
@@ -2083,8 +2084,8 @@ void A380PrimComputer::step()
       A380PrimComputer_DWork.eventTime_not_empty = true;
     }
 
-    if ((rtb_V_ias <= std::fmin(365.0, (look1_binlxpw(rtb_alpha - std::cos(A380PrimComputer_P.Gain1_Gain * rtb_phi) *
-            rtb_Y, A380PrimComputer_P.uDLookupTable_bp01Data_m, A380PrimComputer_P.uDLookupTable_tableData_n, 3U) + 0.01)
+    if ((rtb_V_ias <= std::fmin(365.0, (look1_pbinlxpw<3U>(rtb_alpha - std::cos(A380PrimComputer_P.Gain1_Gain * rtb_phi) *
+            rtb_Y, A380PrimComputer_P.uDLookupTable_bp01Data_m, A380PrimComputer_P.uDLookupTable_tableData_n, &A380PrimComputer_DWork.lookupIndex[4]) + 0.01)
           * (static_cast<real_T>(rtb_V_ias) / rtb_mach))) || ((rtb_law_n != a380_pitch_efcs_law::NormalLaw) &&
          (rtb_activeLateralLaw != a380_lateral_efcs_law::NormalLaw)) || (A380PrimComputer_DWork.eventTime == 0.0)) {
       A380PrimComputer_DWork.eventTime = A380PrimComputer_U.in.time.simulation_time;
@@ -2476,8 +2477,8 @@ void A380PrimComputer::step()
     if (rtb_AND18_c) {
       rtb_Switch4_d = A380PrimComputer_P.Constant8_Value_d;
     } else {
-      rtb_Switch4_d = look1_binlxpw(A380PrimComputer_U.in.analog_inputs.speed_brake_lever_pos,
-        A380PrimComputer_P.uDLookupTable_bp01Data, A380PrimComputer_P.uDLookupTable_tableData, 4U);
+      rtb_Switch4_d = look1_pbinlxpw<4U>(A380PrimComputer_U.in.analog_inputs.speed_brake_lever_pos,
+        A380PrimComputer_P.uDLookupTable_bp01Data, A380PrimComputer_P.uDLookupTable_tableData, &A380PrimComputer_DWork.lookupIndex[5]);
     }
 
     A380PrimComputer_RateLimiter_m(rtb_Switch4_d, A380PrimComputer_P.RateLimiterGenericVariableTs24_up,
@@ -3797,6 +3798,30 @@ void A380PrimComputer::terminate()
 {
 }
 
+void A380PrimComputer::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380PrimComputer_U);
+  writer.write(A380PrimComputer_Y);
+  writer.write(A380PrimComputer_DWork);
+  LawMDLOBJ1.snapshot(writer);
+  LawMDLOBJ2.snapshot(writer);
+  LawMDLOBJ3.snapshot(writer);
+  LawMDLOBJ4.snapshot(writer);
+  LawMDLOBJ5.snapshot(writer);
+}
+
+boolean_T A380PrimComputer::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380PrimComputer_U) &&
+    reader.read(A380PrimComputer_Y) &&
+    reader.read(A380PrimComputer_DWork) &&
+    LawMDLOBJ1.restore(reader) &&
+    LawMDLOBJ2.restore(reader) &&
+    LawMDLOBJ3.restore(reader) &&
+    LawMDLOBJ4.restore(reader) &&
+    LawMDLOBJ5.restore(reader);
+}
+
 A380PrimComputer::A380PrimComputer():
   A380PrimComputer_U(),
   A380PrimComputer_Y(),
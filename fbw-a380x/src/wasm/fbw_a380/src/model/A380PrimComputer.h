@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_A380PrimComputer_h_
 #define RTW_HEADER_A380PrimComputer_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "A380PrimComputer_types.h"
 #include "A380LateralNormalLaw.h"
 #include "A380LateralDirectLaw.h"
@@ -139,6 +140,7 @@ class A380PrimComputer final
     rtDW_RateLimiter_A380PrimComputer_T sf_RateLimiter_c;
     rtDW_RateLimiter_A380PrimComputer_T sf_RateLimiter_b;
     rtDW_RateLimiter_A380PrimComputer_T sf_RateLimiter;
+    uint32_T lookupIndex[6];
   };
 
   struct ExternalInputs_A380PrimComputer_T {
@@ -562,13 +564,15 @@ class A380PrimComputer final
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   A380PrimComputer();
   ~A380PrimComputer();
  private:
   ExternalInputs_A380PrimComputer_T A380PrimComputer_U;
   ExternalOutputs_A380PrimComputer_T A380PrimComputer_Y;
   D_Work_A380PrimComputer_T A380PrimComputer_DWork;
-  static Parameters_A380PrimComputer_T A380PrimComputer_P;
+  static const Parameters_A380PrimComputer_T A380PrimComputer_P;
   static void A380PrimComputer_RateLimiter_Reset(rtDW_RateLimiter_A380PrimComputer_T *localDW);
   static void A380PrimComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init,
     real_T *rty_Y, rtDW_RateLimiter_A380PrimComputer_T *localDW);
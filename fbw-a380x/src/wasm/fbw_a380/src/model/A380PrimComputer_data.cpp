@@ -225,7 +225,7 @@ base_prim_discrete_outputs rtP_prim_discrete_output_MATLABStruct{
   false
 } ;
 
-A380PrimComputer::Parameters_A380PrimComputer_T A380PrimComputer::A380PrimComputer_P{
+const A380PrimComputer::Parameters_A380PrimComputer_T A380PrimComputer::A380PrimComputer_P{
 
   0.5,
 
@@ -3926,6 +3926,26 @@ void A380SecComputer::terminate()
 {
 }
 
+void A380SecComputer::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(A380SecComputer_U);
+  writer.write(A380SecComputer_Y);
+  writer.write(A380SecComputer_B);
+  writer.write(A380SecComputer_DWork);
+  LawMDLOBJ1.snapshot(writer);
+  LawMDLOBJ2.snapshot(writer);
+}
+
+boolean_T A380SecComputer::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(A380SecComputer_U) &&
+    reader.read(A380SecComputer_Y) &&
+    reader.read(A380SecComputer_B) &&
+    reader.read(A380SecComputer_DWork) &&
+    LawMDLOBJ1.restore(reader) &&
+    LawMDLOBJ2.restore(reader);
+}
+
 A380SecComputer::A380SecComputer():
   A380SecComputer_U(),
   A380SecComputer_Y(),
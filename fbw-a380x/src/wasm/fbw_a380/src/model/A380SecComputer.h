@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_A380SecComputer_h_
 #define RTW_HEADER_A380SecComputer_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "A380SecComputer_types.h"
 #include "A380LateralDirectLaw.h"
 #include "A380PitchDirectLaw.h"
@@ -907,6 +908,8 @@ class A380SecComputer final
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   A380SecComputer();
   ~A380SecComputer();
  private:
@@ -914,7 +917,7 @@ class A380SecComputer final
   ExternalOutputs_A380SecComputer_T A380SecComputer_Y;
   BlockIO_A380SecComputer_T A380SecComputer_B;
   D_Work_A380SecComputer_T A380SecComputer_DWork;
-  static Parameters_A380SecComputer_T A380SecComputer_P;
+  static const Parameters_A380SecComputer_T A380SecComputer_P;
   static void A380SecComputer_RateLimiter_Reset(rtDW_RateLimiter_A380SecComputer_T *localDW);
   static void A380SecComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init,
     real_T *rty_Y, rtDW_RateLimiter_A380SecComputer_T *localDW);
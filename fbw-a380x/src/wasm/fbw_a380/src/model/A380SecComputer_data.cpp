@@ -57,7 +57,7 @@ base_sec_discrete_outputs rtP_sec_discrete_output_MATLABStruct{
   false
 } ;
 
-A380SecComputer::Parameters_A380SecComputer_T A380SecComputer::A380SecComputer_P{
+const A380SecComputer::Parameters_A380SecComputer_T A380SecComputer::A380SecComputer_P{
 
   0.5,
 
@@ -1,6 +1,7 @@
 #include "AutopilotLaws.h"
 #include "AutopilotLaws_private.h"
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 #include "mod_mvZvttxs.h"
 #include "rt_modd.h"
 
@@ -946,8 +947,8 @@ void AutopilotLawsModelClass::step()
     AutopilotLaws_DWork.Delay_DSTATE_h = AutopilotLaws_P.DiscreteTimeIntegratorVariableTs_LowerLimit;
   }
 
-  rtb_dme = AutopilotLaws_DWork.DelayInput1_DSTATE * look1_binlxpw(AutopilotLaws_U.in.data.V_gnd_kn,
-    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_j, AutopilotLaws_P.ScheduledGain_Table_p, 2U);
+  rtb_dme = AutopilotLaws_DWork.DelayInput1_DSTATE * look1_pbinlxpw<2U>(AutopilotLaws_U.in.data.V_gnd_kn,
+    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_j, AutopilotLaws_P.ScheduledGain_Table_p, &AutopilotLaws_DWork.lookupIndex[0]);
   AutopilotLaws_DWork.DelayInput1_DSTATE = rtb_Saturation;
   AutopilotLaws_DWork.DelayInput1_DSTATE = rt_modd(AutopilotLaws_DWork.DelayInput1_DSTATE,
     AutopilotLaws_P.Constant3_Value_dk);
@@ -1026,8 +1027,8 @@ void AutopilotLawsModelClass::step()
 
   AutopilotLaws_Chart(rtb_dme, AutopilotLaws_P.Gain_Gain_cy * AutopilotLaws_DWork.DelayInput1_DSTATE, rtb_valid !=
                       rtb_valid_d, &Phi2, &AutopilotLaws_DWork.sf_Chart);
-  AutopilotLaws_DWork.DelayInput1_DSTATE = look1_binlxpw(AutopilotLaws_U.in.data.V_tas_kn,
-    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_h, AutopilotLaws_P.ScheduledGain_Table_o, 6U);
+  AutopilotLaws_DWork.DelayInput1_DSTATE = look1_pbinlxpw<6U>(AutopilotLaws_U.in.data.V_tas_kn,
+    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_h, AutopilotLaws_P.ScheduledGain_Table_o, &AutopilotLaws_DWork.lookupIndex[1]);
   rtb_dme = Phi2 * AutopilotLaws_DWork.DelayInput1_DSTATE;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain_Gain_o5 * result[2];
   b_L = AutopilotLaws_P.Gain1_Gain_o * rtb_dme + AutopilotLaws_DWork.DelayInput1_DSTATE;
@@ -1063,8 +1064,8 @@ void AutopilotLawsModelClass::step()
 
   AutopilotLaws_Chart(R, AutopilotLaws_P.Gain_Gain_p * AutopilotLaws_DWork.DelayInput1_DSTATE, rtb_valid_d !=
                       rtb_Delay_j, &Phi2, &AutopilotLaws_DWork.sf_Chart_ba);
-  AutopilotLaws_DWork.DelayInput1_DSTATE = look1_binlxpw(AutopilotLaws_U.in.data.V_tas_kn,
-    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_o, AutopilotLaws_P.ScheduledGain_Table_e, 6U);
+  AutopilotLaws_DWork.DelayInput1_DSTATE = look1_pbinlxpw<6U>(AutopilotLaws_U.in.data.V_tas_kn,
+    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_o, AutopilotLaws_P.ScheduledGain_Table_e, &AutopilotLaws_DWork.lookupIndex[2]);
   R = Phi2 * AutopilotLaws_DWork.DelayInput1_DSTATE;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.Gain_Gain_l * result[2];
   rtb_Sum_i = AutopilotLaws_P.Gain1_Gain_i4 * R + AutopilotLaws_DWork.DelayInput1_DSTATE;
@@ -1149,10 +1150,10 @@ void AutopilotLawsModelClass::step()
       rtb_dme = AutopilotLaws_P.Constant1_Value_fk;
     }
 
-    rtb_Add3_j4 = (rtb_Y_i * look1_binlxpw(AutopilotLaws_U.in.data.V_tas_kn,
-      AutopilotLaws_P.ScheduledGain2_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain2_Table, 6U) *
-                   AutopilotLaws_P.Gain4_Gain * look1_binlxpw(AutopilotLaws_U.in.data.H_radio_ft,
-      AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain_Table, 5U) + std::sin
+    rtb_Add3_j4 = (rtb_Y_i * look1_pbinlxpw<6U>(AutopilotLaws_U.in.data.V_tas_kn,
+      AutopilotLaws_P.ScheduledGain2_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain2_Table, &AutopilotLaws_DWork.lookupIndex[3]) *
+                   AutopilotLaws_P.Gain4_Gain * look1_pbinlxpw<5U>(AutopilotLaws_U.in.data.H_radio_ft,
+      AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain_Table, &AutopilotLaws_DWork.lookupIndex[4]) + std::sin
                    (AutopilotLaws_P.Gain1_Gain_b * Phi2) * AutopilotLaws_U.in.data.V_gnd_kn *
                    AutopilotLaws_P.Gain2_Gain_g) + rtb_dme;
     if (rtb_Add3_j4 > AutopilotLaws_P.Saturation1_UpperSat) {
@@ -2058,8 +2059,8 @@ void AutopilotLawsModelClass::step()
   rtb_Add3_j4 = AutopilotLaws_P.Gain4_Gain_n * rtb_Gain1_pj;
   AutopilotLaws_LagFilter(AutopilotLaws_U.in.data.nav_gs_error_deg, AutopilotLaws_P.LagFilter1_C1_l,
     AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj, &AutopilotLaws_DWork.sf_LagFilter_gx);
-  R = rtb_Gain1_pj * look1_binlxpw(AutopilotLaws_U.in.data.H_radio_ft,
-    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_a, AutopilotLaws_P.ScheduledGain_Table_j, 7U) *
+  R = rtb_Gain1_pj * look1_pbinlxpw<7U>(AutopilotLaws_U.in.data.H_radio_ft,
+    AutopilotLaws_P.ScheduledGain_BreakpointsForDimension1_a, AutopilotLaws_P.ScheduledGain_Table_j, &AutopilotLaws_DWork.lookupIndex[5]) *
     AutopilotLaws_P.Gain_Gain_gm;
   rtb_Compare_l = ((AutopilotLaws_U.in.input.vertical_mode == AutopilotLaws_P.CompareGSTRACK_const) ||
                    (AutopilotLaws_U.in.input.vertical_mode == AutopilotLaws_P.CompareGSTRACK2_const));
@@ -2077,8 +2078,8 @@ void AutopilotLawsModelClass::step()
   AutopilotLaws_LagFilter(AutopilotLaws_U.in.data.nav_gs_error_deg, AutopilotLaws_P.LagFilter2_C1_e,
     AutopilotLaws_U.in.time.dt, &rtb_Y_i, &AutopilotLaws_DWork.sf_LagFilter_cf);
   rtb_Add3_i = AutopilotLaws_P.DiscreteDerivativeVariableTs_Gain_g * rtb_Y_i;
-  AutopilotLaws_DWork.DelayInput1_DSTATE = look1_binlxpw(AutopilotLaws_U.in.data.H_radio_ft,
-    AutopilotLaws_P.ScheduledGain3_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain3_Table, 4U);
+  AutopilotLaws_DWork.DelayInput1_DSTATE = look1_pbinlxpw<4U>(AutopilotLaws_U.in.data.H_radio_ft,
+    AutopilotLaws_P.ScheduledGain3_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain3_Table, &AutopilotLaws_DWork.lookupIndex[6]);
   AutopilotLaws_LagFilter(rtb_Y_i + (rtb_Add3_i - AutopilotLaws_DWork.Delay_DSTATE_b) / AutopilotLaws_U.in.time.dt *
     AutopilotLaws_DWork.DelayInput1_DSTATE, AutopilotLaws_P.LagFilter_C1_d, AutopilotLaws_U.in.time.dt, &rtb_Gain1_pj,
     &AutopilotLaws_DWork.sf_LagFilter_p);
@@ -2089,8 +2090,8 @@ void AutopilotLawsModelClass::step()
   }
 
   AutopilotLaws_SignalEnablerGSTrack(AutopilotLaws_P.Gain3_Gain_c * ((AutopilotLaws_P.Gain2_Gain_k * rtb_Add3_j4 + R) *
-    Phi2 + (AutopilotLaws_P.Constant_Value_lu - Phi2) * (rtb_Gain1_pj * look1_binlxpw(AutopilotLaws_U.in.data.H_radio_ft,
-    AutopilotLaws_P.ScheduledGain2_BreakpointsForDimension1_h, AutopilotLaws_P.ScheduledGain2_Table_p, 7U))),
+    Phi2 + (AutopilotLaws_P.Constant_Value_lu - Phi2) * (rtb_Gain1_pj * look1_pbinlxpw<7U>(AutopilotLaws_U.in.data.H_radio_ft,
+    AutopilotLaws_P.ScheduledGain2_BreakpointsForDimension1_h, AutopilotLaws_P.ScheduledGain2_Table_p, &AutopilotLaws_DWork.lookupIndex[7]))),
     (AutopilotLaws_U.in.data.H_radio_ft > AutopilotLaws_P.CompareToConstant_const_kt) &&
     AutopilotLaws_U.in.data.nav_gs_valid, &rtb_Sum_kq);
   AutopilotLaws_storevalue(rtb_error_d == AutopilotLaws_P.CompareToConstant6_const_e,
@@ -2118,8 +2119,8 @@ void AutopilotLawsModelClass::step()
   AutopilotLaws_Voter1(rtb_Sum_kq + rtb_Gain1_pj, AutopilotLaws_P.Gain1_Gain_d4 * ((Phi2 + AutopilotLaws_P.Bias_Bias) -
     AutopilotLaws_DWork.DelayInput1_DSTATE), AutopilotLaws_P.Gain_Gain_eyl * ((Phi2 + AutopilotLaws_P.Bias1_Bias) -
     AutopilotLaws_DWork.DelayInput1_DSTATE), &R);
-  rtb_Product_dh = R * look1_binlxpw(AutopilotLaws_U.in.data.V_tas_kn,
-    AutopilotLaws_P.ScheduledGain1_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain1_Table, 6U);
+  rtb_Product_dh = R * look1_pbinlxpw<6U>(AutopilotLaws_U.in.data.V_tas_kn,
+    AutopilotLaws_P.ScheduledGain1_BreakpointsForDimension1, AutopilotLaws_P.ScheduledGain1_Table, &AutopilotLaws_DWork.lookupIndex[8]);
   rtb_Gain4 = (rtb_GainTheta - AutopilotLaws_P.Constant2_Value_f) * AutopilotLaws_P.Gain4_Gain_oy;
   rtb_Y_i = AutopilotLaws_P.Gain5_Gain_c * AutopilotLaws_U.in.data.bz_m_s2;
   AutopilotLaws_WashoutFilter(AutopilotLaws_U.in.data.bx_m_s2, AutopilotLaws_P.WashoutFilter_C1_m,
@@ -2185,8 +2186,8 @@ void AutopilotLawsModelClass::step()
 
   rtb_Sum1_g = AutopilotLaws_P.Gain_Gain_gr * std::asin(R) * AutopilotLaws_P.Gain1_Gain_ml +
     AutopilotLaws_P.Gain_Gain_by * std::asin(rtb_Add3_j4) * AutopilotLaws_P.Gain2_Gain_m;
-  rtb_uDLookupTable_m = look1_binlxpw(AutopilotLaws_U.in.data.total_weight_kg, AutopilotLaws_P.uDLookupTable_bp01Data,
-    AutopilotLaws_P.uDLookupTable_tableData, 3U);
+  rtb_uDLookupTable_m = look1_pbinlxpw<3U>(AutopilotLaws_U.in.data.total_weight_kg, AutopilotLaws_P.uDLookupTable_bp01Data,
+    AutopilotLaws_P.uDLookupTable_tableData, &AutopilotLaws_DWork.lookupIndex[9]);
   rtb_Sum_es = AutopilotLaws_P.Constant1_Value_o0 - rtb_GainTheta;
   rtb_Sum3_m3 = AutopilotLaws_P.Constant2_Value_kz - AutopilotLaws_U.in.data.H_ind_ft;
   AutopilotLaws_DWork.DelayInput1_DSTATE = AutopilotLaws_P.fpmtoms_Gain_po * AutopilotLaws_U.in.data.H_dot_ft_min;
@@ -2581,6 +2582,22 @@ void AutopilotLawsModelClass::terminate()
 {
 }
 
+void AutopilotLawsModelClass::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(AutopilotLaws_U);
+  writer.write(AutopilotLaws_Y);
+  writer.write(AutopilotLaws_B);
+  writer.write(AutopilotLaws_DWork);
+}
+
+boolean_T AutopilotLawsModelClass::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(AutopilotLaws_U) &&
+    reader.read(AutopilotLaws_Y) &&
+    reader.read(AutopilotLaws_B) &&
+    reader.read(AutopilotLaws_DWork);
+}
+
 AutopilotLawsModelClass::AutopilotLawsModelClass():
   AutopilotLaws_U(),
   AutopilotLaws_Y(),
@@ -2,6 +2,7 @@
 #define RTW_HEADER_AutopilotLaws_h_
 #include <cmath>
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "AutopilotLaws_types.h"
 
 class AutopilotLawsModelClass
@@ -170,6 +171,7 @@ class AutopilotLawsModelClass
     rtDW_MATLABFunction_AutopilotLaws_d_T sf_MATLABFunction_m;
     rtDW_RateLimiter_AutopilotLaws_T sf_RateLimiter;
     rtDW_LagFilter_AutopilotLaws_T sf_LagFilter;
+    uint32_T lookupIndex[10];
   };
 
   struct ExternalInputs_AutopilotLaws_T {
@@ -946,6 +948,8 @@ class AutopilotLawsModelClass
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   AutopilotLawsModelClass();
   ~AutopilotLawsModelClass();
  private:
@@ -953,7 +957,7 @@ class AutopilotLawsModelClass
   ExternalOutputs_AutopilotLaws_T AutopilotLaws_Y;
   BlockIO_AutopilotLaws_T AutopilotLaws_B;
   D_Work_AutopilotLaws_T AutopilotLaws_DWork;
-  static Parameters_AutopilotLaws_T AutopilotLaws_P;
+  static const Parameters_AutopilotLaws_T AutopilotLaws_P;
   static void AutopilotLaws_MATLABFunction(real_T rtu_tau, real_T rtu_zeta, real_T *rty_k2, real_T *rty_k1);
   static void AutopilotLaws_LagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_AutopilotLaws_T *localDW);
@@ -1,10 +1,17 @@
 #include "AutopilotStateMachine.h"
 #include "AutopilotStateMachine_private.h"
-#include "Double2MultiWord.h"
-#include "MultiWordIor.h"
 #include "mod_mvZvttxs.h"
 #include "rt_remd.h"
-#include "uMultiWord2Double.h"
+#include "ArmedModes.h"
+
+// The station dependent terms of the LOC and G/S deviations are kept in the DWork until the tuned station changes, and
+// the deviations are not computed while no station is tuned. FBW_AP_SM_FULL_EVALUATION evaluates them every frame.
+// Added by tools/modelpostprocess/cache_station_terms.py after the code generation.
+#ifdef FBW_AP_SM_FULL_EVALUATION
+#define AP_SM_CACHE_NAV_STATION_TERMS false
+#else
+#define AP_SM_CACHE_NAV_STATION_TERMS true
+#endif
 
 const uint8_T AutopilotStateMachine_IN_FLARE{ 1U };
 
@@ -76,16 +83,6 @@ const uint8_T AutopilotStateMachine_IN_TCAS{ 4U };
 
 const uint8_T AutopilotStateMachine_IN_VS{ 12U };
 
-void AutopilotStateMachineModelClass::AutopilotStateMachine_BitShift(real_T rtu_u, real_T *rty_y)
-{
-  *rty_y = std::ldexp(rtu_u, 0);
-}
-
-void AutopilotStateMachineModelClass::AutopilotStateMachine_BitShift1(real_T rtu_u, real_T *rty_y)
-{
-  *rty_y = std::ldexp(rtu_u, 1);
-}
-
 boolean_T AutopilotStateMachineModelClass::AutopilotStateMachine_X_TO_OFF(const ap_sm_output *BusAssignment)
 {
   return ((!BusAssignment->input.FD_active) && (BusAssignment->output.enabled_AP1 == 0.0) &&
@@ -2555,16 +2552,6 @@ void AutopilotStateMachineModelClass::step()
 
   static const int16_T b[7]{ 0, 1000, 3333, 4000, 6000, 8000, 10000 };
 
-  uint64m_T tmp;
-  uint64m_T tmp_0;
-  uint64m_T tmp_1;
-  uint64m_T tmp_2;
-  uint64m_T tmp_3;
-  uint64m_T tmp_4;
-  uint64m_T tmp_5;
-  uint64m_T tmp_6;
-  uint64m_T tmp_7;
-  uint64m_T tmp_8;
   real_T result_tmp_0[9];
   real_T result[3];
   real_T result_0[3];
@@ -2699,54 +2686,72 @@ void AutopilotStateMachineModelClass::step()
   }
 
   rtb_dme = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat;
-  Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
   rtb_Saturation1 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lon;
-  a = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
-                AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
-  result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
-    AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
-  L = std::cos(Phi2);
   a_tmp = std::cos(rtb_dme);
-  a = a_tmp * L * result_tmp * result_tmp + a * a;
-  a = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
-  result_tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
-    AutopilotStateMachine_U.in.data.nav_loc_position.alt;
-  R = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lon - rtb_Saturation1;
-  b_L = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(360.0) + 360.0) - (mod_mvZvttxs(mod_mvZvttxs
-    (AutopilotStateMachine_U.in.data.nav_loc_magvar_deg) + 360.0) + 360.0)) + 360.0);
-  b_R = mod_mvZvttxs(360.0 - b_L);
-  if (std::abs(b_L) < std::abs(b_R)) {
-    b_R = -b_L;
-  }
-
   rtb_dme = std::sin(rtb_dme);
-  L = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin(R) * L, a_tmp * std::sin(Phi2) - rtb_dme * L * std::cos
-    (R)) * 57.295779513082323 + 360.0)) + 360.0) + 360.0;
-  Phi2 = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg -
-    b_R) + 360.0)) + 360.0) - L) + 360.0);
-  b_R = mod_mvZvttxs(360.0 - Phi2);
   guard1 = false;
-  if (std::abs(std::sqrt(a * a + result_tmp * result_tmp) / 1852.0) < 30.0) {
-    L = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg) + 360.0) - L) + 360.0);
-    R = mod_mvZvttxs(360.0 - L);
-    if (std::abs(L) < std::abs(R)) {
-      R = -L;
+  if (AP_SM_CACHE_NAV_STATION_TERMS && (AutopilotStateMachine_U.in.data.nav_loc_position.lat == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_loc_position.lon == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_loc_position.alt == 0.0)) {
+    guard1 = true;
+  } else {
+    if ((!AP_SM_CACHE_NAV_STATION_TERMS) || (!AutopilotStateMachine_DWork.nav_loc_terms_not_empty) ||
+        (AutopilotStateMachine_DWork.nav_loc_lat_deg != AutopilotStateMachine_U.in.data.nav_loc_position.lat) ||
+        (AutopilotStateMachine_DWork.nav_loc_magvar_deg != AutopilotStateMachine_U.in.data.nav_loc_magvar_deg)) {
+      Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
+      AutopilotStateMachine_DWork.nav_loc_lat_deg = AutopilotStateMachine_U.in.data.nav_loc_position.lat;
+      AutopilotStateMachine_DWork.nav_loc_magvar_deg = AutopilotStateMachine_U.in.data.nav_loc_magvar_deg;
+      AutopilotStateMachine_DWork.nav_loc_cos_lat = std::cos(Phi2);
+      AutopilotStateMachine_DWork.nav_loc_sin_lat = std::sin(Phi2);
+      b_L = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(360.0) + 360.0) - (mod_mvZvttxs(mod_mvZvttxs
+        (AutopilotStateMachine_U.in.data.nav_loc_magvar_deg) + 360.0) + 360.0)) + 360.0);
+      b_R = mod_mvZvttxs(360.0 - b_L);
+      if (std::abs(b_L) < std::abs(b_R)) {
+        b_R = -b_L;
+      }
+
+      AutopilotStateMachine_DWork.nav_loc_magvar_correction_deg = b_R;
+      AutopilotStateMachine_DWork.nav_loc_terms_not_empty = true;
     }
 
-    if ((std::abs(R) < 90.0) && ((AutopilotStateMachine_U.in.data.nav_loc_position.lat != 0.0) ||
-         (AutopilotStateMachine_U.in.data.nav_loc_position.lon != 0.0) ||
-         (AutopilotStateMachine_U.in.data.nav_loc_position.alt != 0.0))) {
-      AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_valid = true;
-      if (std::abs(Phi2) < std::abs(b_R)) {
-        AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_error_deg = -Phi2;
+    L = AutopilotStateMachine_DWork.nav_loc_cos_lat;
+    a = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
+                  AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
+    result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
+      AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
+    a = a_tmp * L * result_tmp * result_tmp + a * a;
+    a = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
+    result_tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
+      AutopilotStateMachine_U.in.data.nav_loc_position.alt;
+    R = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lon - rtb_Saturation1;
+    L = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin(R) * L, a_tmp *
+      AutopilotStateMachine_DWork.nav_loc_sin_lat - rtb_dme * L * std::cos(R)) * 57.295779513082323 + 360.0)) + 360.0) +
+      360.0;
+    Phi2 = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg -
+      AutopilotStateMachine_DWork.nav_loc_magvar_correction_deg) + 360.0)) + 360.0) - L) + 360.0);
+    b_R = mod_mvZvttxs(360.0 - Phi2);
+    if (std::abs(std::sqrt(a * a + result_tmp * result_tmp) / 1852.0) < 30.0) {
+      L = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg) + 360.0) - L) + 360.0);
+      R = mod_mvZvttxs(360.0 - L);
+      if (std::abs(L) < std::abs(R)) {
+        R = -L;
+      }
+
+      if ((std::abs(R) < 90.0) && ((AutopilotStateMachine_U.in.data.nav_loc_position.lat != 0.0) ||
+           (AutopilotStateMachine_U.in.data.nav_loc_position.lon != 0.0) ||
+           (AutopilotStateMachine_U.in.data.nav_loc_position.alt != 0.0))) {
+        AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_valid = true;
+        if (std::abs(Phi2) < std::abs(b_R)) {
+          AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_error_deg = -Phi2;
+        } else {
+          AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_error_deg = b_R;
+        }
       } else {
-        AutopilotStateMachine_B.BusAssignment_g.data.nav_e_loc_error_deg = b_R;
+        guard1 = true;
       }
     } else {
       guard1 = true;
     }
-  } else {
-    guard1 = true;
   }
 
   if (guard1) {
@@ -2759,105 +2764,119 @@ void AutopilotStateMachineModelClass::step()
     AutopilotStateMachine_DWork.nav_gs_deg_not_empty = true;
   }
 
-  Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lat;
-  a = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lat -
-                AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
-  result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lon -
-    AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
-  b_R = std::cos(Phi2);
-  a = a_tmp * b_R * result_tmp * result_tmp + a * a;
-  a = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
-  result_tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
-    AutopilotStateMachine_U.in.data.nav_gs_position.alt;
-  a = std::sqrt(a * a + result_tmp * result_tmp);
-  rtb_Saturation1 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lon - rtb_Saturation1;
-  rtb_Saturation1 = std::atan2(std::sin(rtb_Saturation1) * b_R, a_tmp * std::sin(Phi2) - rtb_dme * b_R * std::cos
-    (rtb_Saturation1)) * 57.295779513082323;
-  if (rtb_Saturation1 + 360.0 == 0.0) {
-    rtb_dme = 0.0;
+  guard1 = false;
+  if (AP_SM_CACHE_NAV_STATION_TERMS && (AutopilotStateMachine_U.in.data.nav_gs_position.lat == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_gs_position.lon == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_gs_position.alt == 0.0)) {
+    guard1 = true;
   } else {
-    rtb_dme = std::fmod(rtb_Saturation1 + 360.0, 360.0);
-    if (rtb_dme == 0.0) {
-      rtb_dme = 0.0;
-    } else if (rtb_Saturation1 + 360.0 < 0.0) {
-      rtb_dme += 360.0;
+    if ((!AP_SM_CACHE_NAV_STATION_TERMS) || (!AutopilotStateMachine_DWork.nav_gs_terms_not_empty) ||
+        (AutopilotStateMachine_DWork.nav_gs_lat_deg != AutopilotStateMachine_U.in.data.nav_gs_position.lat)) {
+      Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lat;
+      AutopilotStateMachine_DWork.nav_gs_lat_deg = AutopilotStateMachine_U.in.data.nav_gs_position.lat;
+      AutopilotStateMachine_DWork.nav_gs_cos_lat = std::cos(Phi2);
+      AutopilotStateMachine_DWork.nav_gs_sin_lat = std::sin(Phi2);
+      AutopilotStateMachine_DWork.nav_gs_terms_not_empty = true;
     }
-  }
 
-  guard1 = false;
-  if (std::abs(a / 1852.0) < 30.0) {
-    if (AutopilotStateMachine_U.in.data.nav_loc_deg == 0.0) {
-      Phi2 = 0.0;
+    b_R = AutopilotStateMachine_DWork.nav_gs_cos_lat;
+    a = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lat -
+                  AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
+    result_tmp = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lon -
+      AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
+    a = a_tmp * b_R * result_tmp * result_tmp + a * a;
+    a = std::atan2(std::sqrt(a), std::sqrt(1.0 - a)) * 2.0 * 6.371E+6;
+    result_tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
+      AutopilotStateMachine_U.in.data.nav_gs_position.alt;
+    a = std::sqrt(a * a + result_tmp * result_tmp);
+    rtb_Saturation1 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lon - rtb_Saturation1;
+    rtb_Saturation1 = std::atan2(std::sin(rtb_Saturation1) * b_R, a_tmp * AutopilotStateMachine_DWork.nav_gs_sin_lat -
+      rtb_dme * b_R * std::cos(rtb_Saturation1)) * 57.295779513082323;
+    if (rtb_Saturation1 + 360.0 == 0.0) {
+      rtb_dme = 0.0;
     } else {
-      Phi2 = std::fmod(AutopilotStateMachine_U.in.data.nav_loc_deg, 360.0);
-      if (Phi2 == 0.0) {
-        Phi2 = 0.0;
-      } else if (AutopilotStateMachine_U.in.data.nav_loc_deg < 0.0) {
-        Phi2 += 360.0;
+      rtb_dme = std::fmod(rtb_Saturation1 + 360.0, 360.0);
+      if (rtb_dme == 0.0) {
+        rtb_dme = 0.0;
+      } else if (rtb_Saturation1 + 360.0 < 0.0) {
+        rtb_dme += 360.0;
       }
     }
 
-    if (rtb_dme == 0.0) {
-      rtb_Saturation1 = 0.0;
-    } else {
-      rtb_Saturation1 = std::fmod(rtb_dme, 360.0);
-      if (rtb_Saturation1 == 0.0) {
+    if (std::abs(a / 1852.0) < 30.0) {
+      if (AutopilotStateMachine_U.in.data.nav_loc_deg == 0.0) {
+        Phi2 = 0.0;
+      } else {
+        Phi2 = std::fmod(AutopilotStateMachine_U.in.data.nav_loc_deg, 360.0);
+        if (Phi2 == 0.0) {
+          Phi2 = 0.0;
+        } else if (AutopilotStateMachine_U.in.data.nav_loc_deg < 0.0) {
+          Phi2 += 360.0;
+        }
+      }
+
+      if (rtb_dme == 0.0) {
         rtb_Saturation1 = 0.0;
-      } else if (rtb_dme < 0.0) {
-        rtb_Saturation1 += 360.0;
+      } else {
+        rtb_Saturation1 = std::fmod(rtb_dme, 360.0);
+        if (rtb_Saturation1 == 0.0) {
+          rtb_Saturation1 = 0.0;
+        } else if (rtb_dme < 0.0) {
+          rtb_Saturation1 += 360.0;
+        }
       }
-    }
 
-    if (Phi2 + 360.0 == 0.0) {
-      Phi2 = 0.0;
-    } else {
-      Phi2 = std::fmod(Phi2 + 360.0, 360.0);
-    }
+      if (Phi2 + 360.0 == 0.0) {
+        Phi2 = 0.0;
+      } else {
+        Phi2 = std::fmod(Phi2 + 360.0, 360.0);
+      }
 
-    if (rtb_Saturation1 + 360.0 == 0.0) {
-      rtb_Saturation1 = 0.0;
-    } else {
-      rtb_Saturation1 = std::fmod(rtb_Saturation1 + 360.0, 360.0);
-    }
+      if (rtb_Saturation1 + 360.0 == 0.0) {
+        rtb_Saturation1 = 0.0;
+      } else {
+        rtb_Saturation1 = std::fmod(rtb_Saturation1 + 360.0, 360.0);
+      }
 
-    b_R = (Phi2 - (rtb_Saturation1 + 360.0)) + 360.0;
-    if (b_R == 0.0) {
-      L = 0.0;
-    } else {
-      L = std::fmod(b_R, 360.0);
-      if (L == 0.0) {
+      b_R = (Phi2 - (rtb_Saturation1 + 360.0)) + 360.0;
+      if (b_R == 0.0) {
         L = 0.0;
-      } else if (b_R < 0.0) {
-        L += 360.0;
+      } else {
+        L = std::fmod(b_R, 360.0);
+        if (L == 0.0) {
+          L = 0.0;
+        } else if (b_R < 0.0) {
+          L += 360.0;
+        }
       }
-    }
 
-    if (360.0 - L == 0.0) {
-      R = 0.0;
-    } else {
-      R = std::fmod(360.0 - L, 360.0);
-      if (R == 0.0) {
+      if (360.0 - L == 0.0) {
         R = 0.0;
-      } else if (360.0 - L < 0.0) {
-        R += 360.0;
+      } else {
+        R = std::fmod(360.0 - L, 360.0);
+        if (R == 0.0) {
+          R = 0.0;
+        } else if (360.0 - L < 0.0) {
+          R += 360.0;
+        }
       }
-    }
 
-    if (std::abs(L) < std::abs(R)) {
-      R = -L;
-    }
+      if (std::abs(L) < std::abs(R)) {
+        R = -L;
+      }
 
-    if ((std::abs(R) < 90.0) && ((AutopilotStateMachine_U.in.data.nav_gs_position.lat != 0.0) ||
-         (AutopilotStateMachine_U.in.data.nav_gs_position.lon != 0.0) ||
-         (AutopilotStateMachine_U.in.data.nav_gs_position.alt != 0.0))) {
-      AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_valid = true;
-      AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_error_deg = std::asin(result_tmp / a) * 57.295779513082323 -
-        AutopilotStateMachine_DWork.nav_gs_deg;
+      if ((std::abs(R) < 90.0) && ((AutopilotStateMachine_U.in.data.nav_gs_position.lat != 0.0) ||
+           (AutopilotStateMachine_U.in.data.nav_gs_position.lon != 0.0) ||
+           (AutopilotStateMachine_U.in.data.nav_gs_position.alt != 0.0))) {
+        AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_valid = true;
+        AutopilotStateMachine_B.BusAssignment_g.data.nav_e_gs_error_deg = std::asin(result_tmp / a) * 57.295779513082323 -
+          AutopilotStateMachine_DWork.nav_gs_deg;
+      } else {
+        guard1 = true;
+      }
     } else {
       guard1 = true;
     }
-  } else {
-    guard1 = true;
   }
 
   if (guard1) {
@@ -4342,51 +4361,17 @@ void AutopilotStateMachineModelClass::step()
 
   AutopilotStateMachine_DWork.Delay1_DSTATE = AutopilotStateMachine_B.BusAssignment_g.vertical;
   AutopilotStateMachine_DWork.Delay1_DSTATE.output = AutopilotStateMachine_B.out;
-  AutopilotStateMachine_BitShift(static_cast<real_T>(AutopilotStateMachine_B.BusAssignment_g.lateral.armed.NAV),
-    &rtb_GainTheta);
-  AutopilotStateMachine_BitShift1(static_cast<real_T>(AutopilotStateMachine_B.BusAssignment_g.lateral.armed.LOC),
-    &rtb_GainTheta1);
   if (AutopilotStateMachine_B.BusAssignment_g.input.FD_active ||
       (AutopilotStateMachine_B.BusAssignment_g.output.enabled_AP1 != 0.0) ||
       (AutopilotStateMachine_B.BusAssignment_g.output.enabled_AP2 != 0.0)) {
-    Double2MultiWord(std::floor(rtb_GainTheta), &tmp_0.chunks[0U], 2);
-    Double2MultiWord(std::floor(rtb_GainTheta1), &tmp_1.chunks[0U], 2);
-    MultiWordIor(&tmp_0.chunks[0U], &tmp_1.chunks[0U], &tmp.chunks[0U], 2);
-    AutopilotStateMachine_Y.out.output.lateral_mode_armed = uMultiWord2Double(&tmp.chunks[0U], 2, 0);
+    AutopilotStateMachine_Y.out.output.lateral_mode_armed = static_cast<real_T>(armed_modes::lateralMask
+      (AutopilotStateMachine_B.BusAssignment_g.lateral.armed));
+    AutopilotStateMachine_Y.out.output.vertical_mode_armed = static_cast<real_T>(armed_modes::verticalMask
+      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed));
   } else {
     AutopilotStateMachine_Y.out.output.lateral_mode_armed = AutopilotStateMachine_P.Constant_Value;
-  }
-
-  AutopilotStateMachine_BitShift(static_cast<real_T>(AutopilotStateMachine_B.BusAssignment_g.vertical.armed.ALT),
-    &rtb_GainTheta);
-  AutopilotStateMachine_BitShift1(static_cast<real_T>(AutopilotStateMachine_B.BusAssignment_g.vertical.armed.ALT_CST),
-    &rtb_GainTheta1);
-  if (AutopilotStateMachine_B.BusAssignment_g.input.FD_active ||
-      (AutopilotStateMachine_B.BusAssignment_g.output.enabled_AP1 != 0.0) ||
-      (AutopilotStateMachine_B.BusAssignment_g.output.enabled_AP2 != 0.0)) {
-    Double2MultiWord(std::floor(rtb_GainTheta), &tmp_7.chunks[0U], 2);
-    Double2MultiWord(std::floor(rtb_GainTheta1), &tmp_8.chunks[0U], 2);
-    MultiWordIor(&tmp_7.chunks[0U], &tmp_8.chunks[0U], &tmp_6.chunks[0U], 2);
-    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>
-      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.CLB), 2))), &tmp_7.chunks[0U], 2);
-    MultiWordIor(&tmp_6.chunks[0U], &tmp_7.chunks[0U], &tmp_5.chunks[0U], 2);
-    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>
-      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.DES), 3))), &tmp_6.chunks[0U], 2);
-    MultiWordIor(&tmp_5.chunks[0U], &tmp_6.chunks[0U], &tmp_4.chunks[0U], 2);
-    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>
-      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.GS), 4))), &tmp_5.chunks[0U], 2);
-    MultiWordIor(&tmp_4.chunks[0U], &tmp_5.chunks[0U], &tmp_3.chunks[0U], 2);
-    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>
-      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.FINAL_DES), 5))), &tmp_4.chunks[0U], 2);
-    MultiWordIor(&tmp_3.chunks[0U], &tmp_4.chunks[0U], &tmp_2.chunks[0U], 2);
-    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>
-      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.TCAS), 6))), &tmp_3.chunks[0U], 2);
-    MultiWordIor(&tmp_2.chunks[0U], &tmp_3.chunks[0U], &tmp_1.chunks[0U], 2);
-    AutopilotStateMachine_Y.out.output.vertical_mode_armed = uMultiWord2Double(&tmp_1.chunks[0U], 2, 0);
-  } else {
-    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>
-      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.TCAS), 6))), &tmp_0.chunks[0U], 2);
-    AutopilotStateMachine_Y.out.output.vertical_mode_armed = uMultiWord2Double(&tmp_0.chunks[0U], 2, 0);
+    AutopilotStateMachine_Y.out.output.vertical_mode_armed = static_cast<real_T>(armed_modes::bitIf
+      (AutopilotStateMachine_B.BusAssignment_g.vertical.armed.TCAS, armed_modes::VERTICAL_TCAS));
   }
 
   AutopilotStateMachine_DWork.Delay_DSTATE_e += std::fmax(std::fmin(static_cast<real_T>
@@ -4689,6 +4674,22 @@ void AutopilotStateMachineModelClass::terminate()
 {
 }
 
+void AutopilotStateMachineModelClass::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(AutopilotStateMachine_U);
+  writer.write(AutopilotStateMachine_Y);
+  writer.write(AutopilotStateMachine_B);
+  writer.write(AutopilotStateMachine_DWork);
+}
+
+boolean_T AutopilotStateMachineModelClass::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(AutopilotStateMachine_U) &&
+    reader.read(AutopilotStateMachine_Y) &&
+    reader.read(AutopilotStateMachine_B) &&
+    reader.read(AutopilotStateMachine_DWork);
+}
+
 AutopilotStateMachineModelClass::AutopilotStateMachineModelClass():
   AutopilotStateMachine_U(),
   AutopilotStateMachine_Y(),
@@ -1,7 +1,7 @@
 #include "AutopilotStateMachine.h"
 #include "AutopilotStateMachine_private.h"
 
-AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T AutopilotStateMachineModelClass::
+const AutopilotStateMachineModelClass::Parameters_AutopilotStateMachine_T AutopilotStateMachineModelClass::
   AutopilotStateMachine_P{
 
   {
@@ -3,6 +3,7 @@
 #include "Autothrust_types.h"
 #include <cmath>
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 
 const uint8_T Autothrust_IN_InAir{ 1U };
 
@@ -701,8 +702,8 @@ void Autothrust::step()
   Autothrust_LeadLagFilter(Autothrust_P.ktstomps_Gain_h * rtb_Switch_f_idx_0, Autothrust_P.LowPassFilter_C1,
     Autothrust_P.LowPassFilter_C2, Autothrust_P.LowPassFilter_C3, Autothrust_P.LowPassFilter_C4, Autothrust_U.in.time.dt,
     &rtb_y_p, &Autothrust_DWork.sf_LeadLagFilter_h);
-  rtb_Switch_fs = (rtb_y_hw + rtb_y_p) * Autothrust_P.mpstokts_Gain * Autothrust_P.Gain4_Gain * look1_binlxpw
-    (rtb_Switch_d, Autothrust_P.ScheduledGain1_BreakpointsForDimension1, Autothrust_P.ScheduledGain1_Table, 4U) +
+  rtb_Switch_fs = (rtb_y_hw + rtb_y_p) * Autothrust_P.mpstokts_Gain * Autothrust_P.Gain4_Gain * look1_binlxpw<4U>
+    (rtb_Switch_d, Autothrust_P.ScheduledGain1_BreakpointsForDimension1, Autothrust_P.ScheduledGain1_Table) +
     rtb_Switch_d;
   rtb_Gain_m = Autothrust_P.DiscreteDerivativeVariableTs_Gain * rtb_Switch_fs;
   Autothrust_LagFilter((rtb_Gain_m - Autothrust_DWork.Delay_DSTATE) / Autothrust_U.in.time.dt, Autothrust_P.LagFilter_C1,
@@ -735,9 +736,9 @@ void Autothrust::step()
 
    case 1:
     rtb_Switch_fs = ((Autothrust_P.Gain_Gain * rtb_Switch_fs + rtb_Switch_d) + (Autothrust_P.Gain1_Gain * rtb_y_hw +
-      Autothrust_P.Gain3_Gain * rtb_y_p)) * look1_binlxpw(std::fmin(rtb_Saturation, rtb_Saturation),
-      Autothrust_P.ScheduledGain2_BreakpointsForDimension1, Autothrust_P.ScheduledGain2_Table, 3U) * look1_binlxpw
-      (Autothrust_DWork.pY, Autothrust_P.ScheduledGain4_BreakpointsForDimension1, Autothrust_P.ScheduledGain4_Table, 1U);
+      Autothrust_P.Gain3_Gain * rtb_y_p)) * look1_binlxpw<3U>(std::fmin(rtb_Saturation, rtb_Saturation),
+      Autothrust_P.ScheduledGain2_BreakpointsForDimension1, Autothrust_P.ScheduledGain2_Table) * look1_binlxpw<1U>
+      (Autothrust_DWork.pY, Autothrust_P.ScheduledGain4_BreakpointsForDimension1, Autothrust_P.ScheduledGain4_Table);
     if (rtb_Switch_fs > Autothrust_P.Saturation1_UpperSat) {
       rtb_Switch_fs = Autothrust_P.Saturation1_UpperSat;
     } else if (rtb_Switch_fs < Autothrust_P.Saturation1_LowerSat) {
@@ -746,8 +747,8 @@ void Autothrust::step()
     break;
 
    case 2:
-    rtb_Switch_fs = Autothrust_P.Gain1_Gain_p * look1_binlxpw(std::fmin(rtb_Saturation, rtb_Saturation),
-      Autothrust_P.uDLookupTable_bp01Data, Autothrust_P.uDLookupTable_tableData, 6U);
+    rtb_Switch_fs = Autothrust_P.Gain1_Gain_p * look1_binlxpw<6U>(std::fmin(rtb_Saturation, rtb_Saturation),
+      Autothrust_P.uDLookupTable_bp01Data, Autothrust_P.uDLookupTable_tableData);
     if (rtb_Switch_fs > Autothrust_P.Saturation_UpperSat) {
       rtb_Switch_fs = Autothrust_P.Saturation_UpperSat;
     } else if (rtb_Switch_fs < Autothrust_P.Saturation_LowerSat) {
@@ -756,8 +757,8 @@ void Autothrust::step()
     break;
 
    case 3:
-    rtb_Switch_fs = Autothrust_P.Gain1_Gain_o * look1_binlxpw(std::fmin(rtb_Saturation, rtb_Saturation),
-      Autothrust_P.uDLookupTable_bp01Data_b, Autothrust_P.uDLookupTable_tableData_o, 6U);
+    rtb_Switch_fs = Autothrust_P.Gain1_Gain_o * look1_binlxpw<6U>(std::fmin(rtb_Saturation, rtb_Saturation),
+      Autothrust_P.uDLookupTable_bp01Data_b, Autothrust_P.uDLookupTable_tableData_o);
     if (rtb_Switch_fs > Autothrust_P.Saturation_UpperSat_a) {
       rtb_Switch_fs = Autothrust_P.Saturation_UpperSat_a;
     } else if (rtb_Switch_fs < Autothrust_P.Saturation_LowerSat_a) {
@@ -1172,6 +1173,20 @@ void Autothrust::terminate()
 {
 }
 
+void Autothrust::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(Autothrust_U);
+  writer.write(Autothrust_Y);
+  writer.write(Autothrust_DWork);
+}
+
+boolean_T Autothrust::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(Autothrust_U) &&
+    reader.read(Autothrust_Y) &&
+    reader.read(Autothrust_DWork);
+}
+
 Autothrust::Autothrust():
   Autothrust_U(),
   Autothrust_Y(),
@@ -1,6 +1,7 @@
 #ifndef RTW_HEADER_Autothrust_h_
 #define RTW_HEADER_Autothrust_h_
 #include "rtwtypes.h"
+#include "ModelSnapshot.h"
 #include "Autothrust_types.h"
 
 class Autothrust final
@@ -280,13 +281,15 @@ class Autothrust final
   void initialize();
   void step();
   static void terminate();
+  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
   Autothrust();
   ~Autothrust();
  private:
   ExternalInputs_Autothrust_T Autothrust_U;
   ExternalOutputs_Autothrust_T Autothrust_Y;
   D_Work_Autothrust_T Autothrust_DWork;
-  static Parameters_Autothrust_T Autothrust_P;
+  static const Parameters_Autothrust_T Autothrust_P;
   static void Autothrust_TimeSinceCondition(real_T rtu_time, boolean_T rtu_condition, real_T *rty_y,
     rtDW_TimeSinceCondition_Autothrust_T *localDW);
   static void Autothrust_LeadLagFilter(real_T rtu_U, real_T rtu_C1, real_T rtu_C2, real_T rtu_C3, real_T rtu_C4, real_T
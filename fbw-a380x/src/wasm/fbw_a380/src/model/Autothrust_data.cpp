@@ -1,6 +1,6 @@
 #include "Autothrust.h"
 
-Autothrust::Parameters_Autothrust_T Autothrust::Autothrust_P{
+const Autothrust::Parameters_Autothrust_T Autothrust::Autothrust_P{
 
   {
     {
@@ -4,6 +4,7 @@
 #include <cmath>
 #include "look2_binlxpw.h"
 #include "look1_binlxpw.h"
+#include "LookupKernels.h"
 #include "look2_pbinlxpw.h"
 
 const uint8_T FacComputer_IN_Flying{ 1U };
@@ -592,9 +593,9 @@ void FacComputer::step()
       FacComputer_P.BitfromLabel5_bit_g, &rtb_y_c);
     FacComputer_MATLABFunction_d(rtb_y_pg, rtb_DataTypeConversion_ml, rtb_OR1, rtb_DataTypeConversion_kr,
       rtb_DataTypeConversion_he, rtb_y_c != 0U, &rtb_Switch4_f);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_Switch4_f,
-      FacComputer_P.alphafloor_bp01Data, FacComputer_P.alphafloor_bp02Data, FacComputer_P.alphafloor_tableData,
-      FacComputer_P.alphafloor_maxIndex, 4U), FacComputer_P.RateLimiterGenericVariableTs1_up,
+    FacComputer_RateLimiter(look2_pbinlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_Switch4_f,
+      FacComputer_P.alphafloor_bp01Data, FacComputer_P.alphafloor_bp02Data, FacComputer_P.alphafloor_tableData, &FacComputer_DWork.lookupIndex[0],
+      FacComputer_P.alphafloor_maxIndex), FacComputer_P.RateLimiterGenericVariableTs1_up,
       FacComputer_P.RateLimiterGenericVariableTs1_lo, FacComputer_U.in.time.dt, FacComputer_P.reset_Value,
       &rtb_Switch1_a, &FacComputer_DWork.sf_RateLimiter);
     rtb_Gain_f = FacComputer_P.DiscreteDerivativeVariableTs_Gain * rtb_V_ias;
@@ -713,25 +714,24 @@ void FacComputer::step()
       FacComputer_P.BitfromLabel5_bit_g3, &rtb_y_c);
     FacComputer_MATLABFunction_d(rtb_Memory, rtb_y_pg, rtb_DataTypeConversion_ml, rtb_OR1, rtb_DataTypeConversion_kr,
       rtb_y_c != 0U, &rtb_Switch4_f);
-    FacComputer_RateLimiter(look1_binlxpw(rtb_Switch4_f, FacComputer_P.alpha0_bp01Data, FacComputer_P.alpha0_tableData,
-      5U), FacComputer_P.RateLimiterGenericVariableTs1_up_g, FacComputer_P.RateLimiterGenericVariableTs1_lo_n,
+    FacComputer_RateLimiter(look1_pbinlxpw<5U>(rtb_Switch4_f, FacComputer_P.alpha0_bp01Data, FacComputer_P.alpha0_tableData, &FacComputer_DWork.lookupIndex[2]), FacComputer_P.RateLimiterGenericVariableTs1_up_g, FacComputer_P.RateLimiterGenericVariableTs1_lo_n,
       FacComputer_U.in.time.dt, FacComputer_P.reset_Value_k, &rtb_Switch1_a, &FacComputer_DWork.sf_RateLimiter_c);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_Switch4_f, FacComputer_P.alphamax_bp01Data,
-      FacComputer_P.alphamax_bp02Data, FacComputer_P.alphamax_tableData, FacComputer_P.alphamax_maxIndex, 4U),
+    FacComputer_RateLimiter(look2_pbinlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_Switch4_f, FacComputer_P.alphamax_bp01Data,
+      FacComputer_P.alphamax_bp02Data, FacComputer_P.alphamax_tableData, &FacComputer_DWork.lookupIndex[3], FacComputer_P.alphamax_maxIndex),
       FacComputer_P.RateLimiterGenericVariableTs4_up, FacComputer_P.RateLimiterGenericVariableTs4_lo,
       FacComputer_U.in.time.dt, FacComputer_P.reset_Value_o, &rtb_Y_d, &FacComputer_DWork.sf_RateLimiter_a);
     FacComputer_CalculateV_alpha_max(static_cast<real_T>(rtb_V_ias),
       rtb_BusAssignment_d_flight_envelope_alpha_filtered_deg, rtb_Switch1_a, rtb_Y_d, &rtb_Y_i);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_Switch4_f,
+    FacComputer_RateLimiter(look2_pbinlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_Switch4_f,
       FacComputer_P.alphaprotection_bp01Data, FacComputer_P.alphaprotection_bp02Data,
-      FacComputer_P.alphaprotection_tableData, FacComputer_P.alphaprotection_maxIndex, 4U),
+      FacComputer_P.alphaprotection_tableData, &FacComputer_DWork.lookupIndex[5], FacComputer_P.alphaprotection_maxIndex),
       FacComputer_P.RateLimiterGenericVariableTs3_up, FacComputer_P.RateLimiterGenericVariableTs3_lo,
       FacComputer_U.in.time.dt, FacComputer_P.reset_Value_a, &rtb_Y_d, &FacComputer_DWork.sf_RateLimiter_n);
     FacComputer_CalculateV_alpha_max(static_cast<real_T>(rtb_V_ias),
       rtb_BusAssignment_d_flight_envelope_alpha_filtered_deg, rtb_Switch1_a, rtb_Y_d, &rtb_Y_f);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_Switch4_f,
+    FacComputer_RateLimiter(look2_pbinlxpw<4U>(static_cast<real_T>(rtb_mach), rtb_Switch4_f,
       FacComputer_P.alphastallwarn_bp01Data, FacComputer_P.alphastallwarn_bp02Data,
-      FacComputer_P.alphastallwarn_tableData, FacComputer_P.alphastallwarn_maxIndex, 4U),
+      FacComputer_P.alphastallwarn_tableData, &FacComputer_DWork.lookupIndex[7], FacComputer_P.alphastallwarn_maxIndex),
       FacComputer_P.RateLimiterGenericVariableTs2_up, FacComputer_P.RateLimiterGenericVariableTs2_lo,
       FacComputer_U.in.time.dt, FacComputer_P.reset_Value_i, &rtb_Y_d, &FacComputer_DWork.sf_RateLimiter_j);
     FacComputer_CalculateV_alpha_max(static_cast<real_T>(rtb_V_ias),
@@ -766,9 +766,9 @@ void FacComputer::step()
       FacComputer_P.BitfromLabel5_bit_j, &rtb_y_c);
     FacComputer_MATLABFunction_d(rtb_Memory, rtb_y_pg, rtb_DataTypeConversion_ml, rtb_OR1, rtb_DataTypeConversion_kr,
       rtb_y_c != 0U, &rtb_Switch4_f);
-    FacComputer_MATLABFunction2(look1_binlxpw(rtb_Switch4_f, FacComputer_P.uDLookupTable3_bp01Data,
-      FacComputer_P.uDLookupTable3_tableData, 5U), look1_binlxpw(rtb_Switch4_f, FacComputer_P.uDLookupTable2_bp01Data,
-      FacComputer_P.uDLookupTable2_tableData, 5U), static_cast<real_T>(rtb_DataTypeConversion2), &rtb_Y_d);
+    FacComputer_MATLABFunction2(look1_pbinlxpw<5U>(rtb_Switch4_f, FacComputer_P.uDLookupTable3_bp01Data,
+      FacComputer_P.uDLookupTable3_tableData, &FacComputer_DWork.lookupIndex[9]), look1_pbinlxpw<5U>(rtb_Switch4_f, FacComputer_P.uDLookupTable2_bp01Data,
+      FacComputer_P.uDLookupTable2_tableData, &FacComputer_DWork.lookupIndex[10]), static_cast<real_T>(rtb_DataTypeConversion2), &rtb_Y_d);
     FacComputer_RateLimiter_f(rtb_Y_d, FacComputer_P.RateLimiterGenericVariableTs1_up_d,
       FacComputer_P.RateLimiterGenericVariableTs1_lo_f, FacComputer_U.in.time.dt,
       FacComputer_P.RateLimiterGenericVariableTs1_InitialCondition, FacComputer_P.reset_Value_k5, &rtb_Y_f,
@@ -837,18 +837,18 @@ void FacComputer::step()
       rtb_Y_d = FacComputer_P.Saturation_LowerSat_b;
     }
 
-    y_value = look1_binlxpw(rtb_Y_d, FacComputer_P.uDLookupTable_bp01Data, FacComputer_P.uDLookupTable_tableData, 1U) +
+    y_value = look1_pbinlxpw<1U>(rtb_Y_d, FacComputer_P.uDLookupTable_bp01Data, FacComputer_P.uDLookupTable_tableData, &FacComputer_DWork.lookupIndex[11]) +
       rtb_Switch1_a;
-    FacComputer_MATLABFunction2(look1_binlxpw(FacComputer_P.Constant_Value_k, FacComputer_P.uDLookupTable6_bp01Data,
-      FacComputer_P.uDLookupTable6_tableData, 5U), look1_binlxpw(FacComputer_P.Constant_Value_k,
-      FacComputer_P.uDLookupTable5_bp01Data, FacComputer_P.uDLookupTable5_tableData, 5U), static_cast<real_T>
+    FacComputer_MATLABFunction2(look1_pbinlxpw<5U>(FacComputer_P.Constant_Value_k, FacComputer_P.uDLookupTable6_bp01Data,
+      FacComputer_P.uDLookupTable6_tableData, &FacComputer_DWork.lookupIndex[12]), look1_pbinlxpw<5U>(FacComputer_P.Constant_Value_k,
+      FacComputer_P.uDLookupTable5_bp01Data, FacComputer_P.uDLookupTable5_tableData, &FacComputer_DWork.lookupIndex[13]), static_cast<real_T>
       (rtb_DataTypeConversion2), &rtb_Switch1_a);
     rtb_Switch1_a = std::fmax(FacComputer_P.Gain1_Gain * rtb_Switch1_a, FacComputer_P.Vmcl_Value_a +
       FacComputer_P.Bias_Bias);
     rtb_Y_d = FacComputer_P.Vmcl_Value_a + FacComputer_P.Bias2_Bias;
-    FacComputer_MATLABFunction2(look1_binlxpw(FacComputer_P.Constant1_Value_h, FacComputer_P.uDLookupTable8_bp01Data,
-      FacComputer_P.uDLookupTable8_tableData, 5U), look1_binlxpw(FacComputer_P.Constant1_Value_h,
-      FacComputer_P.uDLookupTable7_bp01Data, FacComputer_P.uDLookupTable7_tableData, 5U), static_cast<real_T>
+    FacComputer_MATLABFunction2(look1_pbinlxpw<5U>(FacComputer_P.Constant1_Value_h, FacComputer_P.uDLookupTable8_bp01Data,
+      FacComputer_P.uDLookupTable8_tableData, &FacComputer_DWork.lookupIndex[14]), look1_pbinlxpw<5U>(FacComputer_P.Constant1_Value_h,
+      FacComputer_P.uDLookupTable7_bp01Data, FacComputer_P.uDLookupTable7_tableData, &FacComputer_DWork.lookupIndex[15]), static_cast<real_T>
       (rtb_DataTypeConversion2), &rtb_Switch4_f);
     rtb_Switch4_f = std::fmax(FacComputer_P.Gain_Gain_o * rtb_Switch4_f, rtb_Y_d);
     rtb_v_gd = (rtb_v_gd * 2.0 + 85.0) + std::fmax(rtb_alt - 20000.0, 0.0) / 1000.0;
@@ -897,8 +897,8 @@ void FacComputer::step()
       FacComputer_P.BitfromLabel5_bit_c, &rtb_y_c);
     FacComputer_MATLABFunction_d(rtb_OR1, rtb_DataTypeConversion_kr, rtb_DataTypeConversion_he,
       rtb_DataTypeConversion_e0, rtb_DataTypeConversion_jc, rtb_y_c != 0U, &rtb_Switch1_a);
-    rtb_BusAssignment_f_flight_envelope_v_fe_next_kn = look1_binlxpw(rtb_Switch1_a,
-      FacComputer_P.uDLookupTable1_bp01Data, FacComputer_P.uDLookupTable1_tableData, 5U);
+    rtb_BusAssignment_f_flight_envelope_v_fe_next_kn = look1_pbinlxpw<5U>(rtb_Switch1_a,
+      FacComputer_P.uDLookupTable1_bp01Data, FacComputer_P.uDLookupTable1_tableData, &FacComputer_DWork.lookupIndex[16]);
     rtb_DataTypeConversion_he = ((rtb_Switch1_a < FacComputer_P.CompareToConstant_const_i) && (rtb_alt <=
       FacComputer_P.CompareToConstant1_const_i));
     if (rtb_Switch_i_idx_2) {
@@ -909,8 +909,8 @@ void FacComputer::step()
 
     rtb_Switch4_a_0 = std::fmin(std::fmin(rtb_Y_d, std::sqrt(std::pow((std::pow(FacComputer_P.Constant1_Value_p *
       FacComputer_P.Constant1_Value_p * 0.2 + 1.0, 3.5) - 1.0) * (rtb_p_s_c / 1013.25) + 1.0, 0.2857142857142857) - 1.0)
-      * 1479.1), look1_binlxpw(rtb_Switch1_a, FacComputer_P.uDLookupTable_bp01Data_a,
-      FacComputer_P.uDLookupTable_tableData_a, 5U));
+      * 1479.1), look1_pbinlxpw<5U>(rtb_Switch1_a, FacComputer_P.uDLookupTable_bp01Data_a,
+      FacComputer_P.uDLookupTable_tableData_a, &FacComputer_DWork.lookupIndex[17]));
     if (rtb_V_ias > FacComputer_P.Saturation_UpperSat_j) {
       rtb_Switch1_a = FacComputer_P.Saturation_UpperSat_j;
     } else if (rtb_V_ias < FacComputer_P.Saturation_LowerSat_c) {
@@ -1042,8 +1042,8 @@ void FacComputer::step()
       FacComputer_P.RateLimiterGenericVariableTs_lo_f, FacComputer_U.in.time.dt,
       FacComputer_U.in.analog_inputs.yaw_damper_position_deg, !rtb_yawDamperEngaged, &rtb_Y_f,
       &FacComputer_DWork.sf_RateLimiter_fu);
-    u0 = look1_binlxpw(static_cast<real_T>(rtb_V_ias), FacComputer_P.uDLookupTable_bp01Data_i,
-                       FacComputer_P.uDLookupTable_tableData_j, 6U);
+    u0 = look1_pbinlxpw<6U>(static_cast<real_T>(rtb_V_ias), FacComputer_P.uDLookupTable_bp01Data_i,
+                       FacComputer_P.uDLookupTable_tableData_j, &FacComputer_DWork.lookupIndex[18]);
     if (u0 > FacComputer_P.Saturation_UpperSat_g) {
       u0 = FacComputer_P.Saturation_UpperSat_g;
     } else if (u0 < FacComputer_P.Saturation_LowerSat_f) {
@@ -1403,6 +1403,20 @@ void FacComputer::terminate()
 {
 }
 
+void FacComputer::snapshot(ModelSnapshotWriter &writer) const
+{
+  writer.write(FacComputer_U);
+  writer.write(FacComputer_Y);
+  writer.write(FacComputer_DWork);
+}
+
+boolean_T FacComputer::restore(ModelSnapshotReader &reader)
+{
+  return reader.read(FacComputer_U) &&
+    reader.read(FacComputer_Y) &&
+    reader.read(FacComputer_DWork);
+}
+
 FacComputer::FacComputer():
   FacComputer_U(),
   FacComputer_Y(),
@@ -5,10 +5,12 @@
 
 Prim::Prim(bool isUnit1, bool isUnit2, bool isUnit3) : isUnit1(isUnit1), isUnit2(isUnit2), isUnit3(isUnit3) {
   primComputer.initialize();
+  modelOutputs = primComputer.getExternalOutputs().out;
 }
 
 Prim::Prim(const Prim& obj) : isUnit1(obj.isUnit1), isUnit2(obj.isUnit2), isUnit3(obj.isUnit3) {
   primComputer.initialize();
+  modelOutputs = primComputer.getExternalOutputs().out;
 }
 
 void Prim::clearMemory() {}
@@ -38,10 +40,15 @@ void Prim::update(double deltaTime, double simulationTime, bool faultActive, boo
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  primComputer.setExternalInputs(&modelInputs);
+  // While the computer is unpowered or failed the model only holds its outputs, so it is skipped after the step that
+  // stopped it. The outputs stay frozen and the getters report them as failed.
+  if (modelInputs.in.sim_data.computer_running || modelRunning) {
+    primComputer.setExternalInputs(&modelInputs);
+    modelRunning = modelInputs.in.sim_data.computer_running;
+    primComputer.step();
+    modelOutputs = primComputer.getExternalOutputs().out;
+  }
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
-  primComputer.step();
-  modelOutputs = primComputer.getExternalOutputs().out;
 }
 
 // Perform self monitoring
@@ -208,3 +215,24 @@ base_prim_analog_outputs Prim::getAnalogOutputs() {
 
   return output;
 }
+
+// Write the computer state (monitoring and model) to a snapshot.
+void Prim::snapshot(ModelSnapshotWriter& writer) const {
+  writer.write(modelInputs);
+  primComputer.snapshot(writer);
+  writer.write(modelOutputs);
+  writer.write(modelRunning);
+  writer.write(monitoringHealthy);
+  writer.write(prevEngageButtonWasPressed);
+  writer.write(powerSupplyOutageTime);
+  writer.write(powerSupplyFault);
+  writer.write(selfTestTimer);
+  writer.write(selfTestComplete);
+}
+
+// Read the computer state back from a snapshot.
+bool Prim::restore(ModelSnapshotReader& reader) {
+  return reader.read(modelInputs) && primComputer.restore(reader) && reader.read(modelOutputs) && reader.read(modelRunning) &&
+         reader.read(monitoringHealthy) && reader.read(prevEngageButtonWasPressed) && reader.read(powerSupplyOutageTime) &&
+         reader.read(powerSupplyFault) && reader.read(selfTestTimer) && reader.read(selfTestComplete);
+}
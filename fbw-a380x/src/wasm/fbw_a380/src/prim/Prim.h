@@ -20,6 +20,10 @@ class Prim {
 
   base_prim_analog_outputs getAnalogOutputs();
 
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+
   A380PrimComputer::ExternalInputs_A380PrimComputer_T modelInputs = {};
 
  private:
@@ -38,6 +42,8 @@ class Prim {
   // Model
   A380PrimComputer primComputer;
   prim_outputs modelOutputs;
+  // true if the computer was running during the last model step
+  bool modelRunning = false;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
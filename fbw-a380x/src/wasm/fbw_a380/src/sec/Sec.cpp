@@ -5,10 +5,12 @@
 
 Sec::Sec(bool isUnit1, bool isUnit2, bool isUnit3) : isUnit1(isUnit1), isUnit2(isUnit2), isUnit3(isUnit3) {
   secComputer.initialize();
+  modelOutputs = secComputer.getExternalOutputs().out;
 }
 
 Sec::Sec(const Sec& obj) : isUnit1(obj.isUnit1), isUnit2(obj.isUnit2), isUnit3(obj.isUnit3) {
   secComputer.initialize();
+  modelOutputs = secComputer.getExternalOutputs().out;
 }
 
 // If the power supply is valid, perform the self-test-sequence.
@@ -34,9 +36,13 @@ void Sec::update(double deltaTime, double simulationTime, bool faultActive, bool
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  secComputer.setExternalInputs(&modelInputs);
-  secComputer.step();
-  modelOutputs = secComputer.getExternalOutputs().out;
+  // dormant computers are not stepped, the model already latched its stopped state in the last step
+  if (modelInputs.in.sim_data.computer_running || modelRunning) {
+    secComputer.setExternalInputs(&modelInputs);
+    modelRunning = modelInputs.in.sim_data.computer_running;
+    secComputer.step();
+    modelOutputs = secComputer.getExternalOutputs().out;
+  }
 }
 
 // Perform self monitoring. If
@@ -180,3 +186,33 @@ base_sec_analog_outputs Sec::getAnalogOutputs() {
 
   return output;
 }
+
+// Write the computer state (monitoring and model) to a snapshot.
+void Sec::snapshot(ModelSnapshotWriter& writer) const {
+  writer.write(modelInputs);
+  secComputer.snapshot(writer);
+  writer.write(modelOutputs);
+  writer.write(modelRunning);
+  writer.write(monitoringHealthy);
+  writer.write(cpuStopped);
+  writer.write(cpuStoppedFlipFlop.getOutput());
+  writer.write(resetPulseNode);
+  writer.write(powerSupplyOutageTime);
+  writer.write(powerSupplyFault);
+  writer.write(selfTestTimer);
+  writer.write(selfTestComplete);
+}
+
+// Read the computer state back from a snapshot.
+bool Sec::restore(ModelSnapshotReader& reader) {
+  // the flip flop is restored through its output, the set precedence is fixed at construction
+  bool cpuStoppedFlipFlopOutput = false;
+  if (!(reader.read(modelInputs) && secComputer.restore(reader) && reader.read(modelOutputs) && reader.read(modelRunning) &&
+        reader.read(monitoringHealthy) && reader.read(cpuStopped) && reader.read(cpuStoppedFlipFlopOutput) &&
+        reader.read(resetPulseNode) && reader.read(powerSupplyOutageTime) && reader.read(powerSupplyFault) &&
+        reader.read(selfTestTimer) && reader.read(selfTestComplete))) {
+    return false;
+  }
+  cpuStoppedFlipFlop.setOutput(cpuStoppedFlipFlopOutput);
+  return true;
+}
@@ -19,6 +19,10 @@ class Sec {
 
   base_sec_analog_outputs getAnalogOutputs();
 
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+
   A380SecComputer::ExternalInputs_A380SecComputer_T modelInputs = {};
 
  private:
@@ -35,6 +39,8 @@ class Sec {
   // Model
   A380SecComputer secComputer;
   sec_outputs modelOutputs;
+  // true if the computer was running during the last model step
+  bool modelRunning = false;
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
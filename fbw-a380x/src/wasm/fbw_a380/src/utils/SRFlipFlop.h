@@ -6,7 +6,9 @@ class SRFlipFlop {
 
   bool update(bool set, bool reset);
 
-  bool getOutput();
+  bool getOutput() const;
+
+  void setOutput(bool value);
 
  private:
   bool output = false;
@@ -0,0 +1,795 @@
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "FuelNetwork.h"
+#include "FuelStateFile.h"
+#include "ini_type_conversion.h"
+
+#define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
+#define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
+#define FILENAME_FADEC_FUEL_STATE_FILE_EXTENSION ".fuel"
+#define CONFIGURATION_SECTION_FUEL "FUEL"
+
+/// <summary>
+/// Key of a fuel quantity in the FUEL section of the configuration file
+/// </summary>
+template <typename Configuration>
+struct ConfigurationEntry {
+  const char* key;
+  double Configuration::*value;
+};
+
+/// <summary>
+/// Fuel tank of an aircraft: the SimConnect data definition of its quantity and the LVar of the quantity tracked by the FADEC
+/// </summary>
+template <typename SimVars, typename DataTypes>
+struct FuelTankEntry {
+  DataTypes dataType;
+  FLOAT64 (SimVars::*getPre)();
+  void (SimVars::*setPre)(FLOAT64);
+};
+
+/// <summary>
+/// Imbalance of an engine against the others, all zero for a balanced engine
+/// </summary>
+struct EngineImbalance {
+  double coreSpeed = 0;      // %
+  double fuelFlow = 0;       // Kg/h
+  double egt = 0;            // degC
+  double oilPressure = 0;    // PSI
+  double oilIdleRandom = 0;  // PSI, applies to every engine
+};
+
+/// <summary>
+/// Engine control logic shared by the A32NX and A380X FADEC.
+/// Aircraft specifics are provided by a traits type:
+/// - ENGINE_COUNT: number of engines
+/// - SimVarsType, PolynomialType, ConfigurationType: the aircraft's SimVars, polynomials and fuel configuration (values in gallons),
+///   the SimVars provide the per-engine LVars by engine number (getEngineState(engine), setEngineN1(engine, value), ...)
+/// - TANK_COUNT, TANKS: the fuel tanks in FUELSYSTEM TANK QUANTITY index order (index + 1)
+/// - FEED_TANKS: the tank feeding each engine unless the cross-feed reassigns it during a frame
+/// - FUEL_LINES, FUEL_DRAWS: the most transfer lines and draws the aircraft adds to the fuel network during a frame
+/// - tankQuantity(simVars, index): quantity of a tank reported by the sim (gallons)
+/// - CONFIGURATION_ENTRIES: the configuration file keys of the fuel quantities, in tank order
+/// - idleCoreSpeed(pressAltitude, mach): corrected idle speed of the core spool (N2 on the A32NX, N3 on the A380X)
+/// - engineIdleCoreSpeed(simVars), setEngineIdleCoreSpeed(simVars, value): idle speed of the core spool
+/// - engineCoreSpeed(simVars, engine), setEngineCoreSpeed(simVars, engine, value): core spool speed of an engine computed by the FADEC
+/// - startCoreSpeed(poly, simSpeed, preSpeed, idleSpeed), shutdownCoreSpeed(poly, preSpeed, deltaTime): core spool polynomials
+/// - START_CORE_SPEED, OIL_TEMPERATURE, OIL_PRESSURE: the SimConnect data definitions of each engine, in engine order
+/// - engineImbalance(simVars, engine): imbalance of an engine
+/// </summary>
+template <typename Traits>
+class EngineControlCore {
+ public:
+  static constexpr int ENGINE_COUNT = Traits::ENGINE_COUNT;
+  static constexpr int TANK_COUNT = Traits::TANK_COUNT;
+
+  static_assert(std::size(Traits::TANKS) == TANK_COUNT && std::size(Traits::CONFIGURATION_ENTRIES) == TANK_COUNT,
+                "every tank needs an entry and a configuration key");
+
+  /// <summary>
+  /// Calls f(index) for every engine with a compile time zero based index, the loop is unrolled
+  /// </summary>
+  template <typename F>
+  static void forEachEngine(F&& f) {
+    forEachEngine(f, std::make_index_sequence<ENGINE_COUNT>{});
+  }
+
+  /// <summary>
+  /// Enables or disables writing the fuel state file on the ground, host tools disable it
+  /// </summary>
+  void setFuelStateSaving(bool enabled) { fuelStateSaving = enabled; }
+
+  /// <summary>
+  /// Exports the fuel quantities to the configuration file if they changed during the session
+  /// </summary>
+  void terminate() {
+    if (fuelStateExportPending) {
+      // the exported INI file is newer than the state file and is imported at the next start
+      saveFuelInConfiguration(fuelStateFile.state());
+      fuelStateExportPending = false;
+    }
+  }
+
+ protected:
+  using SimVarsType = typename Traits::SimVarsType;
+  using PolynomialType = typename Traits::PolynomialType;
+  using Configuration = typename Traits::ConfigurationType;
+
+  SimVarsType* simVars = nullptr;
+  EngineRatios engineRatios;
+  PolynomialType polynomial;
+  EngineRatios* ratios = &engineRatios;
+  PolynomialType* poly = &polynomial;
+
+  const double LBS_TO_KGS = 0.4535934;
+  const double KGS_TO_LBS = 1 / 0.4535934;
+
+  using FuelTanks = std::array<double, TANK_COUNT>;
+
+  FuelNetwork<TANK_COUNT, ENGINE_COUNT, Traits::FUEL_LINES, Traits::FUEL_DRAWS> fuelNetwork{Traits::FEED_TANKS};
+  bool fuelStateSaving = true;
+
+  bool simPaused = false;
+  double simOnGround = 0;
+
+  double idleN1 = 0;
+  double idleNCore = 0;  // N2 on the A32NX, N3 on the A380X
+  double idleFF = 0;
+  double idleEGT = 0;
+
+  std::array<double, ENGINE_COUNT> simNCorePre{};
+  std::array<double, ENGINE_COUNT> thermalEnergy{};
+  std::array<double, ENGINE_COUNT> oilTemperaturePre{};
+  double oilTemperature = 0;
+  double oilTemperatureMax = 0;
+  double correctedEGT = 0;
+  double correctedFuelFlow = 0;
+
+  /// <summary>
+  /// Engine State Machine
+  /// 0 - Engine OFF, 1 - Engine ON, 2 - Engine Starting, 3 - Engine Re-starting & 4 - Engine Shutting
+  /// </summary>
+  void engineStateMachine(int engine,
+                          double engineIgniter,
+                          double engineStarter,
+                          double simNCore,
+                          double idleNCore,
+                          double ambientTemp,
+                          double deltaTimeDiff) {
+    int resetTimer = 0;
+    double engineState = simVars->getEngineState(engine);
+    double egtFbw = simVars->getEngineEGT(engine);
+
+    // Present State PAUSED
+    if (deltaTimeDiff == 0 && engineState < 10) {
+      engineState = engineState + 10;
+      simPaused = true;
+    } else if (deltaTimeDiff == 0 && engineState >= 10) {
+      simPaused = true;
+    } else {
+      simPaused = false;
+
+      // Present State OFF
+      if (engineState == 0 || engineState == 10) {
+        if (engineIgniter == 1 && engineStarter == 1 && simNCore > 20) {
+          engineState = 1;
+        } else if (engineIgniter == 2 && engineStarter == 1) {
+          engineState = 2;
+        } else {
+          engineState = 0;
+        }
+      }
+
+      // Present State ON
+      if (engineState == 1 || engineState == 11) {
+        if (engineStarter == 1) {
+          engineState = 1;
+        } else {
+          engineState = 4;
+        }
+      }
+
+      // Present State Starting.
+      if (engineState == 2 || engineState == 12) {
+        if (engineStarter == 1 && simNCore >= (idleNCore - 0.1)) {
+          engineState = 1;
+          resetTimer = 1;
+        } else if (engineStarter == 0) {
+          engineState = 4;
+          resetTimer = 1;
+        } else {
+          engineState = 2;
+        }
+      }
+
+      // Present State Re-Starting.
+      if (engineState == 3 || engineState == 13) {
+        if (engineStarter == 1 && simNCore >= (idleNCore - 0.1)) {
+          engineState = 1;
+          resetTimer = 1;
+        } else if (engineStarter == 0) {
+          engineState = 4;
+          resetTimer = 1;
+        } else {
+          engineState = 3;
+        }
+      }
+
+      // Present State Shutting
+      if (engineState == 4 || engineState == 14) {
+        if (engineIgniter == 2 && engineStarter == 1) {
+          engineState = 3;
+          resetTimer = 1;
+        } else if (engineStarter == 0 && simNCore < 0.05 && egtFbw <= ambientTemp) {
+          engineState = 0;
+          resetTimer = 1;
+        } else if (engineStarter == 1 && simNCore > 50) {
+          engineState = 3;
+          resetTimer = 1;
+        } else {
+          engineState = 4;
+        }
+      }
+    }
+
+    simVars->setEngineState(engine, engineState);
+    if (resetTimer == 1) {
+      simVars->setEngineTimer(engine, 0);
+    }
+  }
+
+  /// <summary>
+  /// Engine Start Procedure
+  /// </summary>
+  void engineStartProcedure(int engine,
+                            double engineState,
+                            const EngineImbalance& imbalance,
+                            double deltaTime,
+                            double timer,
+                            double simNCore,
+                            double ambientTemp) {
+    // only whole percents of the core speed imbalance apply during the start
+    int coreSpeedImbalance = imbalance.coreSpeed;
+
+    idleNCore = Traits::engineIdleCoreSpeed(simVars);
+    idleN1 = simVars->getEngineIdleN1();
+    idleFF = simVars->getEngineIdleFF();
+    idleEGT = simVars->getEngineIdleEGT();
+
+    // Delay between Engine Master ON and Start Valve Open
+    if (timer < 1.7) {
+      if (simOnGround == 1) {
+        simVars->setEngineFuelUsed(engine, 0);
+      }
+      simVars->setEngineTimer(engine, timer + deltaTime);
+      double startCNCore = 0;
+      SimConnect_SetDataOnSimObject(hSimConnect, Traits::START_CORE_SPEED[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &startCNCore);
+    } else {
+      double preNCoreFbw = Traits::engineCoreSpeed(simVars, engine);
+      double preEgtFbw = simVars->getEngineEGT(engine);
+      double newNCoreFbw = Traits::startCoreSpeed(poly, simNCore, preNCoreFbw, idleNCore - coreSpeedImbalance);
+      double startEgtFbw = poly->startEGT(newNCoreFbw, idleNCore - coreSpeedImbalance, ambientTemp, idleEGT - imbalance.egt);
+      double shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
+
+      Traits::setEngineCoreSpeed(simVars, engine, newNCoreFbw);
+      simVars->setEngineN1(engine, poly->startN1(newNCoreFbw, idleNCore - coreSpeedImbalance, idleN1));
+      simVars->setEngineFF(engine, poly->startFF(newNCoreFbw, idleNCore - coreSpeedImbalance, idleFF - imbalance.fuelFlow));
+
+      if (engineState == 3) {
+        if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
+          simVars->setEngineEGT(engine, startEgtFbw);
+          simVars->setEngineState(engine, 2);
+        } else if (startEgtFbw > preEgtFbw) {
+          simVars->setEngineEGT(engine, preEgtFbw + (0.75 * deltaTime * (idleNCore - newNCoreFbw)));
+        } else {
+          simVars->setEngineEGT(engine, shutdownEgtFbw);
+        }
+      } else {
+        simVars->setEngineEGT(engine, startEgtFbw);
+      }
+
+      oilTemperature = poly->startOilTemp(newNCoreFbw, idleNCore, ambientTemp);
+      oilTemperaturePre[engine - 1] = oilTemperature;
+      SimConnect_SetDataOnSimObject(hSimConnect, Traits::OIL_TEMPERATURE[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &oilTemperature);
+    }
+  }
+
+  /// <summary>
+  /// Engine Shutdown Procedure - TEMPORAL SOLUTION
+  /// </summary>
+  void engineShutdownProcedure(int engine, double ambientTemp, double simN1, double deltaTime, double timer) {
+    if (timer < 1.8) {
+      simVars->setEngineTimer(engine, timer + deltaTime);
+    } else {
+      double preN1Fbw = simVars->getEngineN1(engine);
+      double preNCoreFbw = Traits::engineCoreSpeed(simVars, engine);
+      double preEgtFbw = simVars->getEngineEGT(engine);
+      double newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
+      if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
+        newN1Fbw = simN1;
+      }
+      double newNCoreFbw = Traits::shutdownCoreSpeed(poly, preNCoreFbw, deltaTime);
+      double newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
+      simVars->setEngineN1(engine, newN1Fbw);
+      Traits::setEngineCoreSpeed(simVars, engine, newNCoreFbw);
+      simVars->setEngineEGT(engine, newEgtFbw);
+    }
+  }
+
+  /// <summary>
+  /// FBW Engine RPM (N1 and core spool)
+  /// Updates Engine N1 and the core spool speed with our own algorithm for start-up and shutdown
+  /// </summary>
+  void updatePrimaryParameters(int engine, const EngineImbalance& imbalance, double simN1, double simNCore) {
+    simVars->setEngineN1(engine, simN1);
+    Traits::setEngineCoreSpeed(simVars, engine, max(0, simNCore - imbalance.coreSpeed));
+  }
+
+  /// <summary>
+  /// FBW Exhaust Gas Temperature (in degree Celsius)
+  /// Updates EGT with realistic values visualized in the ECAM
+  /// </summary>
+  void updateEGT(int engine,
+                 const EngineImbalance& imbalance,
+                 double deltaTime,
+                 double engineState,
+                 double simCN1,
+                 double cFbwFF,
+                 double mach,
+                 double pressAltitude,
+                 double ambientTemp) {
+    correctedEGT = poly->correctedEGT(simCN1, cFbwFF, mach, pressAltitude);
+
+    if (simOnGround == 1 && engineState == 0) {
+      simVars->setEngineEGT(engine, ambientTemp);
+    } else {
+      double egtFbwPrevious = simVars->getEngineEGT(engine);
+      double egtFbwActual = (correctedEGT * ratios->theta2(mach, ambientTemp)) - imbalance.egt;
+      egtFbwActual = egtFbwActual + (egtFbwPrevious - egtFbwActual) * expFBW(-0.1 * deltaTime);
+      simVars->setEngineEGT(engine, egtFbwActual);
+    }
+  }
+
+  /// <summary>
+  /// FBW Fuel FLow (in Kg/h)
+  /// Updates Fuel Flow with realistic values
+  /// </summary>
+  double updateFF(int engine,
+                  const EngineImbalance& imbalance,
+                  double simCN1,
+                  double mach,
+                  double pressAltitude,
+                  double ambientTemp,
+                  double ambientPressure) {
+    double outFlow = 0;
+
+    correctedFuelFlow = poly->correctedFuelFlow(simCN1, mach, pressAltitude);  // in lbs/hr.
+
+    // Checking Fuel Logic and final Fuel Flow
+    if (correctedFuelFlow < 1) {
+      outFlow = 0;
+    } else {
+      outFlow = max(0, (correctedFuelFlow * LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * sqrt(ratios->theta2(mach, ambientTemp))) -
+                           imbalance.fuelFlow);
+    }
+
+    simVars->setEngineFF(engine, outFlow);
+
+    return correctedFuelFlow;
+  }
+
+  /// <summary>
+  /// FBW Oil Qty, Pressure and Temperature (in Quarts, PSI and degree Celsius)
+  /// Updates Oil with realistic values visualized in the SD
+  /// </summary>
+  void updateOil(int engine,
+                 const EngineImbalance& imbalance,
+                 double engineState,
+                 double thrust,
+                 double simNCore,
+                 double deltaNCore,
+                 double deltaTime,
+                 double ambientTemp) {
+    double steadyTemperature = simVars->getEngineEGT(engine);
+    double oilQtyActual = simVars->getEngineOil(engine);
+    double oilTotalActual = simVars->getEngineOilTotal(engine);
+    double& energy = thermalEnergy[engine - 1];
+    double& oilTemperatureEnginePre = oilTemperaturePre[engine - 1];
+
+    //--------------------------------------------
+    // Oil Temperature
+    //--------------------------------------------
+    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperatureEnginePre - 10) {
+      oilTemperature = ambientTemp;
+    } else {
+      if (steadyTemperature > oilTemperatureMax) {
+        steadyTemperature = oilTemperatureMax;
+      }
+      energy = (0.995 * energy) + (deltaNCore / deltaTime);
+      oilTemperature = poly->oilTemperature(energy, oilTemperatureEnginePre, steadyTemperature, deltaTime);
+    }
+
+    //--------------------------------------------
+    // Oil Quantity
+    //--------------------------------------------
+    // Calculating Oil Qty as a function of thrust
+    double oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(thrust));
+    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperatureEnginePre);
+
+    // Oil burnt taken into account for tank and total oil
+    double oilBurn = (0.00011111 * deltaTime);
+    oilQtyActual = oilQtyActual - oilBurn;
+    oilTotalActual = oilTotalActual - oilBurn;
+
+    //--------------------------------------------
+    // Oil Pressure
+    //--------------------------------------------
+    double oilPressure = poly->oilPressure(simNCore) - imbalance.oilPressure + imbalance.oilIdleRandom;
+
+    //--------------------------------------------
+    // Engine Writing
+    //--------------------------------------------
+    oilTemperatureEnginePre = oilTemperature;
+    simVars->setEngineOil(engine, oilQtyActual);
+    simVars->setEngineOilTotal(engine, oilTotalActual);
+    SimConnect_SetDataOnSimObject(hSimConnect, Traits::OIL_TEMPERATURE[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                  &oilTemperature);
+    SimConnect_SetDataOnSimObject(hSimConnect, Traits::OIL_PRESSURE[engine - 1], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                  &oilPressure);
+  }
+
+  /// <summary>
+  /// Runs the state machine and the start, shutdown or running procedure of every engine
+  /// </summary>
+  /// <param name="deltaTimeDiff">Change of the animation delta time since the last frame, zero while the sim is paused</param>
+  void updateEngines(double deltaTime,
+                     double deltaTimeDiff,
+                     double mach,
+                     double pressAltitude,
+                     double ambientTemp,
+                     double ambientPressure) {
+    forEachEngine([&](auto i) {
+      int engine = i + 1;
+      double engineStarter = simVars->getEngineStarter(engine);
+      double engineIgniter = simVars->getEngineIgniter(engine);
+      double simCN1 = simVars->getCN1(engine);
+      double simN1 = simVars->getN1(engine);
+      double simNCore = simVars->getN2(engine);  // the sim's N2 is the core spool
+      EngineImbalance imbalance = Traits::engineImbalance(simVars, engine);
+
+      // Set & Check Engine Status for this Cycle
+      engineStateMachine(engine, engineIgniter, engineStarter, simNCore, idleNCore, ambientTemp, deltaTimeDiff);
+      double engineState = simVars->getEngineState(engine);
+      double timer = simVars->getEngineTimer(engine);
+
+      double cFbwFF;
+      switch (int(engineState)) {
+        case 2:
+        case 3:
+          engineStartProcedure(engine, engineState, imbalance, deltaTime, timer, simNCore, ambientTemp);
+          break;
+        case 4:
+          engineShutdownProcedure(engine, ambientTemp, simN1, deltaTime, timer);
+          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
+          break;
+        default:
+          updatePrimaryParameters(engine, imbalance, simN1, simNCore);
+          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
+          updateEGT(engine, imbalance, deltaTime, engineState, simCN1, cFbwFF, mach, pressAltitude, ambientTemp);
+          // updateOil(engine, imbalance, engineState, simVars->getThrust(engine), simNCore, simNCore - simNCorePre[i], deltaTime,
+          //           ambientTemp);
+      }
+
+      simNCorePre[i] = simNCore;
+    });
+  }
+
+  /// <summary>
+  /// Generate Idle/ Initial Engine Parameters (non-imbalanced)
+  /// Parameters are only recomputed when the quantized inputs changed since the last call.
+  /// </summary>
+  void generateIdleParameters(double pressAltitude, double mach, double ambientTemp, double ambientPressure) {
+    double idleCN1;
+    double idleCFF;
+
+    long altitudeKey = lround(pressAltitude / IDLE_CACHE_ALTITUDE_STEP);
+    long machKey = lround(mach / IDLE_CACHE_MACH_STEP);
+    long temperatureKey = lround(ambientTemp / IDLE_CACHE_TEMPERATURE_STEP);
+    long pressureKey = lround(ambientPressure / IDLE_CACHE_PRESSURE_STEP);
+
+    if (idleCacheValid && altitudeKey == idleCacheAltitude && machKey == idleCacheMach && temperatureKey == idleCacheTemperature &&
+        pressureKey == idleCachePressure) {
+      return;
+    }
+
+    idleCacheValid = true;
+    idleCacheAltitude = altitudeKey;
+    idleCacheMach = machKey;
+    idleCacheTemperature = temperatureKey;
+    idleCachePressure = pressureKey;
+
+    idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
+    idleN1 = idleCN1 * sqrt(ratios->theta2(0, ambientTemp));
+    idleNCore = Traits::idleCoreSpeed(pressAltitude, mach) * sqrt(ratios->theta(ambientTemp));
+    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
+    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
+    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
+
+    simVars->setEngineIdleN1(idleN1);
+    Traits::setEngineIdleCoreSpeed(simVars, idleNCore);
+    simVars->setEngineIdleFF(idleFF);
+    simVars->setEngineIdleEGT(idleEGT);
+  }
+
+  void updateThrustLimits(double simulationTime,
+                          double altitude,
+                          double ambientTemp,
+                          double ambientPressure,
+                          double mach,
+                          double packs,
+                          double nai,
+                          double wai) {
+    double idle = simVars->getEngineIdleN1();
+    double flexTemp = simVars->getFlexTemp();
+    double thrustLimitType = simVars->getThrustLimitType();
+    double to = 0;
+    double ga = 0;
+    double toga = 0;
+    double clb = 0;
+    double mct = 0;
+    double flex_to = 0;
+    double flex_ga = 0;
+    double flex = 0;
+
+    // Write all N1 Limits
+    to = limitN1(0, min(16600.0, altitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
+    ga = limitN1(1, min(16600.0, altitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
+    if (flexTemp > 0) {
+      flex_to = limitN1(0, min(16600.0, altitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+      flex_ga = limitN1(1, min(16600.0, altitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+    }
+    clb = limitN1(2, altitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    mct = limitN1(3, altitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+
+    // transition between TO and GA limit -----------------------------------------------------------------------------
+    double machFactorLow = max(0.0, min(1.0, (mach - 0.04) / 0.04));
+    toga = to + (ga - to) * machFactorLow;
+    flex = flex_to + (flex_ga - flex_to) * machFactorLow;
+
+    // adaption of CLB due to FLX limit if necessary ------------------------------------------------------------------
+
+    if ((prevThrustLimitType != 3 && thrustLimitType == 3) || (prevFlexTemperature == 0 && flexTemp > 0)) {
+      isFlexActive = true;
+    } else if ((flexTemp == 0) || (thrustLimitType == 4)) {
+      isFlexActive = false;
+    }
+
+    if (isFlexActive && !isTransitionActive && thrustLimitType == 1) {
+      isTransitionActive = true;
+      transitionStartTime = simulationTime;
+      transitionFactor = 0.2;
+      // transitionFactor = (clb - flex) / transitionTime;
+    } else if (!isFlexActive) {
+      isTransitionActive = false;
+      transitionStartTime = 0;
+      transitionFactor = 0;
+    }
+
+    double deltaThrust = 0;
+
+    if (isTransitionActive) {
+      double timeDifference = max(0, (simulationTime - transitionStartTime) - waitTime);
+
+      if (timeDifference > 0 && clb > flex) {
+        deltaThrust = min(clb - flex, timeDifference * transitionFactor);
+      }
+
+      if (flex + deltaThrust >= clb) {
+        isFlexActive = false;
+        isTransitionActive = false;
+      }
+    }
+
+    if (isFlexActive) {
+      clb = min(clb, flex) + deltaThrust;
+    }
+
+    prevThrustLimitType = thrustLimitType;
+    prevFlexTemperature = flexTemp;
+
+    // thrust transitions for MCT and TOGA ----------------------------------------------------------------------------
+
+    // get factors
+    double machFactor = max(0.0, min(1.0, ((mach - 0.37) / 0.05)));
+    double altitudeFactorLow = max(0.0, min(1.0, ((altitude - 16600) / 500)));
+    double altitudeFactorHigh = max(0.0, min(1.0, ((altitude - 25000) / 500)));
+
+    // adapt thrust limits
+    if (altitude >= 25000) {
+      mct = max(clb, mct + (clb - mct) * altitudeFactorHigh);
+      toga = mct;
+    } else {
+      if (mct > toga) {
+        mct = toga + (mct - toga) * min(1.0, altitudeFactorLow + machFactor);
+        toga = mct;
+      } else {
+        toga = toga + (mct - toga) * min(1.0, altitudeFactorLow + machFactor);
+      }
+    }
+
+    // write limits ---------------------------------------------------------------------------------------------------
+    simVars->setThrustLimitIdle(idle);
+    simVars->setThrustLimitToga(toga);
+    simVars->setThrustLimitFlex(flex);
+    simVars->setThrustLimitClimb(clb);
+    simVars->setThrustLimitMct(mct);
+  }
+
+  /// <summary>
+  /// Sets up the per-registration configuration and fuel state files and loads the fuel quantities
+  /// </summary>
+  Configuration initializeFuelState(const char* acftRegistration) {
+    confFilename += acftRegistration;
+    confFilename += FILENAME_FADEC_CONF_FILE_EXTENSION;
+    fuelStateFile.setFilename(std::string(FILENAME_FADEC_CONF_DIRECTORY) + acftRegistration + FILENAME_FADEC_FUEL_STATE_FILE_EXTENSION);
+
+    return getFuelState();
+  }
+
+  /// <summary>
+  /// Reads the quantities tracked by the FADEC and the quantities reported by the sim into the fuel network (LBS)
+  /// </summary>
+  void readFuelTanks(double fuelWeightGallon) {
+    for (int tank = 0; tank < TANK_COUNT; tank++) {
+      fuelNetwork.pre[tank] = (simVars->*Traits::TANKS[tank].getPre)();
+      fuelNetwork.actual[tank] = Traits::tankQuantity(simVars, tank + 1) * fuelWeightGallon;
+    }
+  }
+
+  /// <summary>
+  /// Writes the fuel quantities tracked by the FADEC
+  /// </summary>
+  /// <param name="fuel">Quantities per tank in LBS</param>
+  void setFuelPre(const FuelTanks& fuel) {
+    for (int tank = 0; tank < TANK_COUNT; tank++) {
+      (simVars->*Traits::TANKS[tank].setPre)(fuel[tank]);
+    }
+  }
+
+  /// <summary>
+  /// Writes the fuel quantity of a tank to the sim
+  /// </summary>
+  /// <param name="fuel">Quantity in LBS</param>
+  void setFuelTank(int tank, double fuel, double fuelWeightGallon) {
+    double fuelGallons = fuel / fuelWeightGallon;  // USG
+    SimConnect_SetDataOnSimObject(hSimConnect, Traits::TANKS[tank].dataType, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelGallons);
+  }
+
+  /// <summary>
+  /// Writes the fuel quantities of all tanks to the sim
+  /// </summary>
+  /// <param name="fuel">Quantities per tank in LBS</param>
+  void setFuelTanks(const FuelTanks& fuel, double fuelWeightGallon) {
+    for (int tank = 0; tank < TANK_COUNT; tank++) {
+      setFuelTank(tank, fuel[tank], fuelWeightGallon);
+    }
+  }
+
+  /// <summary>
+  /// Fuel quantities tracked by the FADEC as configuration (gallons)
+  /// </summary>
+  Configuration fuelConfiguration() {
+    Configuration configuration;
+    double fuelWeightGallon = simVars->getFuelWeightGallon();
+
+    for (int tank = 0; tank < TANK_COUNT; tank++) {
+      configuration.*Traits::CONFIGURATION_ENTRIES[tank].value = (simVars->*Traits::TANKS[tank].getPre)() / fuelWeightGallon;
+    }
+
+    return configuration;
+  }
+
+  /// <summary>
+  /// Writes the fuel quantities to the binary state file if they changed, the INI file is exported on termination
+  /// </summary>
+  void saveFuelState(const Configuration& configuration) {
+    if (!fuelStateFile.changed(configuration, FUEL_STATE_SAVE_THRESHOLD)) {
+      return;
+    }
+
+    if (fuelStateFile.write(configuration)) {
+      fuelStateExportPending = true;
+    } else {
+      std::cout << "EngineControl: failed to write fuel state due to error \"" << strerror(errno) << "\"" << std::endl;
+    }
+  }
+
+ private:
+  std::string confFilename = FILENAME_FADEC_CONF_DIRECTORY;
+
+  /// Fuel quantities are persisted in a binary state file while running, the INI file is exported on termination and
+  /// imported at startup if the state file is missing, invalid or not newer than the INI file (exported or edited outside the sim)
+  FuelStateFile<Configuration> fuelStateFile;
+  bool fuelStateExportPending = false;
+  /// Minimum change of a tank quantity to write the fuel state file (gallons)
+  static constexpr double FUEL_STATE_SAVE_THRESHOLD = 0.05;
+
+  bool isFlexActive = false;
+  double prevThrustLimitType = 0;
+  double prevFlexTemperature = 0;
+
+  const double waitTime = 10;
+  const double transitionTime = 30;
+
+  bool isTransitionActive = false;
+  double transitionFactor = 0;
+  double transitionStartTime = 0;
+
+  // Quantization steps of the idle parameter cache key
+  static constexpr double IDLE_CACHE_ALTITUDE_STEP = 10;       // ft
+  static constexpr double IDLE_CACHE_MACH_STEP = 0.001;       // mach
+  static constexpr double IDLE_CACHE_TEMPERATURE_STEP = 0.1;  // degC
+  static constexpr double IDLE_CACHE_PRESSURE_STEP = 0.1;     // hPa
+
+  bool idleCacheValid = false;
+  long idleCacheAltitude = 0;
+  long idleCacheMach = 0;
+  long idleCacheTemperature = 0;
+  long idleCachePressure = 0;
+
+  template <typename F, std::size_t... Index>
+  static void forEachEngine(F& f, std::index_sequence<Index...>) {
+    (f(std::integral_constant<std::size_t, Index>{}), ...);
+  }
+
+  /// <summary>
+  /// Loads the fuel quantities from the binary state file and falls back to importing them from the INI file,
+  /// the INI file is also imported when it was modified after the state file was last written
+  /// </summary>
+  Configuration getFuelState() {
+    Configuration configuration;
+
+    if (fuelStateFile.olderThan(confFilename) || !fuelStateFile.load(configuration)) {
+      configuration = getConfigurationFromFile();
+    }
+
+    return configuration;
+  }
+
+  Configuration getConfigurationFromFile() {
+    Configuration configuration;
+    mINI::INIStructure stInitStructure;
+
+    mINI::INIFile iniFile(confFilename);
+
+    if (!iniFile.read(stInitStructure)) {
+      std::cout << "EngineControl: failed to read configuration file " << confFilename << " due to error \"" << strerror(errno)
+                << "\" -> use default fuel quantities" << std::endl;
+    } else {
+      configuration = loadConfiguration(stInitStructure);
+    }
+
+    return configuration;
+  }
+
+  Configuration loadConfiguration(const mINI::INIStructure& structure) {
+    const Configuration defaults;
+    Configuration configuration;
+
+    for (const auto& entry : Traits::CONFIGURATION_ENTRIES) {
+      configuration.*entry.value =
+          mINI::INITypeConversion::getDouble(structure, CONFIGURATION_SECTION_FUEL, entry.key, defaults.*entry.value);
+    }
+
+    return configuration;
+  }
+
+  void saveFuelInConfiguration(const Configuration& configuration) {
+    mINI::INIStructure stInitStructure;
+    mINI::INIFile iniFile(confFilename);
+
+    // Do not check a possible error since the file may not exist yet
+    iniFile.read(stInitStructure);
+
+    for (const auto& entry : Traits::CONFIGURATION_ENTRIES) {
+      stInitStructure[CONFIGURATION_SECTION_FUEL][entry.key] = std::to_string(configuration.*entry.value);
+    }
+
+    if (!iniFile.write(stInitStructure, true)) {
+      std::cout << "EngineControl: failed to write engine conf " << confFilename << " due to error \"" << strerror(errno) << "\""
+                << std::endl;
+    }
+  }
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+/// <summary>
+/// Fuel network used by the FADEC fuel consumption logic.
+/// Tanks are held in contiguous arrays indexed by tank, engines are fed from one tank each (or none),
+/// and the transfers the sim performed during the frame are moved along lines between tanks.
+/// A frame is evaluated in a single pass by step().
+/// </summary>
+/// <typeparam name="TankCount">Number of tanks of the aircraft</typeparam>
+/// <typeparam name="EngineCount">Number of engines of the aircraft</typeparam>
+/// <typeparam name="MaxLines">Maximum number of transfer lines active during one frame</typeparam>
+/// <typeparam name="MaxDraws">Maximum number of additional consumers (e.g. APU) during one frame</typeparam>
+template <std::size_t TankCount, std::size_t EngineCount, std::size_t MaxLines, std::size_t MaxDraws>
+class FuelNetwork {
+ public:
+  /// Engine is not fed from any tank during this frame
+  static constexpr int NO_TANK = -1;
+
+  /// Quantity at the end of the previous frame as tracked by the FADEC (LBS)
+  std::array<double, TankCount> pre{};
+  /// Quantity reported by the sim for this frame (LBS)
+  std::array<double, TankCount> actual{};
+  /// Quantity at the end of this frame (LBS), valid for tanks feeding engines, receiving transfers or being drawn from
+  std::array<double, TankCount> quantity{};
+
+  /// Fuel burnt by each engine during this frame (KG)
+  std::array<double, EngineCount> burn{};
+  /// Tank feeding each engine during this frame
+  std::array<int, EngineCount> feedTank{};
+
+  explicit FuelNetwork(const std::array<int, EngineCount>& defaultFeedTanks) : defaultFeedTanks(defaultFeedTanks) { reset(); }
+
+  /// <summary>
+  /// Clears the burns, lines and draws of the previous frame and restores the default engine feeds
+  /// </summary>
+  void reset() {
+    burn.fill(0);
+    feedTank = defaultFeedTanks;
+    lineCount = 0;
+    drawCount = 0;
+  }
+
+  /// <summary>
+  /// Integrates the fuel flow of an engine over the frame.
+  /// The fuel flow is assumed to ramp linearly from the previous frame's value, which the trapezoidal rule integrates exactly.
+  /// </summary>
+  /// <param name="preFuelFlow">Fuel flow at the end of the previous frame (KG/H)</param>
+  /// <param name="fuelFlow">Fuel flow at the end of this frame (KG/H)</param>
+  /// <param name="deltaTime">Frame duration (H)</param>
+  /// <returns>Fuel burnt during the frame (KG)</returns>
+  static double integrateBurn(double preFuelFlow, double fuelFlow, double deltaTime) { return (preFuelFlow + fuelFlow) * 0.5 * deltaTime; }
+
+  /// <summary>
+  /// Moves a share of the fuel the sim removed from a source tank during this frame into a destination tank
+  /// </summary>
+  void addLine(int source, int destination, double share) {
+    assert(lineCount < MaxLines && "more transfer lines than the aircraft declares");
+    lines[lineCount++] = {source, destination, share};
+  }
+
+  /// <summary>
+  /// Removes an amount of fuel (LBS) from a tank during this frame
+  /// </summary>
+  void addDraw(int tank, double amount) {
+    assert(drawCount < MaxDraws && "more draws than the aircraft declares");
+    draws[drawCount++] = {tank, amount};
+  }
+
+  /// <summary>
+  /// Total quantity reported by the sim (LBS)
+  /// </summary>
+  double totalActual() const {
+    double total = 0;
+    for (std::size_t tank = 0; tank < TankCount; tank++) {
+      total += actual[tank];
+    }
+    return total;
+  }
+
+  /// <summary>
+  /// Total quantity tracked by the FADEC at the end of the previous frame (LBS)
+  /// </summary>
+  double totalPre() const {
+    double total = 0;
+    for (std::size_t tank = 0; tank < TankCount; tank++) {
+      total += pre[tank];
+    }
+    return total;
+  }
+
+  /// <summary>
+  /// Evaluates the network for this frame and prepares it for the next one
+  /// </summary>
+  /// <param name="kgsToLbs">Conversion factor of the engine burns into tank units</param>
+  void step(double kgsToLbs) {
+    quantity = pre;
+
+    for (std::size_t engine = 0; engine < EngineCount; engine++) {
+      if (feedTank[engine] != NO_TANK) {
+        quantity[feedTank[engine]] -= burn[engine] * kgsToLbs;
+      }
+    }
+
+    for (std::size_t i = 0; i < lineCount; i++) {
+      quantity[lines[i].destination] += (pre[lines[i].source] - actual[lines[i].source]) * lines[i].share;
+    }
+
+    for (std::size_t i = 0; i < drawCount; i++) {
+      quantity[draws[i].tank] -= draws[i].amount;
+    }
+
+    reset();
+  }
+
+ private:
+  struct Line {
+    int source;
+    int destination;
+    double share;
+  };
+
+  struct Draw {
+    int tank;
+    double amount;
+  };
+
+  std::array<int, EngineCount> defaultFeedTanks;
+  std::array<Line, MaxLines> lines{};
+  std::array<Draw, MaxDraws> draws{};
+  std::size_t lineCount = 0;
+  std::size_t drawCount = 0;
+};
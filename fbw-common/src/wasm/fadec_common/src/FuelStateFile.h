@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+#include <sys/stat.h>
+
+/// <summary>
+/// Compact binary persistence of the fuel quantities.
+/// The file holds a single fixed size record (header, state, checksum) which is written to a temporary file and moved over
+/// the previous one, so a crash while saving never leaves a truncated state behind.
+/// changed() allows skipping writes unless a quantity moved by more than a threshold since the last write.
+/// olderThan() tells whether another file (e.g. the INI file the state is imported from) was modified since the last write.
+/// </summary>
+/// <typeparam name="State">Plain struct made of doubles only (e.g. the FADEC Configuration)</typeparam>
+template <typename State>
+class FuelStateFile {
+  static_assert(std::is_trivially_copyable<State>::value, "State must be trivially copyable");
+  static_assert(sizeof(State) % sizeof(double) == 0, "State must only contain doubles");
+
+ public:
+  static constexpr uint32_t MAGIC = 0x4C455546;  // "FUEL"
+  static constexpr uint32_t VERSION = 1;
+
+  /// <summary>
+  /// Sets the file used by load() and write()
+  /// </summary>
+  void setFilename(const std::string& filename) {
+    this->filename = filename;
+    temporaryFilename = filename + ".tmp";
+  }
+
+  /// <summary>
+  /// Reads the state from the file
+  /// </summary>
+  /// <returns>False if the file does not exist or does not hold a valid record, the state is left untouched then.</returns>
+  bool load(State& state) {
+    Record record;
+
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+      return false;
+    }
+    size_t read = fread(&record, sizeof(Record), 1, file);
+    fclose(file);
+
+    if (read != 1 || record.magic != MAGIC || record.version != VERSION || record.size != sizeof(State) ||
+        record.checksum != checksum(record.state)) {
+      return false;
+    }
+
+    state = record.state;
+    lastSaved = record.state;
+    hasLastSaved = true;
+    return true;
+  }
+
+  /// <summary>
+  /// Checks if another file was modified since this file was last written.
+  /// Modification times only have a resolution of one second, a file modified within the same second counts as newer.
+  /// </summary>
+  /// <returns>True if the other file exists and this file does not or does not have a later modification time.</returns>
+  bool olderThan(const std::string& otherFilename) const {
+    struct stat other;
+    if (stat(otherFilename.c_str(), &other) != 0) {
+      return false;
+    }
+    struct stat own;
+    if (stat(filename.c_str(), &own) != 0) {
+      return true;
+    }
+    return other.st_mtime >= own.st_mtime;
+  }
+
+  /// <summary>
+  /// Checks if any quantity differs from the last loaded or written state by more than the threshold
+  /// </summary>
+  /// <returns>True if the state should be written, always true before the first load or write.</returns>
+  bool changed(const State& state, double threshold) const {
+    if (!hasLastSaved) {
+      return true;
+    }
+
+    const double* values = reinterpret_cast<const double*>(&state);
+    const double* saved = reinterpret_cast<const double*>(&lastSaved);
+    for (size_t i = 0; i < VALUE_COUNT; i++) {
+      if (std::abs(values[i] - saved[i]) > threshold) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// <summary>
+  /// Writes the state to the file
+  /// </summary>
+  /// <returns>True if the file was replaced, the previous file is kept otherwise.</returns>
+  bool write(const State& state) {
+    Record record = {MAGIC, VERSION, sizeof(State), state, checksum(state)};
+
+    FILE* file = fopen(temporaryFilename.c_str(), "wb");
+    if (file == nullptr) {
+      return false;
+    }
+    bool written = fwrite(&record, sizeof(Record), 1, file) == 1;
+    written = fclose(file) == 0 && written;
+
+    written = written && rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+    if (!written) {
+      remove(temporaryFilename.c_str());
+      return false;
+    }
+
+    lastSaved = state;
+    hasLastSaved = true;
+    return true;
+  }
+
+  /// <summary>
+  /// Last loaded or written state
+  /// </summary>
+  const State& state() const { return lastSaved; }
+
+ private:
+  static constexpr size_t VALUE_COUNT = sizeof(State) / sizeof(double);
+
+  struct Record {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;
+    State state;
+    uint32_t checksum;
+  };
+
+  std::string filename;
+  std::string temporaryFilename;
+  State lastSaved{};
+  bool hasLastSaved = false;
+
+  /// FNV-1a over the state bytes
+  static uint32_t checksum(const State& state) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&state);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(State); i++) {
+      hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+  }
+};
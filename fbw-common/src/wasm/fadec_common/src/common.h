@@ -2,13 +2,13 @@
 
 class SimVars;
 
-HANDLE hSimConnect;
+inline HANDLE hSimConnect;
 
 /// <summary>
 /// Interpolation function being used by MSFS for the engine tables
 /// </summary>
 /// <returns>Interpolated 'y' for a given 'x'.</returns>
-double interpolate(double x, double x0, double x1, double y0, double y1) {
+inline double interpolate(double x, double x0, double x1, double y0, double y1) {
   double y = 0;
 
   if (x0 == x1) {
@@ -23,7 +23,7 @@ double interpolate(double x, double x0, double x1, double y0, double y1) {
 /// <summary>
 /// Custom POW function
 /// </summary>
-double powFBW(double base, size_t exponent) {
+inline double powFBW(double base, size_t exponent) {
   double power = 1.0;
 
   while (exponent > 0) {
@@ -37,7 +37,7 @@ double powFBW(double base, size_t exponent) {
 /// <summary>
 /// Custom EXP function
 /// </summary>
-double expFBW(double x) {
+inline double expFBW(double x) {
   int n = 8;
   x = 1.0 + x / 256.0;
 
@@ -53,23 +53,23 @@ double expFBW(double x) {
 /// </summary>
 class EngineRatios {
  public:
-  FLOAT64 theta(double ambientTemp) {
+  static FLOAT64 theta(double ambientTemp) {
     double t = (273.15 + ambientTemp) / 288.15;
     return t;
   }
 
-  FLOAT64 delta(double ambientPressure) {
+  static FLOAT64 delta(double ambientPressure) {
     double d = ambientPressure / 1013;
     return d;
   }
 
-  FLOAT64 theta2(double mach, double ambientTemp) {
-    double t2 = this->theta(ambientTemp) * (1 + 0.2 * powFBW(mach, 2));
+  static FLOAT64 theta2(double mach, double ambientTemp) {
+    double t2 = theta(ambientTemp) * (1 + 0.2 * powFBW(mach, 2));
     return t2;
   }
 
-  FLOAT64 delta2(double mach, double ambientPressure) {
-    double d2 = this->delta(ambientPressure) * pow((1 + 0.2 * powFBW(mach, 2)), 3.5);
+  static FLOAT64 delta2(double mach, double ambientPressure) {
+    double d2 = delta(ambientPressure) * pow((1 + 0.2 * powFBW(mach, 2)), 3.5);
     return d2;
   }
 };
@@ -90,7 +90,7 @@ std::string to_string_with_zero_padding(const T& value, std::size_t total_length
 /// </summary>
 /// <param name="imbalanceCode">The imbalance coded word (2-bytes per parameter).</param>
 /// <param name="parameter">The engine parameter which is being imbalanced.</param>
-double imbalanceExtractor(double imbalanceCode, int parameter) {
+inline double imbalanceExtractor(double imbalanceCode, int parameter) {
   double reg = 0;
 
   parameter = 9 - parameter;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+
+// Bit masks of the armed autopilot modes as published by the AutopilotStateMachine in lateral_mode_armed and
+// vertical_mode_armed (FMA and FCU logic read them back from there).
+//
+// The generated model builds these masks with multiword integers and round trips through double, the masks are only seven
+// bits wide though, so they are built with plain shifts instead. Every mask is exactly representable as double.
+
+namespace armed_modes {
+
+enum LateralArmedBit : uint64_t {
+  LATERAL_NAV = 1ULL << 0,
+  LATERAL_LOC = 1ULL << 1,
+};
+
+enum VerticalArmedBit : uint64_t {
+  VERTICAL_ALT = 1ULL << 0,
+  VERTICAL_ALT_CST = 1ULL << 1,
+  VERTICAL_CLB = 1ULL << 2,
+  VERTICAL_DES = 1ULL << 3,
+  VERTICAL_GS = 1ULL << 4,
+  VERTICAL_FINAL_DES = 1ULL << 5,
+  VERTICAL_TCAS = 1ULL << 6,
+};
+
+inline uint64_t bitIf(bool condition, uint64_t bit) {
+  return static_cast<uint64_t>(condition) * bit;
+}
+
+// mask of an ap_lateral_armed struct of the model
+template <typename LateralArmed>
+inline uint64_t lateralMask(const LateralArmed& armed) {
+  return bitIf(armed.NAV, LATERAL_NAV) | bitIf(armed.LOC, LATERAL_LOC);
+}
+
+// mask of an ap_vertical_armed struct of the model
+template <typename VerticalArmed>
+inline uint64_t verticalMask(const VerticalArmed& armed) {
+  return bitIf(armed.ALT, VERTICAL_ALT) | bitIf(armed.ALT_CST, VERTICAL_ALT_CST) | bitIf(armed.CLB, VERTICAL_CLB) |
+         bitIf(armed.DES, VERTICAL_DES) | bitIf(armed.GS, VERTICAL_GS) | bitIf(armed.FINAL_DES, VERTICAL_FINAL_DES) |
+         bitIf(armed.TCAS, VERTICAL_TCAS);
+}
+
+// converts a mask published as double (model output, simvar or client data) back
+inline uint64_t fromDouble(double value) {
+  return static_cast<uint64_t>(value);
+}
+
+inline bool isLateralArmed(double lateralModeArmed, LateralArmedBit bit) {
+  return (fromDouble(lateralModeArmed) & bit) != 0;
+}
+
+inline bool isVerticalArmed(double verticalModeArmed, VerticalArmedBit bit) {
+  return (fromDouble(verticalModeArmed) & bit) != 0;
+}
+
+}  // namespace armed_modes
@@ -0,0 +1,500 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#include "ElevationTileCache.h"
+
+namespace {
+
+constexpr uint64_t EMPTY_KEY = UINT64_MAX;
+constexpr float NAUTICAL_MILES_PER_DEGREE = 60.0f;
+constexpr float DEGREES_TO_RADIANS = 3.14159265f / 180.0f;
+// the prefetch walks along the path in steps of half a tile and stops after this number of steps
+constexpr int MAXIMUM_PREFETCH_STEPS = 32;
+
+}  // namespace
+
+bool ElevationTileCache::Queue::contains(uint64_t key) const {
+  for (size_t i = 0; i < count; ++i) {
+    if (keys[(first + i) % QUEUE_CAPACITY] == key) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ElevationTileCache::Queue::push(uint64_t key) {
+  if (count == QUEUE_CAPACITY) {
+    return false;
+  }
+  keys[(first + count) % QUEUE_CAPACITY] = key;
+  count++;
+  return true;
+}
+
+uint64_t ElevationTileCache::Queue::pop() {
+  uint64_t key = keys[first];
+  first = (first + 1) % QUEUE_CAPACITY;
+  count--;
+  return key;
+}
+
+ElevationTileCache::ElevationTileCache(size_t budget) : memoryBudget(budget) {}
+
+ElevationTileCache::~ElevationTileCache() {
+  close();
+  if (decoder.streamInitialized) {
+    inflateEnd(&decoder.stream);
+  }
+}
+
+bool ElevationTileCache::open(const std::string& path) {
+  close();
+
+  file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  bool valid = std::fread(&header, sizeof(header), 1, file) == 1 &&
+               std::memcmp(header.magic, ELEVATION_FILE_MAGIC, sizeof(ELEVATION_FILE_MAGIC)) == 0 &&
+               header.version == ELEVATION_FILE_VERSION && header.tileSamples != 0 && header.levelCount != 0 &&
+               header.compression <= ELEVATION_COMPRESSION_DEFLATE;
+
+  if (valid) {
+    levels.resize(header.levelCount);
+    valid = std::fread(levels.data(), sizeof(ElevationLevel), levels.size(), file) == levels.size();
+  }
+
+  tileBytes = static_cast<size_t>(header.tileSamples) * header.tileSamples * sizeof(int16_t);
+  size_t largestTile = 0;
+  for (size_t i = 0; valid && i < levels.size(); ++i) {
+    const auto& level = levels[i];
+    const uint64_t tileCount = static_cast<uint64_t>(level.tilesLongitude) * level.tilesLatitude;
+    valid = level.tileSpan > 0.0f && tileCount != 0 && level.indexOffset < ELEVATION_FILE_MAX_SIZE &&
+            tileCount <= (ELEVATION_FILE_MAX_SIZE - level.indexOffset) / sizeof(ElevationTileEntry) &&
+            std::fseek(file, static_cast<long>(level.indexOffset), SEEK_SET) == 0;
+    if (valid) {
+      indices.emplace_back(static_cast<size_t>(tileCount));
+      valid = std::fread(indices.back().data(), sizeof(ElevationTileEntry), indices.back().size(), file) == indices.back().size();
+    }
+    for (size_t tile = 0; valid && tile < indices.back().size(); ++tile) {
+      const auto& entry = indices.back()[tile];
+      valid = entry.offset == 0 || (entry.offset + entry.size <= ELEVATION_FILE_MAX_SIZE &&
+                                    (header.compression != ELEVATION_COMPRESSION_NONE || entry.size == tileBytes));
+      largestTile = std::max<size_t>(largestTile, entry.size);
+    }
+  }
+
+  if (!valid) {
+    std::cerr << "ElevationTileCache: Invalid elevation file " << path << std::endl;
+    close();
+    return false;
+  }
+
+  // all memory of the cache is allocated here, the lookups and the decoding reuse it
+  const size_t slotCount = std::max<size_t>(memoryBudget / tileBytes, 1);
+  slots.resize(slotCount);
+  samples.resize(slotCount * tileBytes / sizeof(int16_t));
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    slots[slot] = {EMPTY_KEY, 0, NO_SLOT, NO_SLOT, false, false};
+    pushBack(slot);
+  }
+
+  tableBits = 1;
+  while ((size_t{1} << tableBits) < 2 * slotCount) {
+    tableBits++;
+  }
+  tableKeys.assign(size_t{1} << tableBits, EMPTY_KEY);
+  tableSlots.assign(tableKeys.size(), NO_SLOT);
+
+  decoder.input.reserve(largestTile);
+  if (!decoder.streamInitialized) {
+    decoder.streamInitialized = inflateInit(&decoder.stream) == Z_OK;
+  }
+
+  std::cout << "ElevationTileCache: Opened " << path << " with " << slotCount << " tile slots" << std::endl;
+  return true;
+}
+
+void ElevationTileCache::close() {
+  if (file != nullptr) {
+    std::fclose(file);
+    file = nullptr;
+  }
+
+  levels.clear();
+  indices.clear();
+  slots.clear();
+  samples.clear();
+  tableKeys.clear();
+  tableSlots.clear();
+  mostRecent = NO_SLOT;
+  leastRecent = NO_SLOT;
+  lastSlot = NO_SLOT;
+  lastMissingKey = UINT64_MAX;
+  demand.count = 0;
+  ahead.count = 0;
+  decoder.active = false;
+  stats = Statistics();
+}
+
+float ElevationTileCache::sampleSpacing(uint8_t level) const {
+  return levels[level].tileSpan / static_cast<float>(header.tileSamples);
+}
+
+uint8_t ElevationTileCache::selectLevel(float spacing) const {
+  uint8_t selected = 0;
+  for (uint8_t level = 1; level < levelCount(); ++level) {
+    if (sampleSpacing(level) <= spacing) {
+      selected = level;
+    }
+  }
+  return selected;
+}
+
+uint32_t ElevationTileCache::tileIndex(uint8_t level, float latitude, float longitude, int64_t& row, int64_t& column) const {
+  const ElevationLevel& descriptor = levels[level];
+  const int64_t tilesLongitude = descriptor.tilesLongitude;
+  const int64_t tilesLatitude = descriptor.tilesLatitude;
+
+  row = std::clamp(static_cast<int64_t>(std::floor((latitude + 90.0f) / descriptor.tileSpan)), int64_t{0}, tilesLatitude - 1);
+  column = static_cast<int64_t>(std::floor((longitude + 180.0f) / descriptor.tileSpan));
+  column = ((column % tilesLongitude) + tilesLongitude) % tilesLongitude;
+  return static_cast<uint32_t>(row * tilesLongitude + column);
+}
+
+float ElevationTileCache::sample(uint32_t slot, uint8_t level, int64_t row, int64_t column, float latitude, float longitude) const {
+  const ElevationLevel& descriptor = levels[level];
+  const int64_t tileSamples = header.tileSamples;
+  const float spacing = sampleSpacing(level);
+  const float south = static_cast<float>(row) * descriptor.tileSpan - 90.0f;
+  const float west = static_cast<float>(column) * descriptor.tileSpan - 180.0f;
+  // positions east of 180° belong to the tiles from 180° west
+  const float east = std::fmod(longitude - west + 360.0f, 360.0f);
+  const int64_t sampleRow = std::clamp(static_cast<int64_t>((latitude - south) / spacing), int64_t{0}, tileSamples - 1);
+  const int64_t sampleColumn = std::clamp(static_cast<int64_t>(east / spacing), int64_t{0}, tileSamples - 1);
+  const int16_t* tile = &samples[static_cast<size_t>(slot) * static_cast<size_t>(tileSamples * tileSamples)];
+  return static_cast<float>(tile[sampleRow * tileSamples + sampleColumn]);
+}
+
+float ElevationTileCache::elevation(uint8_t level, float latitude, float longitude) {
+  stats.lookups++;
+
+  int64_t row = 0;
+  int64_t column = 0;
+  const uint32_t index = tileIndex(level, latitude, longitude, row, column);
+  const ElevationTileEntry& entry = indices[level][index];
+  if (entry.offset == 0) {
+    return static_cast<float>(entry.elevation);
+  }
+
+  const uint64_t key = tileKey(level, index);
+  if (lastSlot != NO_SLOT && slots[lastSlot].key == key) {
+    return sample(lastSlot, level, row, column, latitude, longitude);
+  }
+  const uint32_t slot = find(key);
+  if (slot != NO_SLOT) {
+    touch(slot);
+    lastSlot = slot;
+    return sample(slot, level, row, column, latitude, longitude);
+  }
+
+  // the tile is queued once per pass, the lookups of the same tile follow each other
+  if (key != lastMissingKey) {
+    lastMissingKey = key;
+    if (!(decoder.active && decoder.key == key) && !demand.contains(key)) {
+      demand.push(key);
+    }
+  }
+
+  stats.fallbacks++;
+  for (uint8_t coarser = static_cast<uint8_t>(level + 1); coarser < levelCount(); ++coarser) {
+    const uint32_t coarserIndex = tileIndex(coarser, latitude, longitude, row, column);
+    const ElevationTileEntry& coarserEntry = indices[coarser][coarserIndex];
+    if (coarserEntry.offset == 0) {
+      return static_cast<float>(coarserEntry.elevation);
+    }
+    const uint32_t coarserSlot = find(tileKey(coarser, coarserIndex));
+    if (coarserSlot != NO_SLOT) {
+      slots[coarserSlot].lastPass = pass;
+      slots[coarserSlot].ahead = false;
+      return sample(coarserSlot, coarser, row, column, latitude, longitude);
+    }
+  }
+  return static_cast<float>(entry.elevation);
+}
+
+void ElevationTileCache::prefetch(uint8_t level,
+                                  float latitude,
+                                  float longitude,
+                                  float track,
+                                  float groundSpeed,
+                                  float lookahead,
+                                  float radius) {
+  if (!isOpen() || level >= levelCount()) {
+    return;
+  }
+
+  const ElevationLevel& descriptor = levels[level];
+  const float cosLatitude = std::max(std::cos(latitude * DEGREES_TO_RADIANS), 0.01f);
+  const float distance = std::max(groundSpeed, 0.0f) * lookahead / 3600.0f;
+  const float stepLength = 0.5f * descriptor.tileSpan * NAUTICAL_MILES_PER_DEGREE;
+  const int steps = std::min(static_cast<int>(distance / stepLength), MAXIMUM_PREFETCH_STEPS);
+  const float latitudeRadius = radius / NAUTICAL_MILES_PER_DEGREE;
+  const float longitudeRadius = std::min(latitudeRadius / cosLatitude, 180.0f);
+
+  for (int step = 0; step <= steps; ++step) {
+    const float travelled = static_cast<float>(step) * stepLength;
+    const float pathLatitude = latitude + travelled * std::cos(track * DEGREES_TO_RADIANS) / NAUTICAL_MILES_PER_DEGREE;
+    const float pathLongitude = longitude + travelled * std::sin(track * DEGREES_TO_RADIANS) / (NAUTICAL_MILES_PER_DEGREE * cosLatitude);
+
+    int64_t southRow = 0;
+    int64_t westColumn = 0;
+    int64_t northRow = 0;
+    int64_t eastColumn = 0;
+    tileIndex(level, pathLatitude - latitudeRadius, pathLongitude - longitudeRadius, southRow, westColumn);
+    tileIndex(level, pathLatitude + latitudeRadius, pathLongitude + longitudeRadius, northRow, eastColumn);
+    const int64_t tilesLongitude = descriptor.tilesLongitude;
+    const int64_t columns = std::min(((eastColumn - westColumn) % tilesLongitude + tilesLongitude) % tilesLongitude + 1, tilesLongitude);
+
+    for (int64_t row = southRow; row <= northRow; ++row) {
+      for (int64_t i = 0; i < columns; ++i) {
+        const auto index = static_cast<uint32_t>(row * tilesLongitude + (westColumn + i) % tilesLongitude);
+        const uint64_t key = tileKey(level, index);
+        if (indices[level][index].offset == 0 || find(key) != NO_SLOT || (decoder.active && decoder.key == key) ||
+            demand.contains(key) || ahead.contains(key)) {
+          continue;
+        }
+        if (!ahead.push(key)) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+void ElevationTileCache::update(size_t decodeBudget) {
+  while (decodeBudget > 0 && isOpen()) {
+    while (!decoder.active && demand.count != 0) {
+      startDecoding(demand.pop(), false);
+    }
+    while (!decoder.active && ahead.count != 0) {
+      startDecoding(ahead.pop(), true);
+    }
+    if (!decoder.active) {
+      return;
+    }
+
+    uint8_t* output = reinterpret_cast<uint8_t*>(&samples[static_cast<size_t>(decoder.slot) * tileBytes / sizeof(int16_t)]);
+    const size_t step = std::min(decodeBudget, tileBytes - decoder.produced);
+    size_t produced = step;
+    bool failed = false;
+
+    if (header.compression == ELEVATION_COMPRESSION_NONE) {
+      std::memcpy(output + decoder.produced, decoder.input.data() + decoder.produced, step);
+    } else {
+      decoder.stream.next_out = output + decoder.produced;
+      decoder.stream.avail_out = static_cast<uInt>(step);
+      const int result = inflate(&decoder.stream, Z_NO_FLUSH);
+      produced = step - decoder.stream.avail_out;
+      // a stream that ends early or makes no progress is corrupt
+      failed = (result != Z_OK && result != Z_STREAM_END) || (result == Z_STREAM_END && decoder.produced + produced != tileBytes) ||
+               produced == 0;
+    }
+
+    decoder.produced += produced;
+    decodeBudget -= std::min(decodeBudget, std::max<size_t>(produced, 1));
+    if (failed) {
+      finishDecoding(false);
+    } else if (decoder.produced == tileBytes) {
+      finishDecoding(true);
+    }
+  }
+}
+
+bool ElevationTileCache::idle() const {
+  return !decoder.active && demand.count == 0 && ahead.count == 0;
+}
+
+size_t ElevationTileCache::residentTiles() const {
+  return static_cast<size_t>(std::count_if(slots.begin(), slots.end(), [](const Slot& slot) { return slot.resident; }));
+}
+
+size_t ElevationTileCache::memoryUsage() const {
+  size_t usage = samples.capacity() * sizeof(int16_t) + slots.capacity() * sizeof(Slot) + decoder.input.capacity() +
+                 tableKeys.capacity() * sizeof(uint64_t) + tableSlots.capacity() * sizeof(uint32_t);
+  for (const auto& index : indices) {
+    usage += index.capacity() * sizeof(ElevationTileEntry);
+  }
+  return usage;
+}
+
+uint32_t ElevationTileCache::find(uint64_t key) const {
+  if (tableKeys.empty()) {
+    return NO_SLOT;
+  }
+
+  const size_t mask = tableKeys.size() - 1;
+  for (size_t position = (key * 0x9e3779b97f4a7c15ull) >> (64 - tableBits);; position = (position + 1) & mask) {
+    if (tableKeys[position] == key) {
+      return tableSlots[position];
+    } else if (tableKeys[position] == EMPTY_KEY) {
+      return NO_SLOT;
+    }
+  }
+}
+
+void ElevationTileCache::insert(uint64_t key, uint32_t slot) {
+  const size_t mask = tableKeys.size() - 1;
+  size_t position = (key * 0x9e3779b97f4a7c15ull) >> (64 - tableBits);
+  while (tableKeys[position] != EMPTY_KEY) {
+    position = (position + 1) & mask;
+  }
+  tableKeys[position] = key;
+  tableSlots[position] = slot;
+}
+
+void ElevationTileCache::erase(uint64_t key) {
+  const size_t mask = tableKeys.size() - 1;
+  size_t position = (key * 0x9e3779b97f4a7c15ull) >> (64 - tableBits);
+  while (tableKeys[position] != key) {
+    if (tableKeys[position] == EMPTY_KEY) {
+      return;
+    }
+    position = (position + 1) & mask;
+  }
+
+  // shift the following entries back so that every entry stays reachable from its home position
+  tableKeys[position] = EMPTY_KEY;
+  for (size_t next = (position + 1) & mask; tableKeys[next] != EMPTY_KEY; next = (next + 1) & mask) {
+    const size_t home = (tableKeys[next] * 0x9e3779b97f4a7c15ull) >> (64 - tableBits);
+    const bool reachable = position <= next ? (home > position && home <= next) : (home > position || home <= next);
+    if (!reachable) {
+      tableKeys[position] = tableKeys[next];
+      tableSlots[position] = tableSlots[next];
+      tableKeys[next] = EMPTY_KEY;
+      position = next;
+    }
+  }
+}
+
+void ElevationTileCache::unlink(uint32_t slot) {
+  Slot& entry = slots[slot];
+  if (entry.previous != NO_SLOT) {
+    slots[entry.previous].next = entry.next;
+  } else {
+    mostRecent = entry.next;
+  }
+  if (entry.next != NO_SLOT) {
+    slots[entry.next].previous = entry.previous;
+  } else {
+    leastRecent = entry.previous;
+  }
+  entry.previous = NO_SLOT;
+  entry.next = NO_SLOT;
+}
+
+void ElevationTileCache::pushFront(uint32_t slot) {
+  slots[slot].next = mostRecent;
+  slots[slot].previous = NO_SLOT;
+  if (mostRecent != NO_SLOT) {
+    slots[mostRecent].previous = slot;
+  } else {
+    leastRecent = slot;
+  }
+  mostRecent = slot;
+}
+
+void ElevationTileCache::pushBack(uint32_t slot) {
+  slots[slot].previous = leastRecent;
+  slots[slot].next = NO_SLOT;
+  if (leastRecent != NO_SLOT) {
+    slots[leastRecent].next = slot;
+  } else {
+    mostRecent = slot;
+  }
+  leastRecent = slot;
+}
+
+void ElevationTileCache::touch(uint32_t slot) {
+  slots[slot].lastPass = pass;
+  slots[slot].ahead = false;
+  if (mostRecent != slot) {
+    unlink(slot);
+    pushFront(slot);
+  }
+}
+
+bool ElevationTileCache::startDecoding(uint64_t key, bool prefetched) {
+  const uint8_t level = keyLevel(key);
+  const ElevationTileEntry& entry = indices[level][keyIndex(key)];
+  const uint32_t slot = leastRecent;
+  if (entry.offset == 0 || slot == NO_SLOT || find(key) != NO_SLOT) {
+    return false;
+  }
+
+  // the prefetch only uses slots that the last pass did not need and does not replace its own tiles
+  Slot& victim = slots[slot];
+  if (prefetched && victim.resident && (victim.lastPass + 1 >= pass || victim.ahead)) {
+    return false;
+  }
+  if (victim.resident) {
+    erase(victim.key);
+    victim.resident = false;
+    victim.key = EMPTY_KEY;
+    stats.evictions++;
+  }
+  if (lastSlot == slot) {
+    lastSlot = NO_SLOT;
+  }
+  unlink(slot);
+
+  decoder.active = true;
+  decoder.key = key;
+  decoder.slot = slot;
+  decoder.prefetched = prefetched;
+  decoder.produced = 0;
+  decoder.input.resize(entry.size);
+  if (std::fseek(file, static_cast<long>(entry.offset), SEEK_SET) != 0 ||
+      std::fread(decoder.input.data(), 1, decoder.input.size(), file) != decoder.input.size()) {
+    finishDecoding(false);
+    return false;
+  }
+
+  if (header.compression == ELEVATION_COMPRESSION_DEFLATE) {
+    if (!decoder.streamInitialized || inflateReset(&decoder.stream) != Z_OK) {
+      finishDecoding(false);
+      return false;
+    }
+    decoder.stream.next_in = decoder.input.data();
+    decoder.stream.avail_in = static_cast<uInt>(decoder.input.size());
+  }
+  return true;
+}
+
+void ElevationTileCache::finishDecoding(bool success) {
+  Slot& slot = slots[decoder.slot];
+  decoder.active = false;
+
+  if (success) {
+    slot.key = decoder.key;
+    slot.resident = true;
+    slot.ahead = decoder.prefetched;
+    slot.lastPass = pass;
+    insert(decoder.key, decoder.slot);
+    pushFront(decoder.slot);
+    stats.decodedTiles++;
+    stats.prefetchedTiles += decoder.prefetched;
+  } else {
+    // the tile is answered with its highest elevation from now on
+    std::cerr << "ElevationTileCache: Unable to decode tile " << keyIndex(decoder.key) << " of level "
+              << static_cast<int>(keyLevel(decoder.key))
+              << std::endl;
+    indices[keyLevel(decoder.key)][keyIndex(decoder.key)].offset = 0;
+    slot.resident = false;
+    pushBack(decoder.slot);
+    stats.failures++;
+  }
+}
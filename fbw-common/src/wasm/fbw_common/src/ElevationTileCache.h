@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "zlib/zlib.h"
+
+// Tiled elevation cache on top of a local elevation file.
+//
+// The file contains a pyramid of levels that cover the whole earth with tiles of tileSamples x tileSamples elevations in feet,
+// level 0 has the finest resolution and every level is coarser than the previous one. The tiles are numbered in rows from the
+// south pole and from 180° west, the samples of a tile are std::int16_t in rows from the south and each sample covers the cell
+// to its north east. Tiles that have the same elevation everywhere (i.e. the oceans) are not stored.
+//
+// Layout: ElevationFileHeader, levelCount x ElevationLevel, then per level its index with one ElevationTileEntry per tile.
+// The stored tiles are deflate streams if the header says so, otherwise raw samples.
+
+struct ElevationFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint16_t tileSamples;
+  uint8_t levelCount;
+  uint8_t compression;
+} __attribute__((packed));
+
+struct ElevationLevel {
+  float tileSpan;
+  uint32_t tilesLongitude;
+  uint32_t tilesLatitude;
+  uint32_t reserved;
+  uint64_t indexOffset;
+} __attribute__((packed));
+
+// A tile with offset 0 is not stored and has the elevation of the entry everywhere. For stored tiles the elevation is the
+// highest sample of the tile, the cache answers with it until the tile is decoded.
+struct ElevationTileEntry {
+  uint64_t offset;
+  uint32_t size;
+  int16_t elevation;
+} __attribute__((packed));
+
+static constexpr char ELEVATION_FILE_MAGIC[8] = {'F', 'B', 'W', 'T', 'E', 'R', 'R', '\0'};
+static constexpr uint32_t ELEVATION_FILE_VERSION = 2;
+static constexpr uint8_t ELEVATION_COMPRESSION_NONE = 0;
+static constexpr uint8_t ELEVATION_COMPRESSION_DEFLATE = 1;
+// the file is read with fseek() whose offset is a 32 bit long in the WASM module, nothing of the file may lie beyond it
+static constexpr uint64_t ELEVATION_FILE_MAX_SIZE = INT32_MAX;
+
+// The cache keeps the decoded tiles in a fixed number of slots that are allocated when the file is opened, so it never uses
+// more than its memory budget for the tiles. The least recently used tile is replaced.
+//
+// A lookup never waits for the file: a missing tile is queued and the lookup is answered from a coarser level that is
+// resident or from the highest elevation of the tile. The queued tiles are read and inflated by update() with a limit of
+// decoded bytes per call, the prefetch queues the tiles ahead of the aircraft with a lower priority.
+class ElevationTileCache {
+ public:
+  struct Statistics {
+    uint64_t lookups = 0;
+    uint64_t fallbacks = 0;
+    uint64_t decodedTiles = 0;
+    uint64_t prefetchedTiles = 0;
+    uint64_t evictions = 0;
+    uint64_t failures = 0;
+  };
+
+  // the budget is the memory of the decoded tiles in bytes
+  explicit ElevationTileCache(size_t budget);
+  ElevationTileCache(const ElevationTileCache&) = delete;
+  ~ElevationTileCache();
+
+  ElevationTileCache& operator=(const ElevationTileCache&) = delete;
+
+  // reads the indices of all levels and allocates the tile slots, false if the file is missing or invalid
+  bool open(const std::string& path);
+  void close();
+  bool isOpen() const { return file != nullptr; }
+
+  uint8_t levelCount() const { return static_cast<uint8_t>(levels.size()); }
+  // the distance between two samples of the level in degrees
+  float sampleSpacing(uint8_t level) const;
+  // the coarsest level that still resolves the spacing in degrees
+  uint8_t selectLevel(float spacing) const;
+
+  // the elevation in feet of the cell that contains the position, answered from the resident tiles only
+  float elevation(uint8_t level, float latitude, float longitude);
+
+  // starts a new pass of lookups (i.e. a picture), the prefetch does not replace tiles of the current and the last pass and
+  // prefetched tiles that were not used yet
+  void beginPass() {
+    pass++;
+    lastSlot = NO_SLOT;
+    lastMissingKey = UINT64_MAX;
+  }
+
+  // queues the tiles within the radius [nm] around the path that the aircraft flies with the track [°] and ground speed [kn]
+  // in the lookahead time [s]
+  void prefetch(uint8_t level, float latitude, float longitude, float track, float groundSpeed, float lookahead, float radius);
+
+  // reads and decodes queued tiles until the number of decoded bytes is reached
+  void update(size_t decodeBudget);
+
+  // true if no tile is queued or being decoded
+  bool idle() const;
+
+  size_t capacity() const { return slots.size(); }
+  size_t residentTiles() const;
+  // the bytes of the tile slots, the indices and the read buffer
+  size_t memoryUsage() const;
+  const Statistics& statistics() const { return stats; }
+
+ private:
+  static constexpr uint32_t NO_SLOT = UINT32_MAX;
+  static constexpr size_t QUEUE_CAPACITY = 256;
+
+  struct Slot {
+    uint64_t key;
+    uint64_t lastPass;
+    uint32_t previous;
+    uint32_t next;
+    bool resident;
+    // a prefetched tile that no lookup used yet
+    bool ahead;
+  };
+
+  struct Queue {
+    uint64_t keys[QUEUE_CAPACITY];
+    size_t first = 0;
+    size_t count = 0;
+
+    bool contains(uint64_t key) const;
+    bool push(uint64_t key);
+    uint64_t pop();
+  };
+
+  struct Decoder {
+    bool active = false;
+    uint64_t key = 0;
+    uint32_t slot = NO_SLOT;
+    bool prefetched = false;
+    size_t produced = 0;
+    std::vector<uint8_t> input;
+    z_stream stream{};
+    bool streamInitialized = false;
+  };
+
+  size_t memoryBudget;
+  FILE* file = nullptr;
+  ElevationFileHeader header{};
+  std::vector<ElevationLevel> levels;
+  std::vector<std::vector<ElevationTileEntry>> indices;
+  size_t tileBytes = 0;
+
+  std::vector<Slot> slots;
+  std::vector<int16_t> samples;
+  uint32_t mostRecent = NO_SLOT;
+  uint32_t leastRecent = NO_SLOT;
+  // open addressing from tile keys to slots
+  std::vector<uint64_t> tableKeys;
+  std::vector<uint32_t> tableSlots;
+  uint32_t tableBits = 0;
+
+  Queue demand;
+  Queue ahead;
+  Decoder decoder;
+  uint64_t pass = 0;
+  uint64_t lastMissingKey = UINT64_MAX;
+  uint32_t lastSlot = NO_SLOT;
+  Statistics stats;
+
+  static uint64_t tileKey(uint8_t level, uint32_t index) { return (static_cast<uint64_t>(level) << 32) | index; }
+  static uint8_t keyLevel(uint64_t key) { return static_cast<uint8_t>(key >> 32); }
+  static uint32_t keyIndex(uint64_t key) { return static_cast<uint32_t>(key); }
+
+  uint32_t tileIndex(uint8_t level, float latitude, float longitude, int64_t& row, int64_t& column) const;
+  float sample(uint32_t slot, uint8_t level, int64_t row, int64_t column, float latitude, float longitude) const;
+
+  uint32_t find(uint64_t key) const;
+  void insert(uint64_t key, uint32_t slot);
+  void erase(uint64_t key);
+
+  void unlink(uint32_t slot);
+  void pushFront(uint32_t slot);
+  void pushBack(uint32_t slot);
+  void touch(uint32_t slot);
+
+  bool startDecoding(uint64_t key, bool prefetched);
+  void finishDecoding(bool success);
+};
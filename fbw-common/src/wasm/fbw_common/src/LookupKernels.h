@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Lookup table kernels with the table size known at compile time.
+//
+// They are drop-in replacements of the Simulink generated look1_binlxpw() and look2_binlxpw() (binary search, linear
+// interpolation, linear extrapolation) and return bit-identical results for strictly increasing breakpoints, which Simulink
+// requires. The generated model sources are switched over by tools/modelpostprocess/specialize_lookups.py.
+//
+// For small tables the interval is selected without branches by counting the breakpoints at or below the input, larger
+// tables keep the binary search of the generated code.
+//
+// The look*_pbinlxpw() variants additionally remember the interval of the previous call in a caller owned index (kept in
+// the DWork of the model) and only search again when the input left that interval.
+//
+// The value type follows the tables, so the kernels also serve models built with a single precision real_T.
+
+namespace lookup_kernels {
+
+// tables with up to this many intervals use the branch-free interval selection
+constexpr uint32_t UNROLL_MAX_INDEX = 8;
+
+// number of inner breakpoints bp[1] .. bp[maxIndex - 1] that are not above u, a NaN counts all of them like the
+// generated code which extrapolates NaN from the last interval
+template <typename T, std::size_t... Index>
+inline uint32_t countInnerBreakpoints([[maybe_unused]] T u, [[maybe_unused]] const T bp[], std::index_sequence<Index...>) {
+  return (0U + ... + static_cast<uint32_t>(!(u < bp[Index + 1])));
+}
+
+// binary search of the generated code for tables only known at runtime
+template <typename T>
+inline uint32_t searchInterval(T u, const T bp[], uint32_t maxIndex) {
+  if (u <= bp[0U]) {
+    return 0U;
+  }
+  if (!(u < bp[maxIndex])) {
+    return maxIndex - 1U;
+  }
+
+  uint32_t iLeft = 0U;
+  uint32_t iRght = maxIndex;
+  uint32_t bpIdx = maxIndex >> 1U;
+  while (iRght - iLeft > 1U) {
+    if (u < bp[bpIdx]) {
+      iRght = bpIdx;
+    } else {
+      iLeft = bpIdx;
+    }
+
+    bpIdx = (iRght + iLeft) >> 1U;
+  }
+  return iLeft;
+}
+
+// left index of the interval used to inter- or extrapolate u
+template <uint32_t maxIndex, typename T>
+inline uint32_t findInterval(T u, const T bp[]) {
+  static_assert(maxIndex >= 1U, "lookup tables need at least two breakpoints");
+
+  if constexpr (maxIndex <= UNROLL_MAX_INDEX) {
+    return countInnerBreakpoints(u, bp, std::make_index_sequence<maxIndex - 1U>{});
+  } else {
+    return searchInterval(u, bp, maxIndex);
+  }
+}
+
+// same as findInterval() but first checks the interval of the previous call, the outer intervals also cover the
+// extrapolation beyond the first and last breakpoint
+template <uint32_t maxIndex, typename T>
+inline uint32_t findIntervalCached(T u, const T bp[], uint32_t* prevIndex) {
+  uint32_t iLeft = *prevIndex;
+  if (iLeft < maxIndex && (iLeft == 0U || !(u < bp[iLeft])) && (iLeft == maxIndex - 1U || u < bp[iLeft + 1U])) {
+    return iLeft;
+  }
+
+  iLeft = findInterval<maxIndex>(u, bp);
+  *prevIndex = iLeft;
+  return iLeft;
+}
+
+// runtime sized variant of findIntervalCached()
+template <typename T>
+inline uint32_t searchIntervalCached(T u, const T bp[], uint32_t maxIndex, uint32_t* prevIndex) {
+  uint32_t iLeft = *prevIndex;
+  if (iLeft < maxIndex && (iLeft == 0U || !(u < bp[iLeft])) && (iLeft == maxIndex - 1U || u < bp[iLeft + 1U])) {
+    return iLeft;
+  }
+
+  iLeft = searchInterval(u, bp, maxIndex);
+  *prevIndex = iLeft;
+  return iLeft;
+}
+
+template <typename T>
+inline T intervalFraction(T u, const T bp[], uint32_t iLeft) {
+  return (u - bp[iLeft]) / (bp[iLeft + 1U] - bp[iLeft]);
+}
+
+}  // namespace lookup_kernels
+
+// 1-D lookup, the table has maxIndex + 1 breakpoints
+template <uint32_t maxIndex, typename T>
+inline T look1_binlxpw(std::type_identity_t<T> u0, const T bp0[], const T table[]) {
+  uint32_t iLeft = lookup_kernels::findInterval<maxIndex>(u0, bp0);
+  T frac = lookup_kernels::intervalFraction(u0, bp0, iLeft);
+  T yL_0d0 = table[iLeft];
+  return (table[iLeft + 1U] - yL_0d0) * frac + yL_0d0;
+}
+
+// 1-D lookup starting at the interval of the previous call
+template <uint32_t maxIndex, typename T>
+inline T look1_pbinlxpw(std::type_identity_t<T> u0, const T bp0[], const T table[], uint32_t prevIndex[]) {
+  uint32_t iLeft = lookup_kernels::findIntervalCached<maxIndex>(u0, bp0, prevIndex);
+  T frac = lookup_kernels::intervalFraction(u0, bp0, iLeft);
+  T yL_0d0 = table[iLeft];
+  return (table[iLeft + 1U] - yL_0d0) * frac + yL_0d0;
+}
+
+namespace lookup_kernels {
+
+template <typename T>
+inline T interpolate2(const T table[], uint32_t stride, uint32_t iLeft0, T frac0, uint32_t iLeft1, T frac1) {
+  uint32_t bpIdx = iLeft1 * stride + iLeft0;
+  T yL_0d0 = table[bpIdx];
+  yL_0d0 += (table[bpIdx + 1U] - yL_0d0) * frac0;
+  bpIdx += stride;
+  T yL_0d1 = table[bpIdx];
+  return (((table[bpIdx + 1U] - yL_0d1) * frac0 + yL_0d1) - yL_0d0) * frac1 + yL_0d0;
+}
+
+}  // namespace lookup_kernels
+
+// 2-D lookup, the first dimension has stride breakpoints, the size of the second one is given by maxIndex[1]
+template <uint32_t stride, typename T>
+inline T look2_binlxpw(std::type_identity_t<T> u0,
+                       std::type_identity_t<T> u1,
+                       const T bp0[],
+                       const T bp1[],
+                       const T table[],
+                       const uint32_t maxIndex[]) {
+  uint32_t iLeft0 = lookup_kernels::findInterval<stride - 1U>(u0, bp0);
+  uint32_t iLeft1 = lookup_kernels::searchInterval(u1, bp1, maxIndex[1U]);
+  return lookup_kernels::interpolate2(table, stride, iLeft0, lookup_kernels::intervalFraction(u0, bp0, iLeft0), iLeft1,
+                                      lookup_kernels::intervalFraction(u1, bp1, iLeft1));
+}
+
+// 2-D lookup starting at the intervals of the previous call, prevIndex holds one index per dimension
+template <uint32_t stride, typename T>
+inline T look2_pbinlxpw(std::type_identity_t<T> u0,
+                        std::type_identity_t<T> u1,
+                        const T bp0[],
+                        const T bp1[],
+                        const T table[],
+                        uint32_t prevIndex[],
+                        const uint32_t maxIndex[]) {
+  uint32_t iLeft0 = lookup_kernels::findIntervalCached<stride - 1U>(u0, bp0, &prevIndex[0U]);
+  uint32_t iLeft1 = lookup_kernels::searchIntervalCached(u1, bp1, maxIndex[1U], &prevIndex[1U]);
+  return lookup_kernels::interpolate2(table, stride, iLeft0, lookup_kernels::intervalFraction(u0, bp0, iLeft0), iLeft1,
+                                      lookup_kernels::intervalFraction(u1, bp1, iLeft1));
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Binary snapshots of the Simulink model states.
+//
+// The generated models keep their whole state in plain structs (inputs, outputs, block I/O and DWork) without any pointers,
+// so a snapshot is the raw bytes of these structs written one after another. The layout is only valid for the build that
+// wrote it, the snapshot()/restore() methods of the models are added by tools/modelpostprocess/add_snapshots.py.
+
+class ModelSnapshotWriter {
+ public:
+  explicit ModelSnapshotWriter(std::vector<uint8_t>& buffer) : buffer(buffer) {}
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable state can be written");
+    size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+  }
+
+ private:
+  std::vector<uint8_t>& buffer;
+};
+
+class ModelSnapshotReader {
+ public:
+  ModelSnapshotReader(const uint8_t* data, size_t size) : data(data), size(size) {}
+
+  template <typename T>
+  bool read(T& value) {
+    // const members would be overwritten as well, such state has to be restored through its accessors
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_copy_assignable<T>::value,
+                  "only trivially copyable and assignable state can be read");
+    if (size - offset < sizeof(T)) {
+      offset = size;
+      return false;
+    }
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+
+  bool atEnd() const { return offset == size; }
+
+ private:
+  const uint8_t* data;
+  size_t size;
+  size_t offset = 0;
+};
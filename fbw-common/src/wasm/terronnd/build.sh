@@ -2,6 +2,7 @@
 
 # get directory of this script relative to root
 DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+COMMON_DIR="${DIR}/.."
 
 OUTPUT="${DIR}/out/terronnd.wasm"
 
@@ -17,6 +18,34 @@ set -ex
 mkdir -p "${DIR}/obj"
 pushd "${DIR}/obj"
 
+# compile c code, the elevation tile cache only inflates
+clang \
+  -c \
+  ${CLANG_ARGS} \
+  -Wno-unused-command-line-argument \
+  -Wno-implicit-function-declaration \
+  -Wno-deprecated-non-prototype \
+  --sysroot "${MSFS_SDK}/WASM/wasi-sysroot" \
+  -target wasm32-unknown-wasi \
+  -D_MSFS_WASM=1 \
+  -D__wasi__ \
+  -D_LIBCPP_HAS_NO_THREADS \
+  -D_WINDLL \
+  -D_MBCS \
+  -mthread-model single \
+  -fno-exceptions \
+  -fms-extensions \
+  -fvisibility=hidden \
+  -O2 \
+  -I "${MSFS_SDK}/WASM/include" \
+  -I "${COMMON_DIR}/fbw_common/src/zlib" \
+  "${COMMON_DIR}/fbw_common/src/zlib/adler32.c" \
+  "${COMMON_DIR}/fbw_common/src/zlib/crc32.c" \
+  "${COMMON_DIR}/fbw_common/src/zlib/inffast.c" \
+  "${COMMON_DIR}/fbw_common/src/zlib/inflate.c" \
+  "${COMMON_DIR}/fbw_common/src/zlib/inftrees.c" \
+  "${COMMON_DIR}/fbw_common/src/zlib/zutil.c"
+
 # compile c++ code
 clang++ \
   -c \
@@ -50,11 +79,16 @@ clang++ \
   -O2 \
   -I "${MSFS_SDK}/WASM/include" \
   -I "${MSFS_SDK}/SimConnect SDK/include" \
+  -I "${COMMON_DIR}/fbw_common/src" \
+  "${COMMON_DIR}/fbw_common/src/ElevationTileCache.cpp" \
   "${DIR}/src/main.cpp" \
   "${DIR}/src/nanovg/nanovg.cpp" \
   "${DIR}/src/navigationdisplay/collection.cpp" \
   "${DIR}/src/navigationdisplay/displaybase.cpp" \
+  "${DIR}/src/navigationdisplay/framebuffer.cpp" \
+  "${DIR}/src/navigationdisplay/framecache.cpp" \
   "${DIR}/src/simconnect/connection.cpp" \
+  "${DIR}/src/terrain/renderer.cpp" \
 
 # restore directory
 popd
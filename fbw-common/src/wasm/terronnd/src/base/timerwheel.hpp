@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace base {
+
+/**
+ * @brief Hashed timer wheel that schedules elements with a resolution of ticks
+ *
+ * An element is stored in the slot of its deadline modulo the number of slots, advancing the wheel only visits the slots
+ * of the passed ticks. Elements with a deadline beyond one revolution stay in their slot until their round is reached.
+ * The slots keep their memory, so rescheduling does not allocate once every slot has seen its largest number of elements.
+ *
+ * @tparam T The type of the scheduled elements
+ * @tparam Slots The number of slots of one revolution
+ */
+template <typename T, std::size_t Slots>
+class TimerWheel {
+ private:
+  struct Timer {
+    std::uint64_t deadline;
+    T element;
+  };
+
+  std::array<std::vector<Timer>, Slots> _slots;
+  std::vector<T> _expired;
+  std::uint64_t _currentTick;
+
+ public:
+  TimerWheel() : _slots(), _expired(), _currentTick(0) {}
+  TimerWheel(const TimerWheel<T, Slots>&) = delete;
+
+  TimerWheel<T, Slots>& operator=(const TimerWheel<T, Slots>&) = delete;
+
+  /**
+   * @brief Schedules an element
+   * @param element The element that expires
+   * @param delay The number of ticks from the current tick, at least one
+   */
+  void schedule(T element, std::uint64_t delay) {
+    const std::uint64_t deadline = this->_currentTick + (delay != 0 ? delay : 1);
+    this->_slots[deadline % Slots].push_back({deadline, element});
+  }
+
+  /**
+   * @brief Advances the wheel to the tick and calls the callback for every expired element
+   * The callback may schedule the element again.
+   * @param tick The new current tick, a tick in the past does not advance the wheel
+   * @param callback The function that is called with the expired elements
+   */
+  template <typename Callback>
+  void advance(std::uint64_t tick, Callback&& callback) {
+    if (tick <= this->_currentTick) {
+      return;
+    }
+
+    // one revolution visits every slot, a larger step does not need to visit them again
+    const std::uint64_t passedTicks = tick - this->_currentTick;
+    const std::uint64_t visitedTicks = passedTicks < Slots ? passedTicks : Slots;
+    for (std::uint64_t i = 1; i <= visitedTicks; ++i) {
+      auto& slot = this->_slots[(this->_currentTick + i) % Slots];
+      for (std::size_t entry = 0; entry < slot.size();) {
+        if (slot[entry].deadline <= tick) {
+          this->_expired.push_back(slot[entry].element);
+          slot[entry] = slot.back();
+          slot.pop_back();
+        } else {
+          ++entry;
+        }
+      }
+    }
+
+    this->_currentTick = tick;
+    for (const auto& element : this->_expired) {
+      callback(element);
+    }
+    this->_expired.clear();
+  }
+
+  /**
+   * @brief Removes all elements, the current tick is kept
+   */
+  void clear() {
+    for (auto& slot : this->_slots) {
+      slot.clear();
+    }
+  }
+
+  /**
+   * @brief Returns the tick of the last advance
+   */
+  std::uint64_t currentTick() const { return this->_currentTick; }
+};
+
+}  // namespace base
@@ -37,11 +37,11 @@ MSFS_CALLBACK bool terronnd_gauge_callback(FsContext ctx, int service_id, void*
     case PANEL_SERVICE_POST_INSTALL:
       break;
     case PANEL_SERVICE_PRE_DRAW:
-      if (!connection.readData()) {
+      if (!connection.readData(ctx)) {
         return false;
       }
 
-      displays->updateDisplay(ctx);
+      displays->updateDisplay(ctx, connection.frameTime());
       displays->renderDisplay((sGaugeDrawData*)pData, ctx);
       break;
     case PANEL_SERVICE_PRE_KILL: {
@@ -1,3 +1,6 @@
+#include <cmath>
+#include <cstdlib>
+
 #include "collection.h"
 
 using namespace navigationdisplay;
@@ -9,17 +12,41 @@ Collection::Collection(simconnect::Connection& connection)
       _configurationLeft(),
       _configurationRight(),
       _lastAircraftStatusTransmission(),
+      _publishedAircraftStatus(),
+      _aircraftStatusStatistics(),
+      _aircraftStatusPublished(false),
       _sendAircraftStatus(false),
       _reconfigureDisplayLeft(false),
       _reconfigureDisplayRight(false),
+      _elevationCache(ElevationCacheBudget),
+      _trackEstimate(),
+      _renderer(LocalFrameWidth, LocalFrameHeight, LocalFrameGridStep),
+      _frameCache(std::make_shared<FrameCache>()),
+      _localFrame(),
+      _lastLocalFrameLeft(),
+      _lastLocalFrameRight(),
       _simulatorData(nullptr),
       _aircraftStatus(nullptr),
       _ndConfiguration(nullptr),
+      _simconnectProtocol(nullptr),
       _simconnectAircraftStatus(nullptr) {
+  // the SimBridge reads the protocol of the gauge before it sends the first frame
+  this->_simconnectProtocol = connection.clientDataArea<types::ProtocolData>();
+  this->_simconnectProtocol->defineArea(ProtocolName);
+  this->_simconnectProtocol->allocateArea(true);
+  this->_simconnectProtocol->data().version = ProtocolVersion;
+  this->_simconnectProtocol->data().capabilities = (1 << types::FrameFormat::COMPRESSED_IMAGE) |
+                                                   (1 << types::FrameFormat::PALETTE_RLE) | (1 << types::FrameFormat::TILE_DELTA);
+  this->_simconnectProtocol->setArea();
+
   this->_simconnectAircraftStatus = connection.clientDataArea<types::AircraftStatusData>();
   this->_simconnectAircraftStatus->defineArea("FBW_SIMBRIDGE_EGPWC_AIRCRAFT_STATUS");
   this->_simconnectAircraftStatus->allocateArea(true);
 
+  if (!this->_elevationCache.open(ElevationFilePath)) {
+    std::cout << "TERR ON ND: No local elevation file, the SimBridge renders the terrain" << std::endl;
+  }
+
   this->_aircraftStatus =
       connection.lvarObject<EgpwcDestinationLat, EgpwcDestinationLong, EgpwcPresentLat, EgpwcPresentLong, EgpwcTerrOnNdRenderingMode,
                             EgpwcAltitude, EgpwcHeading, EgpwcVerticalSpeed, EgpwcGearIsDown>();
@@ -91,10 +118,10 @@ Collection::~Collection() {
 
 void Collection::registerDisplay(DisplaySide side, FsContext context, simconnect::Connection& connection) {
   if (side == DisplaySide::Left) {
-    this->_displays.insert({context, std::shared_ptr<DisplayBase>(new DisplayLeft(connection, context))});
+    this->_displays.insert({context, std::shared_ptr<DisplayBase>(new DisplayLeft(connection, context, this->_frameCache))});
     std::cout << "TERR ON ND: Created left display" << std::endl;
   } else {
-    this->_displays.insert({context, std::shared_ptr<DisplayBase>(new DisplayRight(connection, context))});
+    this->_displays.insert({context, std::shared_ptr<DisplayBase>(new DisplayRight(connection, context, this->_frameCache))});
     std::cout << "TERR ON ND: Created right display" << std::endl;
   }
 }
@@ -104,62 +131,119 @@ void Collection::destroy() {
     display.second->destroy();
   }
   this->_displays.clear();
+  this->_localFrame.buffer.reset();
+  this->_localFrame.rendering = false;
 }
 
-void Collection::updateDisplay(FsContext context) {
-  const auto now = std::chrono::system_clock::now();
-  const auto dt =
-      static_cast<float>(std::chrono::duration_cast<std::chrono::milliseconds>(now - this->_lastAircraftStatusTransmission).count()) *
-      types::millisecond;
-
-  if (this->_sendAircraftStatus && dt >= 100 * types::millisecond) {
-    this->_simconnectAircraftStatus->data().adiruValid = this->_egpwcData.presentLatitude.isNo() &&
-                                                         this->_egpwcData.presentLongitude.isNo() && this->_egpwcData.altitude.isNo() &&
-                                                         this->_egpwcData.heading.isNo() && this->_egpwcData.verticalSpeed.isNo();
-    this->_simconnectAircraftStatus->data().latitude = this->_egpwcData.presentLatitude.value().convert(types::degree);
-    this->_simconnectAircraftStatus->data().longitude = this->_egpwcData.presentLongitude.value().convert(types::degree);
-    this->_simconnectAircraftStatus->data().altitude = static_cast<std::int32_t>(this->_egpwcData.altitude.value().convert(types::feet));
-    this->_simconnectAircraftStatus->data().heading = static_cast<std::int16_t>(this->_egpwcData.heading.value().convert(types::degree));
-    this->_simconnectAircraftStatus->data().verticalSpeed =
-        static_cast<std::int16_t>(this->_egpwcData.verticalSpeed.value().convert(types::ftpmin));
-    this->_simconnectAircraftStatus->data().gearIsDown = static_cast<std::uint8_t>(this->_egpwcData.gearIsDown);
-
-    this->_simconnectAircraftStatus->data().destinationValid =
-        this->_egpwcData.destinationLatitude.isNo() && this->_egpwcData.destinationLongitude.isNo();
-    this->_simconnectAircraftStatus->data().destinationLatitude = this->_egpwcData.destinationLatitude.value().convert(types::degree);
-    this->_simconnectAircraftStatus->data().destinationLongitude = this->_egpwcData.destinationLongitude.value().convert(types::degree);
-
-    bool arcMode = this->_configurationLeft.mode == NavigationDisplayArcModeId;
-    bool terrainMapMode = this->_configurationLeft.mode == NavigationDisplayRoseLsModeId ||
-                          this->_configurationLeft.mode == NavigationDisplayRoseVorModeId ||
-                          this->_configurationLeft.mode == NavigationDisplayRoseNavModeId || arcMode;
-    this->_simconnectAircraftStatus->data().ndRangeCapt =
-        static_cast<std::uint16_t>(this->_configurationLeft.range.convert(types::nauticmile));
-    this->_simconnectAircraftStatus->data().ndArcModeCapt = this->_configurationLeft.mode == NavigationDisplayArcModeId;
-    this->_simconnectAircraftStatus->data().ndTerrainOnNdActiveCapt =
-        static_cast<std::uint8_t>(this->_configurationLeft.terrainActive && terrainMapMode);
-    this->_simconnectAircraftStatus->data().efisModeCapt = this->_configurationLeft.mode;
-
-    arcMode = this->_configurationRight.mode == NavigationDisplayArcModeId;
-    terrainMapMode = this->_configurationRight.mode == NavigationDisplayRoseLsModeId ||
-                     this->_configurationRight.mode == NavigationDisplayRoseVorModeId ||
-                     this->_configurationRight.mode == NavigationDisplayRoseNavModeId || arcMode;
-    this->_simconnectAircraftStatus->data().ndRangeFO =
-        static_cast<std::uint16_t>(this->_configurationRight.range.convert(types::nauticmile));
-    this->_simconnectAircraftStatus->data().ndArcModeFO = this->_configurationRight.mode == NavigationDisplayArcModeId;
-    this->_simconnectAircraftStatus->data().ndTerrainOnNdActiveFO =
-        static_cast<std::uint8_t>(this->_configurationRight.terrainActive && terrainMapMode);
-    this->_simconnectAircraftStatus->data().efisModeFO = this->_configurationRight.mode;
-
-    this->_simconnectAircraftStatus->data().ndTerrainOnNdRenderingMode = this->_egpwcData.terrOnNdRenderingMode;
-    this->_simconnectAircraftStatus->data().groundTruthLatitude = this->_groundTruth.latitude.convert(types::degree);
-    this->_simconnectAircraftStatus->data().groundTruthLongitude = this->_groundTruth.longitude.convert(types::degree);
-
-    this->_simconnectAircraftStatus->setArea();
-    this->_lastAircraftStatusTransmission = now;
-    this->_sendAircraftStatus = false;
+void Collection::publishAircraftStatus(std::chrono::steady_clock::time_point now) {
+  if (!this->_sendAircraftStatus) {
+    return;
+  }
+  this->_aircraftStatusStatistics.updates += 1;
+
+  this->_simconnectAircraftStatus->data().adiruValid = this->_egpwcData.presentLatitude.isNo() &&
+                                                       this->_egpwcData.presentLongitude.isNo() && this->_egpwcData.altitude.isNo() &&
+                                                       this->_egpwcData.heading.isNo() && this->_egpwcData.verticalSpeed.isNo();
+  this->_simconnectAircraftStatus->data().latitude = this->_egpwcData.presentLatitude.value().convert(types::degree);
+  this->_simconnectAircraftStatus->data().longitude = this->_egpwcData.presentLongitude.value().convert(types::degree);
+  this->_simconnectAircraftStatus->data().altitude = static_cast<std::int32_t>(this->_egpwcData.altitude.value().convert(types::feet));
+  this->_simconnectAircraftStatus->data().heading = static_cast<std::int16_t>(this->_egpwcData.heading.value().convert(types::degree));
+  this->_simconnectAircraftStatus->data().verticalSpeed =
+      static_cast<std::int16_t>(this->_egpwcData.verticalSpeed.value().convert(types::ftpmin));
+  this->_simconnectAircraftStatus->data().gearIsDown = static_cast<std::uint8_t>(this->_egpwcData.gearIsDown);
+
+  this->_simconnectAircraftStatus->data().destinationValid =
+      this->_egpwcData.destinationLatitude.isNo() && this->_egpwcData.destinationLongitude.isNo();
+  this->_simconnectAircraftStatus->data().destinationLatitude = this->_egpwcData.destinationLatitude.value().convert(types::degree);
+  this->_simconnectAircraftStatus->data().destinationLongitude = this->_egpwcData.destinationLongitude.value().convert(types::degree);
+
+  bool arcMode = this->_configurationLeft.mode == NavigationDisplayArcModeId;
+  bool terrainMapMode = this->_configurationLeft.mode == NavigationDisplayRoseLsModeId ||
+                        this->_configurationLeft.mode == NavigationDisplayRoseVorModeId ||
+                        this->_configurationLeft.mode == NavigationDisplayRoseNavModeId || arcMode;
+  this->_simconnectAircraftStatus->data().ndRangeCapt =
+      static_cast<std::uint16_t>(this->_configurationLeft.range.convert(types::nauticmile));
+  this->_simconnectAircraftStatus->data().ndArcModeCapt = this->_configurationLeft.mode == NavigationDisplayArcModeId;
+  this->_simconnectAircraftStatus->data().ndTerrainOnNdActiveCapt =
+      static_cast<std::uint8_t>(this->_configurationLeft.terrainActive && terrainMapMode && !this->_elevationCache.isOpen());
+  this->_simconnectAircraftStatus->data().efisModeCapt = this->_configurationLeft.mode;
+
+  arcMode = this->_configurationRight.mode == NavigationDisplayArcModeId;
+  terrainMapMode = this->_configurationRight.mode == NavigationDisplayRoseLsModeId ||
+                   this->_configurationRight.mode == NavigationDisplayRoseVorModeId ||
+                   this->_configurationRight.mode == NavigationDisplayRoseNavModeId || arcMode;
+  this->_simconnectAircraftStatus->data().ndRangeFO =
+      static_cast<std::uint16_t>(this->_configurationRight.range.convert(types::nauticmile));
+  this->_simconnectAircraftStatus->data().ndArcModeFO = this->_configurationRight.mode == NavigationDisplayArcModeId;
+  this->_simconnectAircraftStatus->data().ndTerrainOnNdActiveFO =
+      static_cast<std::uint8_t>(this->_configurationRight.terrainActive && terrainMapMode && !this->_elevationCache.isOpen());
+  this->_simconnectAircraftStatus->data().efisModeFO = this->_configurationRight.mode;
+
+  this->_simconnectAircraftStatus->data().ndTerrainOnNdRenderingMode = this->_egpwcData.terrOnNdRenderingMode;
+  this->_simconnectAircraftStatus->data().groundTruthLatitude = this->_groundTruth.latitude.convert(types::degree);
+  this->_simconnectAircraftStatus->data().groundTruthLongitude = this->_groundTruth.longitude.convert(types::degree);
+
+  const auto& status = this->_simconnectAircraftStatus->data();
+  const auto& published = this->_publishedAircraftStatus;
+  const bool configurationChanged =
+      !this->_aircraftStatusPublished || status.adiruValid != published.adiruValid || status.gearIsDown != published.gearIsDown ||
+      status.destinationValid != published.destinationValid || status.destinationLatitude != published.destinationLatitude ||
+      status.destinationLongitude != published.destinationLongitude || status.ndRangeCapt != published.ndRangeCapt ||
+      status.ndArcModeCapt != published.ndArcModeCapt || status.ndTerrainOnNdActiveCapt != published.ndTerrainOnNdActiveCapt ||
+      status.efisModeCapt != published.efisModeCapt || status.ndRangeFO != published.ndRangeFO ||
+      status.ndArcModeFO != published.ndArcModeFO || status.ndTerrainOnNdActiveFO != published.ndTerrainOnNdActiveFO ||
+      status.efisModeFO != published.efisModeFO || status.ndTerrainOnNdRenderingMode != published.ndTerrainOnNdRenderingMode;
+
+  if (!configurationChanged) {
+    // the SimBridge renders only the displays with an active terrain, the smallest range has the smallest pixels
+    float range = 0.0f;
+    if (status.ndTerrainOnNdActiveCapt != 0) {
+      range = static_cast<float>(status.ndRangeCapt);
+    }
+    if (status.ndTerrainOnNdActiveFO != 0 && (range == 0.0f || status.ndRangeFO < range)) {
+      range = static_cast<float>(status.ndRangeFO);
+    }
+    const float pixel = range / AircraftStatusRangePixels;
+
+    const auto offPixel = [pixel](float latitude, float longitude, float publishedLatitude, float publishedLongitude) {
+      const float north = (latitude - publishedLatitude) * 60.0f;
+      const float east = (longitude - publishedLongitude) * 60.0f * std::cos(latitude * 3.14159265f / 180.0f);
+      return north * north + east * east >= pixel * pixel;
+    };
+    // one degree of heading turns the edge of the picture by more than one pixel for every range
+    const bool moved = range != 0.0f && (offPixel(status.latitude, status.longitude, published.latitude, published.longitude) ||
+                                         offPixel(status.groundTruthLatitude, status.groundTruthLongitude, published.groundTruthLatitude,
+                                                  published.groundTruthLongitude) ||
+                                         status.heading != published.heading ||
+                                         std::abs(status.altitude - published.altitude) >= AircraftStatusAltitudeStepFeet);
+    if (!moved) {
+      this->_aircraftStatusStatistics.skippedUpdates += 1;
+      this->_sendAircraftStatus = false;
+      return;
+    }
+
+    if (std::chrono::duration_cast<std::chrono::milliseconds>(now - this->_lastAircraftStatusTransmission).count() <
+        AircraftStatusMinIntervalMs) {
+      this->_aircraftStatusStatistics.deferredUpdates += 1;
+      return;
+    }
+    this->_aircraftStatusStatistics.motionTransmissions += 1;
+  } else {
+    this->_aircraftStatusStatistics.configurationTransmissions += 1;
   }
 
+  this->_simconnectAircraftStatus->setArea();
+  this->_publishedAircraftStatus = status;
+  this->_aircraftStatusPublished = true;
+  this->_lastAircraftStatusTransmission = now;
+  this->_sendAircraftStatus = false;
+}
+
+void Collection::updateDisplay(FsContext context, std::chrono::steady_clock::time_point now) {
+  this->publishAircraftStatus(now);
+  this->prefetchElevations(now);
+  this->_elevationCache.update(ElevationDecodeBytesPerFrame);
+
   // update the display
   const auto displayIterator = this->_displays.find(context);
   if (displayIterator != this->_displays.cend()) {
@@ -169,13 +253,19 @@ void Collection::updateDisplay(FsContext context) {
       case DisplaySide::Left:
         if (this->_reconfigureDisplayLeft) {
           display->update(this->_configurationLeft);
+          this->renderLocalFrame(*display, this->_configurationLeft, this->_lastLocalFrameLeft, true, now);
           this->_reconfigureDisplayLeft = false;
+        } else {
+          this->renderLocalFrame(*display, this->_configurationLeft, this->_lastLocalFrameLeft, false, now);
         }
         break;
       case DisplaySide::Right:
         if (this->_reconfigureDisplayRight) {
           display->update(this->_configurationRight);
+          this->renderLocalFrame(*display, this->_configurationRight, this->_lastLocalFrameRight, true, now);
           this->_reconfigureDisplayRight = false;
+        } else {
+          this->renderLocalFrame(*display, this->_configurationRight, this->_lastLocalFrameRight, false, now);
         }
         break;
       default:
@@ -184,6 +274,109 @@ void Collection::updateDisplay(FsContext context) {
   }
 }
 
+void Collection::renderLocalFrame(DisplayBase& display,
+                                  const DisplayBase::NdConfiguration& configuration,
+                                  std::chrono::steady_clock::time_point& lastFrame,
+                                  bool forced,
+                                  std::chrono::steady_clock::time_point now) {
+  const bool arcMode = configuration.mode == NavigationDisplayArcModeId;
+  const bool terrainMapMode = configuration.mode == NavigationDisplayRoseLsModeId || configuration.mode == NavigationDisplayRoseVorModeId ||
+                              configuration.mode == NavigationDisplayRoseNavModeId || arcMode;
+  const bool positionValid = this->_egpwcData.presentLatitude.isNo() && this->_egpwcData.presentLongitude.isNo() &&
+                             this->_egpwcData.altitude.isNo() && this->_egpwcData.heading.isNo();
+  const bool active = this->_elevationCache.isOpen() && configuration.terrainActive && terrainMapMode && positionValid;
+  const auto range = static_cast<std::uint16_t>(configuration.range.convert(types::nauticmile));
+
+  // the picture of an outdated configuration of the display must not block the other display
+  if (this->_localFrame.rendering && this->_localFrame.renderingSide == display.side() &&
+      (!active || forced || this->_localFrame.renderingRange != range || this->_localFrame.renderingMode != configuration.mode)) {
+    this->_localFrame.rendering = false;
+  }
+  if (!active) {
+    return;
+  }
+
+  // a forced picture stays due until the renderer is free for it
+  if (forced) {
+    lastFrame = now - std::chrono::milliseconds(LocalFrameIntervalMs);
+  }
+  const bool due = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastFrame).count() >= LocalFrameIntervalMs;
+  const auto age = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->_localFrame.timestamp).count();
+  const bool shared = this->_localFrame.buffer != nullptr && this->_localFrame.key.range == range &&
+                      this->_localFrame.key.mode == configuration.mode && age < LocalFrameIntervalMs;
+
+  if (due && shared) {
+    display.showRenderedFrame(this->_localFrame.buffer, this->_localFrame.thresholds);
+    lastFrame = now;
+    return;
+  }
+
+  if (due && !this->_localFrame.rendering) {
+    terrain::Renderer::Request request;
+    request.latitude = this->_egpwcData.presentLatitude.value().convert(types::degree);
+    request.longitude = this->_egpwcData.presentLongitude.value().convert(types::degree);
+    request.altitude = this->_egpwcData.altitude.value().convert(types::feet);
+    request.heading = this->_egpwcData.heading.value().convert(types::degree);
+    request.range = configuration.range.convert(types::nauticmile);
+    request.arcMode = arcMode;
+    request.gearDown = this->_egpwcData.gearIsDown;
+
+    this->_renderer.begin(request);
+    this->_localFrame.rendering = true;
+    this->_localFrame.renderingSide = display.side();
+    this->_localFrame.renderingRange = range;
+    this->_localFrame.renderingMode = configuration.mode;
+  }
+  if (!this->_localFrame.rendering || this->_localFrame.renderingSide != display.side() ||
+      !this->_renderer.advance(this->_elevationCache, LocalFrameGridRowsPerFrame)) {
+    return;
+  }
+
+  // the last picture returns to the pool unless a display still shows it
+  this->_localFrame.buffer.reset();
+  this->_localFrame.key = {range, configuration.mode, this->_localFrame.key.frameId + 1};
+  this->_localFrame.buffer =
+      this->_frameCache->expandIndices(this->_localFrame.key, this->_renderer.indices().data(), this->_renderer.width(),
+                                       this->_renderer.height(), terrain::Renderer::palette(), terrain::Renderer::PaletteSize);
+  this->_localFrame.thresholds = this->_renderer.thresholds();
+  this->_localFrame.timestamp = now;
+  this->_localFrame.rendering = false;
+
+  display.showRenderedFrame(this->_localFrame.buffer, this->_localFrame.thresholds);
+  lastFrame = now;
+}
+
+void Collection::prefetchElevations(std::chrono::steady_clock::time_point now) {
+  if (!this->_elevationCache.isOpen() || !this->_egpwcData.presentLatitude.isNo() || !this->_egpwcData.presentLongitude.isNo()) {
+    this->_trackEstimate.valid = false;
+    return;
+  }
+
+  const float latitude = this->_egpwcData.presentLatitude.value().convert(types::degree);
+  const float longitude = this->_egpwcData.presentLongitude.value().convert(types::degree);
+  const auto dt = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->_trackEstimate.timestamp).count();
+  if (this->_trackEstimate.valid && dt < ElevationPrefetchIntervalMs) {
+    return;
+  }
+
+  if (this->_trackEstimate.valid) {
+    const float north = (latitude - this->_trackEstimate.latitude) * 60.0f;
+    const float east = (longitude - this->_trackEstimate.longitude) * 60.0f * std::cos(latitude * 3.14159265f / 180.0f);
+    const float groundSpeed = std::sqrt(north * north + east * east) * 3600000.0f / static_cast<float>(dt);
+    const float track = std::atan2(east, north) * 180.0f / 3.14159265f;
+
+    for (const auto* configuration : {&this->_configurationLeft, &this->_configurationRight}) {
+      if (configuration->terrainActive) {
+        const float range = configuration->range.convert(types::nauticmile);
+        this->_elevationCache.prefetch(this->_renderer.level(this->_elevationCache, range), latitude, longitude, track, groundSpeed,
+                                       ElevationPrefetchLookaheadSeconds, range);
+      }
+    }
+  }
+
+  this->_trackEstimate = {latitude, longitude, now, true};
+}
+
 void Collection::renderDisplay(sGaugeDrawData* pDraw, FsContext context) {
   // render the display
   const auto displayIterator = this->_displays.find(context);
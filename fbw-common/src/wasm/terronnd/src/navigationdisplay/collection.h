@@ -4,13 +4,17 @@
 #pragma clang diagnostic ignored "-Wunused-function"
 #include <MSFS/MSFS_Core.h>
 #pragma clang diagnostic pop
+#include <chrono>
 #include <map>
 #include <memory>
 
 #include "../simconnect/connection.hpp"
+#include "../terrain/renderer.h"
+#include "ElevationTileCache.h"
 #include "../types/quantity.hpp"
 #include "configuration.h"
 #include "display.h"
+#include "framecache.h"
 
 namespace navigationdisplay {
 
@@ -18,6 +22,18 @@ namespace navigationdisplay {
  * @brief A collection of all available ND displays to manage terrain on ND visualizations
  */
 class Collection {
+ public:
+  struct AircraftStatusStatistics {
+    // the frames with a changed aircraft status
+    std::uint64_t updates = 0;
+    std::uint64_t configurationTransmissions = 0;
+    std::uint64_t motionTransmissions = 0;
+    // the changes that moved the picture by less than one pixel
+    std::uint64_t skippedUpdates = 0;
+    // the changes that waited for the minimum interval
+    std::uint64_t deferredUpdates = 0;
+  };
+
  private:
   struct EgpwcData {
     types::Arinc429Word<types::Angle> destinationLatitude;
@@ -36,15 +52,44 @@ class Collection {
     types::Angle longitude;
   };
 
+  struct LocalFrame {
+    FrameCache::Key key;
+    std::shared_ptr<FrameBuffer> buffer;
+    terrain::Renderer::Thresholds thresholds;
+    std::chrono::steady_clock::time_point timestamp;
+    // the picture that the renderer draws in bands for the display of the side
+    bool rendering;
+    DisplaySide renderingSide;
+    std::uint16_t renderingRange;
+    std::uint8_t renderingMode;
+  };
+
+  struct TrackEstimate {
+    float latitude;
+    float longitude;
+    std::chrono::steady_clock::time_point timestamp;
+    bool valid;
+  };
+
   std::map<FsContext, std::shared_ptr<DisplayBase>> _displays;
   GroundTruthPosition _groundTruth;
   EgpwcData _egpwcData;
   DisplayBase::NdConfiguration _configurationLeft;
   DisplayBase::NdConfiguration _configurationRight;
-  std::chrono::system_clock::time_point _lastAircraftStatusTransmission;
+  std::chrono::steady_clock::time_point _lastAircraftStatusTransmission;
+  types::AircraftStatusData _publishedAircraftStatus;
+  AircraftStatusStatistics _aircraftStatusStatistics;
+  bool _aircraftStatusPublished;
   bool _sendAircraftStatus;
   bool _reconfigureDisplayLeft;
   bool _reconfigureDisplayRight;
+  ElevationTileCache _elevationCache;
+  TrackEstimate _trackEstimate;
+  terrain::Renderer _renderer;
+  std::shared_ptr<FrameCache> _frameCache;
+  LocalFrame _localFrame;
+  std::chrono::steady_clock::time_point _lastLocalFrameLeft;
+  std::chrono::steady_clock::time_point _lastLocalFrameRight;
 
   // inputs
   std::shared_ptr<simconnect::SimObject<types::SimulatorData>> _simulatorData;
@@ -69,8 +114,40 @@ class Collection {
       _ndConfiguration;
 
   // outputs
+  std::shared_ptr<simconnect::ClientDataArea<types::ProtocolData>> _simconnectProtocol;
   std::shared_ptr<simconnect::ClientDataArea<types::AircraftStatusData>> _simconnectAircraftStatus;
 
+  /**
+   * @brief Sends the aircraft status to the SimBridge if its picture changes
+   * Configuration changes are sent directly. The position, heading and altitude are sent once the picture of the smallest
+   * range that the SimBridge renders is off by one pixel, at most once per interval. The rate follows the ground speed and
+   * the range, nothing is sent while the aircraft does not move.
+   * @param now The time of the frame
+   */
+  void publishAircraftStatus(std::chrono::steady_clock::time_point now);
+  /**
+   * @brief Renders the picture of a display with the local elevation file
+   * The last picture is shown instead if it has the range and mode of the display and is younger than the interval,
+   * so both displays share one picture per interval if they use the same range and mode. The renderer draws one picture
+   * at a time in bands of grid rows per frame, the display keeps its last picture until the new one is complete.
+   * @param display The display that shows the picture
+   * @param configuration The ND configuration of the display
+   * @param lastFrame The time of the last picture of the display
+   * @param forced Renders the picture even if the interval did not pass since the last picture
+   * @param now The current time
+   */
+  void renderLocalFrame(DisplayBase& display,
+                        const DisplayBase::NdConfiguration& configuration,
+                        std::chrono::steady_clock::time_point& lastFrame,
+                        bool forced,
+                        std::chrono::steady_clock::time_point now);
+  /**
+   * @brief Queues the elevation tiles along the flight path of the aircraft for the ranges of both displays
+   * The track and the ground speed are derived from the present positions of the aircraft status
+   * @param now The current time
+   */
+  void prefetchElevations(std::chrono::steady_clock::time_point now);
+
  public:
   /**
    * @brief Construct a new Collection object and initializes the communication objects
@@ -99,14 +176,18 @@ class Collection {
    * The Collection callbacks indicate if the displays need to be updated.
    * In this function are also the information for the SimBridge prepared and sent to it
    * @param context The gauge context
+   * @param now The time of the frame
    */
-  void updateDisplay(FsContext context);
+  void updateDisplay(FsContext context, std::chrono::steady_clock::time_point now);
   /**
    * @brief Renders the terrain on ND or background image for a specific display
    * @param pDraw The pointer to the gauge draw data object
    * @param context The context of the gauge
    */
   void renderDisplay(sGaugeDrawData* pDraw, FsContext context);
+
+  const AircraftStatusStatistics& aircraftStatusStatistics() const { return this->_aircraftStatusStatistics; }
+  const FrameCache::Statistics& frameCacheStatistics() const { return this->_frameCache->statistics(); }
 };
 
 }  // namespace navigationdisplay
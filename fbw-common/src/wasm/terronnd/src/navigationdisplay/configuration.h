@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <string_view>
 
 namespace navigationdisplay {
@@ -8,6 +11,17 @@ static const std::string ThresholdsLeftName = "FBW_SIMBRIDGE_TERRONND_THRESHOLDS
 static const std::string ThresholdsRightName = "FBW_SIMBRIDGE_TERRONND_THRESHOLDS_RIGHT";
 static const std::string FrameDataLeftName = "FBW_SIMBRIDGE_TERRONND_FRAME_DATA_LEFT";
 static const std::string FrameDataRightName = "FBW_SIMBRIDGE_TERRONND_FRAME_DATA_RIGHT";
+static const std::string FrameInfoLeftName = "FBW_SIMBRIDGE_TERRONND_FRAME_INFO_LEFT";
+static const std::string FrameInfoRightName = "FBW_SIMBRIDGE_TERRONND_FRAME_INFO_RIGHT";
+static const std::string ProtocolName = "FBW_SIMBRIDGE_TERRONND_PROTOCOL";
+// the protocol version of the gauge, see types::ProtocolData
+static constexpr std::uint16_t ProtocolVersion = 1;
+// the largest image of a display, frames with a larger header are rejected before their pixels are allocated
+static constexpr std::uint16_t MaxFrameWidth = 768;
+static constexpr std::uint16_t MaxFrameHeight = 768;
+// the receive buffer of a display for compressed images, an uncompressed RGBA image of 768 x 768 pixels fits with the overhead of its
+// format, the buffers of the other formats are sized by DisplayBase::frameDataCapacity()
+static constexpr std::size_t CompressedFrameDataCapacity = 3 * 1024 * 1024;
 static constexpr std::string_view EgpwcTerrOnNdRightActive = "EGPWC_ND_R_TERRAIN_ACTIVE";
 static constexpr std::string_view NdLeftMinElevation = "EGPWC_ND_L_TERRAIN_MIN_ELEVATION";
 static constexpr std::string_view NdLeftMinElevationMode = "EGPWC_ND_L_TERRAIN_MIN_ELEVATION_MODE";
@@ -42,4 +56,22 @@ static constexpr std::uint8_t NavigationDisplayRoseVorModeId = 1;
 static constexpr std::uint8_t NavigationDisplayRoseNavModeId = 2;
 static constexpr std::uint8_t NavigationDisplayArcModeId = 3;
 
+// the local renderer replaces the SimBridge frames if the elevation file exists
+static const std::string ElevationFilePath = "\\work\\terrain.fbwdem";
+static constexpr std::uint16_t LocalFrameWidth = 768;
+static constexpr std::uint16_t LocalFrameHeight = 768;
+static constexpr std::uint16_t LocalFrameGridStep = 4;
+static constexpr std::int64_t LocalFrameIntervalMs = 1000;
+// the grid rows that the local renderer samples or expands per frame, a picture takes about 2 * 768 / 4 / 16 frames
+static constexpr std::uint16_t LocalFrameGridRowsPerFrame = 16;
+// the decoded elevation tiles, the number of decoded bytes per frame and the prefetch along the flight path
+static constexpr std::size_t ElevationCacheBudget = 16 * 1024 * 1024;
+static constexpr std::size_t ElevationDecodeBytesPerFrame = 32 * 1024;
+static constexpr std::int64_t ElevationPrefetchIntervalMs = 2000;
+static constexpr float ElevationPrefetchLookaheadSeconds = 180.0f;
+// the aircraft status is sent to the SimBridge once its picture would be off by one pixel, the range is the picture height
+static constexpr float AircraftStatusRangePixels = 768.0f;
+static constexpr std::int32_t AircraftStatusAltitudeStepFeet = 100;
+static constexpr std::int64_t AircraftStatusMinIntervalMs = 100;
+
 }  // namespace navigationdisplay
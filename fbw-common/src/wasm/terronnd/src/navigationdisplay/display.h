@@ -17,10 +17,13 @@
 #include "../simconnect/connection.hpp"
 #include "../simconnect/lvarobject.hpp"
 #include "../simconnect/simobject.hpp"
+#include "../terrain/renderer.h"
 #include "../types/arinc429.hpp"
 #include "../types/quantity.hpp"
 #include "../types/simbridge.h"
 #include "configuration.h"
+#include "framebuffer.h"
+#include "framecache.h"
 
 namespace navigationdisplay {
 
@@ -48,23 +51,61 @@ class DisplayBase {
   DisplayBase& operator=(const DisplayBase&) = delete;
 
   virtual void update(const NdConfiguration& config) = 0;
+  /**
+   * @brief Shows a picture of the local renderer instead of the SimBridge frames
+   * @param frame The expanded picture, it may be shown on both displays
+   * @param thresholds The elevation thresholds of the picture
+   */
+  virtual void showRenderedFrame(const std::shared_ptr<FrameBuffer>& frame, const terrain::Renderer::Thresholds& thresholds) = 0;
 
   DisplaySide side() const;
   void destroy();
   void render(sGaugeDrawData* pDrawData);
 
+  /**
+   * @brief Returns the size of the receive buffer for the largest frame of a format
+   * Palette and tile delta frames of MaxFrameWidth x MaxFrameHeight pixels are bounded by runs of single pixels and every tile
+   * sent once, compressed images by CompressedFrameDataCapacity.
+   * @param format The frame format
+   * @return std::size_t The maximum number of bytes of a frame
+   */
+  static std::size_t frameDataCapacity(types::FrameFormat format);
+
  protected:
   DisplaySide _side;
   NdConfiguration _configuration;
   std::size_t _frameBufferSize;
+  types::FrameFormat _frameFormat;
+  FrameCache::Key _frameKey;
+  bool _frameInfoPending;
+  std::shared_ptr<FrameCache> _frameCache;
+  std::shared_ptr<FrameBuffer> _frameBuffer;
+  // the frame buffer in the image and its written rows at the upload, it does not keep the buffer from being reused by the cache
+  std::weak_ptr<FrameBuffer> _uploadedBuffer;
+  std::uint64_t _uploadedRows;
+  bool _localRendering;
+  bool _uploadPending;
   int _nanovgImage;
   NVGcontext* _context;
+  std::shared_ptr<simconnect::ClientDataArea<types::FrameInfoData>> _frameInfo;
   std::shared_ptr<simconnect::ClientDataArea<types::ThresholdData>> _thresholds;
   std::shared_ptr<simconnect::ClientDataAreaBuffered<std::uint8_t, SIMCONNECT_CLIENTDATA_MAX_SIZE>> _frameData;
 
-  DisplayBase(DisplaySide side, FsContext context);
+  DisplayBase(DisplaySide side, FsContext context, std::shared_ptr<FrameCache> frameCache);
 
   void destroyImage();
+  /**
+   * @brief Uploads the frame buffer into the image, the frame buffer has to be set
+   * The texture of the image is reused if it has the size of the frame buffer, otherwise a new one is created.
+   * If the image holds an earlier state of the same frame buffer only the rows written since then are uploaded.
+   */
+  void uploadFrameBuffer();
+  /**
+   * @brief Uploads rows of the frame buffer into the texture of the image
+   * @param firstRow The first row from the top
+   * @param rowCount The number of rows
+   */
+  void uploadRows(std::uint16_t firstRow, std::uint16_t rowCount);
 };
 
 /**
@@ -96,14 +137,30 @@ class Display : public DisplayBase {
    * @brief Construct a new Display object
    *
    * Communcation concept to the SimBridge:
+   *  - The SimBridge speaks the protocol version that the collection publishes or the one before the handshake (see types::ProtocolData)
+   *  - From protocol version 1 on the frame info block precedes the threshold data of every frame
    *  - The threshold data block from the SimBridge contains the number of bytes for a frame
    *  - The framedata is sent afterwards in chunks of SIMCONNECT_CLIENTDATA_MAX_SIZE bytes per chunk, until the frame is transmitted
+   *  - With the frame info every chunk starts with a simconnect::ChunkHeader with the transfer id and the offset of the chunk, a frame
+   *    with lost chunks is dropped, without it the chunks are appended as they arrive
+   *  - The frame format of the frame info defines if the frame is a compressed image or palette indices (see types::FrameFormat),
+   *    without it the frame is a compressed image
+   *  - Tile delta frames only contain the changed tiles and are patched into the frame buffer of the display
+   *  - Palette and tile delta frames are decoded by the frame cache, a frame that the other display already decoded is shared
+   *  - Palette frames are decoded progressively as their chunks arrive, the new rows sweep down over the last image
+   *  - The frame buffer is uploaded in the next draw call of the display, once per frame, only the rows that changed since the last
+   *    upload are sent to the texture
+   *  - The receive buffer is allocated for the format of the first frame, grows for a format with larger frames and is released when
+   *    the terrain is switched off
+   *  - The SimBridge data is ignored as soon as the display shows pictures of the local renderer
    *
    * @param connection The connection to SimCommect
    * @param side The display side
    * @param context The gauge context
+   * @param frameCache The frame cache that both displays share
    */
-  Display(simconnect::Connection& connection, DisplaySide side, FsContext context) : DisplayBase(side, context), _ndThresholdData(nullptr) {
+  Display(simconnect::Connection& connection, DisplaySide side, FsContext context, std::shared_ptr<FrameCache> frameCache)
+      : DisplayBase(side, context, std::move(frameCache)), _ndThresholdData(nullptr), _ignoreNextFrame(false) {
     this->_ndThresholdData = connection.lvarObject<NdMinElevation, NdMinElevationMode, NdMaxElevation, NdMaxElevationMode>();
 
     // write initial values to avoid invalid drawings
@@ -112,27 +169,92 @@ class Display : public DisplayBase {
     this->_frameData = connection.clientDataArea<std::uint8_t, SIMCONNECT_CLIENTDATA_MAX_SIZE>();
     this->_frameData->defineArea(side == DisplaySide::Left ? FrameDataLeftName : FrameDataRightName);
     this->_frameData->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
+    this->_frameData->setProgressive(true);
     this->_frameData->setOnChangeCallback([=]() {
-      this->destroyImage();
+      const bool receiving = this->_frameData->receiving();
 
-      if (!this->_ignoreNextFrame && this->_configuration.terrainActive) {
+      if (this->_localRendering) {
+        return;
+      } else if (this->_ignoreNextFrame || !this->_configuration.terrainActive) {
+        if (!receiving) {
+          this->destroyImage();
+          this->resetNavigationDisplayData();
+        }
+      } else if (!receiving && !this->_frameData->complete()) {
+        // the next delta frame must not be patched into an outdated image
+        this->_frameBuffer.reset();
+        this->destroyImage();
+      } else if (this->_frameFormat == types::FrameFormat::PALETTE_RLE) {
+        const std::uint8_t decoder = this->_side == DisplaySide::Left ? 0 : 1;
+        this->_frameBuffer = this->_frameCache->continuePaletteRle(this->_frameKey, decoder, std::move(this->_frameBuffer),
+                                                                   this->_frameData->data(), this->_frameData->receivedBytes(),
+                                                                   this->_frameBufferSize);
+        if (this->_frameBuffer != nullptr) {
+          this->_uploadPending = true;
+        } else {
+          this->destroyImage();
+          std::cerr << "TERR ON ND: Unable to decode the palette frame from the stream" << std::endl;
+        }
+      } else if (receiving) {
+        // the other formats are decoded when the frame is complete
+        return;
+      } else if (this->_frameFormat == types::FrameFormat::TILE_DELTA) {
+        this->_frameBuffer =
+            this->_frameCache->patchTiles(this->_frameKey, std::move(this->_frameBuffer), this->_frameData->data(), this->_frameBufferSize);
+        if (this->_frameBuffer != nullptr) {
+          this->_uploadPending = true;
+        } else {
+          this->destroyImage();
+          std::cerr << "TERR ON ND: Unable to patch the tiles from the stream" << std::endl;
+        }
+      } else {
+        // nanovg decodes compressed images into the texture of this display, they are not shared
+        this->_frameBuffer.reset();
+        this->destroyImage();
         this->_nanovgImage =
-            nvgCreateImageMem(this->_context, 0, this->_frameData->data().data(), static_cast<int>(this->_frameBufferSize));
+            nvgCreateImageMem(this->_context, 0, this->_frameData->data(), static_cast<int>(this->_frameBufferSize));
         if (this->_nanovgImage == 0) {
           std::cerr << "TERR ON ND: Unable to decode the image from the stream" << std::endl;
         }
-      } else {
-        this->resetNavigationDisplayData();
       }
     });
 
+    this->_frameInfo = connection.clientDataArea<types::FrameInfoData>();
+    this->_frameInfo->defineArea(side == DisplaySide::Left ? FrameInfoLeftName : FrameInfoRightName);
+    this->_frameInfo->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
+    this->_frameInfo->setAlwaysChanges(true);
+    this->_frameInfo->setOnChangeCallback([=]() { this->_frameInfoPending = true; });
+
     this->_thresholds = connection.clientDataArea<types::ThresholdData>();
     this->_thresholds->defineArea(side == DisplaySide::Left ? ThresholdsLeftName : ThresholdsRightName);
     this->_thresholds->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
     this->_thresholds->setAlwaysChanges(true);
     this->_thresholds->setOnChangeCallback([=]() {
-      this->_frameBufferSize = this->_thresholds->data().frameByteCount;
-      this->_frameData->reserve(this->_frameBufferSize);
+      // the frame info belongs to these thresholds only, a SimBridge of protocol version 0 never sends one
+      const bool framed = this->_frameInfoPending;
+      this->_frameInfoPending = false;
+      if (this->_localRendering) {
+        return;
+      }
+
+      const types::FrameInfoData& info = this->_frameInfo->data();
+      const bool supported = !framed || (info.protocolVersion >= 1 && info.protocolVersion <= ProtocolVersion &&
+                                         info.frameFormat <= types::FrameFormat::TILE_DELTA);
+      this->_frameBufferSize = supported ? this->_thresholds->data().frameByteCount : 0;
+      this->_frameFormat = framed ? static_cast<types::FrameFormat>(info.frameFormat) : types::FrameFormat::COMPRESSED_IMAGE;
+      this->_frameKey = {this->_thresholds->data().displayRange, this->_thresholds->data().displayMode, framed ? info.frameId : 0};
+      const std::size_t capacity = supported ? DisplayBase::frameDataCapacity(this->_frameFormat) : 0;
+      if (capacity > this->_frameData->capacity()) {
+        this->_frameData->setCapacity(capacity);
+      }
+      // an empty transfer ignores the chunks of an unsupported frame
+      const bool fits = this->_frameData->reserve(this->_frameBufferSize, framed ? info.transferId : 0, framed);
+      if (!supported) {
+        std::cerr << "TERR ON ND: Ignoring the frame of protocol version " << info.protocolVersion << " and format "
+                  << static_cast<int>(info.frameFormat) << std::endl;
+      } else if (!fits) {
+        std::cerr << "TERR ON ND: The frame of " << this->_frameBufferSize << " bytes exceeds the receive buffer" << std::endl;
+      }
       this->_ignoreNextFrame =
           this->_ignoreNextFrame &&
           (this->_thresholds->data().firstFrame == 0 || this->_configuration.mode != this->_thresholds->data().displayMode ||
@@ -167,8 +289,35 @@ class Display : public DisplayBase {
     if (!this->_configuration.terrainActive || !validEfisMode || resetMapData) {
       this->resetNavigationDisplayData();
       this->destroyImage();
+      this->_frameBuffer.reset();
       this->_ignoreNextFrame = true;
     }
+    if (!this->_configuration.terrainActive) {
+      // the receive buffer is allocated again with the next frame
+      this->_frameData->setCapacity(0);
+    }
+  }
+
+  /**
+   * @brief Uploads the picture of the local renderer and publishes its thresholds
+   * A picture that the display already shows is not uploaded again.
+   * @param frame The expanded picture
+   * @param thresholds The elevation thresholds of the picture
+   */
+  void showRenderedFrame(const std::shared_ptr<FrameBuffer>& frame, const terrain::Renderer::Thresholds& thresholds) override {
+    this->_localRendering = true;
+    if (!this->_configuration.terrainActive || (frame == this->_frameBuffer && (this->_nanovgImage != 0 || this->_uploadPending))) {
+      return;
+    }
+
+    this->_frameBuffer = frame;
+    this->_uploadPending = true;
+
+    this->_ndThresholdData->template value<NdMinElevation>() = thresholds.lower;
+    this->_ndThresholdData->template value<NdMinElevationMode>() = thresholds.lowerMode;
+    this->_ndThresholdData->template value<NdMaxElevation>() = thresholds.upper;
+    this->_ndThresholdData->template value<NdMaxElevationMode>() = thresholds.upperMode;
+    this->_ndThresholdData->writeValues();
   }
 };
 
@@ -177,10 +326,11 @@ class Display : public DisplayBase {
  */
 class DisplayLeft : public Display<NdLeftMinElevation, NdLeftMinElevationMode, NdLeftMaxElevation, NdLeftMaxElevationMode> {
  public:
-  DisplayLeft(simconnect::Connection& connection, FsContext context)
+  DisplayLeft(simconnect::Connection& connection, FsContext context, std::shared_ptr<FrameCache> frameCache)
       : Display<NdLeftMinElevation, NdLeftMinElevationMode, NdLeftMaxElevation, NdLeftMaxElevationMode>(connection,
                                                                                                         DisplaySide::Left,
-                                                                                                        context) {}
+                                                                                                        context,
+                                                                                                        std::move(frameCache)) {}
   DisplayLeft(const DisplayLeft&) = delete;
   virtual ~DisplayLeft() {}
 
@@ -192,10 +342,11 @@ class DisplayLeft : public Display<NdLeftMinElevation, NdLeftMinElevationMode, N
  */
 class DisplayRight : public Display<NdRightMinElevation, NdRightMinElevationMode, NdRightMaxElevation, NdRightMaxElevationMode> {
  public:
-  DisplayRight(simconnect::Connection& connection, FsContext context)
+  DisplayRight(simconnect::Connection& connection, FsContext context, std::shared_ptr<FrameCache> frameCache)
       : Display<NdRightMinElevation, NdRightMinElevationMode, NdRightMaxElevation, NdRightMaxElevationMode>(connection,
                                                                                                             DisplaySide::Right,
-                                                                                                            context) {}
+                                                                                                            context,
+                                                                                                            std::move(frameCache)) {}
   DisplayRight(const DisplayRight&) = delete;
   virtual ~DisplayRight() {}
 
@@ -1,9 +1,27 @@
+#include <limits>
+
 #include "display.h"
 
 using namespace navigationdisplay;
 
-DisplayBase::DisplayBase(DisplaySide side, FsContext context)
-    : _side(side), _configuration(), _frameBufferSize(0), _nanovgImage(0), _context(nullptr), _thresholds(nullptr), _frameData(nullptr) {
+DisplayBase::DisplayBase(DisplaySide side, FsContext context, std::shared_ptr<FrameCache> frameCache)
+    : _side(side),
+      _configuration(),
+      _frameBufferSize(0),
+      _frameFormat(types::FrameFormat::COMPRESSED_IMAGE),
+      _frameKey(),
+      _frameInfoPending(false),
+      _frameCache(std::move(frameCache)),
+      _frameBuffer(nullptr),
+      _uploadedBuffer(),
+      _uploadedRows(0),
+      _localRendering(false),
+      _uploadPending(false),
+      _nanovgImage(0),
+      _context(nullptr),
+      _frameInfo(nullptr),
+      _thresholds(nullptr),
+      _frameData(nullptr) {
   NVGparams params;
   params.userPtr = context;
   params.edgeAntiAlias = false;
@@ -14,6 +32,24 @@ DisplaySide DisplayBase::side() const {
   return this->_side;
 }
 
+std::size_t DisplayBase::frameDataCapacity(types::FrameFormat format) {
+  constexpr std::size_t pixelCount = static_cast<std::size_t>(MaxFrameWidth) * MaxFrameHeight;
+  // a packet codes at least one pixel in two bytes
+  constexpr std::size_t pixelBytes = 2 * pixelCount;
+  constexpr std::size_t paletteBytes = 256 * sizeof(std::uint32_t);
+
+  switch (format) {
+    case types::FrameFormat::PALETTE_RLE:
+      return sizeof(types::PaletteFrameHeader) + paletteBytes + pixelBytes;
+    case types::FrameFormat::TILE_DELTA:
+      // the tile count of the header limits the tile indices
+      return sizeof(types::TileDeltaHeader) + paletteBytes + std::numeric_limits<std::uint16_t>::max() * sizeof(std::uint16_t) +
+             pixelBytes;
+    default:
+      return CompressedFrameDataCapacity;
+  }
+}
+
 void DisplayBase::destroy() {
   this->destroyImage();
   nvgDeleteInternal(this->_context);
@@ -27,11 +63,69 @@ void DisplayBase::destroyImage() {
   }
 }
 
+void DisplayBase::uploadRows(std::uint16_t firstRow, std::uint16_t rowCount) {
+  if (rowCount == 0) {
+    return;
+  }
+
+  // nanovg only updates whole images, its renderer takes a region of the image data like for the updates of the font atlas
+  NVGparams* params = nvgInternalParams(this->_context);
+  params->renderUpdateTexture(params->userPtr, this->_nanovgImage, 0, firstRow, this->_frameBuffer->width(), rowCount,
+                              this->_frameBuffer->rgba());
+}
+
+void DisplayBase::uploadFrameBuffer() {
+  int width = 0;
+  int height = 0;
+  if (this->_nanovgImage != 0) {
+    nvgImageSize(this->_context, this->_nanovgImage, &width, &height);
+  }
+
+  const bool sameBuffer =
+      !this->_uploadedBuffer.expired() && !this->_uploadedBuffer.owner_before(this->_frameBuffer) &&
+      !this->_frameBuffer.owner_before(this->_uploadedBuffer);
+  const std::uint64_t writtenRows = this->_frameBuffer->writtenRows() - this->_uploadedRows;
+  this->_uploadedBuffer = this->_frameBuffer;
+  this->_uploadedRows = this->_frameBuffer->writtenRows();
+
+  if (this->_nanovgImage != 0 && width == this->_frameBuffer->width() && height == this->_frameBuffer->height()) {
+    if (!sameBuffer || writtenRows >= static_cast<std::uint64_t>(height)) {
+      nvgUpdateImage(this->_context, this->_nanovgImage, this->_frameBuffer->rgba());
+      return;
+    }
+
+    // the rows of the progressive decoding, the ones of the last image continue at the bottom
+    const std::uint16_t rowCount = static_cast<std::uint16_t>(writtenRows);
+    const std::uint16_t decodedRows = this->_frameBuffer->decodedRows();
+    if (rowCount <= decodedRows) {
+      this->uploadRows(decodedRows - rowCount, rowCount);
+    } else {
+      this->uploadRows(0, decodedRows);
+      this->uploadRows(static_cast<std::uint16_t>(height - (rowCount - decodedRows)), rowCount - decodedRows);
+    }
+  } else {
+    this->destroyImage();
+    this->_nanovgImage =
+        nvgCreateImageRGBA(this->_context, this->_frameBuffer->width(), this->_frameBuffer->height(), 0, this->_frameBuffer->rgba());
+    if (this->_nanovgImage == 0) {
+      std::cerr << "TERR ON ND: Unable to create the image of the frame buffer" << std::endl;
+    }
+  }
+}
+
 void DisplayBase::render(sGaugeDrawData* pDrawData) {
   if (this->_context == nullptr) {
     return;
   }
 
+  // the frame callbacks may run in the callback of the other gauge, the texture is updated in the draw call of this gauge
+  if (this->_uploadPending) {
+    if (this->_frameBuffer != nullptr) {
+      this->uploadFrameBuffer();
+    }
+    this->_uploadPending = false;
+  }
+
   const float ratio = static_cast<float>(pDrawData->fbWidth) / static_cast<float>(pDrawData->fbHeight);
   nvgBeginFrame(this->_context, static_cast<float>(pDrawData->winWidth), static_cast<float>(pDrawData->winHeight), ratio);
   {
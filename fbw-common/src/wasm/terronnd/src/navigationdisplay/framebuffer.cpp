@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <cstring>
+
+#include "configuration.h"
+#include "framebuffer.h"
+
+using namespace navigationdisplay;
+
+FrameBuffer::FrameBuffer()
+    : _width(0),
+      _height(0),
+      _complete(false),
+      _headerDecoded(false),
+      _clearImage(false),
+      _decodePosition(0),
+      _decodedPixels(0),
+      _writtenRows(0),
+      _pixels(),
+      _tile(),
+      _palette(),
+      _paletteSize(0) {}
+
+bool FrameBuffer::fitsDisplay(std::uint16_t width, std::uint16_t height) {
+  return width <= MaxFrameWidth && height <= MaxFrameHeight;
+}
+
+bool FrameBuffer::readPalette(const std::uint8_t* data, std::size_t size, std::size_t& position, std::uint8_t paletteSize) {
+  const std::size_t paletteBytes = static_cast<std::size_t>(paletteSize) * sizeof(std::uint32_t);
+  if (paletteSize == 0 || size - position < paletteBytes) {
+    return false;
+  }
+
+  // the colors are stored as RGBA bytes, the same memory layout as the pixels
+  std::memcpy(this->_palette, &data[position], paletteBytes);
+  this->_paletteSize = paletteSize;
+  position += paletteBytes;
+  return true;
+}
+
+bool FrameBuffer::decodePackets(const std::uint8_t* data,
+                                std::size_t size,
+                                std::size_t& position,
+                                std::uint32_t* pixel,
+                                std::size_t count,
+                                std::size_t& decoded) const {
+  std::uint32_t* const begin = pixel;
+  std::uint32_t* const end = pixel + count;
+  bool valid = true;
+
+  while (pixel != end && position < size) {
+    const std::uint8_t control = data[position];
+    if (control < 0x80) {
+      const std::size_t runLength = static_cast<std::size_t>(control) + 1;
+      if (size - position < 2) {
+        break;
+      } else if (data[position + 1] >= this->_paletteSize || static_cast<std::size_t>(end - pixel) < runLength) {
+        valid = false;
+        break;
+      }
+      std::fill_n(pixel, runLength, this->_palette[data[position + 1]]);
+      pixel += runLength;
+      position += 2;
+    } else if (control < 0xc0) {
+      const std::size_t literals = static_cast<std::size_t>(control) - 0x7f;
+      if (size - position < literals + 1) {
+        break;
+      } else if (static_cast<std::size_t>(end - pixel) < literals) {
+        valid = false;
+        break;
+      }
+      for (std::size_t i = 1; i <= literals && valid; ++i) {
+        valid = data[position + i] < this->_paletteSize;
+      }
+      if (!valid) {
+        break;
+      }
+      for (std::size_t i = 1; i <= literals; ++i) {
+        *pixel++ = this->_palette[data[position + i]];
+      }
+      position += literals + 1;
+    } else {
+      const std::size_t pairs = static_cast<std::size_t>(control) - 0xbf;
+      if (size - position < 3) {
+        break;
+      } else if (data[position + 1] >= this->_paletteSize || data[position + 2] >= this->_paletteSize ||
+                 static_cast<std::size_t>(end - pixel) < 2 * pairs) {
+        valid = false;
+        break;
+      }
+      const std::uint32_t first = this->_palette[data[position + 1]];
+      const std::uint32_t second = this->_palette[data[position + 2]];
+      for (std::size_t i = 0; i < pairs; ++i) {
+        *pixel++ = first;
+        *pixel++ = second;
+      }
+      position += 3;
+    }
+  }
+
+  decoded = static_cast<std::size_t>(pixel - begin);
+  return valid;
+}
+
+bool FrameBuffer::decodePaletteRle(const std::uint8_t* data, std::size_t size) {
+  types::PaletteFrameHeader header;
+  if (size < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (!FrameBuffer::fitsDisplay(header.width, header.height)) {
+    return false;
+  }
+
+  std::size_t position = sizeof(header);
+  if (!this->readPalette(data, size, position, header.paletteSize)) {
+    return false;
+  }
+
+  this->_width = header.width;
+  this->_height = header.height;
+  this->_pixels.resize(static_cast<std::size_t>(header.width) * header.height);
+  this->_writtenRows += header.height;
+
+  std::size_t decoded = 0;
+  this->_complete = this->decodePackets(data, size, position, this->_pixels.data(), this->_pixels.size(), decoded) &&
+                    decoded == this->_pixels.size();
+  return this->_complete;
+}
+
+void FrameBuffer::beginPaletteRle(bool clearImage) {
+  // the rows of an incomplete image below the new rows are not in the order of writtenRows()
+  if (!this->_complete) {
+    this->_writtenRows += this->_height;
+  }
+  this->_complete = false;
+  this->_headerDecoded = false;
+  this->_clearImage = clearImage;
+  this->_decodePosition = 0;
+  this->_decodedPixels = 0;
+}
+
+bool FrameBuffer::continuePaletteRle(const std::uint8_t* data, std::size_t size) {
+  if (!this->_headerDecoded) {
+    types::PaletteFrameHeader header;
+    if (size < sizeof(header)) {
+      return true;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (!FrameBuffer::fitsDisplay(header.width, header.height)) {
+      return false;
+    }
+    if (size - sizeof(header) < static_cast<std::size_t>(header.paletteSize) * sizeof(std::uint32_t)) {
+      return true;
+    }
+
+    std::size_t position = sizeof(header);
+    if (!this->readPalette(data, size, position, header.paletteSize)) {
+      return false;
+    }
+
+    // the rows of another image size or of an unrelated image are not shown below the decoded rows
+    const std::size_t pixelCount = static_cast<std::size_t>(header.width) * header.height;
+    if (this->_clearImage || header.width != this->_width || header.height != this->_height) {
+      this->_pixels.assign(pixelCount, 0);
+      this->_writtenRows += header.height;
+    }
+    this->_width = header.width;
+    this->_height = header.height;
+    this->_decodePosition = position;
+    this->_headerDecoded = true;
+  }
+
+  std::size_t decoded = 0;
+  const std::uint16_t decodedRows = this->decodedRows();
+  const bool valid = this->decodePackets(data, size, this->_decodePosition, this->_pixels.data() + this->_decodedPixels,
+                                         this->_pixels.size() - this->_decodedPixels, decoded);
+  this->_decodedPixels += decoded;
+  this->_writtenRows += this->decodedRows() - decodedRows;
+  this->_complete = valid && this->_decodedPixels == this->_pixels.size();
+  return valid;
+}
+
+bool FrameBuffer::patchTiles(const std::uint8_t* data, std::size_t size) {
+  types::TileDeltaHeader header;
+  if (size < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (!FrameBuffer::fitsDisplay(header.width, header.height)) {
+    this->_complete = false;
+    return false;
+  }
+
+  const std::size_t tileSize = header.tileSize;
+  if (tileSize == 0) {
+    return false;
+  }
+  const std::size_t tilesPerRow = (header.width + tileSize - 1) / tileSize;
+  const std::size_t tileRows = (header.height + tileSize - 1) / tileSize;
+
+  // a delta frame only applies to the image it was computed against
+  if (header.width != this->_width || header.height != this->_height) {
+    this->_complete = false;
+    this->_width = header.width;
+    this->_height = header.height;
+    this->_pixels.resize(static_cast<std::size_t>(header.width) * header.height);
+  }
+  if (!this->_complete && header.tileCount != tilesPerRow * tileRows) {
+    return false;
+  }
+
+  std::size_t position = sizeof(header);
+  if (!this->readPalette(data, size, position, header.paletteSize)) {
+    this->_complete = false;
+    return false;
+  }
+
+  this->_writtenRows += this->_height;
+  this->_tile.resize(tileSize * tileSize);
+  for (std::size_t i = 0; i < header.tileCount; ++i) {
+    std::uint16_t tileIndex;
+    if (size - position < sizeof(tileIndex)) {
+      this->_complete = false;
+      return false;
+    }
+    std::memcpy(&tileIndex, &data[position], sizeof(tileIndex));
+    position += sizeof(tileIndex);
+    if (tileIndex >= tilesPerRow * tileRows) {
+      this->_complete = false;
+      return false;
+    }
+
+    const std::size_t left = (tileIndex % tilesPerRow) * tileSize;
+    const std::size_t top = (tileIndex / tilesPerRow) * tileSize;
+    const std::size_t columns = std::min(tileSize, this->_width - left);
+    const std::size_t rows = std::min(tileSize, this->_height - top);
+    std::size_t decoded = 0;
+    if (!this->decodePackets(data, size, position, this->_tile.data(), columns * rows, decoded) || decoded != columns * rows) {
+      this->_complete = false;
+      return false;
+    }
+
+    for (std::size_t row = 0; row < rows; ++row) {
+      std::memcpy(&this->_pixels[(top + row) * this->_width + left], &this->_tile[row * columns], columns * sizeof(std::uint32_t));
+    }
+  }
+
+  this->_complete = true;
+  return true;
+}
+
+void FrameBuffer::expandIndices(const std::uint8_t* indices,
+                                std::uint16_t width,
+                                std::uint16_t height,
+                                const std::uint32_t* palette,
+                                std::uint8_t paletteSize) {
+  std::memcpy(this->_palette, palette, static_cast<std::size_t>(paletteSize) * sizeof(std::uint32_t));
+  this->_paletteSize = paletteSize;
+  this->_width = width;
+  this->_height = height;
+  this->_pixels.resize(static_cast<std::size_t>(width) * height);
+
+  for (std::size_t i = 0; i < this->_pixels.size(); ++i) {
+    this->_pixels[i] = this->_palette[indices[i]];
+  }
+  this->_writtenRows += height;
+
+  // a later delta frame of the SimBridge does not refer to this image
+  this->_complete = false;
+}
+
+void FrameBuffer::copyFrom(const FrameBuffer& other) {
+  std::memcpy(this->_palette, other._palette, sizeof(this->_palette));
+  this->_paletteSize = other._paletteSize;
+  this->_width = other._width;
+  this->_height = other._height;
+  this->_pixels.assign(other._pixels.begin(), other._pixels.end());
+  this->_complete = other._complete;
+  this->_writtenRows += this->_height;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../types/simbridge.h"
+
+namespace navigationdisplay {
+
+/**
+ * @brief Persistent RGBA image of a display that the received frames are expanded into
+ *
+ * The buffer keeps its memory between frames, so decoding a frame of the same size does not allocate.
+ */
+class FrameBuffer {
+ private:
+  std::uint16_t _width;
+  std::uint16_t _height;
+  bool _complete;
+  // the state of a progressive decoding
+  bool _headerDecoded;
+  bool _clearImage;
+  std::size_t _decodePosition;
+  std::size_t _decodedPixels;
+  std::uint64_t _writtenRows;
+  std::vector<std::uint32_t> _pixels;
+  std::vector<std::uint32_t> _tile;
+  std::uint32_t _palette[256];
+  std::uint8_t _paletteSize;
+
+  /**
+   * @brief Returns true if the size of a received frame fits the display, the size is not trusted before
+   */
+  static bool fitsDisplay(std::uint16_t width, std::uint16_t height);
+  bool readPalette(const std::uint8_t* data, std::size_t size, std::size_t& position, std::uint8_t paletteSize);
+  /**
+   * @brief Decodes packets until count pixels are written or the data ends, a packet that is not complete is not consumed
+   * @return false if a packet is corrupt
+   */
+  bool decodePackets(const std::uint8_t* data,
+                     std::size_t size,
+                     std::size_t& position,
+                     std::uint32_t* pixel,
+                     std::size_t count,
+                     std::size_t& decoded) const;
+
+ public:
+  FrameBuffer();
+  FrameBuffer(const FrameBuffer&) = delete;
+
+  FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+  /**
+   * @brief Expands a PALETTE_RLE frame into the buffer
+   * @param data The frame data starting with the types::PaletteFrameHeader
+   * @param size The number of bytes of the frame
+   * @return true if the frame is decoded
+   * @return false if the frame is truncated, corrupt or larger than the display, the content of the buffer is undefined in that case
+   */
+  bool decodePaletteRle(const std::uint8_t* data, std::size_t size);
+  /**
+   * @brief Starts the progressive decoding of a PALETTE_RLE frame
+   * The rows of the new frame replace the rows of the current image as they are decoded.
+   * @param clearImage Clears the image before the first row instead of keeping the current one
+   */
+  void beginPaletteRle(bool clearImage);
+  /**
+   * @brief Decodes the packets of the bytes that are received since the last call
+   * @param data The frame data starting with the types::PaletteFrameHeader
+   * @param size The number of received bytes of the frame
+   * @return true if the received packets are decoded, decodedRows() tells how far
+   * @return false if the frame is corrupt or larger than the display
+   */
+  bool continuePaletteRle(const std::uint8_t* data, std::size_t size);
+  /**
+   * @brief Returns the number of rows from the top that the progressive decoding finished
+   */
+  std::uint16_t decodedRows() const {
+    return this->_width != 0 ? static_cast<std::uint16_t>(this->_decodedPixels / this->_width) : 0;
+  }
+  /**
+   * @brief Returns the number of rows that are written since the buffer was created
+   * Every change of the image except the rows of a progressive decoding counts all rows of the image. A progressive decoding
+   * writes its rows in order from the top and only continues an image whose last decoding completed, so the rows that are
+   * written since an earlier count are the last ones before decodedRows(), continued at the bottom of the image.
+   */
+  std::uint64_t writtenRows() const { return this->_writtenRows; }
+  /**
+   * @brief Patches the tiles of a TILE_DELTA frame into the buffer
+   * A frame with a different image size or after invalidate() is only accepted if it contains all tiles.
+   * @param data The frame data starting with the types::TileDeltaHeader
+   * @param size The number of bytes of the frame
+   * @return true if the tiles are patched
+   * @return false if the frame does not fit to the buffer or the display or is corrupt, the buffer is invalid afterwards
+   */
+  bool patchTiles(const std::uint8_t* data, std::size_t size);
+  /**
+   * @brief Expands the palette indices of a locally rendered picture into the buffer
+   * @param indices The palette indices in rows from the top, every index has to be smaller than paletteSize
+   * @param width The width of the picture in pixels
+   * @param height The height of the picture in pixels
+   * @param palette The RGBA colors of the indices
+   * @param paletteSize The number of colors
+   */
+  void expandIndices(const std::uint8_t* indices,
+                     std::uint16_t width,
+                     std::uint16_t height,
+                     const std::uint32_t* palette,
+                     std::uint8_t paletteSize);
+  /**
+   * @brief Copies the image of another buffer, the memory of this buffer is reused if it is large enough
+   */
+  void copyFrom(const FrameBuffer& other);
+  /**
+   * @brief Returns true if the image is a complete frame
+   */
+  bool complete() const { return this->_complete; }
+  /**
+   * @brief Marks the content as outdated, the next delta frame has to contain the full image
+   */
+  void invalidate() { this->_complete = false; }
+
+  std::uint16_t width() const { return this->_width; }
+  std::uint16_t height() const { return this->_height; }
+
+  /**
+   * @brief Returns the pixels in rows from the top with the RGBA bytes of a pixel in memory order
+   * @return const std::uint8_t* The first byte of the image
+   */
+  const std::uint8_t* rgba() const { return reinterpret_cast<const std::uint8_t*>(this->_pixels.data()); }
+};
+
+}  // namespace navigationdisplay
@@ -0,0 +1,160 @@
+#include "framecache.h"
+
+using namespace navigationdisplay;
+
+FrameCache::FrameCache() : _entries(), _statistics() {}
+
+FrameCache::Entry* FrameCache::find(const Key& key, bool decoding) {
+  if (key.frameId == 0) {
+    return nullptr;
+  }
+
+  for (auto& entry : this->_entries) {
+    if ((entry.valid || (decoding && entry.decoding)) && entry.key == key) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+FrameCache::Entry* FrameCache::entry(const FrameBuffer* buffer) {
+  for (auto& entry : this->_entries) {
+    if (entry.buffer.get() == buffer) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+FrameCache::Entry& FrameCache::acquire(const Key& key) {
+  // prefer the buffers without a frame, the others may still be requested by the second display
+  Entry* target = nullptr;
+  for (auto& entry : this->_entries) {
+    if (entry.buffer.use_count() == 1 && (target == nullptr || !entry.valid)) {
+      target = &entry;
+    }
+  }
+
+  if (target == nullptr) {
+    this->_entries.push_back({key, false, false, 0, std::make_shared<FrameBuffer>()});
+    target = &this->_entries.back();
+  }
+
+  target->key = key;
+  target->valid = false;
+  target->decoding = false;
+  target->decoders = 0;
+  target->buffer->invalidate();
+  return *target;
+}
+
+FrameCache::Entry& FrameCache::derive(const Key& key, std::shared_ptr<FrameBuffer> current) {
+  // the pool and the caller reference the current frame if no other display shows it
+  Entry* target = current != nullptr ? this->entry(current.get()) : nullptr;
+  const bool advances = target != nullptr && target->key.range == key.range && target->key.mode == key.mode &&
+                        target->key.frameId != 0 && target->key.frameId < key.frameId;
+  if (target == nullptr || (current.use_count() > 2 && !advances)) {
+    target = &this->acquire(key);
+    if (current != nullptr) {
+      target->buffer->copyFrom(*current);
+      this->_statistics.copiedFrames += 1;
+    }
+  }
+
+  target->key = key;
+  target->valid = false;
+  target->decoding = false;
+  target->decoders = 0;
+  return *target;
+}
+
+std::shared_ptr<FrameBuffer> FrameCache::decodePaletteRle(const Key& key, const std::uint8_t* data, std::size_t size) {
+  Entry* shared = this->find(key, false);
+  if (shared != nullptr) {
+    this->_statistics.sharedFrames += 1;
+    return shared->buffer;
+  }
+
+  Entry& target = this->acquire(key);
+  if (!target.buffer->decodePaletteRle(data, size)) {
+    this->_statistics.failures += 1;
+    return nullptr;
+  }
+
+  target.valid = true;
+  this->_statistics.decodedFrames += 1;
+  return target.buffer;
+}
+
+std::shared_ptr<FrameBuffer> FrameCache::patchTiles(const Key& key,
+                                                    std::shared_ptr<FrameBuffer> current,
+                                                    const std::uint8_t* data,
+                                                    std::size_t size) {
+  Entry* shared = this->find(key, false);
+  if (shared != nullptr) {
+    this->_statistics.sharedFrames += 1;
+    return shared->buffer;
+  }
+
+  Entry& target = this->derive(key, std::move(current));
+  if (!target.buffer->patchTiles(data, size)) {
+    this->_statistics.failures += 1;
+    return nullptr;
+  }
+
+  target.valid = true;
+  this->_statistics.decodedFrames += 1;
+  return target.buffer;
+}
+
+std::shared_ptr<FrameBuffer> FrameCache::continuePaletteRle(const Key& key,
+                                                            std::uint8_t decoder,
+                                                            std::shared_ptr<FrameBuffer> current,
+                                                            const std::uint8_t* data,
+                                                            std::size_t received,
+                                                            std::size_t size) {
+  // the display may hold the buffer of the frame already if the other display advanced their common frame in place
+  const std::uint8_t decoderBit = static_cast<std::uint8_t>(1u << decoder);
+  Entry* target = this->find(key, true);
+  if (target != nullptr) {
+    if ((target->decoders & decoderBit) == 0) {
+      this->_statistics.sharedFrames += 1;
+    }
+  } else {
+    const bool clearImage = current == nullptr;
+    target = &this->derive(key, std::move(current));
+    target->decoding = true;
+    target->buffer->beginPaletteRle(clearImage);
+  }
+  target->decoders |= decoderBit;
+  current.reset();
+
+  // the other display may have decoded more bytes of the same frame already
+  if (target->decoding) {
+    if (!target->buffer->continuePaletteRle(data, received) || (received >= size && !target->buffer->complete())) {
+      target->decoding = false;
+      this->_statistics.failures += 1;
+      return nullptr;
+    }
+    if (target->buffer->complete()) {
+      target->decoding = false;
+      target->valid = true;
+      this->_statistics.decodedFrames += 1;
+    }
+  }
+
+  return target->buffer;
+}
+
+std::shared_ptr<FrameBuffer> FrameCache::expandIndices(const Key& key,
+                                                       const std::uint8_t* indices,
+                                                       std::uint16_t width,
+                                                       std::uint16_t height,
+                                                       const std::uint32_t* palette,
+                                                       std::uint8_t paletteSize) {
+  Entry& target = this->acquire(key);
+  target.buffer->expandIndices(indices, width, height, palette, paletteSize);
+  target.valid = true;
+  this->_statistics.decodedFrames += 1;
+  return target.buffer;
+}
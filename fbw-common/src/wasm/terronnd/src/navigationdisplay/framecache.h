@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "framebuffer.h"
+
+namespace navigationdisplay {
+
+/**
+ * @brief Decodes the frames of both displays into a shared pool of frame buffers
+ *
+ * The SimBridge sends the same picture to both sides if they use the same range and mode. The frames are identified by
+ * the range, the mode and the frame id of the threshold data, a frame that is already decoded for one display is only
+ * referenced by the other one. A buffer returns to the pool as soon as no display references it anymore, the pool keeps
+ * the memory of the buffers.
+ */
+class FrameCache {
+ public:
+  struct Key {
+    std::uint16_t range;
+    std::uint8_t mode;
+    std::uint32_t frameId;
+
+    bool operator==(const Key& other) const { return range == other.range && mode == other.mode && frameId == other.frameId; }
+  };
+
+  struct Statistics {
+    std::uint64_t decodedFrames = 0;
+    std::uint64_t sharedFrames = 0;
+    std::uint64_t copiedFrames = 0;
+    std::uint64_t failures = 0;
+  };
+
+ private:
+  struct Entry {
+    Key key;
+    bool valid;
+    // the frame of the key is decoded progressively
+    bool decoding;
+    // one bit per display that continues the progressive decoding of the frame
+    std::uint8_t decoders;
+    std::shared_ptr<FrameBuffer> buffer;
+  };
+
+  std::vector<Entry> _entries;
+  Statistics _statistics;
+
+  Entry* find(const Key& key, bool decoding);
+  Entry* entry(const FrameBuffer* buffer);
+  /**
+   * @brief Returns an unreferenced entry of the pool for the key, the content of its buffer is invalid
+   */
+  Entry& acquire(const Key& key);
+  /**
+   * @brief Returns the entry for the key that starts with the image of the current frame
+   * The current frame is used in place if no other display references it or if the key is the next frame of the same range
+   * and mode, the other display receives the same frame next. Otherwise the current frame is copied into a new entry.
+   * @return Entry& The entry, its content is invalid if there is no current frame
+   */
+  Entry& derive(const Key& key, std::shared_ptr<FrameBuffer> current);
+
+ public:
+  FrameCache();
+  FrameCache(const FrameCache&) = delete;
+
+  FrameCache& operator=(const FrameCache&) = delete;
+
+  /**
+   * @brief Returns the decoded PALETTE_RLE frame of the key
+   * @param key The key of the frame, a frame id of 0 is never shared
+   * @param data The frame data starting with the types::PaletteFrameHeader
+   * @param size The number of bytes of the frame
+   * @return std::shared_ptr<FrameBuffer> The decoded frame or nullptr if it is corrupt
+   */
+  std::shared_ptr<FrameBuffer> decodePaletteRle(const Key& key, const std::uint8_t* data, std::size_t size);
+  /**
+   * @brief Decodes the received part of a PALETTE_RLE frame, the decoded rows replace the rows of the current frame
+   * The frame is shared with the other display while it is decoded, both displays continue the same decoding.
+   * @param key The key of the frame, a frame id of 0 is never shared
+   * @param decoder The index of the display that receives the frame, below 8
+   * @param current The last frame of the display or nullptr if the image starts empty
+   * @param data The frame data starting with the types::PaletteFrameHeader
+   * @param received The number of received bytes
+   * @param size The number of bytes of the frame
+   * @return std::shared_ptr<FrameBuffer> The frame with the decoded rows or nullptr if the frame is corrupt or incomplete
+   */
+  std::shared_ptr<FrameBuffer> continuePaletteRle(const Key& key,
+                                                  std::uint8_t decoder,
+                                                  std::shared_ptr<FrameBuffer> current,
+                                                  const std::uint8_t* data,
+                                                  std::size_t received,
+                                                  std::size_t size);
+  /**
+   * @brief Returns the frame of the key that results from patching the TILE_DELTA frame into the current frame
+   * The current frame is patched in place if no other display references it or if the delta is the next frame of the same
+   * range and mode, otherwise it is copied first.
+   * @param key The key of the frame, a frame id of 0 is never shared
+   * @param current The last frame of the display or nullptr if the frame has to contain all tiles
+   * @param data The frame data starting with the types::TileDeltaHeader
+   * @param size The number of bytes of the frame
+   * @return std::shared_ptr<FrameBuffer> The patched frame or nullptr if the frame does not fit or is corrupt
+   */
+  std::shared_ptr<FrameBuffer> patchTiles(const Key& key,
+                                          std::shared_ptr<FrameBuffer> current,
+                                          const std::uint8_t* data,
+                                          std::size_t size);
+  /**
+   * @brief Expands the palette indices of a locally rendered picture into a buffer of the pool
+   * @see FrameBuffer::expandIndices
+   */
+  std::shared_ptr<FrameBuffer> expandIndices(const Key& key,
+                                             const std::uint8_t* indices,
+                                             std::uint16_t width,
+                                             std::uint16_t height,
+                                             const std::uint32_t* palette,
+                                             std::uint8_t paletteSize);
+
+  /**
+   * @brief Returns the number of buffers in the pool
+   */
+  std::size_t bufferCount() const { return this->_entries.size(); }
+  const Statistics& statistics() const { return this->_statistics; }
+};
+
+}  // namespace navigationdisplay
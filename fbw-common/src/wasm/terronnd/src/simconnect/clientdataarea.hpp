@@ -5,6 +5,7 @@
 #pragma clang diagnostic ignored "-Wundef"
 #include <SimConnect.h>
 #pragma clang diagnostic pop
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -167,8 +168,26 @@ class ClientDataArea : public ClientDataAreaBase {
   const T& data() const { return this->_content; }
 };
 
+/**
+ * @brief The header in front of the payload of every chunk of a buffered client data area
+ * The sequence identifies the transfer that the chunk belongs to (i.e. the transfer id of the frame info), the offset is
+ * the position of the payload in the transfer. The chunks of a transfer are sent in order, so the offset equals the
+ * number of received bytes.
+ */
+struct ChunkHeader {
+  std::uint32_t sequence;
+  std::uint32_t offset;
+} __attribute__((packed));
+
 /**
  * @brief Defines a buffer-based client data area (i.e. frame data of terronnd)
+ *
+ * The transfers are received into an arena that is allocated once with the maximum size of a transfer, the chunks are
+ * written to their offset in the arena. A chunk of another transfer is ignored, a chunk at an unexpected offset marks
+ * the transfer as lost. Transfers without chunk headers (i.e. SimBridge releases of protocol version 0) fill the chunks
+ * with payload and are appended in the order of their arrival without any checks. The OnChange callback is triggered
+ * when the transfer is complete or lost and in the progressive mode after every received chunk.
+ *
  * @tparam T The element type of one entry in the buffer
  * @tparam ChunkSize The number bytes that is used for the buffer-based communication
  */
@@ -176,27 +195,78 @@ template <typename T, std::size_t ChunkSize>
 class ClientDataAreaBuffered : public ClientDataAreaBase {
   friend Connection;
 
+  static_assert(sizeof(T) == 1, "The buffered client data area transfers bytes");
+  static_assert(ChunkSize > sizeof(ChunkHeader), "The chunk has no space for the payload");
+
+ public:
+  static constexpr std::size_t PayloadSize = ChunkSize - sizeof(ChunkHeader);
+  static constexpr std::size_t HeaderlessPayloadSize = ChunkSize;
+
  private:
-  std::vector<T> _content;
-  std::size_t _expectedByteCount;
+  std::vector<T> _arena;
+  std::array<std::uint8_t, ChunkSize> _chunk;
+  std::size_t _byteCount;
   std::size_t _receivedBytes;
+  std::uint32_t _sequence;
+  bool _chunkHeaders;
+  bool _receiving;
+  bool _complete;
+  bool _progressive;
 
   ClientDataAreaBuffered(HANDLE* connection, std::uint32_t dataId, std::uint32_t definitionId)
-      : ClientDataAreaBase(connection, dataId, definitionId), _content() {}
+      : ClientDataAreaBase(connection, dataId, definitionId),
+        _arena(),
+        _chunk(),
+        _byteCount(0),
+        _receivedBytes(0),
+        _sequence(0),
+        _chunkHeaders(true),
+        _receiving(false),
+        _complete(false),
+        _progressive(false) {}
   ClientDataAreaBuffered(const ClientDataAreaBuffered<T, ChunkSize>&) = delete;
 
   ClientDataAreaBuffered<T, ChunkSize>& operator=(const ClientDataAreaBuffered<T, ChunkSize>&) = delete;
 
+  std::size_t payloadSize() const { return this->_chunkHeaders ? PayloadSize : HeaderlessPayloadSize; }
+
   void receivedData(void* data) override {
-    std::size_t remainingBytes = this->_expectedByteCount - this->_receivedBytes;
-    if (remainingBytes > ChunkSize) {
-      remainingBytes = ChunkSize;
+    // a chunk without an announced transfer must not be written behind the last one
+    if (!this->_receiving) {
+      return;
     }
 
-    std::memcpy(&this->_content.data()[this->_receivedBytes], data, remainingBytes);
+    std::size_t headerSize = 0;
+    if (this->_chunkHeaders) {
+      ChunkHeader header;
+      std::memcpy(&header, data, sizeof(header));
+      if (header.sequence != this->_sequence) {
+        return;
+      }
+
+      if (header.offset != this->_receivedBytes) {
+        std::cerr << "TERR ON ND: Lost the chunks at " << this->_receivedBytes << " of transfer " << this->_sequence
+                  << ", received offset " << header.offset << std::endl;
+        this->_receiving = false;
+        this->changed();
+        return;
+      }
+      headerSize = sizeof(header);
+    }
+
+    std::size_t remainingBytes = this->_byteCount - this->_receivedBytes;
+    if (remainingBytes > this->payloadSize()) {
+      remainingBytes = this->payloadSize();
+    }
+
+    std::memcpy(&this->_arena[this->_receivedBytes], static_cast<const std::uint8_t*>(data) + headerSize, remainingBytes);
     this->_receivedBytes += remainingBytes;
 
-    if (this->_receivedBytes >= this->_expectedByteCount) {
+    if (this->_receivedBytes >= this->_byteCount) {
+      this->_receiving = false;
+      this->_complete = true;
+      this->changed();
+    } else if (this->_progressive) {
       this->changed();
     }
   }
@@ -221,7 +291,29 @@ class ClientDataAreaBuffered : public ClientDataAreaBase {
   bool allocateArea(bool readOnlyForOthers) { return this->allocateClientArea(readOnlyForOthers, ChunkSize); }
 
   /**
-   * @brief Sets an area object and sends it to the receivers
+   * @brief Set the progressive flag
+   * @param progressive True if the OnChange callback has to be triggered after every chunk of a transfer
+   */
+  void setProgressive(bool progressive) { this->_progressive = progressive; }
+
+  /**
+   * @brief Allocates the arena for the largest transfer, the arena is only reallocated if the capacity changes
+   * A running transfer is aborted.
+   * @param byteCount The maximum number of bytes of a transfer, 0 releases the arena
+   */
+  void setCapacity(std::size_t byteCount) {
+    if (byteCount != this->_arena.size()) {
+      // a new vector, the arena must not keep the memory of a larger capacity
+      this->_arena = std::vector<T>(byteCount, T());
+    }
+    this->_byteCount = 0;
+    this->_receiving = false;
+    this->_complete = false;
+  }
+
+  /**
+   * @brief Sets an area object and sends it in chunks to the receivers
+   * The transfer has to be prepared with reserve() and its data written into data().
    * @return true if the are is send
    * @return false if the setting failed
    */
@@ -233,46 +325,83 @@ class ClientDataAreaBuffered : public ClientDataAreaBase {
     HRESULT result = S_OK;
     std::size_t sentBytes = 0;
 
-    while (sentBytes < this->_content.size()) {
-      std::size_t remainingBytes = this->_content.size() - sentBytes;
-
-      if (remainingBytes >= ChunkSize) {
-        result &= SimConnect_SetClientData(*this->_connection, this->_dataId, this->_definitionId, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT,
-                                           0, ChunkSize, &this->_content.data()[sentBytes]);
-        sentBytes += ChunkSize;
-      } else {
-        std::array<T, ChunkSize> buffer{};
-        std::memcpy(buffer.data(), &this->_content.data()[sentBytes], remainingBytes);
-        result &= SimConnect_SetClientData(*this->_connection, this->_dataId, this->_definitionId, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT,
-                                           0, ChunkSize, buffer.data());
-        sentBytes += remainingBytes;
+    while (sentBytes < this->_byteCount) {
+      std::size_t payloadBytes = this->_byteCount - sentBytes;
+      if (payloadBytes > this->payloadSize()) {
+        payloadBytes = this->payloadSize();
+      }
+
+      std::size_t headerSize = 0;
+      if (this->_chunkHeaders) {
+        const ChunkHeader header = {this->_sequence, static_cast<std::uint32_t>(sentBytes)};
+        std::memcpy(this->_chunk.data(), &header, sizeof(header));
+        headerSize = sizeof(header);
       }
+      std::memcpy(&this->_chunk[headerSize], &this->_arena[sentBytes], payloadBytes);
+      // the last chunk is padded with the bytes of the previous one, the receiver only reads the announced bytes
+      result &= SimConnect_SetClientData(*this->_connection, this->_dataId, this->_definitionId, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT,
+                                         0, ChunkSize, this->_chunk.data());
+      sentBytes += payloadBytes;
     }
 
     return SUCCEEDED(result);
   }
 
   /**
-   * @brief Reserves internal data to receive the data
-   * @param expectedByteCount Number of expected bytes in streaming cases
+   * @brief Prepares the arena for a transfer
+   * @param byteCount Number of bytes of the transfer
+   * @param sequence The sequence in the chunk headers of the transfer
+   * @param chunkHeaders False if the chunks of the transfer have no headers, the sequence is ignored then
+   * @return true if the transfer fits into the arena
+   * @return false if the transfer is larger than the capacity, its chunks are ignored
    */
-  void reserve(std::size_t expectedByteCount) {
-    this->_expectedByteCount = expectedByteCount;
-    this->_content.reserve(expectedByteCount);
+  bool reserve(std::size_t byteCount, std::uint32_t sequence, bool chunkHeaders = true) {
+    const bool fits = byteCount <= this->_arena.size();
+    this->_byteCount = fits ? byteCount : 0;
     this->_receivedBytes = 0;
+    this->_sequence = sequence;
+    this->_chunkHeaders = chunkHeaders;
+    this->_receiving = fits && byteCount != 0;
+    this->_complete = false;
+    return fits;
   }
 
   /**
-   * @brief Returns a modifiable reference to the data container
-   * @return std::vector<T>& Reference to the data container
+   * @brief Returns the maximum number of bytes of a transfer
    */
-  std::vector<T>& data() { return this->_content; }
+  std::size_t capacity() const { return this->_arena.size(); }
 
   /**
-   * @brief Returns a constant reference to the data container
-   * @return std::vector<T>& Reference to the data container
+   * @brief Returns true if all chunks of the last transfer are received, false if chunks are lost or still expected
+   */
+  bool complete() const { return this->_complete; }
+
+  /**
+   * @brief Returns true while chunks of the transfer are expected
+   */
+  bool receiving() const { return this->_receiving; }
+
+  /**
+   * @brief Returns the number of bytes of the transfer that are received
+   */
+  std::size_t receivedBytes() const { return this->_receivedBytes; }
+
+  /**
+   * @brief Returns the number of bytes of the transfer
+   */
+  std::size_t size() const { return this->_byteCount; }
+
+  /**
+   * @brief Returns the first element of the arena
+   * @return T* The data of the transfer
+   */
+  T* data() { return this->_arena.data(); }
+
+  /**
+   * @brief Returns the first element of the arena
+   * @return const T* The data of the transfer
    */
-  const std::vector<T>& data() const { return this->_content; }
+  const T* data() const { return this->_arena.data(); }
 };
 
 }  // namespace simconnect
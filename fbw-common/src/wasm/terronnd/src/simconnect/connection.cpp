@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 
 #include "connection.hpp"
@@ -11,7 +12,11 @@ Connection::Connection()
       _lastClientDataDefinitionId(0),
       _simObjects(),
       _clientDataAreas(),
-      _lvarObjects() {}
+      _lvarObjects(),
+      _lvarTimers(),
+      _frameTime(),
+      _frameCount(0),
+      _frameGauges() {}
 
 Connection::~Connection() {
   this->disconnect();
@@ -38,6 +43,7 @@ void Connection::disconnect() {
     this->_simObjects.clear();
     this->_clientDataAreas.clear();
     this->_lvarObjects.clear();
+    this->_lvarTimers.clear();
   }
 }
 
@@ -87,21 +93,43 @@ void Connection::processDispatchMessage(SIMCONNECT_RECV* pData) {
   }
 }
 
-void Connection::updateLVarObjects() {
-  std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+void Connection::updateLVarObjects(std::chrono::steady_clock::time_point now) {
+  const auto tick = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() /
+                                               LVarTimerTickMs);
 
-  for (auto& object : this->_lvarObjects) {
-    if (object->updateRequired(now)) {
-      object->update(now);
+  this->_lvarTimers.advance(tick, [this](LVarObjectBase* object) {
+    // disabled objects are checked again after one revolution
+    if (object->_updateCycleMs < 0) {
+      this->_lvarTimers.schedule(object, LVarTimerSlots);
+      return;
     }
-  }
+
+    object->readValues();
+    this->_lvarTimers.schedule(object, static_cast<std::uint64_t>((object->_updateCycleMs + LVarTimerTickMs - 1) / LVarTimerTickMs));
+  });
+}
+
+bool Connection::readData(FsContext gauge) {
+  return this->readData(gauge, std::chrono::steady_clock::now());
 }
 
-bool Connection::readData() {
+bool Connection::readData(FsContext gauge, std::chrono::steady_clock::time_point now) {
   if (this->_connection == 0) {
     return false;
   }
 
+  // the first call of a frame processes the data, it is the one of a gauge that already read in the last frame
+  const bool newFrame =
+      this->_frameGauges.empty() || std::find(this->_frameGauges.cbegin(), this->_frameGauges.cend(), gauge) != this->_frameGauges.cend();
+  if (!newFrame) {
+    this->_frameGauges.push_back(gauge);
+    return true;
+  }
+  this->_frameGauges.clear();
+  this->_frameGauges.push_back(gauge);
+  this->_frameTime = now;
+  this->_frameCount += 1;
+
   DWORD cbData;
   SIMCONNECT_RECV* pData;
 
@@ -109,7 +137,7 @@ bool Connection::readData() {
     this->processDispatchMessage(pData);
   }
 
-  this->updateLVarObjects();
+  this->updateLVarObjects(now);
 
   return true;
 }
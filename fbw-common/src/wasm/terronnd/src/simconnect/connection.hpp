@@ -6,12 +6,15 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #include <MSFS/Legacy/gauges.h>
 #pragma clang diagnostic pop
+#include <chrono>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "../base/timerwheel.hpp"
 #include "clientdataarea.hpp"
 #include "lvarobject.hpp"
 #include "simobject.hpp"
@@ -23,6 +26,10 @@ namespace simconnect {
  */
 class Connection {
  private:
+  // the resolution of the update cycles of the named variables, one revolution of the wheel covers 640 ms
+  static constexpr std::int64_t LVarTimerTickMs = 10;
+  static constexpr std::size_t LVarTimerSlots = 64;
+
   HANDLE _connection;
   std::uint32_t _lastSimObjectId;
   std::uint32_t _lastClientDataId;
@@ -30,8 +37,13 @@ class Connection {
   std::map<std::uint32_t, std::shared_ptr<SimObjectBase>> _simObjects;
   std::map<std::uint32_t, std::shared_ptr<ClientDataAreaBase>> _clientDataAreas;
   std::list<std::shared_ptr<LVarObjectBase>> _lvarObjects;
+  base::TimerWheel<LVarObjectBase*, LVarTimerSlots> _lvarTimers;
+  std::chrono::steady_clock::time_point _frameTime;
+  std::uint64_t _frameCount;
+  // the gauges that read the data in the current frame
+  std::vector<FsContext> _frameGauges;
 
-  void updateLVarObjects();
+  void updateLVarObjects(std::chrono::steady_clock::time_point now);
   void processSimObjectData(const SIMCONNECT_RECV_SIMOBJECT_DATA* data);
   void processClientData(const SIMCONNECT_RECV_CLIENT_DATA* data);
   void processDispatchMessage(SIMCONNECT_RECV* pData);
@@ -58,10 +70,30 @@ class Connection {
   /**
    * @brief Processes the buffered data that is received during to readData calls
    * The registered areas and objects are automatically update
+   * The data is processed once per frame, the calls of the other gauges in the same frame return directly. A frame ends
+   * when a gauge calls again that already read the data in it, so a gauge that is not drawn does not stop the updates.
+   * @param gauge The context of the gauge in PANEL_SERVICE_PRE_DRAW
+   * @return true if data processing was possible
+   * @return false if something failed
+   */
+  bool readData(FsContext gauge);
+  /**
+   * @brief Processes the buffered data like readData() for a frame at the given time
+   * @param gauge The context of the gauge in PANEL_SERVICE_PRE_DRAW
+   * @param now The time of the frame, the host tools use it to simulate flights faster than in real time
    * @return true if data processing was possible
    * @return false if something failed
    */
-  bool readData();
+  bool readData(FsContext gauge, std::chrono::steady_clock::time_point now);
+  /**
+   * @brief Returns the time of the frame that readData processed last
+   * The gauges use it instead of reading the clock again in every callback.
+   */
+  std::chrono::steady_clock::time_point frameTime() const { return this->_frameTime; }
+  /**
+   * @brief Returns the number of frames that readData processed
+   */
+  std::uint64_t frameCount() const { return this->_frameCount; }
 
   /**
    * @brief Creates an object that handles simulator data
@@ -114,6 +146,8 @@ class Connection {
   std::shared_ptr<LVarObject<Strings...>> lvarObject() {
     auto newObject = std::shared_ptr<LVarObjectBase>(new LVarObject<Strings...>());
     this->_lvarObjects.push_back(newObject);
+    // the first update reads the values, the update cycle is set after the creation
+    this->_lvarTimers.schedule(newObject.get(), 1);
     return std::dynamic_pointer_cast<LVarObject<Strings...>>(newObject);
   }
 };
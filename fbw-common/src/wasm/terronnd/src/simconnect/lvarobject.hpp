@@ -4,8 +4,9 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #include <SimConnect.h>
 #pragma clang diagnostic pop
-#include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -21,31 +22,16 @@ class Connection;
 
 /**
  * @brief The base class to define the named aircraft objects
+ * The connection schedules the objects in a timer wheel and reads the values when the update cycle expired.
  */
 class LVarObjectBase : public base::Changeable {
   friend Connection;
 
  private:
-  std::chrono::system_clock::time_point _lastUpdateTime;
-  types::Time _updateCycleTime;
+  std::int64_t _updateCycleMs;
 
  protected:
-  LVarObjectBase() : _lastUpdateTime(), _updateCycleTime(-1 * types::millisecond) {}
-
-  bool updateRequired(const std::chrono::system_clock::time_point& now) {
-    if (_updateCycleTime.value() < 0.0f) {
-      return false;
-    }
-
-    types::Time dt =
-        static_cast<float>(std::chrono::duration_cast<std::chrono::milliseconds>(now - this->_lastUpdateTime).count()) * types::millisecond;
-    return dt >= this->_updateCycleTime;
-  }
-
-  void update(const std::chrono::system_clock::time_point& now) {
-    this->_lastUpdateTime = now;
-    this->readValues();
-  }
+  LVarObjectBase() : _updateCycleMs(-1) {}
 
   virtual void readValues() = 0;
 
@@ -59,7 +45,9 @@ class LVarObjectBase : public base::Changeable {
    * @brief Set the Update Cycle Time that is used to check if variables changed
    * @param cycleTime The time object that needs to pass until variables are read. A negative value disables the updates
    */
-  void setUpdateCycleTime(types::Time cycleTime) { this->_updateCycleTime = cycleTime; }
+  void setUpdateCycleTime(types::Time cycleTime) {
+    this->_updateCycleMs = static_cast<std::int64_t>(std::lround(cycleTime.convert(types::millisecond)));
+  }
 };
 
 /**
@@ -81,8 +81,8 @@ class SimObject : public SimObjectBase {
   }
 
  public:
-  virtual ~SimObject<T>() {}
-  SimObject<T>(const SimObject<T>&) = delete;
+  virtual ~SimObject() {}
+  SimObject(const SimObject<T>&) = delete;
 
   SimObject<T>& operator=(const SimObject<T>&) = delete;
 
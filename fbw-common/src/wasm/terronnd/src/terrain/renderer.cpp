@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "renderer.h"
+
+using namespace terrain;
+
+namespace {
+
+enum PaletteIndex : std::uint8_t { Transparent = 0, Black = 1, Green = 2, Amber = 3, Red = 4 };
+
+// RGBA bytes in memory order
+constexpr std::uint8_t PaletteColors[Renderer::PaletteSize][4] = {
+    {0, 0, 0, 0}, {4, 4, 4, 255}, {0, 255, 0, 255}, {255, 255, 0, 255}, {255, 0, 0, 255},
+};
+
+// the colors of the bands for the pixels (x & 1) | ((y & 1) << 1), the dot patterns have a density of 25 % and 50 %
+constexpr std::uint8_t BandPatterns[][4] = {
+    {Transparent, Transparent, Transparent, Transparent},
+    {Black, Black, Black, Black},
+    {Green, Black, Black, Black},
+    {Green, Black, Black, Green},
+    {Green, Green, Green, Green},
+    {Amber, Black, Black, Black},
+    {Amber, Black, Black, Amber},
+    {Red, Black, Black, Red},
+};
+
+constexpr float NauticalMilesPerDegree = 60.0f;
+constexpr float DegreesToRadians = 3.14159265f / 180.0f;
+
+}  // namespace
+
+Renderer::Renderer(std::uint16_t width, std::uint16_t height, std::uint16_t gridStep)
+    : _width(width),
+      _height(height),
+      _gridStep(std::max<std::uint16_t>(gridStep, 1)),
+      _gridWidth(0),
+      _gridHeight(0),
+      _grid(),
+      _samples(),
+      _bands(),
+      _indices(),
+      _histogram(),
+      _thresholds({-1, 0, -1, 0}),
+      _request(),
+      _sampledRows(0),
+      _expandedRows(0),
+      _classified(false) {
+  this->_gridWidth = static_cast<std::uint16_t>(width / this->_gridStep + 1);
+  this->_gridHeight = static_cast<std::uint16_t>(height / this->_gridStep + 1);
+  this->_grid.resize(static_cast<std::size_t>(this->_gridWidth) * this->_gridHeight);
+  this->_bands.resize(this->_grid.size());
+  this->_samples.reserve(this->_grid.size());
+  this->_indices.resize(static_cast<std::size_t>(width) * height);
+}
+
+const std::uint32_t* Renderer::palette() {
+  return reinterpret_cast<const std::uint32_t*>(PaletteColors);
+}
+
+float Renderer::maximum(const float* values, std::size_t count) {
+  // independent accumulators, the compiler keeps them in vector lanes
+  float lanes[4] = {-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                    -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      lanes[lane] = values[i + lane] > lanes[lane] ? values[i + lane] : lanes[lane];
+    }
+  }
+  for (; i < count; ++i) {
+    lanes[0] = values[i] > lanes[0] ? values[i] : lanes[0];
+  }
+  return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+}
+
+float Renderer::minimum(const float* values, std::size_t count) {
+  float lanes[4] = {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+                    std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      lanes[lane] = values[i + lane] < lanes[lane] ? values[i + lane] : lanes[lane];
+    }
+  }
+  for (; i < count; ++i) {
+    lanes[0] = values[i] < lanes[0] ? values[i] : lanes[0];
+  }
+  return std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+}
+
+float Renderer::percentile(const float* values,
+                           std::size_t count,
+                           float minimum,
+                           float bucketSize,
+                           float fraction,
+                           std::vector<std::uint32_t>& histogram) {
+  if (count == 0) {
+    return minimum;
+  }
+
+  histogram.assign(1, 0);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto bucket = static_cast<std::size_t>((values[i] - minimum) / bucketSize);
+    if (bucket >= histogram.size()) {
+      histogram.resize(bucket + 1, 0);
+    }
+    histogram[bucket] += 1;
+  }
+
+  const auto target = static_cast<std::size_t>(fraction * static_cast<float>(count));
+  std::size_t accumulated = 0;
+  for (std::size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+    accumulated += histogram[bucket];
+    if (accumulated > target) {
+      return minimum + static_cast<float>(bucket) * bucketSize;
+    }
+  }
+  return minimum + static_cast<float>(histogram.size() - 1) * bucketSize;
+}
+
+std::uint8_t Renderer::level(const ElevationTileCache& cache, float range) const {
+  const float nauticalMilesPerPixel = range / static_cast<float>(this->_height);
+  return cache.selectLevel(static_cast<float>(this->_gridStep) * nauticalMilesPerPixel / NauticalMilesPerDegree);
+}
+
+void Renderer::sample(ElevationTileCache& cache, std::uint16_t firstRow, std::uint16_t rowCount) {
+  const Request& request = this->_request;
+  const float centerX = static_cast<float>(this->_width) * 0.5f;
+  const float centerY = request.arcMode ? static_cast<float>(this->_height) : static_cast<float>(this->_height) * 0.5f;
+  const float radius = request.arcMode ? static_cast<float>(this->_height) : static_cast<float>(this->_height) * 0.5f;
+  const float nauticalMilesPerPixel = request.range / static_cast<float>(this->_height);
+
+  const float sinHeading = std::sin(request.heading * DegreesToRadians);
+  const float cosHeading = std::cos(request.heading * DegreesToRadians);
+  const float longitudeScale = 1.0f / (NauticalMilesPerDegree * std::max(std::cos(request.latitude * DegreesToRadians), 0.01f));
+  const std::uint8_t level = this->level(cache, request.range);
+
+  for (std::uint16_t gridY = firstRow; gridY < firstRow + rowCount; ++gridY) {
+    for (std::uint16_t gridX = 0; gridX < this->_gridWidth; ++gridX) {
+      const std::size_t cell = static_cast<std::size_t>(gridY) * this->_gridWidth + gridX;
+      const float right = static_cast<float>(gridX * this->_gridStep) - centerX;
+      const float forward = centerY - static_cast<float>(gridY * this->_gridStep);
+      if (right * right + forward * forward > radius * radius) {
+        this->_bands[cell] = Band::Outside;
+        continue;
+      }
+
+      // the picture is heading up
+      const float north = (forward * cosHeading - right * sinHeading) * nauticalMilesPerPixel;
+      const float east = (forward * sinHeading + right * cosHeading) * nauticalMilesPerPixel;
+      const float elevation =
+          cache.elevation(level, request.latitude + north / NauticalMilesPerDegree, request.longitude + east * longitudeScale);
+      this->_grid[cell] = elevation;
+      this->_bands[cell] = Band::NoTerrain;
+      this->_samples.push_back(elevation);
+    }
+  }
+}
+
+void Renderer::classify() {
+  const Request& request = this->_request;
+  if (this->_samples.empty()) {
+    this->_thresholds = {-1, 0, -1, 0};
+    return;
+  }
+
+  const float highest = Renderer::maximum(this->_samples.data(), this->_samples.size());
+  const float lowest = Renderer::minimum(this->_samples.data(), this->_samples.size());
+  const float amberLimit = request.gearDown ? -250.0f : -500.0f;
+
+  auto relativeBand = [&](float elevation) {
+    const float relative = elevation - request.altitude;
+    if (relative > 2000.0f) {
+      return Band::RedHigh;
+    } else if (relative > 1000.0f) {
+      return Band::AmberHigh;
+    } else if (relative > amberLimit) {
+      return Band::AmberLow;
+    } else if (relative > -1000.0f) {
+      return Band::GreenHigh;
+    } else if (relative > -2000.0f) {
+      return Band::GreenLow;
+    }
+    return Band::NoTerrain;
+  };
+  auto thresholdMode = [](Band band) {
+    if (band == Band::RedHigh) {
+      return types::ThresholdMode::WARNING;
+    } else if (band == Band::AmberHigh || band == Band::AmberLow) {
+      return types::ThresholdMode::CAUTION;
+    }
+    return types::ThresholdMode::PEAKS_MODE;
+  };
+
+  // the peaks mode shows the upper half of the terrain if all terrain is more than 2000 ft below the aircraft
+  const bool peaksMode = highest <= request.altitude - 2000.0f;
+  float lower = std::max(lowest, request.altitude - 2000.0f);
+  if (peaksMode) {
+    lower = Renderer::percentile(this->_samples.data(), this->_samples.size(), lowest, 100.0f, 0.5f, this->_histogram);
+  }
+  const float third = (highest - lower) / 3.0f;
+
+  for (std::size_t cell = 0; cell < this->_bands.size(); ++cell) {
+    // the sea is not drawn
+    if (this->_bands[cell] == Band::Outside || this->_grid[cell] <= 0.0f) {
+      continue;
+    }
+
+    const float elevation = this->_grid[cell];
+    if (!peaksMode) {
+      this->_bands[cell] = relativeBand(elevation);
+    } else if (elevation >= lower + 2.0f * third) {
+      this->_bands[cell] = Band::GreenSolid;
+    } else if (elevation >= lower + third) {
+      this->_bands[cell] = Band::GreenHigh;
+    } else if (elevation >= lower) {
+      this->_bands[cell] = Band::GreenLow;
+    }
+  }
+
+  this->_thresholds.lower = static_cast<std::int16_t>(std::lround(lower));
+  this->_thresholds.upper = static_cast<std::int16_t>(std::lround(highest));
+  this->_thresholds.lowerMode = peaksMode ? types::ThresholdMode::PEAKS_MODE : thresholdMode(relativeBand(lower));
+  this->_thresholds.upperMode = peaksMode ? types::ThresholdMode::PEAKS_MODE : thresholdMode(relativeBand(highest));
+}
+
+void Renderer::expand(std::uint16_t firstRow, std::uint16_t rowCount) {
+  const std::uint16_t halfStep = this->_gridStep / 2;
+  for (std::uint16_t y = firstRow; y < firstRow + rowCount; ++y) {
+    const std::size_t gridRow = static_cast<std::size_t>((y + halfStep) / this->_gridStep) * this->_gridWidth;
+    const std::uint8_t* bands = &this->_bands[gridRow];
+    std::uint8_t* row = &this->_indices[static_cast<std::size_t>(y) * this->_width];
+    const std::size_t patternRow = static_cast<std::size_t>(y & 1) << 1;
+
+    for (std::uint16_t x = 0; x < this->_width; ++x) {
+      row[x] = BandPatterns[bands[(x + halfStep) / this->_gridStep]][patternRow | (x & 1)];
+    }
+  }
+}
+
+void Renderer::render(ElevationTileCache& cache, const Request& request) {
+  this->begin(request);
+  while (!this->advance(cache, this->_gridHeight)) {
+  }
+}
+
+void Renderer::begin(const Request& request) {
+  this->_request = request;
+  this->_sampledRows = 0;
+  this->_expandedRows = 0;
+  this->_classified = false;
+  this->_samples.clear();
+}
+
+bool Renderer::advance(ElevationTileCache& cache, std::uint16_t gridRows) {
+  gridRows = std::max<std::uint16_t>(gridRows, 1);
+
+  if (this->_sampledRows < this->_gridHeight) {
+    if (this->_sampledRows == 0) {
+      cache.beginPass();
+    }
+    const auto rowCount = std::min<std::uint16_t>(gridRows, this->_gridHeight - this->_sampledRows);
+    this->sample(cache, this->_sampledRows, rowCount);
+    this->_sampledRows += rowCount;
+    return false;
+  }
+
+  // the thresholds need all samples, the classification is linear in the cells of the grid
+  if (!this->_classified) {
+    this->classify();
+    this->_classified = true;
+  }
+
+  const auto rowCount = static_cast<std::uint16_t>(
+      std::min<std::uint32_t>(static_cast<std::uint32_t>(gridRows) * this->_gridStep, this->_height - this->_expandedRows));
+  this->expand(this->_expandedRows, rowCount);
+  this->_expandedRows += rowCount;
+  return this->_expandedRows >= this->_height;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../types/simbridge.h"
+#include "ElevationTileCache.h"
+
+namespace terrain {
+
+/**
+ * @brief Renders the EGPWC terrain picture of the ND from the elevation tile cache
+ *
+ * The picture uses the geometry of the SimBridge frames: in ARC mode the aircraft is in the bottom center and the range
+ * is the height of the picture, in ROSE mode the aircraft is in the center and half the range is half the height.
+ * The elevations are sampled on a coarse grid and expanded to the pixels with the dot patterns of the EGPWC.
+ * Tiles that are not decoded yet are drawn from coarser levels, a later picture shows them in full resolution.
+ * A picture can be rendered in bands of grid rows over several frames to bound the time per frame.
+ */
+class Renderer {
+ public:
+  struct Request {
+    float latitude;
+    float longitude;
+    float altitude;
+    float heading;
+    float range;
+    bool arcMode;
+    bool gearDown;
+  };
+
+  struct Thresholds {
+    std::int16_t lower;
+    std::uint8_t lowerMode;
+    std::int16_t upper;
+    std::uint8_t upperMode;
+  };
+
+  static constexpr std::uint8_t PaletteSize = 5;
+
+ private:
+  /**
+   * @brief The color and density of a grid cell
+   */
+  enum Band : std::uint8_t {
+    Outside = 0,
+    NoTerrain,
+    GreenLow,
+    GreenHigh,
+    GreenSolid,
+    AmberLow,
+    AmberHigh,
+    RedHigh,
+    BandCount,
+  };
+
+  std::uint16_t _width;
+  std::uint16_t _height;
+  std::uint16_t _gridStep;
+  std::uint16_t _gridWidth;
+  std::uint16_t _gridHeight;
+  std::vector<float> _grid;
+  std::vector<float> _samples;
+  std::vector<std::uint8_t> _bands;
+  std::vector<std::uint8_t> _indices;
+  std::vector<std::uint32_t> _histogram;
+  Thresholds _thresholds;
+  // the state of the picture that is rendered in bands
+  Request _request;
+  std::uint16_t _sampledRows;
+  std::uint16_t _expandedRows;
+  bool _classified;
+
+  void sample(ElevationTileCache& cache, std::uint16_t firstRow, std::uint16_t rowCount);
+  void classify();
+  void expand(std::uint16_t firstRow, std::uint16_t rowCount);
+
+ public:
+  /**
+   * @brief Creates a renderer for pictures of a fixed size
+   * @param width The width of the picture in pixels
+   * @param height The height of the picture in pixels
+   * @param gridStep The distance between two elevation samples in pixels
+   */
+  Renderer(std::uint16_t width, std::uint16_t height, std::uint16_t gridStep);
+  Renderer(const Renderer&) = delete;
+
+  Renderer& operator=(const Renderer&) = delete;
+
+  /**
+   * @brief Renders the picture and derives the elevation thresholds
+   * @param cache The cache of the opened elevation file
+   * @param request The position, altitude [ft], heading [°] and range [nm] of the aircraft
+   */
+  void render(ElevationTileCache& cache, const Request& request);
+  /**
+   * @brief Starts a picture that advance() renders in bands, a picture that is not complete yet is dropped
+   * @param request The position, altitude [ft], heading [°] and range [nm] of the aircraft
+   */
+  void begin(const Request& request);
+  /**
+   * @brief Renders the next band of the picture of begin()
+   * The grid rows are sampled first, the thresholds are derived after the last row and the pixels are expanded afterwards,
+   * both in bands of the same number of grid rows.
+   * @param cache The cache of the opened elevation file
+   * @param gridRows The number of grid rows of the band
+   * @return true if the picture and its thresholds are complete
+   */
+  bool advance(ElevationTileCache& cache, std::uint16_t gridRows);
+  /**
+   * @brief Returns the level of the elevation file that a picture of the range is sampled from
+   * @param cache The cache of the opened elevation file
+   * @param range The range of the picture [nm]
+   */
+  std::uint8_t level(const ElevationTileCache& cache, float range) const;
+
+  std::uint16_t width() const { return this->_width; }
+  std::uint16_t height() const { return this->_height; }
+  /**
+   * @brief Returns the palette indices of the last picture in rows from the top
+   */
+  const std::vector<std::uint8_t>& indices() const { return this->_indices; }
+  /**
+   * @brief Returns the RGBA colors of the palette indices
+   */
+  static const std::uint32_t* palette();
+  const Thresholds& thresholds() const { return this->_thresholds; }
+
+  /**
+   * @brief Returns the largest value of the samples
+   */
+  static float maximum(const float* values, std::size_t count);
+  /**
+   * @brief Returns the smallest value of the samples
+   */
+  static float minimum(const float* values, std::size_t count);
+  /**
+   * @brief Returns the percentile of the samples with a resolution of bucketSize, the histogram is scratch memory
+   */
+  static float percentile(const float* values,
+                          std::size_t count,
+                          float minimum,
+                          float bucketSize,
+                          float fraction,
+                          std::vector<std::uint32_t>& histogram);
+};
+
+}  // namespace terrain
@@ -41,7 +41,7 @@ class Quantity {
                      std::ratio_divide<A, std::ratio<2>>>
   sqrt() const {
     return Quantity<std::ratio_divide<M, std::ratio<2>>, std::ratio_divide<L, std::ratio<2>>, std::ratio_divide<T, std::ratio<2>>,
-                    std::ratio_divide<A, std::ratio<2>>>(std::sqrtf(this->m_value));
+                    std::ratio_divide<A, std::ratio<2>>>(std::sqrt(this->m_value));
   }
   constexpr Quantity<M, L, T, A> abs() const { return Quantity<M, L, T, A>(std::abs(this->m_value)); }
 };
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <SimConnect.h>
 #include <cstdint>
 
 namespace types {
@@ -44,8 +43,43 @@ struct AircraftStatusData {
 
 enum ThresholdMode : std::uint8_t { PEAKS_MODE = 0, WARNING = 1, CAUTION = 2 };
 
+/**
+ * @brief The encoding of the frame data that follows the threshold data
+ * COMPRESSED_IMAGE is a compressed image file that nanovg decodes and the only format of protocol version 0, PALETTE_RLE is
+ * described by PaletteFrameHeader and TILE_DELTA by TileDeltaHeader
+ */
+enum FrameFormat : std::uint8_t { COMPRESSED_IMAGE = 0, PALETTE_RLE = 1, TILE_DELTA = 2 };
+
+/**
+ * @brief Client data area block that the gauge publishes for the SimBridge to negotiate the terrain on ND protocol
+ * The capabilities have the bit 1 << format set for every FrameFormat that the gauge decodes. A SimBridge that knows the
+ * handshake speaks the lower of both versions and echoes it in the FrameInfoData of every frame.
+ *
+ * The versions of the protocol:
+ *  - 0: SimBridge releases before the handshake, the threshold data is followed by a compressed image in chunks without headers
+ *  - 1: the FrameInfoData precedes the threshold data of every frame and every chunk starts with a simconnect::ChunkHeader
+ */
+struct ProtocolData {
+  std::uint16_t version;
+  std::uint16_t capabilities;
+} __attribute__((packed));
+
+/**
+ * @brief The frame info that a SimBridge of protocol version 1 or later sends right before the threshold data of a frame
+ * The frame id numbers the pictures of the SimBridge, a picture that is sent to both sides has the same id on both sides.
+ * An id of 0 marks a frame that is not shared between the displays. The transfer id counts the frames that are sent to a
+ * display, independent of the frame id, and the chunk headers of the frame data carry it.
+ */
+struct FrameInfoData {
+  std::uint16_t protocolVersion;
+  std::uint8_t frameFormat;
+  std::uint32_t frameId;
+  std::uint32_t transferId;
+} __attribute__((packed));
+
 /**
  * @brief The threshold data that is received from the SimBridge for a new frame
+ * The layout is the one of protocol version 0, the fields of later versions are part of the FrameInfoData.
  */
 struct ThresholdData {
   std::int16_t lowerThreshold;
@@ -58,4 +92,37 @@ struct ThresholdData {
   std::uint32_t frameByteCount;
 } __attribute__((packed));
 
+/**
+ * @brief The header of a PALETTE_RLE frame
+ *
+ * The header is followed by paletteSize RGBA colors with four bytes each and the pixels in rows from the top.
+ * The pixels are coded in packets, the control byte of a packet defines the content:
+ *  - 0x00 - 0x7f: a run of control + 1 pixels with the palette index of the next byte
+ *  - 0x80 - 0xbf: control - 0x7f literal palette indices follow
+ *  - 0xc0 - 0xff: control - 0xbf repetitions of the pair of palette indices in the next two bytes, the dot patterns of the EGPWC
+ * Packets may continue in the next row.
+ */
+struct PaletteFrameHeader {
+  std::uint16_t width;
+  std::uint16_t height;
+  std::uint8_t paletteSize;
+} __attribute__((packed));
+
+/**
+ * @brief The header of a TILE_DELTA frame
+ *
+ * The image is split into tiles of tileSize x tileSize pixels, numbered in rows from the top left. Only the tiles that
+ * changed since the last frame are sent, the first frame after a reset contains all tiles.
+ * The header is followed by the palette like in PALETTE_RLE and tileCount tiles. A tile starts with its index as
+ * std::uint16_t, followed by the packets of PALETTE_RLE for its pixels in rows. Tiles at the right and bottom border are
+ * clipped to the image.
+ */
+struct TileDeltaHeader {
+  std::uint16_t width;
+  std::uint16_t height;
+  std::uint8_t tileSize;
+  std::uint8_t paletteSize;
+  std::uint16_t tileCount;
+} __attribute__((packed));
+
 }  // namespace types
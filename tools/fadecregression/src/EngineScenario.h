@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+/// Number of engines of the largest aircraft run by the harness
+const int MAX_ENGINE_COUNT = 4;
+
+/// <summary>
+/// Cockpit switches and sim spool speeds of one engine at the end of a phase
+/// </summary>
+struct EngineTarget {
+  double starter;  // GENERAL ENG STARTER
+  double igniter;  // TURB ENG IGNITION SWITCH EX1, 1 normal and 2 start
+  double n1;       // %
+  double nCore;    // TURB ENG N2 of the sim, N2 on the A32NX and N3 on the A380X (%)
+};
+
+/// <summary>
+/// Segment of the scripted engine run. Switches, the ground flag and the pause apply from the start of the phase,
+/// the spool speeds and the atmosphere ramp linearly from the end of the previous phase to the values given here.
+/// </summary>
+struct EnginePhase {
+  const char* name;
+  double duration;         // s
+  double altitude;         // ft
+  double mach;
+  double ambientTemp;      // degC
+  double ambientPressure;  // hPa
+  bool onGround;
+  bool paused;
+  std::array<EngineTarget, MAX_ENGINE_COUNT> engines;
+};
+
+/// All engines set alike
+inline std::array<EngineTarget, MAX_ENGINE_COUNT> allEngines(const EngineTarget& target) {
+  return {target, target, target, target};
+}
+
+/// Engine 1 set apart from the others
+inline std::array<EngineTarget, MAX_ENGINE_COUNT> engineOneApart(const EngineTarget& engineOne, const EngineTarget& others) {
+  return {engineOne, others, others, others};
+}
+
+/// <summary>
+/// Ground start, takeoff, climb, a pause, an in-flight shutdown and relight of engine 1, descent, landing and shutdown.
+/// The same script runs on both aircraft, so the engine procedures are exercised alike on each of them.
+/// </summary>
+inline std::vector<EnginePhase> scriptedEngineRun() {
+  const EngineTarget off = {0, 1, 0, 0};
+  return {
+      {"cold and dark", 5, 0, 0, 15, 1013.25, true, false, allEngines(off)},
+      {"engine start", 50, 0, 0, 15, 1013.25, true, false, allEngines({1, 2, 21, 75})},
+      {"idle", 20, 0, 0, 15, 1013.25, true, false, allEngines({1, 1, 20, 70})},
+      {"takeoff roll", 30, 0, 0.25, 15, 1013.25, true, false, allEngines({1, 1, 88, 97})},
+      {"initial climb", 40, 5000, 0.4, 5, 843, false, false, allEngines({1, 1, 90, 97})},
+      {"climb", 60, 30000, 0.78, -44, 301, false, false, allEngines({1, 1, 90, 96})},
+      {"cruise", 30, 35000, 0.78, -54, 238, false, false, allEngines({1, 1, 85, 94})},
+      {"pause", 5, 35000, 0.78, -54, 238, false, true, allEngines({1, 1, 85, 94})},
+      {"engine 1 shutdown", 40, 35000, 0.78, -54, 238, false, false, engineOneApart({0, 1, 8, 20}, {1, 1, 87, 95})},
+      {"engine 1 relight", 50, 35000, 0.78, -54, 238, false, false, engineOneApart({1, 2, 85, 94}, {1, 1, 85, 94})},
+      {"descent", 60, 3000, 0.35, 9, 908, false, false, allEngines({1, 1, 30, 75})},
+      {"landing", 30, 0, 0.1, 15, 1013.25, true, false, allEngines({1, 1, 25, 70})},
+      {"engine shutdown", 90, 0, 0, 15, 1013.25, true, false, allEngines(off)},
+  };
+}
@@ -0,0 +1,242 @@
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// the stand-in needs to be included before the FADEC headers
+#include "GaugeStandIn.h"
+
+#include "EngineControl.h"
+
+#include "EngineScenario.h"
+#include "GoldenTrace.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+#ifdef FADEC_A380X
+const char* AIRCRAFT = "a380x";
+using EngineTraits = A380xEngineTraits;
+#else
+const char* AIRCRAFT = "a32nx";
+using EngineTraits = A32nxEngineTraits;
+#endif
+
+const int ENGINE_COUNT = EngineTraits::ENGINE_COUNT;
+const int TANK_COUNT = EngineTraits::TANK_COUNT;
+/// SimConnect data definitions written by the FADEC, all definitions before the simulation data
+const int DATA_DEFINITION_COUNT = DataTypesID::SimulationDataTypeId;
+
+const double FRAME_TIME = 0.1;  // s
+const double FUEL_WEIGHT_GALLON = 6.7;  // LBS
+const double KGS_TO_LBS = 1 / 0.4535934;
+/// Engine imbalance code of the A32NX: engine 1 with EGT, FF, N2, oil quantity, oil pressure, idle oil pressure and max oil temperature
+const double IMBALANCE_CODE = 115201005120790;
+const double OIL_TOTAL = 17;  // qt
+
+/// <summary>
+/// Applies the cockpit and sim side of a frame: switches, spool speeds, atmosphere and the fuel the engines burnt
+/// </summary>
+void applyFrame(SimulatedGauge& gauge, const EnginePhase& previous, const EnginePhase& phase, double phaseTime, double& animationTime) {
+  double f = phase.duration > 0 ? std::min(1.0, phaseTime / phase.duration) : 1;
+  auto ramp = [f](double from, double to) { return from + (to - from) * f; };
+
+  gauge.aircraftVar("PRESSURE ALTITUDE", 0) = ramp(previous.altitude, phase.altitude);
+  gauge.aircraftVar("AIRSPEED MACH", 0) = ramp(previous.mach, phase.mach);
+  gauge.aircraftVar("AMBIENT TEMPERATURE", 0) = ramp(previous.ambientTemp, phase.ambientTemp);
+  gauge.aircraftVar("AMBIENT PRESSURE", 0) = ramp(previous.ambientPressure, phase.ambientPressure);
+  gauge.aircraftVar("SIM ON GROUND", 0) = phase.onGround ? 1 : 0;
+
+  // the FADEC detects a pause by the animation delta time not changing between frames
+  if (!phase.paused) {
+    animationTime += FRAME_TIME;
+  }
+  gauge.aircraftVar("ANIMATION DELTA TIME", 0) = animationTime;
+
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    const EngineTarget& from = previous.engines[engine];
+    const EngineTarget& to = phase.engines[engine];
+    double n1 = ramp(from.n1, to.n1);
+    gauge.aircraftVar("GENERAL ENG STARTER", engine + 1) = to.starter;
+    gauge.aircraftVar("TURB ENG IGNITION SWITCH EX1", engine + 1) = to.igniter;
+    gauge.aircraftVar("TURB ENG CORRECTED N1", engine + 1) = n1;
+    gauge.aircraftVar("TURB ENG N1", engine + 1) = n1;
+    gauge.aircraftVar("TURB ENG N2", engine + 1) = ramp(from.nCore, to.nCore);
+    gauge.aircraftVar("TURB ENG JET THRUST", engine + 1) = n1 * 300;
+  }
+
+  if (phase.paused) {
+    return;
+  }
+
+  // the sim burns the fuel flow the FADEC computed from the feed tanks
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    double fuelFlow = gauge.namedVar(fmt::format("A32NX_ENGINE_FF:{}", engine + 1));  // KG/H
+    double& quantity = gauge.aircraftVar("FUELSYSTEM TANK QUANTITY", EngineTraits::FEED_TANKS[engine] + 1);
+    quantity = std::max(0.0, quantity - fuelFlow * FRAME_TIME / 3600 * KGS_TO_LBS / FUEL_WEIGHT_GALLON);
+  }
+}
+
+/// <summary>
+/// Tank written by a SimConnect data definition, -1 if the definition is not a tank
+/// </summary>
+int tankOf(DWORD defineId) {
+  for (int tank = 0; tank < TANK_COUNT; tank++) {
+    if (static_cast<DWORD>(EngineTraits::TANKS[tank].dataType) == defineId) {
+      return tank;
+    }
+  }
+  return -1;
+}
+
+/// <summary>
+/// Runs the scripted engine run through a freshly initialized FADEC and records all LVars and SimConnect writes
+/// </summary>
+/// <remarks>The pump states run on wall clock timers and are left out.</remarks>
+GoldenTrace run() {
+  SimulatedGauge gauge;
+  currentGauge = &gauge;
+
+  std::vector<EnginePhase> phases = scriptedEngineRun();
+  const EnginePhase& first = phases.front();
+  gauge.aircraftVar("FUEL WEIGHT PER GALLON", 0) = FUEL_WEIGHT_GALLON;
+  gauge.aircraftVar("AMBIENT TEMPERATURE", 0) = first.ambientTemp;
+  gauge.aircraftVar("AMBIENT PRESSURE", 0) = first.ambientPressure;
+  gauge.aircraftVar("SIM ON GROUND", 0) = first.onGround ? 1 : 0;
+  const EngineTraits::ConfigurationType configuration;
+  for (int tank = 0; tank < TANK_COUNT; tank++) {
+    gauge.aircraftVar("FUELSYSTEM TANK QUANTITY", tank + 1) = configuration.*EngineTraits::CONFIGURATION_ENTRIES[tank].value;
+  }
+
+  // value initialized like the global instance of the gauge
+  auto engineControl = std::make_unique<EngineControl>();
+  engineControl->setFuelStateSaving(false);
+  engineControl->initialize("FADECREGRESSION");
+
+  // the imbalance and the oil quantities are random, they are fixed for the run
+  gauge.namedVar("A32NX_ENGINE_IMBALANCE") = IMBALANCE_CODE;
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    gauge.namedVar(fmt::format("A32NX_ENGINE_OIL_TOTAL:{}", engine + 1)) = OIL_TOTAL;
+  }
+  gauge.namedVar("A32NX_IS_READY") = 1;
+
+  GoldenTrace trace;
+  std::vector<int> namedIds;
+  for (int id = 0; id < static_cast<int>(namedVariables.size()); id++) {
+    if (namedVariables.name(id).find("PUMP_STATE") == std::string::npos) {
+      namedIds.push_back(id);
+      trace.names.push_back(namedVariables.name(id));
+    }
+  }
+  for (int defineId = 0; defineId < DATA_DEFINITION_COUNT; defineId++) {
+    trace.names.push_back(fmt::format("DATA:{}", defineId));
+  }
+
+  std::vector<double> written(DATA_DEFINITION_COUNT, std::numeric_limits<double>::quiet_NaN());
+  double time = 0;
+  double animationTime = 0;
+  for (size_t index = 0; index < phases.size(); index++) {
+    const EnginePhase& phase = phases[index];
+    const EnginePhase& previous = phases[index > 0 ? index - 1 : 0];
+    uint64_t frames = static_cast<uint64_t>(std::llround(phase.duration / FRAME_TIME));
+    for (uint64_t frame = 0; frame < frames; frame++) {
+      time += FRAME_TIME;
+      applyFrame(gauge, previous, phase, (frame + 1) * FRAME_TIME, animationTime);
+      engineControl->update(FRAME_TIME, time);
+
+      for (const auto& [defineId, value] : gauge.objectData) {
+        if (defineId < static_cast<DWORD>(DATA_DEFINITION_COUNT)) {
+          written[defineId] = value;
+        }
+        int tank = tankOf(defineId);
+        if (tank >= 0) {
+          gauge.aircraftVar("FUELSYSTEM TANK QUANTITY", tank + 1) = value;
+        }
+      }
+      gauge.objectData.clear();
+
+      std::vector<double> values;
+      values.reserve(trace.names.size());
+      for (int id : namedIds) {
+        values.push_back(gauge.namedVar(id));
+      }
+      values.insert(values.end(), written.begin(), written.end());
+      trace.times.push_back(time);
+      trace.frames.push_back(std::move(values));
+    }
+  }
+  return trace;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  std::string goldenDirectory = FADECREGRESSION_GOLDEN_DIRECTORY;
+  double absTolerance = 1e-9;
+  double relTolerance = 1e-9;
+  uint32_t topCount = 10;
+  bool record = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(fmt::format("Checks the engine control of the {} FADEC against its golden trace", AIRCRAFT));
+  args.addArgument({"-r", "--record"}, &record, "Record the golden trace instead of checking against it");
+  args.addArgument({"-d", "--directory"}, &goldenDirectory, "Directory of the golden traces");
+  args.addArgument({"-a", "--abs-tolerance"}, &absTolerance, "Absolute tolerance of the outputs");
+  args.addArgument({"-e", "--rel-tolerance"}, &relTolerance, "Relative tolerance of the outputs");
+  args.addArgument({"-t", "--top"}, &topCount, "Number of diverging output fields to print");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  std::string path = (std::filesystem::path(goldenDirectory) / fmt::format("{}_engines.trace", AIRCRAFT)).string();
+  GoldenTrace actual = run();
+
+  if (record) {
+    std::filesystem::create_directories(goldenDirectory);
+    if (!actual.write(path)) {
+      fmt::print("Cannot write {}!\n", path);
+      return 1;
+    }
+    fmt::print("Recorded {} frames of {} outputs to {}\n", actual.frames.size(), actual.names.size(), path);
+    return 0;
+  }
+
+  GoldenTrace golden;
+  if (!golden.read(path)) {
+    fmt::print("Cannot read golden trace {}, record it first!\n", path);
+    return 1;
+  }
+
+  TraceComparison comparison = compareTraces(golden, actual, absTolerance, relTolerance);
+  fmt::print("{} engines: {}\n", AIRCRAFT, comparison.passed() ? "passed" : "FAILED");
+  for (const auto& name : comparison.addedFields) {
+    fmt::print("  added field   {}\n", name);
+  }
+  for (const auto& name : comparison.removedFields) {
+    fmt::print("  removed field {}\n", name);
+  }
+  if (comparison.frameCountDiffers) {
+    fmt::print("  {} frames, golden has {}\n", actual.frames.size(), golden.frames.size());
+  }
+  for (size_t i = 0; i < std::min<size_t>(topCount, comparison.mismatches.size()); i++) {
+    const auto& field = comparison.mismatches[i];
+    fmt::print("  {:<40} at {:7.2f} s golden {:<12.6g} actual {:<12.6g} max deviation {:<12.6g} in {} frames\n", field.name,
+               field.firstTime, field.goldenValue, field.actualValue, field.maxDeviation, field.framesDifferent);
+  }
+  return comparison.passed() ? 0 : 1;
+}
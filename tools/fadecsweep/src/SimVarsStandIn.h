@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+/// <summary>
+/// Stand-in for the parts of the MSFS gauge API the FADEC model headers are built on.
+/// The sweep only uses the pure model functions, so the SimVars class compiles against these
+/// but none of its accessors are ever called.
+/// </summary>
+
+typedef void* HANDLE;
+typedef double FLOAT64;
+typedef int ID;
+typedef int ENUM;
+
+inline ENUM get_units_enum(const char*) {
+  return 0;
+}
+
+inline ENUM get_aircraft_var_enum(const char*) {
+  return 0;
+}
+
+inline FLOAT64 aircraft_varget(ENUM, ENUM, int) {
+  return 0;
+}
+
+inline ID register_named_variable(const char*) {
+  return 0;
+}
+
+inline FLOAT64 get_named_variable_value(ID) {
+  return 0;
+}
+
+inline void set_named_variable_value(ID, FLOAT64) {}
@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// the stand-in needs to be included before the FADEC model headers
+#include "SimVarsStandIn.h"
+
+#include "RegPolynomials.h"
+#include "Tables.h"
+#include "ThrustLimits.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+#ifdef FADEC_A380X
+const char* AIRCRAFT = "A380X";
+#else
+const char* AIRCRAFT = "A32NX";
+#endif
+
+const double LBS_TO_KGS = 0.4535934;
+
+/// bleed configurations are encoded as bit field: 1 - packs, 2 - nacelle anti-ice, 4 - wing anti-ice
+const int BLEED_CONFIGURATION_COUNT = 8;
+
+/// number of points evaluated (and buffered as text) before the output is flushed
+const uint64_t SWEEP_BATCH_SIZE = 1 << 20;
+
+/// <summary>
+/// Inclusive range of one sweep dimension
+/// </summary>
+struct SweepRange {
+  double min;
+  double max;
+  double step;
+
+  uint32_t count() const {
+    if (step <= 0 || max < min) {
+      return 1;
+    }
+    return static_cast<uint32_t>(std::floor((max - min) / step + 1e-9)) + 1;
+  }
+
+  double value(uint32_t index) const { return min + index * step; }
+};
+
+struct SweepPoint {
+  double altitude;     // ft (pressure altitude)
+  double mach;         // -
+  double ambientTemp;  // degC
+  int bleed;           // bit field, see BLEED_CONFIGURATION_COUNT
+};
+
+struct SweepResult {
+  double idleN1;       // %
+  double idleNCore;    // % (N2 on the A32NX, N3 on the A380X)
+  double idleFF;       // kg/h
+  double idleEGT;      // degC
+  double limitTo;      // % N1
+  double limitGa;      // % N1
+  double limitClb;     // % N1
+  double limitMct;     // % N1
+  double climbCFF;     // lbs/h (corrected, at the CLB limit)
+  double climbCEGT;    // degC (corrected, at the CLB limit)
+};
+
+/// <summary>
+/// ISA static pressure for a given pressure altitude
+/// </summary>
+/// <returns>Pressure in hPa.</returns>
+double isaPressure(double altitude) {
+  if (altitude <= 36089) {
+    return 1013.25 * pow(1 - 6.8755856e-6 * altitude, 5.2558797);
+  }
+  return 226.3206 * exp(-4.806346e-5 * (altitude - 36089));
+}
+
+/// <summary>
+/// Expected core speed (corrected) at idle
+/// </summary>
+double idleCoreSpeed(double pressAltitude, double mach) {
+#ifdef FADEC_A380X
+  return iCN3(pressAltitude, mach);
+#else
+  return iCN2(pressAltitude, mach);
+#endif
+}
+
+/// <summary>
+/// Evaluates one operating point the same way EngineControl does for the idle parameters and thrust limits
+/// </summary>
+SweepResult evaluate(const SweepPoint& point, EngineRatios& engineRatios, Polynomial& poly) {
+  SweepResult result = {};
+
+  double ambientPressure = isaPressure(point.altitude);
+  double packs = (point.bleed & 1) ? 1 : 0;
+  double nai = (point.bleed & 2) ? 1 : 0;
+  double wai = (point.bleed & 4) ? 1 : 0;
+
+  // idle parameters (EngineControl::generateIdleParameters)
+  double idleCN1 = iCN1(point.altitude, point.mach, point.ambientTemp);
+  double idleCFF = poly.correctedFuelFlow(idleCN1, 0, point.altitude);
+  result.idleN1 = idleCN1 * sqrt(engineRatios.theta2(0, point.ambientTemp));
+  result.idleNCore = idleCoreSpeed(point.altitude, point.mach) * sqrt(engineRatios.theta(point.ambientTemp));
+  result.idleFF =
+      idleCFF * LBS_TO_KGS * engineRatios.delta2(0, ambientPressure) * sqrt(engineRatios.theta2(0, point.ambientTemp));
+  result.idleEGT = poly.correctedEGT(idleCN1, idleCFF, 0, point.altitude) * engineRatios.theta2(0, point.ambientTemp);
+
+  // thrust limits (EngineControl::updateThrustLimits)
+  double takeoffAltitude = std::min(16600.0, point.altitude);
+  result.limitTo = limitN1(0, takeoffAltitude, point.ambientTemp, ambientPressure, 0, packs, nai, wai);
+  result.limitGa = limitN1(1, takeoffAltitude, point.ambientTemp, ambientPressure, 0, packs, nai, wai);
+  result.limitClb = limitN1(2, point.altitude, point.ambientTemp, ambientPressure, 0, packs, nai, wai);
+  result.limitMct = limitN1(3, point.altitude, point.ambientTemp, ambientPressure, 0, packs, nai, wai);
+
+  // corrected fuel flow and EGT when running at the climb limit
+  double climbCN1 = result.limitClb / sqrt(engineRatios.theta2(point.mach, point.ambientTemp));
+  result.climbCFF = poly.correctedFuelFlow(climbCN1, point.mach, point.altitude);
+  result.climbCEGT = poly.correctedEGT(climbCN1, result.climbCFF, point.mach, point.altitude);
+
+  return result;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  std::string outFilePath;
+  std::string delimiter = ",";
+  SweepRange altitude = {-2000, 41000, 1000};
+  SweepRange mach = {0, 0.8, 0.05};
+  SweepRange temperature = {-60, 50, 5};
+  bool allBleedConfigurations = false;
+  uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(fmt::format("Sweeps the {} FADEC engine models over altitude, mach, temperature and bleed configuration", AIRCRAFT));
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output File (timing only if empty)");
+  args.addArgument({"-d", "--delimiter"}, &delimiter, "Delimiter");
+  args.addArgument({"--alt-min"}, &altitude.min, "Minimum pressure altitude (ft)");
+  args.addArgument({"--alt-max"}, &altitude.max, "Maximum pressure altitude (ft)");
+  args.addArgument({"--alt-step"}, &altitude.step, "Pressure altitude step (ft)");
+  args.addArgument({"--mach-min"}, &mach.min, "Minimum mach");
+  args.addArgument({"--mach-max"}, &mach.max, "Maximum mach");
+  args.addArgument({"--mach-step"}, &mach.step, "Mach step");
+  args.addArgument({"--temp-min"}, &temperature.min, "Minimum ambient temperature (degC)");
+  args.addArgument({"--temp-max"}, &temperature.max, "Maximum ambient temperature (degC)");
+  args.addArgument({"--temp-step"}, &temperature.step, "Ambient temperature step (degC)");
+  args.addArgument({"-b", "--bleed"}, &allBleedConfigurations, "Sweep all packs / nacelle / wing anti-ice combinations");
+  args.addArgument({"-j", "--threads"}, &threadCount, "Number of worker threads");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // sweep dimensions, bleed is the fastest changing one
+  const uint64_t bleedCount = allBleedConfigurations ? BLEED_CONFIGURATION_COUNT : 1;
+  const uint64_t temperatureCount = temperature.count();
+  const uint64_t machCount = mach.count();
+  const uint64_t altitudeCount = altitude.count();
+  const uint64_t pointCount = altitudeCount * machCount * temperatureCount * bleedCount;
+  threadCount = std::max(1u, threadCount);
+
+  fmt::print("Sweeping {} points ({} altitudes x {} mach x {} temperatures x {} bleed) on {} threads\n", pointCount, altitudeCount,
+             machCount, temperatureCount, bleedCount, threadCount);
+
+  // output stream
+  std::ofstream out;
+  const bool writeOutput = !outFilePath.empty();
+  if (writeOutput) {
+    // open the output file
+    out.open(outFilePath, std::ios::out | std::ios::trunc);
+    // check if file is open
+    if (!out.is_open()) {
+      fmt::print("Failed to create output file!\n");
+      return 1;
+    }
+
+    // write header
+    out << fmt::format("altitude_ft{0}mach{0}ambient_temp_c{0}bleed{0}idle_n1{0}idle_n_core{0}idle_ff_kgh{0}idle_egt_c{0}limit_to_n1{0}"
+                       "limit_ga_n1{0}limit_clb_n1{0}limit_mct_n1{0}clb_corrected_ff_lbsh{0}clb_corrected_egt_c\n",
+                       delimiter);
+  }
+
+  std::vector<fmt::memory_buffer> chunks(threadCount);
+  std::vector<double> checksums(threadCount);
+  std::vector<std::thread> workers;
+  workers.reserve(threadCount);
+
+  auto start = std::chrono::steady_clock::now();
+
+  // points are evaluated in batches so that the formatted output of a batch is bounded
+  for (uint64_t batchStart = 0; batchStart < pointCount; batchStart += SWEEP_BATCH_SIZE) {
+    const uint64_t batchCount = std::min(SWEEP_BATCH_SIZE, pointCount - batchStart);
+
+    for (uint32_t t = 0; t < threadCount; t++) {
+      workers.emplace_back([&, t]() {
+        Polynomial poly;
+        EngineRatios threadRatios;
+        fmt::memory_buffer& buffer = chunks[t];
+        buffer.clear();
+
+        uint64_t first = batchStart + batchCount * t / threadCount;
+        uint64_t last = batchStart + batchCount * (t + 1) / threadCount;
+        for (uint64_t i = first; i < last; i++) {
+          uint64_t index = i;
+          SweepPoint point = {};
+          point.bleed = static_cast<int>(index % bleedCount);
+          index /= bleedCount;
+          point.ambientTemp = temperature.value(static_cast<uint32_t>(index % temperatureCount));
+          index /= temperatureCount;
+          point.mach = mach.value(static_cast<uint32_t>(index % machCount));
+          index /= machCount;
+          point.altitude = altitude.value(static_cast<uint32_t>(index));
+
+          SweepResult r = evaluate(point, threadRatios, poly);
+
+          if (writeOutput) {
+            fmt::format_to(std::back_inserter(buffer),
+                           "{1:g}{0}{2:g}{0}{3:g}{0}{4}{0}{5:.3f}{0}{6:.3f}{0}{7:.1f}{0}{8:.1f}{0}{9:.3f}{0}{10:.3f}{0}{11:.3f}{0}{12:.3f}{0}"
+                           "{13:.1f}{0}{14:.1f}\n",
+                           delimiter, point.altitude, point.mach, point.ambientTemp, point.bleed, r.idleN1, r.idleNCore, r.idleFF,
+                           r.idleEGT, r.limitTo, r.limitGa, r.limitClb, r.limitMct, r.climbCFF, r.climbCEGT);
+          } else {
+            // keep the evaluation from being optimized away
+            checksums[t] += r.limitClb + r.idleEGT;
+          }
+        }
+      });
+    }
+
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    workers.clear();
+
+    if (writeOutput) {
+      for (const auto& chunk : chunks) {
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+      }
+    }
+  }
+
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  fmt::print("Evaluated {} points in {:.3f} s ({:.0f} points/s)\n", pointCount, elapsed, pointCount / std::max(elapsed, 1e-9));
+
+  if (writeOutput) {
+    fmt::print("Written to '{}'\n", outFilePath);
+  }
+
+  // success
+  return 0;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "A32nxReferenceFuel.h"
+#include "FlightScript.h"
+
+const char* AIRCRAFT = "A32NX";
+
+using EngineTraits = A32nxEngineTraits;
+
+const int TANK_COUNT = EngineTraits::TANK_COUNT;
+const int ENGINE_COUNT = EngineTraits::ENGINE_COUNT;
+
+/// Quantities before the refuel (LBS)
+const std::array<double, TANK_COUNT> INITIAL_FUEL = {0, 1500, 1500, 0, 0};
+
+const char* VALVE = "FUELSYSTEM VALVE OPEN";
+const char* PUMP = "FUELSYSTEM PUMP ACTIVE";
+const char* LINE_FLOW = "FUELSYSTEM LINE FUEL FLOW";
+const char* JUNCTION = "FUELSYSTEM JUNCTION SETTING";
+
+const int APU_LINE = 18;
+const double APU_FLOW = 43;  // GPH
+const double APU_BURN = 288;  // LBS/H
+
+/// <summary>
+/// Block to block flight exercising the refuel, the center and outer tank transfers, the cross-feed with every pump
+/// combination, the APU, pause, the fuel UI tamper detection and the developer states
+/// </summary>
+inline std::vector<FlightPhase> scriptedFlight() {
+  return {
+      {"refuel", 300, {0, 0},
+       {{PUMP, 2, 1}, {PUMP, 3, 1}, {PUMP, 5, 1}, {PUMP, 6, 1}, {JUNCTION, 4, 1}, {JUNCTION, 5, 1}, {LINE_FLOW, APU_LINE, APU_FLOW}},
+       {{OUTSIDE, FuelTankCenter, 144000}, {OUTSIDE, FuelTankLeft, 108000}, {OUTSIDE, FuelTankRight, 108000},
+        {OUTSIDE, FuelTankLeftAux, 18000}, {OUTSIDE, FuelTankRightAux, 18000}, {FuelTankLeft, OUTSIDE, APU_BURN}},
+       true},
+      {"apu, fuel ui tampered", 600, {0, 0}, {}, {{FuelTankLeft, OUTSIDE, APU_BURN}}, false, false, 0, FuelTankCenter, 2000},
+      {"engine start, taxi", 600, {300, 300}, {}, {{FuelTankLeft, OUTSIDE, APU_BURN}}},
+      {"takeoff", 60, {2900, 2900}, {{LINE_FLOW, APU_LINE, 0}}, {}},
+      {"climb, center transfer", 1200, {1800, 1800},
+       {{VALVE, 9, 1}, {VALVE, 10, 1}, {VALVE, 11, 1}, {VALVE, 12, 1}, {LINE_FLOW, 27, 537}, {LINE_FLOW, 28, 358}},
+       {{FuelTankCenter, FuelTankLeft, 3600}, {FuelTankCenter, FuelTankRight, 2400}}},
+      {"cruise, manual right center transfer", 1800, {1150, 1150},
+       {{VALVE, 9, 0}, {VALVE, 11, 0}, {VALVE, 12, 0}, {JUNCTION, 5, 2}, {LINE_FLOW, 27, 0}, {LINE_FLOW, 28, 373}},
+       {{FuelTankCenter, FuelTankRight, 2500}}},
+      {"cruise, outer transfer", 900, {1100, 1100},
+       {{VALVE, 10, 0}, {JUNCTION, 5, 1}, {LINE_FLOW, 28, 0}, {VALVE, 4, 1}, {VALVE, 5, 1}, {VALVE, 6, 1}, {VALVE, 7, 1}},
+       {{FuelTankLeftAux, FuelTankLeft, 3000}, {FuelTankRightAux, FuelTankRight, 3000}}},
+      {"cross-feed, left pumps off", 600, {1100, 1150},
+       {{VALVE, 4, 0}, {VALVE, 5, 0}, {VALVE, 6, 0}, {VALVE, 7, 0}, {VALVE, 3, 1}, {PUMP, 2, 0}, {PUMP, 5, 0}},
+       {}},
+      {"cross-feed, right pumps off", 600, {1150, 1100}, {{PUMP, 2, 1}, {PUMP, 5, 1}, {PUMP, 3, 0}, {PUMP, 6, 0}}, {}},
+      {"cross-feed, all pumps off, apu", 300, {1100, 1100},
+       {{PUMP, 2, 0}, {PUMP, 5, 0}, {LINE_FLOW, APU_LINE, APU_FLOW}},
+       {{FuelTankLeft, OUTSIDE, APU_BURN / 2}, {FuelTankRight, OUTSIDE, APU_BURN / 2}}},
+      {"cross-feed, all pumps on, apu", 300, {1100, 1100},
+       {{PUMP, 2, 1}, {PUMP, 3, 1}, {PUMP, 5, 1}, {PUMP, 6, 1}},
+       {{FuelTankLeft, OUTSIDE, APU_BURN / 2}, {FuelTankRight, OUTSIDE, APU_BURN / 2}}},
+      {"paused", 120, {1100, 1100}, {{VALVE, 3, 0}, {LINE_FLOW, APU_LINE, 0}}, {}, false, true},
+      {"developer, fuel ui changed", 30, {1100, 1100}, {}, {}, false, false, 1, FuelTankLeftAux, 1000},
+      {"developer, no burn", 300, {1100, 1100}, {}, {}, false, false, 2},
+      {"descent", 1500, {400, 400}, {}, {}},
+      {"taxi in, apu", 400, {300, 300}, {{LINE_FLOW, APU_LINE, APU_FLOW}}, {{FuelTankLeft, OUTSIDE, APU_BURN}}},
+      {"shutdown", 120, {0, 0}, {}, {{FuelTankLeft, OUTSIDE, APU_BURN}}},
+  };
+}
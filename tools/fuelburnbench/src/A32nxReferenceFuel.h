@@ -0,0 +1,327 @@
+#pragma once
+
+#include "EngineControl.h"
+
+/// <summary>
+/// Fuel consumption of the A32NX FADEC as it was before it moved onto the shared FuelNetwork.
+/// updateFuel is kept unchanged except that the fuel state is not written on the ground: the save condition and its
+/// timer are still evaluated so that both sides pay for them, the harness compares the quantities written to the sim.
+/// </summary>
+class ReferenceFuel {
+ public:
+  explicit ReferenceFuel(SimVars* simVars) : simVars(simVars) {}
+
+  void setPaused(bool paused) { simPaused = paused; }
+
+  /// @brief FBW Fuel Consumption and Tankering
+  /// Updates Fuel Consumption with realistic values
+  /// @param deltaTimeSeconds Frame delta time in seconds
+  void updateFuel(double deltaTimeSeconds) {
+    double m = 0;
+    double b = 0;
+    double fuelBurn1 = 0;
+    double fuelBurn2 = 0;
+    double apuBurn1 = 0;
+    double apuBurn2 = 0;
+
+    double refuelRate = simVars->getRefuelRate();
+    double refuelStartedByUser = simVars->getRefuelStartedByUser();
+    bool uiFuelTamper = false;
+    double pumpStateLeft = simVars->getPumpStateLeft();
+    double pumpStateRight = simVars->getPumpStateRight();
+    bool xfrCenterLeftManual = simVars->getJunctionSetting(4) > 1.5;
+    bool xfrCenterRightManual = simVars->getJunctionSetting(5) > 1.5;
+    bool xfrCenterLeftAuto = simVars->getValve(11) > 0.0 && !xfrCenterLeftManual;
+    bool xfrCenterRightAuto = simVars->getValve(12) > 0.0 && !xfrCenterRightManual;
+    bool xfrValveCenterLeftOpen = simVars->getValve(9) > 0.0 && (xfrCenterLeftAuto || xfrCenterLeftManual);
+    bool xfrValveCenterRightOpen = simVars->getValve(10) > 0.0 && (xfrCenterRightAuto || xfrCenterRightManual);
+    double xfrValveOuterLeft1 = simVars->getValve(6);
+    double xfrValveOuterLeft2 = simVars->getValve(4);
+    double xfrValveOuterRight1 = simVars->getValve(7);
+    double xfrValveOuterRight2 = simVars->getValve(5);
+    double lineLeftToCenterFlow = simVars->getLineFlow(27);
+    double lineRightToCenterFlow = simVars->getLineFlow(28);
+    double lineFlowRatio = 0;
+
+    double engine1PreFF = simVars->getEngine1PreFF();  // KG/H
+    double engine2PreFF = simVars->getEngine2PreFF();  // KG/H
+    double engine1FF = simVars->getEngine1FF();        // KG/H
+    double engine2FF = simVars->getEngine2FF();        // KG/H
+
+    /// weight of one gallon of fuel in pounds
+    double fuelWeightGallon = simVars->getFuelWeightGallon();
+    double fuelUsedLeft = simVars->getFuelUsedLeft();    // Kg
+    double fuelUsedRight = simVars->getFuelUsedRight();  // Kg
+
+    double fuelLeftPre = simVars->getFuelLeftPre();                                // LBS
+    double fuelRightPre = simVars->getFuelRightPre();                              // LBS
+    double fuelAuxLeftPre = simVars->getFuelAuxLeftPre();                          // LBS
+    double fuelAuxRightPre = simVars->getFuelAuxRightPre();                        // LBS
+    double fuelCenterPre = simVars->getFuelCenterPre();                            // LBS
+    double leftQuantity = simVars->getFuelTankQuantity(2) * fuelWeightGallon;      // LBS
+    double rightQuantity = simVars->getFuelTankQuantity(3) * fuelWeightGallon;     // LBS
+    double leftAuxQuantity = simVars->getFuelTankQuantity(4) * fuelWeightGallon;   // LBS
+    double rightAuxQuantity = simVars->getFuelTankQuantity(5) * fuelWeightGallon;  // LBS
+    double centerQuantity = simVars->getFuelTankQuantity(1) * fuelWeightGallon;    // LBS
+    /// Left inner tank fuel quantity in pounds
+    double fuelLeft = 0;
+    /// Right inner tank fuel quantity in pounds
+    double fuelRight = 0;
+    double fuelLeftAux = 0;
+    double fuelRightAux = 0;
+    double fuelCenter = 0;
+    double xfrCenterToLeft = 0;
+    double xfrCenterToRight = 0;
+    double xfrAuxLeft = 0;
+    double xfrAuxRight = 0;
+    double fuelTotalActual = leftQuantity + rightQuantity + leftAuxQuantity + rightAuxQuantity + centerQuantity;  // LBS
+    double fuelTotalPre = fuelLeftPre + fuelRightPre + fuelAuxLeftPre + fuelAuxRightPre + fuelCenterPre;          // LBS
+    double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTimeSeconds);           // LBS/ sec
+
+    double engine1State = simVars->getEngine1State();
+    double engine2State = simVars->getEngine2State();
+
+    int isTankClosed = 0;
+    double xFeedValve = simVars->getValve(3);
+    double leftPump1 = simVars->getPump(2);
+    double leftPump2 = simVars->getPump(5);
+    double rightPump1 = simVars->getPump(3);
+    double rightPump2 = simVars->getPump(6);
+
+    // Check Ready & Development State for UI
+    isReady = simVars->getIsReady();
+    devState = simVars->getDeveloperState();
+
+    /// Delta time for this update in hours
+    double deltaTime = deltaTimeSeconds / 3600;
+
+    // Pump State Logic for Left Wing
+    if (pumpStateLeft == 0 && (timerLeft.elapsed() == 0 || timerLeft.elapsed() >= 1000)) {
+      if (fuelLeftPre - leftQuantity > 0 && leftQuantity == 0) {
+        timerLeft.reset();
+        simVars->setPumpStateLeft(1);
+      } else if (fuelLeftPre == 0 && leftQuantity - fuelLeftPre > 0) {
+        timerLeft.reset();
+        simVars->setPumpStateLeft(2);
+      } else {
+        simVars->setPumpStateLeft(0);
+      }
+    } else if (pumpStateLeft == 1 && timerLeft.elapsed() >= 2100) {
+      simVars->setPumpStateLeft(0);
+      timerLeft.reset();
+    } else if (pumpStateLeft == 2 && timerLeft.elapsed() >= 2700) {
+      simVars->setPumpStateLeft(0);
+      timerLeft.reset();
+    }
+
+    // Pump State Logic for Right Wing
+    if (pumpStateRight == 0 && (timerRight.elapsed() == 0 || timerRight.elapsed() >= 1000)) {
+      if (fuelRightPre - rightQuantity > 0 && rightQuantity == 0) {
+        timerRight.reset();
+        simVars->setPumpStateRight(1);
+      } else if (fuelRightPre == 0 && rightQuantity - fuelRightPre > 0) {
+        timerRight.reset();
+        simVars->setPumpStateRight(2);
+      } else {
+        simVars->setPumpStateRight(0);
+      }
+    } else if (pumpStateRight == 1 && timerRight.elapsed() >= 2100) {
+      simVars->setPumpStateRight(0);
+      timerRight.reset();
+    } else if (pumpStateRight == 2 && timerRight.elapsed() >= 2700) {
+      simVars->setPumpStateRight(0);
+      timerRight.reset();
+    }
+
+    // Checking for in-game UI Fuel tampering
+    if ((isReady == 1 && refuelStartedByUser == 0 && deltaFuelRate > FUEL_THRESHOLD) ||
+        (isReady == 1 && refuelStartedByUser == 1 && deltaFuelRate > FUEL_THRESHOLD && refuelRate < 2)) {
+      uiFuelTamper = true;
+    }
+
+    if (simPaused || uiFuelTamper && devState == 0) {  // Detects whether the Sim is paused or the Fuel UI is being tampered with
+      simVars->setFuelLeftPre(fuelLeftPre);            // in LBS
+      simVars->setFuelRightPre(fuelRightPre);          // in LBS
+      simVars->setFuelAuxLeftPre(fuelAuxLeftPre);      // in LBS
+      simVars->setFuelAuxRightPre(fuelAuxRightPre);    // in LBS
+      simVars->setFuelCenterPre(fuelCenterPre);        // in LBS
+
+      fuelLeft = (fuelLeftPre / fuelWeightGallon);          // USG
+      fuelRight = (fuelRightPre / fuelWeightGallon);        // USG
+      fuelCenter = (fuelCenterPre / fuelWeightGallon);      // USG
+      fuelLeftAux = (fuelAuxLeftPre / fuelWeightGallon);    // USG
+      fuelRightAux = (fuelAuxRightPre / fuelWeightGallon);  // USG
+
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelCenter);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeftAux);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRightAux);
+    } else if (!uiFuelTamper && refuelStartedByUser == 1) {  // Detects refueling from the EFB
+      simVars->setFuelLeftPre(leftQuantity);                 // in LBS
+      simVars->setFuelRightPre(rightQuantity);               // in LBS
+      simVars->setFuelAuxLeftPre(leftAuxQuantity);           // in LBS
+      simVars->setFuelAuxRightPre(rightAuxQuantity);         // in LBS
+      simVars->setFuelCenterPre(centerQuantity);             // in LBS
+    } else {
+      if (uiFuelTamper == 1) {
+        fuelLeftPre = leftQuantity;          // LBS
+        fuelRightPre = rightQuantity;        // LBS
+        fuelAuxLeftPre = leftAuxQuantity;    // LBS
+        fuelAuxRightPre = rightAuxQuantity;  // LBS
+        fuelCenterPre = centerQuantity;      // LBS
+      }
+      //-----------------------------------------------------------
+      // Cross-feed Logic
+      // isTankClosed = 0, x-feed valve closed
+      // isTankClosed = 1, left tank does not supply fuel
+      // isTankClosed = 2, right tank does not supply fuel
+      // isTankClosed = 3, left & right tanks do not supply fuel
+      // isTankClosed = 4, both tanks supply fuel
+      if (xFeedValve > 0.0) {
+        if (leftPump1 == 0 && leftPump2 == 0 && rightPump1 == 0 && rightPump2 == 0)
+          isTankClosed = 3;
+        else if (leftPump1 == 0 && leftPump2 == 0)
+          isTankClosed = 1;
+        else if (rightPump1 == 0 && rightPump2 == 0)
+          isTankClosed = 2;
+        else
+          isTankClosed = 4;
+      }
+
+      //--------------------------------------------
+      // Left Engine and Wing routine
+      if (fuelLeftPre > 0) {
+        // Cycle Fuel Burn for Engine 1
+        if (devState != 2) {
+          m = (engine1FF - engine1PreFF) / deltaTime;
+          b = engine1PreFF;
+          fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        }
+
+        // Fuel transfer routine for Left Wing
+        if (xfrValveOuterLeft1 > 0.0 || xfrValveOuterLeft2 > 0.0)
+          xfrAuxLeft = fuelAuxLeftPre - leftAuxQuantity;
+      } else {
+        fuelBurn1 = 0;
+        fuelLeftPre = 0;
+      }
+
+      //--------------------------------------------
+      // Right Engine and Wing routine
+      if (fuelRightPre > 0) {
+        // Cycle Fuel Burn for Engine 2
+        if (devState != 2) {
+          m = (engine2FF - engine2PreFF) / deltaTime;
+          b = engine2PreFF;
+          fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        }
+        // Fuel transfer routine for Right Wing
+        if (xfrValveOuterRight1 > 0.0 || xfrValveOuterRight2 > 0.0)
+          xfrAuxRight = fuelAuxRightPre - rightAuxQuantity;
+      } else {
+        fuelBurn2 = 0;
+        fuelRightPre = 0;
+      }
+
+      /// apu fuel consumption for this frame in pounds
+      double apuFuelConsumption = simVars->getLineFlow(18) * fuelWeightGallon * deltaTime;
+      apuBurn1 = apuFuelConsumption;
+      apuBurn2 = 0;
+
+      //--------------------------------------------
+      // Fuel used accumulators
+      fuelUsedLeft += fuelBurn1;
+      fuelUsedRight += fuelBurn2;
+
+      //--------------------------------------------
+      // Cross-feed fuel burn routine
+      // If fuel pumps for a given tank are closed,
+      // all fuel will be burnt on the other tank
+      switch (isTankClosed) {
+        case 1:
+          fuelBurn2 = fuelBurn1 + fuelBurn2;
+          fuelBurn1 = 0;
+          apuBurn1 = 0;
+          apuBurn2 = apuFuelConsumption;
+          break;
+        case 2:
+          fuelBurn1 = fuelBurn1 + fuelBurn2;
+          fuelBurn2 = 0;
+          break;
+        case 3:
+          fuelBurn1 = 0;
+          fuelBurn2 = 0;
+          apuBurn1 = apuFuelConsumption * 0.5;
+          apuBurn2 = apuFuelConsumption * 0.5;
+          break;
+        case 4:
+          apuBurn1 = apuFuelConsumption*0.5;
+          apuBurn2 = apuFuelConsumption*0.5;
+          break;
+        default:
+          break;
+      }
+
+      //--------------------------------------------
+      // Center Tank transfer routine
+      if (xfrValveCenterLeftOpen && xfrValveCenterRightOpen) {
+        if (lineLeftToCenterFlow < 0.1 && lineRightToCenterFlow < 0.1)
+          lineFlowRatio = 0.5;
+        else
+          lineFlowRatio = lineLeftToCenterFlow / (lineLeftToCenterFlow + lineRightToCenterFlow);
+
+        xfrCenterToLeft = (fuelCenterPre - centerQuantity) * lineFlowRatio;
+        xfrCenterToRight = (fuelCenterPre - centerQuantity) * (1 - lineFlowRatio);
+      } else if (xfrValveCenterLeftOpen)
+        xfrCenterToLeft = fuelCenterPre - centerQuantity;
+      else if (xfrValveCenterRightOpen)
+        xfrCenterToRight = fuelCenterPre - centerQuantity;
+
+      //--------------------------------------------
+      // Final Fuel levels for left and right inner tanks
+      fuelLeft = (fuelLeftPre - (fuelBurn1 * KGS_TO_LBS)) + xfrAuxLeft + xfrCenterToLeft - apuBurn1;  // LBS
+      fuelRight = (fuelRightPre - (fuelBurn2 * KGS_TO_LBS)) + xfrAuxRight + xfrCenterToRight - apuBurn2;                   // LBS
+
+      //--------------------------------------------
+      // Setting new pre-cycle conditions
+      simVars->setEngine1PreFF(engine1FF);
+      simVars->setEngine2PreFF(engine2FF);
+      simVars->setFuelUsedLeft(fuelUsedLeft);         // in KG
+      simVars->setFuelUsedRight(fuelUsedRight);       // in KG
+      simVars->setFuelAuxLeftPre(leftAuxQuantity);    // in LBS
+      simVars->setFuelAuxRightPre(rightAuxQuantity);  // in LBS
+      simVars->setFuelCenterPre(centerQuantity);      // in LBS
+
+      simVars->setFuelLeftPre(fuelLeft);    // in LBS
+      simVars->setFuelRightPre(fuelRight);  // in LBS
+
+      fuelLeft = (fuelLeft / fuelWeightGallon);    // USG
+      fuelRight = (fuelRight / fuelWeightGallon);  // USG
+
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
+    }
+
+    //--------------------------------------------
+    // Will save the current fuel quantities if on
+    // the ground AND engines being shutdown
+    if (timerFuel.elapsed() >= 1000 && simVars->getSimOnGround() &&
+        (engine1State == 0 || engine1State == 10 || engine1State == 4 || engine1State == 14 || engine2State == 0 || engine2State == 10 ||
+         engine2State == 4 || engine2State == 14)) {
+      timerFuel.reset();
+    }
+  }
+
+ private:
+  SimVars* simVars;
+  bool simPaused = false;
+  Timer timerFuel;
+  Timer timerLeft;
+  Timer timerRight;
+  double devState = 0;
+  double isReady = 0;
+
+  const double FUEL_THRESHOLD = 661;  // lbs/sec
+  const double KGS_TO_LBS = 1 / 0.4535934;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "A380xReferenceFuel.h"
+#include "FlightScript.h"
+
+const char* AIRCRAFT = "A380X";
+
+using EngineTraits = A380xEngineTraits;
+
+const int TANK_COUNT = EngineTraits::TANK_COUNT;
+const int ENGINE_COUNT = EngineTraits::ENGINE_COUNT;
+
+/// Quantities before the refuel (LBS)
+const std::array<double, TANK_COUNT> INITIAL_FUEL = {0, 2000, 0, 0, 2000, 2000, 0, 0, 2000, 0, 0};
+
+/// <summary>
+/// Block to block flight exercising the refuel, feed tanks running dry, an engine out, pause, the fuel UI tamper detection and
+/// the developer states. The FADEC only tracks the feed tanks, the sim moves no fuel between the other tanks.
+/// </summary>
+inline std::vector<FlightPhase> scriptedFlight() {
+  return {
+      {"refuel", 600, {0, 0, 0, 0}, {},
+       {{OUTSIDE, FuelTankLeftOuter, 96000},
+        {OUTSIDE, FuelTankFeedOne, 48000},
+        {OUTSIDE, FuelTankLeftMid, 330000},
+        {OUTSIDE, FuelTankLeftInner, 420000},
+        {OUTSIDE, FuelTankFeedTwo, 48000},
+        {OUTSIDE, FuelTankFeedThree, 48000},
+        {OUTSIDE, FuelTankRightInner, 420000},
+        {OUTSIDE, FuelTankRightMid, 330000},
+        {OUTSIDE, FuelTankFeedFour, 6000},
+        {OUTSIDE, FuelTankRightOuter, 96000},
+        {OUTSIDE, FuelTankTrim, 210000}},
+       true},
+      {"ground, fuel ui tampered", 600, {0, 0, 0, 0}, {}, {}, false, false, 0, FuelTankTrim, 3000},
+      {"engine start, taxi", 600, {500, 500, 500, 500}, {}, {}},
+      {"takeoff", 60, {9000, 9000, 9000, 9000}, {}, {}},
+      {"climb, feed four runs dry", 1500, {5500, 5500, 5500, 5500}, {}, {}},
+      {"cruise, engine four out", 1200, {3000, 3000, 3000, 0}, {}, {}},
+      {"paused", 120, {3000, 3000, 3000, 0}, {}, {}, false, true},
+      {"developer, fuel ui changed", 30, {3000, 3000, 3000, 0}, {}, {}, false, false, 1, FuelTankFeedTwo, 1000},
+      {"developer, no burn", 300, {3000, 3000, 3000, 0}, {}, {}, false, false, 2},
+      {"cruise, feeds run dry", 1500, {3000, 3000, 3000, 0}, {}, {}},
+      {"descent", 600, {700, 700, 700, 0}, {}, {}},
+      {"shutdown", 120, {0, 0, 0, 0}, {}, {}},
+  };
+}
@@ -0,0 +1,384 @@
+#pragma once
+
+#include "EngineControl.h"
+
+/// <summary>
+/// Fuel consumption of the A380X FADEC as it was before it moved onto the shared FuelNetwork.
+/// updateFuel is kept unchanged except that the fuel state is not written on the ground: the save condition and its
+/// timer are still evaluated so that both sides pay for them, the harness compares the quantities written to the sim.
+/// </summary>
+class ReferenceFuel {
+ public:
+  explicit ReferenceFuel(SimVars* simVars) : simVars(simVars) {}
+
+  void setPaused(bool paused) { simPaused = paused; }
+
+  /// <summary>
+  /// FBW Fuel Consumption and Tankering
+  /// Updates Fuel Consumption with realistic values
+  /// </summary>
+  void updateFuel(double deltaTime) {
+    double m = 0;
+    double b = 0;
+    double fuelBurn1 = 0;
+    double fuelBurn2 = 0;
+    double fuelBurn3 = 0;
+    double fuelBurn4 = 0;
+
+    double refuelRate = simVars->getRefuelRate();
+    double refuelStartedByUser = simVars->getRefuelStartedByUser();
+    bool uiFuelTamper = false;
+
+    double pumpStateEngine1 = simVars->getPumpStateEngine1();
+    double pumpStateEngine2 = simVars->getPumpStateEngine2();
+    double pumpStateEngine3 = simVars->getPumpStateEngine3();
+    double pumpStateEngine4 = simVars->getPumpStateEngine4();
+
+    double engine1PreFF = simVars->getEngine1PreFF();  // KG/H
+    double engine2PreFF = simVars->getEngine2PreFF();  // KG/H
+    double engine3PreFF = simVars->getEngine3PreFF();  // KG/H
+    double engine4PreFF = simVars->getEngine4PreFF();  // KG/H
+    double engine1FF = simVars->getEngine1FF();        // KG/H
+    double engine2FF = simVars->getEngine2FF();        // KG/H
+    double engine3FF = simVars->getEngine3FF();        // KG/H
+    double engine4FF = simVars->getEngine4FF();        // KG/H
+
+    double fuelWeightGallon = simVars->getFuelWeightGallon();
+    double fuelUsedEngine1 = simVars->getFuelUsedEngine1();  // Kg
+    double fuelUsedEngine2 = simVars->getFuelUsedEngine2();  // Kg
+    double fuelUsedEngine3 = simVars->getFuelUsedEngine3();  // Kg
+    double fuelUsedEngine4 = simVars->getFuelUsedEngine4();  // Kg
+
+    double fuelLeftOuterPre = simVars->getFuelLeftOuterPre();    // LBS
+    double fuelFeedOnePre = simVars->getFuelFeedOnePre();        // LBS
+    double fuelLeftMidPre = simVars->getFuelLeftMidPre();        // LBS
+    double fuelLeftInnerPre = simVars->getFuelLeftInnerPre();    // LBS
+    double fuelFeedTwoPre = simVars->getFuelFeedTwoPre();        // LBS
+    double fuelFeedThreePre = simVars->getFuelFeedThreePre();    // LBS
+    double fuelRightInnerPre = simVars->getFuelRightInnerPre();  // LBS
+    double fuelRightMidPre = simVars->getFuelRightMidPre();      // LBS
+    double fuelFeedFourPre = simVars->getFuelFeedFourPre();      // LBS
+    double fuelRightOuterPre = simVars->getFuelRightOuterPre();  // LBS
+    double fuelTrimPre = simVars->getFuelTrimPre();              // LBS
+
+    double leftOuterQty = simVars->getTankFuelQuantity(1) * fuelWeightGallon;    // LBS
+    double feedOneQty = simVars->getTankFuelQuantity(2) * fuelWeightGallon;      // LBS
+    double leftMidQty = simVars->getTankFuelQuantity(3) * fuelWeightGallon;      // LBS
+    double leftInnerQty = simVars->getTankFuelQuantity(4) * fuelWeightGallon;    // LBS
+    double feedTwoQty = simVars->getTankFuelQuantity(5) * fuelWeightGallon;      // LBS
+    double feedThreeQty = simVars->getTankFuelQuantity(6) * fuelWeightGallon;    // LBS
+    double rightInnerQty = simVars->getTankFuelQuantity(7) * fuelWeightGallon;   // LBS
+    double rightMidQty = simVars->getTankFuelQuantity(8) * fuelWeightGallon;     // LBS
+    double feedFourQty = simVars->getTankFuelQuantity(9) * fuelWeightGallon;     // LBS
+    double rightOuterQty = simVars->getTankFuelQuantity(10) * fuelWeightGallon;  // LBS
+    double trimQty = simVars->getTankFuelQuantity(11) * fuelWeightGallon;        // LBS
+
+    double fuelLeftOuter = 0;
+    double fuelFeedOne = 0;
+    double fuelLeftMid = 0;
+    double fuelLeftInner = 0;
+    double fuelFeedTwo = 0;
+    double fuelFeedThree = 0;
+    double fuelRightInner = 0;
+    double fuelRightMid = 0;
+    double fuelFeedFour = 0;
+    double fuelRightOuter = 0;
+    double fuelTrim = 0;
+
+    double fuelTotalActual = leftOuterQty + feedOneQty + leftMidQty + leftInnerQty + feedTwoQty + feedThreeQty + rightInnerQty +
+                             rightMidQty + feedFourQty + rightOuterQty + trimQty;  // LBS
+    double fuelTotalPre = fuelLeftOuterPre + fuelFeedOnePre + fuelLeftMidPre + fuelLeftInnerPre + fuelFeedTwoPre + fuelFeedThreePre +
+                          fuelRightInnerPre + fuelRightMidPre + fuelFeedFourPre + fuelRightOuterPre + fuelTrimPre;  // LBS
+    double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTime);                    // LBS/ sec
+
+    double engine1State = simVars->getEngine1State();
+    double engine2State = simVars->getEngine2State();
+    double engine3State = simVars->getEngine3State();
+    double engine4State = simVars->getEngine4State();
+
+    // Check Development State for UI
+    isReady = simVars->getIsReady();
+    devState = simVars->getDeveloperState();
+
+    deltaTime = deltaTime / 3600;
+
+    /*--------------------------------------------
+    // Pump Logic - TO BE IMPLEMENTED
+
+    // Pump State Logic for Engine 1
+    if (pumpStateEngine1 == 0 && (timerEngine1.elapsed() == 0 || timerEngine1.elapsed() >= 1000)) {
+      if (fuelLeftPre - leftQuantity > 0 && leftQuantity == 0) {
+        timerEngine1.reset();
+        simVars->setPumpStateEngine1(1);
+      } else if (fuelLeftPre == 0 && leftQuantity - fuelLeftPre > 0) {
+        timerEngine1.reset();
+        simVars->setPumpStateEngine1(2);
+      } else {
+        simVars->setPumpStateEngine1(0);
+      }
+    } else if (pumpStateEngine1 == 1 && timerEngine1.elapsed() >= 2100) {
+      simVars->setPumpStateEngine1(0);
+      fuelLeftPre = 0;
+      timerEngine1.reset();
+    } else if (pumpStateEngine1 == 2 && timerEngine1.elapsed() >= 2700) {
+      simVars->setPumpStateEngine1(0);
+      timerEngine1.reset();
+    }
+
+    // Pump State Logic for Engine 2
+    if (pumpStateEngine2 == 0 && (timerEngine2.elapsed() == 0 || timerEngine2.elapsed() >= 1000)) {
+      if (fuelLeftPre - leftQuantity > 0 && leftQuantity == 0) {
+        timerEngine2.reset();
+        simVars->setPumpStateEngine2(1);
+      } else if (fuelLeftPre == 0 && leftQuantity - fuelLeftPre > 0) {
+        timerEngine2.reset();
+        simVars->setPumpStateEngine2(2);
+      } else {
+        simVars->setPumpStateEngine2(0);
+      }
+    } else if (pumpStateEngine2 == 1 && timerEngine2.elapsed() >= 2100) {
+      simVars->setPumpStateEngine2(0);
+      fuelLeftPre = 0;
+      timerEngine2.reset();
+    } else if (pumpStateEngine2 == 2 && timerEngine2.elapsed() >= 2700) {
+      simVars->setPumpStateEngine2(0);
+      timerEngine2.reset();
+    }
+
+    // Pump State Logic for Engine 3
+    if (pumpStateEngine3 == 0 && (timerEngine3.elapsed() == 0 || timerEngine3.elapsed() >= 1000)) {
+      if (fuelRightPre - rightQuantity > 0 && rightQuantity == 0) {
+        timerEngine3.reset();
+        simVars->setPumpStateEngine3(1);
+      } else if (fuelRightPre == 0 && rightQuantity - fuelRightPre > 0) {
+        timerEngine3.reset();
+        simVars->setPumpStateEngine3(2);
+      } else {
+        simVars->setPumpStateEngine3(0);
+      }
+    } else if (pumpStateEngine3 == 1 && timerEngine3.elapsed() >= 2100) {
+      simVars->setPumpStateEngine3(0);
+      fuelRightPre = 0;
+      timerEngine3.reset();
+    } else if (pumpStateEngine3 == 2 && timerEngine3.elapsed() >= 2700) {
+      simVars->setPumpStateEngine3(0);
+      timerEngine3.reset();
+    }
+
+    // Pump State Logic for Engine 4
+    if (pumpStateEngine4 == 0 && (timerEngine4.elapsed() == 0 || timerEngine4.elapsed() >= 1000)) {
+      if (fuelRightPre - rightQuantity > 0 && rightQuantity == 0) {
+        timerEngine4.reset();
+        simVars->setPumpStateEngine4(1);
+      } else if (fuelRightPre == 0 && rightQuantity - fuelRightPre > 0) {
+        timerEngine4.reset();
+        simVars->setPumpStateEngine4(2);
+      } else {
+        simVars->setPumpStateEngine4(0);
+      }
+    } else if (pumpStateEngine4 == 1 && timerEngine4.elapsed() >= 2100) {
+      simVars->setPumpStateEngine4(0);
+      fuelRightPre = 0;
+      timerEngine4.reset();
+    } else if (pumpStateEngine4 == 2 && timerEngine4.elapsed() >= 2700) {
+      simVars->setPumpStateEngine4(0);
+      timerEngine4.reset();
+    }
+    --------------------------------------------*/
+
+    // Checking for in-game UI Fuel tampering
+    if ((isReady == 1 && refuelStartedByUser == 0 && deltaFuelRate > FUEL_THRESHOLD) ||
+        (isReady == 1 && refuelStartedByUser == 1 && deltaFuelRate > FUEL_THRESHOLD && refuelRate < 2)) {
+      uiFuelTamper = true;
+    }
+
+    //--------------------------------------------
+    // Main Fuel Burn Logic
+    //--------------------------------------------
+    if (simPaused || uiFuelTamper && devState == 0) {    // Detects whether the Sim is paused or the Fuel UI is being tampered with
+      simVars->setFuelLeftOuterPre(fuelLeftOuterPre);    // in LBS
+      simVars->setFuelFeedOnePre(fuelFeedOnePre);        // in LBS
+      simVars->setFuelLeftMidPre(fuelLeftMidPre);        // in LBS
+      simVars->setFuelLeftInnerPre(fuelLeftInnerPre);    // in LBS
+      simVars->setFuelFeedTwoPre(fuelFeedTwoPre);        // in LBS
+      simVars->setFuelFeedThreePre(fuelFeedThreePre);    // in LBS
+      simVars->setFuelRightInnerPre(fuelRightInnerPre);  // in LBS
+      simVars->setFuelRightMidPre(fuelRightMidPre);      // in LBS
+      simVars->setFuelFeedFourPre(fuelFeedFourPre);      // in LBS
+      simVars->setFuelRightOuterPre(fuelRightOuterPre);  // in LBS
+      simVars->setFuelTrimPre(fuelTrimPre);              // in LBS
+
+      fuelLeftOuter = (fuelLeftOuterPre / fuelWeightGallon);    // USG
+      fuelFeedOne = (fuelFeedOnePre / fuelWeightGallon);        // USG
+      fuelLeftMid = (fuelLeftMidPre / fuelWeightGallon);        // USG
+      fuelLeftInner = (fuelLeftInnerPre / fuelWeightGallon);    // USG
+      fuelFeedTwo = (fuelFeedTwoPre / fuelWeightGallon);        // USG
+      fuelFeedThree = (fuelFeedThreePre / fuelWeightGallon);    // USG
+      fuelRightInner = (fuelRightInnerPre / fuelWeightGallon);  // USG
+      fuelRightMid = (fuelRightMidPre / fuelWeightGallon);      // USG
+      fuelFeedFour = (fuelFeedFourPre / fuelWeightGallon);      // USG
+      fuelRightOuter = (fuelRightOuterPre / fuelWeightGallon);  // USG
+      fuelTrim = (fuelTrimPre / fuelWeightGallon);              // USG
+
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemLeftOuter, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelLeftOuter);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedOne, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedOne);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemLeftMid, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelLeftMid);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemLeftInner, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelLeftInner);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedTwo, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedTwo);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedThree, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedThree);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemRightInner, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelRightInner);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemRightMid, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelRightMid);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedFour, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedFour);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemRightOuter, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelRightOuter);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemTrim, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelTrim);
+    } else if (!uiFuelTamper && refuelStartedByUser == 1) {  // Detects refueling from the EFB
+      simVars->setFuelLeftOuterPre(leftOuterQty);            // in LBS
+      simVars->setFuelFeedOnePre(feedOneQty);                // in LBS
+      simVars->setFuelLeftMidPre(leftMidQty);                // in LBS
+      simVars->setFuelLeftInnerPre(leftInnerQty);            // in LBS
+      simVars->setFuelFeedTwoPre(feedTwoQty);                // in LBS
+      simVars->setFuelFeedThreePre(feedThreeQty);            // in LBS
+      simVars->setFuelRightInnerPre(rightInnerQty);          // in LBS
+      simVars->setFuelRightMidPre(rightMidQty);              // in LBS
+      simVars->setFuelFeedFourPre(feedFourQty);              // in LBS
+      simVars->setFuelRightOuterPre(rightOuterQty);          // in LBS
+      simVars->setFuelTrimPre(trimQty);                      // in LBS
+    } else {
+      if (uiFuelTamper == 1) {
+        fuelLeftOuterPre = leftOuterQty;    // in LBS
+        fuelFeedOnePre = feedOneQty;        // in LBS
+        fuelLeftMidPre = leftMidQty;        // in LBS
+        fuelLeftInnerPre = leftInnerQty;    // in LBS
+        fuelFeedTwoPre = feedTwoQty;        // in LBS
+        fuelFeedThreePre = feedThreeQty;    // in LBS
+        fuelRightInnerPre = rightInnerQty;  // in LBS
+        fuelRightMidPre = rightMidQty;      // in LBS
+        fuelFeedFourPre = feedFourQty;      // in LBS
+        fuelRightOuterPre = rightOuterQty;  // in LBS
+        fuelTrimPre = trimQty;              // in LBS
+      }
+      //--------------------------------------------
+      // Engine 1 Fuel Burn routine
+      if (fuelFeedOnePre > 0) {
+        // Cycle Fuel Burn for Engine 1
+        if (devState != 2) {
+          m = (engine1FF - engine1PreFF) / deltaTime;
+          b = engine1PreFF;
+          fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        }
+        // Fuel Used Accumulators - Engine 1
+        fuelUsedEngine1 += fuelBurn1;
+      } else {
+        fuelBurn1 = 0;
+        fuelFeedOnePre = 0;
+      }
+      //--------------------------------------------
+      // Engine 2 Fuel Burn routine
+      if (fuelFeedTwoPre > 0) {
+        // Cycle Fuel Burn for Engine 2
+        if (devState != 2) {
+          m = (engine2FF - engine2PreFF) / deltaTime;
+          b = engine2PreFF;
+          fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        }
+        // Fuel Used Accumulators - Engine 2
+        fuelUsedEngine2 += fuelBurn2;
+      } else {
+        fuelBurn2 = 0;
+        fuelFeedTwoPre = 0;
+      }
+      //--------------------------------------------
+      // Engine 3 Fuel Burn routine
+      if (fuelFeedThreePre > 0) {
+        // Cycle Fuel Burn for Engine 3
+        if (devState != 2) {
+          m = (engine3FF - engine3PreFF) / deltaTime;
+          b = engine3PreFF;
+          fuelBurn3 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        }
+        // Fuel Used Accumulators - Engine 3
+        fuelUsedEngine3 += fuelBurn3;
+      } else {
+        fuelBurn3 = 0;
+        fuelFeedThreePre = 0;
+      }
+      //--------------------------------------------
+      // Engine 4 Fuel Burn routine
+      if (fuelFeedFourPre > 0) {
+        // Cycle Fuel Burn for Engine 4
+        if (devState != 2) {
+          m = (engine4FF - engine4PreFF) / deltaTime;
+          b = engine4PreFF;
+          fuelBurn4 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        }
+        // Fuel Used Accumulators - Engine 4
+        fuelUsedEngine4 += fuelBurn4;
+      } else {
+        fuelBurn4 = 0;
+        fuelFeedFourPre = 0;
+      }
+
+      fuelFeedOne = fuelFeedOnePre - (fuelBurn1 * KGS_TO_LBS);      // LBS
+      fuelFeedTwo = fuelFeedTwoPre - (fuelBurn2 * KGS_TO_LBS);      // LBS
+      fuelFeedThree = fuelFeedThreePre - (fuelBurn3 * KGS_TO_LBS);  // LBS
+      fuelFeedFour = fuelFeedFourPre - (fuelBurn4 * KGS_TO_LBS);    // LBS
+
+      // Setting new pre-cycle conditions
+      simVars->setEngine1PreFF(engine1FF);
+      simVars->setEngine2PreFF(engine2FF);
+      simVars->setEngine3PreFF(engine3FF);
+      simVars->setEngine4PreFF(engine4FF);
+      simVars->setFuelUsedEngine1(fuelUsedEngine1);  // in KG
+      simVars->setFuelUsedEngine2(fuelUsedEngine2);  // in KG
+      simVars->setFuelUsedEngine3(fuelUsedEngine3);  // in KG
+      simVars->setFuelUsedEngine4(fuelUsedEngine4);  // in KG
+
+      simVars->setFuelFeedOnePre(fuelFeedOne);      // in LBS
+      simVars->setFuelFeedTwoPre(fuelFeedTwo);      // in LBS
+      simVars->setFuelFeedThreePre(fuelFeedThree);  // in LBS
+      simVars->setFuelFeedFourPre(fuelFeedFour);    // in LBS
+
+      fuelFeedOne = (fuelFeedOne / fuelWeightGallon);      // USG
+      fuelFeedTwo = (fuelFeedTwo / fuelWeightGallon);      // USG
+      fuelFeedThree = (fuelFeedThree / fuelWeightGallon);  // USG
+      fuelFeedFour = (fuelFeedFour / fuelWeightGallon);    // USG
+
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedOne, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedOne);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedTwo, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedTwo);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedThree, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedThree);
+      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelSystemFeedFour, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                    &fuelFeedFour);
+    }
+
+    // Will save the current fuel quantities if on the ground AND engines being shutdown
+    if (timerFuel.elapsed() >= 1000 && simVars->getSimOnGround() &&
+        (engine1State == 0 || engine1State == 10 || engine1State == 4 || engine1State == 14 || engine2State == 0 || engine2State == 10 ||
+         engine2State == 4 || engine2State == 14 || engine3State == 0 || engine3State == 10 || engine3State == 4 || engine3State == 14 ||
+         engine4State == 0 || engine4State == 10 || engine4State == 4 || engine4State == 14)) {
+      timerFuel.reset();
+    }
+  }
+
+ private:
+  SimVars* simVars;
+  bool simPaused = false;
+  Timer timerFuel;
+  double devState = 0;
+  double isReady = 0;
+
+  const double FUEL_THRESHOLD = 661;  // lbs/sec
+  const double KGS_TO_LBS = 1 / 0.4535934;
+};
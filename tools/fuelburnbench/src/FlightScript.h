@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+/// Number of engines of the largest aircraft flown by the harness
+const int MAX_ENGINE_COUNT = 4;
+
+/// Fuel enters from or leaves to outside the tanks (refuel truck, APU)
+const int OUTSIDE = -1;
+
+/// <summary>
+/// Aircraft variable changed at the start of a phase, e.g. a valve, pump, junction or line flow
+/// </summary>
+struct AircraftVarSetting {
+  const char* name;
+  int index;
+  double value;
+};
+
+/// <summary>
+/// Fuel moved by the sim's own fuel system during a phase
+/// </summary>
+struct FuelTransfer {
+  int source;       // tank index or OUTSIDE
+  int destination;  // tank index or OUTSIDE
+  double rate;      // LBS/H
+};
+
+/// <summary>
+/// Segment of the scripted flight. Settings persist into the following phases like cockpit switches,
+/// fuel flows and transfers only apply during the phase.
+/// </summary>
+struct FlightPhase {
+  const char* name;
+  double duration;                                   // s
+  std::array<double, MAX_ENGINE_COUNT> fuelFlow;     // KG/H
+  std::vector<AircraftVarSetting> settings;          // applied at the start of the phase
+  std::vector<FuelTransfer> transfers;               // moved by the sim every frame
+  bool refuel = false;                               // refuel started from the EFB
+  bool paused = false;                               // sim paused
+  double developerState = 0;                         // A32NX_DEVELOPER_STATE
+  int tamperTank = OUTSIDE;                          // tank changed through the sim's fuel UI at the start of the phase
+  double tamperAmount = 0;                           // LBS
+};
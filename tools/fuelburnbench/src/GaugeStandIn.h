@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Stand-in for the parts of the MSFS gauge and SimConnect API the FADEC headers are built on.
+/// Variables are held by a SimulatedGauge, the harness switches the current gauge so that the reference
+/// and the refactored fuel logic each run against their own copy of the aircraft state.
+/// </summary>
+
+typedef void* HANDLE;
+typedef double FLOAT64;
+typedef int ID;
+typedef int ENUM;
+typedef std::uint32_t DWORD;
+typedef std::int32_t HRESULT;
+
+#define SIMCONNECT_OBJECT_ID_USER 0
+
+// the MSFS SDK provides min and max as macros which accept mixed argument types
+template <typename A, typename B>
+inline auto min(A a, B b) {
+  return a < b ? a : b;
+}
+
+template <typename A, typename B>
+inline auto max(A a, B b) {
+  return a > b ? a : b;
+}
+
+/// <summary>
+/// Ids of the aircraft variables and named variables by name, shared by all gauges
+/// </summary>
+class VariableRegistry {
+ public:
+  int id(const std::string& name) {
+    auto it = ids.find(name);
+    if (it != ids.end()) {
+      return it->second;
+    }
+    int newId = static_cast<int>(names.size());
+    ids.emplace(name, newId);
+    names.push_back(name);
+    return newId;
+  }
+
+  const std::string& name(int id) const { return names[id]; }
+  std::size_t size() const { return names.size(); }
+
+ private:
+  std::map<std::string, int> ids;
+  std::vector<std::string> names;
+};
+
+inline VariableRegistry aircraftVariables;
+inline VariableRegistry namedVariables;
+
+/// <summary>
+/// Aircraft state seen by one FADEC instance
+/// </summary>
+class SimulatedGauge {
+ public:
+  double& aircraftVar(int id, int index) {
+    if (id >= static_cast<int>(aircraftVars.size())) {
+      aircraftVars.resize(id + 1);
+    }
+    if (index >= static_cast<int>(aircraftVars[id].size())) {
+      aircraftVars[id].resize(index + 1, 0);
+    }
+    return aircraftVars[id][index];
+  }
+
+  double& namedVar(int id) {
+    if (id >= static_cast<int>(namedVars.size())) {
+      namedVars.resize(id + 1, 0);
+    }
+    return namedVars[id];
+  }
+
+  /// Whether a named variable was written through set_named_variable_value since the written flags were cleared
+  bool namedVarWritten(int id) const { return id < static_cast<int>(writtenNamedVars.size()) && writtenNamedVars[id]; }
+
+  void setNamedVar(int id, double value) {
+    if (id >= static_cast<int>(writtenNamedVars.size())) {
+      writtenNamedVars.resize(id + 1, false);
+    }
+    writtenNamedVars[id] = true;
+    namedVar(id) = value;
+  }
+
+  /// Number of indices of an aircraft variable that have been read or written
+  int indexCount(int id) const { return id < static_cast<int>(aircraftVars.size()) ? static_cast<int>(aircraftVars[id].size()) : 0; }
+
+  double& aircraftVar(const std::string& name, int index) { return aircraftVar(aircraftVariables.id(name), index); }
+  double& namedVar(const std::string& name) { return namedVar(namedVariables.id(name)); }
+
+  /// Aircraft variables by id and index
+  std::vector<std::vector<double>> aircraftVars;
+  /// Named variables by id
+  std::vector<double> namedVars;
+  /// Named variables written through set_named_variable_value by id
+  std::vector<bool> writtenNamedVars;
+  /// Values written through SimConnect_SetDataOnSimObject since the last frame (definition id, value)
+  std::vector<std::pair<DWORD, double>> objectData;
+};
+
+inline SimulatedGauge* currentGauge = nullptr;
+
+inline ENUM get_units_enum(const char*) {
+  return 0;
+}
+
+inline ENUM get_aircraft_var_enum(const char* name) {
+  return aircraftVariables.id(name);
+}
+
+inline FLOAT64 aircraft_varget(ENUM var, ENUM, int index) {
+  return currentGauge->aircraftVar(var, index);
+}
+
+inline ID register_named_variable(const char* name) {
+  return namedVariables.id(name);
+}
+
+inline FLOAT64 get_named_variable_value(ID id) {
+  return currentGauge->namedVar(id);
+}
+
+inline void set_named_variable_value(ID id, FLOAT64 value) {
+  currentGauge->setNamedVar(id, value);
+}
+
+inline HRESULT SimConnect_SetDataOnSimObject(HANDLE, DWORD defineId, DWORD, DWORD, DWORD, DWORD, void* data) {
+  currentGauge->objectData.emplace_back(defineId, *static_cast<double*>(data));
+  return 0;
+}
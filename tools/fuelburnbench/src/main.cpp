@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// the stand-in needs to be included before the FADEC headers
+#include "GaugeStandIn.h"
+
+#ifdef FADEC_A380X
+#include "A380xFlight.h"
+#else
+#include "A32nxFlight.h"
+#endif
+
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+const double KGS_TO_LBS = 1 / 0.4535934;
+const double FUEL_WEIGHT_GALLON = 6.7;  // LBS
+/// The flight is flown at sea level in the standard atmosphere, the fuel flows of the engines only depend on their N1
+const double AMBIENT_TEMPERATURE = 15;    // degC
+const double AMBIENT_PRESSURE = 1013.25;  // hPa
+
+/// <summary>
+/// Ids of the variables the harness drives every frame
+/// </summary>
+struct DrivenVariables {
+  int tankQuantity = aircraftVariables.id("FUELSYSTEM TANK QUANTITY");
+  int correctedN1 = aircraftVariables.id("TURB ENG CORRECTED N1");
+  int animationTime = aircraftVariables.id("ANIMATION DELTA TIME");
+  int imbalance = namedVariables.id("A32NX_ENGINE_IMBALANCE");
+  int isReady = namedVariables.id("A32NX_IS_READY");
+  int developerState = namedVariables.id("A32NX_DEVELOPER_STATE");
+  int refuelStartedByUser = namedVariables.id("A32NX_REFUEL_STARTED_BY_USR");
+  int refuelRate = namedVariables.id("A32NX_EFB_REFUEL_RATE_SETTING");
+  std::array<int, ENGINE_COUNT> fuelFlow;
+  std::array<int, ENGINE_COUNT> engineState;
+  std::array<int, ENGINE_COUNT> fuelUsed;
+
+  DrivenVariables() {
+    for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+      fuelFlow[engine] = namedVariables.id(fmt::format("A32NX_ENGINE_FF:{}", engine + 1));
+      engineState[engine] = namedVariables.id(fmt::format("A32NX_ENGINE_STATE:{}", engine + 1));
+      fuelUsed[engine] = namedVariables.id(fmt::format("A32NX_FUEL_USED:{}", engine + 1));
+    }
+  }
+};
+
+const DrivenVariables driven;
+
+/// <summary>
+/// Runs the FADEC through its update like the gauge does, the engine logic computes the fuel flows that the fuel logic burns
+/// </summary>
+class FuelEngineControl {
+ public:
+  /// the FADEC creates its own SimVars on the current gauge when it is initialized
+  explicit FuelEngineControl(SimVars*) {
+    engineControl.setFuelStateSaving(false);
+    engineControl.initialize("FUELBURNBENCH");
+    // the imbalance is random, the engines run balanced so that their fuel flows follow the script
+    currentGauge->namedVar(driven.imbalance) = 0;
+  }
+
+  void step(double deltaTime) {
+    simulationTime += deltaTime;
+    engineControl.update(deltaTime, simulationTime);
+  }
+
+  /// <summary>
+  /// Tank written by a SimConnect data definition, -1 if the definition is not a tank
+  /// </summary>
+  static int tankOf(DWORD defineId) {
+    for (int tank = 0; tank < TANK_COUNT; tank++) {
+      if (static_cast<DWORD>(EngineTraits::TANKS[tank].dataType) == defineId) {
+        return tank;
+      }
+    }
+    return -1;
+  }
+
+ private:
+  // value initialized like the global instance of the gauge
+  EngineControl engineControl{};
+  double simulationTime = 0;  // s
+};
+
+/// <summary>
+/// Corrected N1 at which the engine logic of the FADEC computes the fuel flow, found by bisection
+/// </summary>
+double correctedN1For(double fuelFlow) {
+  if (fuelFlow <= 0) {
+    return 0;
+  }
+
+  // the corrected fuel flow polynomial rises with N1 everywhere
+  EngineTraits::PolynomialType polynomial;
+  const double ratio = (1 / KGS_TO_LBS) * EngineRatios::delta2(0, AMBIENT_PRESSURE) * std::sqrt(EngineRatios::theta2(0, AMBIENT_TEMPERATURE));
+  double low = 0;
+  double high = 150;
+  for (int i = 0; i < 60; i++) {
+    double middle = (low + high) / 2;
+    if (polynomial.correctedFuelFlow(middle, 0, 0) * ratio < fuelFlow) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return high;
+}
+
+/// <summary>
+/// Aircraft state, FADEC and the time it spent in the fuel logic
+/// </summary>
+template <typename Fuel>
+struct FlownAircraft {
+  SimulatedGauge gauge;
+  SimVars* simVars;
+  Fuel fuel;
+  double fuelTime = 0;  // s
+
+  FlownAircraft() : simVars(createSimVars(gauge)), fuel(simVars) {
+    // the SimVars zero all their variables when they are created, only what the frames write is compared
+    gauge.writtenNamedVars.clear();
+  }
+
+  static SimVars* createSimVars(SimulatedGauge& gauge) {
+    currentGauge = &gauge;
+    return new SimVars();
+  }
+};
+
+/// <summary>
+/// Applies the cockpit and sim side of a frame: switches, engine speeds and the fuel the sim moved by itself
+/// </summary>
+void applyFrame(SimulatedGauge& gauge,
+                const FlightPhase& phase,
+                const std::array<double, ENGINE_COUNT>& correctedN1,
+                bool phaseStart,
+                double animationTime,
+                double deltaTime) {
+  if (phaseStart) {
+    for (const AircraftVarSetting& setting : phase.settings) {
+      gauge.aircraftVar(setting.name, setting.index) = setting.value;
+    }
+    if (phase.tamperTank != OUTSIDE) {
+      gauge.aircraftVar(driven.tankQuantity, phase.tamperTank + 1) += phase.tamperAmount / FUEL_WEIGHT_GALLON;
+    }
+  }
+
+  gauge.namedVar(driven.isReady) = 1;
+  gauge.namedVar(driven.developerState) = phase.developerState;
+  gauge.namedVar(driven.refuelStartedByUser) = phase.refuel ? 1 : 0;
+  gauge.namedVar(driven.refuelRate) = 2;
+  // the FADEC detects a pause by the animation delta time not changing between frames
+  gauge.aircraftVar(driven.animationTime, 0) = animationTime;
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    gauge.aircraftVar(driven.correctedN1, engine + 1) = correctedN1[engine];
+  }
+
+  if (phase.paused) {
+    return;
+  }
+
+  double hours = deltaTime / 3600;
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    double& quantity = gauge.aircraftVar(driven.tankQuantity, EngineTraits::FEED_TANKS[engine] + 1);
+    quantity = std::max(0.0, quantity - phase.fuelFlow[engine] * hours * KGS_TO_LBS / FUEL_WEIGHT_GALLON);
+  }
+  for (const FuelTransfer& transfer : phase.transfers) {
+    double amount = transfer.rate * hours / FUEL_WEIGHT_GALLON;  // USG
+    if (transfer.source != OUTSIDE) {
+      double& source = gauge.aircraftVar(driven.tankQuantity, transfer.source + 1);
+      amount = std::min(amount, source);
+      source -= amount;
+    }
+    if (transfer.destination != OUTSIDE) {
+      gauge.aircraftVar(driven.tankQuantity, transfer.destination + 1) += amount;
+    }
+  }
+}
+
+/// <summary>
+/// Runs the FADEC or the reference fuel logic of one aircraft for a frame and writes the quantities it set back into the tanks
+/// </summary>
+template <typename Fuel>
+void runFuel(FlownAircraft<Fuel>& aircraft, const FlightPhase& phase, double deltaTime) {
+  currentGauge = &aircraft.gauge;
+  if constexpr (!std::is_same_v<Fuel, FuelEngineControl>) {
+    aircraft.fuel.setPaused(phase.paused);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  if constexpr (std::is_same_v<Fuel, FuelEngineControl>) {
+    aircraft.fuel.step(deltaTime);
+  } else {
+    aircraft.fuel.updateFuel(deltaTime);
+  }
+  aircraft.fuelTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  for (const auto& [defineId, value] : aircraft.gauge.objectData) {
+    int tank = FuelEngineControl::tankOf(defineId);
+    if (tank >= 0) {
+      aircraft.gauge.aircraftVar(driven.tankQuantity, tank + 1) = value;
+    }
+  }
+  aircraft.gauge.objectData.clear();
+}
+
+/// <summary>
+/// Hands the fuel flows and states the engine logic of the FADEC computed to the reference fuel logic
+/// </summary>
+void copyEngineOutputs(SimulatedGauge& from, SimulatedGauge& to) {
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    to.namedVar(driven.fuelFlow[engine]) = from.namedVar(driven.fuelFlow[engine]);
+    to.namedVar(driven.engineState[engine]) = from.namedVar(driven.engineState[engine]);
+  }
+}
+
+bool matches(double reference, double value, double tolerance) {
+  return std::abs(reference - value) <= tolerance * std::max({1.0, std::abs(reference), std::abs(value)});
+}
+
+/// <summary>
+/// Named variables compared between the two aircraft, the pump states are driven by wall clock timers and left out
+/// </summary>
+std::vector<int> comparedNamedVariables() {
+  std::vector<int> ids;
+  for (int id = 0; id < static_cast<int>(namedVariables.size()); id++) {
+    if (namedVariables.name(id).find("PUMP_STATE") == std::string::npos) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+/// <summary>
+/// Compares the named variables that the reference fuel logic wrote and all aircraft variables of the two aircraft
+/// </summary>
+/// <returns>Name and values of the first differing variable, empty if all match.</returns>
+std::string compare(SimulatedGauge& reference, SimulatedGauge& refactored, const std::vector<int>& namedIds, double tolerance) {
+  for (int id : namedIds) {
+    if (reference.namedVarWritten(id) && !matches(reference.namedVar(id), refactored.namedVar(id), tolerance)) {
+      return fmt::format("{} reference {} refactored {}", namedVariables.name(id), reference.namedVar(id), refactored.namedVar(id));
+    }
+  }
+  for (int id = 0; id < static_cast<int>(aircraftVariables.size()); id++) {
+    int indexCount = std::max(reference.indexCount(id), refactored.indexCount(id));
+    for (int index = 0; index < indexCount; index++) {
+      if (!matches(reference.aircraftVar(id, index), refactored.aircraftVar(id, index), tolerance)) {
+        return fmt::format("{}:{} reference {} refactored {}", aircraftVariables.name(id), index, reference.aircraftVar(id, index),
+                           refactored.aircraftVar(id, index));
+      }
+    }
+  }
+  return {};
+}
+
+double totalFuel(SimulatedGauge& gauge) {
+  double total = 0;
+  for (int tank = 0; tank < TANK_COUNT; tank++) {
+    total += gauge.aircraftVar(driven.tankQuantity, tank + 1) * FUEL_WEIGHT_GALLON;
+  }
+  return total;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  double frameRate = 30;
+  double tolerance = 1e-9;
+  bool oVerbose = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(fmt::format("Flies the {} fuel consumption of the FADEC against the implementation before the fuel network", AIRCRAFT));
+  args.addArgument({"-r", "--rate"}, &frameRate, "Frames per second");
+  args.addArgument({"-t", "--tolerance"}, &tolerance, "Relative tolerance of the comparison");
+  args.addArgument({"-v", "--verbose"}, &oVerbose, "Print the fuel state after every phase");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  if (frameRate <= 0) {
+    fmt::print("Frame rate must be positive!\n");
+    return -1;
+  }
+
+  FlownAircraft<ReferenceFuel> reference;
+  FlownAircraft<FuelEngineControl> refactored;
+  for (SimulatedGauge* gauge : {&reference.gauge, &refactored.gauge}) {
+    gauge->aircraftVar("FUEL WEIGHT PER GALLON", 0) = FUEL_WEIGHT_GALLON;
+    gauge->aircraftVar("AMBIENT TEMPERATURE", 0) = AMBIENT_TEMPERATURE;
+    gauge->aircraftVar("AMBIENT PRESSURE", 0) = AMBIENT_PRESSURE;
+    for (int tank = 0; tank < TANK_COUNT; tank++) {
+      gauge->aircraftVar(driven.tankQuantity, tank + 1) = INITIAL_FUEL[tank] / FUEL_WEIGHT_GALLON;
+    }
+  }
+
+  std::vector<int> namedIds = comparedNamedVariables();
+  double deltaTime = 1 / frameRate;
+  uint64_t frames = 0;
+  double flightTime = 0;
+  double startFuel = 0;
+  double animationTime = 0;
+
+  for (const FlightPhase& phase : scriptedFlight()) {
+    std::array<double, ENGINE_COUNT> correctedN1;
+    for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+      correctedN1[engine] = correctedN1For(phase.fuelFlow[engine]);
+    }
+
+    uint64_t phaseFrames = static_cast<uint64_t>(std::llround(phase.duration * frameRate));
+    for (uint64_t frame = 0; frame < phaseFrames; frame++) {
+      if (!phase.paused) {
+        animationTime += deltaTime;
+      }
+      applyFrame(reference.gauge, phase, correctedN1, frame == 0, animationTime, deltaTime);
+      applyFrame(refactored.gauge, phase, correctedN1, frame == 0, animationTime, deltaTime);
+
+      runFuel(refactored, phase, deltaTime);
+      copyEngineOutputs(refactored.gauge, reference.gauge);
+      runFuel(reference, phase, deltaTime);
+
+      std::string difference = compare(reference.gauge, refactored.gauge, namedIds, tolerance);
+      if (!difference.empty()) {
+        fmt::print("Divergence in phase '{}' at {:.3f} s: {}\n", phase.name, flightTime + frame * deltaTime, difference);
+        return 1;
+      }
+    }
+    frames += phaseFrames;
+    flightTime += phaseFrames * deltaTime;
+
+    if (phase.refuel) {
+      startFuel = totalFuel(refactored.gauge);
+    }
+    if (oVerbose) {
+      fmt::print("{:<40} {:>8.0f} s {:>10.1f} LBS\n", phase.name, flightTime, totalFuel(refactored.gauge));
+    }
+  }
+
+  double fuelUsed = 0;
+  for (int engine = 0; engine < ENGINE_COUNT; engine++) {
+    fuelUsed += refactored.gauge.namedVar(driven.fuelUsed[engine]);
+  }
+
+  fmt::print("Flew {} frames ({:.1f} h) on the {}, fuel used {:.1f} KG, {:.1f} LBS left of {:.1f} LBS after the refuel\n", frames,
+             flightTime / 3600, AIRCRAFT, fuelUsed, totalFuel(refactored.gauge), startFuel);
+  fmt::print("Time: reference fuel logic {:.1f} ms, FADEC update with the engine logic {:.1f} ms\n", reference.fuelTime * 1000,
+             refactored.fuelTime * 1000);
+  fmt::print("Reference and refactored match within {}\n", tolerance);
+  return 0;
+}
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "ElevationFileWriter.h"
+#include "ElevationTileCache.h"
+
+namespace {
+
+const double FEET_PER_METER = 3.28084;
+// the samples on the border of a cell belong to it, the rounding errors of the degrees must not move them out
+const double BORDER_EPSILON = 1.0e-9;
+
+std::vector<uint8_t> deflateBytes(const std::vector<uint8_t>& data) {
+  z_stream stream{};
+  deflateInit(&stream, Z_BEST_COMPRESSION);
+  std::vector<uint8_t> compressed(deflateBound(&stream, static_cast<uLong>(data.size())));
+  stream.next_in = const_cast<Bytef*>(data.data());
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = compressed.data();
+  stream.avail_out = static_cast<uInt>(compressed.size());
+  deflate(&stream, Z_FINISH);
+  compressed.resize(stream.total_out);
+  deflateEnd(&stream);
+  return compressed;
+}
+
+int16_t toFeet(int16_t elevation_m) {
+  if (elevation_m == HgtDirectory::VOID_ELEVATION) {
+    return 0;
+  }
+  return static_cast<int16_t>(std::clamp<long>(std::lround(elevation_m * FEET_PER_METER), INT16_MIN, INT16_MAX));
+}
+
+}  // namespace
+
+bool ElevationFileWriter::write(const std::string& path, std::vector<Statistics>& levels) {
+  std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+  if (!stream) {
+    return false;
+  }
+
+  ElevationFileHeader header{};
+  std::copy(std::begin(ELEVATION_FILE_MAGIC), std::end(ELEVATION_FILE_MAGIC), header.magic);
+  header.version = ELEVATION_FILE_VERSION;
+  header.tileSamples = settings.tileSamples;
+  header.levelCount = settings.levelCount;
+  header.compression = settings.compress ? ELEVATION_COMPRESSION_DEFLATE : ELEVATION_COMPRESSION_NONE;
+
+  std::vector<ElevationLevel> descriptors(settings.levelCount);
+  levels.assign(settings.levelCount, Statistics());
+  uint64_t position = sizeof(header) + settings.levelCount * sizeof(ElevationLevel);
+  stream.seekp(static_cast<std::streamoff>(position));
+
+  std::vector<int16_t> samples(static_cast<size_t>(settings.tileSamples) * settings.tileSamples);
+  std::vector<uint8_t> stored;
+  for (uint8_t level = 0; level < settings.levelCount; level++) {
+    const double span = settings.finestTileSpan_deg * static_cast<double>(1u << level);
+    auto& descriptor = descriptors[level];
+    auto& statistics = levels[level];
+    descriptor.tileSpan = static_cast<float>(span);
+    descriptor.tilesLongitude = static_cast<uint32_t>(std::ceil(360.0 / span));
+    descriptor.tilesLatitude = static_cast<uint32_t>(std::ceil(180.0 / span));
+    descriptor.indexOffset = position;
+
+    std::vector<ElevationTileEntry> index(static_cast<size_t>(descriptor.tilesLongitude) * descriptor.tilesLatitude);
+    position += index.size() * sizeof(ElevationTileEntry);
+    if (position > ELEVATION_FILE_MAX_SIZE) {
+      return false;
+    }
+    stream.seekp(static_cast<std::streamoff>(position));
+
+    for (uint32_t row = 0; row < descriptor.tilesLatitude; row++) {
+      for (uint32_t column = 0; column < descriptor.tilesLongitude; column++) {
+        auto& entry = index[static_cast<size_t>(row) * descriptor.tilesLongitude + column];
+        if (!sampleTile(row * span - 90.0, column * span - 180.0, span, statistics)) {
+          entry = {0, 0, 0};
+          continue;
+        }
+
+        std::transform(cells.begin(), cells.end(), samples.begin(), toFeet);
+        const auto [lowest, highest] = std::minmax_element(samples.begin(), samples.end());
+        if (*lowest == *highest) {
+          entry = {0, 0, *highest};
+          statistics.uniformTiles++;
+          continue;
+        }
+
+        const auto* bytes = reinterpret_cast<const uint8_t*>(samples.data());
+        stored.assign(bytes, bytes + samples.size() * sizeof(int16_t));
+        if (settings.compress) {
+          stored = deflateBytes(stored);
+        }
+        if (position + stored.size() > ELEVATION_FILE_MAX_SIZE) {
+          return false;
+        }
+        entry = {position, static_cast<uint32_t>(stored.size()), *highest};
+        stream.write(reinterpret_cast<const char*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+        position += stored.size();
+        statistics.storedTiles++;
+        statistics.bytes += stored.size();
+      }
+    }
+
+    stream.seekp(static_cast<std::streamoff>(descriptor.indexOffset));
+    stream.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(index[0])));
+    stream.seekp(static_cast<std::streamoff>(position));
+  }
+
+  stream.seekp(0);
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  stream.write(reinterpret_cast<const char*>(descriptors.data()),
+               static_cast<std::streamsize>(descriptors.size() * sizeof(descriptors[0])));
+  return static_cast<bool>(stream);
+}
+
+bool ElevationFileWriter::sampleTile(double south, double west, double span, Statistics& statistics) {
+  cells.assign(static_cast<size_t>(settings.tileSamples) * settings.tileSamples, HgtDirectory::VOID_ELEVATION);
+
+  // the height files are read one after the other, every file belongs to a single tile of the level
+  bool touched = false;
+  const double spacing = span / settings.tileSamples;
+  const int northEdge = std::min(static_cast<int>(std::ceil(south + span)), 90);
+  const int eastEdge = std::min(static_cast<int>(std::ceil(west + span)), 180);
+  for (int latitude = std::max(static_cast<int>(std::floor(south)), -90); latitude < northEdge; latitude++) {
+    for (int longitude = std::max(static_cast<int>(std::floor(west)), -180); longitude < eastEdge; longitude++) {
+      if (directory.read(latitude, longitude, file)) {
+        sampleFile(south, west, spacing);
+        statistics.readFiles++;
+        touched = true;
+      }
+    }
+  }
+  return touched;
+}
+
+void ElevationFileWriter::sampleFile(double south, double west, double spacing) {
+  const int last = static_cast<int>(file.samples) - 1;
+  const int tileSamples = settings.tileSamples;
+  const double latitude = file.latitude;
+  const double longitude = file.longitude;
+
+  // the cells of the tile that overlap the square degree of the file
+  const int firstRow = std::max(static_cast<int>(std::floor((latitude - south) / spacing)), 0);
+  const int lastRow = std::min(static_cast<int>(std::ceil((latitude + 1.0 - south) / spacing)), tileSamples) - 1;
+  const int firstColumn = std::max(static_cast<int>(std::floor((longitude - west) / spacing)), 0);
+  const int lastColumn = std::min(static_cast<int>(std::ceil((longitude + 1.0 - west) / spacing)), tileSamples) - 1;
+
+  for (int row = firstRow; row <= lastRow; row++) {
+    // the file owns the rows 1 to last from the north and the columns 0 to last - 1 from the west
+    const double cellSouth = south + row * spacing;
+    const int northSample = std::max(static_cast<int>(std::floor((latitude + 1.0 - cellSouth - spacing) * last + BORDER_EPSILON)) + 1, 1);
+    const int southSample = std::min(static_cast<int>(std::floor((latitude + 1.0 - cellSouth) * last + BORDER_EPSILON)), last);
+
+    for (int column = firstColumn; column <= lastColumn; column++) {
+      const double cellWest = west + column * spacing;
+      const int westSample = std::max(static_cast<int>(std::ceil((cellWest - longitude) * last - BORDER_EPSILON)), 0);
+      const int eastSample = std::min(static_cast<int>(std::ceil((cellWest + spacing - longitude) * last - BORDER_EPSILON)) - 1, last - 1);
+
+      int16_t highest = HgtDirectory::VOID_ELEVATION;
+      if (northSample <= southSample && westSample <= eastSample) {
+        for (int sampleRow = northSample; sampleRow <= southSample; sampleRow++) {
+          const int16_t* elevations = &file.elevations[static_cast<size_t>(sampleRow) * file.samples];
+          for (int sampleColumn = westSample; sampleColumn <= eastSample; sampleColumn++) {
+            highest = std::max(highest, elevations[sampleColumn]);
+          }
+        }
+      } else {
+        // a cell finer than the file takes the nearest sample
+        const int sampleRow = std::clamp(static_cast<int>(std::lround((latitude + 1.0 - cellSouth - spacing / 2) * last)), 0, last);
+        const int sampleColumn = std::clamp(static_cast<int>(std::lround((cellWest + spacing / 2 - longitude) * last)), 0, last);
+        highest = file.elevations[static_cast<size_t>(sampleRow) * file.samples + sampleColumn];
+      }
+
+      auto& cell = cells[static_cast<size_t>(row) * tileSamples + column];
+      cell = std::max(cell, highest);
+    }
+  }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "HgtDirectory.h"
+
+/// <summary>
+/// Writes the pyramid of a directory of height files into a local elevation file of the terrain on ND
+/// </summary>
+/// <remarks>
+/// Every sample of a tile is the highest elevation of the height files in its cell, so the coarse levels never hide
+/// terrain. Cells of the sea and tiles without a height file have the elevation 0 and tiles with a single elevation
+/// are not stored. The layout is the one of ElevationTileCache.h.
+/// </remarks>
+class ElevationFileWriter {
+ public:
+  struct Settings {
+    uint16_t tileSamples = 128;
+    uint8_t levelCount = 8;
+    // the span of the tiles of level 0, every level doubles it
+    double finestTileSpan_deg = 1.0;
+    bool compress = true;
+  };
+
+  struct Statistics {
+    uint64_t storedTiles = 0;
+    uint64_t uniformTiles = 0;
+    uint64_t readFiles = 0;
+    uint64_t bytes = 0;
+  };
+
+  ElevationFileWriter(const HgtDirectory& directory, const Settings& settings) : directory(directory), settings(settings) {}
+
+  /// <summary>
+  /// Writes the elevation file, the statistics cover the levels
+  /// </summary>
+  /// <returns>false if the file cannot be written or grows beyond ELEVATION_FILE_MAX_SIZE</returns>
+  bool write(const std::string& path, std::vector<Statistics>& levels);
+
+ private:
+  const HgtDirectory& directory;
+  Settings settings;
+  HgtDirectory::Tile file;
+  // the highest elevation in meters per cell of the tile, VOID_ELEVATION if the cell has no sample
+  std::vector<int16_t> cells;
+
+  /// fills the cells of the tile, false if no height file touches it
+  bool sampleTile(double south, double west, double span, Statistics& statistics);
+  /// the highest samples of the height file in the cells that it overlaps
+  void sampleFile(double south, double west, double spacing);
+};
@@ -0,0 +1,71 @@
+#include <cctype>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+#include "HgtDirectory.h"
+
+namespace {
+
+/// parses N47E010.hgt into 47 and 10, S and W are negative
+bool parseName(std::string name, int& latitude, int& longitude) {
+  for (auto& character : name) {
+    character = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+  }
+  if (name.size() != 11 || name.compare(7, 4, ".HGT") != 0 || (name[0] != 'N' && name[0] != 'S') || (name[3] != 'E' && name[3] != 'W')) {
+    return false;
+  }
+  for (size_t i : {1, 2, 4, 5, 6}) {
+    if (!std::isdigit(static_cast<unsigned char>(name[i]))) {
+      return false;
+    }
+  }
+
+  latitude = std::stoi(name.substr(1, 2)) * (name[0] == 'S' ? -1 : 1);
+  longitude = std::stoi(name.substr(4, 3)) * (name[3] == 'W' ? -1 : 1);
+  return latitude >= -90 && latitude < 90 && longitude >= -180 && longitude < 180;
+}
+
+}  // namespace
+
+bool HgtDirectory::scan(const std::string& directory) {
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+    int latitude = 0;
+    int longitude = 0;
+    if (entry.is_regular_file() && parseName(entry.path().filename().string(), latitude, longitude)) {
+      files[{latitude, longitude}] = entry.path().string();
+    }
+  }
+  return !error;
+}
+
+bool HgtDirectory::read(int latitude, int longitude, Tile& tile) const {
+  const auto file = files.find({latitude, longitude});
+  if (file == files.end()) {
+    return false;
+  }
+
+  std::ifstream stream(file->second, std::ios::binary | std::ios::ate);
+  const auto size = static_cast<size_t>(stream.tellg());
+  const auto samples = static_cast<uint32_t>(std::lround(std::sqrt(static_cast<double>(size / 2))));
+  if (!stream || samples < 2 || static_cast<size_t>(samples) * samples * 2 != size) {
+    return false;
+  }
+
+  std::vector<uint8_t> bytes(size);
+  stream.seekg(0);
+  stream.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(size));
+  if (!stream) {
+    return false;
+  }
+
+  tile.latitude = latitude;
+  tile.longitude = longitude;
+  tile.samples = samples;
+  tile.elevations.resize(static_cast<size_t>(samples) * samples);
+  for (size_t i = 0; i < tile.elevations.size(); i++) {
+    tile.elevations[i] = static_cast<int16_t>((bytes[2 * i] << 8) | bytes[2 * i + 1]);
+  }
+  return true;
+}
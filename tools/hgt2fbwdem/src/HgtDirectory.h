@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// The SRTM height files of a directory, one file per square degree
+/// </summary>
+/// <remarks>
+/// A file is named after its south west corner (i.e. N47E010.hgt) and contains n x n big-endian std::int16_t elevations
+/// in meters in rows from the north, the first row and the last column are the edges of the neighbouring files. The
+/// resolution is derived from the file size, 1201 x 1201 for three and 3601 x 3601 for one arc second.
+/// </remarks>
+class HgtDirectory {
+ public:
+  static constexpr int16_t VOID_ELEVATION = INT16_MIN;
+
+  struct Tile {
+    int latitude = 0;
+    int longitude = 0;
+    uint32_t samples = 0;
+    // the elevations in meters in rows from the north
+    std::vector<int16_t> elevations;
+  };
+
+  /// <summary>
+  /// Lists the height files of the directory
+  /// </summary>
+  /// <returns>false if the directory cannot be read</returns>
+  bool scan(const std::string& directory);
+
+  size_t fileCount() const { return files.size(); }
+  bool contains(int latitude, int longitude) const { return files.find({latitude, longitude}) != files.end(); }
+
+  /// <summary>
+  /// Reads the file of the square degree with the south west corner
+  /// </summary>
+  /// <returns>false if there is no file or it has no square number of samples</returns>
+  bool read(int latitude, int longitude, Tile& tile) const;
+
+ private:
+  std::map<std::pair<int, int>, std::string> files;
+};
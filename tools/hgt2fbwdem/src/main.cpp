@@ -0,0 +1,99 @@
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+#include "ElevationFileWriter.h"
+#include "ElevationTileCache.h"
+#include "HgtDirectory.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  std::string inDirectory;
+  std::string outFilePath = "terrain.fbwdem";
+  uint32_t tileSamples = 128;
+  uint32_t levelCount = 8;
+  double finestTileSpan_deg = 1.0;
+  bool noCompression = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Converts a directory of SRTM height files into the local elevation file of the terrain on ND");
+  args.addArgument({"-i", "--in"}, &inDirectory, "Input directory with the .hgt files");
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output file, the gauge reads it from \\work\\terrain.fbwdem");
+  args.addArgument({"-t", "--tile-samples"}, &tileSamples, "Number of samples per side of a tile");
+  args.addArgument({"-l", "--levels"}, &levelCount, "Number of levels, every level doubles the span of the tiles");
+  args.addArgument({"-s", "--tile-span"}, &finestTileSpan_deg, "Span of the tiles of the finest level in degrees");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Store the tiles as raw samples");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // check parameters
+  if (inDirectory.empty() || !std::filesystem::is_directory(inDirectory)) {
+    fmt::print("Input directory missing or does not exist!\n");
+    return 1;
+  }
+  if (tileSamples < 2 || tileSamples > 1024) {
+    fmt::print("The tiles must have between 2 and 1024 samples per side!\n");
+    return 1;
+  }
+  if (levelCount == 0 || levelCount > 16) {
+    fmt::print("The file must have between 1 and 16 levels!\n");
+    return 1;
+  }
+  if (finestTileSpan_deg <= 0.0 || finestTileSpan_deg * (1u << (levelCount - 1)) > 360.0) {
+    fmt::print("The tiles of the coarsest level must not span more than 360 degrees!\n");
+    return 1;
+  }
+
+  HgtDirectory directory;
+  if (!directory.scan(inDirectory) || directory.fileCount() == 0) {
+    fmt::print("No .hgt files in {}!\n", inDirectory);
+    return 1;
+  }
+  fmt::print("{} height files in {}\n", directory.fileCount(), inDirectory);
+
+  ElevationFileWriter::Settings settings;
+  settings.tileSamples = static_cast<uint16_t>(tileSamples);
+  settings.levelCount = static_cast<uint8_t>(levelCount);
+  settings.finestTileSpan_deg = finestTileSpan_deg;
+  settings.compress = !noCompression;
+
+  const auto start = std::chrono::steady_clock::now();
+  ElevationFileWriter writer(directory, settings);
+  std::vector<ElevationFileWriter::Statistics> levels;
+  if (!writer.write(outFilePath, levels)) {
+    fmt::print("Unable to write {} or it exceeds {} MiB!\n", outFilePath, ELEVATION_FILE_MAX_SIZE / (1024 * 1024));
+    return 1;
+  }
+  for (size_t level = 0; level < levels.size(); level++) {
+    fmt::print("  level {:2}  {:8.3f} deg tiles  {:7} stored {:7} uniform  {:9} KiB  {:7} files read\n", level,
+               finestTileSpan_deg * (1u << level), levels[level].storedTiles, levels[level].uniformTiles, levels[level].bytes / 1024,
+               levels[level].readFiles);
+  }
+
+  // the gauge has to accept the file
+  ElevationTileCache cache(16 * 1024 * 1024);
+  if (!cache.open(outFilePath)) {
+    fmt::print("The elevation tile cache rejects {}!\n", outFilePath);
+    return 1;
+  }
+  fmt::print("{} KiB written to {} in {:.1f} s\n", std::filesystem::file_size(outFilePath) / 1024, outFilePath,
+             std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  return 0;
+}
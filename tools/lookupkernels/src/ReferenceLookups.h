@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+// the lookups generated by Simulink in the real_T of the aircraft (double)
+#include "look1_binlxpw.h"
+#include "look2_binlxpw.h"
+#include "look2_pbinlxpw.h"
+
+namespace single_precision {
+
+/// the generated look1_binlxpw() built with FBW_MODEL_SINGLE_PRECISION (float real_T)
+float look1_binlxpw(float u0, const float bp0[], const float table[], uint32_t maxIndex);
+
+/// the generated look2_binlxpw() built with FBW_MODEL_SINGLE_PRECISION (float real_T)
+float look2_binlxpw(float u0, float u1, const float bp0[], const float bp1[], const float table[], const uint32_t maxIndex[], uint32_t stride);
+
+/// the generated look2_pbinlxpw() built with FBW_MODEL_SINGLE_PRECISION (float real_T)
+float look2_pbinlxpw(float u0,
+                     float u1,
+                     const float bp0[],
+                     const float bp1[],
+                     const float table[],
+                     uint32_t prevIndex[],
+                     const uint32_t maxIndex[],
+                     uint32_t stride);
+
+}  // namespace single_precision
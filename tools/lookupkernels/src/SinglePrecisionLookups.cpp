@@ -0,0 +1,10 @@
+// the generated headers must not be included before, rtwtypes.h would keep the double real_T in the namespace
+
+// switches real_T of the models to float (see rtwtypes.h)
+#define FBW_MODEL_SINGLE_PRECISION
+
+namespace single_precision {
+#include "look1_binlxpw.cpp"
+#include "look2_binlxpw.cpp"
+#include "look2_pbinlxpw.cpp"
+}  // namespace single_precision
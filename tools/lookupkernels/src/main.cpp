@@ -0,0 +1,381 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "LookupKernels.h"
+#include "ReferenceLookups.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+/// table sizes of the 1-D lookups, 1 to 8 intervals take the branch-free interval selection
+using Look1Sizes = std::integer_sequence<uint32_t, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 40>;
+/// strides of the 2-D lookups, i.e. the number of breakpoints of the first dimension
+using Look2Strides = std::integer_sequence<uint32_t, 2, 3, 4, 5, 6, 7, 8, 9, 10, 13, 41>;
+/// sizes of the second dimension of the 2-D lookups, always searched at runtime
+const uint32_t LOOK2_SECOND_SIZES[] = {1, 2, 5, 8, 13};
+/// tables with different breakpoints checked per size
+const int TABLES_PER_SIZE = 4;
+
+template <typename T>
+using Look1Reference = T (*)(T, const T[], const T[], uint32_t);
+template <typename T>
+using Look2Reference = T (*)(T, T, const T[], const T[], const T[], const uint32_t[], uint32_t);
+template <typename T>
+using Look2CachedReference = T (*)(T, T, const T[], const T[], const T[], uint32_t[], const uint32_t[], uint32_t);
+
+/// <summary>
+/// Counts the comparisons of a kernel against its reference and keeps the first mismatches for the report
+/// </summary>
+class KernelReport {
+ public:
+  explicit KernelReport(uint32_t topCount) : topCount(topCount) {}
+
+  template <typename T>
+  void compare(const std::string& kernel, T expected, T actual, T u0, T u1 = 0) {
+    comparisons++;
+    // bit for bit, so a different NaN or the sign of a zero counts as a mismatch as well
+    if (std::memcmp(&expected, &actual, sizeof(T)) == 0) {
+      return;
+    }
+    fail(fmt::format("{:<28} u0 {:<24} u1 {:<24} expected {:<24} kernel {}", kernel, u0, u1, expected, actual));
+  }
+
+  /// checks the interval a cached kernel kept for the next call
+  template <typename T>
+  void compareIndex(const std::string& kernel, uint32_t index, uint32_t maxIndex, T u0) {
+    comparisons++;
+    if (index < maxIndex) {
+      return;
+    }
+    fail(fmt::format("{:<28} u0 {:<24} kept interval {} of {}", kernel, u0, index, maxIndex));
+  }
+
+  uint64_t comparisons = 0;
+  uint64_t mismatches = 0;
+  std::vector<std::string> examples;
+
+ private:
+  uint32_t topCount;
+
+  void fail(std::string example) {
+    mismatches++;
+    if (examples.size() < topCount) {
+      examples.push_back(std::move(example));
+    }
+  }
+};
+
+/// <summary>
+/// Strictly increasing breakpoints with an irregular spacing, crossing zero
+/// </summary>
+template <typename T>
+std::vector<T> breakpoints(uint32_t maxIndex, std::mt19937& rng) {
+  std::uniform_real_distribution<double> spacing(0.1, 10);
+  std::vector<T> bp(maxIndex + 1);
+  double value = -5.0 * maxIndex;
+  for (auto& breakpoint : bp) {
+    breakpoint = static_cast<T>(value);
+    value += spacing(rng);
+  }
+  return bp;
+}
+
+template <typename T>
+std::vector<T> tableValues(size_t count, std::mt19937& rng) {
+  std::uniform_real_distribution<double> value(-100, 100);
+  std::vector<T> table(count);
+  for (auto& entry : table) {
+    entry = static_cast<T>(value(rng));
+  }
+  return table;
+}
+
+/// <summary>
+/// Inputs of one dimension: NaN, infinities, the breakpoints and their neighbours, the interval midpoints, extrapolation on
+/// both sides and random values over and beyond the breakpoints
+/// </summary>
+template <typename T>
+std::vector<T> testInputs(const std::vector<T>& bp, uint32_t randomCount, std::mt19937& rng) {
+  const T inf = std::numeric_limits<T>::infinity();
+  std::vector<T> inputs = {std::numeric_limits<T>::quiet_NaN(),
+                           -std::numeric_limits<T>::quiet_NaN(),
+                           inf,
+                           -inf,
+                           std::numeric_limits<T>::lowest(),
+                           std::numeric_limits<T>::max(),
+                           static_cast<T>(0),
+                           static_cast<T>(-0.0)};
+
+  for (size_t i = 0; i < bp.size(); i++) {
+    inputs.push_back(bp[i]);
+    inputs.push_back(std::nextafter(bp[i], -inf));
+    inputs.push_back(std::nextafter(bp[i], inf));
+    if (i + 1 < bp.size()) {
+      inputs.push_back((bp[i] + bp[i + 1]) / 2);
+    }
+  }
+
+  T range = bp.back() - bp.front();
+  for (T distance : {range / 100, range, 1000 * range}) {
+    inputs.push_back(bp.front() - distance);
+    inputs.push_back(bp.back() + distance);
+  }
+
+  std::uniform_real_distribution<double> value(bp.front() - range / 2, bp.back() + range / 2);
+  for (uint32_t i = 0; i < randomCount; i++) {
+    inputs.push_back(static_cast<T>(value(rng)));
+  }
+  return inputs;
+}
+
+template <uint32_t maxIndex, typename T>
+void checkLook1(Look1Reference<T> reference, uint32_t randomCount, std::mt19937& rng, KernelReport& report) {
+  const std::string kernel = fmt::format("look1_binlxpw<{}>", maxIndex);
+  for (int tableIndex = 0; tableIndex < TABLES_PER_SIZE; tableIndex++) {
+    std::vector<T> bp = breakpoints<T>(maxIndex, rng);
+    std::vector<T> table = tableValues<T>(maxIndex + 1, rng);
+    for (T u0 : testInputs(bp, randomCount, rng)) {
+      report.compare(kernel, reference(u0, bp.data(), table.data(), maxIndex), look1_binlxpw<maxIndex>(u0, bp.data(), table.data()),
+                     u0);
+    }
+  }
+}
+
+template <uint32_t stride, typename T>
+void checkLook2(Look2Reference<T> reference, uint32_t randomCount, std::mt19937& rng, KernelReport& report) {
+  for (uint32_t secondMaxIndex : LOOK2_SECOND_SIZES) {
+    const std::string kernel = fmt::format("look2_binlxpw<{}> x {}", stride, secondMaxIndex + 1);
+    const uint32_t maxIndex[] = {stride - 1, secondMaxIndex};
+    for (int tableIndex = 0; tableIndex < TABLES_PER_SIZE; tableIndex++) {
+      std::vector<T> bp0 = breakpoints<T>(maxIndex[0], rng);
+      std::vector<T> bp1 = breakpoints<T>(maxIndex[1], rng);
+      std::vector<T> table = tableValues<T>(stride * (secondMaxIndex + 1), rng);
+      std::vector<T> inputs1 = testInputs(bp1, randomCount / 10, rng);
+      for (T u0 : testInputs(bp0, randomCount / 10, rng)) {
+        for (T u1 : inputs1) {
+          report.compare(kernel, reference(u0, u1, bp0.data(), bp1.data(), table.data(), maxIndex, stride),
+                         look2_binlxpw<stride>(u0, u1, bp0.data(), bp1.data(), table.data(), maxIndex), u0, u1);
+        }
+      }
+    }
+  }
+}
+
+/// <summary>
+/// Input of a cached lookup over consecutive calls: a slow drift over and beyond the breakpoints, with jumps to distant
+/// intervals, NaN, exact breakpoints and infinities in between
+/// </summary>
+template <typename T>
+std::vector<T> inputSequence(const std::vector<T>& bp, uint32_t length, std::mt19937& rng) {
+  const T inf = std::numeric_limits<T>::infinity();
+  double range = bp.back() - bp.front();
+  std::uniform_real_distribution<double> position(bp.front() - range / 2, bp.back() + range / 2);
+  std::uniform_real_distribution<double> drift(-range / 50, range / 50);
+  std::uniform_int_distribution<size_t> breakpoint(0, bp.size() - 1);
+  std::uniform_int_distribution<int> event(0, 99);
+
+  std::vector<T> sequence;
+  double value = position(rng);
+  for (uint32_t i = 0; i < length; i++) {
+    int kind = event(rng);
+    if (kind < 5) {
+      sequence.push_back(std::numeric_limits<T>::quiet_NaN());
+      continue;
+    }
+    if (kind < 7) {
+      sequence.push_back(kind == 5 ? inf : -inf);
+      continue;
+    }
+
+    if (kind < 12) {
+      value = position(rng);
+    } else if (kind < 17) {
+      value = bp[breakpoint(rng)];
+    } else {
+      value += drift(rng);
+    }
+    sequence.push_back(static_cast<T>(value));
+  }
+  return sequence;
+}
+
+/// intervals the cached kernels start from: the value-initialized DWork, the last interval and indices out of range
+inline std::vector<uint32_t> initialIndices(uint32_t maxIndex) {
+  return {0U, maxIndex - 1U, maxIndex, UINT32_MAX};
+}
+
+template <uint32_t maxIndex, typename T>
+void checkLook1Cached(uint32_t length, std::mt19937& rng, KernelReport& report) {
+  const std::string kernel = fmt::format("look1_pbinlxpw<{}>", maxIndex);
+  for (int tableIndex = 0; tableIndex < TABLES_PER_SIZE; tableIndex++) {
+    std::vector<T> bp = breakpoints<T>(maxIndex, rng);
+    std::vector<T> table = tableValues<T>(maxIndex + 1, rng);
+    std::vector<T> sequence = inputSequence(bp, length, rng);
+    for (uint32_t initialIndex : initialIndices(maxIndex)) {
+      uint32_t prevIndex = initialIndex;
+      for (T u0 : sequence) {
+        report.compare(kernel, look1_binlxpw<maxIndex>(u0, bp.data(), table.data()),
+                       look1_pbinlxpw<maxIndex>(u0, bp.data(), table.data(), &prevIndex), u0);
+        report.compareIndex(kernel, prevIndex, maxIndex, u0);
+      }
+    }
+  }
+}
+
+template <uint32_t stride, typename T>
+void checkLook2Cached(Look2CachedReference<T> generated, uint32_t length, std::mt19937& rng, KernelReport& report) {
+  for (uint32_t secondMaxIndex : LOOK2_SECOND_SIZES) {
+    const std::string kernel = fmt::format("look2_pbinlxpw<{}> x {}", stride, secondMaxIndex + 1);
+    const std::string generatedKernel = fmt::format("generated look2_pbinlxpw {} x {}", stride, secondMaxIndex + 1);
+    const uint32_t maxIndex[] = {stride - 1, secondMaxIndex};
+    for (int tableIndex = 0; tableIndex < TABLES_PER_SIZE; tableIndex++) {
+      std::vector<T> bp0 = breakpoints<T>(maxIndex[0], rng);
+      std::vector<T> bp1 = breakpoints<T>(maxIndex[1], rng);
+      std::vector<T> table = tableValues<T>(stride * (secondMaxIndex + 1), rng);
+      std::vector<T> sequence0 = inputSequence(bp0, length, rng);
+      std::vector<T> sequence1 = inputSequence(bp1, length, rng);
+      std::vector<uint32_t> initial0 = initialIndices(maxIndex[0]);
+      std::vector<uint32_t> initial1 = initialIndices(maxIndex[1]);
+      for (size_t start = 0; start < initial0.size(); start++) {
+        uint32_t prevIndex[] = {initial0[start], initial1[start]};
+        // the generated lookup only accepts intervals in range, it starts from the value-initialized DWork
+        uint32_t generatedIndex[] = {0U, 0U};
+        for (size_t i = 0; i < sequence0.size(); i++) {
+          T u0 = sequence0[i];
+          T u1 = sequence1[i];
+          T actual = look2_pbinlxpw<stride>(u0, u1, bp0.data(), bp1.data(), table.data(), prevIndex, maxIndex);
+          report.compare(kernel, look2_binlxpw<stride>(u0, u1, bp0.data(), bp1.data(), table.data(), maxIndex), actual, u0, u1);
+          report.compareIndex(kernel, prevIndex[0], maxIndex[0], u0);
+          report.compareIndex(kernel, prevIndex[1], maxIndex[1], u1);
+          if (start == 0) {
+            report.compare(generatedKernel, generated(u0, u1, bp0.data(), bp1.data(), table.data(), generatedIndex, maxIndex, stride),
+                           actual, u0, u1);
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename T, uint32_t... MaxIndex>
+void checkLook1Sizes(std::integer_sequence<uint32_t, MaxIndex...>,
+                     Look1Reference<T> reference,
+                     uint32_t randomCount,
+                     std::mt19937& rng,
+                     KernelReport& report) {
+  (checkLook1<MaxIndex, T>(reference, randomCount, rng, report), ...);
+}
+
+template <typename T, uint32_t... Stride>
+void checkLook2Strides(std::integer_sequence<uint32_t, Stride...>,
+                       Look2Reference<T> reference,
+                       uint32_t randomCount,
+                       std::mt19937& rng,
+                       KernelReport& report) {
+  (checkLook2<Stride, T>(reference, randomCount, rng, report), ...);
+}
+
+template <typename T, uint32_t... MaxIndex>
+void checkLook1CachedSizes(std::integer_sequence<uint32_t, MaxIndex...>, uint32_t length, std::mt19937& rng, KernelReport& report) {
+  (checkLook1Cached<MaxIndex, T>(length, rng, report), ...);
+}
+
+template <typename T, uint32_t... Stride>
+void checkLook2CachedStrides(std::integer_sequence<uint32_t, Stride...>,
+                             Look2CachedReference<T> generated,
+                             uint32_t length,
+                             std::mt19937& rng,
+                             KernelReport& report) {
+  (checkLook2Cached<Stride, T>(generated, length, rng, report), ...);
+}
+
+/// <summary>
+/// Prints the result of one kernel and precision
+/// </summary>
+/// <returns>true if the kernel matched its reference bit for bit.</returns>
+bool printReport(const char* name, const KernelReport& report) {
+  bool passed = report.mismatches == 0;
+  fmt::print("{:<32} {:>10} comparisons {:>8} mismatches  {}\n", name, report.comparisons, report.mismatches,
+             passed ? "passed" : "FAILED");
+  for (const auto& example : report.examples) {
+    fmt::print("  {}\n", example);
+  }
+  return passed;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t randomCount = 1000;
+  uint32_t length = 2000;
+  uint32_t seed = 1;
+  uint32_t topCount = 10;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Checks the lookup kernels of LookupKernels.h bit for bit against the generated lookups and the cached kernels "
+                   "against the uncached ones");
+  args.addArgument({"-n", "--random"}, &randomCount, "Number of random inputs per 1-D table, a tenth of it per 2-D dimension");
+  args.addArgument({"-l", "--length"}, &length, "Number of consecutive calls per table of the cached kernels");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed of the breakpoints, table values and random inputs");
+  args.addArgument({"-t", "--top"}, &topCount, "Number of mismatches to print per kernel");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  std::mt19937 rng(seed);
+  bool success = true;
+
+  KernelReport look1Double(topCount);
+  checkLook1Sizes<double>(Look1Sizes{}, ::look1_binlxpw, randomCount, rng, look1Double);
+  success &= printReport("look1_binlxpw double", look1Double);
+
+  KernelReport look1Single(topCount);
+  checkLook1Sizes<float>(Look1Sizes{}, single_precision::look1_binlxpw, randomCount, rng, look1Single);
+  success &= printReport("look1_binlxpw float", look1Single);
+
+  KernelReport look2Double(topCount);
+  checkLook2Strides<double>(Look2Strides{}, ::look2_binlxpw, randomCount, rng, look2Double);
+  success &= printReport("look2_binlxpw double", look2Double);
+
+  KernelReport look2Single(topCount);
+  checkLook2Strides<float>(Look2Strides{}, single_precision::look2_binlxpw, randomCount, rng, look2Single);
+  success &= printReport("look2_binlxpw float", look2Single);
+
+  // the cached kernels against the uncached ones, which match the generated lookups as checked above
+  KernelReport look1CachedDouble(topCount);
+  checkLook1CachedSizes<double>(Look1Sizes{}, length, rng, look1CachedDouble);
+  success &= printReport("look1_pbinlxpw double", look1CachedDouble);
+
+  KernelReport look1CachedSingle(topCount);
+  checkLook1CachedSizes<float>(Look1Sizes{}, length, rng, look1CachedSingle);
+  success &= printReport("look1_pbinlxpw float", look1CachedSingle);
+
+  KernelReport look2CachedDouble(topCount);
+  checkLook2CachedStrides<double>(Look2Strides{}, ::look2_pbinlxpw, length, rng, look2CachedDouble);
+  success &= printReport("look2_pbinlxpw double", look2CachedDouble);
+
+  KernelReport look2CachedSingle(topCount);
+  checkLook2CachedStrides<float>(Look2Strides{}, single_precision::look2_pbinlxpw, length, rng, look2CachedSingle);
+  success &= printReport("look2_pbinlxpw float", look2CachedSingle);
+
+  return success ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+"""
+Adds snapshot() and restore() to the generated Simulink model classes (see fbw-common/src/wasm/fbw_common/src/ModelSnapshot.h).
+
+The methods write and read the whole state of a model in member order: the external inputs and outputs, block I/O, DWork
+and zero crossing structs, followed by the state of the referenced models (LawMDLOBJ members). Parameters are static and
+not part of a snapshot.
+
+Run it after every code generation of the models:
+
+  python3 tools/modelpostprocess/add_snapshots.py fbw-a32nx/src/wasm/fbw_a320/src/model fbw-a380x/src/wasm/fbw_a380/src/model
+
+The script is idempotent, existing methods are replaced.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+SNAPSHOT_HEADER = "ModelSnapshot.h"
+
+CLASS_PATTERN = re.compile(r"^class (\w+)", re.MULTILINE)
+STATE_PATTERN = re.compile(
+    r"^  (?:ExternalInputs|ExternalOutputs|BlockIO|D_Work|PrevZCX)_\w+_T (\w+);$", re.MULTILINE)
+REFERENCED_MODEL_PATTERN = re.compile(r"^  \w+ (LawMDLOBJ\d+);$", re.MULTILINE)
+
+DECLARATIONS = """  void snapshot(ModelSnapshotWriter &writer) const;
+  boolean_T restore(ModelSnapshotReader &reader);
+"""
+
+
+def private_section(header):
+    index = header.find("\n private:\n")
+    if index < 0:
+        raise ValueError("no private section found")
+    return header[index:]
+
+
+def add_declarations(header, name):
+    header = header.replace(DECLARATIONS, "")
+    constructor = "  {}();\n".format(name)
+    if constructor not in header:
+        raise ValueError("no constructor declaration found for {}".format(name))
+    header = header.replace(constructor, DECLARATIONS + constructor, 1)
+
+    if '#include "{}"'.format(SNAPSHOT_HEADER) not in header:
+        header = header.replace('#include "rtwtypes.h"\n', '#include "rtwtypes.h"\n#include "{}"\n'.format(SNAPSHOT_HEADER), 1)
+    return header
+
+
+def definitions(name, state, referenced):
+    snapshot = ["void {}::snapshot(ModelSnapshotWriter &writer) const".format(name), "{"]
+    snapshot += ["  writer.write({});".format(member) for member in state]
+    snapshot += ["  {}.snapshot(writer);".format(member) for member in referenced]
+    snapshot.append("}")
+
+    reads = ["reader.read({})".format(member) for member in state]
+    reads += ["{}.restore(reader)".format(member) for member in referenced]
+    restore = ["boolean_T {}::restore(ModelSnapshotReader &reader)".format(name), "{"]
+    restore.append("  return " + " &&\n    ".join(reads) + ";")
+    restore.append("}")
+
+    return "\n".join(snapshot) + "\n\n" + "\n".join(restore) + "\n\n"
+
+
+def add_definitions(source, name, state, referenced):
+    for method in ("void {}::snapshot", "boolean_T {}::restore"):
+        pattern = re.compile(r"^" + re.escape(method.format(name)) + r"\(.*?^}\n\n", re.MULTILINE | re.DOTALL)
+        source = pattern.sub("", source)
+
+    constructor = re.search(r"^{0}::{0}\(\)".format(name), source, re.MULTILINE)
+    if constructor is None:
+        raise ValueError("no constructor definition found for {}".format(name))
+    index = constructor.start()
+    return source[:index] + definitions(name, state, referenced) + source[index:]
+
+
+def process_model(header_path, check):
+    header = header_path.read_text()
+    match = CLASS_PATTERN.search(header)
+    if match is None:
+        return None
+    name = match.group(1)
+
+    private = private_section(header)
+    state = STATE_PATTERN.findall(private)
+    referenced = REFERENCED_MODEL_PATTERN.findall(private)
+    if not state and not referenced:
+        raise ValueError("no state found for {}".format(name))
+
+    source_path = header_path.with_suffix(".cpp")
+    source = source_path.read_text()
+    updated_header = add_declarations(header, name)
+    updated_source = add_definitions(source, name, state, referenced)
+
+    changed = updated_header != header or updated_source != source
+    if changed and not check:
+        header_path.write_text(updated_header)
+        source_path.write_text(updated_source)
+    return name, len(state), len(referenced), changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Adds snapshot() and restore() to generated model classes")
+    parser.add_argument("directories", nargs="+", type=pathlib.Path, help="model source directories")
+    parser.add_argument("--check", action="store_true", help="only report, fail if any model is not up to date")
+    args = parser.parse_args()
+
+    outdated = 0
+    for directory in args.directories:
+        for header_path in sorted(directory.glob("*.h")):
+            result = process_model(header_path, args.check)
+            if result is None:
+                continue
+            name, state_count, referenced_count, changed = result
+            print("{}: {} state structs, {} referenced models{}".format(name, state_count, referenced_count,
+                                                                         " (updated)" if changed else ""))
+            outdated += changed
+
+    return 1 if args.check and outdated > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,204 @@
+"""
+Replaces the multiword arithmetic the generated AutopilotStateMachine uses for the armed mode masks by the native
+64-bit masks of fbw-common/src/wasm/fbw_common/src/ArmedModes.h.
+
+The state machine publishes lateral_mode_armed and vertical_mode_armed as double. The generated code shifts every armed
+flag through BitShift helpers and std::ldexp, converts it into a two-word integer with Double2MultiWord, ORs the words
+with MultiWordIor and converts back with uMultiWord2Double:
+
+  AutopilotStateMachine_BitShift(static_cast<real_T>(bus.lateral.armed.NAV), &rtb_GainTheta);
+  ...
+  if (FD or AP engaged) {
+    Double2MultiWord(std::floor(rtb_GainTheta), &tmp_0.chunks[0U], 2);
+    ...
+    AutopilotStateMachine_Y.out.output.lateral_mode_armed = uMultiWord2Double(&tmp.chunks[0U], 2, 0);
+  } else {
+  ...
+
+  ->
+
+  if (FD or AP engaged) {
+    AutopilotStateMachine_Y.out.output.lateral_mode_armed = static_cast<real_T>(armed_modes::lateralMask
+      (bus.lateral.armed));
+  ...
+
+The bits of the generated code are compared against the ones of ArmedModes.h, the script fails instead of rewriting if
+the model ever publishes other flags or shifts. Afterwards the BitShift helpers, the multiword temporaries and the
+multiword sources (Double2MultiWord, MultiWordIor, uMultiWord2Double) are unused and removed, build.sh and CMakeLists.txt
+of the aircraft do not list them.
+
+Run it after every code generation of the models:
+
+  python3 tools/modelpostprocess/armed_mode_masks.py fbw-a32nx/src/wasm/fbw_a320/src/model fbw-a380x/src/wasm/fbw_a380/src/model
+
+The script is idempotent, with --check it only reports and fails if any file would change.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+MODEL = "AutopilotStateMachine"
+MASKS_HEADER = "ArmedModes.h"
+MULTIWORD_SOURCES = ["Double2MultiWord", "MultiWordIor", "uMultiWord2Double"]
+
+# bits of the vertical mask that are built with std::ldexp, the first two go through the BitShift helpers
+VERTICAL_SHIFTED_BITS = [("CLB", 2), ("DES", 3), ("GS", 4), ("FINAL_DES", 5), ("TCAS", 6)]
+# without FD and AP only the TCAS bit is published
+VERTICAL_DISENGAGED_BITS = [("TCAS", 6)]
+
+OUTPUT = MODEL + r"_Y\.out\.output\."
+SHIFT = r"  {0}_BitShift{1}\(static_cast<real_T>\({2}\.{3}\.armed\.{4}\),\s*&\w+\);\n"
+MASKS_PATTERN = re.compile(
+    SHIFT.format(MODEL, "", r"(?P<bus>[\w.]+)", "lateral", "NAV")
+    + SHIFT.format(MODEL, "1", r"(?P=bus)", "lateral", "LOC")
+    + r"  if \((?P<condition>[^{]+?)\) \{\n"
+    + r"(?:    .*\n)*?"
+    + r"    " + OUTPUT + r"lateral_mode_armed = uMultiWord2Double\([^;]*\);\n"
+    + r"  \} else \{\n"
+    + r"(?P<lateral_disengaged>    " + OUTPUT + r"lateral_mode_armed = [^;]*;\n)"
+    + r"  \}\n\n"
+    + SHIFT.format(MODEL, "", r"(?P=bus)", "vertical", "ALT")
+    + SHIFT.format(MODEL, "1", r"(?P=bus)", "vertical", "ALT_CST")
+    + r"  if \((?P=condition)\) \{\n"
+    + r"(?P<vertical>(?:    .*\n)*?)"
+    + r"    " + OUTPUT + r"vertical_mode_armed = uMultiWord2Double\([^;]*\);\n"
+    + r"  \} else \{\n"
+    + r"(?P<vertical_disengaged>(?:    .*\n)*?)"
+    + r"    " + OUTPUT + r"vertical_mode_armed = uMultiWord2Double\([^;]*\);\n"
+    + r"  \}\n"
+)
+SHIFTED_BIT_PATTERN = re.compile(r"\.armed\.(\w+)\), (\d+)\)")
+
+MASKS_TEMPLATE = """  if ({condition}) {{
+    {model}_Y.out.output.lateral_mode_armed = static_cast<real_T>(armed_modes::lateralMask
+      ({bus}.lateral.armed));
+    {model}_Y.out.output.vertical_mode_armed = static_cast<real_T>(armed_modes::verticalMask
+      ({bus}.vertical.armed));
+  }} else {{
+{lateral_disengaged}    {model}_Y.out.output.vertical_mode_armed = static_cast<real_T>(armed_modes::bitIf
+      ({bus}.vertical.armed.TCAS, armed_modes::VERTICAL_TCAS));
+  }}
+"""
+
+BIT_SHIFT_DEFINITION_PATTERN = re.compile(
+    r"^void {0}ModelClass::{0}_BitShift1?\(real_T rtu_u, real_T \*rty_y\)\n\{{\n[^}}]*\}}\n\n".format(MODEL), re.MULTILINE)
+BIT_SHIFT_DECLARATION_PATTERN = re.compile(
+    r"^  static void {0}_BitShift1?\(real_T rtu_u, real_T \*rty_y\);\n".format(MODEL), re.MULTILINE)
+MULTIWORD_TEMPORARY_PATTERN = re.compile(r"^  uint64m_T \w+;\n", re.MULTILINE)
+INCLUDE_PATTERN = re.compile(r"^#include \"(\w+)\.h\"\n", re.MULTILINE)
+
+
+class UnexpectedModelError(Exception):
+    pass
+
+
+def replace_masks(source):
+    match = MASKS_PATTERN.search(source)
+    if match is None:
+        if "uMultiWord2Double(" in source:
+            raise UnexpectedModelError("the armed mode masks do not have the generated shape")
+        return source
+
+    if SHIFTED_BIT_PATTERN.findall(match.group("vertical")) != [(name, str(shift)) for name, shift in VERTICAL_SHIFTED_BITS]:
+        raise UnexpectedModelError("the vertical armed mode bits differ from " + MASKS_HEADER)
+    disengaged = SHIFTED_BIT_PATTERN.findall(match.group("vertical_disengaged"))
+    if disengaged != [(name, str(shift)) for name, shift in VERTICAL_DISENGAGED_BITS]:
+        raise UnexpectedModelError("the disengaged vertical armed mode bits differ from " + MASKS_HEADER)
+
+    masks = MASKS_TEMPLATE.format(model=MODEL, condition=match.group("condition"), bus=match.group("bus"),
+                                  lateral_disengaged=match.group("lateral_disengaged"))
+    return source[:match.start()] + masks + source[match.end():]
+
+
+def update_includes(source):
+    includes = list(INCLUDE_PATTERN.finditer(source))
+    if not includes:
+        return source
+
+    # the masks header goes after the last include of the generated block
+    last = includes[-1]
+    if MASKS_HEADER.replace(".h", "") not in [include.group(1) for include in includes]:
+        source = source[:last.end()] + "#include \"{}\"\n".format(MASKS_HEADER) + source[last.end():]
+
+    for name in MULTIWORD_SOURCES:
+        source = source.replace("#include \"{}.h\"\n".format(name), "")
+    return source
+
+
+def process_model(source_path, check):
+    """Returns the list of files that are (or in check mode would be) changed"""
+    header_path = source_path.with_suffix(".h")
+    source = source_path.read_text()
+    header = header_path.read_text()
+
+    updated_source = replace_masks(source)
+    updated_header = header
+    # the helpers go once the masks were the last ones to shift through them
+    if "_BitShift" not in BIT_SHIFT_DEFINITION_PATTERN.sub("", updated_source):
+        updated_source = BIT_SHIFT_DEFINITION_PATTERN.sub("", updated_source)
+        updated_header = BIT_SHIFT_DECLARATION_PATTERN.sub("", header)
+    if ".chunks[" not in updated_source:
+        updated_source = MULTIWORD_TEMPORARY_PATTERN.sub("", updated_source)
+    if not any(name + "(" in updated_source for name in MULTIWORD_SOURCES):
+        updated_source = update_includes(updated_source)
+
+    changed = []
+    for path, content, updated in ((source_path, source, updated_source), (header_path, header, updated_header)):
+        if updated != content:
+            changed.append(path)
+            if not check:
+                path.write_text(updated)
+    return changed
+
+
+def unused_multiword_sources(directory, check):
+    """Returns the multiword sources no other source of the directory includes, they are deleted unless in check mode"""
+    helper_names = {name + suffix for name in MULTIWORD_SOURCES for suffix in (".cpp", ".h")}
+    sources = [path for path in sorted(directory.glob("*.cpp")) + sorted(directory.glob("*.h")) if path.name not in helper_names]
+
+    unused = []
+    for name in MULTIWORD_SOURCES:
+        include = "#include \"{}.h\"".format(name)
+        if any(include in path.read_text() for path in sources):
+            continue
+        for suffix in (".cpp", ".h"):
+            path = directory / (name + suffix)
+            if path.exists():
+                unused.append(path)
+                if not check:
+                    path.unlink()
+    return unused
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replaces the multiword armed mode masks of the generated autopilot state machine")
+    parser.add_argument("directories", nargs="+", type=pathlib.Path, help="model source directories")
+    parser.add_argument("--check", action="store_true", help="only report, fail if any file is not up to date")
+    args = parser.parse_args()
+
+    outdated = 0
+    for directory in args.directories:
+        source_path = directory / (MODEL + ".cpp")
+        if not source_path.exists():
+            print("{}: no {}".format(directory, source_path.name))
+            return 1
+
+        try:
+            changed = process_model(source_path, args.check)
+        except UnexpectedModelError as error:
+            print("{}: {}".format(source_path, error))
+            return 1
+        for path in changed:
+            print("{}: {}".format(path, "outdated" if args.check else "updated"))
+        for path in unused_multiword_sources(directory, args.check):
+            print("{}: {}".format(path, "unused" if args.check else "deleted"))
+            outdated += 1
+        outdated += len(changed)
+
+    return 1 if args.check and outdated > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
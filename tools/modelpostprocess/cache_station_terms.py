@@ -0,0 +1,321 @@
+"""
+Keeps the station dependent terms of the LOC and G/S deviations of the generated AutopilotStateMachine in its DWork.
+
+The state machine computes the distance and bearing to the tuned localizer and glide slope every frame. The cosine and
+sine of the station latitude and the magnetic variation correction of the localizer only change with the tuned station:
+
+  Phi2 = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
+  ...
+  L = std::cos(Phi2);
+  ...
+  b_L = mod_mvZvttxs(... AutopilotStateMachine_U.in.data.nav_loc_magvar_deg ...);
+
+  ->
+
+  if ((!AP_SM_CACHE_NAV_STATION_TERMS) || (!AutopilotStateMachine_DWork.nav_loc_terms_not_empty) ||
+      (AutopilotStateMachine_DWork.nav_loc_lat_deg != AutopilotStateMachine_U.in.data.nav_loc_position.lat) || ...) {
+    ...
+    AutopilotStateMachine_DWork.nav_loc_cos_lat = std::cos(Phi2);
+  ...
+  L = AutopilotStateMachine_DWork.nav_loc_cos_lat;
+
+The terms are recomputed when the station latitude (or the magnetic variation of the localizer) changes, so the outputs
+stay bit identical. While no station is tuned (position all zero) the deviations are not computed at all, their guards
+reject that position anyway. Defining FBW_AP_SM_FULL_EVALUATION builds the generated behaviour, tools/statemachinebench
+compares both.
+
+The script also adds the DWork members to the header and removes the ULONG_MAX/LONG_MAX guard of
+AutopilotStateMachine_private.h, which only protected the multiword helpers armed_mode_masks.py removes and keeps the
+model from compiling on 64-bit hosts. Run it after armed_mode_masks.py on every code generation of the models:
+
+  python3 tools/modelpostprocess/cache_station_terms.py fbw-a32nx/src/wasm/fbw_a320/src/model fbw-a380x/src/wasm/fbw_a380/src/model
+
+The script is idempotent, with --check it only reports and fails if any file would change. It fails instead of
+rewriting if the deviations do not have the generated shape.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+MODEL = "AutopilotStateMachine"
+SWITCH = "AP_SM_CACHE_NAV_STATION_TERMS"
+
+SWITCH_DEFINITION = """
+// The station dependent terms of the LOC and G/S deviations are kept in the DWork until the tuned station changes, and
+// the deviations are not computed while no station is tuned. FBW_AP_SM_FULL_EVALUATION evaluates them every frame.
+// Added by tools/modelpostprocess/cache_station_terms.py after the code generation.
+#ifdef FBW_AP_SM_FULL_EVALUATION
+#define AP_SM_CACHE_NAV_STATION_TERMS false
+#else
+#define AP_SM_CACHE_NAV_STATION_TERMS true
+#endif
+"""
+
+# The templates name the local variables of the step, the generated names are matched and reused:
+#   $lat_ac  aircraft latitude (rad), later its sine     $lon_ac  aircraft longitude (rad), later the G/S bearing
+#   $cos_ac  cosine of the aircraft latitude             $phi     station latitude (rad), later the LOC error
+#   $a, $tmp haversine terms, distance and height        $l, $r   bearings
+#   $bl, $br magnetic variation correction, G/S cosine   $guard   invalid deviation flag
+
+GENERATED_LOC = """\
+  $lat_ac = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat;
+  $phi = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
+  $lon_ac = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lon;
+  $a = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
+                AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
+  $tmp = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
+    AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
+  $l = std::cos($phi);
+  $cos_ac = std::cos($lat_ac);
+  $a = $cos_ac * $l * $tmp * $tmp + $a * $a;
+  $a = std::atan2(std::sqrt($a), std::sqrt(1.0 - $a)) * 2.0 * 6.371E+6;
+  $tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
+    AutopilotStateMachine_U.in.data.nav_loc_position.alt;
+  $r = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lon - $lon_ac;
+  $bl = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(360.0) + 360.0) - (mod_mvZvttxs(mod_mvZvttxs
+    (AutopilotStateMachine_U.in.data.nav_loc_magvar_deg) + 360.0) + 360.0)) + 360.0);
+  $br = mod_mvZvttxs(360.0 - $bl);
+  if (std::abs($bl) < std::abs($br)) {
+    $br = -$bl;
+  }
+
+  $lat_ac = std::sin($lat_ac);
+  $l = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin($r) * $l, $cos_ac * std::sin($phi) - $lat_ac * $l * std::cos
+    ($r)) * 57.295779513082323 + 360.0)) + 360.0) + 360.0;
+  $phi = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg -
+    $br) + 360.0)) + 360.0) - $l) + 360.0);
+  $br = mod_mvZvttxs(360.0 - $phi);
+  $guard = false;
+"""
+
+CACHED_LOC = """\
+  $lat_ac = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lat;
+  $lon_ac = 0.017453292519943295 * AutopilotStateMachine_U.in.data.aircraft_position.lon;
+  $cos_ac = std::cos($lat_ac);
+  $lat_ac = std::sin($lat_ac);
+  $guard = false;
+  if (AP_SM_CACHE_NAV_STATION_TERMS && (AutopilotStateMachine_U.in.data.nav_loc_position.lat == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_loc_position.lon == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_loc_position.alt == 0.0)) {
+    $guard = true;
+  } else {
+    if ((!AP_SM_CACHE_NAV_STATION_TERMS) || (!AutopilotStateMachine_DWork.nav_loc_terms_not_empty) ||
+        (AutopilotStateMachine_DWork.nav_loc_lat_deg != AutopilotStateMachine_U.in.data.nav_loc_position.lat) ||
+        (AutopilotStateMachine_DWork.nav_loc_magvar_deg != AutopilotStateMachine_U.in.data.nav_loc_magvar_deg)) {
+      $phi = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lat;
+      AutopilotStateMachine_DWork.nav_loc_lat_deg = AutopilotStateMachine_U.in.data.nav_loc_position.lat;
+      AutopilotStateMachine_DWork.nav_loc_magvar_deg = AutopilotStateMachine_U.in.data.nav_loc_magvar_deg;
+      AutopilotStateMachine_DWork.nav_loc_cos_lat = std::cos($phi);
+      AutopilotStateMachine_DWork.nav_loc_sin_lat = std::sin($phi);
+      $bl = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(360.0) + 360.0) - (mod_mvZvttxs(mod_mvZvttxs
+        (AutopilotStateMachine_U.in.data.nav_loc_magvar_deg) + 360.0) + 360.0)) + 360.0);
+      $br = mod_mvZvttxs(360.0 - $bl);
+      if (std::abs($bl) < std::abs($br)) {
+        $br = -$bl;
+      }
+
+      AutopilotStateMachine_DWork.nav_loc_magvar_correction_deg = $br;
+      AutopilotStateMachine_DWork.nav_loc_terms_not_empty = true;
+    }
+
+    $l = AutopilotStateMachine_DWork.nav_loc_cos_lat;
+    $a = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lat -
+                  AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
+    $tmp = std::sin((AutopilotStateMachine_U.in.data.nav_loc_position.lon -
+      AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
+    $a = $cos_ac * $l * $tmp * $tmp + $a * $a;
+    $a = std::atan2(std::sqrt($a), std::sqrt(1.0 - $a)) * 2.0 * 6.371E+6;
+    $tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
+      AutopilotStateMachine_U.in.data.nav_loc_position.alt;
+    $r = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_loc_position.lon - $lon_ac;
+    $l = mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(std::atan2(std::sin($r) * $l, $cos_ac *
+      AutopilotStateMachine_DWork.nav_loc_sin_lat - $lat_ac * $l * std::cos($r)) * 57.295779513082323 + 360.0)) + 360.0) +
+      360.0;
+    $phi = mod_mvZvttxs((mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(mod_mvZvttxs(AutopilotStateMachine_U.in.data.nav_loc_deg -
+      AutopilotStateMachine_DWork.nav_loc_magvar_correction_deg) + 360.0)) + 360.0) - $l) + 360.0);
+    $br = mod_mvZvttxs(360.0 - $phi);
+"""
+
+GENERATED_GS = """\
+  $phi = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lat;
+  $a = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lat -
+                AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
+  $tmp = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lon -
+    AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
+  $br = std::cos($phi);
+  $a = $cos_ac * $br * $tmp * $tmp + $a * $a;
+  $a = std::atan2(std::sqrt($a), std::sqrt(1.0 - $a)) * 2.0 * 6.371E+6;
+  $tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
+    AutopilotStateMachine_U.in.data.nav_gs_position.alt;
+  $a = std::sqrt($a * $a + $tmp * $tmp);
+  $lon_ac = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lon - $lon_ac;
+  $lon_ac = std::atan2(std::sin($lon_ac) * $br, $cos_ac * std::sin($phi) - $lat_ac * $br * std::cos
+    ($lon_ac)) * 57.295779513082323;
+"""
+
+CACHED_GS = """\
+  $guard = false;
+  if (AP_SM_CACHE_NAV_STATION_TERMS && (AutopilotStateMachine_U.in.data.nav_gs_position.lat == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_gs_position.lon == 0.0) &&
+      (AutopilotStateMachine_U.in.data.nav_gs_position.alt == 0.0)) {
+    $guard = true;
+  } else {
+    if ((!AP_SM_CACHE_NAV_STATION_TERMS) || (!AutopilotStateMachine_DWork.nav_gs_terms_not_empty) ||
+        (AutopilotStateMachine_DWork.nav_gs_lat_deg != AutopilotStateMachine_U.in.data.nav_gs_position.lat)) {
+      $phi = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lat;
+      AutopilotStateMachine_DWork.nav_gs_lat_deg = AutopilotStateMachine_U.in.data.nav_gs_position.lat;
+      AutopilotStateMachine_DWork.nav_gs_cos_lat = std::cos($phi);
+      AutopilotStateMachine_DWork.nav_gs_sin_lat = std::sin($phi);
+      AutopilotStateMachine_DWork.nav_gs_terms_not_empty = true;
+    }
+
+    $br = AutopilotStateMachine_DWork.nav_gs_cos_lat;
+    $a = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lat -
+                  AutopilotStateMachine_U.in.data.aircraft_position.lat) * 0.017453292519943295 / 2.0);
+    $tmp = std::sin((AutopilotStateMachine_U.in.data.nav_gs_position.lon -
+      AutopilotStateMachine_U.in.data.aircraft_position.lon) * 0.017453292519943295 / 2.0);
+    $a = $cos_ac * $br * $tmp * $tmp + $a * $a;
+    $a = std::atan2(std::sqrt($a), std::sqrt(1.0 - $a)) * 2.0 * 6.371E+6;
+    $tmp = AutopilotStateMachine_U.in.data.aircraft_position.alt -
+      AutopilotStateMachine_U.in.data.nav_gs_position.alt;
+    $a = std::sqrt($a * $a + $tmp * $tmp);
+    $lon_ac = 0.017453292519943295 * AutopilotStateMachine_U.in.data.nav_gs_position.lon - $lon_ac;
+    $lon_ac = std::atan2(std::sin($lon_ac) * $br, $cos_ac * AutopilotStateMachine_DWork.nav_gs_sin_lat -
+      $lat_ac * $br * std::cos($lon_ac)) * 57.295779513082323;
+"""
+
+# an if statement at the indentation of the step body, up to its closing brace
+BLOCK = r"  if [^\n]*\{\n(?:(?:    [^\n]*|  \} else(?: if [^\n]*)? \{|)\n)*?  \}\n"
+PLACEHOLDER_PATTERN = re.compile(r"\$(\w+)")
+
+DWORK_MEMBERS = [
+    ("    real_T nav_gs_deg;\n", ["nav_loc_lat_deg", "nav_loc_magvar_deg", "nav_loc_cos_lat", "nav_loc_sin_lat",
+                                   "nav_loc_magvar_correction_deg", "nav_gs_lat_deg", "nav_gs_cos_lat", "nav_gs_sin_lat"],
+     "real_T"),
+    ("    boolean_T nav_gs_deg_not_empty;\n", ["nav_loc_terms_not_empty", "nav_gs_terms_not_empty"], "boolean_T"),
+]
+
+WORD_SIZE_GUARD_PATTERN = re.compile(
+    r"^#if \( ULONG_MAX != \(0xFFFFFFFFU\) \) \|\| \( LONG_MAX != \(0x7FFFFFFF\) \)\n.*?^#endif\n", re.MULTILINE | re.DOTALL)
+INCLUDE_PATTERN = re.compile(r"^#include \"\w+\.h\"\n", re.MULTILINE)
+
+
+class UnexpectedModelError(Exception):
+    pass
+
+
+def template_pattern(template, seen):
+    """Regular expression of a template, the placeholders match the generated names and whitespace may wrap differently.
+    Placeholders in seen refer back to the names matched by an earlier template."""
+    pattern = ""
+    for i, part in enumerate(re.split(r"(\$\w+|\s+)", template)):
+        if i % 2 == 0 or i == 1:
+            pattern += re.escape(part)
+        elif part.startswith("$"):
+            name = part[1:]
+            pattern += r"(?P={})".format(name) if name in seen else r"(?P<{}>\w+)".format(name)
+            seen.add(name)
+        else:
+            pattern += r"\n" if part == "\n" else r"\s*"
+    return pattern
+
+
+def fill(template, names):
+    return PLACEHOLDER_PATTERN.sub(lambda match: names[match.group(1)], template)
+
+
+def indent(block):
+    return "".join("  " + line if line.strip() else line for line in block.splitlines(keepends=True))
+
+
+NAMES = set()
+DEVIATIONS_PATTERN = re.compile(
+    "^(?P<loc>" + template_pattern(GENERATED_LOC, NAMES) + ")"
+    + "(?P<loc_guards>" + BLOCK + ")"
+    + r"(?P<middle>\n" + BLOCK + r"\n" + BLOCK + r"\n)"
+    + "(?P<gs>" + template_pattern(GENERATED_GS, NAMES) + ")"
+    + "(?P<gs_bearing>" + BLOCK + r"\n)"
+    + r"  (?P=guard) = false;\n"
+    + "(?P<gs_guards>" + BLOCK + ")",
+    re.MULTILINE
+)
+
+
+def cache_terms(source):
+    if SWITCH in source:
+        return source
+
+    match = DEVIATIONS_PATTERN.search(source)
+    if match is None:
+        raise UnexpectedModelError("the LOC and G/S deviations do not have the generated shape")
+
+    names = {name: match.group(name) for name in NAMES}
+    cached = (fill(CACHED_LOC, names) + indent(match.group("loc_guards")) + "  }\n"
+              + match.group("middle")
+              + fill(CACHED_GS, names) + indent(match.group("gs_bearing")) + indent(match.group("gs_guards")) + "  }\n")
+    source = source[:match.start()] + cached + source[match.end():]
+
+    includes = list(INCLUDE_PATTERN.finditer(source))
+    if not includes:
+        raise UnexpectedModelError("no includes to define " + SWITCH + " after")
+    return source[:includes[-1].end()] + SWITCH_DEFINITION + source[includes[-1].end():]
+
+
+def add_dwork_members(header):
+    for anchor, members, member_type in DWORK_MEMBERS:
+        missing = [name for name in members if not re.search(r"^    {} {};$".format(member_type, name), header, re.MULTILINE)]
+        if not missing:
+            continue
+        if anchor not in header:
+            raise UnexpectedModelError("no '{}' in the DWork to add the cached terms after".format(anchor.strip()))
+        declarations = "".join("    {} {};\n".format(member_type, name) for name in missing)
+        header = header.replace(anchor, anchor + declarations, 1)
+    return header
+
+
+def process_model(directory, check):
+    """Returns the list of files that are (or in check mode would be) changed"""
+    source_path = directory / (MODEL + ".cpp")
+    header_path = directory / (MODEL + ".h")
+    private_path = directory / (MODEL + "_private.h")
+
+    changed = []
+    for path, update in ((source_path, cache_terms), (header_path, add_dwork_members),
+                         (private_path, lambda content: WORD_SIZE_GUARD_PATTERN.sub("", content))):
+        content = path.read_text()
+        updated = update(content)
+        if updated != content:
+            changed.append(path)
+            if not check:
+                path.write_text(updated)
+    return changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Caches the station terms of the LOC and G/S deviations of the autopilot state machine")
+    parser.add_argument("directories", nargs="+", type=pathlib.Path, help="model source directories")
+    parser.add_argument("--check", action="store_true", help="only report, fail if any file is not up to date")
+    args = parser.parse_args()
+
+    outdated = 0
+    for directory in args.directories:
+        if not (directory / (MODEL + ".cpp")).exists():
+            print("{}: no {}.cpp".format(directory, MODEL))
+            return 1
+
+        try:
+            changed = process_model(directory, args.check)
+        except UnexpectedModelError as error:
+            print("{}: {}".format(directory / (MODEL + ".cpp"), error))
+            return 1
+        for path in changed:
+            print("{}: {}".format(path, "outdated" if args.check else "updated"))
+        outdated += len(changed)
+
+    return 1 if args.check and outdated > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,95 @@
+"""
+Declares the parameter structs of the generated Simulink model sources const.
+
+The models keep their tunable parameters (gains, lookup tables, initial conditions) in one static struct per model class,
+shared by all instances. Nothing writes to them at runtime, as const they are placed with the read-only data and the
+compiler is free to fold their values into the code of the steps:
+
+  static Parameters_ElacComputer_T ElacComputer_P;                     -> static const Parameters_ElacComputer_T ...
+  ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{ -> const ElacComputer::Parameters_ElacComputer_T ...
+
+The referenced models take their inputs as const pointers, so parameters passed on by address need no changes.
+
+Run it after every code generation of the models:
+
+  python3 tools/modelpostprocess/constify_parameters.py fbw-a32nx/src/wasm/fbw_a320/src/model fbw-a380x/src/wasm/fbw_a380/src/model
+
+The script is idempotent.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+CLASS_PATTERN = re.compile(r"^class (\w+)", re.MULTILINE)
+MEMBER_PATTERN = re.compile(r"^(  static )(Parameters_\w+_T \w+;)$", re.MULTILINE)
+EXTERN_PATTERN = re.compile(r"^(extern )(\w+::Parameters_\w+_T \w+;)$", re.MULTILINE)
+
+
+def constify_header(header):
+    header = MEMBER_PATTERN.sub(r"\1const \2", header)
+    return EXTERN_PATTERN.sub(r"\1const \2", header)
+
+
+def parameter_members(header):
+    return re.findall(r"^  static const (Parameters_\w+_T) (\w+);$", header, re.MULTILINE)
+
+
+def constify_definition(source, name, struct, member):
+    # the generated code sometimes breaks the line after the class name
+    pattern = re.compile(r"^({0}::{1} {0}::\s*{2}\{{)".format(name, struct, member), re.MULTILINE)
+    return pattern.sub(r"const \1", source)
+
+
+def process_model(header_path, check):
+    header = header_path.read_text()
+    match = CLASS_PATTERN.search(header)
+    if match is None:
+        return None
+    name = match.group(1)
+
+    updated_header = constify_header(header)
+    members = parameter_members(updated_header)
+    if not members:
+        return None
+
+    changed = updated_header != header
+    if not check and changed:
+        header_path.write_text(updated_header)
+
+    for struct, member in members:
+        for source_path in (header_path.with_suffix(".cpp"), header_path.with_name(header_path.stem + "_data.cpp")):
+            if not source_path.exists():
+                continue
+            source = source_path.read_text()
+            updated_source = constify_definition(source, name, struct, member)
+            if updated_source != source:
+                changed = True
+                if not check:
+                    source_path.write_text(updated_source)
+
+    return [member for _, member in members], changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Declares the parameter structs of generated model sources const")
+    parser.add_argument("directories", nargs="+", type=pathlib.Path, help="model source directories")
+    parser.add_argument("--check", action="store_true", help="only report, fail if any model is not up to date")
+    args = parser.parse_args()
+
+    outdated = 0
+    for directory in args.directories:
+        for header_path in sorted(directory.glob("*.h")):
+            result = process_model(header_path, args.check)
+            if result is None:
+                continue
+            members, changed = result
+            print("{}: {}{}".format(header_path.stem, ", ".join(members), " (updated)" if changed else ""))
+            outdated += changed
+
+    return 1 if args.check and outdated > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
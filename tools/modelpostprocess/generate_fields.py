@@ -0,0 +1,93 @@
+"""
+Generates the field lists of the structs in the generated model types for the host tools.
+
+The precision harness (tools/modelprecision) uses them to copy inputs field by field between the double and the single
+precision build of a model and to report the deviation per output field by name, the regression suite
+(tools/modelregression) to record and compare the outputs of the computers by name.
+
+Run it after every code generation of the models:
+
+  python3 tools/modelpostprocess/generate_fields.py
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+ROOT = pathlib.Path(__file__).resolve().parents[2]
+A32NX_MODEL_DIR = "fbw-a32nx/src/wasm/fbw_a320/src/model"
+A380X_MODEL_DIR = "fbw-a380x/src/wasm/fbw_a380/src/model"
+
+# output header, model directory and the types headers it is generated from
+TARGETS = [
+    ("tools/modelprecision/src/ModelFields.h", A32NX_MODEL_DIR, [
+        "AutopilotStateMachine_types.h",
+        "AutopilotLaws_types.h",
+        "Autothrust_types.h",
+        "FacComputer_types.h",
+    ]),
+    ("tools/modelregression/src/A32nxFields.h", A32NX_MODEL_DIR, [
+        "ElacComputer_types.h",
+        "SecComputer_types.h",
+        "FacComputer_types.h",
+    ]),
+    ("tools/modelregression/src/A380xFields.h", A380X_MODEL_DIR, [
+        "A380PrimComputer_types.h",
+        "A380SecComputer_types.h",
+        "FacComputer_types.h",
+    ]),
+]
+
+STRUCT_PATTERN = re.compile(r"^#ifndef DEFINED_TYPEDEF_FOR_(\w+)_\n#define DEFINED_TYPEDEF_FOR_\1_\n\nstruct \1\n\{\n(.*?)^\};",
+                            re.MULTILINE | re.DOTALL)
+FIELD_PATTERN = re.compile(r"^  \w+ (\w+)(?:\[\d+\])?;$", re.MULTILINE)
+
+HEADER = """#pragma once
+
+// Generated by tools/modelpostprocess/generate_fields.py from the {} model types, do not edit.
+//
+// visitFields() calls visitor.field(name, member) for every member of a struct. Each overload is only defined when the
+// model types that declare the struct are included before this header.
+"""
+
+
+def generate(model_dir, types_headers):
+    structs = {}
+    for name in types_headers:
+        for match in STRUCT_PATTERN.finditer((ROOT / model_dir / name).read_text()):
+            structs.setdefault(match.group(1), FIELD_PATTERN.findall(match.group(2)))
+
+    aircraft = "A32NX" if model_dir == A32NX_MODEL_DIR else "A380X"
+    lines = [HEADER.format(aircraft)]
+    for struct, fields in structs.items():
+        lines.append("#ifdef DEFINED_TYPEDEF_FOR_{}_".format(struct))
+        lines.append("template <typename Visitor>")
+        lines.append("void visitFields(Visitor& visitor, {}& value) {{".format(struct))
+        lines += ["  visitor.field(\"{0}\", value.{0});".format(field) for field in fields]
+        lines.append("}")
+        lines.append("#endif")
+        lines.append("")
+    return "\n".join(lines), len(structs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generates the field lists of the model types for the host tools")
+    parser.add_argument("--check", action="store_true", help="only report, fail if any header is not up to date")
+    args = parser.parse_args()
+
+    outdated = 0
+    for output, model_dir, types_headers in TARGETS:
+        content, count = generate(model_dir, types_headers)
+        path = ROOT / output
+        changed = not path.exists() or path.read_text() != content
+        if changed and not args.check:
+            path.write_text(content)
+        print("{}: {} structs{}".format(output, count, " (updated)" if changed else ""))
+        outdated += changed
+
+    return 1 if args.check and outdated > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
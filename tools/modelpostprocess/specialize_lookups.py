@@ -0,0 +1,277 @@
+"""
+Switches the lookup table calls of the generated Simulink model sources over to the compile time
+specialized kernels in fbw-common/src/wasm/fbw_common/src/LookupKernels.h.
+
+  look1_binlxpw(u0, bp0, table, 6U)                    -> look1_binlxpw<6U>(u0, bp0, table)
+  look2_binlxpw(u0, u1, bp0, bp1, table, maxIndex, 5U) -> look2_binlxpw<5U>(u0, u1, bp0, bp1, table, maxIndex)
+
+The models in CACHED_MODELS run their lookups every frame with slowly changing inputs (speeds, altitudes, mach), their
+calls switch to the variants that start at the interval of the previous call. Each call site gets its own slots in the
+lookupIndex member of the model DWork (one for 1-D, two for 2-D lookups), which the script adds to the header:
+
+  look1_binlxpw(u0, bp0, table, 6U) -> look1_pbinlxpw<6U>(u0, bp0, table, &Model_DWork.lookupIndex[3])
+
+Calls inside static member functions have no access to the DWork and stay stateless.
+
+Run it after every code generation of the models:
+
+  python3 tools/modelpostprocess/specialize_lookups.py fbw-a32nx/src/wasm/fbw_a320/src/model fbw-a380x/src/wasm/fbw_a380/src/model
+
+The script is idempotent, already specialized calls are parsed again and get the same result. With --check it only
+reports and fails if a file would change or a stateless call is left without a compile time table size, which catches
+calls whose size is only known at runtime as well as call shapes the script does not understand.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+KERNEL_HEADER = "LookupKernels.h"
+
+# function name -> number of arguments of the generated signature
+LOOKUP_FUNCTIONS = {
+    "look1_binlxpw": 4,
+    "look2_binlxpw": 7,
+}
+
+# models whose lookups remember the interval of the previous call
+CACHED_MODELS = {
+    "PitchNormalLaw",
+    "LateralNormalLaw",
+    "AutopilotLaws",
+    "FacComputer",
+    "A380PrimComputer",
+    "A380PitchNormalLaw",
+    "A380LateralNormalLaw",
+}
+
+INDEX_MEMBER = "lookupIndex"
+
+# the generated code may wrap the line between the function name and the argument list
+CALL_PATTERN = re.compile(r"\b(look[12])_(p?)binlxpw(?:<(\d+)U>)?(\s*)\(")
+SIZE_PATTERN = re.compile(r"^\s*(\d+)U\s*$")
+DECLARATION_ARGUMENT_PATTERN = re.compile(r"^\s*(const\s+)?\w+_T\b")
+INDEX_PATTERN = re.compile(r"^\s*&\w+\." + INDEX_MEMBER + r"\[\d+\]\s*$")
+FUNCTION_PATTERN = re.compile(r"^[A-Za-z_][^;\n]*?\b\w+::(\w+)\(", re.MULTILINE)
+
+
+def find_closing_parenthesis(source, start):
+    depth = 0
+    for index in range(start, len(source)):
+        if source[index] == "(":
+            depth += 1
+        elif source[index] == ")":
+            depth -= 1
+            if depth == 0:
+                return index
+    raise ValueError("unbalanced parenthesis at offset {}".format(start))
+
+
+def split_arguments(arguments):
+    """Splits the argument list at the top level commas, keeping the original formatting of each argument"""
+    parts = []
+    depth = 0
+    begin = 0
+    for index, character in enumerate(arguments):
+        if character in "([{":
+            depth += 1
+        elif character in ")]}":
+            depth -= 1
+        elif character == "," and depth == 0:
+            parts.append(arguments[begin:index])
+            begin = index + 1
+    parts.append(arguments[begin:])
+    return parts
+
+
+def parse_call(match, arguments):
+    """Returns the table size and the arguments of the stateless call, None if the call is not a complete lookup call"""
+    base, cached, size = match.group(1, 2, 3)
+    # the stateless signature without the size, the cached one adds the index argument
+    count = LOOKUP_FUNCTIONS[base + "_binlxpw"] - 1
+
+    if size is None:
+        if cached or len(arguments) != count + 1:
+            return None
+        size_match = SIZE_PATTERN.match(arguments[-1])
+        if size_match is None:
+            return None
+        return size_match.group(1), arguments[:-1]
+
+    if not cached:
+        return (size, arguments) if len(arguments) == count else None
+
+    # the index argument is the one before the maxIndex array of look2
+    index_position = 3 if base == "look1" else 5
+    if len(arguments) != count + 1 or INDEX_PATTERN.match(arguments[index_position]) is None:
+        return None
+    return size, arguments[:index_position] + arguments[index_position + 1:]
+
+
+class IndexSlots:
+    """Hands out consecutive lookupIndex slots of the model DWork"""
+
+    def __init__(self, dwork):
+        self.dwork = dwork
+        self.count = 0
+
+    def allocate(self, size):
+        slot = self.count
+        self.count += size
+        return " &{}.{}[{}]".format(self.dwork, INDEX_MEMBER, slot)
+
+
+def specialize_calls(source, slots=None, static_functions=(), function=None):
+    """Returns the rewritten source and the number of rewritten calls"""
+    result = []
+    position = 0
+    count = 0
+
+    functions = [(m.start(), m.group(1)) for m in FUNCTION_PATTERN.finditer(source)] if slots else []
+
+    for match in CALL_PATTERN.finditer(source):
+        if match.start() < position:
+            continue
+
+        open_index = match.end() - 1
+        close_index = find_closing_parenthesis(source, open_index)
+        call = parse_call(match, split_arguments(source[open_index + 1:close_index]))
+        if call is None:
+            # declarations, definitions and calls with a table size only known at runtime
+            continue
+        size, arguments = call
+
+        # the function definition the call is in, calls nested in the arguments belong to the same function
+        enclosing = [name for offset, name in functions if offset <= match.start()]
+        call_function = enclosing[-1] if enclosing else function
+        cached = slots is not None and call_function not in static_functions
+
+        # nested lookups are rewritten as well
+        inner, inner_count = specialize_calls(",".join(arguments), slots if cached else None, static_functions, call_function)
+        inner = inner.rstrip()
+        base = match.group(1)
+        if cached:
+            inner_arguments = split_arguments(inner)
+            index_position = 3 if base == "look1" else 5
+            inner_arguments.insert(index_position, slots.allocate(1 if base == "look1" else 2))
+            name = base + "_pbinlxpw"
+            inner = ",".join(inner_arguments)
+        else:
+            name = base + "_binlxpw"
+
+        result.append(source[position:match.start()])
+        # keep the line break the generated code may have put before the argument list
+        result.append("{}<{}U>{}({})".format(name, size, match.group(4), inner))
+        position = close_index + 1
+        count += 1 + inner_count
+
+    result.append(source[position:])
+    return "".join(result), count
+
+
+def find_unspecialized_calls(source):
+    """Returns the lines of the stateless lookup calls without a compile time table size"""
+    lines = []
+    for match in CALL_PATTERN.finditer(source):
+        # Simulink's own look*_pbinlxpw() with a stride are a different kernel and not rewritten
+        if match.group(2) or match.group(3):
+            continue
+        open_index = match.end() - 1
+        arguments = split_arguments(source[open_index + 1:find_closing_parenthesis(source, open_index)])
+        if any(DECLARATION_ARGUMENT_PATTERN.match(argument) for argument in arguments):
+            continue
+        lines.append(source.count("\n", 0, match.start()) + 1)
+    return lines
+
+
+def find_dwork(header, model):
+    match = re.search(r"^\s*D_Work_{0}_T (\w+);".format(model), header, re.MULTILINE)
+    if match is None:
+        raise ValueError("no DWork member found for {}".format(model))
+    return match.group(1)
+
+
+def find_static_functions(header):
+    return set(re.findall(r"^\s*static [^;(]*?\b(\w+)\(", header, re.MULTILINE))
+
+
+def update_index_member(header, model, size):
+    """Adds, resizes or removes the lookupIndex member of the DWork struct"""
+    struct = re.search(r"^(\s*)struct D_Work_{0}_T {{\n(.*?)^\1}};".format(model), header, re.MULTILINE | re.DOTALL)
+    if struct is None:
+        raise ValueError("no DWork struct found for {}".format(model))
+
+    body = re.sub(r"^\s*uint32_T {}\[\d+\];\n".format(INDEX_MEMBER), "", struct.group(2), flags=re.MULTILINE)
+    if size > 0:
+        body += "{0}  uint32_T {1}[{2}];\n".format(struct.group(1), INDEX_MEMBER, size)
+    return header[:struct.start(2)] + body + header[struct.end(2):]
+
+
+def add_include(source):
+    if '#include "{}"'.format(KERNEL_HEADER) in source:
+        return source
+
+    includes = list(re.finditer(r'^#include "look[12]_p?binlxpw\.h"\n', source, re.MULTILINE))
+    if not includes:
+        raise ValueError("no lookup include found")
+    index = includes[-1].end()
+    return source[:index] + '#include "{}"\n'.format(KERNEL_HEADER) + source[index:]
+
+
+def process_file(path, check):
+    """Returns the number of calls that are (or in check mode would be) rewritten and the lines of the calls left unspecialized"""
+    source = path.read_text()
+
+    header_path = path.with_suffix(".h")
+    slots = None
+    static_functions = ()
+    if path.stem in CACHED_MODELS:
+        header = header_path.read_text()
+        slots = IndexSlots(find_dwork(header, path.stem))
+        static_functions = find_static_functions(header)
+
+    specialized, count = specialize_calls(source, slots, static_functions)
+    unspecialized = find_unspecialized_calls(source if check else specialized)
+    if count == 0:
+        return 0, unspecialized
+
+    specialized = add_include(specialized)
+    updated_header = update_index_member(header, path.stem, slots.count) if slots is not None else None
+    if check:
+        # only the calls of files that would change are reported
+        unchanged = specialized == source and (updated_header is None or updated_header == header)
+        return (0 if unchanged else count), unspecialized
+
+    path.write_text(specialized)
+    if updated_header is not None:
+        header_path.write_text(updated_header)
+    return count, unspecialized
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Specializes the lookup table calls of generated model sources")
+    parser.add_argument("directories", nargs="+", type=pathlib.Path, help="model source directories")
+    parser.add_argument("--check", action="store_true", help="only report, fail if any call is or would be left unspecialized")
+    args = parser.parse_args()
+
+    total = 0
+    unspecialized_total = 0
+    for directory in args.directories:
+        for path in sorted(directory.glob("*.cpp")):
+            if path.stem in LOOKUP_FUNCTIONS:
+                continue
+            count, unspecialized = process_file(path, args.check)
+            if count > 0:
+                print("{}: {} lookup calls".format(path, count))
+                total += count
+            for line in unspecialized:
+                print("{}:{}: lookup call without a compile time table size".format(path, line))
+            unspecialized_total += len(unspecialized)
+
+    print("{} {} lookup calls, {} left unspecialized".format("found" if args.check else "specialized", total, unspecialized_total))
+    return 1 if args.check and (total > 0 or unspecialized_total > 0) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,20 @@
+// the headers used by the models are included outside of the namespace first
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "FieldVisitors.h"
+#include "LookupKernels.h"
+#include "ModelSnapshot.h"
+#include "PrecisionVariant.h"
+
+namespace double_precision {
+#include "ModelVariant.inc"
+}  // namespace double_precision
+
+std::unique_ptr<PrecisionVariant> createDoublePrecision(PrecisionModel model) {
+  return double_precision::createVariant(model);
+}
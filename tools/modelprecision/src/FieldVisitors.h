@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Walks the members of a model struct with the generated visitFields() overloads (see ModelFields.h)
+/// </summary>
+/// <remarks>
+/// Scalars, enums and booleans are handed to Derived::leaf(), nested structs and arrays are walked recursively. The
+/// overloads are found by argument dependent lookup, so the same visitors work for the model types in any namespace.
+/// </remarks>
+template <typename Derived>
+class FieldVisitor {
+ public:
+  template <typename T>
+  void field(const char* name, T& value) {
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+      derived().leaf(name, value);
+    } else if constexpr (std::is_array_v<T>) {
+      for (std::size_t i = 0; i < std::extent_v<T>; i++) {
+        derived().enter(name, static_cast<int>(i));
+        field("", value[i]);
+        derived().leave();
+      }
+    } else {
+      derived().enter(name, -1);
+      visitFields(derived(), value);
+      derived().leave();
+    }
+  }
+
+  // by default the path is not tracked
+  void enter(const char*, int) {}
+  void leave() {}
+
+ private:
+  Derived& derived() { return static_cast<Derived&>(*this); }
+};
+
+/// collects the full names of all leaves, e.g. "in.data.V_ias_kn"
+class FieldNames : public FieldVisitor<FieldNames> {
+ public:
+  std::vector<std::string> names;
+
+  template <typename T>
+  void leaf(const char* name, T&) {
+    names.push_back(path + name);
+  }
+
+  void enter(const char* name, int index) {
+    lengths.push_back(path.size());
+    path += name;
+    if (index >= 0) {
+      path += "[" + std::to_string(index) + "]";
+    } else {
+      path += ".";
+    }
+  }
+
+  void leave() {
+    path.resize(lengths.back());
+    lengths.pop_back();
+  }
+
+ private:
+  std::string path;
+  std::vector<std::size_t> lengths;
+};
+
+/// appends the values of all leaves as double
+class FieldReader : public FieldVisitor<FieldReader> {
+ public:
+  explicit FieldReader(std::vector<double>& values) : values(values) { values.clear(); }
+
+  template <typename T>
+  void leaf(const char*, T& value) {
+    values.push_back(static_cast<double>(value));
+  }
+
+ private:
+  std::vector<double>& values;
+};
+
+/// assigns the leaves from values in the order of FieldNames, narrowing them to the type of the leaf
+class FieldWriter : public FieldVisitor<FieldWriter> {
+ public:
+  explicit FieldWriter(const std::vector<double>& values) : values(values) {}
+
+  template <typename T>
+  void leaf(const char*, T& value) {
+    if constexpr (std::is_enum_v<T>) {
+      value = static_cast<T>(static_cast<std::underlying_type_t<T>>(values[index++]));
+    } else {
+      value = static_cast<T>(values[index++]);
+    }
+  }
+
+ private:
+  const std::vector<double>& values;
+  std::size_t index = 0;
+};
@@ -0,0 +1,1084 @@
+#pragma once
+
+// Generated by tools/modelpostprocess/generate_fields.py from the A32NX model types, do not edit.
+//
+// visitFields() calls visitor.field(name, member) for every member of a struct. Each overload is only defined when the
+// model types that declare the struct are included before this header.
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_time_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_time& value) {
+  visitor.field("dt", value.dt);
+  visitor.field("simulation_time", value.simulation_time);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_lat_lon_alt_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_lat_lon_alt& value) {
+  visitor.field("lat", value.lat);
+  visitor.field("lon", value.lon);
+  visitor.field("alt", value.alt);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_data& value) {
+  visitor.field("aircraft_position", value.aircraft_position);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("q_rad_s", value.q_rad_s);
+  visitor.field("r_rad_s", value.r_rad_s);
+  visitor.field("p_rad_s", value.p_rad_s);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("V_mach", value.V_mach);
+  visitor.field("V_gnd_kn", value.V_gnd_kn);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("beta_deg", value.beta_deg);
+  visitor.field("H_ft", value.H_ft);
+  visitor.field("H_ind_ft", value.H_ind_ft);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("H_dot_ft_min", value.H_dot_ft_min);
+  visitor.field("Psi_magnetic_deg", value.Psi_magnetic_deg);
+  visitor.field("Psi_magnetic_track_deg", value.Psi_magnetic_track_deg);
+  visitor.field("Psi_true_deg", value.Psi_true_deg);
+  visitor.field("bx_m_s2", value.bx_m_s2);
+  visitor.field("by_m_s2", value.by_m_s2);
+  visitor.field("bz_m_s2", value.bz_m_s2);
+  visitor.field("nav_valid", value.nav_valid);
+  visitor.field("nav_loc_deg", value.nav_loc_deg);
+  visitor.field("nav_gs_deg", value.nav_gs_deg);
+  visitor.field("nav_dme_valid", value.nav_dme_valid);
+  visitor.field("nav_dme_nmi", value.nav_dme_nmi);
+  visitor.field("nav_loc_valid", value.nav_loc_valid);
+  visitor.field("nav_loc_magvar_deg", value.nav_loc_magvar_deg);
+  visitor.field("nav_loc_error_deg", value.nav_loc_error_deg);
+  visitor.field("nav_loc_position", value.nav_loc_position);
+  visitor.field("nav_gs_valid", value.nav_gs_valid);
+  visitor.field("nav_gs_error_deg", value.nav_gs_error_deg);
+  visitor.field("nav_gs_position", value.nav_gs_position);
+  visitor.field("flight_guidance_xtk_nmi", value.flight_guidance_xtk_nmi);
+  visitor.field("flight_guidance_tae_deg", value.flight_guidance_tae_deg);
+  visitor.field("flight_guidance_phi_deg", value.flight_guidance_phi_deg);
+  visitor.field("flight_guidance_phi_limit_deg", value.flight_guidance_phi_limit_deg);
+  visitor.field("flight_phase", value.flight_phase);
+  visitor.field("V2_kn", value.V2_kn);
+  visitor.field("VAPP_kn", value.VAPP_kn);
+  visitor.field("VLS_kn", value.VLS_kn);
+  visitor.field("VMAX_kn", value.VMAX_kn);
+  visitor.field("is_flight_plan_available", value.is_flight_plan_available);
+  visitor.field("altitude_constraint_ft", value.altitude_constraint_ft);
+  visitor.field("thrust_reduction_altitude", value.thrust_reduction_altitude);
+  visitor.field("thrust_reduction_altitude_go_around", value.thrust_reduction_altitude_go_around);
+  visitor.field("acceleration_altitude", value.acceleration_altitude);
+  visitor.field("acceleration_altitude_engine_out", value.acceleration_altitude_engine_out);
+  visitor.field("acceleration_altitude_go_around", value.acceleration_altitude_go_around);
+  visitor.field("acceleration_altitude_go_around_engine_out", value.acceleration_altitude_go_around_engine_out);
+  visitor.field("cruise_altitude", value.cruise_altitude);
+  visitor.field("gear_strut_compression_1", value.gear_strut_compression_1);
+  visitor.field("gear_strut_compression_2", value.gear_strut_compression_2);
+  visitor.field("zeta_pos", value.zeta_pos);
+  visitor.field("throttle_lever_1_pos", value.throttle_lever_1_pos);
+  visitor.field("throttle_lever_2_pos", value.throttle_lever_2_pos);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("is_engine_operative_1", value.is_engine_operative_1);
+  visitor.field("is_engine_operative_2", value.is_engine_operative_2);
+  visitor.field("altimeter_setting_left_mbar", value.altimeter_setting_left_mbar);
+  visitor.field("altimeter_setting_right_mbar", value.altimeter_setting_right_mbar);
+  visitor.field("total_weight_kg", value.total_weight_kg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_sm_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_sm_input& value) {
+  visitor.field("FD_active", value.FD_active);
+  visitor.field("AP_ENGAGE_push", value.AP_ENGAGE_push);
+  visitor.field("AP_1_push", value.AP_1_push);
+  visitor.field("AP_2_push", value.AP_2_push);
+  visitor.field("AP_DISCONNECT_push", value.AP_DISCONNECT_push);
+  visitor.field("HDG_push", value.HDG_push);
+  visitor.field("HDG_pull", value.HDG_pull);
+  visitor.field("ALT_push", value.ALT_push);
+  visitor.field("ALT_pull", value.ALT_pull);
+  visitor.field("VS_push", value.VS_push);
+  visitor.field("VS_pull", value.VS_pull);
+  visitor.field("LOC_push", value.LOC_push);
+  visitor.field("APPR_push", value.APPR_push);
+  visitor.field("EXPED_push", value.EXPED_push);
+  visitor.field("V_fcu_kn", value.V_fcu_kn);
+  visitor.field("Psi_fcu_deg", value.Psi_fcu_deg);
+  visitor.field("H_fcu_ft", value.H_fcu_ft);
+  visitor.field("H_constraint_ft", value.H_constraint_ft);
+  visitor.field("H_dot_fcu_fpm", value.H_dot_fcu_fpm);
+  visitor.field("FPA_fcu_deg", value.FPA_fcu_deg);
+  visitor.field("TRK_FPA_mode", value.TRK_FPA_mode);
+  visitor.field("DIR_TO_trigger", value.DIR_TO_trigger);
+  visitor.field("is_FLX_active", value.is_FLX_active);
+  visitor.field("Slew_trigger", value.Slew_trigger);
+  visitor.field("MACH_mode", value.MACH_mode);
+  visitor.field("ATHR_engaged", value.ATHR_engaged);
+  visitor.field("is_SPEED_managed", value.is_SPEED_managed);
+  visitor.field("FDR_event", value.FDR_event);
+  visitor.field("Phi_loc_c", value.Phi_loc_c);
+  visitor.field("FM_requested_vertical_mode", value.FM_requested_vertical_mode);
+  visitor.field("FM_H_c_ft", value.FM_H_c_ft);
+  visitor.field("FM_H_dot_c_fpm", value.FM_H_dot_c_fpm);
+  visitor.field("FM_rnav_appr_selected", value.FM_rnav_appr_selected);
+  visitor.field("FM_final_des_can_engage", value.FM_final_des_can_engage);
+  visitor.field("TCAS_mode_fail", value.TCAS_mode_fail);
+  visitor.field("TCAS_mode_available", value.TCAS_mode_available);
+  visitor.field("TCAS_advisory_state", value.TCAS_advisory_state);
+  visitor.field("TCAS_advisory_target_min_fpm", value.TCAS_advisory_target_min_fpm);
+  visitor.field("TCAS_advisory_target_max_fpm", value.TCAS_advisory_target_max_fpm);
+  visitor.field("condition_Flare", value.condition_Flare);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_sm_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_sm_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("data", value.data);
+  visitor.field("input", value.input);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_lateral_armed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_lateral_armed& value) {
+  visitor.field("NAV", value.NAV);
+  visitor.field("LOC", value.LOC);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_lateral_condition_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_lateral_condition& value) {
+  visitor.field("NAV", value.NAV);
+  visitor.field("LOC_CPT", value.LOC_CPT);
+  visitor.field("LOC_TRACK", value.LOC_TRACK);
+  visitor.field("LAND", value.LAND);
+  visitor.field("FLARE", value.FLARE);
+  visitor.field("ROLL_OUT", value.ROLL_OUT);
+  visitor.field("GA_TRACK", value.GA_TRACK);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_data& value) {
+  visitor.field("aircraft_position", value.aircraft_position);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("qk_deg_s", value.qk_deg_s);
+  visitor.field("rk_deg_s", value.rk_deg_s);
+  visitor.field("pk_deg_s", value.pk_deg_s);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("V_mach", value.V_mach);
+  visitor.field("V_gnd_kn", value.V_gnd_kn);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("beta_deg", value.beta_deg);
+  visitor.field("H_ft", value.H_ft);
+  visitor.field("H_ind_ft", value.H_ind_ft);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("H_dot_ft_min", value.H_dot_ft_min);
+  visitor.field("Psi_magnetic_deg", value.Psi_magnetic_deg);
+  visitor.field("Psi_magnetic_track_deg", value.Psi_magnetic_track_deg);
+  visitor.field("Psi_true_deg", value.Psi_true_deg);
+  visitor.field("ax_m_s2", value.ax_m_s2);
+  visitor.field("ay_m_s2", value.ay_m_s2);
+  visitor.field("az_m_s2", value.az_m_s2);
+  visitor.field("bx_m_s2", value.bx_m_s2);
+  visitor.field("by_m_s2", value.by_m_s2);
+  visitor.field("bz_m_s2", value.bz_m_s2);
+  visitor.field("nav_valid", value.nav_valid);
+  visitor.field("nav_loc_deg", value.nav_loc_deg);
+  visitor.field("nav_gs_deg", value.nav_gs_deg);
+  visitor.field("nav_dme_valid", value.nav_dme_valid);
+  visitor.field("nav_dme_nmi", value.nav_dme_nmi);
+  visitor.field("nav_loc_valid", value.nav_loc_valid);
+  visitor.field("nav_loc_magvar_deg", value.nav_loc_magvar_deg);
+  visitor.field("nav_loc_error_deg", value.nav_loc_error_deg);
+  visitor.field("nav_loc_position", value.nav_loc_position);
+  visitor.field("nav_e_loc_valid", value.nav_e_loc_valid);
+  visitor.field("nav_e_loc_error_deg", value.nav_e_loc_error_deg);
+  visitor.field("nav_gs_valid", value.nav_gs_valid);
+  visitor.field("nav_gs_error_deg", value.nav_gs_error_deg);
+  visitor.field("nav_gs_position", value.nav_gs_position);
+  visitor.field("nav_e_gs_valid", value.nav_e_gs_valid);
+  visitor.field("nav_e_gs_error_deg", value.nav_e_gs_error_deg);
+  visitor.field("flight_guidance_xtk_nmi", value.flight_guidance_xtk_nmi);
+  visitor.field("flight_guidance_tae_deg", value.flight_guidance_tae_deg);
+  visitor.field("flight_guidance_phi_deg", value.flight_guidance_phi_deg);
+  visitor.field("flight_guidance_phi_limit_deg", value.flight_guidance_phi_limit_deg);
+  visitor.field("flight_phase", value.flight_phase);
+  visitor.field("V2_kn", value.V2_kn);
+  visitor.field("VAPP_kn", value.VAPP_kn);
+  visitor.field("VLS_kn", value.VLS_kn);
+  visitor.field("VMAX_kn", value.VMAX_kn);
+  visitor.field("is_flight_plan_available", value.is_flight_plan_available);
+  visitor.field("altitude_constraint_ft", value.altitude_constraint_ft);
+  visitor.field("thrust_reduction_altitude", value.thrust_reduction_altitude);
+  visitor.field("thrust_reduction_altitude_go_around", value.thrust_reduction_altitude_go_around);
+  visitor.field("acceleration_altitude", value.acceleration_altitude);
+  visitor.field("acceleration_altitude_engine_out", value.acceleration_altitude_engine_out);
+  visitor.field("acceleration_altitude_go_around", value.acceleration_altitude_go_around);
+  visitor.field("acceleration_altitude_go_around_engine_out", value.acceleration_altitude_go_around_engine_out);
+  visitor.field("cruise_altitude", value.cruise_altitude);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("zeta_deg", value.zeta_deg);
+  visitor.field("throttle_lever_1_pos", value.throttle_lever_1_pos);
+  visitor.field("throttle_lever_2_pos", value.throttle_lever_2_pos);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("is_engine_operative_1", value.is_engine_operative_1);
+  visitor.field("is_engine_operative_2", value.is_engine_operative_2);
+  visitor.field("altimeter_setting_changed", value.altimeter_setting_changed);
+  visitor.field("total_weight_kg", value.total_weight_kg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_sm_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_sm_data_computed& value) {
+  visitor.field("time_since_touchdown", value.time_since_touchdown);
+  visitor.field("time_since_lift_off", value.time_since_lift_off);
+  visitor.field("time_since_SRS", value.time_since_SRS);
+  visitor.field("H_fcu_in_selection", value.H_fcu_in_selection);
+  visitor.field("H_constraint_valid", value.H_constraint_valid);
+  visitor.field("Psi_fcu_in_selection", value.Psi_fcu_in_selection);
+  visitor.field("gs_convergent_towards_beam", value.gs_convergent_towards_beam);
+  visitor.field("V_fcu_in_selection", value.V_fcu_in_selection);
+  visitor.field("ALT_soft_mode", value.ALT_soft_mode);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_lateral_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_lateral_output& value) {
+  visitor.field("mode", value.mode);
+  visitor.field("mode_reversion", value.mode_reversion);
+  visitor.field("mode_reversion_TRK_FPA", value.mode_reversion_TRK_FPA);
+  visitor.field("law", value.law);
+  visitor.field("Psi_c_deg", value.Psi_c_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_lateral_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_lateral& value) {
+  visitor.field("armed", value.armed);
+  visitor.field("condition", value.condition);
+  visitor.field("output", value.output);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_vertical_armed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_vertical_armed& value) {
+  visitor.field("ALT", value.ALT);
+  visitor.field("ALT_CST", value.ALT_CST);
+  visitor.field("CLB", value.CLB);
+  visitor.field("DES", value.DES);
+  visitor.field("FINAL_DES", value.FINAL_DES);
+  visitor.field("GS", value.GS);
+  visitor.field("TCAS", value.TCAS);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_vertical_condition_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_vertical_condition& value) {
+  visitor.field("ALT", value.ALT);
+  visitor.field("ALT_CPT", value.ALT_CPT);
+  visitor.field("ALT_CST", value.ALT_CST);
+  visitor.field("ALT_CST_CPT", value.ALT_CST_CPT);
+  visitor.field("CLB", value.CLB);
+  visitor.field("DES", value.DES);
+  visitor.field("FINAL_DES", value.FINAL_DES);
+  visitor.field("GS_CPT", value.GS_CPT);
+  visitor.field("GS_TRACK", value.GS_TRACK);
+  visitor.field("LAND", value.LAND);
+  visitor.field("FLARE", value.FLARE);
+  visitor.field("ROLL_OUT", value.ROLL_OUT);
+  visitor.field("SRS", value.SRS);
+  visitor.field("SRS_GA", value.SRS_GA);
+  visitor.field("THR_RED", value.THR_RED);
+  visitor.field("H_fcu_active", value.H_fcu_active);
+  visitor.field("TCAS", value.TCAS);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_vertical_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_vertical_output& value) {
+  visitor.field("mode", value.mode);
+  visitor.field("mode_autothrust", value.mode_autothrust);
+  visitor.field("mode_reversion", value.mode_reversion);
+  visitor.field("mode_reversion_target_fpm", value.mode_reversion_target_fpm);
+  visitor.field("mode_reversion_TRK_FPA", value.mode_reversion_TRK_FPA);
+  visitor.field("law", value.law);
+  visitor.field("H_c_ft", value.H_c_ft);
+  visitor.field("H_dot_c_fpm", value.H_dot_c_fpm);
+  visitor.field("FPA_c_deg", value.FPA_c_deg);
+  visitor.field("V_c_kn", value.V_c_kn);
+  visitor.field("ALT_soft_mode_active", value.ALT_soft_mode_active);
+  visitor.field("ALT_cruise_mode_active", value.ALT_cruise_mode_active);
+  visitor.field("EXPED_mode_active", value.EXPED_mode_active);
+  visitor.field("speed_protection_mode", value.speed_protection_mode);
+  visitor.field("FD_disconnect", value.FD_disconnect);
+  visitor.field("FD_connect", value.FD_connect);
+  visitor.field("TCAS_sub_mode", value.TCAS_sub_mode);
+  visitor.field("TCAS_sub_mode_compatible", value.TCAS_sub_mode_compatible);
+  visitor.field("TCAS_message_disarm", value.TCAS_message_disarm);
+  visitor.field("TCAS_message_RA_inhibit", value.TCAS_message_RA_inhibit);
+  visitor.field("TCAS_message_TRK_FPA_deselection", value.TCAS_message_TRK_FPA_deselection);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_vertical_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_vertical& value) {
+  visitor.field("armed", value.armed);
+  visitor.field("condition", value.condition);
+  visitor.field("output", value.output);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_laws_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_laws_input& value) {
+  visitor.field("enabled_AP1", value.enabled_AP1);
+  visitor.field("enabled_AP2", value.enabled_AP2);
+  visitor.field("lateral_law", value.lateral_law);
+  visitor.field("lateral_mode", value.lateral_mode);
+  visitor.field("lateral_mode_armed", value.lateral_mode_armed);
+  visitor.field("vertical_law", value.vertical_law);
+  visitor.field("vertical_mode", value.vertical_mode);
+  visitor.field("vertical_mode_armed", value.vertical_mode_armed);
+  visitor.field("mode_reversion_lateral", value.mode_reversion_lateral);
+  visitor.field("mode_reversion_vertical", value.mode_reversion_vertical);
+  visitor.field("mode_reversion_vertical_target_fpm", value.mode_reversion_vertical_target_fpm);
+  visitor.field("mode_reversion_TRK_FPA", value.mode_reversion_TRK_FPA);
+  visitor.field("mode_reversion_triple_click", value.mode_reversion_triple_click);
+  visitor.field("mode_reversion_fma", value.mode_reversion_fma);
+  visitor.field("speed_protection_mode", value.speed_protection_mode);
+  visitor.field("autothrust_mode", value.autothrust_mode);
+  visitor.field("Psi_c_deg", value.Psi_c_deg);
+  visitor.field("H_c_ft", value.H_c_ft);
+  visitor.field("H_dot_c_fpm", value.H_dot_c_fpm);
+  visitor.field("FPA_c_deg", value.FPA_c_deg);
+  visitor.field("V_c_kn", value.V_c_kn);
+  visitor.field("ALT_soft_mode_active", value.ALT_soft_mode_active);
+  visitor.field("ALT_cruise_mode_active", value.ALT_cruise_mode_active);
+  visitor.field("EXPED_mode_active", value.EXPED_mode_active);
+  visitor.field("FD_disconnect", value.FD_disconnect);
+  visitor.field("FD_connect", value.FD_connect);
+  visitor.field("TCAS_message_disarm", value.TCAS_message_disarm);
+  visitor.field("TCAS_message_RA_inhibit", value.TCAS_message_RA_inhibit);
+  visitor.field("TCAS_message_TRK_FPA_deselection", value.TCAS_message_TRK_FPA_deselection);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_sm_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_sm_output& value) {
+  visitor.field("time", value.time);
+  visitor.field("data", value.data);
+  visitor.field("data_computed", value.data_computed);
+  visitor.field("input", value.input);
+  visitor.field("lateral", value.lateral);
+  visitor.field("lateral_previous", value.lateral_previous);
+  visitor.field("vertical", value.vertical);
+  visitor.field("vertical_previous", value.vertical_previous);
+  visitor.field("output", value.output);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_laws_flare_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_laws_flare& value) {
+  visitor.field("condition_Flare", value.condition_Flare);
+  visitor.field("H_dot_radio_fpm", value.H_dot_radio_fpm);
+  visitor.field("H_dot_c_fpm", value.H_dot_c_fpm);
+  visitor.field("delta_Theta_H_dot_deg", value.delta_Theta_H_dot_deg);
+  visitor.field("delta_Theta_bz_deg", value.delta_Theta_bz_deg);
+  visitor.field("delta_Theta_bx_deg", value.delta_Theta_bx_deg);
+  visitor.field("delta_Theta_beta_c_deg", value.delta_Theta_beta_c_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_laws_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_laws_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("data", value.data);
+  visitor.field("input", value.input);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_output_command_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_output_command& value) {
+  visitor.field("Theta_c_deg", value.Theta_c_deg);
+  visitor.field("Phi_c_deg", value.Phi_c_deg);
+  visitor.field("Beta_c_deg", value.Beta_c_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_raw_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_raw_output& value) {
+  visitor.field("ap_on", value.ap_on);
+  visitor.field("Phi_loc_c", value.Phi_loc_c);
+  visitor.field("Nosewheel_c", value.Nosewheel_c);
+  visitor.field("flight_director", value.flight_director);
+  visitor.field("autopilot", value.autopilot);
+  visitor.field("flare_law", value.flare_law);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_laws_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_laws_output& value) {
+  visitor.field("time", value.time);
+  visitor.field("data", value.data);
+  visitor.field("input", value.input);
+  visitor.field("output", value.output);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_ap_output_law_
+template <typename Visitor>
+void visitFields(Visitor& visitor, ap_output_law& value) {
+  visitor.field("flight_director", value.flight_director);
+  visitor.field("autopilot", value.autopilot);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_time_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_time& value) {
+  visitor.field("dt", value.dt);
+  visitor.field("simulation_time", value.simulation_time);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_raw_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_raw_data& value) {
+  visitor.field("nz_g", value.nz_g);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("V_mach", value.V_mach);
+  visitor.field("V_gnd_kn", value.V_gnd_kn);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("H_ft", value.H_ft);
+  visitor.field("H_ind_ft", value.H_ind_ft);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("H_dot_fpm", value.H_dot_fpm);
+  visitor.field("bx_m_s2", value.bx_m_s2);
+  visitor.field("by_m_s2", value.by_m_s2);
+  visitor.field("bz_m_s2", value.bz_m_s2);
+  visitor.field("Psi_magnetic_deg", value.Psi_magnetic_deg);
+  visitor.field("Psi_magnetic_track_deg", value.Psi_magnetic_track_deg);
+  visitor.field("gear_strut_compression_1", value.gear_strut_compression_1);
+  visitor.field("gear_strut_compression_2", value.gear_strut_compression_2);
+  visitor.field("flap_handle_index", value.flap_handle_index);
+  visitor.field("is_engine_operative_1", value.is_engine_operative_1);
+  visitor.field("is_engine_operative_2", value.is_engine_operative_2);
+  visitor.field("commanded_engine_N1_1_percent", value.commanded_engine_N1_1_percent);
+  visitor.field("commanded_engine_N1_2_percent", value.commanded_engine_N1_2_percent);
+  visitor.field("engine_N1_1_percent", value.engine_N1_1_percent);
+  visitor.field("engine_N1_2_percent", value.engine_N1_2_percent);
+  visitor.field("corrected_engine_N1_1_percent", value.corrected_engine_N1_1_percent);
+  visitor.field("corrected_engine_N1_2_percent", value.corrected_engine_N1_2_percent);
+  visitor.field("TAT_degC", value.TAT_degC);
+  visitor.field("OAT_degC", value.OAT_degC);
+  visitor.field("ambient_density_kg_per_m3", value.ambient_density_kg_per_m3);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_input& value) {
+  visitor.field("ATHR_push", value.ATHR_push);
+  visitor.field("ATHR_disconnect", value.ATHR_disconnect);
+  visitor.field("TLA_1_deg", value.TLA_1_deg);
+  visitor.field("TLA_2_deg", value.TLA_2_deg);
+  visitor.field("V_c_kn", value.V_c_kn);
+  visitor.field("V_LS_kn", value.V_LS_kn);
+  visitor.field("V_MAX_kn", value.V_MAX_kn);
+  visitor.field("thrust_limit_REV_percent", value.thrust_limit_REV_percent);
+  visitor.field("thrust_limit_IDLE_percent", value.thrust_limit_IDLE_percent);
+  visitor.field("thrust_limit_CLB_percent", value.thrust_limit_CLB_percent);
+  visitor.field("thrust_limit_MCT_percent", value.thrust_limit_MCT_percent);
+  visitor.field("thrust_limit_FLEX_percent", value.thrust_limit_FLEX_percent);
+  visitor.field("thrust_limit_TOGA_percent", value.thrust_limit_TOGA_percent);
+  visitor.field("flex_temperature_degC", value.flex_temperature_degC);
+  visitor.field("mode_requested", value.mode_requested);
+  visitor.field("is_mach_mode_active", value.is_mach_mode_active);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("is_approach_mode_active", value.is_approach_mode_active);
+  visitor.field("is_SRS_TO_mode_active", value.is_SRS_TO_mode_active);
+  visitor.field("is_SRS_GA_mode_active", value.is_SRS_GA_mode_active);
+  visitor.field("is_LAND_mode_active", value.is_LAND_mode_active);
+  visitor.field("thrust_reduction_altitude", value.thrust_reduction_altitude);
+  visitor.field("thrust_reduction_altitude_go_around", value.thrust_reduction_altitude_go_around);
+  visitor.field("flight_phase", value.flight_phase);
+  visitor.field("is_alt_soft_mode_active", value.is_alt_soft_mode_active);
+  visitor.field("is_anti_ice_wing_active", value.is_anti_ice_wing_active);
+  visitor.field("is_anti_ice_engine_1_active", value.is_anti_ice_engine_1_active);
+  visitor.field("is_anti_ice_engine_2_active", value.is_anti_ice_engine_2_active);
+  visitor.field("is_air_conditioning_1_active", value.is_air_conditioning_1_active);
+  visitor.field("is_air_conditioning_2_active", value.is_air_conditioning_2_active);
+  visitor.field("FD_active", value.FD_active);
+  visitor.field("ATHR_reset_disable", value.ATHR_reset_disable);
+  visitor.field("is_TCAS_active", value.is_TCAS_active);
+  visitor.field("target_TCAS_RA_rate_fpm", value.target_TCAS_RA_rate_fpm);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_in_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_in& value) {
+  visitor.field("time", value.time);
+  visitor.field("data", value.data);
+  visitor.field("input", value.input);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_data& value) {
+  visitor.field("nz_g", value.nz_g);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("V_mach", value.V_mach);
+  visitor.field("V_gnd_kn", value.V_gnd_kn);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("H_ft", value.H_ft);
+  visitor.field("H_ind_ft", value.H_ind_ft);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("H_dot_fpm", value.H_dot_fpm);
+  visitor.field("ax_m_s2", value.ax_m_s2);
+  visitor.field("ay_m_s2", value.ay_m_s2);
+  visitor.field("az_m_s2", value.az_m_s2);
+  visitor.field("bx_m_s2", value.bx_m_s2);
+  visitor.field("by_m_s2", value.by_m_s2);
+  visitor.field("bz_m_s2", value.bz_m_s2);
+  visitor.field("Psi_magnetic_deg", value.Psi_magnetic_deg);
+  visitor.field("Psi_magnetic_track_deg", value.Psi_magnetic_track_deg);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("flap_handle_index", value.flap_handle_index);
+  visitor.field("is_engine_operative_1", value.is_engine_operative_1);
+  visitor.field("is_engine_operative_2", value.is_engine_operative_2);
+  visitor.field("commanded_engine_N1_1_percent", value.commanded_engine_N1_1_percent);
+  visitor.field("commanded_engine_N1_2_percent", value.commanded_engine_N1_2_percent);
+  visitor.field("engine_N1_1_percent", value.engine_N1_1_percent);
+  visitor.field("engine_N1_2_percent", value.engine_N1_2_percent);
+  visitor.field("TAT_degC", value.TAT_degC);
+  visitor.field("OAT_degC", value.OAT_degC);
+  visitor.field("ISA_degC", value.ISA_degC);
+  visitor.field("ambient_density_kg_per_m3", value.ambient_density_kg_per_m3);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_data_computed& value) {
+  visitor.field("TLA_in_active_range", value.TLA_in_active_range);
+  visitor.field("is_FLX_active", value.is_FLX_active);
+  visitor.field("ATHR_push", value.ATHR_push);
+  visitor.field("ATHR_disabled", value.ATHR_disabled);
+  visitor.field("time_since_touchdown", value.time_since_touchdown);
+  visitor.field("alpha_floor_inhibited", value.alpha_floor_inhibited);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_output& value) {
+  visitor.field("sim_throttle_lever_1_pos", value.sim_throttle_lever_1_pos);
+  visitor.field("sim_throttle_lever_2_pos", value.sim_throttle_lever_2_pos);
+  visitor.field("sim_thrust_mode_1", value.sim_thrust_mode_1);
+  visitor.field("sim_thrust_mode_2", value.sim_thrust_mode_2);
+  visitor.field("N1_TLA_1_percent", value.N1_TLA_1_percent);
+  visitor.field("N1_TLA_2_percent", value.N1_TLA_2_percent);
+  visitor.field("is_in_reverse_1", value.is_in_reverse_1);
+  visitor.field("is_in_reverse_2", value.is_in_reverse_2);
+  visitor.field("thrust_limit_type", value.thrust_limit_type);
+  visitor.field("thrust_limit_percent", value.thrust_limit_percent);
+  visitor.field("N1_c_1_percent", value.N1_c_1_percent);
+  visitor.field("N1_c_2_percent", value.N1_c_2_percent);
+  visitor.field("status", value.status);
+  visitor.field("mode", value.mode);
+  visitor.field("mode_message", value.mode_message);
+  visitor.field("thrust_lever_warning_flex", value.thrust_lever_warning_flex);
+  visitor.field("thrust_lever_warning_toga", value.thrust_lever_warning_toga);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_athr_out_
+template <typename Visitor>
+void visitFields(Visitor& visitor, athr_out& value) {
+  visitor.field("time", value.time);
+  visitor.field("data", value.data);
+  visitor.field("data_computed", value.data_computed);
+  visitor.field("input", value.input);
+  visitor.field("output", value.output);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_time_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_time& value) {
+  visitor.field("dt", value.dt);
+  visitor.field("simulation_time", value.simulation_time);
+  visitor.field("monotonic_time", value.monotonic_time);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sim_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sim_data& value) {
+  visitor.field("slew_on", value.slew_on);
+  visitor.field("pause_on", value.pause_on);
+  visitor.field("tracking_mode_on_override", value.tracking_mode_on_override);
+  visitor.field("tailstrike_protection_on", value.tailstrike_protection_on);
+  visitor.field("computer_running", value.computer_running);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_discrete_inputs& value) {
+  visitor.field("ap_own_engaged", value.ap_own_engaged);
+  visitor.field("ap_opp_engaged", value.ap_opp_engaged);
+  visitor.field("yaw_damper_opp_engaged", value.yaw_damper_opp_engaged);
+  visitor.field("rudder_trim_opp_engaged", value.rudder_trim_opp_engaged);
+  visitor.field("rudder_travel_lim_opp_engaged", value.rudder_travel_lim_opp_engaged);
+  visitor.field("elac_1_healthy", value.elac_1_healthy);
+  visitor.field("elac_2_healthy", value.elac_2_healthy);
+  visitor.field("engine_1_stopped", value.engine_1_stopped);
+  visitor.field("engine_2_stopped", value.engine_2_stopped);
+  visitor.field("rudder_trim_switch_left", value.rudder_trim_switch_left);
+  visitor.field("rudder_trim_switch_right", value.rudder_trim_switch_right);
+  visitor.field("rudder_trim_reset_button", value.rudder_trim_reset_button);
+  visitor.field("fac_engaged_from_switch", value.fac_engaged_from_switch);
+  visitor.field("fac_opp_healthy", value.fac_opp_healthy);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("rudder_trim_actuator_healthy", value.rudder_trim_actuator_healthy);
+  visitor.field("rudder_travel_lim_actuator_healthy", value.rudder_travel_lim_actuator_healthy);
+  visitor.field("slats_extended", value.slats_extended);
+  visitor.field("nose_gear_pressed", value.nose_gear_pressed);
+  visitor.field("ir_3_switch", value.ir_3_switch);
+  visitor.field("adr_3_switch", value.adr_3_switch);
+  visitor.field("yaw_damper_has_hyd_press", value.yaw_damper_has_hyd_press);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_analog_inputs& value) {
+  visitor.field("yaw_damper_position_deg", value.yaw_damper_position_deg);
+  visitor.field("rudder_trim_position_deg", value.rudder_trim_position_deg);
+  visitor.field("rudder_travel_lim_position_deg", value.rudder_travel_lim_position_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_arinc_429_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_arinc_429& value) {
+  visitor.field("SSM", value.SSM);
+  visitor.field("Data", value.Data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("gamma_a_deg", value.gamma_a_deg);
+  visitor.field("gamma_t_deg", value.gamma_t_deg);
+  visitor.field("total_weight_lbs", value.total_weight_lbs);
+  visitor.field("center_of_gravity_pos_percent", value.center_of_gravity_pos_percent);
+  visitor.field("sideslip_target_deg", value.sideslip_target_deg);
+  visitor.field("fac_slat_angle_deg", value.fac_slat_angle_deg);
+  visitor.field("fac_flap_angle", value.fac_flap_angle);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("rudder_travel_limit_command_deg", value.rudder_travel_limit_command_deg);
+  visitor.field("delta_r_yaw_damper_deg", value.delta_r_yaw_damper_deg);
+  visitor.field("estimated_sideslip_deg", value.estimated_sideslip_deg);
+  visitor.field("v_alpha_lim_kn", value.v_alpha_lim_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("speed_trend_kn", value.speed_trend_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("discrete_word_5", value.discrete_word_5);
+  visitor.field("delta_r_rudder_trim_deg", value.delta_r_rudder_trim_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_adr_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_adr_bus& value) {
+  visitor.field("altitude_standard_ft", value.altitude_standard_ft);
+  visitor.field("altitude_corrected_ft", value.altitude_corrected_ft);
+  visitor.field("mach", value.mach);
+  visitor.field("airspeed_computed_kn", value.airspeed_computed_kn);
+  visitor.field("airspeed_true_kn", value.airspeed_true_kn);
+  visitor.field("vertical_speed_ft_min", value.vertical_speed_ft_min);
+  visitor.field("aoa_corrected_deg", value.aoa_corrected_deg);
+  visitor.field("corrected_average_static_pressure", value.corrected_average_static_pressure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_ir_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_ir_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("latitude_deg", value.latitude_deg);
+  visitor.field("longitude_deg", value.longitude_deg);
+  visitor.field("ground_speed_kn", value.ground_speed_kn);
+  visitor.field("track_angle_true_deg", value.track_angle_true_deg);
+  visitor.field("heading_true_deg", value.heading_true_deg);
+  visitor.field("wind_speed_kn", value.wind_speed_kn);
+  visitor.field("wind_direction_true_deg", value.wind_direction_true_deg);
+  visitor.field("track_angle_magnetic_deg", value.track_angle_magnetic_deg);
+  visitor.field("heading_magnetic_deg", value.heading_magnetic_deg);
+  visitor.field("drift_angle_deg", value.drift_angle_deg);
+  visitor.field("flight_path_angle_deg", value.flight_path_angle_deg);
+  visitor.field("flight_path_accel_g", value.flight_path_accel_g);
+  visitor.field("pitch_angle_deg", value.pitch_angle_deg);
+  visitor.field("roll_angle_deg", value.roll_angle_deg);
+  visitor.field("body_pitch_rate_deg_s", value.body_pitch_rate_deg_s);
+  visitor.field("body_roll_rate_deg_s", value.body_roll_rate_deg_s);
+  visitor.field("body_yaw_rate_deg_s", value.body_yaw_rate_deg_s);
+  visitor.field("body_long_accel_g", value.body_long_accel_g);
+  visitor.field("body_lat_accel_g", value.body_lat_accel_g);
+  visitor.field("body_normal_accel_g", value.body_normal_accel_g);
+  visitor.field("track_angle_rate_deg_s", value.track_angle_rate_deg_s);
+  visitor.field("pitch_att_rate_deg_s", value.pitch_att_rate_deg_s);
+  visitor.field("roll_att_rate_deg_s", value.roll_att_rate_deg_s);
+  visitor.field("inertial_alt_ft", value.inertial_alt_ft);
+  visitor.field("along_track_horiz_acc_g", value.along_track_horiz_acc_g);
+  visitor.field("cross_track_horiz_acc_g", value.cross_track_horiz_acc_g);
+  visitor.field("vertical_accel_g", value.vertical_accel_g);
+  visitor.field("inertial_vertical_speed_ft_s", value.inertial_vertical_speed_ft_s);
+  visitor.field("north_south_velocity_kn", value.north_south_velocity_kn);
+  visitor.field("east_west_velocity_kn", value.east_west_velocity_kn);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fmgc_b_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fmgc_b_bus& value) {
+  visitor.field("fac_weight_lbs", value.fac_weight_lbs);
+  visitor.field("fm_weight_lbs", value.fm_weight_lbs);
+  visitor.field("fac_cg_percent", value.fac_cg_percent);
+  visitor.field("fm_cg_percent", value.fm_cg_percent);
+  visitor.field("fg_radio_height_ft", value.fg_radio_height_ft);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("ats_discrete_word", value.ats_discrete_word);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("approach_spd_target_kn", value.approach_spd_target_kn);
+  visitor.field("delta_p_ail_cmd_deg", value.delta_p_ail_cmd_deg);
+  visitor.field("delta_p_splr_cmd_deg", value.delta_p_splr_cmd_deg);
+  visitor.field("delta_r_cmd_deg", value.delta_r_cmd_deg);
+  visitor.field("delta_nose_wheel_cmd_deg", value.delta_nose_wheel_cmd_deg);
+  visitor.field("delta_q_cmd_deg", value.delta_q_cmd_deg);
+  visitor.field("n1_left_percent", value.n1_left_percent);
+  visitor.field("n1_right_percent", value.n1_right_percent);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sfcc_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sfcc_bus& value) {
+  visitor.field("slat_flap_component_status_word", value.slat_flap_component_status_word);
+  visitor.field("slat_flap_system_status_word", value.slat_flap_system_status_word);
+  visitor.field("slat_flap_actual_position_word", value.slat_flap_actual_position_word);
+  visitor.field("slat_actual_position_deg", value.slat_actual_position_deg);
+  visitor.field("flap_actual_position_deg", value.flap_actual_position_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_lgciu_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_lgciu_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_out_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_out_bus& value) {
+  visitor.field("left_aileron_position_deg", value.left_aileron_position_deg);
+  visitor.field("right_aileron_position_deg", value.right_aileron_position_deg);
+  visitor.field("left_elevator_position_deg", value.left_elevator_position_deg);
+  visitor.field("right_elevator_position_deg", value.right_elevator_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_command_deg", value.aileron_command_deg);
+  visitor.field("roll_spoiler_command_deg", value.roll_spoiler_command_deg);
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("elevator_double_pressurization_command_deg", value.elevator_double_pressurization_command_deg);
+  visitor.field("speedbrake_extension_deg", value.speedbrake_extension_deg);
+  visitor.field("discrete_status_word_1", value.discrete_status_word_1);
+  visitor.field("discrete_status_word_2", value.discrete_status_word_2);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_bus_inputs& value) {
+  visitor.field("fac_opp_bus", value.fac_opp_bus);
+  visitor.field("adr_own_bus", value.adr_own_bus);
+  visitor.field("adr_opp_bus", value.adr_opp_bus);
+  visitor.field("adr_3_bus", value.adr_3_bus);
+  visitor.field("ir_own_bus", value.ir_own_bus);
+  visitor.field("ir_opp_bus", value.ir_opp_bus);
+  visitor.field("ir_3_bus", value.ir_3_bus);
+  visitor.field("fmgc_own_bus", value.fmgc_own_bus);
+  visitor.field("fmgc_opp_bus", value.fmgc_opp_bus);
+  visitor.field("sfcc_own_bus", value.sfcc_own_bus);
+  visitor.field("lgciu_own_bus", value.lgciu_own_bus);
+  visitor.field("elac_1_bus", value.elac_1_bus);
+  visitor.field("elac_2_bus", value.elac_2_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_fac_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, fac_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_laws_outputs& value) {
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("rudder_trim_command_deg", value.rudder_trim_command_deg);
+  visitor.field("rudder_travel_lim_command_deg", value.rudder_travel_lim_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_adr_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_adr_computation_data& value) {
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("p_s_c_hpa", value.p_s_c_hpa);
+  visitor.field("altitude_corrected_ft", value.altitude_corrected_ft);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_ir_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_ir_computation_data& value) {
+  visitor.field("theta_deg", value.theta_deg);
+  visitor.field("phi_deg", value.phi_deg);
+  visitor.field("q_deg_s", value.q_deg_s);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("n_x_g", value.n_x_g);
+  visitor.field("n_y_g", value.n_y_g);
+  visitor.field("n_z_g", value.n_z_g);
+  visitor.field("theta_dot_deg_s", value.theta_dot_deg_s);
+  visitor.field("phi_dot_deg_s", value.phi_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_logic_outputs& value) {
+  visitor.field("lgciu_own_valid", value.lgciu_own_valid);
+  visitor.field("all_lgciu_lost", value.all_lgciu_lost);
+  visitor.field("left_main_gear_pressed", value.left_main_gear_pressed);
+  visitor.field("right_main_gear_pressed", value.right_main_gear_pressed);
+  visitor.field("main_gear_out", value.main_gear_out);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("double_self_detected_adr_failure", value.double_self_detected_adr_failure);
+  visitor.field("double_self_detected_ir_failure", value.double_self_detected_ir_failure);
+  visitor.field("double_not_self_detected_adr_failure", value.double_not_self_detected_adr_failure);
+  visitor.field("double_not_self_detected_ir_failure", value.double_not_self_detected_ir_failure);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+  visitor.field("yaw_damper_engaged", value.yaw_damper_engaged);
+  visitor.field("yaw_damper_can_engage", value.yaw_damper_can_engage);
+  visitor.field("yaw_damper_has_priority", value.yaw_damper_has_priority);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("rudder_trim_can_engage", value.rudder_trim_can_engage);
+  visitor.field("rudder_trim_has_priority", value.rudder_trim_has_priority);
+  visitor.field("rudder_travel_lim_engaged", value.rudder_travel_lim_engaged);
+  visitor.field("rudder_travel_lim_can_engage", value.rudder_travel_lim_can_engage);
+  visitor.field("rudder_travel_lim_has_priority", value.rudder_travel_lim_has_priority);
+  visitor.field("speed_scale_lost", value.speed_scale_lost);
+  visitor.field("speed_scale_visible", value.speed_scale_visible);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_flight_envelope_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_flight_envelope_outputs& value) {
+  visitor.field("estimated_beta_deg", value.estimated_beta_deg);
+  visitor.field("beta_target_deg", value.beta_target_deg);
+  visitor.field("beta_target_visible", value.beta_target_visible);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("alpha_filtered_deg", value.alpha_filtered_deg);
+  visitor.field("computed_weight_lbs", value.computed_weight_lbs);
+  visitor.field("computed_cg_percent", value.computed_cg_percent);
+  visitor.field("v_alpha_max_kn", value.v_alpha_max_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_3_visible", value.v_3_visible);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_4_visible", value.v_4_visible);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_man_visible", value.v_man_visible);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("v_fe_next_visible", value.v_fe_next_visible);
+  visitor.field("v_c_trend_kn", value.v_c_trend_kn);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_discrete_outputs& value) {
+  visitor.field("fac_healthy", value.fac_healthy);
+  visitor.field("yaw_damper_engaged", value.yaw_damper_engaged);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("rudder_travel_lim_engaged", value.rudder_travel_lim_engaged);
+  visitor.field("rudder_travel_lim_emergency_reset", value.rudder_travel_lim_emergency_reset);
+  visitor.field("yaw_damper_avail_for_norm_law", value.yaw_damper_avail_for_norm_law);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_analog_outputs& value) {
+  visitor.field("yaw_damper_order_deg", value.yaw_damper_order_deg);
+  visitor.field("rudder_trim_order_deg", value.rudder_trim_order_deg);
+  visitor.field("rudder_travel_limit_order_deg", value.rudder_travel_limit_order_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_fac_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, fac_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("flight_envelope", value.flight_envelope);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_2OohiAWrazWy5wDS5iisgF_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_2OohiAWrazWy5wDS5iisgF& value) {
+  visitor.field("SSM", value.SSM);
+  visitor.field("Data", value.Data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_fAEsrEZhvvruiP1ICEwvRC_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_fAEsrEZhvvruiP1ICEwvRC& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("gamma_a_deg", value.gamma_a_deg);
+  visitor.field("gamma_t_deg", value.gamma_t_deg);
+  visitor.field("total_weight_lbs", value.total_weight_lbs);
+  visitor.field("center_of_gravity_pos_percent", value.center_of_gravity_pos_percent);
+  visitor.field("sideslip_target_deg", value.sideslip_target_deg);
+  visitor.field("fac_slat_angle_deg", value.fac_slat_angle_deg);
+  visitor.field("fac_flap_angle", value.fac_flap_angle);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("rudder_travel_limit_command_deg", value.rudder_travel_limit_command_deg);
+  visitor.field("delta_r_yaw_damper_deg", value.delta_r_yaw_damper_deg);
+  visitor.field("estimated_sideslip_deg", value.estimated_sideslip_deg);
+  visitor.field("v_alpha_lim_kn", value.v_alpha_lim_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("speed_trend_kn", value.speed_trend_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("discrete_word_5", value.discrete_word_5);
+  visitor.field("delta_r_rudder_trim_deg", value.delta_r_rudder_trim_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_NHciy9HFthvyJ1C8wWfWlB_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_NHciy9HFthvyJ1C8wWfWlB& value) {
+  visitor.field("estimated_beta_deg", value.estimated_beta_deg);
+  visitor.field("beta_target_deg", value.beta_target_deg);
+  visitor.field("beta_target_visible", value.beta_target_visible);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("alpha_filtered_deg", value.alpha_filtered_deg);
+  visitor.field("computed_weight_lbs", value.computed_weight_lbs);
+  visitor.field("computed_cg_percent", value.computed_cg_percent);
+  visitor.field("v_alpha_max_kn", value.v_alpha_max_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_3_visible", value.v_3_visible);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_4_visible", value.v_4_visible);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_man_visible", value.v_man_visible);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("v_fe_next_visible", value.v_fe_next_visible);
+  visitor.field("v_c_trend_kn", value.v_c_trend_kn);
+}
+#endif
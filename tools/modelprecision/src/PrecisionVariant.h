@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class PrecisionModel { AutopilotLaws, Autothrust, FacComputer };
+
+/// <summary>
+/// One build of a model, the inputs and outputs are exchanged as double in the order of the names
+/// </summary>
+class PrecisionVariant {
+ public:
+  virtual ~PrecisionVariant() = default;
+
+  virtual std::vector<std::string> inputNames() = 0;
+
+  virtual std::vector<std::string> outputNames() = 0;
+
+  /// steps the model once, returns the time spent in the step in ns
+  virtual double step(const std::vector<double>& inputs, std::vector<double>& outputs) = 0;
+};
+
+/// the models built with the real_T of the aircraft (double)
+std::unique_ptr<PrecisionVariant> createDoublePrecision(PrecisionModel model);
+
+/// the models built with FBW_MODEL_SINGLE_PRECISION (float real_T)
+std::unique_ptr<PrecisionVariant> createSinglePrecision(PrecisionModel model);
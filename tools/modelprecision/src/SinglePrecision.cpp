@@ -0,0 +1,23 @@
+// the headers used by the models are included outside of the namespace first
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "FieldVisitors.h"
+#include "LookupKernels.h"
+#include "ModelSnapshot.h"
+#include "PrecisionVariant.h"
+
+// switches real_T of the models to float (see rtwtypes.h)
+#define FBW_MODEL_SINGLE_PRECISION
+
+namespace single_precision {
+#include "ModelVariant.inc"
+}  // namespace single_precision
+
+std::unique_ptr<PrecisionVariant> createSinglePrecision(PrecisionModel model) {
+  return single_precision::createVariant(model);
+}
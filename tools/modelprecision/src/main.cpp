@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AdditionalData.h"
+#include "AutopilotLaws_types.h"
+#include "AutopilotStateMachine_types.h"
+#include "Autothrust_types.h"
+#include "EngineData.h"
+#include "FieldVisitors.h"
+#include "ModelFields.h"
+#include "PrecisionVariant.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+#include "zfstream.h"
+
+// interface version of the flight data recorder files, see tools/fdr2csv
+const uint64_t INTERFACE_VERSION = 25;
+
+const double SAMPLE_TIME = 0.03;
+
+/// one recorded frame of the A32NX flight data recorder
+struct RecordedFrame {
+  ap_sm_output apStateMachine;
+  ap_raw_output apLaws;
+  athr_out athr;
+  EngineData engine;
+  AdditionalData additional;
+};
+
+/// <summary>
+/// Source of the model inputs, either a recording or a synthetic flight
+/// </summary>
+class InputSource {
+ public:
+  explicit InputSource(std::unique_ptr<std::istream> in) : in(std::move(in)) {}
+
+  /// reads the next frame, returns false at the end of the recording or after frameCount synthetic frames
+  bool next(uint32_t frameCount) {
+    if (in == nullptr) {
+      return frameIndex++ < frameCount;
+    }
+    in->read(reinterpret_cast<char*>(&frame), sizeof(RecordedFrame));
+    frameIndex++;
+    return in->good();
+  }
+
+  bool isRecorded() const { return in != nullptr; }
+
+  /// values of the recorded frame by name, e.g. "sm.data.V_ias_kn" or "athr.input.mode_requested"
+  std::map<std::string, double> recordedValues() {
+    std::map<std::string, double> values;
+    addValues(values, "sm", frame.apStateMachine);
+    addValues(values, "athr", frame.athr);
+    return values;
+  }
+
+  double time() const { return frameIndex * SAMPLE_TIME; }
+
+ private:
+  std::unique_ptr<std::istream> in;
+  RecordedFrame frame = {};
+  uint64_t frameIndex = 0;
+
+  template <typename T>
+  static void addValues(std::map<std::string, double>& values, const char* name, T& value) {
+    FieldNames names;
+    names.field(name, value);
+    std::vector<double> leaves;
+    FieldReader reader(leaves);
+    reader.field(name, value);
+    for (size_t i = 0; i < leaves.size(); i++) {
+      values[names.names[i]] = leaves[i];
+    }
+  }
+};
+
+/// <summary>
+/// Maps the model inputs to the recorded fields they are fed from in the aircraft
+/// </summary>
+/// <returns>The recorded field per input, empty when the input is not recorded.</returns>
+std::vector<std::string> mapRecordedInputs(PrecisionModel model, const std::vector<std::string>& inputNames) {
+  std::vector<std::pair<std::string, std::string>> prefixes;
+  if (model == PrecisionModel::AutopilotLaws) {
+    // the laws run on the time, data and the law inputs the state machine computed in the same frame
+    prefixes = {{"in.time.", "sm.time."}, {"in.data.", "sm.data."}, {"in.input.", "sm.output."}};
+  } else if (model == PrecisionModel::Autothrust) {
+    prefixes = {{"in.", "athr."}};
+  }
+
+  std::vector<std::string> recordedNames;
+  for (const auto& name : inputNames) {
+    std::string recordedName;
+    for (const auto& [prefix, replacement] : prefixes) {
+      if (name.starts_with(prefix)) {
+        recordedName = replacement + name.substr(prefix.size());
+        break;
+      }
+    }
+    recordedNames.push_back(recordedName);
+  }
+  return recordedNames;
+}
+
+/// <summary>
+/// Synthetic inputs: a slow climbing turn with the computers running, for the models that are not recorded
+/// </summary>
+void prepareSyntheticInputs(const std::vector<std::string>& inputNames, std::vector<double>& inputs, double time) {
+  for (size_t i = 0; i < inputNames.size(); i++) {
+    std::string_view name = inputNames[i];
+    std::string_view leaf = name.substr(name.find_last_of('.') + 1);
+
+    if (leaf == "dt") {
+      inputs[i] = SAMPLE_TIME;
+    } else if (leaf == "simulation_time" || leaf == "monotonic_time" || leaf == "time") {
+      inputs[i] = time;
+    } else if (leaf == "computer_running") {
+      inputs[i] = 1;
+    } else if (leaf == "V_ias_kn" || leaf == "V_tas_kn" || leaf == "computed_airspeed_kn") {
+      inputs[i] = 250 + 20 * std::sin(0.05 * time);
+    } else if (leaf == "H_ft" || leaf == "H_ind_ft" || leaf == "altitude_ft") {
+      inputs[i] = 10000 + 50 * time;
+    } else if (leaf == "Theta_deg") {
+      inputs[i] = 5 + 2 * std::sin(0.2 * time);
+    } else if (leaf == "Phi_deg") {
+      inputs[i] = 25 * std::sin(0.1 * time);
+    } else if (leaf == "Psi_magnetic_deg" || leaf == "Psi_true_deg") {
+      inputs[i] = std::fmod(3 * time, 360.0);
+    } else if (name.find("analog_inputs.") != std::string_view::npos) {
+      inputs[i] = std::sin(0.3 * time + i);
+    }
+  }
+}
+
+/// deviation of one output field between the two precisions
+struct FieldDeviation {
+  double maxDeviation = 0;
+  double maxValue = 0;
+  uint64_t framesDifferent = 0;
+};
+
+/// <summary>
+/// Steps both precisions of a model over the same inputs and collects the deviation per output field
+/// </summary>
+/// <returns>false if the model could not be run.</returns>
+bool compare(PrecisionModel model,
+             const char* name,
+             const std::string& inFilePath,
+             bool noCompression,
+             uint32_t frameCount,
+             uint32_t topCount,
+             std::ofstream& csv) {
+  auto doublePrecision = createDoublePrecision(model);
+  auto singlePrecision = createSinglePrecision(model);
+
+  std::vector<std::string> inputNames = doublePrecision->inputNames();
+  std::vector<std::string> outputNames = doublePrecision->outputNames();
+  if (inputNames != singlePrecision->inputNames() || outputNames != singlePrecision->outputNames()) {
+    fmt::print("{}: fields of the precisions differ!\n", name);
+    return false;
+  }
+
+  // create input source, the flight control computers are not recorded and always run on synthetic inputs
+  std::unique_ptr<std::istream> in;
+  if (!inFilePath.empty() && model != PrecisionModel::FacComputer) {
+    if (!noCompression) {
+      in = std::make_unique<gzifstream>(inFilePath.c_str());
+    } else {
+      in = std::make_unique<std::ifstream>(inFilePath.c_str(), std::ios::in | std::ios::binary);
+    }
+    uint64_t fileFormatVersion = 0;
+    in->read(reinterpret_cast<char*>(&fileFormatVersion), sizeof(INTERFACE_VERSION));
+    if (!in->good() || fileFormatVersion != INTERFACE_VERSION) {
+      fmt::print("ERROR: mismatch between harness and file version (expected {}, got {})\n", INTERFACE_VERSION, fileFormatVersion);
+      return false;
+    }
+  }
+  InputSource source(std::move(in));
+
+  std::vector<std::string> recordedNames;
+  if (source.isRecorded()) {
+    recordedNames = mapRecordedInputs(model, inputNames);
+  }
+
+  std::vector<double> inputs(inputNames.size(), 0.0);
+  std::vector<double> doubleOutputs;
+  std::vector<double> singleOutputs;
+  std::vector<FieldDeviation> deviations(outputNames.size());
+  double doubleTime = 0;
+  double singleTime = 0;
+  uint64_t frames = 0;
+  size_t unmappedInputs = 0;
+
+  while (source.next(frameCount)) {
+    if (source.isRecorded()) {
+      auto values = source.recordedValues();
+      unmappedInputs = 0;
+      for (size_t i = 0; i < inputNames.size(); i++) {
+        auto value = values.find(recordedNames[i]);
+        if (value != values.end()) {
+          inputs[i] = value->second;
+        } else {
+          unmappedInputs++;
+        }
+      }
+    } else {
+      prepareSyntheticInputs(inputNames, inputs, source.time());
+    }
+
+    doubleTime += doublePrecision->step(inputs, doubleOutputs);
+    singleTime += singlePrecision->step(inputs, singleOutputs);
+    frames++;
+
+    for (size_t i = 0; i < outputNames.size(); i++) {
+      double deviation = std::abs(doubleOutputs[i] - singleOutputs[i]);
+      if (std::isnan(doubleOutputs[i]) != std::isnan(singleOutputs[i])) {
+        deviation = INFINITY;
+      } else if (std::isnan(deviation)) {
+        deviation = 0;
+      }
+      auto& field = deviations[i];
+      field.maxDeviation = std::max(field.maxDeviation, deviation);
+      field.maxValue = std::max(field.maxValue, std::abs(doubleOutputs[i]));
+      field.framesDifferent += deviation > 0;
+    }
+  }
+
+  if (frames == 0) {
+    fmt::print("{}: no frames!\n", name);
+    return false;
+  }
+
+  size_t deviatingOutputs = std::count_if(deviations.begin(), deviations.end(), [](const auto& field) { return field.maxDeviation > 0; });
+  fmt::print("{}: {} frames ({}), {} inputs{}, {} outputs\n", name, frames, source.isRecorded() ? "recorded" : "synthetic",
+             inputNames.size(), unmappedInputs > 0 ? fmt::format(" ({} not recorded)", unmappedInputs) : "", outputNames.size());
+  fmt::print("  step double {:8.3f} us  float {:8.3f} us  ({:+.1f} %)\n", doubleTime / frames / 1000, singleTime / frames / 1000,
+             100 * (singleTime - doubleTime) / doubleTime);
+  fmt::print("  {} outputs deviate\n", deviatingOutputs);
+
+  std::vector<size_t> order(outputNames.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t a, size_t b) { return deviations[a].maxDeviation > deviations[b].maxDeviation; });
+  for (size_t i = 0; i < std::min<size_t>(topCount, deviatingOutputs); i++) {
+    const auto& field = deviations[order[i]];
+    fmt::print("  {:<60} max deviation {:<12.6g} max |value| {:<12.6g} in {} frames\n", outputNames[order[i]], field.maxDeviation,
+               field.maxValue, field.framesDifferent);
+  }
+
+  if (csv.is_open()) {
+    for (size_t i = 0; i < outputNames.size(); i++) {
+      csv << fmt::format("{},{},{},{},{}\n", name, outputNames[i], deviations[i].maxDeviation, deviations[i].maxValue,
+                         deviations[i].framesDifferent);
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  std::string inFilePath;
+  std::string outFilePath;
+  std::string modelName = "all";
+  uint32_t frameCount = 20000;
+  uint32_t topCount = 10;
+  bool noCompression = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Compares the double and single precision builds of the A32NX AutopilotLaws, Autothrust and FacComputer");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Input FDR file, synthetic inputs when not given");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input file is not compressed");
+  args.addArgument({"-m", "--model"}, &modelName, "Model to compare: all, laws, athr or fac");
+  args.addArgument({"-f", "--frames"}, &frameCount, "Number of synthetic frames");
+  args.addArgument({"-t", "--top"}, &topCount, "Number of output fields with the largest deviation to print");
+  args.addArgument({"-o", "--out"}, &outFilePath, "CSV file with the deviation of every output field");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // check parameters
+  if (!inFilePath.empty() && !std::filesystem::exists(inFilePath)) {
+    fmt::print("Input file does not exist!\n");
+    return 1;
+  }
+  if (modelName != "all" && modelName != "laws" && modelName != "athr" && modelName != "fac") {
+    fmt::print("Unknown model {}!\n", modelName);
+    return 1;
+  }
+
+  std::ofstream csv;
+  if (!outFilePath.empty()) {
+    csv.open(outFilePath);
+    csv << "model,field,max_deviation,max_value,frames_different\n";
+  }
+
+  bool success = true;
+  if (modelName == "all" || modelName == "laws") {
+    success &= compare(PrecisionModel::AutopilotLaws, "AutopilotLaws", inFilePath, noCompression, frameCount, topCount, csv);
+  }
+  if (modelName == "all" || modelName == "athr") {
+    success &= compare(PrecisionModel::Autothrust, "Autothrust", inFilePath, noCompression, frameCount, topCount, csv);
+  }
+  if (modelName == "all" || modelName == "fac") {
+    success &= compare(PrecisionModel::FacComputer, "FacComputer", inFilePath, noCompression, frameCount, topCount, csv);
+  }
+
+  return success ? 0 : 1;
+}
@@ -0,0 +1,1265 @@
+#pragma once
+
+// Generated by tools/modelpostprocess/generate_fields.py from the A32NX model types, do not edit.
+//
+// visitFields() calls visitor.field(name, member) for every member of a struct. Each overload is only defined when the
+// model types that declare the struct are included before this header.
+
+#ifdef DEFINED_TYPEDEF_FOR_base_time_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_time& value) {
+  visitor.field("dt", value.dt);
+  visitor.field("simulation_time", value.simulation_time);
+  visitor.field("monotonic_time", value.monotonic_time);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sim_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sim_data& value) {
+  visitor.field("slew_on", value.slew_on);
+  visitor.field("pause_on", value.pause_on);
+  visitor.field("tracking_mode_on_override", value.tracking_mode_on_override);
+  visitor.field("tailstrike_protection_on", value.tailstrike_protection_on);
+  visitor.field("computer_running", value.computer_running);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_discrete_inputs& value) {
+  visitor.field("ground_spoilers_active_1", value.ground_spoilers_active_1);
+  visitor.field("ground_spoilers_active_2", value.ground_spoilers_active_2);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("is_unit_2", value.is_unit_2);
+  visitor.field("opp_axis_pitch_failure", value.opp_axis_pitch_failure);
+  visitor.field("ap_1_disengaged", value.ap_1_disengaged);
+  visitor.field("ap_2_disengaged", value.ap_2_disengaged);
+  visitor.field("opp_left_aileron_lost", value.opp_left_aileron_lost);
+  visitor.field("opp_right_aileron_lost", value.opp_right_aileron_lost);
+  visitor.field("fac_1_yaw_control_lost", value.fac_1_yaw_control_lost);
+  visitor.field("lgciu_1_nose_gear_pressed", value.lgciu_1_nose_gear_pressed);
+  visitor.field("lgciu_2_nose_gear_pressed", value.lgciu_2_nose_gear_pressed);
+  visitor.field("fac_2_yaw_control_lost", value.fac_2_yaw_control_lost);
+  visitor.field("lgciu_1_right_main_gear_pressed", value.lgciu_1_right_main_gear_pressed);
+  visitor.field("lgciu_2_right_main_gear_pressed", value.lgciu_2_right_main_gear_pressed);
+  visitor.field("lgciu_1_left_main_gear_pressed", value.lgciu_1_left_main_gear_pressed);
+  visitor.field("lgciu_2_left_main_gear_pressed", value.lgciu_2_left_main_gear_pressed);
+  visitor.field("ths_motor_fault", value.ths_motor_fault);
+  visitor.field("sfcc_1_slats_out", value.sfcc_1_slats_out);
+  visitor.field("sfcc_2_slats_out", value.sfcc_2_slats_out);
+  visitor.field("l_ail_servo_failed", value.l_ail_servo_failed);
+  visitor.field("l_elev_servo_failed", value.l_elev_servo_failed);
+  visitor.field("r_ail_servo_failed", value.r_ail_servo_failed);
+  visitor.field("r_elev_servo_failed", value.r_elev_servo_failed);
+  visitor.field("ths_override_active", value.ths_override_active);
+  visitor.field("yellow_low_pressure", value.yellow_low_pressure);
+  visitor.field("capt_priority_takeover_pressed", value.capt_priority_takeover_pressed);
+  visitor.field("fo_priority_takeover_pressed", value.fo_priority_takeover_pressed);
+  visitor.field("blue_low_pressure", value.blue_low_pressure);
+  visitor.field("green_low_pressure", value.green_low_pressure);
+  visitor.field("elac_engaged_from_switch", value.elac_engaged_from_switch);
+  visitor.field("normal_powersupply_lost", value.normal_powersupply_lost);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_analog_inputs& value) {
+  visitor.field("capt_pitch_stick_pos", value.capt_pitch_stick_pos);
+  visitor.field("fo_pitch_stick_pos", value.fo_pitch_stick_pos);
+  visitor.field("capt_roll_stick_pos", value.capt_roll_stick_pos);
+  visitor.field("fo_roll_stick_pos", value.fo_roll_stick_pos);
+  visitor.field("left_elevator_pos_deg", value.left_elevator_pos_deg);
+  visitor.field("right_elevator_pos_deg", value.right_elevator_pos_deg);
+  visitor.field("ths_pos_deg", value.ths_pos_deg);
+  visitor.field("left_aileron_pos_deg", value.left_aileron_pos_deg);
+  visitor.field("right_aileron_pos_deg", value.right_aileron_pos_deg);
+  visitor.field("rudder_pedal_pos", value.rudder_pedal_pos);
+  visitor.field("load_factor_acc_1_g", value.load_factor_acc_1_g);
+  visitor.field("load_factor_acc_2_g", value.load_factor_acc_2_g);
+  visitor.field("blue_hyd_pressure_psi", value.blue_hyd_pressure_psi);
+  visitor.field("green_hyd_pressure_psi", value.green_hyd_pressure_psi);
+  visitor.field("yellow_hyd_pressure_psi", value.yellow_hyd_pressure_psi);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_arinc_429_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_arinc_429& value) {
+  visitor.field("SSM", value.SSM);
+  visitor.field("Data", value.Data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_adr_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_adr_bus& value) {
+  visitor.field("altitude_standard_ft", value.altitude_standard_ft);
+  visitor.field("altitude_corrected_ft", value.altitude_corrected_ft);
+  visitor.field("mach", value.mach);
+  visitor.field("airspeed_computed_kn", value.airspeed_computed_kn);
+  visitor.field("airspeed_true_kn", value.airspeed_true_kn);
+  visitor.field("vertical_speed_ft_min", value.vertical_speed_ft_min);
+  visitor.field("aoa_corrected_deg", value.aoa_corrected_deg);
+  visitor.field("corrected_average_static_pressure", value.corrected_average_static_pressure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_ir_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_ir_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("latitude_deg", value.latitude_deg);
+  visitor.field("longitude_deg", value.longitude_deg);
+  visitor.field("ground_speed_kn", value.ground_speed_kn);
+  visitor.field("track_angle_true_deg", value.track_angle_true_deg);
+  visitor.field("heading_true_deg", value.heading_true_deg);
+  visitor.field("wind_speed_kn", value.wind_speed_kn);
+  visitor.field("wind_direction_true_deg", value.wind_direction_true_deg);
+  visitor.field("track_angle_magnetic_deg", value.track_angle_magnetic_deg);
+  visitor.field("heading_magnetic_deg", value.heading_magnetic_deg);
+  visitor.field("drift_angle_deg", value.drift_angle_deg);
+  visitor.field("flight_path_angle_deg", value.flight_path_angle_deg);
+  visitor.field("flight_path_accel_g", value.flight_path_accel_g);
+  visitor.field("pitch_angle_deg", value.pitch_angle_deg);
+  visitor.field("roll_angle_deg", value.roll_angle_deg);
+  visitor.field("body_pitch_rate_deg_s", value.body_pitch_rate_deg_s);
+  visitor.field("body_roll_rate_deg_s", value.body_roll_rate_deg_s);
+  visitor.field("body_yaw_rate_deg_s", value.body_yaw_rate_deg_s);
+  visitor.field("body_long_accel_g", value.body_long_accel_g);
+  visitor.field("body_lat_accel_g", value.body_lat_accel_g);
+  visitor.field("body_normal_accel_g", value.body_normal_accel_g);
+  visitor.field("track_angle_rate_deg_s", value.track_angle_rate_deg_s);
+  visitor.field("pitch_att_rate_deg_s", value.pitch_att_rate_deg_s);
+  visitor.field("roll_att_rate_deg_s", value.roll_att_rate_deg_s);
+  visitor.field("inertial_alt_ft", value.inertial_alt_ft);
+  visitor.field("along_track_horiz_acc_g", value.along_track_horiz_acc_g);
+  visitor.field("cross_track_horiz_acc_g", value.cross_track_horiz_acc_g);
+  visitor.field("vertical_accel_g", value.vertical_accel_g);
+  visitor.field("inertial_vertical_speed_ft_s", value.inertial_vertical_speed_ft_s);
+  visitor.field("north_south_velocity_kn", value.north_south_velocity_kn);
+  visitor.field("east_west_velocity_kn", value.east_west_velocity_kn);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fmgc_b_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fmgc_b_bus& value) {
+  visitor.field("fac_weight_lbs", value.fac_weight_lbs);
+  visitor.field("fm_weight_lbs", value.fm_weight_lbs);
+  visitor.field("fac_cg_percent", value.fac_cg_percent);
+  visitor.field("fm_cg_percent", value.fm_cg_percent);
+  visitor.field("fg_radio_height_ft", value.fg_radio_height_ft);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("ats_discrete_word", value.ats_discrete_word);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("approach_spd_target_kn", value.approach_spd_target_kn);
+  visitor.field("delta_p_ail_cmd_deg", value.delta_p_ail_cmd_deg);
+  visitor.field("delta_p_splr_cmd_deg", value.delta_p_splr_cmd_deg);
+  visitor.field("delta_r_cmd_deg", value.delta_r_cmd_deg);
+  visitor.field("delta_nose_wheel_cmd_deg", value.delta_nose_wheel_cmd_deg);
+  visitor.field("delta_q_cmd_deg", value.delta_q_cmd_deg);
+  visitor.field("n1_left_percent", value.n1_left_percent);
+  visitor.field("n1_right_percent", value.n1_right_percent);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_ra_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_ra_bus& value) {
+  visitor.field("radio_height_ft", value.radio_height_ft);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sfcc_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sfcc_bus& value) {
+  visitor.field("slat_flap_component_status_word", value.slat_flap_component_status_word);
+  visitor.field("slat_flap_system_status_word", value.slat_flap_system_status_word);
+  visitor.field("slat_flap_actual_position_word", value.slat_flap_actual_position_word);
+  visitor.field("slat_actual_position_deg", value.slat_actual_position_deg);
+  visitor.field("flap_actual_position_deg", value.flap_actual_position_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fcdc_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fcdc_bus& value) {
+  visitor.field("efcs_status_word_1", value.efcs_status_word_1);
+  visitor.field("efcs_status_word_2", value.efcs_status_word_2);
+  visitor.field("efcs_status_word_3", value.efcs_status_word_3);
+  visitor.field("efcs_status_word_4", value.efcs_status_word_4);
+  visitor.field("efcs_status_word_5", value.efcs_status_word_5);
+  visitor.field("capt_roll_command_deg", value.capt_roll_command_deg);
+  visitor.field("fo_roll_command_deg", value.fo_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("capt_pitch_command_deg", value.capt_pitch_command_deg);
+  visitor.field("fo_pitch_command_deg", value.fo_pitch_command_deg);
+  visitor.field("aileron_left_pos_deg", value.aileron_left_pos_deg);
+  visitor.field("elevator_left_pos_deg", value.elevator_left_pos_deg);
+  visitor.field("aileron_right_pos_deg", value.aileron_right_pos_deg);
+  visitor.field("elevator_right_pos_deg", value.elevator_right_pos_deg);
+  visitor.field("horiz_stab_trim_pos_deg", value.horiz_stab_trim_pos_deg);
+  visitor.field("spoiler_1_left_pos_deg", value.spoiler_1_left_pos_deg);
+  visitor.field("spoiler_2_left_pos_deg", value.spoiler_2_left_pos_deg);
+  visitor.field("spoiler_3_left_pos_deg", value.spoiler_3_left_pos_deg);
+  visitor.field("spoiler_4_left_pos_deg", value.spoiler_4_left_pos_deg);
+  visitor.field("spoiler_5_left_pos_deg", value.spoiler_5_left_pos_deg);
+  visitor.field("spoiler_1_right_pos_deg", value.spoiler_1_right_pos_deg);
+  visitor.field("spoiler_2_right_pos_deg", value.spoiler_2_right_pos_deg);
+  visitor.field("spoiler_3_right_pos_deg", value.spoiler_3_right_pos_deg);
+  visitor.field("spoiler_4_right_pos_deg", value.spoiler_4_right_pos_deg);
+  visitor.field("spoiler_5_right_pos_deg", value.spoiler_5_right_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_out_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_out_bus& value) {
+  visitor.field("left_spoiler_1_position_deg", value.left_spoiler_1_position_deg);
+  visitor.field("right_spoiler_1_position_deg", value.right_spoiler_1_position_deg);
+  visitor.field("left_spoiler_2_position_deg", value.left_spoiler_2_position_deg);
+  visitor.field("right_spoiler_2_position_deg", value.right_spoiler_2_position_deg);
+  visitor.field("left_elevator_position_deg", value.left_elevator_position_deg);
+  visitor.field("right_elevator_position_deg", value.right_elevator_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("speed_brake_lever_command_deg", value.speed_brake_lever_command_deg);
+  visitor.field("speed_brake_command_deg", value.speed_brake_command_deg);
+  visitor.field("thrust_lever_angle_1_deg", value.thrust_lever_angle_1_deg);
+  visitor.field("thrust_lever_angle_2_deg", value.thrust_lever_angle_2_deg);
+  visitor.field("discrete_status_word_1", value.discrete_status_word_1);
+  visitor.field("discrete_status_word_2", value.discrete_status_word_2);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_out_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_out_bus& value) {
+  visitor.field("left_aileron_position_deg", value.left_aileron_position_deg);
+  visitor.field("right_aileron_position_deg", value.right_aileron_position_deg);
+  visitor.field("left_elevator_position_deg", value.left_elevator_position_deg);
+  visitor.field("right_elevator_position_deg", value.right_elevator_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_command_deg", value.aileron_command_deg);
+  visitor.field("roll_spoiler_command_deg", value.roll_spoiler_command_deg);
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("elevator_double_pressurization_command_deg", value.elevator_double_pressurization_command_deg);
+  visitor.field("speedbrake_extension_deg", value.speedbrake_extension_deg);
+  visitor.field("discrete_status_word_1", value.discrete_status_word_1);
+  visitor.field("discrete_status_word_2", value.discrete_status_word_2);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_bus_inputs& value) {
+  visitor.field("adr_1_bus", value.adr_1_bus);
+  visitor.field("adr_2_bus", value.adr_2_bus);
+  visitor.field("adr_3_bus", value.adr_3_bus);
+  visitor.field("ir_1_bus", value.ir_1_bus);
+  visitor.field("ir_2_bus", value.ir_2_bus);
+  visitor.field("ir_3_bus", value.ir_3_bus);
+  visitor.field("fmgc_1_bus", value.fmgc_1_bus);
+  visitor.field("fmgc_2_bus", value.fmgc_2_bus);
+  visitor.field("ra_1_bus", value.ra_1_bus);
+  visitor.field("ra_2_bus", value.ra_2_bus);
+  visitor.field("sfcc_1_bus", value.sfcc_1_bus);
+  visitor.field("sfcc_2_bus", value.sfcc_2_bus);
+  visitor.field("fcdc_1_bus", value.fcdc_1_bus);
+  visitor.field("fcdc_2_bus", value.fcdc_2_bus);
+  visitor.field("sec_1_bus", value.sec_1_bus);
+  visitor.field("sec_2_bus", value.sec_2_bus);
+  visitor.field("elac_opp_bus", value.elac_opp_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_elac_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, elac_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_lateral_law_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_lateral_law_outputs& value) {
+  visitor.field("left_aileron_command_deg", value.left_aileron_command_deg);
+  visitor.field("right_aileron_command_deg", value.right_aileron_command_deg);
+  visitor.field("roll_spoiler_command_deg", value.roll_spoiler_command_deg);
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_pitch_law_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_pitch_law_outputs& value) {
+  visitor.field("elevator_command_deg", value.elevator_command_deg);
+  visitor.field("ths_command_deg", value.ths_command_deg);
+  visitor.field("elevator_double_pressurization_active", value.elevator_double_pressurization_active);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_laws_outputs& value) {
+  visitor.field("lateral_law_outputs", value.lateral_law_outputs);
+  visitor.field("pitch_law_outputs", value.pitch_law_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_adr_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_adr_computation_data& value) {
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("alpha_deg", value.alpha_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_ir_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_ir_computation_data& value) {
+  visitor.field("theta_deg", value.theta_deg);
+  visitor.field("phi_deg", value.phi_deg);
+  visitor.field("q_deg_s", value.q_deg_s);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("n_x_g", value.n_x_g);
+  visitor.field("n_y_g", value.n_y_g);
+  visitor.field("n_z_g", value.n_z_g);
+  visitor.field("theta_dot_deg_s", value.theta_dot_deg_s);
+  visitor.field("phi_dot_deg_s", value.phi_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_logic_outputs& value) {
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("pitch_law_in_flight", value.pitch_law_in_flight);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("lateral_law_capability", value.lateral_law_capability);
+  visitor.field("active_lateral_law", value.active_lateral_law);
+  visitor.field("pitch_law_capability", value.pitch_law_capability);
+  visitor.field("active_pitch_law", value.active_pitch_law);
+  visitor.field("abnormal_condition_law_active", value.abnormal_condition_law_active);
+  visitor.field("is_engaged_in_pitch", value.is_engaged_in_pitch);
+  visitor.field("can_engage_in_pitch", value.can_engage_in_pitch);
+  visitor.field("has_priority_in_pitch", value.has_priority_in_pitch);
+  visitor.field("left_elevator_avail", value.left_elevator_avail);
+  visitor.field("right_elevator_avail", value.right_elevator_avail);
+  visitor.field("ths_avail", value.ths_avail);
+  visitor.field("ths_active_commanded", value.ths_active_commanded);
+  visitor.field("ths_ground_setting_active", value.ths_ground_setting_active);
+  visitor.field("is_engaged_in_roll", value.is_engaged_in_roll);
+  visitor.field("can_engage_in_roll", value.can_engage_in_roll);
+  visitor.field("has_priority_in_roll", value.has_priority_in_roll);
+  visitor.field("left_aileron_crosscommand_active", value.left_aileron_crosscommand_active);
+  visitor.field("right_aileron_crosscommand_active", value.right_aileron_crosscommand_active);
+  visitor.field("left_aileron_avail", value.left_aileron_avail);
+  visitor.field("right_aileron_avail", value.right_aileron_avail);
+  visitor.field("aileron_droop_active", value.aileron_droop_active);
+  visitor.field("aileron_antidroop_active", value.aileron_antidroop_active);
+  visitor.field("is_yellow_hydraulic_power_avail", value.is_yellow_hydraulic_power_avail);
+  visitor.field("is_blue_hydraulic_power_avail", value.is_blue_hydraulic_power_avail);
+  visitor.field("is_green_hydraulic_power_avail", value.is_green_hydraulic_power_avail);
+  visitor.field("left_sidestick_disabled", value.left_sidestick_disabled);
+  visitor.field("right_sidestick_disabled", value.right_sidestick_disabled);
+  visitor.field("left_sidestick_priority_locked", value.left_sidestick_priority_locked);
+  visitor.field("right_sidestick_priority_locked", value.right_sidestick_priority_locked);
+  visitor.field("total_sidestick_pitch_command", value.total_sidestick_pitch_command);
+  visitor.field("total_sidestick_roll_command", value.total_sidestick_roll_command);
+  visitor.field("ap_authorised", value.ap_authorised);
+  visitor.field("protection_ap_disconnect", value.protection_ap_disconnect);
+  visitor.field("high_alpha_prot_active", value.high_alpha_prot_active);
+  visitor.field("alpha_prot_deg", value.alpha_prot_deg);
+  visitor.field("alpha_max_deg", value.alpha_max_deg);
+  visitor.field("high_speed_prot_active", value.high_speed_prot_active);
+  visitor.field("high_speed_prot_lo_thresh_kn", value.high_speed_prot_lo_thresh_kn);
+  visitor.field("high_speed_prot_hi_thresh_kn", value.high_speed_prot_hi_thresh_kn);
+  visitor.field("double_adr_failure", value.double_adr_failure);
+  visitor.field("triple_adr_failure", value.triple_adr_failure);
+  visitor.field("cas_or_mach_disagree", value.cas_or_mach_disagree);
+  visitor.field("alpha_disagree", value.alpha_disagree);
+  visitor.field("double_ir_failure", value.double_ir_failure);
+  visitor.field("triple_ir_failure", value.triple_ir_failure);
+  visitor.field("ir_failure_not_self_detected", value.ir_failure_not_self_detected);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+  visitor.field("ra_computation_data_ft", value.ra_computation_data_ft);
+  visitor.field("dual_ra_failure", value.dual_ra_failure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_discrete_outputs& value) {
+  visitor.field("pitch_axis_ok", value.pitch_axis_ok);
+  visitor.field("left_aileron_ok", value.left_aileron_ok);
+  visitor.field("right_aileron_ok", value.right_aileron_ok);
+  visitor.field("digital_output_validated", value.digital_output_validated);
+  visitor.field("ap_1_authorised", value.ap_1_authorised);
+  visitor.field("ap_2_authorised", value.ap_2_authorised);
+  visitor.field("left_aileron_active_mode", value.left_aileron_active_mode);
+  visitor.field("right_aileron_active_mode", value.right_aileron_active_mode);
+  visitor.field("left_elevator_damping_mode", value.left_elevator_damping_mode);
+  visitor.field("right_elevator_damping_mode", value.right_elevator_damping_mode);
+  visitor.field("ths_active", value.ths_active);
+  visitor.field("batt_power_supply", value.batt_power_supply);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_analog_outputs& value) {
+  visitor.field("left_elev_pos_order_deg", value.left_elev_pos_order_deg);
+  visitor.field("right_elev_pos_order_deg", value.right_elev_pos_order_deg);
+  visitor.field("ths_pos_order", value.ths_pos_order);
+  visitor.field("left_aileron_pos_order", value.left_aileron_pos_order);
+  visitor.field("right_aileron_pos_order", value.right_aileron_pos_order);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_elac_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, elac_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_roll_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_roll_output& value) {
+  visitor.field("xi_deg", value.xi_deg);
+  visitor.field("zeta_deg", value.zeta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_lateral_direct_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, lateral_direct_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("delta_xi_pos", value.delta_xi_pos);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_lateral_normal_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, lateral_normal_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("pk_deg_s", value.pk_deg_s);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("delta_xi_pos", value.delta_xi_pos);
+  visitor.field("delta_zeta_pos", value.delta_zeta_pos);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("high_aoa_prot_active", value.high_aoa_prot_active);
+  visitor.field("high_speed_prot_active", value.high_speed_prot_active);
+  visitor.field("ap_phi_c_deg", value.ap_phi_c_deg);
+  visitor.field("ap_beta_c_deg", value.ap_beta_c_deg);
+  visitor.field("any_ap_engaged", value.any_ap_engaged);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_roll_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_roll_data_computed& value) {
+  visitor.field("delta_xi_deg", value.delta_xi_deg);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("in_flight_gain", value.in_flight_gain);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_roll_normal_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_roll_normal& value) {
+  visitor.field("pk_c_deg_s", value.pk_c_deg_s);
+  visitor.field("Phi_c_deg", value.Phi_c_deg);
+  visitor.field("xi_deg", value.xi_deg);
+  visitor.field("zeta_deg", value.zeta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_pitch_alternate_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, pitch_alternate_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("nz_g", value.nz_g);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("qk_deg_s", value.qk_deg_s);
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("eta_trim_deg", value.eta_trim_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("CG_percent_MAC", value.CG_percent_MAC);
+  visitor.field("total_weight_kg", value.total_weight_kg);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("spoilers_left_pos", value.spoilers_left_pos);
+  visitor.field("spoilers_right_pos", value.spoilers_right_pos);
+  visitor.field("delta_eta_pos", value.delta_eta_pos);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("stabilities_available", value.stabilities_available);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_output& value) {
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("eta_trim_dot_deg_s", value.eta_trim_dot_deg_s);
+  visitor.field("eta_trim_limit_lo", value.eta_trim_limit_lo);
+  visitor.field("eta_trim_limit_up", value.eta_trim_limit_up);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_alternate_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_alternate_data_computed& value) {
+  visitor.field("eta_trim_deg_limit_lo", value.eta_trim_deg_limit_lo);
+  visitor.field("eta_trim_deg_limit_up", value.eta_trim_deg_limit_up);
+  visitor.field("delta_eta_deg", value.delta_eta_deg);
+  visitor.field("nz_limit_up_g", value.nz_limit_up_g);
+  visitor.field("nz_limit_lo_g", value.nz_limit_lo_g);
+  visitor.field("eta_trim_deg_should_freeze", value.eta_trim_deg_should_freeze);
+  visitor.field("eta_trim_deg_reset", value.eta_trim_deg_reset);
+  visitor.field("eta_trim_deg_reset_deg", value.eta_trim_deg_reset_deg);
+  visitor.field("eta_trim_deg_should_write", value.eta_trim_deg_should_write);
+  visitor.field("eta_trim_deg_rate_limit_up_deg_s", value.eta_trim_deg_rate_limit_up_deg_s);
+  visitor.field("eta_trim_deg_rate_limit_lo_deg_s", value.eta_trim_deg_rate_limit_lo_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_normal_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_normal& value) {
+  visitor.field("nz_c_g", value.nz_c_g);
+  visitor.field("Cstar_g", value.Cstar_g);
+  visitor.field("protection_alpha_c_deg", value.protection_alpha_c_deg);
+  visitor.field("protection_V_c_kn", value.protection_V_c_kn);
+  visitor.field("eta_dot_deg_s", value.eta_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_law_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_law_output& value) {
+  visitor.field("eta_dot_deg_s", value.eta_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_integrated_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_integrated& value) {
+  visitor.field("eta_deg", value.eta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_pitch_direct_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, pitch_direct_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("delta_eta_pos", value.delta_eta_pos);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_pitch_normal_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, pitch_normal_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("nz_g", value.nz_g);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("qk_deg_s", value.qk_deg_s);
+  visitor.field("qk_dot_deg_s2", value.qk_dot_deg_s2);
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("eta_trim_deg", value.eta_trim_deg);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("CG_percent_MAC", value.CG_percent_MAC);
+  visitor.field("total_weight_kg", value.total_weight_kg);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("spoilers_left_pos", value.spoilers_left_pos);
+  visitor.field("spoilers_right_pos", value.spoilers_right_pos);
+  visitor.field("thrust_lever_1_pos", value.thrust_lever_1_pos);
+  visitor.field("thrust_lever_2_pos", value.thrust_lever_2_pos);
+  visitor.field("tailstrike_protection_on", value.tailstrike_protection_on);
+  visitor.field("VLS_kn", value.VLS_kn);
+  visitor.field("delta_eta_pos", value.delta_eta_pos);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("high_aoa_prot_active", value.high_aoa_prot_active);
+  visitor.field("high_speed_prot_active", value.high_speed_prot_active);
+  visitor.field("alpha_prot", value.alpha_prot);
+  visitor.field("alpha_max", value.alpha_max);
+  visitor.field("high_speed_prot_high_kn", value.high_speed_prot_high_kn);
+  visitor.field("high_speed_prot_low_kn", value.high_speed_prot_low_kn);
+  visitor.field("ap_theta_c_deg", value.ap_theta_c_deg);
+  visitor.field("any_ap_engaged", value.any_ap_engaged);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_data_computed& value) {
+  visitor.field("eta_trim_deg_limit_lo", value.eta_trim_deg_limit_lo);
+  visitor.field("eta_trim_deg_limit_up", value.eta_trim_deg_limit_up);
+  visitor.field("delta_eta_deg", value.delta_eta_deg);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("in_rotation", value.in_rotation);
+  visitor.field("in_flare", value.in_flare);
+  visitor.field("in_flight_gain", value.in_flight_gain);
+  visitor.field("in_rotation_gain", value.in_rotation_gain);
+  visitor.field("nz_limit_up_g", value.nz_limit_up_g);
+  visitor.field("nz_limit_lo_g", value.nz_limit_lo_g);
+  visitor.field("eta_trim_deg_should_freeze", value.eta_trim_deg_should_freeze);
+  visitor.field("eta_trim_deg_reset", value.eta_trim_deg_reset);
+  visitor.field("eta_trim_deg_reset_deg", value.eta_trim_deg_reset_deg);
+  visitor.field("eta_trim_deg_should_write", value.eta_trim_deg_should_write);
+  visitor.field("eta_trim_deg_rate_limit_up_deg_s", value.eta_trim_deg_rate_limit_up_deg_s);
+  visitor.field("eta_trim_deg_rate_limit_lo_deg_s", value.eta_trim_deg_rate_limit_lo_deg_s);
+  visitor.field("flare_Theta_deg", value.flare_Theta_deg);
+  visitor.field("flare_Theta_c_deg", value.flare_Theta_c_deg);
+  visitor.field("flare_Theta_c_rate_deg_s", value.flare_Theta_c_rate_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_rotation_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_rotation& value) {
+  visitor.field("qk_c_deg_s", value.qk_c_deg_s);
+  visitor.field("eta_deg", value.eta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_AS8ihRtYtxSipjDCqtVGCE_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_AS8ihRtYtxSipjDCqtVGCE& value) {
+  visitor.field("elevator_command_deg", value.elevator_command_deg);
+  visitor.field("ths_command_deg", value.ths_command_deg);
+  visitor.field("elevator_double_pressurization_active", value.elevator_double_pressurization_active);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_DGJtjwcHjMwSjtoGHgU8YD_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_DGJtjwcHjMwSjtoGHgU8YD& value) {
+  visitor.field("lateral_law_outputs", value.lateral_law_outputs);
+  visitor.field("pitch_law_outputs", value.pitch_law_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_2OohiAWrazWy5wDS5iisgF_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_2OohiAWrazWy5wDS5iisgF& value) {
+  visitor.field("SSM", value.SSM);
+  visitor.field("Data", value.Data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_Xd8GY38siv3zt9dPGmymPF_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_Xd8GY38siv3zt9dPGmymPF& value) {
+  visitor.field("left_aileron_position_deg", value.left_aileron_position_deg);
+  visitor.field("right_aileron_position_deg", value.right_aileron_position_deg);
+  visitor.field("left_elevator_position_deg", value.left_elevator_position_deg);
+  visitor.field("right_elevator_position_deg", value.right_elevator_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_command_deg", value.aileron_command_deg);
+  visitor.field("roll_spoiler_command_deg", value.roll_spoiler_command_deg);
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("elevator_double_pressurization_command_deg", value.elevator_double_pressurization_command_deg);
+  visitor.field("speedbrake_extension_deg", value.speedbrake_extension_deg);
+  visitor.field("discrete_status_word_1", value.discrete_status_word_1);
+  visitor.field("discrete_status_word_2", value.discrete_status_word_2);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_discrete_inputs& value) {
+  visitor.field("sec_engaged_from_switch", value.sec_engaged_from_switch);
+  visitor.field("sec_in_emergency_powersupply", value.sec_in_emergency_powersupply);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("is_unit_2", value.is_unit_2);
+  visitor.field("is_unit_3", value.is_unit_3);
+  visitor.field("pitch_not_avail_elac_1", value.pitch_not_avail_elac_1);
+  visitor.field("pitch_not_avail_elac_2", value.pitch_not_avail_elac_2);
+  visitor.field("left_elev_not_avail_sec_opp", value.left_elev_not_avail_sec_opp);
+  visitor.field("digital_output_failed_elac_1", value.digital_output_failed_elac_1);
+  visitor.field("right_elev_not_avail_sec_opp", value.right_elev_not_avail_sec_opp);
+  visitor.field("green_low_pressure", value.green_low_pressure);
+  visitor.field("blue_low_pressure", value.blue_low_pressure);
+  visitor.field("yellow_low_pressure", value.yellow_low_pressure);
+  visitor.field("sfcc_1_slats_out", value.sfcc_1_slats_out);
+  visitor.field("sfcc_2_slats_out", value.sfcc_2_slats_out);
+  visitor.field("digital_output_failed_elac_2", value.digital_output_failed_elac_2);
+  visitor.field("ths_motor_fault", value.ths_motor_fault);
+  visitor.field("l_elev_servo_failed", value.l_elev_servo_failed);
+  visitor.field("r_elev_servo_failed", value.r_elev_servo_failed);
+  visitor.field("l_spoiler_1_servo_failed", value.l_spoiler_1_servo_failed);
+  visitor.field("r_spoiler_1_servo_failed", value.r_spoiler_1_servo_failed);
+  visitor.field("l_spoiler_2_servo_failed", value.l_spoiler_2_servo_failed);
+  visitor.field("r_spoiler_2_servo_failed", value.r_spoiler_2_servo_failed);
+  visitor.field("ths_override_active", value.ths_override_active);
+  visitor.field("capt_priority_takeover_pressed", value.capt_priority_takeover_pressed);
+  visitor.field("fo_priority_takeover_pressed", value.fo_priority_takeover_pressed);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_analog_inputs& value) {
+  visitor.field("capt_pitch_stick_pos", value.capt_pitch_stick_pos);
+  visitor.field("fo_pitch_stick_pos", value.fo_pitch_stick_pos);
+  visitor.field("capt_roll_stick_pos", value.capt_roll_stick_pos);
+  visitor.field("fo_roll_stick_pos", value.fo_roll_stick_pos);
+  visitor.field("spd_brk_lever_pos", value.spd_brk_lever_pos);
+  visitor.field("thr_lever_1_pos", value.thr_lever_1_pos);
+  visitor.field("thr_lever_2_pos", value.thr_lever_2_pos);
+  visitor.field("left_elevator_pos_deg", value.left_elevator_pos_deg);
+  visitor.field("right_elevator_pos_deg", value.right_elevator_pos_deg);
+  visitor.field("ths_pos_deg", value.ths_pos_deg);
+  visitor.field("left_spoiler_1_pos_deg", value.left_spoiler_1_pos_deg);
+  visitor.field("right_spoiler_1_pos_deg", value.right_spoiler_1_pos_deg);
+  visitor.field("left_spoiler_2_pos_deg", value.left_spoiler_2_pos_deg);
+  visitor.field("right_spoiler_2_pos_deg", value.right_spoiler_2_pos_deg);
+  visitor.field("load_factor_acc_1_g", value.load_factor_acc_1_g);
+  visitor.field("load_factor_acc_2_g", value.load_factor_acc_2_g);
+  visitor.field("wheel_speed_left", value.wheel_speed_left);
+  visitor.field("wheel_speed_right", value.wheel_speed_right);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_lgciu_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_lgciu_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_bus_inputs& value) {
+  visitor.field("adr_1_bus", value.adr_1_bus);
+  visitor.field("adr_2_bus", value.adr_2_bus);
+  visitor.field("ir_1_bus", value.ir_1_bus);
+  visitor.field("ir_2_bus", value.ir_2_bus);
+  visitor.field("elac_1_bus", value.elac_1_bus);
+  visitor.field("fcdc_1_bus", value.fcdc_1_bus);
+  visitor.field("fcdc_2_bus", value.fcdc_2_bus);
+  visitor.field("elac_2_bus", value.elac_2_bus);
+  visitor.field("sfcc_1_bus", value.sfcc_1_bus);
+  visitor.field("sfcc_2_bus", value.sfcc_2_bus);
+  visitor.field("lgciu_1_bus", value.lgciu_1_bus);
+  visitor.field("lgciu_2_bus", value.lgciu_2_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_sec_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, sec_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_lateral_law_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_lateral_law_outputs& value) {
+  visitor.field("left_spoiler_1_command_deg", value.left_spoiler_1_command_deg);
+  visitor.field("right_spoiler_1_command_deg", value.right_spoiler_1_command_deg);
+  visitor.field("left_spoiler_2_command_deg", value.left_spoiler_2_command_deg);
+  visitor.field("right_spoiler_2_command_deg", value.right_spoiler_2_command_deg);
+  visitor.field("speedbrake_command_deg", value.speedbrake_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_pitch_law_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_pitch_law_outputs& value) {
+  visitor.field("elevator_command_deg", value.elevator_command_deg);
+  visitor.field("ths_command_deg", value.ths_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_laws_outputs& value) {
+  visitor.field("lateral_law_outputs", value.lateral_law_outputs);
+  visitor.field("pitch_law_outputs", value.pitch_law_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_adr_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_adr_computation_data& value) {
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("alpha_deg", value.alpha_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_ir_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_ir_computation_data& value) {
+  visitor.field("theta_deg", value.theta_deg);
+  visitor.field("phi_deg", value.phi_deg);
+  visitor.field("q_deg_s", value.q_deg_s);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("n_x_g", value.n_x_g);
+  visitor.field("n_y_g", value.n_y_g);
+  visitor.field("n_z_g", value.n_z_g);
+  visitor.field("theta_dot_deg_s", value.theta_dot_deg_s);
+  visitor.field("phi_dot_deg_s", value.phi_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_logic_outputs& value) {
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("pitch_law_in_flight", value.pitch_law_in_flight);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("pitch_law_capability", value.pitch_law_capability);
+  visitor.field("active_pitch_law", value.active_pitch_law);
+  visitor.field("abnormal_condition_law_active", value.abnormal_condition_law_active);
+  visitor.field("is_engaged_in_pitch", value.is_engaged_in_pitch);
+  visitor.field("can_engage_in_pitch", value.can_engage_in_pitch);
+  visitor.field("has_priority_in_pitch", value.has_priority_in_pitch);
+  visitor.field("left_elevator_avail", value.left_elevator_avail);
+  visitor.field("right_elevator_avail", value.right_elevator_avail);
+  visitor.field("ths_avail", value.ths_avail);
+  visitor.field("ths_active_commanded", value.ths_active_commanded);
+  visitor.field("ths_ground_setting_active", value.ths_ground_setting_active);
+  visitor.field("is_engaged_in_roll", value.is_engaged_in_roll);
+  visitor.field("spoiler_pair_1_avail", value.spoiler_pair_1_avail);
+  visitor.field("spoiler_pair_2_avail", value.spoiler_pair_2_avail);
+  visitor.field("is_yellow_hydraulic_power_avail", value.is_yellow_hydraulic_power_avail);
+  visitor.field("is_blue_hydraulic_power_avail", value.is_blue_hydraulic_power_avail);
+  visitor.field("is_green_hydraulic_power_avail", value.is_green_hydraulic_power_avail);
+  visitor.field("left_sidestick_disabled", value.left_sidestick_disabled);
+  visitor.field("right_sidestick_disabled", value.right_sidestick_disabled);
+  visitor.field("left_sidestick_priority_locked", value.left_sidestick_priority_locked);
+  visitor.field("right_sidestick_priority_locked", value.right_sidestick_priority_locked);
+  visitor.field("total_sidestick_pitch_command", value.total_sidestick_pitch_command);
+  visitor.field("total_sidestick_roll_command", value.total_sidestick_roll_command);
+  visitor.field("ground_spoilers_armed", value.ground_spoilers_armed);
+  visitor.field("ground_spoilers_out", value.ground_spoilers_out);
+  visitor.field("partial_lift_dumping_active", value.partial_lift_dumping_active);
+  visitor.field("speed_brake_inhibited", value.speed_brake_inhibited);
+  visitor.field("single_adr_failure", value.single_adr_failure);
+  visitor.field("double_adr_failure", value.double_adr_failure);
+  visitor.field("cas_or_mach_disagree", value.cas_or_mach_disagree);
+  visitor.field("alpha_disagree", value.alpha_disagree);
+  visitor.field("single_ir_failure", value.single_ir_failure);
+  visitor.field("double_ir_failure", value.double_ir_failure);
+  visitor.field("ir_disagree", value.ir_disagree);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+  visitor.field("any_landing_gear_not_uplocked", value.any_landing_gear_not_uplocked);
+  visitor.field("lgciu_uplock_disagree_or_fault", value.lgciu_uplock_disagree_or_fault);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_discrete_outputs& value) {
+  visitor.field("thr_reverse_selected", value.thr_reverse_selected);
+  visitor.field("left_elevator_ok", value.left_elevator_ok);
+  visitor.field("right_elevator_ok", value.right_elevator_ok);
+  visitor.field("ground_spoiler_out", value.ground_spoiler_out);
+  visitor.field("sec_failed", value.sec_failed);
+  visitor.field("left_elevator_damping_mode", value.left_elevator_damping_mode);
+  visitor.field("right_elevator_damping_mode", value.right_elevator_damping_mode);
+  visitor.field("ths_active", value.ths_active);
+  visitor.field("batt_power_supply", value.batt_power_supply);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_analog_outputs& value) {
+  visitor.field("left_elev_pos_order_deg", value.left_elev_pos_order_deg);
+  visitor.field("right_elev_pos_order_deg", value.right_elev_pos_order_deg);
+  visitor.field("ths_pos_order_deg", value.ths_pos_order_deg);
+  visitor.field("left_spoiler_1_pos_order_deg", value.left_spoiler_1_pos_order_deg);
+  visitor.field("right_spoiler_1_pos_order_deg", value.right_spoiler_1_pos_order_deg);
+  visitor.field("left_spoiler_2_pos_order_deg", value.left_spoiler_2_pos_order_deg);
+  visitor.field("right_spoiler_2_pos_order_deg", value.right_spoiler_2_pos_order_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_sec_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, sec_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_tXqQxauZPGP7M6uUMzLxgB_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_tXqQxauZPGP7M6uUMzLxgB& value) {
+  visitor.field("left_spoiler_1_position_deg", value.left_spoiler_1_position_deg);
+  visitor.field("right_spoiler_1_position_deg", value.right_spoiler_1_position_deg);
+  visitor.field("left_spoiler_2_position_deg", value.left_spoiler_2_position_deg);
+  visitor.field("right_spoiler_2_position_deg", value.right_spoiler_2_position_deg);
+  visitor.field("left_elevator_position_deg", value.left_elevator_position_deg);
+  visitor.field("right_elevator_position_deg", value.right_elevator_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("speed_brake_lever_command_deg", value.speed_brake_lever_command_deg);
+  visitor.field("speed_brake_command_deg", value.speed_brake_command_deg);
+  visitor.field("thrust_lever_angle_1_deg", value.thrust_lever_angle_1_deg);
+  visitor.field("thrust_lever_angle_2_deg", value.thrust_lever_angle_2_deg);
+  visitor.field("discrete_status_word_1", value.discrete_status_word_1);
+  visitor.field("discrete_status_word_2", value.discrete_status_word_2);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_discrete_inputs& value) {
+  visitor.field("ap_own_engaged", value.ap_own_engaged);
+  visitor.field("ap_opp_engaged", value.ap_opp_engaged);
+  visitor.field("yaw_damper_opp_engaged", value.yaw_damper_opp_engaged);
+  visitor.field("rudder_trim_opp_engaged", value.rudder_trim_opp_engaged);
+  visitor.field("rudder_travel_lim_opp_engaged", value.rudder_travel_lim_opp_engaged);
+  visitor.field("elac_1_healthy", value.elac_1_healthy);
+  visitor.field("elac_2_healthy", value.elac_2_healthy);
+  visitor.field("engine_1_stopped", value.engine_1_stopped);
+  visitor.field("engine_2_stopped", value.engine_2_stopped);
+  visitor.field("rudder_trim_switch_left", value.rudder_trim_switch_left);
+  visitor.field("rudder_trim_switch_right", value.rudder_trim_switch_right);
+  visitor.field("rudder_trim_reset_button", value.rudder_trim_reset_button);
+  visitor.field("fac_engaged_from_switch", value.fac_engaged_from_switch);
+  visitor.field("fac_opp_healthy", value.fac_opp_healthy);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("rudder_trim_actuator_healthy", value.rudder_trim_actuator_healthy);
+  visitor.field("rudder_travel_lim_actuator_healthy", value.rudder_travel_lim_actuator_healthy);
+  visitor.field("slats_extended", value.slats_extended);
+  visitor.field("nose_gear_pressed", value.nose_gear_pressed);
+  visitor.field("ir_3_switch", value.ir_3_switch);
+  visitor.field("adr_3_switch", value.adr_3_switch);
+  visitor.field("yaw_damper_has_hyd_press", value.yaw_damper_has_hyd_press);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_analog_inputs& value) {
+  visitor.field("yaw_damper_position_deg", value.yaw_damper_position_deg);
+  visitor.field("rudder_trim_position_deg", value.rudder_trim_position_deg);
+  visitor.field("rudder_travel_lim_position_deg", value.rudder_travel_lim_position_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("gamma_a_deg", value.gamma_a_deg);
+  visitor.field("gamma_t_deg", value.gamma_t_deg);
+  visitor.field("total_weight_lbs", value.total_weight_lbs);
+  visitor.field("center_of_gravity_pos_percent", value.center_of_gravity_pos_percent);
+  visitor.field("sideslip_target_deg", value.sideslip_target_deg);
+  visitor.field("fac_slat_angle_deg", value.fac_slat_angle_deg);
+  visitor.field("fac_flap_angle", value.fac_flap_angle);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("rudder_travel_limit_command_deg", value.rudder_travel_limit_command_deg);
+  visitor.field("delta_r_yaw_damper_deg", value.delta_r_yaw_damper_deg);
+  visitor.field("estimated_sideslip_deg", value.estimated_sideslip_deg);
+  visitor.field("v_alpha_lim_kn", value.v_alpha_lim_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("speed_trend_kn", value.speed_trend_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("discrete_word_5", value.discrete_word_5);
+  visitor.field("delta_r_rudder_trim_deg", value.delta_r_rudder_trim_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_bus_inputs& value) {
+  visitor.field("fac_opp_bus", value.fac_opp_bus);
+  visitor.field("adr_own_bus", value.adr_own_bus);
+  visitor.field("adr_opp_bus", value.adr_opp_bus);
+  visitor.field("adr_3_bus", value.adr_3_bus);
+  visitor.field("ir_own_bus", value.ir_own_bus);
+  visitor.field("ir_opp_bus", value.ir_opp_bus);
+  visitor.field("ir_3_bus", value.ir_3_bus);
+  visitor.field("fmgc_own_bus", value.fmgc_own_bus);
+  visitor.field("fmgc_opp_bus", value.fmgc_opp_bus);
+  visitor.field("sfcc_own_bus", value.sfcc_own_bus);
+  visitor.field("lgciu_own_bus", value.lgciu_own_bus);
+  visitor.field("elac_1_bus", value.elac_1_bus);
+  visitor.field("elac_2_bus", value.elac_2_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_fac_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, fac_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_laws_outputs& value) {
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("rudder_trim_command_deg", value.rudder_trim_command_deg);
+  visitor.field("rudder_travel_lim_command_deg", value.rudder_travel_lim_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_adr_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_adr_computation_data& value) {
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("p_s_c_hpa", value.p_s_c_hpa);
+  visitor.field("altitude_corrected_ft", value.altitude_corrected_ft);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_ir_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_ir_computation_data& value) {
+  visitor.field("theta_deg", value.theta_deg);
+  visitor.field("phi_deg", value.phi_deg);
+  visitor.field("q_deg_s", value.q_deg_s);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("n_x_g", value.n_x_g);
+  visitor.field("n_y_g", value.n_y_g);
+  visitor.field("n_z_g", value.n_z_g);
+  visitor.field("theta_dot_deg_s", value.theta_dot_deg_s);
+  visitor.field("phi_dot_deg_s", value.phi_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_logic_outputs& value) {
+  visitor.field("lgciu_own_valid", value.lgciu_own_valid);
+  visitor.field("all_lgciu_lost", value.all_lgciu_lost);
+  visitor.field("left_main_gear_pressed", value.left_main_gear_pressed);
+  visitor.field("right_main_gear_pressed", value.right_main_gear_pressed);
+  visitor.field("main_gear_out", value.main_gear_out);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("double_self_detected_adr_failure", value.double_self_detected_adr_failure);
+  visitor.field("double_self_detected_ir_failure", value.double_self_detected_ir_failure);
+  visitor.field("double_not_self_detected_adr_failure", value.double_not_self_detected_adr_failure);
+  visitor.field("double_not_self_detected_ir_failure", value.double_not_self_detected_ir_failure);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+  visitor.field("yaw_damper_engaged", value.yaw_damper_engaged);
+  visitor.field("yaw_damper_can_engage", value.yaw_damper_can_engage);
+  visitor.field("yaw_damper_has_priority", value.yaw_damper_has_priority);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("rudder_trim_can_engage", value.rudder_trim_can_engage);
+  visitor.field("rudder_trim_has_priority", value.rudder_trim_has_priority);
+  visitor.field("rudder_travel_lim_engaged", value.rudder_travel_lim_engaged);
+  visitor.field("rudder_travel_lim_can_engage", value.rudder_travel_lim_can_engage);
+  visitor.field("rudder_travel_lim_has_priority", value.rudder_travel_lim_has_priority);
+  visitor.field("speed_scale_lost", value.speed_scale_lost);
+  visitor.field("speed_scale_visible", value.speed_scale_visible);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_flight_envelope_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_flight_envelope_outputs& value) {
+  visitor.field("estimated_beta_deg", value.estimated_beta_deg);
+  visitor.field("beta_target_deg", value.beta_target_deg);
+  visitor.field("beta_target_visible", value.beta_target_visible);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("alpha_filtered_deg", value.alpha_filtered_deg);
+  visitor.field("computed_weight_lbs", value.computed_weight_lbs);
+  visitor.field("computed_cg_percent", value.computed_cg_percent);
+  visitor.field("v_alpha_max_kn", value.v_alpha_max_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_3_visible", value.v_3_visible);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_4_visible", value.v_4_visible);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_man_visible", value.v_man_visible);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("v_fe_next_visible", value.v_fe_next_visible);
+  visitor.field("v_c_trend_kn", value.v_c_trend_kn);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_discrete_outputs& value) {
+  visitor.field("fac_healthy", value.fac_healthy);
+  visitor.field("yaw_damper_engaged", value.yaw_damper_engaged);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("rudder_travel_lim_engaged", value.rudder_travel_lim_engaged);
+  visitor.field("rudder_travel_lim_emergency_reset", value.rudder_travel_lim_emergency_reset);
+  visitor.field("yaw_damper_avail_for_norm_law", value.yaw_damper_avail_for_norm_law);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_analog_outputs& value) {
+  visitor.field("yaw_damper_order_deg", value.yaw_damper_order_deg);
+  visitor.field("rudder_trim_order_deg", value.rudder_trim_order_deg);
+  visitor.field("rudder_travel_limit_order_deg", value.rudder_travel_limit_order_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_fac_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, fac_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("flight_envelope", value.flight_envelope);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_fAEsrEZhvvruiP1ICEwvRC_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_fAEsrEZhvvruiP1ICEwvRC& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("gamma_a_deg", value.gamma_a_deg);
+  visitor.field("gamma_t_deg", value.gamma_t_deg);
+  visitor.field("total_weight_lbs", value.total_weight_lbs);
+  visitor.field("center_of_gravity_pos_percent", value.center_of_gravity_pos_percent);
+  visitor.field("sideslip_target_deg", value.sideslip_target_deg);
+  visitor.field("fac_slat_angle_deg", value.fac_slat_angle_deg);
+  visitor.field("fac_flap_angle", value.fac_flap_angle);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("rudder_travel_limit_command_deg", value.rudder_travel_limit_command_deg);
+  visitor.field("delta_r_yaw_damper_deg", value.delta_r_yaw_damper_deg);
+  visitor.field("estimated_sideslip_deg", value.estimated_sideslip_deg);
+  visitor.field("v_alpha_lim_kn", value.v_alpha_lim_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("speed_trend_kn", value.speed_trend_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("discrete_word_5", value.discrete_word_5);
+  visitor.field("delta_r_rudder_trim_deg", value.delta_r_rudder_trim_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_NHciy9HFthvyJ1C8wWfWlB_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_NHciy9HFthvyJ1C8wWfWlB& value) {
+  visitor.field("estimated_beta_deg", value.estimated_beta_deg);
+  visitor.field("beta_target_deg", value.beta_target_deg);
+  visitor.field("beta_target_visible", value.beta_target_visible);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("alpha_filtered_deg", value.alpha_filtered_deg);
+  visitor.field("computed_weight_lbs", value.computed_weight_lbs);
+  visitor.field("computed_cg_percent", value.computed_cg_percent);
+  visitor.field("v_alpha_max_kn", value.v_alpha_max_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_3_visible", value.v_3_visible);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_4_visible", value.v_4_visible);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_man_visible", value.v_man_visible);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("v_fe_next_visible", value.v_fe_next_visible);
+  visitor.field("v_c_trend_kn", value.v_c_trend_kn);
+}
+#endif
@@ -0,0 +1,370 @@
+#include "ComputerRig.h"
+
+#include <cstring>
+
+#include "FieldVisitors.h"
+#include "SensorBuses.h"
+#include "elac/Elac.h"
+#include "fac/Fac.h"
+#include "fcdc/Fcdc.h"
+#include "sec/Sec.h"
+
+#include "A32nxFields.h"
+
+struct ComputerRig::Computers {
+  SensorBuses sensors;
+
+  Elac elacs[2] = {Elac(true), Elac(false)};
+  base_elac_discrete_outputs elacsDiscreteOutputs[2] = {};
+  base_elac_analog_outputs elacsAnalogOutputs[2] = {};
+  base_elac_out_bus elacsBusOutputs[2] = {};
+
+  Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
+  base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
+  base_sec_analog_outputs secsAnalogOutputs[3] = {};
+  base_sec_out_bus secsBusOutputs[3] = {};
+
+  Fcdc fcdcs[2] = {Fcdc(true), Fcdc(false)};
+  FcdcDiscreteOutputs fcdcsDiscreteOutputs[2] = {};
+  base_fcdc_bus fcdcsBusOutputs[2] = {};
+
+  Fac facs[2] = {Fac(true), Fac(false)};
+  base_fac_discrete_outputs facsDiscreteOutputs[2] = {};
+  base_fac_analog_outputs facsAnalogOutputs[2] = {};
+  base_fac_bus facsBusOutputs[2] = {};
+
+  template <typename Visitor>
+  void visitOutputs(Visitor& visitor) {
+    visitor.field("elac_discrete", elacsDiscreteOutputs);
+    visitor.field("elac_analog", elacsAnalogOutputs);
+    visitor.field("elac_bus", elacsBusOutputs);
+    visitor.field("sec_discrete", secsDiscreteOutputs);
+    visitor.field("sec_analog", secsAnalogOutputs);
+    visitor.field("sec_bus", secsBusOutputs);
+    visitor.field("fcdc_bus", fcdcsBusOutputs);
+    visitor.field("fac_discrete", facsDiscreteOutputs);
+    visitor.field("fac_analog", facsAnalogOutputs);
+    visitor.field("fac_bus", facsBusOutputs);
+  }
+
+  void updateElac(const AircraftState& state, int elacIndex);
+
+  void updateSec(const AircraftState& state, int secIndex);
+
+  void updateFcdc(const AircraftState& state, int fcdcIndex);
+
+  void updateFac(const AircraftState& state, int facIndex);
+
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+};
+
+void ComputerRig::Computers::updateElac(const AircraftState& state, int elacIndex) {
+  const int oppElacIndex = elacIndex == 0 ? 1 : 0;
+  auto& in = elacs[elacIndex].modelInputs.in;
+
+  in.time.dt = state.dt;
+  in.time.simulation_time = state.time;
+  in.time.monotonic_time = state.time;
+
+  in.discrete_inputs.ground_spoilers_active_1 = secsDiscreteOutputs[0].ground_spoiler_out;
+  in.discrete_inputs.ground_spoilers_active_2 =
+      elacIndex == 0 ? secsDiscreteOutputs[1].ground_spoiler_out : secsDiscreteOutputs[2].ground_spoiler_out;
+  in.discrete_inputs.is_unit_1 = elacIndex == 0;
+  in.discrete_inputs.is_unit_2 = elacIndex == 1;
+  in.discrete_inputs.opp_axis_pitch_failure = !elacsDiscreteOutputs[oppElacIndex].pitch_axis_ok;
+  in.discrete_inputs.ap_1_disengaged = true;
+  in.discrete_inputs.ap_2_disengaged = true;
+  in.discrete_inputs.opp_left_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].left_aileron_ok;
+  in.discrete_inputs.opp_right_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].right_aileron_ok;
+  in.discrete_inputs.fac_1_yaw_control_lost = !facsDiscreteOutputs[0].yaw_damper_avail_for_norm_law;
+  in.discrete_inputs.fac_2_yaw_control_lost = !facsDiscreteOutputs[1].yaw_damper_avail_for_norm_law;
+  in.discrete_inputs.lgciu_1_nose_gear_pressed = state.onGround;
+  in.discrete_inputs.lgciu_2_nose_gear_pressed = state.onGround;
+  in.discrete_inputs.lgciu_1_right_main_gear_pressed = state.onGround;
+  in.discrete_inputs.lgciu_2_right_main_gear_pressed = state.onGround;
+  in.discrete_inputs.lgciu_1_left_main_gear_pressed = state.onGround;
+  in.discrete_inputs.lgciu_2_left_main_gear_pressed = state.onGround;
+  in.discrete_inputs.yellow_low_pressure = !state.yellowPressurised;
+  in.discrete_inputs.blue_low_pressure = !state.bluePressurised;
+  in.discrete_inputs.green_low_pressure = !state.greenPressurised;
+  in.discrete_inputs.elac_engaged_from_switch = true;
+
+  in.analog_inputs.capt_pitch_stick_pos = state.captPitchStick;
+  in.analog_inputs.capt_roll_stick_pos = state.captRollStick;
+  in.analog_inputs.left_elevator_pos_deg = elacsAnalogOutputs[elacIndex].left_elev_pos_order_deg;
+  in.analog_inputs.right_elevator_pos_deg = elacsAnalogOutputs[elacIndex].right_elev_pos_order_deg;
+  in.analog_inputs.ths_pos_deg = elacsAnalogOutputs[elacIndex].ths_pos_order;
+  in.analog_inputs.left_aileron_pos_deg = elacsAnalogOutputs[elacIndex].left_aileron_pos_order;
+  in.analog_inputs.right_aileron_pos_deg = elacsAnalogOutputs[elacIndex].right_aileron_pos_order;
+  in.analog_inputs.rudder_pedal_pos = state.rudderPedal;
+  in.analog_inputs.blue_hyd_pressure_psi = state.bluePressurised ? 3000 : 0;
+  in.analog_inputs.green_hyd_pressure_psi = state.greenPressurised ? 3000 : 0;
+  in.analog_inputs.yellow_hyd_pressure_psi = state.yellowPressurised ? 3000 : 0;
+
+  in.bus_inputs.adr_1_bus = sensors.adr[0];
+  in.bus_inputs.adr_2_bus = sensors.adr[1];
+  in.bus_inputs.adr_3_bus = sensors.adr[2];
+  in.bus_inputs.ir_1_bus = sensors.ir[0];
+  in.bus_inputs.ir_2_bus = sensors.ir[1];
+  in.bus_inputs.ir_3_bus = sensors.ir[2];
+  in.bus_inputs.fmgc_1_bus = sensors.fmgc;
+  in.bus_inputs.fmgc_2_bus = sensors.fmgc;
+  in.bus_inputs.ra_1_bus = sensors.ra[0];
+  in.bus_inputs.ra_2_bus = sensors.ra[1];
+  in.bus_inputs.sfcc_1_bus = sensors.sfcc[0];
+  in.bus_inputs.sfcc_2_bus = sensors.sfcc[1];
+  in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+  in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+  in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+  in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+  in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+
+  elacs[elacIndex].update(state.dt, state.time, state.isActive(elacIndex == 0 ? Failures::Elac1 : Failures::Elac2), state.powered);
+
+  elacsDiscreteOutputs[elacIndex] = elacs[elacIndex].getDiscreteOutputs();
+  elacsAnalogOutputs[elacIndex] = elacs[elacIndex].getAnalogOutputs();
+  elacsBusOutputs[elacIndex] = elacs[elacIndex].getBusOutputs();
+}
+
+void ComputerRig::Computers::updateSec(const AircraftState& state, int secIndex) {
+  const int oppSecIndex = secIndex == 0 ? 1 : 0;
+  auto& in = secs[secIndex].modelInputs.in;
+
+  in.time.dt = state.dt;
+  in.time.simulation_time = state.time;
+  in.time.monotonic_time = state.time;
+
+  in.discrete_inputs.sec_engaged_from_switch = true;
+  in.discrete_inputs.is_unit_1 = secIndex == 0;
+  in.discrete_inputs.is_unit_2 = secIndex == 1;
+  in.discrete_inputs.is_unit_3 = secIndex == 2;
+  if (secIndex < 2) {
+    in.discrete_inputs.pitch_not_avail_elac_1 = !elacsDiscreteOutputs[0].pitch_axis_ok;
+    in.discrete_inputs.pitch_not_avail_elac_2 = !elacsDiscreteOutputs[1].pitch_axis_ok;
+    in.discrete_inputs.left_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].left_elevator_ok;
+    in.discrete_inputs.right_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].right_elevator_ok;
+  }
+  in.discrete_inputs.digital_output_failed_elac_1 = !elacsDiscreteOutputs[0].digital_output_validated;
+  in.discrete_inputs.digital_output_failed_elac_2 = !elacsDiscreteOutputs[1].digital_output_validated;
+  in.discrete_inputs.green_low_pressure = !state.greenPressurised;
+  in.discrete_inputs.blue_low_pressure = !state.bluePressurised;
+  in.discrete_inputs.yellow_low_pressure = !state.yellowPressurised;
+
+  if (secIndex < 2) {
+    in.analog_inputs.capt_pitch_stick_pos = state.captPitchStick;
+    in.analog_inputs.left_elevator_pos_deg = secsAnalogOutputs[secIndex].left_elev_pos_order_deg;
+    in.analog_inputs.right_elevator_pos_deg = secsAnalogOutputs[secIndex].right_elev_pos_order_deg;
+    in.analog_inputs.ths_pos_deg = secsAnalogOutputs[secIndex].ths_pos_order_deg;
+  }
+  in.analog_inputs.capt_roll_stick_pos = state.captRollStick;
+  in.analog_inputs.spd_brk_lever_pos = state.speedBrakeLever;
+  in.analog_inputs.thr_lever_1_pos = state.thrustLever;
+  in.analog_inputs.thr_lever_2_pos = state.thrustLever;
+  in.analog_inputs.left_spoiler_1_pos_deg = secsAnalogOutputs[secIndex].left_spoiler_1_pos_order_deg;
+  in.analog_inputs.right_spoiler_1_pos_deg = secsAnalogOutputs[secIndex].right_spoiler_1_pos_order_deg;
+  in.analog_inputs.left_spoiler_2_pos_deg = secsAnalogOutputs[secIndex].left_spoiler_2_pos_order_deg;
+  in.analog_inputs.right_spoiler_2_pos_deg = secsAnalogOutputs[secIndex].right_spoiler_2_pos_order_deg;
+  in.analog_inputs.wheel_speed_left = state.wheelSpeed_kn;
+  in.analog_inputs.wheel_speed_right = state.wheelSpeed_kn;
+
+  // each SEC reads two of the three ADIRUs
+  const int firstAdiru = secIndex == 2 ? 1 : 0;
+  const int secondAdiru = secIndex == 1 ? 1 : 2;
+  in.bus_inputs.adr_1_bus = sensors.adr[firstAdiru];
+  in.bus_inputs.adr_2_bus = sensors.adr[secondAdiru];
+  in.bus_inputs.ir_1_bus = sensors.ir[firstAdiru];
+  in.bus_inputs.ir_2_bus = sensors.ir[secondAdiru];
+  in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+  in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+  in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  in.bus_inputs.sfcc_1_bus = sensors.sfcc[0];
+  in.bus_inputs.sfcc_2_bus = sensors.sfcc[1];
+  in.bus_inputs.lgciu_1_bus = sensors.lgciu[0];
+  in.bus_inputs.lgciu_2_bus = sensors.lgciu[1];
+
+  Failures failureIndex = secIndex == 0 ? Failures::Sec1 : (secIndex == 1 ? Failures::Sec2 : Failures::Sec3);
+  secs[secIndex].update(state.dt, state.time, state.isActive(failureIndex), state.powered);
+
+  secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
+  secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
+  secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
+}
+
+void ComputerRig::Computers::updateFcdc(const AircraftState& state, int fcdcIndex) {
+  const int oppFcdcIndex = fcdcIndex == 0 ? 1 : 0;
+  auto& fcdc = fcdcs[fcdcIndex];
+
+  fcdc.discreteInputs.elac1Off = false;
+  fcdc.discreteInputs.elac1Valid = elacsDiscreteOutputs[0].digital_output_validated;
+  fcdc.discreteInputs.elac2Valid = elacsDiscreteOutputs[1].digital_output_validated;
+  fcdc.discreteInputs.sec1Off = false;
+  fcdc.discreteInputs.sec1Valid = !secsDiscreteOutputs[0].sec_failed;
+  fcdc.discreteInputs.sec2Valid = !secsDiscreteOutputs[1].sec_failed;
+  fcdc.discreteInputs.eng1NotOnGroundAndNotLowOilPress = false;
+  fcdc.discreteInputs.eng2NotOnGroundAndNotLowOilPress = false;
+  fcdc.discreteInputs.noseGearPressed = state.onGround;
+  fcdc.discreteInputs.oppFcdcFailed = !fcdcsDiscreteOutputs[oppFcdcIndex].fcdcValid;
+  fcdc.discreteInputs.sec3Off = false;
+  fcdc.discreteInputs.sec3Valid = !secsDiscreteOutputs[2].sec_failed;
+  fcdc.discreteInputs.elac2Off = false;
+  fcdc.discreteInputs.sec2Off = false;
+
+  fcdc.busInputs.elac1 = elacsBusOutputs[0];
+  fcdc.busInputs.sec1 = secsBusOutputs[0];
+  fcdc.busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
+  fcdc.busInputs.elac2 = elacsBusOutputs[1];
+  fcdc.busInputs.sec2 = secsBusOutputs[1];
+  fcdc.busInputs.sec3 = secsBusOutputs[2];
+
+  fcdc.update(state.dt, state.isActive(fcdcIndex == 0 ? Failures::Fcdc1 : Failures::Fcdc2), state.powered);
+
+  fcdcsDiscreteOutputs[fcdcIndex] = fcdc.getDiscreteOutputs();
+  // FcdcBus mirrors the layout of the generated bus, copy it instead of reading it through a foreign type
+  static_assert(sizeof(FcdcBus) == sizeof(base_fcdc_bus));
+  FcdcBus bus = fcdc.getBusOutputs();
+  std::memcpy(&fcdcsBusOutputs[fcdcIndex], &bus, sizeof(bus));
+}
+
+void ComputerRig::Computers::updateFac(const AircraftState& state, int facIndex) {
+  const int oppFacIndex = facIndex == 0 ? 1 : 0;
+  auto& in = facs[facIndex].modelInputs.in;
+
+  in.time.dt = state.dt;
+  in.time.simulation_time = state.time;
+  in.time.monotonic_time = state.time;
+
+  in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+  in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+  in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+  in.discrete_inputs.elac_1_healthy = elacsDiscreteOutputs[0].digital_output_validated;
+  in.discrete_inputs.elac_2_healthy = elacsDiscreteOutputs[1].digital_output_validated;
+  in.discrete_inputs.engine_1_stopped = true;
+  in.discrete_inputs.engine_2_stopped = true;
+  in.discrete_inputs.fac_engaged_from_switch = true;
+  in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+  in.discrete_inputs.is_unit_1 = facIndex == 0;
+  in.discrete_inputs.rudder_trim_actuator_healthy = true;
+  in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+  in.discrete_inputs.nose_gear_pressed = state.onGround;
+  in.discrete_inputs.yaw_damper_has_hyd_press = facIndex == 0 ? state.greenPressurised : state.yellowPressurised;
+
+  in.analog_inputs.yaw_damper_position_deg = facsAnalogOutputs[facIndex].yaw_damper_order_deg;
+  in.analog_inputs.rudder_trim_position_deg = facsAnalogOutputs[facIndex].rudder_trim_order_deg;
+  in.analog_inputs.rudder_travel_lim_position_deg = facsAnalogOutputs[facIndex].rudder_travel_limit_order_deg;
+
+  in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  in.bus_inputs.adr_own_bus = sensors.adr[facIndex];
+  in.bus_inputs.adr_opp_bus = sensors.adr[oppFacIndex];
+  in.bus_inputs.adr_3_bus = sensors.adr[2];
+  in.bus_inputs.ir_own_bus = sensors.ir[facIndex];
+  in.bus_inputs.ir_opp_bus = sensors.ir[oppFacIndex];
+  in.bus_inputs.ir_3_bus = sensors.ir[2];
+  in.bus_inputs.fmgc_own_bus = sensors.fmgc;
+  in.bus_inputs.fmgc_opp_bus = sensors.fmgc;
+  in.bus_inputs.sfcc_own_bus = sensors.sfcc[facIndex];
+  in.bus_inputs.lgciu_own_bus = sensors.lgciu[facIndex];
+  in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+
+  facs[facIndex].update(state.dt, state.time, state.isActive(facIndex == 0 ? Failures::Fac1 : Failures::Fac2), state.powered);
+
+  facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
+  facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
+  facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
+}
+
+void ComputerRig::Computers::snapshot(ModelSnapshotWriter& writer) const {
+  for (int i = 0; i < 2; i++) {
+    elacs[i].snapshot(writer);
+    writer.write(elacsDiscreteOutputs[i]);
+    writer.write(elacsAnalogOutputs[i]);
+    writer.write(elacsBusOutputs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    secs[i].snapshot(writer);
+    writer.write(secsDiscreteOutputs[i]);
+    writer.write(secsAnalogOutputs[i]);
+    writer.write(secsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    fcdcs[i].snapshot(writer);
+    writer.write(fcdcsDiscreteOutputs[i]);
+    writer.write(fcdcsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    facs[i].snapshot(writer);
+    writer.write(facsDiscreteOutputs[i]);
+    writer.write(facsAnalogOutputs[i]);
+    writer.write(facsBusOutputs[i]);
+  }
+}
+
+bool ComputerRig::Computers::restore(ModelSnapshotReader& reader) {
+  bool result = true;
+  for (int i = 0; i < 2; i++) {
+    result = result && elacs[i].restore(reader) && reader.read(elacsDiscreteOutputs[i]) && reader.read(elacsAnalogOutputs[i]) &&
+             reader.read(elacsBusOutputs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    result = result && secs[i].restore(reader) && reader.read(secsDiscreteOutputs[i]) && reader.read(secsAnalogOutputs[i]) &&
+             reader.read(secsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    result = result && fcdcs[i].restore(reader) && reader.read(fcdcsDiscreteOutputs[i]) && reader.read(fcdcsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    result = result && facs[i].restore(reader) && reader.read(facsDiscreteOutputs[i]) && reader.read(facsAnalogOutputs[i]) &&
+             reader.read(facsBusOutputs[i]);
+  }
+  return result;
+}
+
+ComputerRig::ComputerRig() : computers(std::make_unique<Computers>()) {}
+
+ComputerRig::~ComputerRig() = default;
+
+const char* ComputerRig::aircraft() {
+  return "a32nx";
+}
+
+std::vector<std::string> ComputerRig::outputNames() {
+  FieldNames names;
+  computers->visitOutputs(names);
+  return names.names;
+}
+
+void ComputerRig::step(const AircraftState& state) {
+  computers->sensors.update(state);
+
+  // same order as the FlyByWireInterface
+  for (int i = 0; i < 2; i++) {
+    computers->updateElac(state, i);
+  }
+  for (int i = 0; i < 3; i++) {
+    computers->updateSec(state, i);
+  }
+  for (int i = 0; i < 2; i++) {
+    computers->updateFac(state, i);
+  }
+  for (int i = 0; i < 2; i++) {
+    computers->updateFcdc(state, i);
+  }
+}
+
+void ComputerRig::readOutputs(std::vector<double>& values) {
+  FieldReader reader(values);
+  computers->visitOutputs(reader);
+}
+
+void ComputerRig::snapshot(std::vector<uint8_t>& buffer) const {
+  ModelSnapshotWriter writer(buffer);
+  computers->snapshot(writer);
+}
+
+bool ComputerRig::restore(const std::vector<uint8_t>& buffer) {
+  ModelSnapshotReader reader(buffer.data(), buffer.size());
+  return computers->restore(reader) && reader.atEnd();
+}
@@ -0,0 +1,1510 @@
+#pragma once
+
+// Generated by tools/modelpostprocess/generate_fields.py from the A380X model types, do not edit.
+//
+// visitFields() calls visitor.field(name, member) for every member of a struct. Each overload is only defined when the
+// model types that declare the struct are included before this header.
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_temporary_ap_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_temporary_ap_input& value) {
+  visitor.field("ap_engaged", value.ap_engaged);
+  visitor.field("roll_command", value.roll_command);
+  visitor.field("pitch_command", value.pitch_command);
+  visitor.field("yaw_command", value.yaw_command);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_time_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_time& value) {
+  visitor.field("dt", value.dt);
+  visitor.field("simulation_time", value.simulation_time);
+  visitor.field("monotonic_time", value.monotonic_time);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sim_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sim_data& value) {
+  visitor.field("slew_on", value.slew_on);
+  visitor.field("pause_on", value.pause_on);
+  visitor.field("tracking_mode_on_override", value.tracking_mode_on_override);
+  visitor.field("tailstrike_protection_on", value.tailstrike_protection_on);
+  visitor.field("computer_running", value.computer_running);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_discrete_inputs& value) {
+  visitor.field("prim_overhead_button_pressed", value.prim_overhead_button_pressed);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("is_unit_2", value.is_unit_2);
+  visitor.field("is_unit_3", value.is_unit_3);
+  visitor.field("capt_priority_takeover_pressed", value.capt_priority_takeover_pressed);
+  visitor.field("fo_priority_takeover_pressed", value.fo_priority_takeover_pressed);
+  visitor.field("ap_1_pushbutton_pressed", value.ap_1_pushbutton_pressed);
+  visitor.field("ap_2_pushbutton_pressed", value.ap_2_pushbutton_pressed);
+  visitor.field("fcu_healthy", value.fcu_healthy);
+  visitor.field("athr_pushbutton", value.athr_pushbutton);
+  visitor.field("ir_3_on_capt", value.ir_3_on_capt);
+  visitor.field("ir_3_on_fo", value.ir_3_on_fo);
+  visitor.field("adr_3_on_capt", value.adr_3_on_capt);
+  visitor.field("adr_3_on_fo", value.adr_3_on_fo);
+  visitor.field("pitch_trim_up_pressed", value.pitch_trim_up_pressed);
+  visitor.field("pitch_trim_down_pressed", value.pitch_trim_down_pressed);
+  visitor.field("green_low_pressure", value.green_low_pressure);
+  visitor.field("yellow_low_pressure", value.yellow_low_pressure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_analog_inputs& value) {
+  visitor.field("capt_pitch_stick_pos", value.capt_pitch_stick_pos);
+  visitor.field("fo_pitch_stick_pos", value.fo_pitch_stick_pos);
+  visitor.field("capt_roll_stick_pos", value.capt_roll_stick_pos);
+  visitor.field("fo_roll_stick_pos", value.fo_roll_stick_pos);
+  visitor.field("speed_brake_lever_pos", value.speed_brake_lever_pos);
+  visitor.field("thr_lever_1_pos", value.thr_lever_1_pos);
+  visitor.field("thr_lever_2_pos", value.thr_lever_2_pos);
+  visitor.field("thr_lever_3_pos", value.thr_lever_3_pos);
+  visitor.field("thr_lever_4_pos", value.thr_lever_4_pos);
+  visitor.field("elevator_1_pos_deg", value.elevator_1_pos_deg);
+  visitor.field("elevator_2_pos_deg", value.elevator_2_pos_deg);
+  visitor.field("elevator_3_pos_deg", value.elevator_3_pos_deg);
+  visitor.field("ths_pos_deg", value.ths_pos_deg);
+  visitor.field("left_aileron_1_pos_deg", value.left_aileron_1_pos_deg);
+  visitor.field("left_aileron_2_pos_deg", value.left_aileron_2_pos_deg);
+  visitor.field("right_aileron_1_pos_deg", value.right_aileron_1_pos_deg);
+  visitor.field("right_aileron_2_pos_deg", value.right_aileron_2_pos_deg);
+  visitor.field("left_spoiler_pos_deg", value.left_spoiler_pos_deg);
+  visitor.field("right_spoiler_pos_deg", value.right_spoiler_pos_deg);
+  visitor.field("rudder_1_pos_deg", value.rudder_1_pos_deg);
+  visitor.field("rudder_2_pos_deg", value.rudder_2_pos_deg);
+  visitor.field("rudder_pedal_pos", value.rudder_pedal_pos);
+  visitor.field("yellow_hyd_pressure_psi", value.yellow_hyd_pressure_psi);
+  visitor.field("green_hyd_pressure_psi", value.green_hyd_pressure_psi);
+  visitor.field("vert_acc_1_g", value.vert_acc_1_g);
+  visitor.field("vert_acc_2_g", value.vert_acc_2_g);
+  visitor.field("vert_acc_3_g", value.vert_acc_3_g);
+  visitor.field("lat_acc_1_g", value.lat_acc_1_g);
+  visitor.field("lat_acc_2_g", value.lat_acc_2_g);
+  visitor.field("lat_acc_3_g", value.lat_acc_3_g);
+  visitor.field("left_body_wheel_speed", value.left_body_wheel_speed);
+  visitor.field("left_wing_wheel_speed", value.left_wing_wheel_speed);
+  visitor.field("right_body_wheel_speed", value.right_body_wheel_speed);
+  visitor.field("right_wing_wheel_speed", value.right_wing_wheel_speed);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_arinc_429_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_arinc_429& value) {
+  visitor.field("SSM", value.SSM);
+  visitor.field("Data", value.Data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_adr_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_adr_bus& value) {
+  visitor.field("altitude_standard_ft", value.altitude_standard_ft);
+  visitor.field("altitude_corrected_ft", value.altitude_corrected_ft);
+  visitor.field("mach", value.mach);
+  visitor.field("airspeed_computed_kn", value.airspeed_computed_kn);
+  visitor.field("airspeed_true_kn", value.airspeed_true_kn);
+  visitor.field("vertical_speed_ft_min", value.vertical_speed_ft_min);
+  visitor.field("aoa_corrected_deg", value.aoa_corrected_deg);
+  visitor.field("corrected_average_static_pressure", value.corrected_average_static_pressure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_ir_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_ir_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("latitude_deg", value.latitude_deg);
+  visitor.field("longitude_deg", value.longitude_deg);
+  visitor.field("ground_speed_kn", value.ground_speed_kn);
+  visitor.field("track_angle_true_deg", value.track_angle_true_deg);
+  visitor.field("heading_true_deg", value.heading_true_deg);
+  visitor.field("wind_speed_kn", value.wind_speed_kn);
+  visitor.field("wind_direction_true_deg", value.wind_direction_true_deg);
+  visitor.field("track_angle_magnetic_deg", value.track_angle_magnetic_deg);
+  visitor.field("heading_magnetic_deg", value.heading_magnetic_deg);
+  visitor.field("drift_angle_deg", value.drift_angle_deg);
+  visitor.field("flight_path_angle_deg", value.flight_path_angle_deg);
+  visitor.field("flight_path_accel_g", value.flight_path_accel_g);
+  visitor.field("pitch_angle_deg", value.pitch_angle_deg);
+  visitor.field("roll_angle_deg", value.roll_angle_deg);
+  visitor.field("body_pitch_rate_deg_s", value.body_pitch_rate_deg_s);
+  visitor.field("body_roll_rate_deg_s", value.body_roll_rate_deg_s);
+  visitor.field("body_yaw_rate_deg_s", value.body_yaw_rate_deg_s);
+  visitor.field("body_long_accel_g", value.body_long_accel_g);
+  visitor.field("body_lat_accel_g", value.body_lat_accel_g);
+  visitor.field("body_normal_accel_g", value.body_normal_accel_g);
+  visitor.field("track_angle_rate_deg_s", value.track_angle_rate_deg_s);
+  visitor.field("pitch_att_rate_deg_s", value.pitch_att_rate_deg_s);
+  visitor.field("roll_att_rate_deg_s", value.roll_att_rate_deg_s);
+  visitor.field("inertial_alt_ft", value.inertial_alt_ft);
+  visitor.field("along_track_horiz_acc_g", value.along_track_horiz_acc_g);
+  visitor.field("cross_track_horiz_acc_g", value.cross_track_horiz_acc_g);
+  visitor.field("vertical_accel_g", value.vertical_accel_g);
+  visitor.field("inertial_vertical_speed_ft_s", value.inertial_vertical_speed_ft_s);
+  visitor.field("north_south_velocity_kn", value.north_south_velocity_kn);
+  visitor.field("east_west_velocity_kn", value.east_west_velocity_kn);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_ra_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_ra_bus& value) {
+  visitor.field("radio_height_ft", value.radio_height_ft);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sfcc_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sfcc_bus& value) {
+  visitor.field("slat_flap_component_status_word", value.slat_flap_component_status_word);
+  visitor.field("slat_flap_system_status_word", value.slat_flap_system_status_word);
+  visitor.field("slat_flap_actual_position_word", value.slat_flap_actual_position_word);
+  visitor.field("slat_actual_position_deg", value.slat_actual_position_deg);
+  visitor.field("flap_actual_position_deg", value.flap_actual_position_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_out_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_out_bus& value) {
+  visitor.field("left_inboard_aileron_command_deg", value.left_inboard_aileron_command_deg);
+  visitor.field("right_inboard_aileron_command_deg", value.right_inboard_aileron_command_deg);
+  visitor.field("left_midboard_aileron_command_deg", value.left_midboard_aileron_command_deg);
+  visitor.field("right_midboard_aileron_command_deg", value.right_midboard_aileron_command_deg);
+  visitor.field("left_outboard_aileron_command_deg", value.left_outboard_aileron_command_deg);
+  visitor.field("right_outboard_aileron_command_deg", value.right_outboard_aileron_command_deg);
+  visitor.field("left_spoiler_1_command_deg", value.left_spoiler_1_command_deg);
+  visitor.field("right_spoiler_1_command_deg", value.right_spoiler_1_command_deg);
+  visitor.field("left_spoiler_2_command_deg", value.left_spoiler_2_command_deg);
+  visitor.field("right_spoiler_2_command_deg", value.right_spoiler_2_command_deg);
+  visitor.field("left_spoiler_3_command_deg", value.left_spoiler_3_command_deg);
+  visitor.field("right_spoiler_3_command_deg", value.right_spoiler_3_command_deg);
+  visitor.field("left_spoiler_4_command_deg", value.left_spoiler_4_command_deg);
+  visitor.field("right_spoiler_4_command_deg", value.right_spoiler_4_command_deg);
+  visitor.field("left_spoiler_5_command_deg", value.left_spoiler_5_command_deg);
+  visitor.field("right_spoiler_5_command_deg", value.right_spoiler_5_command_deg);
+  visitor.field("left_spoiler_6_command_deg", value.left_spoiler_6_command_deg);
+  visitor.field("right_spoiler_6_command_deg", value.right_spoiler_6_command_deg);
+  visitor.field("left_spoiler_7_command_deg", value.left_spoiler_7_command_deg);
+  visitor.field("right_spoiler_7_command_deg", value.right_spoiler_7_command_deg);
+  visitor.field("left_spoiler_8_command_deg", value.left_spoiler_8_command_deg);
+  visitor.field("right_spoiler_8_command_deg", value.right_spoiler_8_command_deg);
+  visitor.field("left_inboard_elevator_command_deg", value.left_inboard_elevator_command_deg);
+  visitor.field("right_inboard_elevator_command_deg", value.right_inboard_elevator_command_deg);
+  visitor.field("left_outboard_elevator_command_deg", value.left_outboard_elevator_command_deg);
+  visitor.field("right_outboard_elevator_command_deg", value.right_outboard_elevator_command_deg);
+  visitor.field("ths_command_deg", value.ths_command_deg);
+  visitor.field("upper_rudder_command_deg", value.upper_rudder_command_deg);
+  visitor.field("lower_rudder_command_deg", value.lower_rudder_command_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_status_word", value.aileron_status_word);
+  visitor.field("left_aileron_1_position_deg", value.left_aileron_1_position_deg);
+  visitor.field("left_aileron_2_position_deg", value.left_aileron_2_position_deg);
+  visitor.field("right_aileron_1_position_deg", value.right_aileron_1_position_deg);
+  visitor.field("right_aileron_2_position_deg", value.right_aileron_2_position_deg);
+  visitor.field("spoiler_status_word", value.spoiler_status_word);
+  visitor.field("left_spoiler_position_deg", value.left_spoiler_position_deg);
+  visitor.field("right_spoiler_position_deg", value.right_spoiler_position_deg);
+  visitor.field("elevator_status_word", value.elevator_status_word);
+  visitor.field("elevator_1_position_deg", value.elevator_1_position_deg);
+  visitor.field("elevator_2_position_deg", value.elevator_2_position_deg);
+  visitor.field("elevator_3_position_deg", value.elevator_3_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("rudder_status_word", value.rudder_status_word);
+  visitor.field("rudder_1_position_deg", value.rudder_1_position_deg);
+  visitor.field("rudder_2_position_deg", value.rudder_2_position_deg);
+  visitor.field("fctl_law_status_word", value.fctl_law_status_word);
+  visitor.field("misc_data_status_word", value.misc_data_status_word);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_out_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_out_bus& value) {
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_status_word", value.aileron_status_word);
+  visitor.field("left_aileron_1_position_deg", value.left_aileron_1_position_deg);
+  visitor.field("left_aileron_2_position_deg", value.left_aileron_2_position_deg);
+  visitor.field("right_aileron_1_position_deg", value.right_aileron_1_position_deg);
+  visitor.field("right_aileron_2_position_deg", value.right_aileron_2_position_deg);
+  visitor.field("spoiler_status_word", value.spoiler_status_word);
+  visitor.field("left_spoiler_1_position_deg", value.left_spoiler_1_position_deg);
+  visitor.field("right_spoiler_1_position_deg", value.right_spoiler_1_position_deg);
+  visitor.field("left_spoiler_2_position_deg", value.left_spoiler_2_position_deg);
+  visitor.field("right_spoiler_2_position_deg", value.right_spoiler_2_position_deg);
+  visitor.field("elevator_status_word", value.elevator_status_word);
+  visitor.field("elevator_1_position_deg", value.elevator_1_position_deg);
+  visitor.field("elevator_2_position_deg", value.elevator_2_position_deg);
+  visitor.field("elevator_3_position_deg", value.elevator_3_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("rudder_status_word", value.rudder_status_word);
+  visitor.field("rudder_1_position_deg", value.rudder_1_position_deg);
+  visitor.field("rudder_2_position_deg", value.rudder_2_position_deg);
+  visitor.field("fctl_law_status_word", value.fctl_law_status_word);
+  visitor.field("misc_data_status_word", value.misc_data_status_word);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_bus_inputs& value) {
+  visitor.field("adr_1_bus", value.adr_1_bus);
+  visitor.field("adr_2_bus", value.adr_2_bus);
+  visitor.field("adr_3_bus", value.adr_3_bus);
+  visitor.field("ir_1_bus", value.ir_1_bus);
+  visitor.field("ir_2_bus", value.ir_2_bus);
+  visitor.field("ir_3_bus", value.ir_3_bus);
+  visitor.field("isis_1_bus", value.isis_1_bus);
+  visitor.field("isis_2_bus", value.isis_2_bus);
+  visitor.field("rate_gyro_pitch_1_bus", value.rate_gyro_pitch_1_bus);
+  visitor.field("rate_gyro_pitch_2_bus", value.rate_gyro_pitch_2_bus);
+  visitor.field("rate_gyro_roll_1_bus", value.rate_gyro_roll_1_bus);
+  visitor.field("rate_gyro_roll_2_bus", value.rate_gyro_roll_2_bus);
+  visitor.field("rate_gyro_yaw_1_bus", value.rate_gyro_yaw_1_bus);
+  visitor.field("rate_gyro_yaw_2_bus", value.rate_gyro_yaw_2_bus);
+  visitor.field("ra_1_bus", value.ra_1_bus);
+  visitor.field("ra_2_bus", value.ra_2_bus);
+  visitor.field("sfcc_1_bus", value.sfcc_1_bus);
+  visitor.field("sfcc_2_bus", value.sfcc_2_bus);
+  visitor.field("irdc_1_bus", value.irdc_1_bus);
+  visitor.field("irdc_2_bus", value.irdc_2_bus);
+  visitor.field("irdc_3_bus", value.irdc_3_bus);
+  visitor.field("irdc_4_a_bus", value.irdc_4_a_bus);
+  visitor.field("irdc_4_b_bus", value.irdc_4_b_bus);
+  visitor.field("fcu_own_bus", value.fcu_own_bus);
+  visitor.field("fcu_opp_bus", value.fcu_opp_bus);
+  visitor.field("prim_x_bus", value.prim_x_bus);
+  visitor.field("prim_y_bus", value.prim_y_bus);
+  visitor.field("sec_1_bus", value.sec_1_bus);
+  visitor.field("sec_2_bus", value.sec_2_bus);
+  visitor.field("sec_3_bus", value.sec_3_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_prim_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, prim_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+  visitor.field("temporary_ap_input", value.temporary_ap_input);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_lateral_surface_positions_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_lateral_surface_positions& value) {
+  visitor.field("left_inboard_aileron_deg", value.left_inboard_aileron_deg);
+  visitor.field("right_inboard_aileron_deg", value.right_inboard_aileron_deg);
+  visitor.field("left_midboard_aileron_deg", value.left_midboard_aileron_deg);
+  visitor.field("right_midboard_aileron_deg", value.right_midboard_aileron_deg);
+  visitor.field("left_outboard_aileron_deg", value.left_outboard_aileron_deg);
+  visitor.field("right_outboard_aileron_deg", value.right_outboard_aileron_deg);
+  visitor.field("left_spoiler_1_deg", value.left_spoiler_1_deg);
+  visitor.field("right_spoiler_1_deg", value.right_spoiler_1_deg);
+  visitor.field("left_spoiler_2_deg", value.left_spoiler_2_deg);
+  visitor.field("right_spoiler_2_deg", value.right_spoiler_2_deg);
+  visitor.field("left_spoiler_3_deg", value.left_spoiler_3_deg);
+  visitor.field("right_spoiler_3_deg", value.right_spoiler_3_deg);
+  visitor.field("left_spoiler_4_deg", value.left_spoiler_4_deg);
+  visitor.field("right_spoiler_4_deg", value.right_spoiler_4_deg);
+  visitor.field("left_spoiler_5_deg", value.left_spoiler_5_deg);
+  visitor.field("right_spoiler_5_deg", value.right_spoiler_5_deg);
+  visitor.field("left_spoiler_6_deg", value.left_spoiler_6_deg);
+  visitor.field("right_spoiler_6_deg", value.right_spoiler_6_deg);
+  visitor.field("left_spoiler_7_deg", value.left_spoiler_7_deg);
+  visitor.field("right_spoiler_7_deg", value.right_spoiler_7_deg);
+  visitor.field("left_spoiler_8_deg", value.left_spoiler_8_deg);
+  visitor.field("right_spoiler_8_deg", value.right_spoiler_8_deg);
+  visitor.field("upper_rudder_deg", value.upper_rudder_deg);
+  visitor.field("lower_rudder_deg", value.lower_rudder_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_pitch_surface_positions_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_pitch_surface_positions& value) {
+  visitor.field("left_inboard_elevator_deg", value.left_inboard_elevator_deg);
+  visitor.field("right_inboard_elevator_deg", value.right_inboard_elevator_deg);
+  visitor.field("left_outboard_elevator_deg", value.left_outboard_elevator_deg);
+  visitor.field("right_outboard_elevator_deg", value.right_outboard_elevator_deg);
+  visitor.field("ths_deg", value.ths_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_laws_outputs& value) {
+  visitor.field("lateral_law_outputs", value.lateral_law_outputs);
+  visitor.field("pitch_law_outputs", value.pitch_law_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_surface_status_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_surface_status& value) {
+  visitor.field("left_inboard_aileron_engaged", value.left_inboard_aileron_engaged);
+  visitor.field("right_inboard_aileron_engaged", value.right_inboard_aileron_engaged);
+  visitor.field("left_midboard_aileron_engaged", value.left_midboard_aileron_engaged);
+  visitor.field("right_midboard_aileron_engaged", value.right_midboard_aileron_engaged);
+  visitor.field("left_outboard_aileron_engaged", value.left_outboard_aileron_engaged);
+  visitor.field("right_outboard_aileron_engaged", value.right_outboard_aileron_engaged);
+  visitor.field("spoiler_pair_1_engaged", value.spoiler_pair_1_engaged);
+  visitor.field("spoiler_pair_2_engaged", value.spoiler_pair_2_engaged);
+  visitor.field("spoiler_pair_3_engaged", value.spoiler_pair_3_engaged);
+  visitor.field("spoiler_pair_4_engaged", value.spoiler_pair_4_engaged);
+  visitor.field("spoiler_pair_5_engaged", value.spoiler_pair_5_engaged);
+  visitor.field("spoiler_pair_6_engaged", value.spoiler_pair_6_engaged);
+  visitor.field("spoiler_pair_7_engaged", value.spoiler_pair_7_engaged);
+  visitor.field("spoiler_pair_8_engaged", value.spoiler_pair_8_engaged);
+  visitor.field("left_inboard_elevator_engaged", value.left_inboard_elevator_engaged);
+  visitor.field("right_inboard_elevator_engaged", value.right_inboard_elevator_engaged);
+  visitor.field("left_outboard_elevator_engaged", value.left_outboard_elevator_engaged);
+  visitor.field("right_outboard_elevator_engaged", value.right_outboard_elevator_engaged);
+  visitor.field("ths_engaged", value.ths_engaged);
+  visitor.field("upper_rudder_engaged", value.upper_rudder_engaged);
+  visitor.field("lower_rudder_engaged", value.lower_rudder_engaged);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_adr_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_adr_computation_data& value) {
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("alpha_deg", value.alpha_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_ir_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_ir_computation_data& value) {
+  visitor.field("theta_deg", value.theta_deg);
+  visitor.field("phi_deg", value.phi_deg);
+  visitor.field("q_deg_s", value.q_deg_s);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("n_x_g", value.n_x_g);
+  visitor.field("n_y_g", value.n_y_g);
+  visitor.field("n_z_g", value.n_z_g);
+  visitor.field("theta_dot_deg_s", value.theta_dot_deg_s);
+  visitor.field("phi_dot_deg_s", value.phi_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_logic_outputs& value) {
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("surface_statuses", value.surface_statuses);
+  visitor.field("lateral_surface_positions", value.lateral_surface_positions);
+  visitor.field("pitch_surface_positions", value.pitch_surface_positions);
+  visitor.field("lateral_law_capability", value.lateral_law_capability);
+  visitor.field("active_lateral_law", value.active_lateral_law);
+  visitor.field("pitch_law_capability", value.pitch_law_capability);
+  visitor.field("active_pitch_law", value.active_pitch_law);
+  visitor.field("abnormal_condition_law_active", value.abnormal_condition_law_active);
+  visitor.field("is_master_prim", value.is_master_prim);
+  visitor.field("elevator_1_avail", value.elevator_1_avail);
+  visitor.field("elevator_1_engaged", value.elevator_1_engaged);
+  visitor.field("elevator_2_avail", value.elevator_2_avail);
+  visitor.field("elevator_2_engaged", value.elevator_2_engaged);
+  visitor.field("elevator_3_avail", value.elevator_3_avail);
+  visitor.field("elevator_3_engaged", value.elevator_3_engaged);
+  visitor.field("ths_avail", value.ths_avail);
+  visitor.field("ths_engaged", value.ths_engaged);
+  visitor.field("left_aileron_1_avail", value.left_aileron_1_avail);
+  visitor.field("left_aileron_1_engaged", value.left_aileron_1_engaged);
+  visitor.field("left_aileron_2_avail", value.left_aileron_2_avail);
+  visitor.field("left_aileron_2_engaged", value.left_aileron_2_engaged);
+  visitor.field("right_aileron_1_avail", value.right_aileron_1_avail);
+  visitor.field("right_aileron_1_engaged", value.right_aileron_1_engaged);
+  visitor.field("right_aileron_2_avail", value.right_aileron_2_avail);
+  visitor.field("right_aileron_2_engaged", value.right_aileron_2_engaged);
+  visitor.field("left_spoiler_hydraulic_mode_avail", value.left_spoiler_hydraulic_mode_avail);
+  visitor.field("left_spoiler_electric_mode_avail", value.left_spoiler_electric_mode_avail);
+  visitor.field("left_spoiler_hydraulic_mode_engaged", value.left_spoiler_hydraulic_mode_engaged);
+  visitor.field("left_spoiler_electric_mode_engaged", value.left_spoiler_electric_mode_engaged);
+  visitor.field("right_spoiler_hydraulic_mode_avail", value.right_spoiler_hydraulic_mode_avail);
+  visitor.field("right_spoiler_electric_mode_avail", value.right_spoiler_electric_mode_avail);
+  visitor.field("right_spoiler_hydraulic_mode_engaged", value.right_spoiler_hydraulic_mode_engaged);
+  visitor.field("right_spoiler_electric_mode_engaged", value.right_spoiler_electric_mode_engaged);
+  visitor.field("rudder_1_hydraulic_mode_avail", value.rudder_1_hydraulic_mode_avail);
+  visitor.field("rudder_1_electric_mode_avail", value.rudder_1_electric_mode_avail);
+  visitor.field("rudder_1_hydraulic_mode_engaged", value.rudder_1_hydraulic_mode_engaged);
+  visitor.field("rudder_1_electric_mode_engaged", value.rudder_1_electric_mode_engaged);
+  visitor.field("rudder_2_hydraulic_mode_avail", value.rudder_2_hydraulic_mode_avail);
+  visitor.field("rudder_2_electric_mode_avail", value.rudder_2_electric_mode_avail);
+  visitor.field("rudder_2_hydraulic_mode_engaged", value.rudder_2_hydraulic_mode_engaged);
+  visitor.field("rudder_2_electric_mode_engaged", value.rudder_2_electric_mode_engaged);
+  visitor.field("aileron_droop_active", value.aileron_droop_active);
+  visitor.field("aileron_antidroop_active", value.aileron_antidroop_active);
+  visitor.field("is_yellow_hydraulic_power_avail", value.is_yellow_hydraulic_power_avail);
+  visitor.field("is_green_hydraulic_power_avail", value.is_green_hydraulic_power_avail);
+  visitor.field("left_sidestick_disabled", value.left_sidestick_disabled);
+  visitor.field("right_sidestick_disabled", value.right_sidestick_disabled);
+  visitor.field("left_sidestick_priority_locked", value.left_sidestick_priority_locked);
+  visitor.field("right_sidestick_priority_locked", value.right_sidestick_priority_locked);
+  visitor.field("total_sidestick_pitch_command", value.total_sidestick_pitch_command);
+  visitor.field("total_sidestick_roll_command", value.total_sidestick_roll_command);
+  visitor.field("speed_brake_inhibited", value.speed_brake_inhibited);
+  visitor.field("ground_spoilers_armed", value.ground_spoilers_armed);
+  visitor.field("ground_spoilers_out", value.ground_spoilers_out);
+  visitor.field("phased_lift_dumping_active", value.phased_lift_dumping_active);
+  visitor.field("ap_authorised", value.ap_authorised);
+  visitor.field("protection_ap_disconnect", value.protection_ap_disconnect);
+  visitor.field("high_alpha_prot_active", value.high_alpha_prot_active);
+  visitor.field("alpha_prot_deg", value.alpha_prot_deg);
+  visitor.field("alpha_max_deg", value.alpha_max_deg);
+  visitor.field("high_speed_prot_active", value.high_speed_prot_active);
+  visitor.field("high_speed_prot_lo_thresh_kn", value.high_speed_prot_lo_thresh_kn);
+  visitor.field("high_speed_prot_hi_thresh_kn", value.high_speed_prot_hi_thresh_kn);
+  visitor.field("double_adr_failure", value.double_adr_failure);
+  visitor.field("triple_adr_failure", value.triple_adr_failure);
+  visitor.field("cas_or_mach_disagree", value.cas_or_mach_disagree);
+  visitor.field("alpha_disagree", value.alpha_disagree);
+  visitor.field("double_ir_failure", value.double_ir_failure);
+  visitor.field("triple_ir_failure", value.triple_ir_failure);
+  visitor.field("ir_failure_not_self_detected", value.ir_failure_not_self_detected);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+  visitor.field("ra_computation_data_ft", value.ra_computation_data_ft);
+  visitor.field("dual_ra_failure", value.dual_ra_failure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_discrete_outputs& value) {
+  visitor.field("elevator_1_active_mode", value.elevator_1_active_mode);
+  visitor.field("elevator_2_active_mode", value.elevator_2_active_mode);
+  visitor.field("elevator_3_active_mode", value.elevator_3_active_mode);
+  visitor.field("ths_active_mode", value.ths_active_mode);
+  visitor.field("left_aileron_1_active_mode", value.left_aileron_1_active_mode);
+  visitor.field("left_aileron_2_active_mode", value.left_aileron_2_active_mode);
+  visitor.field("right_aileron_1_active_mode", value.right_aileron_1_active_mode);
+  visitor.field("right_aileron_2_active_mode", value.right_aileron_2_active_mode);
+  visitor.field("left_spoiler_electronic_module_enable", value.left_spoiler_electronic_module_enable);
+  visitor.field("right_spoiler_electronic_module_enable", value.right_spoiler_electronic_module_enable);
+  visitor.field("rudder_1_hydraulic_active_mode", value.rudder_1_hydraulic_active_mode);
+  visitor.field("rudder_1_electric_active_mode", value.rudder_1_electric_active_mode);
+  visitor.field("rudder_2_hydraulic_active_mode", value.rudder_2_hydraulic_active_mode);
+  visitor.field("rudder_2_electric_active_mode", value.rudder_2_electric_active_mode);
+  visitor.field("prim_healthy", value.prim_healthy);
+  visitor.field("fcu_own_select", value.fcu_own_select);
+  visitor.field("fcu_opp_select", value.fcu_opp_select);
+  visitor.field("reverser_tertiary_lock", value.reverser_tertiary_lock);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_prim_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_prim_analog_outputs& value) {
+  visitor.field("elevator_1_pos_order_deg", value.elevator_1_pos_order_deg);
+  visitor.field("elevator_2_pos_order_deg", value.elevator_2_pos_order_deg);
+  visitor.field("elevator_3_pos_order_deg", value.elevator_3_pos_order_deg);
+  visitor.field("ths_pos_order_deg", value.ths_pos_order_deg);
+  visitor.field("left_aileron_1_pos_order_deg", value.left_aileron_1_pos_order_deg);
+  visitor.field("left_aileron_2_pos_order_deg", value.left_aileron_2_pos_order_deg);
+  visitor.field("right_aileron_1_pos_order_deg", value.right_aileron_1_pos_order_deg);
+  visitor.field("right_aileron_2_pos_order_deg", value.right_aileron_2_pos_order_deg);
+  visitor.field("left_spoiler_pos_order_deg", value.left_spoiler_pos_order_deg);
+  visitor.field("right_spoiler_pos_order_deg", value.right_spoiler_pos_order_deg);
+  visitor.field("rudder_1_pos_order_deg", value.rudder_1_pos_order_deg);
+  visitor.field("rudder_2_pos_order_deg", value.rudder_2_pos_order_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_prim_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, prim_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_roll_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_roll_output& value) {
+  visitor.field("xi_inboard_deg", value.xi_inboard_deg);
+  visitor.field("xi_midboard_deg", value.xi_midboard_deg);
+  visitor.field("xi_outboard_deg", value.xi_outboard_deg);
+  visitor.field("xi_spoiler_deg", value.xi_spoiler_deg);
+  visitor.field("zeta_upper_deg", value.zeta_upper_deg);
+  visitor.field("zeta_lower_deg", value.zeta_lower_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_lateral_direct_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, lateral_direct_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("delta_xi_pos", value.delta_xi_pos);
+  visitor.field("delta_zeta_pos", value.delta_zeta_pos);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_lateral_normal_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, lateral_normal_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("pk_deg_s", value.pk_deg_s);
+  visitor.field("beta_deg", value.beta_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("delta_xi_pos", value.delta_xi_pos);
+  visitor.field("delta_zeta_pos", value.delta_zeta_pos);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("high_aoa_prot_active", value.high_aoa_prot_active);
+  visitor.field("high_speed_prot_active", value.high_speed_prot_active);
+  visitor.field("ap_phi_c_deg", value.ap_phi_c_deg);
+  visitor.field("ap_beta_c_deg", value.ap_beta_c_deg);
+  visitor.field("any_ap_engaged", value.any_ap_engaged);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_pitch_alternate_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, pitch_alternate_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("nz_g", value.nz_g);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("qk_deg_s", value.qk_deg_s);
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("eta_trim_deg", value.eta_trim_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("CG_percent_MAC", value.CG_percent_MAC);
+  visitor.field("total_weight_kg", value.total_weight_kg);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("spoilers_left_pos", value.spoilers_left_pos);
+  visitor.field("spoilers_right_pos", value.spoilers_right_pos);
+  visitor.field("delta_eta_pos", value.delta_eta_pos);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("stabilities_available", value.stabilities_available);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_output& value) {
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("eta_trim_dot_deg_s", value.eta_trim_dot_deg_s);
+  visitor.field("eta_trim_limit_lo", value.eta_trim_limit_lo);
+  visitor.field("eta_trim_limit_up", value.eta_trim_limit_up);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_pitch_direct_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, pitch_direct_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("delta_eta_pos", value.delta_eta_pos);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_pitch_normal_input_
+template <typename Visitor>
+void visitFields(Visitor& visitor, pitch_normal_input& value) {
+  visitor.field("time", value.time);
+  visitor.field("nz_g", value.nz_g);
+  visitor.field("Theta_deg", value.Theta_deg);
+  visitor.field("Phi_deg", value.Phi_deg);
+  visitor.field("qk_deg_s", value.qk_deg_s);
+  visitor.field("qk_dot_deg_s2", value.qk_dot_deg_s2);
+  visitor.field("eta_deg", value.eta_deg);
+  visitor.field("eta_trim_deg", value.eta_trim_deg);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("H_radio_ft", value.H_radio_ft);
+  visitor.field("CG_percent_MAC", value.CG_percent_MAC);
+  visitor.field("total_weight_kg", value.total_weight_kg);
+  visitor.field("flaps_handle_index", value.flaps_handle_index);
+  visitor.field("spoilers_left_pos", value.spoilers_left_pos);
+  visitor.field("spoilers_right_pos", value.spoilers_right_pos);
+  visitor.field("thrust_lever_1_pos", value.thrust_lever_1_pos);
+  visitor.field("thrust_lever_2_pos", value.thrust_lever_2_pos);
+  visitor.field("tailstrike_protection_on", value.tailstrike_protection_on);
+  visitor.field("VLS_kn", value.VLS_kn);
+  visitor.field("delta_eta_pos", value.delta_eta_pos);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("high_aoa_prot_active", value.high_aoa_prot_active);
+  visitor.field("high_speed_prot_active", value.high_speed_prot_active);
+  visitor.field("alpha_prot", value.alpha_prot);
+  visitor.field("alpha_max", value.alpha_max);
+  visitor.field("high_speed_prot_high_kn", value.high_speed_prot_high_kn);
+  visitor.field("high_speed_prot_low_kn", value.high_speed_prot_low_kn);
+  visitor.field("ap_theta_c_deg", value.ap_theta_c_deg);
+  visitor.field("any_ap_engaged", value.any_ap_engaged);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_roll_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_roll_data_computed& value) {
+  visitor.field("delta_xi_deg", value.delta_xi_deg);
+  visitor.field("delta_zeta_deg", value.delta_zeta_deg);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("in_flight_gain", value.in_flight_gain);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_roll_normal_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_roll_normal& value) {
+  visitor.field("pk_c_deg_s", value.pk_c_deg_s);
+  visitor.field("Phi_c_deg", value.Phi_c_deg);
+  visitor.field("xi_deg", value.xi_deg);
+  visitor.field("zeta_deg", value.zeta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_alternate_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_alternate_data_computed& value) {
+  visitor.field("eta_trim_deg_limit_lo", value.eta_trim_deg_limit_lo);
+  visitor.field("eta_trim_deg_limit_up", value.eta_trim_deg_limit_up);
+  visitor.field("delta_eta_deg", value.delta_eta_deg);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("in_flare", value.in_flare);
+  visitor.field("in_flight_gain", value.in_flight_gain);
+  visitor.field("nz_limit_up_g", value.nz_limit_up_g);
+  visitor.field("nz_limit_lo_g", value.nz_limit_lo_g);
+  visitor.field("eta_trim_deg_should_freeze", value.eta_trim_deg_should_freeze);
+  visitor.field("eta_trim_deg_reset", value.eta_trim_deg_reset);
+  visitor.field("eta_trim_deg_reset_deg", value.eta_trim_deg_reset_deg);
+  visitor.field("eta_trim_deg_should_write", value.eta_trim_deg_should_write);
+  visitor.field("eta_trim_deg_rate_limit_up_deg_s", value.eta_trim_deg_rate_limit_up_deg_s);
+  visitor.field("eta_trim_deg_rate_limit_lo_deg_s", value.eta_trim_deg_rate_limit_lo_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_normal_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_normal& value) {
+  visitor.field("nz_c_g", value.nz_c_g);
+  visitor.field("Cstar_g", value.Cstar_g);
+  visitor.field("protection_alpha_c_deg", value.protection_alpha_c_deg);
+  visitor.field("protection_V_c_kn", value.protection_V_c_kn);
+  visitor.field("eta_dot_deg_s", value.eta_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_law_output_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_law_output& value) {
+  visitor.field("eta_dot_deg_s", value.eta_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_integrated_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_integrated& value) {
+  visitor.field("eta_deg", value.eta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_data_computed_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_data_computed& value) {
+  visitor.field("eta_trim_deg_limit_lo", value.eta_trim_deg_limit_lo);
+  visitor.field("eta_trim_deg_limit_up", value.eta_trim_deg_limit_up);
+  visitor.field("delta_eta_deg", value.delta_eta_deg);
+  visitor.field("in_flight", value.in_flight);
+  visitor.field("in_rotation", value.in_rotation);
+  visitor.field("in_flare", value.in_flare);
+  visitor.field("in_flight_gain", value.in_flight_gain);
+  visitor.field("in_rotation_gain", value.in_rotation_gain);
+  visitor.field("nz_limit_up_g", value.nz_limit_up_g);
+  visitor.field("nz_limit_lo_g", value.nz_limit_lo_g);
+  visitor.field("eta_trim_deg_should_freeze", value.eta_trim_deg_should_freeze);
+  visitor.field("eta_trim_deg_reset", value.eta_trim_deg_reset);
+  visitor.field("eta_trim_deg_reset_deg", value.eta_trim_deg_reset_deg);
+  visitor.field("eta_trim_deg_should_write", value.eta_trim_deg_should_write);
+  visitor.field("eta_trim_deg_rate_limit_up_deg_s", value.eta_trim_deg_rate_limit_up_deg_s);
+  visitor.field("eta_trim_deg_rate_limit_lo_deg_s", value.eta_trim_deg_rate_limit_lo_deg_s);
+  visitor.field("flare_Theta_deg", value.flare_Theta_deg);
+  visitor.field("flare_Theta_c_deg", value.flare_Theta_c_deg);
+  visitor.field("flare_Theta_c_rate_deg_s", value.flare_Theta_c_rate_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_pitch_rotation_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_pitch_rotation& value) {
+  visitor.field("qk_c_deg_s", value.qk_c_deg_s);
+  visitor.field("eta_deg", value.eta_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_2OohiAWrazWy5wDS5iisgF_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_2OohiAWrazWy5wDS5iisgF& value) {
+  visitor.field("SSM", value.SSM);
+  visitor.field("Data", value.Data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_Tb3yuiM08uQe7QpDsuHA8B_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_Tb3yuiM08uQe7QpDsuHA8B& value) {
+  visitor.field("left_inboard_aileron_command_deg", value.left_inboard_aileron_command_deg);
+  visitor.field("right_inboard_aileron_command_deg", value.right_inboard_aileron_command_deg);
+  visitor.field("left_midboard_aileron_command_deg", value.left_midboard_aileron_command_deg);
+  visitor.field("right_midboard_aileron_command_deg", value.right_midboard_aileron_command_deg);
+  visitor.field("left_outboard_aileron_command_deg", value.left_outboard_aileron_command_deg);
+  visitor.field("right_outboard_aileron_command_deg", value.right_outboard_aileron_command_deg);
+  visitor.field("left_spoiler_1_command_deg", value.left_spoiler_1_command_deg);
+  visitor.field("right_spoiler_1_command_deg", value.right_spoiler_1_command_deg);
+  visitor.field("left_spoiler_2_command_deg", value.left_spoiler_2_command_deg);
+  visitor.field("right_spoiler_2_command_deg", value.right_spoiler_2_command_deg);
+  visitor.field("left_spoiler_3_command_deg", value.left_spoiler_3_command_deg);
+  visitor.field("right_spoiler_3_command_deg", value.right_spoiler_3_command_deg);
+  visitor.field("left_spoiler_4_command_deg", value.left_spoiler_4_command_deg);
+  visitor.field("right_spoiler_4_command_deg", value.right_spoiler_4_command_deg);
+  visitor.field("left_spoiler_5_command_deg", value.left_spoiler_5_command_deg);
+  visitor.field("right_spoiler_5_command_deg", value.right_spoiler_5_command_deg);
+  visitor.field("left_spoiler_6_command_deg", value.left_spoiler_6_command_deg);
+  visitor.field("right_spoiler_6_command_deg", value.right_spoiler_6_command_deg);
+  visitor.field("left_spoiler_7_command_deg", value.left_spoiler_7_command_deg);
+  visitor.field("right_spoiler_7_command_deg", value.right_spoiler_7_command_deg);
+  visitor.field("left_spoiler_8_command_deg", value.left_spoiler_8_command_deg);
+  visitor.field("right_spoiler_8_command_deg", value.right_spoiler_8_command_deg);
+  visitor.field("left_inboard_elevator_command_deg", value.left_inboard_elevator_command_deg);
+  visitor.field("right_inboard_elevator_command_deg", value.right_inboard_elevator_command_deg);
+  visitor.field("left_outboard_elevator_command_deg", value.left_outboard_elevator_command_deg);
+  visitor.field("right_outboard_elevator_command_deg", value.right_outboard_elevator_command_deg);
+  visitor.field("ths_command_deg", value.ths_command_deg);
+  visitor.field("upper_rudder_command_deg", value.upper_rudder_command_deg);
+  visitor.field("lower_rudder_command_deg", value.lower_rudder_command_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_status_word", value.aileron_status_word);
+  visitor.field("left_aileron_1_position_deg", value.left_aileron_1_position_deg);
+  visitor.field("left_aileron_2_position_deg", value.left_aileron_2_position_deg);
+  visitor.field("right_aileron_1_position_deg", value.right_aileron_1_position_deg);
+  visitor.field("right_aileron_2_position_deg", value.right_aileron_2_position_deg);
+  visitor.field("spoiler_status_word", value.spoiler_status_word);
+  visitor.field("left_spoiler_position_deg", value.left_spoiler_position_deg);
+  visitor.field("right_spoiler_position_deg", value.right_spoiler_position_deg);
+  visitor.field("elevator_status_word", value.elevator_status_word);
+  visitor.field("elevator_1_position_deg", value.elevator_1_position_deg);
+  visitor.field("elevator_2_position_deg", value.elevator_2_position_deg);
+  visitor.field("elevator_3_position_deg", value.elevator_3_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("rudder_status_word", value.rudder_status_word);
+  visitor.field("rudder_1_position_deg", value.rudder_1_position_deg);
+  visitor.field("rudder_2_position_deg", value.rudder_2_position_deg);
+  visitor.field("fctl_law_status_word", value.fctl_law_status_word);
+  visitor.field("misc_data_status_word", value.misc_data_status_word);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_discrete_inputs& value) {
+  visitor.field("sec_overhead_button_pressed", value.sec_overhead_button_pressed);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("is_unit_2", value.is_unit_2);
+  visitor.field("is_unit_3", value.is_unit_3);
+  visitor.field("capt_priority_takeover_pressed", value.capt_priority_takeover_pressed);
+  visitor.field("fo_priority_takeover_pressed", value.fo_priority_takeover_pressed);
+  visitor.field("rudder_trim_left_pressed", value.rudder_trim_left_pressed);
+  visitor.field("rudder_trim_right_pressed", value.rudder_trim_right_pressed);
+  visitor.field("rudder_trim_reset_pressed", value.rudder_trim_reset_pressed);
+  visitor.field("pitch_trim_up_pressed", value.pitch_trim_up_pressed);
+  visitor.field("pitch_trim_down_pressed", value.pitch_trim_down_pressed);
+  visitor.field("green_low_pressure", value.green_low_pressure);
+  visitor.field("yellow_low_pressure", value.yellow_low_pressure);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_analog_inputs& value) {
+  visitor.field("capt_pitch_stick_pos", value.capt_pitch_stick_pos);
+  visitor.field("fo_pitch_stick_pos", value.fo_pitch_stick_pos);
+  visitor.field("capt_roll_stick_pos", value.capt_roll_stick_pos);
+  visitor.field("fo_roll_stick_pos", value.fo_roll_stick_pos);
+  visitor.field("elevator_1_pos_deg", value.elevator_1_pos_deg);
+  visitor.field("elevator_2_pos_deg", value.elevator_2_pos_deg);
+  visitor.field("elevator_3_pos_deg", value.elevator_3_pos_deg);
+  visitor.field("ths_pos_deg", value.ths_pos_deg);
+  visitor.field("left_aileron_1_pos_deg", value.left_aileron_1_pos_deg);
+  visitor.field("left_aileron_2_pos_deg", value.left_aileron_2_pos_deg);
+  visitor.field("right_aileron_1_pos_deg", value.right_aileron_1_pos_deg);
+  visitor.field("right_aileron_2_pos_deg", value.right_aileron_2_pos_deg);
+  visitor.field("left_spoiler_1_pos_deg", value.left_spoiler_1_pos_deg);
+  visitor.field("right_spoiler_1_pos_deg", value.right_spoiler_1_pos_deg);
+  visitor.field("left_spoiler_2_pos_deg", value.left_spoiler_2_pos_deg);
+  visitor.field("right_spoiler_2_pos_deg", value.right_spoiler_2_pos_deg);
+  visitor.field("rudder_1_pos_deg", value.rudder_1_pos_deg);
+  visitor.field("rudder_2_pos_deg", value.rudder_2_pos_deg);
+  visitor.field("rudder_pedal_pos_deg", value.rudder_pedal_pos_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_bus_inputs& value) {
+  visitor.field("adr_1_bus", value.adr_1_bus);
+  visitor.field("adr_2_bus", value.adr_2_bus);
+  visitor.field("ir_1_bus", value.ir_1_bus);
+  visitor.field("ir_2_bus", value.ir_2_bus);
+  visitor.field("sfcc_1_bus", value.sfcc_1_bus);
+  visitor.field("sfcc_2_bus", value.sfcc_2_bus);
+  visitor.field("irdc_5_a_bus", value.irdc_5_a_bus);
+  visitor.field("irdc_5_b_bus", value.irdc_5_b_bus);
+  visitor.field("prim_1_bus", value.prim_1_bus);
+  visitor.field("prim_2_bus", value.prim_2_bus);
+  visitor.field("prim_3_bus", value.prim_3_bus);
+  visitor.field("sec_x_bus", value.sec_x_bus);
+  visitor.field("sec_y_bus", value.sec_y_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_sec_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, sec_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_lateral_surface_positions_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_lateral_surface_positions& value) {
+  visitor.field("left_aileron_1_command_deg", value.left_aileron_1_command_deg);
+  visitor.field("right_aileron_1_command_deg", value.right_aileron_1_command_deg);
+  visitor.field("left_aileron_2_command_deg", value.left_aileron_2_command_deg);
+  visitor.field("right_aileron_2_command_deg", value.right_aileron_2_command_deg);
+  visitor.field("left_spoiler_1_command_deg", value.left_spoiler_1_command_deg);
+  visitor.field("right_spoiler_1_command_deg", value.right_spoiler_1_command_deg);
+  visitor.field("left_spoiler_2_command_deg", value.left_spoiler_2_command_deg);
+  visitor.field("right_spoiler_2_command_deg", value.right_spoiler_2_command_deg);
+  visitor.field("rudder_1_command_deg", value.rudder_1_command_deg);
+  visitor.field("rudder_2_command_deg", value.rudder_2_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_pitch_surface_positions_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_pitch_surface_positions& value) {
+  visitor.field("elevator_1_command_deg", value.elevator_1_command_deg);
+  visitor.field("elevator_2_command_deg", value.elevator_2_command_deg);
+  visitor.field("elevator_3_command_deg", value.elevator_3_command_deg);
+  visitor.field("ths_command_deg", value.ths_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_laws_outputs& value) {
+  visitor.field("lateral_law_outputs", value.lateral_law_outputs);
+  visitor.field("pitch_law_outputs", value.pitch_law_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_logic_outputs& value) {
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("master_prim", value.master_prim);
+  visitor.field("active_lateral_law", value.active_lateral_law);
+  visitor.field("active_pitch_law", value.active_pitch_law);
+  visitor.field("elevator_1_avail", value.elevator_1_avail);
+  visitor.field("elevator_1_engaged", value.elevator_1_engaged);
+  visitor.field("elevator_2_avail", value.elevator_2_avail);
+  visitor.field("elevator_2_engaged", value.elevator_2_engaged);
+  visitor.field("elevator_3_avail", value.elevator_3_avail);
+  visitor.field("elevator_3_engaged", value.elevator_3_engaged);
+  visitor.field("ths_avail", value.ths_avail);
+  visitor.field("ths_engaged", value.ths_engaged);
+  visitor.field("left_aileron_1_avail", value.left_aileron_1_avail);
+  visitor.field("left_aileron_1_engaged", value.left_aileron_1_engaged);
+  visitor.field("left_aileron_2_avail", value.left_aileron_2_avail);
+  visitor.field("left_aileron_2_engaged", value.left_aileron_2_engaged);
+  visitor.field("right_aileron_1_avail", value.right_aileron_1_avail);
+  visitor.field("right_aileron_1_engaged", value.right_aileron_1_engaged);
+  visitor.field("right_aileron_2_avail", value.right_aileron_2_avail);
+  visitor.field("right_aileron_2_engaged", value.right_aileron_2_engaged);
+  visitor.field("left_spoiler_1_hydraulic_mode_avail", value.left_spoiler_1_hydraulic_mode_avail);
+  visitor.field("left_spoiler_1_hydraulic_mode_engaged", value.left_spoiler_1_hydraulic_mode_engaged);
+  visitor.field("right_spoiler_1_hydraulic_mode_avail", value.right_spoiler_1_hydraulic_mode_avail);
+  visitor.field("right_spoiler_1_hydraulic_mode_engaged", value.right_spoiler_1_hydraulic_mode_engaged);
+  visitor.field("left_spoiler_2_hydraulic_mode_avail", value.left_spoiler_2_hydraulic_mode_avail);
+  visitor.field("left_spoiler_2_hydraulic_mode_engaged", value.left_spoiler_2_hydraulic_mode_engaged);
+  visitor.field("right_spoiler_2_hydraulic_mode_avail", value.right_spoiler_2_hydraulic_mode_avail);
+  visitor.field("right_spoiler_2_hydraulic_mode_engaged", value.right_spoiler_2_hydraulic_mode_engaged);
+  visitor.field("rudder_1_hydraulic_mode_avail", value.rudder_1_hydraulic_mode_avail);
+  visitor.field("rudder_1_electric_mode_avail", value.rudder_1_electric_mode_avail);
+  visitor.field("rudder_1_hydraulic_mode_engaged", value.rudder_1_hydraulic_mode_engaged);
+  visitor.field("rudder_1_electric_mode_engaged", value.rudder_1_electric_mode_engaged);
+  visitor.field("rudder_2_hydraulic_mode_avail", value.rudder_2_hydraulic_mode_avail);
+  visitor.field("rudder_2_electric_mode_avail", value.rudder_2_electric_mode_avail);
+  visitor.field("rudder_2_hydraulic_mode_engaged", value.rudder_2_hydraulic_mode_engaged);
+  visitor.field("rudder_2_electric_mode_engaged", value.rudder_2_electric_mode_engaged);
+  visitor.field("rudder_trim_avail", value.rudder_trim_avail);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("aileron_droop_active", value.aileron_droop_active);
+  visitor.field("is_yellow_hydraulic_power_avail", value.is_yellow_hydraulic_power_avail);
+  visitor.field("is_green_hydraulic_power_avail", value.is_green_hydraulic_power_avail);
+  visitor.field("left_sidestick_disabled", value.left_sidestick_disabled);
+  visitor.field("right_sidestick_disabled", value.right_sidestick_disabled);
+  visitor.field("left_sidestick_priority_locked", value.left_sidestick_priority_locked);
+  visitor.field("right_sidestick_priority_locked", value.right_sidestick_priority_locked);
+  visitor.field("total_sidestick_pitch_command", value.total_sidestick_pitch_command);
+  visitor.field("total_sidestick_roll_command", value.total_sidestick_roll_command);
+  visitor.field("phased_lift_dumping_active", value.phased_lift_dumping_active);
+  visitor.field("double_adr_failure", value.double_adr_failure);
+  visitor.field("cas_or_mach_disagree", value.cas_or_mach_disagree);
+  visitor.field("alpha_disagree", value.alpha_disagree);
+  visitor.field("double_ir_failure", value.double_ir_failure);
+  visitor.field("ir_failure_not_self_detected", value.ir_failure_not_self_detected);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_discrete_outputs& value) {
+  visitor.field("elevator_1_active_mode", value.elevator_1_active_mode);
+  visitor.field("elevator_2_active_mode", value.elevator_2_active_mode);
+  visitor.field("elevator_3_active_mode", value.elevator_3_active_mode);
+  visitor.field("ths_active_mode", value.ths_active_mode);
+  visitor.field("left_aileron_1_active_mode", value.left_aileron_1_active_mode);
+  visitor.field("left_aileron_2_active_mode", value.left_aileron_2_active_mode);
+  visitor.field("right_aileron_1_active_mode", value.right_aileron_1_active_mode);
+  visitor.field("right_aileron_2_active_mode", value.right_aileron_2_active_mode);
+  visitor.field("rudder_1_hydraulic_active_mode", value.rudder_1_hydraulic_active_mode);
+  visitor.field("rudder_1_electric_active_mode", value.rudder_1_electric_active_mode);
+  visitor.field("rudder_2_hydraulic_active_mode", value.rudder_2_hydraulic_active_mode);
+  visitor.field("rudder_2_electric_active_mode", value.rudder_2_electric_active_mode);
+  visitor.field("rudder_trim_active_mode", value.rudder_trim_active_mode);
+  visitor.field("sec_healthy", value.sec_healthy);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_sec_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_sec_analog_outputs& value) {
+  visitor.field("elevator_1_pos_order_deg", value.elevator_1_pos_order_deg);
+  visitor.field("elevator_2_pos_order_deg", value.elevator_2_pos_order_deg);
+  visitor.field("elevator_3_pos_order_deg", value.elevator_3_pos_order_deg);
+  visitor.field("ths_pos_order_deg", value.ths_pos_order_deg);
+  visitor.field("left_aileron_1_pos_order_deg", value.left_aileron_1_pos_order_deg);
+  visitor.field("left_aileron_2_pos_order_deg", value.left_aileron_2_pos_order_deg);
+  visitor.field("right_aileron_1_pos_order_deg", value.right_aileron_1_pos_order_deg);
+  visitor.field("right_aileron_2_pos_order_deg", value.right_aileron_2_pos_order_deg);
+  visitor.field("left_spoiler_1_pos_order_deg", value.left_spoiler_1_pos_order_deg);
+  visitor.field("right_spoiler_1_pos_order_deg", value.right_spoiler_1_pos_order_deg);
+  visitor.field("left_spoiler_2_pos_order_deg", value.left_spoiler_2_pos_order_deg);
+  visitor.field("right_spoiler_2_pos_order_deg", value.right_spoiler_2_pos_order_deg);
+  visitor.field("rudder_1_pos_order_deg", value.rudder_1_pos_order_deg);
+  visitor.field("rudder_2_pos_order_deg", value.rudder_2_pos_order_deg);
+  visitor.field("rudder_trim_pos_order_deg", value.rudder_trim_pos_order_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_sec_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, sec_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_6VfXUKTenMAzoBANFhRdsG_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_6VfXUKTenMAzoBANFhRdsG& value) {
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("master_prim", value.master_prim);
+  visitor.field("active_lateral_law", value.active_lateral_law);
+  visitor.field("active_pitch_law", value.active_pitch_law);
+  visitor.field("elevator_1_avail", value.elevator_1_avail);
+  visitor.field("elevator_1_engaged", value.elevator_1_engaged);
+  visitor.field("elevator_2_avail", value.elevator_2_avail);
+  visitor.field("elevator_2_engaged", value.elevator_2_engaged);
+  visitor.field("elevator_3_avail", value.elevator_3_avail);
+  visitor.field("elevator_3_engaged", value.elevator_3_engaged);
+  visitor.field("ths_avail", value.ths_avail);
+  visitor.field("ths_engaged", value.ths_engaged);
+  visitor.field("left_aileron_1_avail", value.left_aileron_1_avail);
+  visitor.field("left_aileron_1_engaged", value.left_aileron_1_engaged);
+  visitor.field("left_aileron_2_avail", value.left_aileron_2_avail);
+  visitor.field("left_aileron_2_engaged", value.left_aileron_2_engaged);
+  visitor.field("right_aileron_1_avail", value.right_aileron_1_avail);
+  visitor.field("right_aileron_1_engaged", value.right_aileron_1_engaged);
+  visitor.field("right_aileron_2_avail", value.right_aileron_2_avail);
+  visitor.field("right_aileron_2_engaged", value.right_aileron_2_engaged);
+  visitor.field("left_spoiler_1_hydraulic_mode_avail", value.left_spoiler_1_hydraulic_mode_avail);
+  visitor.field("left_spoiler_1_hydraulic_mode_engaged", value.left_spoiler_1_hydraulic_mode_engaged);
+  visitor.field("right_spoiler_1_hydraulic_mode_avail", value.right_spoiler_1_hydraulic_mode_avail);
+  visitor.field("right_spoiler_1_hydraulic_mode_engaged", value.right_spoiler_1_hydraulic_mode_engaged);
+  visitor.field("left_spoiler_2_hydraulic_mode_avail", value.left_spoiler_2_hydraulic_mode_avail);
+  visitor.field("left_spoiler_2_hydraulic_mode_engaged", value.left_spoiler_2_hydraulic_mode_engaged);
+  visitor.field("right_spoiler_2_hydraulic_mode_avail", value.right_spoiler_2_hydraulic_mode_avail);
+  visitor.field("right_spoiler_2_hydraulic_mode_engaged", value.right_spoiler_2_hydraulic_mode_engaged);
+  visitor.field("rudder_1_hydraulic_mode_avail", value.rudder_1_hydraulic_mode_avail);
+  visitor.field("rudder_1_electric_mode_avail", value.rudder_1_electric_mode_avail);
+  visitor.field("rudder_1_hydraulic_mode_engaged", value.rudder_1_hydraulic_mode_engaged);
+  visitor.field("rudder_1_electric_mode_engaged", value.rudder_1_electric_mode_engaged);
+  visitor.field("rudder_2_hydraulic_mode_avail", value.rudder_2_hydraulic_mode_avail);
+  visitor.field("rudder_2_electric_mode_avail", value.rudder_2_electric_mode_avail);
+  visitor.field("rudder_2_hydraulic_mode_engaged", value.rudder_2_hydraulic_mode_engaged);
+  visitor.field("rudder_2_electric_mode_engaged", value.rudder_2_electric_mode_engaged);
+  visitor.field("rudder_trim_avail", value.rudder_trim_avail);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("aileron_droop_active", value.aileron_droop_active);
+  visitor.field("is_yellow_hydraulic_power_avail", value.is_yellow_hydraulic_power_avail);
+  visitor.field("is_green_hydraulic_power_avail", value.is_green_hydraulic_power_avail);
+  visitor.field("left_sidestick_disabled", value.left_sidestick_disabled);
+  visitor.field("right_sidestick_disabled", value.right_sidestick_disabled);
+  visitor.field("left_sidestick_priority_locked", value.left_sidestick_priority_locked);
+  visitor.field("right_sidestick_priority_locked", value.right_sidestick_priority_locked);
+  visitor.field("total_sidestick_pitch_command", value.total_sidestick_pitch_command);
+  visitor.field("total_sidestick_roll_command", value.total_sidestick_roll_command);
+  visitor.field("phased_lift_dumping_active", value.phased_lift_dumping_active);
+  visitor.field("double_adr_failure", value.double_adr_failure);
+  visitor.field("cas_or_mach_disagree", value.cas_or_mach_disagree);
+  visitor.field("alpha_disagree", value.alpha_disagree);
+  visitor.field("double_ir_failure", value.double_ir_failure);
+  visitor.field("ir_failure_not_self_detected", value.ir_failure_not_self_detected);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_W6au3j0oCs6HSrPmc8YjEH_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_W6au3j0oCs6HSrPmc8YjEH& value) {
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_status_word", value.aileron_status_word);
+  visitor.field("left_aileron_1_position_deg", value.left_aileron_1_position_deg);
+  visitor.field("left_aileron_2_position_deg", value.left_aileron_2_position_deg);
+  visitor.field("right_aileron_1_position_deg", value.right_aileron_1_position_deg);
+  visitor.field("right_aileron_2_position_deg", value.right_aileron_2_position_deg);
+  visitor.field("spoiler_status_word", value.spoiler_status_word);
+  visitor.field("left_spoiler_1_position_deg", value.left_spoiler_1_position_deg);
+  visitor.field("right_spoiler_1_position_deg", value.right_spoiler_1_position_deg);
+  visitor.field("left_spoiler_2_position_deg", value.left_spoiler_2_position_deg);
+  visitor.field("right_spoiler_2_position_deg", value.right_spoiler_2_position_deg);
+  visitor.field("elevator_status_word", value.elevator_status_word);
+  visitor.field("elevator_1_position_deg", value.elevator_1_position_deg);
+  visitor.field("elevator_2_position_deg", value.elevator_2_position_deg);
+  visitor.field("elevator_3_position_deg", value.elevator_3_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("rudder_status_word", value.rudder_status_word);
+  visitor.field("rudder_1_position_deg", value.rudder_1_position_deg);
+  visitor.field("rudder_2_position_deg", value.rudder_2_position_deg);
+  visitor.field("fctl_law_status_word", value.fctl_law_status_word);
+  visitor.field("misc_data_status_word", value.misc_data_status_word);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_discrete_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_discrete_inputs& value) {
+  visitor.field("ap_own_engaged", value.ap_own_engaged);
+  visitor.field("ap_opp_engaged", value.ap_opp_engaged);
+  visitor.field("yaw_damper_opp_engaged", value.yaw_damper_opp_engaged);
+  visitor.field("rudder_trim_opp_engaged", value.rudder_trim_opp_engaged);
+  visitor.field("rudder_travel_lim_opp_engaged", value.rudder_travel_lim_opp_engaged);
+  visitor.field("elac_1_healthy", value.elac_1_healthy);
+  visitor.field("elac_2_healthy", value.elac_2_healthy);
+  visitor.field("engine_1_stopped", value.engine_1_stopped);
+  visitor.field("engine_2_stopped", value.engine_2_stopped);
+  visitor.field("rudder_trim_switch_left", value.rudder_trim_switch_left);
+  visitor.field("rudder_trim_switch_right", value.rudder_trim_switch_right);
+  visitor.field("rudder_trim_reset_button", value.rudder_trim_reset_button);
+  visitor.field("fac_engaged_from_switch", value.fac_engaged_from_switch);
+  visitor.field("fac_opp_healthy", value.fac_opp_healthy);
+  visitor.field("is_unit_1", value.is_unit_1);
+  visitor.field("rudder_trim_actuator_healthy", value.rudder_trim_actuator_healthy);
+  visitor.field("rudder_travel_lim_actuator_healthy", value.rudder_travel_lim_actuator_healthy);
+  visitor.field("slats_extended", value.slats_extended);
+  visitor.field("nose_gear_pressed", value.nose_gear_pressed);
+  visitor.field("ir_3_switch", value.ir_3_switch);
+  visitor.field("adr_3_switch", value.adr_3_switch);
+  visitor.field("yaw_damper_has_hyd_press", value.yaw_damper_has_hyd_press);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_analog_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_analog_inputs& value) {
+  visitor.field("yaw_damper_position_deg", value.yaw_damper_position_deg);
+  visitor.field("rudder_trim_position_deg", value.rudder_trim_position_deg);
+  visitor.field("rudder_travel_lim_position_deg", value.rudder_travel_lim_position_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("gamma_a_deg", value.gamma_a_deg);
+  visitor.field("gamma_t_deg", value.gamma_t_deg);
+  visitor.field("total_weight_lbs", value.total_weight_lbs);
+  visitor.field("center_of_gravity_pos_percent", value.center_of_gravity_pos_percent);
+  visitor.field("sideslip_target_deg", value.sideslip_target_deg);
+  visitor.field("fac_slat_angle_deg", value.fac_slat_angle_deg);
+  visitor.field("fac_flap_angle", value.fac_flap_angle);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("rudder_travel_limit_command_deg", value.rudder_travel_limit_command_deg);
+  visitor.field("delta_r_yaw_damper_deg", value.delta_r_yaw_damper_deg);
+  visitor.field("estimated_sideslip_deg", value.estimated_sideslip_deg);
+  visitor.field("v_alpha_lim_kn", value.v_alpha_lim_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("speed_trend_kn", value.speed_trend_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("discrete_word_5", value.discrete_word_5);
+  visitor.field("delta_r_rudder_trim_deg", value.delta_r_rudder_trim_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fmgc_b_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fmgc_b_bus& value) {
+  visitor.field("fac_weight_lbs", value.fac_weight_lbs);
+  visitor.field("fm_weight_lbs", value.fm_weight_lbs);
+  visitor.field("fac_cg_percent", value.fac_cg_percent);
+  visitor.field("fm_cg_percent", value.fm_cg_percent);
+  visitor.field("fg_radio_height_ft", value.fg_radio_height_ft);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("ats_discrete_word", value.ats_discrete_word);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("approach_spd_target_kn", value.approach_spd_target_kn);
+  visitor.field("delta_p_ail_cmd_deg", value.delta_p_ail_cmd_deg);
+  visitor.field("delta_p_splr_cmd_deg", value.delta_p_splr_cmd_deg);
+  visitor.field("delta_r_cmd_deg", value.delta_r_cmd_deg);
+  visitor.field("delta_nose_wheel_cmd_deg", value.delta_nose_wheel_cmd_deg);
+  visitor.field("delta_q_cmd_deg", value.delta_q_cmd_deg);
+  visitor.field("n1_left_percent", value.n1_left_percent);
+  visitor.field("n1_right_percent", value.n1_right_percent);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_lgciu_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_lgciu_bus& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_elac_out_bus_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_elac_out_bus& value) {
+  visitor.field("left_aileron_position_deg", value.left_aileron_position_deg);
+  visitor.field("right_aileron_position_deg", value.right_aileron_position_deg);
+  visitor.field("left_elevator_position_deg", value.left_elevator_position_deg);
+  visitor.field("right_elevator_position_deg", value.right_elevator_position_deg);
+  visitor.field("ths_position_deg", value.ths_position_deg);
+  visitor.field("left_sidestick_pitch_command_deg", value.left_sidestick_pitch_command_deg);
+  visitor.field("right_sidestick_pitch_command_deg", value.right_sidestick_pitch_command_deg);
+  visitor.field("left_sidestick_roll_command_deg", value.left_sidestick_roll_command_deg);
+  visitor.field("right_sidestick_roll_command_deg", value.right_sidestick_roll_command_deg);
+  visitor.field("rudder_pedal_position_deg", value.rudder_pedal_position_deg);
+  visitor.field("aileron_command_deg", value.aileron_command_deg);
+  visitor.field("roll_spoiler_command_deg", value.roll_spoiler_command_deg);
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("elevator_double_pressurization_command_deg", value.elevator_double_pressurization_command_deg);
+  visitor.field("speedbrake_extension_deg", value.speedbrake_extension_deg);
+  visitor.field("discrete_status_word_1", value.discrete_status_word_1);
+  visitor.field("discrete_status_word_2", value.discrete_status_word_2);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_bus_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_bus_inputs& value) {
+  visitor.field("fac_opp_bus", value.fac_opp_bus);
+  visitor.field("adr_own_bus", value.adr_own_bus);
+  visitor.field("adr_opp_bus", value.adr_opp_bus);
+  visitor.field("adr_3_bus", value.adr_3_bus);
+  visitor.field("ir_own_bus", value.ir_own_bus);
+  visitor.field("ir_opp_bus", value.ir_opp_bus);
+  visitor.field("ir_3_bus", value.ir_3_bus);
+  visitor.field("fmgc_own_bus", value.fmgc_own_bus);
+  visitor.field("fmgc_opp_bus", value.fmgc_opp_bus);
+  visitor.field("sfcc_own_bus", value.sfcc_own_bus);
+  visitor.field("lgciu_own_bus", value.lgciu_own_bus);
+  visitor.field("elac_1_bus", value.elac_1_bus);
+  visitor.field("elac_2_bus", value.elac_2_bus);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_fac_inputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, fac_inputs& value) {
+  visitor.field("time", value.time);
+  visitor.field("sim_data", value.sim_data);
+  visitor.field("discrete_inputs", value.discrete_inputs);
+  visitor.field("analog_inputs", value.analog_inputs);
+  visitor.field("bus_inputs", value.bus_inputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_laws_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_laws_outputs& value) {
+  visitor.field("yaw_damper_command_deg", value.yaw_damper_command_deg);
+  visitor.field("rudder_trim_command_deg", value.rudder_trim_command_deg);
+  visitor.field("rudder_travel_lim_command_deg", value.rudder_travel_lim_command_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_adr_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_adr_computation_data& value) {
+  visitor.field("V_ias_kn", value.V_ias_kn);
+  visitor.field("V_tas_kn", value.V_tas_kn);
+  visitor.field("mach", value.mach);
+  visitor.field("alpha_deg", value.alpha_deg);
+  visitor.field("p_s_c_hpa", value.p_s_c_hpa);
+  visitor.field("altitude_corrected_ft", value.altitude_corrected_ft);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_ir_computation_data_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_ir_computation_data& value) {
+  visitor.field("theta_deg", value.theta_deg);
+  visitor.field("phi_deg", value.phi_deg);
+  visitor.field("q_deg_s", value.q_deg_s);
+  visitor.field("r_deg_s", value.r_deg_s);
+  visitor.field("n_x_g", value.n_x_g);
+  visitor.field("n_y_g", value.n_y_g);
+  visitor.field("n_z_g", value.n_z_g);
+  visitor.field("theta_dot_deg_s", value.theta_dot_deg_s);
+  visitor.field("phi_dot_deg_s", value.phi_dot_deg_s);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_logic_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_logic_outputs& value) {
+  visitor.field("lgciu_own_valid", value.lgciu_own_valid);
+  visitor.field("all_lgciu_lost", value.all_lgciu_lost);
+  visitor.field("left_main_gear_pressed", value.left_main_gear_pressed);
+  visitor.field("right_main_gear_pressed", value.right_main_gear_pressed);
+  visitor.field("main_gear_out", value.main_gear_out);
+  visitor.field("on_ground", value.on_ground);
+  visitor.field("tracking_mode_on", value.tracking_mode_on);
+  visitor.field("double_self_detected_adr_failure", value.double_self_detected_adr_failure);
+  visitor.field("double_self_detected_ir_failure", value.double_self_detected_ir_failure);
+  visitor.field("double_not_self_detected_adr_failure", value.double_not_self_detected_adr_failure);
+  visitor.field("double_not_self_detected_ir_failure", value.double_not_self_detected_ir_failure);
+  visitor.field("adr_computation_data", value.adr_computation_data);
+  visitor.field("ir_computation_data", value.ir_computation_data);
+  visitor.field("yaw_damper_engaged", value.yaw_damper_engaged);
+  visitor.field("yaw_damper_can_engage", value.yaw_damper_can_engage);
+  visitor.field("yaw_damper_has_priority", value.yaw_damper_has_priority);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("rudder_trim_can_engage", value.rudder_trim_can_engage);
+  visitor.field("rudder_trim_has_priority", value.rudder_trim_has_priority);
+  visitor.field("rudder_travel_lim_engaged", value.rudder_travel_lim_engaged);
+  visitor.field("rudder_travel_lim_can_engage", value.rudder_travel_lim_can_engage);
+  visitor.field("rudder_travel_lim_has_priority", value.rudder_travel_lim_has_priority);
+  visitor.field("speed_scale_lost", value.speed_scale_lost);
+  visitor.field("speed_scale_visible", value.speed_scale_visible);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_flight_envelope_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_flight_envelope_outputs& value) {
+  visitor.field("estimated_beta_deg", value.estimated_beta_deg);
+  visitor.field("beta_target_deg", value.beta_target_deg);
+  visitor.field("beta_target_visible", value.beta_target_visible);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("alpha_filtered_deg", value.alpha_filtered_deg);
+  visitor.field("computed_weight_lbs", value.computed_weight_lbs);
+  visitor.field("computed_cg_percent", value.computed_cg_percent);
+  visitor.field("v_alpha_max_kn", value.v_alpha_max_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_3_visible", value.v_3_visible);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_4_visible", value.v_4_visible);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_man_visible", value.v_man_visible);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("v_fe_next_visible", value.v_fe_next_visible);
+  visitor.field("v_c_trend_kn", value.v_c_trend_kn);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_discrete_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_discrete_outputs& value) {
+  visitor.field("fac_healthy", value.fac_healthy);
+  visitor.field("yaw_damper_engaged", value.yaw_damper_engaged);
+  visitor.field("rudder_trim_engaged", value.rudder_trim_engaged);
+  visitor.field("rudder_travel_lim_engaged", value.rudder_travel_lim_engaged);
+  visitor.field("rudder_travel_lim_emergency_reset", value.rudder_travel_lim_emergency_reset);
+  visitor.field("yaw_damper_avail_for_norm_law", value.yaw_damper_avail_for_norm_law);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_base_fac_analog_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, base_fac_analog_outputs& value) {
+  visitor.field("yaw_damper_order_deg", value.yaw_damper_order_deg);
+  visitor.field("rudder_trim_order_deg", value.rudder_trim_order_deg);
+  visitor.field("rudder_travel_limit_order_deg", value.rudder_travel_limit_order_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_fac_outputs_
+template <typename Visitor>
+void visitFields(Visitor& visitor, fac_outputs& value) {
+  visitor.field("data", value.data);
+  visitor.field("laws", value.laws);
+  visitor.field("logic", value.logic);
+  visitor.field("flight_envelope", value.flight_envelope);
+  visitor.field("discrete_outputs", value.discrete_outputs);
+  visitor.field("analog_outputs", value.analog_outputs);
+  visitor.field("bus_outputs", value.bus_outputs);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_fAEsrEZhvvruiP1ICEwvRC_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_fAEsrEZhvvruiP1ICEwvRC& value) {
+  visitor.field("discrete_word_1", value.discrete_word_1);
+  visitor.field("gamma_a_deg", value.gamma_a_deg);
+  visitor.field("gamma_t_deg", value.gamma_t_deg);
+  visitor.field("total_weight_lbs", value.total_weight_lbs);
+  visitor.field("center_of_gravity_pos_percent", value.center_of_gravity_pos_percent);
+  visitor.field("sideslip_target_deg", value.sideslip_target_deg);
+  visitor.field("fac_slat_angle_deg", value.fac_slat_angle_deg);
+  visitor.field("fac_flap_angle", value.fac_flap_angle);
+  visitor.field("discrete_word_2", value.discrete_word_2);
+  visitor.field("rudder_travel_limit_command_deg", value.rudder_travel_limit_command_deg);
+  visitor.field("delta_r_yaw_damper_deg", value.delta_r_yaw_damper_deg);
+  visitor.field("estimated_sideslip_deg", value.estimated_sideslip_deg);
+  visitor.field("v_alpha_lim_kn", value.v_alpha_lim_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("speed_trend_kn", value.speed_trend_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("discrete_word_3", value.discrete_word_3);
+  visitor.field("discrete_word_4", value.discrete_word_4);
+  visitor.field("discrete_word_5", value.discrete_word_5);
+  visitor.field("delta_r_rudder_trim_deg", value.delta_r_rudder_trim_deg);
+  visitor.field("rudder_trim_pos_deg", value.rudder_trim_pos_deg);
+}
+#endif
+
+#ifdef DEFINED_TYPEDEF_FOR_struct_NHciy9HFthvyJ1C8wWfWlB_
+template <typename Visitor>
+void visitFields(Visitor& visitor, struct_NHciy9HFthvyJ1C8wWfWlB& value) {
+  visitor.field("estimated_beta_deg", value.estimated_beta_deg);
+  visitor.field("beta_target_deg", value.beta_target_deg);
+  visitor.field("beta_target_visible", value.beta_target_visible);
+  visitor.field("alpha_floor_condition", value.alpha_floor_condition);
+  visitor.field("alpha_filtered_deg", value.alpha_filtered_deg);
+  visitor.field("computed_weight_lbs", value.computed_weight_lbs);
+  visitor.field("computed_cg_percent", value.computed_cg_percent);
+  visitor.field("v_alpha_max_kn", value.v_alpha_max_kn);
+  visitor.field("v_alpha_prot_kn", value.v_alpha_prot_kn);
+  visitor.field("v_stall_warn_kn", value.v_stall_warn_kn);
+  visitor.field("v_ls_kn", value.v_ls_kn);
+  visitor.field("v_stall_kn", value.v_stall_kn);
+  visitor.field("v_3_kn", value.v_3_kn);
+  visitor.field("v_3_visible", value.v_3_visible);
+  visitor.field("v_4_kn", value.v_4_kn);
+  visitor.field("v_4_visible", value.v_4_visible);
+  visitor.field("v_man_kn", value.v_man_kn);
+  visitor.field("v_man_visible", value.v_man_visible);
+  visitor.field("v_max_kn", value.v_max_kn);
+  visitor.field("v_fe_next_kn", value.v_fe_next_kn);
+  visitor.field("v_fe_next_visible", value.v_fe_next_visible);
+  visitor.field("v_c_trend_kn", value.v_c_trend_kn);
+}
+#endif
@@ -0,0 +1,302 @@
+#include "ComputerRig.h"
+
+#include "FieldVisitors.h"
+#include "SensorBuses.h"
+#include "fac/Fac.h"
+#include "prim/Prim.h"
+#include "sec/Sec.h"
+
+#include "A380xFields.h"
+
+struct ComputerRig::Computers {
+  SensorBuses sensors;
+
+  Prim prims[3] = {Prim(true, false, false), Prim(false, true, false), Prim(false, false, true)};
+  base_prim_discrete_outputs primsDiscreteOutputs[3] = {};
+  base_prim_analog_outputs primsAnalogOutputs[3] = {};
+  base_prim_out_bus primsBusOutputs[3] = {};
+
+  Sec secs[3] = {Sec(true, false, false), Sec(false, true, false), Sec(false, false, true)};
+  base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
+  base_sec_analog_outputs secsAnalogOutputs[3] = {};
+  base_sec_out_bus secsBusOutputs[3] = {};
+
+  Fac facs[2] = {Fac(true), Fac(false)};
+  base_fac_discrete_outputs facsDiscreteOutputs[2] = {};
+  base_fac_analog_outputs facsAnalogOutputs[2] = {};
+  base_fac_bus facsBusOutputs[2] = {};
+
+  template <typename Visitor>
+  void visitOutputs(Visitor& visitor) {
+    visitor.field("prim_discrete", primsDiscreteOutputs);
+    visitor.field("prim_analog", primsAnalogOutputs);
+    visitor.field("prim_bus", primsBusOutputs);
+    visitor.field("sec_discrete", secsDiscreteOutputs);
+    visitor.field("sec_analog", secsAnalogOutputs);
+    visitor.field("sec_bus", secsBusOutputs);
+    visitor.field("fac_discrete", facsDiscreteOutputs);
+    visitor.field("fac_analog", facsAnalogOutputs);
+    visitor.field("fac_bus", facsBusOutputs);
+  }
+
+  void updatePrim(const AircraftState& state, int primIndex);
+
+  void updateSec(const AircraftState& state, int secIndex);
+
+  void updateFac(const AircraftState& state, int facIndex);
+
+  void snapshot(ModelSnapshotWriter& writer) const;
+
+  bool restore(ModelSnapshotReader& reader);
+};
+
+void ComputerRig::Computers::updatePrim(const AircraftState& state, int primIndex) {
+  auto& in = prims[primIndex].modelInputs.in;
+  const auto& orders = primsAnalogOutputs[primIndex];
+
+  in.time.dt = state.dt;
+  in.time.simulation_time = state.time;
+  in.time.monotonic_time = state.time;
+
+  in.discrete_inputs.prim_overhead_button_pressed = true;
+  in.discrete_inputs.is_unit_1 = primIndex == 0;
+  in.discrete_inputs.is_unit_2 = primIndex == 1;
+  in.discrete_inputs.is_unit_3 = primIndex == 2;
+  in.discrete_inputs.green_low_pressure = !state.greenPressurised;
+  in.discrete_inputs.yellow_low_pressure = !state.yellowPressurised;
+
+  in.analog_inputs.capt_pitch_stick_pos = state.captPitchStick;
+  in.analog_inputs.capt_roll_stick_pos = state.captRollStick;
+  in.analog_inputs.speed_brake_lever_pos = state.speedBrakeLever;
+  in.analog_inputs.thr_lever_1_pos = state.thrustLever;
+  in.analog_inputs.thr_lever_2_pos = state.thrustLever;
+  in.analog_inputs.thr_lever_3_pos = state.thrustLever;
+  in.analog_inputs.thr_lever_4_pos = state.thrustLever;
+  in.analog_inputs.elevator_1_pos_deg = orders.elevator_1_pos_order_deg;
+  in.analog_inputs.elevator_2_pos_deg = orders.elevator_2_pos_order_deg;
+  in.analog_inputs.elevator_3_pos_deg = orders.elevator_3_pos_order_deg;
+  in.analog_inputs.ths_pos_deg = orders.ths_pos_order_deg;
+  in.analog_inputs.left_aileron_1_pos_deg = orders.left_aileron_1_pos_order_deg;
+  in.analog_inputs.left_aileron_2_pos_deg = orders.left_aileron_2_pos_order_deg;
+  in.analog_inputs.right_aileron_1_pos_deg = orders.right_aileron_1_pos_order_deg;
+  in.analog_inputs.right_aileron_2_pos_deg = orders.right_aileron_2_pos_order_deg;
+  in.analog_inputs.left_spoiler_pos_deg = orders.left_spoiler_pos_order_deg;
+  in.analog_inputs.right_spoiler_pos_deg = orders.right_spoiler_pos_order_deg;
+  in.analog_inputs.rudder_1_pos_deg = orders.rudder_1_pos_order_deg;
+  in.analog_inputs.rudder_2_pos_deg = orders.rudder_2_pos_order_deg;
+  in.analog_inputs.rudder_pedal_pos = state.rudderPedal;
+  in.analog_inputs.yellow_hyd_pressure_psi = state.yellowPressurised ? 5000 : 0;
+  in.analog_inputs.green_hyd_pressure_psi = state.greenPressurised ? 5000 : 0;
+  in.analog_inputs.left_body_wheel_speed = state.wheelSpeed_kn;
+  in.analog_inputs.left_wing_wheel_speed = state.wheelSpeed_kn;
+  in.analog_inputs.right_body_wheel_speed = state.wheelSpeed_kn;
+  in.analog_inputs.right_wing_wheel_speed = state.wheelSpeed_kn;
+
+  in.bus_inputs.adr_1_bus = sensors.adr[0];
+  in.bus_inputs.adr_2_bus = sensors.adr[1];
+  in.bus_inputs.adr_3_bus = sensors.adr[2];
+  in.bus_inputs.ir_1_bus = sensors.ir[0];
+  in.bus_inputs.ir_2_bus = sensors.ir[1];
+  in.bus_inputs.ir_3_bus = sensors.ir[2];
+  // each PRIM reads two of the three radio altimeters
+  in.bus_inputs.ra_1_bus = sensors.ra[primIndex == 1 ? 1 : 0];
+  in.bus_inputs.ra_2_bus = sensors.ra[primIndex == 2 ? 1 : 2];
+  in.bus_inputs.sfcc_1_bus = sensors.sfcc[0];
+  in.bus_inputs.sfcc_2_bus = sensors.sfcc[1];
+  in.bus_inputs.prim_x_bus = primsBusOutputs[primIndex == 0 ? 1 : 0];
+  in.bus_inputs.prim_y_bus = primsBusOutputs[primIndex == 2 ? 1 : 2];
+  in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+  in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+  in.bus_inputs.sec_3_bus = secsBusOutputs[2];
+
+  // the PRIMs share the ELAC failure indices, like in the FlyByWireInterface
+  prims[primIndex].update(state.dt, state.time, state.isActive(primIndex == 0 ? Failures::Elac1 : Failures::Elac2), state.powered);
+
+  primsDiscreteOutputs[primIndex] = prims[primIndex].getDiscreteOutputs();
+  primsAnalogOutputs[primIndex] = prims[primIndex].getAnalogOutputs();
+  primsBusOutputs[primIndex] = prims[primIndex].getBusOutputs();
+}
+
+void ComputerRig::Computers::updateSec(const AircraftState& state, int secIndex) {
+  auto& in = secs[secIndex].modelInputs.in;
+  const auto& orders = secsAnalogOutputs[secIndex];
+
+  in.time.dt = state.dt;
+  in.time.simulation_time = state.time;
+  in.time.monotonic_time = state.time;
+
+  in.discrete_inputs.sec_overhead_button_pressed = true;
+  in.discrete_inputs.is_unit_1 = secIndex == 0;
+  in.discrete_inputs.is_unit_2 = secIndex == 1;
+  in.discrete_inputs.is_unit_3 = secIndex == 2;
+  in.discrete_inputs.green_low_pressure = !state.greenPressurised;
+  in.discrete_inputs.yellow_low_pressure = !state.yellowPressurised;
+
+  in.analog_inputs.capt_pitch_stick_pos = state.captPitchStick;
+  in.analog_inputs.capt_roll_stick_pos = state.captRollStick;
+  in.analog_inputs.elevator_1_pos_deg = orders.elevator_1_pos_order_deg;
+  in.analog_inputs.elevator_2_pos_deg = orders.elevator_2_pos_order_deg;
+  in.analog_inputs.elevator_3_pos_deg = orders.elevator_3_pos_order_deg;
+  in.analog_inputs.ths_pos_deg = orders.ths_pos_order_deg;
+  in.analog_inputs.left_aileron_1_pos_deg = orders.left_aileron_1_pos_order_deg;
+  in.analog_inputs.left_aileron_2_pos_deg = orders.left_aileron_2_pos_order_deg;
+  in.analog_inputs.right_aileron_1_pos_deg = orders.right_aileron_1_pos_order_deg;
+  in.analog_inputs.right_aileron_2_pos_deg = orders.right_aileron_2_pos_order_deg;
+  in.analog_inputs.left_spoiler_1_pos_deg = orders.left_spoiler_1_pos_order_deg;
+  in.analog_inputs.right_spoiler_1_pos_deg = orders.right_spoiler_1_pos_order_deg;
+  in.analog_inputs.left_spoiler_2_pos_deg = orders.left_spoiler_2_pos_order_deg;
+  in.analog_inputs.right_spoiler_2_pos_deg = orders.right_spoiler_2_pos_order_deg;
+  in.analog_inputs.rudder_1_pos_deg = orders.rudder_1_pos_order_deg;
+  in.analog_inputs.rudder_2_pos_deg = orders.rudder_2_pos_order_deg;
+  in.analog_inputs.rudder_pedal_pos_deg = state.rudderPedal;
+  in.analog_inputs.rudder_trim_pos_deg = orders.rudder_trim_pos_order_deg;
+
+  // each SEC reads two of the three ADIRUs
+  const int firstAdiru = secIndex == 1 ? 1 : 0;
+  const int secondAdiru = secIndex == 0 ? 1 : 2;
+  in.bus_inputs.adr_1_bus = sensors.adr[firstAdiru];
+  in.bus_inputs.adr_2_bus = sensors.adr[secondAdiru];
+  in.bus_inputs.ir_1_bus = sensors.ir[firstAdiru];
+  in.bus_inputs.ir_2_bus = sensors.ir[secondAdiru];
+  in.bus_inputs.sfcc_1_bus = sensors.sfcc[0];
+  in.bus_inputs.sfcc_2_bus = sensors.sfcc[1];
+  in.bus_inputs.prim_1_bus = primsBusOutputs[0];
+  in.bus_inputs.prim_2_bus = primsBusOutputs[1];
+  in.bus_inputs.prim_3_bus = primsBusOutputs[2];
+  in.bus_inputs.sec_x_bus = secsBusOutputs[secIndex == 0 ? 1 : 0];
+  in.bus_inputs.sec_y_bus = secsBusOutputs[secIndex == 2 ? 1 : 2];
+
+  Failures failureIndex = secIndex == 0 ? Failures::Sec1 : (secIndex == 1 ? Failures::Sec2 : Failures::Sec3);
+  secs[secIndex].update(state.dt, state.time, state.isActive(failureIndex), state.powered);
+
+  secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
+  secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
+  secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
+}
+
+void ComputerRig::Computers::updateFac(const AircraftState& state, int facIndex) {
+  const int oppFacIndex = facIndex == 0 ? 1 : 0;
+  auto& in = facs[facIndex].modelInputs.in;
+
+  in.time.dt = state.dt;
+  in.time.simulation_time = state.time;
+  in.time.monotonic_time = state.time;
+
+  in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+  in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+  in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+  in.discrete_inputs.elac_1_healthy = true;
+  in.discrete_inputs.elac_2_healthy = true;
+  in.discrete_inputs.engine_1_stopped = true;
+  in.discrete_inputs.engine_2_stopped = true;
+  in.discrete_inputs.fac_engaged_from_switch = true;
+  in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+  in.discrete_inputs.is_unit_1 = facIndex == 0;
+  in.discrete_inputs.rudder_trim_actuator_healthy = true;
+  in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+  in.discrete_inputs.nose_gear_pressed = state.onGround;
+  in.discrete_inputs.yaw_damper_has_hyd_press = facIndex == 0 ? state.greenPressurised : state.yellowPressurised;
+
+  in.analog_inputs.yaw_damper_position_deg = facsAnalogOutputs[facIndex].yaw_damper_order_deg;
+  in.analog_inputs.rudder_trim_position_deg = facsAnalogOutputs[facIndex].rudder_trim_order_deg;
+  in.analog_inputs.rudder_travel_lim_position_deg = facsAnalogOutputs[facIndex].rudder_travel_limit_order_deg;
+
+  // the FMGC and ELAC buses are not connected on this aircraft
+  in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  in.bus_inputs.adr_own_bus = sensors.adr[facIndex];
+  in.bus_inputs.adr_opp_bus = sensors.adr[oppFacIndex];
+  in.bus_inputs.adr_3_bus = sensors.adr[2];
+  in.bus_inputs.ir_own_bus = sensors.ir[facIndex];
+  in.bus_inputs.ir_opp_bus = sensors.ir[oppFacIndex];
+  in.bus_inputs.ir_3_bus = sensors.ir[2];
+  in.bus_inputs.sfcc_own_bus = sensors.sfcc[facIndex];
+  in.bus_inputs.lgciu_own_bus = sensors.lgciu[facIndex];
+
+  facs[facIndex].update(state.dt, state.time, state.isActive(facIndex == 0 ? Failures::Fac1 : Failures::Fac2), state.powered);
+
+  facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
+  facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
+  facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
+}
+
+void ComputerRig::Computers::snapshot(ModelSnapshotWriter& writer) const {
+  for (int i = 0; i < 3; i++) {
+    prims[i].snapshot(writer);
+    writer.write(primsDiscreteOutputs[i]);
+    writer.write(primsAnalogOutputs[i]);
+    writer.write(primsBusOutputs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    secs[i].snapshot(writer);
+    writer.write(secsDiscreteOutputs[i]);
+    writer.write(secsAnalogOutputs[i]);
+    writer.write(secsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    facs[i].snapshot(writer);
+    writer.write(facsDiscreteOutputs[i]);
+    writer.write(facsAnalogOutputs[i]);
+    writer.write(facsBusOutputs[i]);
+  }
+}
+
+bool ComputerRig::Computers::restore(ModelSnapshotReader& reader) {
+  bool result = true;
+  for (int i = 0; i < 3; i++) {
+    result = result && prims[i].restore(reader) && reader.read(primsDiscreteOutputs[i]) && reader.read(primsAnalogOutputs[i]) &&
+             reader.read(primsBusOutputs[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    result = result && secs[i].restore(reader) && reader.read(secsDiscreteOutputs[i]) && reader.read(secsAnalogOutputs[i]) &&
+             reader.read(secsBusOutputs[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    result = result && facs[i].restore(reader) && reader.read(facsDiscreteOutputs[i]) && reader.read(facsAnalogOutputs[i]) &&
+             reader.read(facsBusOutputs[i]);
+  }
+  return result;
+}
+
+ComputerRig::ComputerRig() : computers(std::make_unique<Computers>()) {}
+
+ComputerRig::~ComputerRig() = default;
+
+const char* ComputerRig::aircraft() {
+  return "a380x";
+}
+
+std::vector<std::string> ComputerRig::outputNames() {
+  FieldNames names;
+  computers->visitOutputs(names);
+  return names.names;
+}
+
+void ComputerRig::step(const AircraftState& state) {
+  computers->sensors.update(state);
+
+  // same order as the FlyByWireInterface
+  for (int i = 0; i < 3; i++) {
+    computers->updatePrim(state, i);
+  }
+  for (int i = 0; i < 3; i++) {
+    computers->updateSec(state, i);
+  }
+  for (int i = 0; i < 2; i++) {
+    computers->updateFac(state, i);
+  }
+}
+
+void ComputerRig::readOutputs(std::vector<double>& values) {
+  FieldReader reader(values);
+  computers->visitOutputs(reader);
+}
+
+void ComputerRig::snapshot(std::vector<uint8_t>& buffer) const {
+  ModelSnapshotWriter writer(buffer);
+  computers->snapshot(writer);
+}
+
+bool ComputerRig::restore(const std::vector<uint8_t>& buffer) {
+  ModelSnapshotReader reader(buffer.data(), buffer.size());
+  return computers->restore(reader) && reader.atEnd();
+}
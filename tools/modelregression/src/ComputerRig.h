@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Scenario.h"
+
+/// <summary>
+/// The flight control computers of one aircraft, wired to each other like in the FlyByWireInterface
+/// </summary>
+/// <remarks>
+/// The computers run in their wrappers, so failures, power interruptions and self tests take the same paths as in the
+/// aircraft. The surfaces are ideal actuators, each computer reads back the positions it ordered in the previous frame.
+/// </remarks>
+class ComputerRig {
+ public:
+  ComputerRig();
+
+  ~ComputerRig();
+
+  static const char* aircraft();
+
+  /// names of the recorded outputs, e.g. "elac_discrete[0].pitch_axis_ok"
+  std::vector<std::string> outputNames();
+
+  void step(const AircraftState& state);
+
+  void readOutputs(std::vector<double>& values);
+
+  /// appends the state of the computers and the outputs they exchange, like the FlyByWireInterface snapshot
+  void snapshot(std::vector<uint8_t>& buffer) const;
+
+  /// false if the snapshot does not match the computers of this build
+  bool restore(const std::vector<uint8_t>& buffer);
+
+ private:
+  struct Computers;
+
+  std::unique_ptr<Computers> computers;
+};
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+
+#include "GoldenTrace.h"
+#include "zfstream.h"
+
+namespace {
+
+const char MAGIC[8] = {'F', 'B', 'W', 'G', 'O', 'L', 'D', '\0'};
+
+// increase when the layout of the file changes
+const uint32_t FILE_FORMAT_VERSION = 1;
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return in.good();
+}
+
+bool diverges(double golden, double actual, double absTolerance, double relTolerance) {
+  if (std::isnan(golden) || std::isnan(actual)) {
+    return std::isnan(golden) != std::isnan(actual);
+  }
+  double deviation = std::abs(actual - golden);
+  return deviation > absTolerance && deviation > relTolerance * std::abs(golden);
+}
+
+}  // namespace
+
+bool GoldenTrace::write(const std::string& path) const {
+  gzofstream out(path.c_str());
+  if (!out.is_open()) {
+    return false;
+  }
+
+  out.write(MAGIC, sizeof(MAGIC));
+  writeValue(out, FILE_FORMAT_VERSION);
+  writeValue(out, static_cast<uint32_t>(names.size()));
+  for (const auto& name : names) {
+    writeValue(out, static_cast<uint32_t>(name.size()));
+    out.write(name.data(), static_cast<std::streamsize>(name.size()));
+  }
+  writeValue(out, static_cast<uint64_t>(frames.size()));
+  for (size_t i = 0; i < frames.size(); i++) {
+    writeValue(out, times[i]);
+    out.write(reinterpret_cast<const char*>(frames[i].data()), static_cast<std::streamsize>(frames[i].size() * sizeof(double)));
+  }
+
+  out.close();
+  return true;
+}
+
+bool GoldenTrace::read(const std::string& path) {
+  gzifstream in(path.c_str());
+  if (!in.is_open()) {
+    return false;
+  }
+
+  char magic[sizeof(MAGIC)] = {};
+  uint32_t version = 0;
+  uint32_t nameCount = 0;
+  in.read(magic, sizeof(magic));
+  if (!in.good() || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || !readValue(in, version) || version != FILE_FORMAT_VERSION ||
+      !readValue(in, nameCount)) {
+    return false;
+  }
+
+  names.resize(nameCount);
+  for (auto& name : names) {
+    uint32_t length = 0;
+    if (!readValue(in, length)) {
+      return false;
+    }
+    name.resize(length);
+    in.read(name.data(), length);
+  }
+
+  uint64_t frameCount = 0;
+  if (!readValue(in, frameCount)) {
+    return false;
+  }
+  times.resize(frameCount);
+  frames.assign(frameCount, std::vector<double>(nameCount));
+  for (uint64_t i = 0; i < frameCount; i++) {
+    readValue(in, times[i]);
+    in.read(reinterpret_cast<char*>(frames[i].data()), static_cast<std::streamsize>(nameCount * sizeof(double)));
+  }
+  return in.good();
+}
+
+TraceComparison compareTraces(const GoldenTrace& golden, const GoldenTrace& actual, double absTolerance, double relTolerance) {
+  TraceComparison result;
+
+  std::map<std::string, size_t> goldenIndex;
+  for (size_t i = 0; i < golden.names.size(); i++) {
+    goldenIndex[golden.names[i]] = i;
+  }
+
+  // pairs of indices into the golden and the actual frames
+  std::vector<std::pair<size_t, size_t>> common;
+  for (size_t i = 0; i < actual.names.size(); i++) {
+    auto match = goldenIndex.find(actual.names[i]);
+    if (match == goldenIndex.end()) {
+      result.addedFields.push_back(actual.names[i]);
+    } else {
+      common.emplace_back(match->second, i);
+      goldenIndex.erase(match);
+    }
+  }
+  for (const auto& [name, index] : goldenIndex) {
+    result.removedFields.push_back(name);
+  }
+
+  size_t frameCount = std::min(golden.frames.size(), actual.frames.size());
+  result.frameCountDiffers = golden.frames.size() != actual.frames.size();
+
+  for (const auto& [goldenField, actualField] : common) {
+    FieldMismatch mismatch;
+    mismatch.name = actual.names[actualField];
+    for (size_t frame = 0; frame < frameCount; frame++) {
+      double goldenValue = golden.frames[frame][goldenField];
+      double actualValue = actual.frames[frame][actualField];
+      if (!diverges(goldenValue, actualValue, absTolerance, relTolerance)) {
+        continue;
+      }
+      if (mismatch.framesDifferent++ == 0) {
+        mismatch.firstTime = actual.times[frame];
+        mismatch.goldenValue = goldenValue;
+        mismatch.actualValue = actualValue;
+      }
+      double deviation = std::isnan(goldenValue) || std::isnan(actualValue) ? INFINITY : std::abs(actualValue - goldenValue);
+      mismatch.maxDeviation = std::max(mismatch.maxDeviation, deviation);
+    }
+    if (mismatch.framesDifferent > 0) {
+      result.mismatches.push_back(mismatch);
+    }
+  }
+
+  std::stable_sort(result.mismatches.begin(), result.mismatches.end(),
+                   [](const auto& a, const auto& b) { return a.firstTime < b.firstTime; });
+  return result;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Outputs of the computers over one scenario, one frame of values per step
+/// </summary>
+/// <remarks>
+/// Stored compressed with the names of the outputs, so a trace recorded before an interface change of the models can
+/// still be compared field by field afterwards.
+/// </remarks>
+struct GoldenTrace {
+  std::vector<std::string> names;
+  std::vector<double> times;
+  std::vector<std::vector<double>> frames;
+
+  bool write(const std::string& path) const;
+
+  bool read(const std::string& path);
+};
+
+/// deviation of one output field from the golden trace
+struct FieldMismatch {
+  std::string name;
+  double maxDeviation = 0;
+  double firstTime = 0;
+  double goldenValue = 0;
+  double actualValue = 0;
+  uint64_t framesDifferent = 0;
+};
+
+/// <summary>
+/// Result of comparing a run against its golden trace
+/// </summary>
+struct TraceComparison {
+  std::vector<std::string> addedFields;
+  std::vector<std::string> removedFields;
+  std::vector<FieldMismatch> mismatches;  // sorted by time of the first divergence
+  bool frameCountDiffers = false;
+
+  bool passed() const { return addedFields.empty() && removedFields.empty() && mismatches.empty() && !frameCountDiffers; }
+};
+
+/// <summary>
+/// Compares the fields both traces have, a value diverges when it exceeds both the absolute and the relative tolerance
+/// </summary>
+/// <remarks>NaN is equal to NaN, so outputs that are never computed do not fail the comparison.</remarks>
+TraceComparison compareTraces(const GoldenTrace& golden, const GoldenTrace& actual, double absTolerance, double relTolerance);
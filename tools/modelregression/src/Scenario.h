@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "failures/FailureList.h"
+
+/// <summary>
+/// Simplified state of the aircraft and its systems the computers are driven with
+/// </summary>
+/// <remarks>
+/// The sticks and pedals are in the convention of the model inputs. The scenarios are scripted open loop, the computers
+/// do not fly the aircraft.
+/// </remarks>
+struct AircraftState {
+  double dt = 0.03;
+  double time = 0;
+
+  bool powered = true;
+  bool onGround = true;
+  bool gearDown = true;
+  int flapsConfig = 0;  // 0, 1, 2, 3, 4 (FULL)
+
+  double ias_kn = 0;
+  double tas_kn = 0;
+  double mach = 0;
+  double altitude_ft = 0;
+  double verticalSpeed_ft_min = 0;
+  double radioHeight_ft = 0;
+  double aoa_deg = 0;
+  double pitch_deg = 0;
+  double roll_deg = 0;
+  double heading_deg = 0;
+  double pitchRate_deg_s = 0;
+  double rollRate_deg_s = 0;
+  double yawRate_deg_s = 0;
+  double nx_g = 0;
+  double ny_g = 0;
+  double nz_g = 1;
+
+  double weight_kg = 64000;
+  double cg_percent = 27;
+
+  double captPitchStick = 0;
+  double captRollStick = 0;
+  double rudderPedal = 0;
+  double speedBrakeLever = 0;  // -0.05 when armed
+  double thrustLever = 0;      // TLA in degrees
+  double wheelSpeed_kn = 0;
+
+  bool greenPressurised = true;
+  bool bluePressurised = true;
+  bool yellowPressurised = true;
+
+  bool adrValid[3] = {true, true, true};
+  bool irValid[3] = {true, true, true};
+  bool raValid[3] = {true, true, true};
+
+  std::vector<Failures> failures;
+
+  bool isActive(Failures failure) const;
+};
+
+/// <summary>
+/// Canonical input sequence, update() scripts the state over the time
+/// </summary>
+struct Scenario {
+  std::string name;
+  std::string description;
+  double duration_s;
+  void (*update)(AircraftState& state);
+};
+
+/// all scenarios, in the order they are run
+const std::vector<Scenario>& scenarios();
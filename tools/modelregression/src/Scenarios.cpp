@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Scenario.h"
+
+namespace {
+
+const double KNOTS_TO_FT_MIN = 101.269;
+
+/// linear transition from v0 at t0 to v1 at t1, constant outside
+double ramp(double t, double t0, double t1, double v0, double v1) {
+  if (t <= t0) {
+    return v0;
+  }
+  if (t >= t1) {
+    return v1;
+  }
+  return v0 + (v1 - v0) * (t - t0) / (t1 - t0);
+}
+
+/// value during [t0, t1), 0 otherwise
+double pulse(double t, double t0, double t1, double value) {
+  return t >= t0 && t < t1 ? value : 0;
+}
+
+/// doublet of the given amplitude starting at t0, each half lasting halfPeriod
+double doublet(double t, double t0, double halfPeriod, double amplitude) {
+  return pulse(t, t0, t0 + halfPeriod, amplitude) + pulse(t, t0 + halfPeriod, t0 + 2 * halfPeriod, -amplitude);
+}
+
+/// derives the air data that follows from the speeds, altitude and attitude
+void updateAirData(AircraftState& state) {
+  state.tas_kn = state.ias_kn * (1 + state.altitude_ft / 50000);
+  state.mach = state.tas_kn / (661.5 - 0.0023 * std::min(state.altitude_ft, 36000.0));
+  double gamma = state.tas_kn > 1 ? std::atan(state.verticalSpeed_ft_min / (state.tas_kn * KNOTS_TO_FT_MIN)) * 180 / M_PI : 0;
+  state.aoa_deg = state.onGround && state.ias_kn < 30 ? 0 : state.pitch_deg - gamma;
+  state.wheelSpeed_kn = state.onGround ? state.ias_kn : 0;
+}
+
+/// stabilized flight at the given altitude and speed with pitch and roll doublets every 20 s
+void cruise(AircraftState& state, double altitude, double ias) {
+  double t = state.time;
+  double phase = std::fmod(t, 20.0);
+
+  state.onGround = false;
+  state.gearDown = false;
+  state.flapsConfig = 0;
+  state.altitude_ft = altitude;
+  state.radioHeight_ft = altitude;
+  state.ias_kn = ias;
+  state.verticalSpeed_ft_min = 0;
+  state.thrustLever = 25;
+
+  state.captPitchStick = doublet(phase, 5, 1.5, 0.3);
+  state.captRollStick = doublet(phase, 12, 1.5, 0.5);
+  state.pitchRate_deg_s = 2 * state.captPitchStick;
+  state.rollRate_deg_s = 10 * state.captRollStick;
+  state.pitch_deg = 2.5 + ramp(phase, 5, 6.5, 0, 1.5) - ramp(phase, 6.5, 9.5, 0, 1.5);
+  state.roll_deg = ramp(phase, 12, 13.5, 0, 15) - ramp(phase, 13.5, 16.5, 0, 15);
+  state.nz_g = 1 + 0.1 * state.captPitchStick;
+  state.heading_deg = std::fmod(90 + 0.2 * t, 360.0);
+  updateAirData(state);
+}
+
+void takeoff(AircraftState& state) {
+  double t = state.time;
+
+  state.flapsConfig = t < 55 ? 1 : 0;
+  state.thrustLever = t < 5 ? 0 : (t < 60 ? 45 : 25);
+  state.speedBrakeLever = t < 40 ? -0.05 : 0;
+  state.heading_deg = 90;
+
+  // ground roll, rotation at 32 s and lift off at 36 s
+  state.ias_kn = t < 36 ? ramp(t, 5, 36, 0, 155) : ramp(t, 36, 60, 155, 180);
+  state.captPitchStick = pulse(t, 32, 36, 0.5) + pulse(t, 36, 38, 0.2);
+  state.pitch_deg = ramp(t, 32, 37, 0, 15);
+  state.pitchRate_deg_s = pulse(t, 32, 37, 3);
+  state.onGround = t < 36;
+  state.gearDown = t < 42;
+  state.verticalSpeed_ft_min = ramp(t, 36, 40, 0, 2000);
+  state.altitude_ft = t < 36 ? 0 : 2000 * (t - 36) / 60;
+  state.radioHeight_ft = state.altitude_ft;
+  state.nx_g = t < 36 ? pulse(t, 5, 36, 0.25) : 0.1;
+  state.nz_g = 1 + pulse(t, 34, 38, 0.15);
+
+  // roll doublet in the initial climb
+  state.captRollStick = doublet(t, 45, 2, 0.5);
+  state.rollRate_deg_s = 8 * state.captRollStick;
+  state.roll_deg = ramp(t, 45, 47, 0, 15) - ramp(t, 47, 51, 0, 30) + ramp(t, 51, 53, 0, 15);
+  updateAirData(state);
+}
+
+void approach(AircraftState& state) {
+  double t = state.time;
+
+  // stabilized final approach in FULL, flare at 64 s and touchdown at 70 s
+  state.flapsConfig = 4;
+  state.gearDown = true;
+  state.speedBrakeLever = -0.05;
+  state.heading_deg = 270;
+  state.onGround = t >= 70;
+  state.verticalSpeed_ft_min = t < 64 ? -700 : (t < 70 ? ramp(t, 64, 70, -700, -150) : 0);
+  state.altitude_ft = std::max(0.0, t < 64 ? 800 - 700 * t / 60 : 53 - ramp(t, 64, 70, 0, 53));
+  state.radioHeight_ft = state.altitude_ft;
+  state.ias_kn = t < 64 ? 135 : (t < 70 ? ramp(t, 64, 70, 135, 128) : std::max(0.0, 128 - 3 * (t - 70)));
+  state.thrustLever = t < 66 ? 20 : (t >= 71 && t < 90 ? -20 : 0);
+
+  state.captPitchStick = pulse(t, 64, 70, 0.3) - pulse(t, 72, 74, 0.2);
+  state.pitch_deg = t < 64 ? 2 : (t < 70 ? ramp(t, 64, 69, 2, 5.5) : ramp(t, 72, 75, 5.5, 0));
+  state.pitchRate_deg_s = pulse(t, 64, 69, 0.7) - pulse(t, 72, 75, 1.8);
+  state.nz_g = 1 + pulse(t, 64, 70, 0.08) + pulse(t, 70, 70.5, 0.3);
+  state.nx_g = t >= 70 ? -0.3 : 0;
+
+  // lateral corrections on short final
+  state.captRollStick = doublet(t, 20, 2, 0.3);
+  state.rudderPedal = doublet(t, 30, 2, 0.3) + pulse(t, 75, 80, 0.2);
+  state.rollRate_deg_s = 5 * state.captRollStick;
+  state.yawRate_deg_s = 2 * state.rudderPedal;
+  state.roll_deg = ramp(t, 20, 22, 0, 5) - ramp(t, 22, 26, 0, 10) + ramp(t, 26, 28, 0, 5);
+  updateAirData(state);
+}
+
+void lawReversions(AircraftState& state) {
+  double t = state.time;
+  cruise(state, 35000, 270);
+  state.weight_kg = 60000;
+
+  // two ADRs lost, then two IRs, then the air data and inertial references are restored
+  bool sensorsRestored = t >= 60;
+  state.adrValid[0] = t < 20 || sensorsRestored;
+  state.adrValid[1] = t < 20 || sensorsRestored;
+  state.irValid[0] = t < 40 || sensorsRestored;
+  state.irValid[1] = t < 40 || sensorsRestored;
+
+  // loss of green and yellow, then blue hydraulics
+  state.greenPressurised = t < 70;
+  state.yellowPressurised = t < 70;
+  state.bluePressurised = t < 90;
+}
+
+void computerFailures(AircraftState& state) {
+  double t = state.time;
+  cruise(state, 20000, 300);
+
+  state.failures.clear();
+  if (t >= 10 && t < 70) {
+    state.failures.push_back(Failures::Elac1);
+  }
+  if (t >= 20 && t < 70) {
+    state.failures.push_back(Failures::Sec1);
+  }
+  if (t >= 30 && t < 70) {
+    state.failures.push_back(Failures::Fac1);
+  }
+  if (t >= 40 && t < 70) {
+    state.failures.push_back(Failures::Elac2);
+  }
+  if (t >= 50 && t < 70) {
+    state.failures.push_back(Failures::Fac2);
+  }
+  if (t >= 60 && t < 70) {
+    state.failures.push_back(Failures::Sec2);
+    state.failures.push_back(Failures::Sec3);
+  }
+  if (t >= 75 && t < 85) {
+    state.failures.push_back(Failures::Fcdc1);
+  }
+
+  // short power interruption, the computers restart and run their self tests
+  state.powered = t < 88 || t >= 88.5;
+}
+
+}  // namespace
+
+bool AircraftState::isActive(Failures failure) const {
+  return std::find(failures.begin(), failures.end(), failure) != failures.end();
+}
+
+const std::vector<Scenario>& scenarios() {
+  static const std::vector<Scenario> all = {
+      {"takeoff", "ground roll, rotation, lift off and initial climb with a roll doublet", 70, takeoff},
+      {"approach", "final approach in FULL, flare, touchdown with ground spoilers armed and roll out", 100, approach},
+      {"reversions", "cruise with loss of air data and inertial references and of the hydraulic systems", 110, lawReversions},
+      {"failures", "cruise with the computers failed one after the other through the failure indices and a power interruption",
+       100, computerFailures},
+  };
+  return all;
+}
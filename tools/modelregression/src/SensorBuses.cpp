@@ -0,0 +1,163 @@
+#include "SensorBuses.h"
+
+#include <cmath>
+
+#include "Arinc429.h"
+
+namespace {
+
+void setWord(base_arinc_429& word, double value, bool valid) {
+  word.SSM = valid ? Arinc429SignStatus::NormalOperation : Arinc429SignStatus::FailureWarning;
+  word.Data = static_cast<float>(value);
+}
+
+void setDiscreteWord(base_arinc_429& word, bool valid) {
+  word.SSM = valid ? Arinc429SignStatus::NormalOperation : Arinc429SignStatus::FailureWarning;
+  word.Data = 0;
+}
+
+void updateAdr(base_adr_bus& bus, const AircraftState& state, bool valid) {
+  setWord(bus.altitude_standard_ft, state.altitude_ft, valid);
+  setWord(bus.altitude_corrected_ft, state.altitude_ft, valid);
+  setWord(bus.mach, state.mach, valid);
+  setWord(bus.airspeed_computed_kn, state.ias_kn, valid);
+  setWord(bus.airspeed_true_kn, state.tas_kn, valid);
+  setWord(bus.vertical_speed_ft_min, state.verticalSpeed_ft_min, valid);
+  setWord(bus.aoa_corrected_deg, state.aoa_deg, valid);
+  setWord(bus.corrected_average_static_pressure, 1013.25 * std::pow(1 - 6.8756e-6 * state.altitude_ft, 5.2559), valid);
+}
+
+void updateIr(base_ir_bus& bus, const AircraftState& state, bool valid) {
+  double flightPathAngle = state.pitch_deg - state.aoa_deg;
+
+  setDiscreteWord(bus.discrete_word_1, valid);
+  setWord(bus.latitude_deg, 47.26, valid);
+  setWord(bus.longitude_deg, 11.34, valid);
+  setWord(bus.ground_speed_kn, state.tas_kn, valid);
+  setWord(bus.track_angle_true_deg, state.heading_deg, valid);
+  setWord(bus.heading_true_deg, state.heading_deg, valid);
+  setWord(bus.wind_speed_kn, 0, valid);
+  setWord(bus.wind_direction_true_deg, 0, valid);
+  setWord(bus.track_angle_magnetic_deg, state.heading_deg, valid);
+  setWord(bus.heading_magnetic_deg, state.heading_deg, valid);
+  setWord(bus.drift_angle_deg, 0, valid);
+  setWord(bus.flight_path_angle_deg, flightPathAngle, valid);
+  setWord(bus.flight_path_accel_g, state.nx_g, valid);
+  setWord(bus.pitch_angle_deg, state.pitch_deg, valid);
+  setWord(bus.roll_angle_deg, state.roll_deg, valid);
+  setWord(bus.body_pitch_rate_deg_s, state.pitchRate_deg_s, valid);
+  setWord(bus.body_roll_rate_deg_s, state.rollRate_deg_s, valid);
+  setWord(bus.body_yaw_rate_deg_s, state.yawRate_deg_s, valid);
+  setWord(bus.body_long_accel_g, state.nx_g, valid);
+  setWord(bus.body_lat_accel_g, state.ny_g, valid);
+  setWord(bus.body_normal_accel_g, state.nz_g, valid);
+  setWord(bus.track_angle_rate_deg_s, state.yawRate_deg_s, valid);
+  setWord(bus.pitch_att_rate_deg_s, state.pitchRate_deg_s, valid);
+  setWord(bus.roll_att_rate_deg_s, state.rollRate_deg_s, valid);
+  setWord(bus.inertial_alt_ft, state.altitude_ft, valid);
+  setWord(bus.along_track_horiz_acc_g, state.nx_g, valid);
+  setWord(bus.cross_track_horiz_acc_g, state.ny_g, valid);
+  setWord(bus.vertical_accel_g, state.nz_g - 1, valid);
+  setWord(bus.inertial_vertical_speed_ft_s, state.verticalSpeed_ft_min / 60, valid);
+  setWord(bus.north_south_velocity_kn, state.tas_kn * std::cos(state.heading_deg * M_PI / 180), valid);
+  setWord(bus.east_west_velocity_kn, state.tas_kn * std::sin(state.heading_deg * M_PI / 180), valid);
+}
+
+// slat and flap feedback angles of the SFCC synchros and the surface angles per configuration
+struct SlatFlapPosition {
+  double slatFeedback;
+  double flapFeedback;
+  double slat_deg;
+  double flap_deg;
+};
+const SlatFlapPosition SLAT_FLAP_POSITIONS[] = {
+    {0, 0, 0, 0}, {222.3, 0, 18, 0}, {272.2, 145.5, 22, 15}, {272.2, 168.3, 22, 20}, {334.2, 251.0, 27, 40},
+};
+
+void updateSfcc(base_sfcc_bus& bus, const AircraftState& state) {
+  const auto& position = SLAT_FLAP_POSITIONS[state.flapsConfig];
+
+  // bits as in the SFCC of the systems (flaps_computer.rs)
+  setDiscreteWord(bus.slat_flap_actual_position_word, true);
+  auto& word = bus.slat_flap_actual_position_word;
+  Arinc429Utils::setBit(word, 11, true);
+  Arinc429Utils::setBit(word, 12, position.slatFeedback > -5 && position.slatFeedback < 6.2);
+  Arinc429Utils::setBit(word, 13, position.slatFeedback > 210.4 && position.slatFeedback < 337);
+  Arinc429Utils::setBit(word, 14, position.slatFeedback > 321.8 && position.slatFeedback < 337);
+  Arinc429Utils::setBit(word, 15, position.slatFeedback > 327.4 && position.slatFeedback < 337);
+  Arinc429Utils::setBit(word, 18, true);
+  Arinc429Utils::setBit(word, 19, position.flapFeedback > -5 && position.flapFeedback < 2.5);
+  Arinc429Utils::setBit(word, 20, position.flapFeedback > 140.7 && position.flapFeedback < 254);
+  Arinc429Utils::setBit(word, 21, position.flapFeedback > 163.7 && position.flapFeedback < 254);
+  Arinc429Utils::setBit(word, 22, position.flapFeedback > 247.8 && position.flapFeedback < 254);
+  Arinc429Utils::setBit(word, 23, position.flapFeedback > 250 && position.flapFeedback < 254);
+
+  setDiscreteWord(bus.slat_flap_component_status_word, true);
+  setDiscreteWord(bus.slat_flap_system_status_word, true);
+  setWord(bus.slat_actual_position_deg, position.slat_deg, true);
+  setWord(bus.flap_actual_position_deg, position.flap_deg, true);
+}
+
+void updateLgciu(base_lgciu_bus& bus, const AircraftState& state) {
+  bool handleDown = state.gearDown;
+  bool downLocked = state.gearDown;
+  bool upLocked = !state.gearDown;
+  bool compressed = state.onGround;
+
+  // bits as in the LGCIU of the systems (landing_gear/mod.rs), the gear doors are closed
+  setDiscreteWord(bus.discrete_word_1, state.powered);
+  for (int bit = 11; bit <= 13; bit++) {
+    Arinc429Utils::setBit(bus.discrete_word_1, bit, !upLocked && !handleDown);
+    Arinc429Utils::setBit(bus.discrete_word_1, bit + 3, !downLocked && handleDown);
+    Arinc429Utils::setBit(bus.discrete_word_1, bit + 12, downLocked);
+    Arinc429Utils::setBit(bus.discrete_word_1, bit + 15, compressed);
+  }
+  Arinc429Utils::setBit(bus.discrete_word_1, 29, handleDown);
+
+  setDiscreteWord(bus.discrete_word_2, state.powered);
+  for (int bit = 11; bit <= 14; bit++) {
+    Arinc429Utils::setBit(bus.discrete_word_2, bit, compressed);
+  }
+  Arinc429Utils::setBit(bus.discrete_word_2, 15, downLocked);
+
+  setDiscreteWord(bus.discrete_word_3, state.powered);
+  for (int bit = 11; bit <= 13; bit++) {
+    Arinc429Utils::setBit(bus.discrete_word_3, bit, !upLocked);
+  }
+  Arinc429Utils::setBit(bus.discrete_word_3, 14, !handleDown);
+
+  setDiscreteWord(bus.discrete_word_4, true);
+}
+
+}  // namespace
+
+void SensorBuses::update(const AircraftState& state) {
+  for (int i = 0; i < 3; i++) {
+    updateAdr(adr[i], state, state.adrValid[i]);
+    updateIr(ir[i], state, state.irValid[i]);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    // the radio altimeters report no computed data above their range
+    ra[i].radio_height_ft.SSM = !state.raValid[i]           ? Arinc429SignStatus::FailureWarning
+                                : state.radioHeight_ft > 2500 ? Arinc429SignStatus::NoComputedData
+                                                              : Arinc429SignStatus::NormalOperation;
+    ra[i].radio_height_ft.Data = static_cast<float>(std::min(state.radioHeight_ft, 2500.0));
+  }
+
+  for (int i = 0; i < 2; i++) {
+    updateSfcc(sfcc[i], state);
+    updateLgciu(lgciu[i], state);
+  }
+
+  // the flight guidance commands no surface deflections, the autopilot is not engaged
+  fmgc.fg_radio_height_ft = ra[0].radio_height_ft.SSM != Arinc429SignStatus::FailureWarning ? ra[0].radio_height_ft : ra[1].radio_height_ft;
+  setWord(fmgc.delta_p_ail_cmd_deg, 0, true);
+  setWord(fmgc.delta_p_splr_cmd_deg, 0, true);
+  setWord(fmgc.delta_r_cmd_deg, 0, true);
+  setWord(fmgc.delta_q_cmd_deg, 0, true);
+  setWord(fmgc.fm_weight_lbs, state.weight_kg * 2.20462262, true);
+  setWord(fmgc.fm_cg_percent, state.cg_percent, true);
+  setWord(fmgc.fac_weight_lbs, state.weight_kg * 2.20462262, true);
+  setWord(fmgc.fac_cg_percent, state.cg_percent, true);
+}
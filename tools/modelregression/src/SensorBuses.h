@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Arinc429Utils.h"
+#include "Scenario.h"
+#include "model/FacComputer_types.h"
+
+/// <summary>
+/// Outputs of the sensors and systems around the flight control computers, built from the aircraft state
+/// </summary>
+/// <remarks>
+/// The layouts of these buses are the same for both aircraft, only the encoding the computers rely on is reproduced
+/// (SSM of the failed references, the LGCIU and SFCC discrete words).
+/// </remarks>
+struct SensorBuses {
+  base_adr_bus adr[3] = {};
+  base_ir_bus ir[3] = {};
+  base_ra_bus ra[3] = {};
+  base_sfcc_bus sfcc[2] = {};
+  base_lgciu_bus lgciu[2] = {};
+  base_fmgc_b_bus fmgc = {};
+
+  void update(const AircraftState& state);
+};
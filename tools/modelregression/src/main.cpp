@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ComputerRig.h"
+#include "GoldenTrace.h"
+#include "Scenario.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+/// <summary>
+/// Runs a scenario through a fresh set of computers and records all outputs
+/// </summary>
+/// <param name="stepTime">Mean time of a step of the computers in us.</param>
+GoldenTrace run(const Scenario& scenario, double& stepTime) {
+  ComputerRig rig;
+  AircraftState state;
+
+  GoldenTrace trace;
+  trace.names = rig.outputNames();
+
+  uint64_t steps = static_cast<uint64_t>(std::round(scenario.duration_s / state.dt));
+  std::vector<double> values;
+  std::chrono::duration<double, std::micro> totalStepTime(0);
+  for (uint64_t i = 0; i < steps; i++) {
+    state.time = (i + 1) * state.dt;
+    scenario.update(state);
+    auto start = std::chrono::steady_clock::now();
+    rig.step(state);
+    totalStepTime += std::chrono::steady_clock::now() - start;
+    rig.readOutputs(values);
+    trace.times.push_back(state.time);
+    trace.frames.push_back(values);
+  }
+  stepTime = steps > 0 ? totalStepTime.count() / steps : 0;
+  return trace;
+}
+
+/// <summary>
+/// Snapshots the computers halfway through a scenario and replays the second half on a fresh set of computers restored
+/// from the snapshot
+/// </summary>
+/// <returns>Description of the first difference to the uninterrupted run, empty if the replay matches it bit for bit.</returns>
+std::string checkSnapshotRoundTrip(const Scenario& scenario) {
+  ComputerRig rig;
+  AircraftState state;
+  std::vector<std::string> names = rig.outputNames();
+
+  uint64_t steps = static_cast<uint64_t>(std::round(scenario.duration_s / state.dt));
+  uint64_t snapshotStep = steps / 2;
+  std::vector<uint8_t> snapshot;
+  AircraftState snapshotState;
+  std::vector<std::vector<double>> frames;
+  std::vector<double> values;
+  for (uint64_t i = 0; i < steps; i++) {
+    if (i == snapshotStep) {
+      rig.snapshot(snapshot);
+      snapshotState = state;
+    }
+    state.time = (i + 1) * state.dt;
+    scenario.update(state);
+    rig.step(state);
+    if (i >= snapshotStep) {
+      rig.readOutputs(values);
+      frames.push_back(values);
+    }
+  }
+
+  ComputerRig truncated;
+  if (truncated.restore(std::vector<uint8_t>(snapshot.begin(), snapshot.end() - 1))) {
+    return "a truncated snapshot was restored";
+  }
+
+  ComputerRig restored;
+  if (!restored.restore(snapshot)) {
+    return fmt::format("the snapshot of {} bytes was rejected", snapshot.size());
+  }
+  std::vector<uint8_t> restoredSnapshot;
+  restored.snapshot(restoredSnapshot);
+  if (restoredSnapshot != snapshot) {
+    return "the snapshot of the restored computers differs";
+  }
+
+  state = snapshotState;
+  for (uint64_t i = snapshotStep; i < steps; i++) {
+    state.time = (i + 1) * state.dt;
+    scenario.update(state);
+    restored.step(state);
+    restored.readOutputs(values);
+    const std::vector<double>& expected = frames[i - snapshotStep];
+    for (size_t field = 0; field < values.size(); field++) {
+      if (std::memcmp(&values[field], &expected[field], sizeof(double)) != 0) {
+        return fmt::format("{} at {:.2f} s: uninterrupted {} restored {}", names[field], state.time, expected[field], values[field]);
+      }
+    }
+  }
+  return {};
+}
+
+/// <summary>
+/// Prints the interface changes and the fields that diverge first
+/// </summary>
+void printComparison(const TraceComparison& comparison, const GoldenTrace& golden, const GoldenTrace& actual, uint32_t topCount) {
+  for (const auto& name : comparison.addedFields) {
+    fmt::print("  added field   {}\n", name);
+  }
+  for (const auto& name : comparison.removedFields) {
+    fmt::print("  removed field {}\n", name);
+  }
+  if (comparison.frameCountDiffers) {
+    fmt::print("  {} frames, golden has {}\n", actual.frames.size(), golden.frames.size());
+  }
+  if (comparison.mismatches.empty()) {
+    return;
+  }
+
+  fmt::print("  {} fields diverge, first at {:.2f} s\n", comparison.mismatches.size(), comparison.mismatches.front().firstTime);
+  for (size_t i = 0; i < std::min<size_t>(topCount, comparison.mismatches.size()); i++) {
+    const auto& field = comparison.mismatches[i];
+    fmt::print("  {:<60} at {:7.2f} s golden {:<12.6g} actual {:<12.6g} max deviation {:<12.6g} in {} frames\n", field.name,
+               field.firstTime, field.goldenValue, field.actualValue, field.maxDeviation, field.framesDifferent);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  std::string goldenDirectory = MODELREGRESSION_GOLDEN_DIRECTORY;
+  std::string scenarioName = "all";
+  double absTolerance = 1e-6;
+  double relTolerance = 1e-6;
+  uint32_t topCount = 10;
+  bool record = false;
+  bool list = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(fmt::format("Checks the outputs of the {} flight control computers against golden traces", ComputerRig::aircraft()));
+  args.addArgument({"-r", "--record"}, &record, "Record the golden traces instead of checking against them");
+  args.addArgument({"-d", "--directory"}, &goldenDirectory, "Directory of the golden traces");
+  args.addArgument({"-s", "--scenario"}, &scenarioName, "Scenario to run, all by default");
+  args.addArgument({"-a", "--abs-tolerance"}, &absTolerance, "Absolute tolerance of the outputs");
+  args.addArgument({"-e", "--rel-tolerance"}, &relTolerance, "Relative tolerance of the outputs");
+  args.addArgument({"-t", "--top"}, &topCount, "Number of diverging output fields to print per scenario");
+  args.addArgument({"-l", "--list"}, &list, "List the scenarios");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  if (list) {
+    for (const auto& scenario : scenarios()) {
+      fmt::print("{:<12} {:6.1f} s  {}\n", scenario.name, scenario.duration_s, scenario.description);
+    }
+    return 0;
+  }
+
+  // check parameters
+  bool scenarioFound = scenarioName == "all";
+  for (const auto& scenario : scenarios()) {
+    scenarioFound |= scenario.name == scenarioName;
+  }
+  if (!scenarioFound) {
+    fmt::print("Unknown scenario {}!\n", scenarioName);
+    return 1;
+  }
+  if (record) {
+    std::filesystem::create_directories(goldenDirectory);
+  } else if (!std::filesystem::exists(goldenDirectory)) {
+    fmt::print("Golden directory {} does not exist, record the traces first!\n", goldenDirectory);
+    return 1;
+  }
+
+  bool success = true;
+  for (const auto& scenario : scenarios()) {
+    if (scenarioName != "all" && scenario.name != scenarioName) {
+      continue;
+    }
+
+    std::string fileName = fmt::format("{}_{}.trace", ComputerRig::aircraft(), scenario.name);
+    std::string path = (std::filesystem::path(goldenDirectory) / fileName).string();
+    double stepTime = 0;
+    GoldenTrace actual = run(scenario, stepTime);
+
+    if (record) {
+      if (!actual.write(path)) {
+        fmt::print("{}: cannot write {}!\n", scenario.name, path);
+        success = false;
+        continue;
+      }
+      fmt::print("{}: recorded {} frames of {} outputs to {}\n", scenario.name, actual.frames.size(), actual.names.size(), path);
+      continue;
+    }
+
+    GoldenTrace golden;
+    if (!golden.read(path)) {
+      fmt::print("{}: cannot read golden trace {}!\n", scenario.name, path);
+      success = false;
+      continue;
+    }
+
+    TraceComparison comparison = compareTraces(golden, actual, absTolerance, relTolerance);
+    fmt::print("{}: {}, step {:.2f} us\n", scenario.name, comparison.passed() ? "passed" : "FAILED", stepTime);
+    printComparison(comparison, golden, actual, topCount);
+    success &= comparison.passed();
+
+    std::string roundTripDifference = checkSnapshotRoundTrip(scenario);
+    if (!roundTripDifference.empty()) {
+      fmt::print("  snapshot round trip FAILED, {}\n", roundTripDifference);
+      success = false;
+    }
+  }
+
+  return success ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Found instead of fbw_common/src/LookupKernels.h when MODELREGRESSION_UNCACHED_LOOKUPS is on. The models then call the
+// stateless kernels where the generated code was switched to the cached ones, so the step time of both can be compared
+// on the same scenarios. The outputs have to stay bit-identical, the golden traces are the same.
+
+// the cached kernels of the real header are moved out of the way
+#define look1_pbinlxpw look1_pbinlxpw_cached
+#define look2_pbinlxpw look2_pbinlxpw_cached
+#include "../../../../fbw-common/src/wasm/fbw_common/src/LookupKernels.h"
+#undef look1_pbinlxpw
+#undef look2_pbinlxpw
+
+template <uint32_t maxIndex, typename T>
+inline T look1_pbinlxpw(std::type_identity_t<T> u0, const T bp0[], const T table[], uint32_t[]) {
+  return look1_binlxpw<maxIndex>(u0, bp0, table);
+}
+
+template <uint32_t stride, typename T>
+inline T look2_pbinlxpw(std::type_identity_t<T> u0,
+                        std::type_identity_t<T> u1,
+                        const T bp0[],
+                        const T bp1[],
+                        const T table[],
+                        uint32_t[],
+                        const uint32_t maxIndex[]) {
+  return look2_binlxpw<stride>(u0, u1, bp0, bp1, table, maxIndex);
+}
@@ -0,0 +1,21 @@
+// the headers used by the model are included outside of the namespace first
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "ArmedModes.h"
+#include "EvaluationVariant.h"
+#include "FieldVisitors.h"
+#include "ModelSnapshot.h"
+
+namespace cached_evaluation {
+#include "StateMachineVariant.inc"
+}  // namespace cached_evaluation
+
+std::unique_ptr<EvaluationVariant> createCachedEvaluation() {
+  return std::make_unique<cached_evaluation::StateMachineVariant>();
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// One build of the AutopilotStateMachine, the inputs and outputs are exchanged as double in the order of the names
+/// </summary>
+class EvaluationVariant {
+ public:
+  virtual ~EvaluationVariant() = default;
+
+  virtual std::vector<std::string> inputNames() = 0;
+
+  virtual std::vector<std::string> outputNames() = 0;
+
+  /// steps the model once, returns the time spent in the step in ns
+  virtual double step(const std::vector<double>& inputs, std::vector<double>& outputs) = 0;
+};
+
+/// the state machine as built for the aircraft, with the cached station terms
+std::unique_ptr<EvaluationVariant> createCachedEvaluation();
+
+/// the state machine built with FBW_AP_SM_FULL_EVALUATION, everything is evaluated every frame
+std::unique_ptr<EvaluationVariant> createFullEvaluation();
@@ -0,0 +1,24 @@
+// the headers used by the model are included outside of the namespace first
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "ArmedModes.h"
+#include "EvaluationVariant.h"
+#include "FieldVisitors.h"
+#include "ModelSnapshot.h"
+
+// evaluates the station terms every frame (see AutopilotStateMachine.cpp)
+#define FBW_AP_SM_FULL_EVALUATION
+
+namespace full_evaluation {
+#include "StateMachineVariant.inc"
+}  // namespace full_evaluation
+
+std::unique_ptr<EvaluationVariant> createFullEvaluation() {
+  return std::make_unique<full_evaluation::StateMachineVariant>();
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cmath>
+
+#include "multiword_types.h"
+#include "rtwtypes.h"
+
+/// <summary>
+/// Armed mode masks as the generated AutopilotStateMachine built them before tools/modelpostprocess/armed_mode_masks.py,
+/// the multiword helpers and the step code are kept verbatim as the reference of the native masks in ArmedModes.h
+/// </summary>
+namespace multiword_armed_modes {
+
+inline void Double2MultiWord(real_T u1, uint32_T y[], int32_T n)
+{
+  real_T yn;
+  int32_T currExp;
+  int32_T i;
+  int32_T msl;
+  int32_T prevExp;
+  uint32_T cb;
+  boolean_T isNegative;
+  isNegative = (u1 < 0.0);
+  yn = frexp(u1, &currExp);
+  msl = currExp <= 0 ? -1 : (currExp - 1) / 32;
+  cb = 1U;
+  for (i = msl + 1; i < n; i++) {
+    y[i] = 0U;
+  }
+
+  yn = isNegative ? -yn : yn;
+  prevExp = 32 * msl;
+  for (i = msl; i >= 0; i--) {
+    real_T yd;
+    yn = std::ldexp(yn, currExp - prevExp);
+    yd = std::floor(yn);
+    yn -= yd;
+    if (i < n) {
+      y[i] = static_cast<uint32_T>(yd);
+    }
+
+    currExp = prevExp;
+    prevExp -= 32;
+  }
+
+  if (isNegative) {
+    for (i = 0; i < n; i++) {
+      uint32_T u1i;
+      u1i = ~y[i];
+      cb += u1i;
+      y[i] = cb;
+      cb = (cb < u1i);
+    }
+  }
+}
+
+inline void MultiWordIor(const uint32_T u1[], const uint32_T u2[], uint32_T y[], int32_T n)
+{
+  for (int32_T i{0}; i < n; i++) {
+    y[i] = u1[i] | u2[i];
+  }
+}
+
+inline real_T uMultiWord2Double(const uint32_T u1[], int32_T n1, int32_T e1)
+{
+  real_T y;
+  int32_T exp_0;
+  y = 0.0;
+  exp_0 = e1;
+  for (int32_T i{0}; i < n1; i++) {
+    y += std::ldexp(static_cast<real_T>(u1[i]), exp_0);
+    exp_0 += 32;
+  }
+
+  return y;
+}
+
+inline void AutopilotStateMachine_BitShift(real_T rtu_u, real_T *rty_y)
+{
+  *rty_y = std::ldexp(rtu_u, 0);
+}
+
+inline void AutopilotStateMachine_BitShift1(real_T rtu_u, real_T *rty_y)
+{
+  *rty_y = std::ldexp(rtu_u, 1);
+}
+
+/// the masks of the step, engaged stands for FD active or an AP engaged and disengagedLateral for the Constant_Value
+/// parameter published without them
+template <typename LateralArmed, typename VerticalArmed>
+inline void publish(const LateralArmed& lateral, const VerticalArmed& vertical, bool engaged, real_T disengagedLateral,
+                    real_T& lateral_mode_armed, real_T& vertical_mode_armed)
+{
+  uint64m_T tmp;
+  uint64m_T tmp_0;
+  uint64m_T tmp_1;
+  uint64m_T tmp_2;
+  uint64m_T tmp_3;
+  uint64m_T tmp_4;
+  uint64m_T tmp_5;
+  uint64m_T tmp_6;
+  uint64m_T tmp_7;
+  uint64m_T tmp_8;
+  real_T rtb_GainTheta;
+  real_T rtb_GainTheta1;
+
+  AutopilotStateMachine_BitShift(static_cast<real_T>(lateral.NAV), &rtb_GainTheta);
+  AutopilotStateMachine_BitShift1(static_cast<real_T>(lateral.LOC), &rtb_GainTheta1);
+  if (engaged) {
+    Double2MultiWord(std::floor(rtb_GainTheta), &tmp_0.chunks[0U], 2);
+    Double2MultiWord(std::floor(rtb_GainTheta1), &tmp_1.chunks[0U], 2);
+    MultiWordIor(&tmp_0.chunks[0U], &tmp_1.chunks[0U], &tmp.chunks[0U], 2);
+    lateral_mode_armed = uMultiWord2Double(&tmp.chunks[0U], 2, 0);
+  } else {
+    lateral_mode_armed = disengagedLateral;
+  }
+
+  AutopilotStateMachine_BitShift(static_cast<real_T>(vertical.ALT), &rtb_GainTheta);
+  AutopilotStateMachine_BitShift1(static_cast<real_T>(vertical.ALT_CST), &rtb_GainTheta1);
+  if (engaged) {
+    Double2MultiWord(std::floor(rtb_GainTheta), &tmp_7.chunks[0U], 2);
+    Double2MultiWord(std::floor(rtb_GainTheta1), &tmp_8.chunks[0U], 2);
+    MultiWordIor(&tmp_7.chunks[0U], &tmp_8.chunks[0U], &tmp_6.chunks[0U], 2);
+    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>(vertical.CLB), 2))),
+                     &tmp_7.chunks[0U], 2);
+    MultiWordIor(&tmp_6.chunks[0U], &tmp_7.chunks[0U], &tmp_5.chunks[0U], 2);
+    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>(vertical.DES), 3))),
+                     &tmp_6.chunks[0U], 2);
+    MultiWordIor(&tmp_5.chunks[0U], &tmp_6.chunks[0U], &tmp_4.chunks[0U], 2);
+    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>(vertical.GS), 4))),
+                     &tmp_5.chunks[0U], 2);
+    MultiWordIor(&tmp_4.chunks[0U], &tmp_5.chunks[0U], &tmp_3.chunks[0U], 2);
+    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>(vertical.FINAL_DES), 5))),
+                     &tmp_4.chunks[0U], 2);
+    MultiWordIor(&tmp_3.chunks[0U], &tmp_4.chunks[0U], &tmp_2.chunks[0U], 2);
+    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>(vertical.TCAS), 6))),
+                     &tmp_3.chunks[0U], 2);
+    MultiWordIor(&tmp_2.chunks[0U], &tmp_3.chunks[0U], &tmp_1.chunks[0U], 2);
+    vertical_mode_armed = uMultiWord2Double(&tmp_1.chunks[0U], 2, 0);
+  } else {
+    Double2MultiWord(static_cast<real_T>(static_cast<int32_T>(std::ldexp(static_cast<real_T>(vertical.TCAS), 6))),
+                     &tmp_0.chunks[0U], 2);
+    vertical_mode_armed = uMultiWord2Double(&tmp_0.chunks[0U], 2, 0);
+  }
+}
+
+}  // namespace multiword_armed_modes
@@ -0,0 +1,365 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ArmedModes.h"
+#include "AutopilotStateMachine_types.h"
+#include "EvaluationVariant.h"
+#include "FieldVisitors.h"
+#include "ModelFields.h"
+#include "MultiwordArmedModes.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+
+#ifdef STATEMACHINEBENCH_A380X
+const char* AIRCRAFT = "A380X";
+#else
+const char* AIRCRAFT = "A32NX";
+#endif
+
+const double SAMPLE_TIME = 0.03;
+
+// localizer and glide slope of the scripted approach, runway 09 with the threshold at 47 N 8 E
+const double STATION_LAT = 47.0;
+const double STATION_LON = 8.0;
+const double STATION_ALT_M = 400.0;
+const double STATION_MAGVAR_DEG = 2.0;
+const double FIELD_ELEVATION_FT = STATION_ALT_M * 3.28084;
+
+/// <summary>
+/// Scripted ILS approach: no station tuned in the descent, then the ILS is tuned, retuned and captured until roll out
+/// </summary>
+/// <remarks>
+/// The inputs are not closed loop, the deviations and the altitude follow the path the laws would fly. With retune set the
+/// station jumps between not tuned, a valid position and NaN every few seconds, which exercises the cached station terms.
+/// </remarks>
+class ScriptedFlight {
+ public:
+  ScriptedFlight(bool retune, uint32_t seed) : retune(retune), random(seed) {}
+
+  void update(ap_sm_input& in, double time) {
+    in.time.dt = SAMPLE_TIME;
+    in.time.simulation_time = time;
+
+    // the aircraft flies east at 180 kn and crosses the threshold at 390 s
+    double distance_nmi = (390.0 - time) * 180.0 / 3600.0;
+    double altitude_ft = std::clamp(FIELD_ELEVATION_FT + distance_nmi * 318.0, FIELD_ELEVATION_FT, 5000.0);
+    if (time < 150) {
+      altitude_ft = std::max(5000.0 - std::max(0.0, time - 20) * 20.0, 3000.0);
+    } else {
+      altitude_ft = std::min(altitude_ft, 3000.0);
+    }
+    double rate_ft_min = (altitude_ft - lastAltitude_ft) / SAMPLE_TIME * 60.0;
+    lastAltitude_ft = altitude_ft;
+
+    auto& data = in.data;
+    data.aircraft_position.lat = STATION_LAT - 0.002 * std::exp(-std::max(0.0, time - 180) / 40.0);
+    data.aircraft_position.lon = STATION_LON - distance_nmi / (60.0 * std::cos(STATION_LAT * M_PI / 180.0));
+    data.aircraft_position.alt = altitude_ft / 3.28084;
+    data.Theta_deg = rate_ft_min < -100 ? -2.5 : 2.5;
+    data.Phi_deg = 0;
+    data.V_ias_kn = time < 390 ? 180 - std::max(0.0, time - 200) * 0.2 : std::max(0.0, 140 - (time - 390) * 3);
+    data.V_tas_kn = data.V_ias_kn * 1.05;
+    data.V_mach = data.V_tas_kn / 661.0;
+    data.V_gnd_kn = data.V_tas_kn;
+    data.alpha_deg = 4;
+    data.H_ft = altitude_ft;
+    data.H_ind_ft = altitude_ft;
+    data.H_radio_ft = altitude_ft - FIELD_ELEVATION_FT;
+    data.H_dot_ft_min = rate_ft_min;
+    data.Psi_magnetic_deg = 88;
+    data.Psi_magnetic_track_deg = 88;
+    data.Psi_true_deg = 90;
+    data.flight_phase = time < 150 ? 4 : 5;
+    data.V2_kn = 130;
+    data.VAPP_kn = 135;
+    data.VLS_kn = 125;
+    data.VMAX_kn = 350;
+    data.cruise_altitude = 35000;
+    data.gear_strut_compression_1 = data.H_radio_ft < 1 ? 1 : 0;
+    data.gear_strut_compression_2 = data.gear_strut_compression_1;
+    data.flaps_handle_index = time < 150 ? 0 : 3;
+    data.is_engine_operative_1 = true;
+    data.is_engine_operative_2 = true;
+    data.altimeter_setting_left_mbar = 1013.25;
+    data.altimeter_setting_right_mbar = 1013.25;
+    data.total_weight_kg = 60000;
+
+    // the ILS is tuned at 60 s and retuned with a different magnetic variation at 100 s
+    bool tuned = time >= 60;
+    double magvar_deg = time >= 100 ? STATION_MAGVAR_DEG : STATION_MAGVAR_DEG + 1;
+    ap_lat_lon_alt station = {STATION_LAT, STATION_LON, STATION_ALT_M};
+    if (retune && time >= 60 && time < 330) {
+      if (time >= nextRetune_s) {
+        nextRetune_s = time + std::uniform_real_distribution<double>(1, 8)(random);
+        retuneState = std::uniform_int_distribution<int>(0, 3)(random);
+      }
+      tuned = retuneState != 0;
+      if (retuneState == 2) {
+        station.lat += 0.01;
+        magvar_deg += 1;
+      } else if (retuneState == 3) {
+        station = {NAN, NAN, NAN};
+      }
+    }
+    data.nav_valid = tuned;
+    data.nav_loc_deg = 90 - magvar_deg;
+    data.nav_gs_deg = 3;
+    data.nav_dme_valid = tuned;
+    data.nav_dme_nmi = std::abs(distance_nmi);
+    data.nav_loc_valid = tuned;
+    data.nav_loc_magvar_deg = tuned ? magvar_deg : 0;
+    data.nav_loc_error_deg = tuned ? 4 * std::exp(-std::max(0.0, time - 180) / 25.0) : 0;
+    data.nav_loc_position = tuned ? station : ap_lat_lon_alt{};
+    data.nav_gs_valid = tuned;
+    data.nav_gs_error_deg = tuned ? std::clamp((altitude_ft - FIELD_ELEVATION_FT - distance_nmi * 318.0) / 300.0, -0.8, 0.8) : 0;
+    data.nav_gs_position = tuned ? ap_lat_lon_alt{station.lat, station.lon - 0.004, station.alt} : ap_lat_lon_alt{};
+
+    // FD on, AP engaged in HDG and OP DES to 3000 ft, APPR pushed at 170 s
+    auto& input = in.input;
+    input.FD_active = time >= 2;
+    input.AP_ENGAGE_push = pulse(time, 5);
+    input.HDG_pull = pulse(time, 8);
+    input.ALT_pull = pulse(time, 20);
+    input.APPR_push = pulse(time, 170);
+    input.V_fcu_kn = 180;
+    input.Psi_fcu_deg = 88;
+    input.H_fcu_ft = 3000;
+    input.ATHR_engaged = true;
+    input.is_SPEED_managed = true;
+    input.TCAS_mode_available = true;
+  }
+
+  /// true while no station is tuned, the state machine then skips the station terms
+  static bool isUntuned(const ap_sm_input& in) {
+    const auto& position = in.data.nav_loc_position;
+    return position.lat == 0 && position.lon == 0 && position.alt == 0;
+  }
+
+ private:
+  bool retune;
+  std::mt19937 random;
+  double nextRetune_s = 0;
+  int retuneState = 1;
+  double lastAltitude_ft = 5000;
+
+  static bool pulse(double time, double at) { return time >= at && time < at + SAMPLE_TIME; }
+};
+
+/// statistics of one scenario
+struct ScenarioResult {
+  uint64_t frames = 0;
+  uint64_t untunedFrames = 0;
+  double cachedTime = 0;
+  double fullTime = 0;
+  double cachedUntunedTime = 0;
+  double fullUntunedTime = 0;
+  uint64_t divergingFrames = 0;
+  uint64_t transitions = 0;
+};
+
+/// <summary>
+/// Steps both builds over the same scenario and compares every output bit for bit
+/// </summary>
+ScenarioResult run(const char* name, bool retune, uint32_t seed, uint32_t frameCount, uint32_t topCount) {
+  auto cached = createCachedEvaluation();
+  auto full = createFullEvaluation();
+
+  std::vector<std::string> outputNames = cached->outputNames();
+  size_t lateralMode = std::find(outputNames.begin(), outputNames.end(), "out.lateral.output.mode") - outputNames.begin();
+  size_t verticalMode = std::find(outputNames.begin(), outputNames.end(), "out.vertical.output.mode") - outputNames.begin();
+
+  ScriptedFlight flight(retune, seed);
+  ap_sm_input in = {};
+  std::vector<double> inputs;
+  std::vector<double> cachedOutputs;
+  std::vector<double> fullOutputs;
+  std::vector<double> lastOutputs(outputNames.size(), 0.0);
+  std::vector<uint64_t> framesDifferent(outputNames.size(), 0);
+  ScenarioResult result;
+
+  fmt::print("{}:\n", name);
+  for (uint32_t frame = 0; frame < frameCount; frame++) {
+    double time = (frame + 1) * SAMPLE_TIME;
+    flight.update(in, time);
+    FieldReader reader(inputs);
+    reader.field("in", in);
+
+    double cachedTime = cached->step(inputs, cachedOutputs);
+    double fullTime = full->step(inputs, fullOutputs);
+    result.frames++;
+    result.cachedTime += cachedTime;
+    result.fullTime += fullTime;
+    if (ScriptedFlight::isUntuned(in)) {
+      result.untunedFrames++;
+      result.cachedUntunedTime += cachedTime;
+      result.fullUntunedTime += fullTime;
+    }
+
+    bool diverges = false;
+    for (size_t i = 0; i < outputNames.size(); i++) {
+      double a = cachedOutputs[i];
+      double b = fullOutputs[i];
+      if (std::isnan(a) ? !std::isnan(b) : a != b) {
+        if (result.divergingFrames == 0 && framesDifferent[i] == 0) {
+          fmt::print("  {} diverges at {:.2f} s, cached {} full {}\n", outputNames[i], time, a, b);
+        }
+        framesDifferent[i]++;
+        diverges = true;
+      }
+    }
+    result.divergingFrames += diverges;
+
+    for (size_t mode : {lateralMode, verticalMode}) {
+      if (cachedOutputs[mode] != lastOutputs[mode]) {
+        fmt::print("  {:7.2f} s {:<26} {:>3} -> {:>3}\n", time, outputNames[mode], lastOutputs[mode], cachedOutputs[mode]);
+        result.transitions++;
+      }
+    }
+    lastOutputs = cachedOutputs;
+  }
+
+  std::vector<size_t> order(outputNames.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return framesDifferent[a] > framesDifferent[b]; });
+  for (size_t i = 0; i < std::min<size_t>(topCount, order.size()) && framesDifferent[order[i]] > 0; i++) {
+    fmt::print("  {:<60} differs in {} frames\n", outputNames[order[i]], framesDifferent[order[i]]);
+  }
+
+  uint64_t tunedFrames = result.frames - result.untunedFrames;
+  fmt::print("  {} frames ({} without station), {} mode transitions, {} diverging frames\n", result.frames, result.untunedFrames,
+             result.transitions, result.divergingFrames);
+  fmt::print("  step full {:8.1f} ns  cached {:8.1f} ns  ({:+.1f} %)\n", result.fullTime / result.frames,
+             result.cachedTime / result.frames, 100 * (result.cachedTime - result.fullTime) / result.fullTime);
+  if (result.untunedFrames > 0 && tunedFrames > 0) {
+    fmt::print("  without station full {:8.1f} ns  cached {:8.1f} ns\n", result.fullUntunedTime / result.untunedFrames,
+               result.cachedUntunedTime / result.untunedFrames);
+    fmt::print("  with station    full {:8.1f} ns  cached {:8.1f} ns\n", (result.fullTime - result.fullUntunedTime) / tunedFrames,
+               (result.cachedTime - result.cachedUntunedTime) / tunedFrames);
+  }
+  return result;
+}
+
+/// <summary>
+/// Compares the native armed mode masks against the multiword code of the generated model for all combinations of the
+/// nine armed flags and the FD/AP engagement, together with the accessors against the shifts FlyByWireInterface used
+/// </summary>
+bool compareArmedModes() {
+  // published without FD and AP, passed through unchanged by both
+  const double disengagedLateral = 0;
+  const uint32_t flagCount = 10;
+
+  uint64_t checks = 0;
+  uint64_t failures = 0;
+  auto check = [&](bool equal, uint32_t combination, const char* what, double reference, double value) {
+    checks++;
+    if (!equal) {
+      if (failures == 0) {
+        fmt::print("  combination {:#05x}: {} multiword {} native {}\n", combination, what, reference, value);
+      }
+      failures++;
+    }
+  };
+
+  for (uint32_t combination = 0; combination < (1U << flagCount); combination++) {
+    auto flag = [combination](uint32_t bit) { return ((combination >> bit) & 1U) != 0; };
+    ap_lateral_armed lateral = {flag(0), flag(1)};
+    ap_vertical_armed vertical = {};
+    vertical.ALT = flag(2);
+    vertical.ALT_CST = flag(3);
+    vertical.CLB = flag(4);
+    vertical.DES = flag(5);
+    vertical.GS = flag(6);
+    vertical.FINAL_DES = flag(7);
+    vertical.TCAS = flag(8);
+    bool engaged = flag(9);
+
+    double referenceLateral;
+    double referenceVertical;
+    multiword_armed_modes::publish(lateral, vertical, engaged, disengagedLateral, referenceLateral, referenceVertical);
+
+    // as the post processed step publishes them
+    double nativeLateral = engaged ? static_cast<double>(armed_modes::lateralMask(lateral)) : disengagedLateral;
+    double nativeVertical = engaged ? static_cast<double>(armed_modes::verticalMask(vertical))
+                                    : static_cast<double>(armed_modes::bitIf(vertical.TCAS, armed_modes::VERTICAL_TCAS));
+
+    check(std::memcmp(&referenceLateral, &nativeLateral, sizeof(double)) == 0, combination, "lateral_mode_armed", referenceLateral,
+          nativeLateral);
+    check(std::memcmp(&referenceVertical, &nativeVertical, sizeof(double)) == 0, combination, "vertical_mode_armed",
+          referenceVertical, nativeVertical);
+
+    bool isLocArmed = static_cast<unsigned long long>(referenceLateral) >> 1 & 0x01;
+    bool isGsArmed = static_cast<unsigned long long>(referenceVertical) >> 4 & 0x01;
+    bool isFinalArmed = static_cast<unsigned long long>(referenceVertical) >> 5 & 0x01;
+    check(isLocArmed == armed_modes::isLateralArmed(nativeLateral, armed_modes::LATERAL_LOC), combination, "LOC armed", isLocArmed,
+          !isLocArmed);
+    check(isGsArmed == armed_modes::isVerticalArmed(nativeVertical, armed_modes::VERTICAL_GS), combination, "G/S armed", isGsArmed,
+          !isGsArmed);
+    check(isFinalArmed == armed_modes::isVerticalArmed(nativeVertical, armed_modes::VERTICAL_FINAL_DES), combination,
+          "FINAL DES armed", isFinalArmed, !isFinalArmed);
+  }
+
+  fmt::print("armed modes: {} combinations, {} checks, {} failures\n", 1U << flagCount, checks, failures);
+  return failures == 0;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  uint32_t frameCount = 14000;
+  uint32_t seed = 1;
+  uint32_t repeatCount = 5;
+  uint32_t topCount = 10;
+  bool oArmedModes = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(fmt::format("Compares the {} autopilot state machine with cached station terms against the full evaluation", AIRCRAFT));
+  args.addArgument({"-f", "--frames"}, &frameCount, "Number of frames per scenario, the approach ends after about 14000");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed of the station retunes");
+  args.addArgument({"-r", "--repeat"}, &repeatCount, "Number of runs of the retune scenario with consecutive seeds");
+  args.addArgument({"-t", "--top"}, &topCount, "Number of diverging output fields to print");
+  args.addArgument({"-a", "--armed-modes"}, &oArmedModes, "Only compare the armed mode masks against the multiword code of the model");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  if (oArmedModes) {
+    bool identical = compareArmedModes();
+    fmt::print("{}\n", identical ? "native and multiword armed mode masks are identical" : "native and multiword armed mode masks DIFFER");
+    return identical ? 0 : 1;
+  }
+
+  // check parameters
+  if (createCachedEvaluation()->inputNames() != createFullEvaluation()->inputNames()) {
+    fmt::print("Inputs of the builds differ!\n");
+    return 1;
+  }
+
+  bool success = run("approach", false, seed, frameCount, topCount).divergingFrames == 0;
+  for (uint32_t i = 0; i < repeatCount; i++) {
+    std::string name = fmt::format("retune seed {}", seed + i);
+    success &= run(name.c_str(), true, seed + i, frameCount, topCount).divergingFrames == 0;
+  }
+
+  fmt::print("{}\n", success ? "cached and full evaluation are identical" : "cached and full evaluation DIFFER");
+  return success ? 0 : 1;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// Host stand-in for the MSFS SDK header, see SimConnect.h
+
+#include <MSFS/MSFS_Core.h>
+#include <SimConnect.h>
+
+#define PANEL_SERVICE_PRE_QUERY 0
+#define PANEL_SERVICE_POST_QUERY 1
+#define PANEL_SERVICE_PRE_INSTALL 2
+#define PANEL_SERVICE_POST_INSTALL 3
+#define PANEL_SERVICE_PRE_INITIALIZE 4
+#define PANEL_SERVICE_POST_INITIALIZE 5
+#define PANEL_SERVICE_PRE_UPDATE 6
+#define PANEL_SERVICE_POST_UPDATE 7
+#define PANEL_SERVICE_PRE_GENERATE 8
+#define PANEL_SERVICE_POST_GENERATE 9
+#define PANEL_SERVICE_PRE_DRAW 10
+#define PANEL_SERVICE_POST_DRAW 11
+#define PANEL_SERVICE_PRE_KILL 12
+#define PANEL_SERVICE_POST_KILL 13
+
+typedef int ID;
+
+struct sGaugeInstallData {
+  int iSizeX;
+  int iSizeY;
+  char* strParameters;
+};
+
+struct sGaugeDrawData {
+  double mx;
+  double my;
+  double t;
+  double dt;
+  int winWidth;
+  int winHeight;
+  int fbWidth;
+  int fbHeight;
+};
+
+ID register_named_variable(const char* name);
+double get_named_variable_value(ID id);
+void set_named_variable_value(ID id, double value);
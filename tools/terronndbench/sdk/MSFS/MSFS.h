@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for the MSFS SDK header, see SimConnect.h
+
+#include <MSFS/MSFS_Core.h>
+
+#define MSFS_CALLBACK
@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for the MSFS SDK header, see SimConnect.h
+
+typedef void* FsContext;
@@ -0,0 +1,50 @@
+#pragma once
+
+// Host stand-in for the nanovg header of the MSFS SDK, only the entry points that terronnd draws with, see SimConnect.h
+
+struct NVGcontext;
+
+struct NVGcolor {
+  float r;
+  float g;
+  float b;
+  float a;
+};
+
+struct NVGpaint {
+  float xform[6];
+  float extent[2];
+  float radius;
+  float feather;
+  NVGcolor innerColor;
+  NVGcolor outerColor;
+  int image;
+};
+
+struct NVGparams {
+  void* userPtr;
+  int edgeAntiAlias;
+  int (*renderUpdateTexture)(void* uptr, int image, int x, int y, int w, int h, const unsigned char* data);
+};
+
+NVGcontext* nvgCreateInternal(NVGparams* params);
+NVGparams* nvgInternalParams(NVGcontext* ctx);
+void nvgDeleteInternal(NVGcontext* ctx);
+
+void nvgBeginFrame(NVGcontext* ctx, float windowWidth, float windowHeight, float devicePixelRatio);
+void nvgEndFrame(NVGcontext* ctx);
+
+NVGcolor nvgRGBA(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+void nvgFillColor(NVGcontext* ctx, NVGcolor color);
+void nvgFillPaint(NVGcontext* ctx, NVGpaint paint);
+NVGpaint nvgImagePattern(NVGcontext* ctx, float ox, float oy, float ex, float ey, float angle, int image, float alpha);
+
+void nvgBeginPath(NVGcontext* ctx);
+void nvgRect(NVGcontext* ctx, float x, float y, float w, float h);
+void nvgFill(NVGcontext* ctx);
+
+int nvgCreateImageMem(NVGcontext* ctx, int imageFlags, unsigned char* data, int ndata);
+int nvgCreateImageRGBA(NVGcontext* ctx, int w, int h, int imageFlags, const unsigned char* data);
+void nvgUpdateImage(NVGcontext* ctx, int image, const unsigned char* data);
+void nvgImageSize(NVGcontext* ctx, int image, int* w, int* h);
+void nvgDeleteImage(NVGcontext* ctx, int image);
@@ -0,0 +1,147 @@
+#pragma once
+
+// Host stand-in for the SimConnect SDK header, only the declarations that terronnd uses. The functions are implemented
+// by the simulated SDK of terronndbench (src/SimulatedSdk.cpp).
+
+#include <cstdint>
+
+typedef void* HANDLE;
+typedef std::uint32_t DWORD;
+// 32 bits like the long of Windows, so the error codes are negative
+typedef std::int32_t HRESULT;
+
+#define S_OK ((HRESULT)0)
+#define E_FAIL ((HRESULT)0x80004005u)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+
+#define SIMCONNECT_CLIENTDATA_MAX_SIZE 8192
+#define SIMCONNECT_CLIENTDATAOFFSET_AUTO ((DWORD)-1)
+#define SIMCONNECT_UNUSED ((DWORD)-1)
+#define SIMCONNECT_OBJECT_ID_USER 0
+
+typedef DWORD SIMCONNECT_CLIENT_DATA_REQUEST_FLAG;
+#define SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_DEFAULT 0
+#define SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_CHANGED 1
+
+typedef DWORD SIMCONNECT_CLIENT_DATA_SET_FLAG;
+#define SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT 0
+
+typedef DWORD SIMCONNECT_CREATE_CLIENT_DATA_FLAG;
+#define SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT 0
+#define SIMCONNECT_CREATE_CLIENT_DATA_FLAG_READ_ONLY 1
+
+enum SIMCONNECT_CLIENT_DATA_PERIOD {
+  SIMCONNECT_CLIENT_DATA_PERIOD_NEVER,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+  SIMCONNECT_CLIENT_DATA_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET,
+  SIMCONNECT_CLIENT_DATA_PERIOD_SECOND,
+};
+
+enum SIMCONNECT_PERIOD {
+  SIMCONNECT_PERIOD_NEVER,
+  SIMCONNECT_PERIOD_ONCE,
+  SIMCONNECT_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_PERIOD_SIM_FRAME,
+  SIMCONNECT_PERIOD_SECOND,
+};
+
+enum SIMCONNECT_DATATYPE {
+  SIMCONNECT_DATATYPE_INVALID,
+  SIMCONNECT_DATATYPE_INT32,
+  SIMCONNECT_DATATYPE_INT64,
+  SIMCONNECT_DATATYPE_FLOAT32,
+  SIMCONNECT_DATATYPE_FLOAT64,
+};
+
+enum SIMCONNECT_RECV_ID {
+  SIMCONNECT_RECV_ID_NULL,
+  SIMCONNECT_RECV_ID_EXCEPTION,
+  SIMCONNECT_RECV_ID_OPEN,
+  SIMCONNECT_RECV_ID_QUIT,
+  SIMCONNECT_RECV_ID_EVENT,
+  SIMCONNECT_RECV_ID_EVENT_OBJECT_ADDREMOVE,
+  SIMCONNECT_RECV_ID_EVENT_FILENAME,
+  SIMCONNECT_RECV_ID_EVENT_FRAME,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA_BYTYPE,
+  SIMCONNECT_RECV_ID_WEATHER_OBSERVATION,
+  SIMCONNECT_RECV_ID_CLOUD_STATE,
+  SIMCONNECT_RECV_ID_ASSIGNED_OBJECT_ID,
+  SIMCONNECT_RECV_ID_RESERVED_KEY,
+  SIMCONNECT_RECV_ID_CUSTOM_ACTION,
+  SIMCONNECT_RECV_ID_SYSTEM_STATE,
+  SIMCONNECT_RECV_ID_CLIENT_DATA,
+};
+
+struct SIMCONNECT_RECV {
+  DWORD dwSize;
+  DWORD dwVersion;
+  DWORD dwID;
+};
+
+struct SIMCONNECT_RECV_EXCEPTION : public SIMCONNECT_RECV {
+  DWORD dwException;
+  DWORD dwSendID;
+  DWORD dwIndex;
+};
+
+struct SIMCONNECT_RECV_SIMOBJECT_DATA : public SIMCONNECT_RECV {
+  DWORD dwRequestID;
+  DWORD dwObjectID;
+  DWORD dwDefineID;
+  DWORD dwFlags;
+  DWORD dwentrynumber;
+  DWORD dwoutof;
+  DWORD dwDefineCount;
+  DWORD dwData;
+};
+
+struct SIMCONNECT_RECV_CLIENT_DATA : public SIMCONNECT_RECV_SIMOBJECT_DATA {};
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char* szName, void* hWnd, DWORD UserEventWin32, HANDLE hEventHandle, DWORD ConfigIndex);
+HRESULT SimConnect_Close(HANDLE hSimConnect);
+HRESULT SimConnect_GetNextDispatch(HANDLE hSimConnect, SIMCONNECT_RECV** ppData, DWORD* pcbData);
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE hSimConnect,
+                                       DWORD DefineID,
+                                       const char* DatumName,
+                                       const char* UnitsName,
+                                       SIMCONNECT_DATATYPE DatumType = SIMCONNECT_DATATYPE_FLOAT64,
+                                       float fEpsilon = 0,
+                                       DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE hSimConnect,
+                                          DWORD RequestID,
+                                          DWORD DefineID,
+                                          DWORD ObjectID,
+                                          SIMCONNECT_PERIOD Period,
+                                          DWORD Flags = 0,
+                                          DWORD origin = 0,
+                                          DWORD interval = 0,
+                                          DWORD limit = 0);
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE hSimConnect, const char* szClientDataName, DWORD ClientDataID);
+HRESULT SimConnect_CreateClientData(HANDLE hSimConnect, DWORD ClientDataID, DWORD dwSize, SIMCONNECT_CREATE_CLIENT_DATA_FLAG Flags);
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE hSimConnect,
+                                             DWORD DefineID,
+                                             DWORD dwOffset,
+                                             DWORD dwSizeOrType,
+                                             float fEpsilon = 0,
+                                             DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestClientData(HANDLE hSimConnect,
+                                     DWORD ClientDataID,
+                                     DWORD RequestID,
+                                     DWORD DefineID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD Period = SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+                                     SIMCONNECT_CLIENT_DATA_REQUEST_FLAG Flags = 0,
+                                     DWORD origin = 0,
+                                     DWORD interval = 0,
+                                     DWORD limit = 0);
+HRESULT SimConnect_SetClientData(HANDLE hSimConnect,
+                                 DWORD ClientDataID,
+                                 DWORD DefineID,
+                                 SIMCONNECT_CLIENT_DATA_SET_FLAG Flags,
+                                 DWORD dwReserved,
+                                 DWORD cbUnitSize,
+                                 void* pDataSet);
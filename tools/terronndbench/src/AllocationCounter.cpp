@@ -0,0 +1,122 @@
+#include "AllocationCounter.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+namespace {
+
+// the header in front of every block keeps the alignment of the allocation
+struct alignas(alignof(std::max_align_t)) BlockHeader {
+  size_t size;
+  bool counted;
+};
+
+bool counting = false;
+AllocationCounter::Statistics statistics;
+
+void* allocate(size_t size) {
+  auto* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+  if (header == nullptr) {
+    return nullptr;
+  }
+
+  header->size = size;
+  header->counted = counting;
+  if (counting) {
+    statistics.allocations++;
+    statistics.allocatedBytes += size;
+  }
+  return header + 1;
+}
+
+void release(void* block) {
+  if (block == nullptr) {
+    return;
+  }
+
+  auto* header = static_cast<BlockHeader*>(block) - 1;
+  if (header->counted) {
+    statistics.releases++;
+    statistics.releasedBytes += header->size;
+  }
+  std::free(header);
+}
+
+}  // namespace
+
+AllocationCounter::Section::Section() : counting(::counting) {
+  ::counting = true;
+}
+
+AllocationCounter::Section::~Section() {
+  ::counting = counting;
+}
+
+AllocationCounter::Pause::Pause() : counting(::counting) {
+  ::counting = false;
+}
+
+AllocationCounter::Pause::~Pause() {
+  ::counting = counting;
+}
+
+AllocationCounter::Statistics AllocationCounter::statistics() {
+  return ::statistics;
+}
+
+uint64_t AllocationCounter::residentBytes() {
+  // the second field of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  uint64_t pages = 0;
+  uint64_t residentPages = 0;
+  if (!(statm >> pages >> residentPages)) {
+    return 0;
+  }
+  return residentPages * 4096;
+}
+
+void* operator new(size_t size) {
+  void* block = allocate(size);
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  return block;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void operator delete(void* block) noexcept {
+  release(block);
+}
+
+void operator delete[](void* block) noexcept {
+  release(block);
+}
+
+void operator delete(void* block, size_t) noexcept {
+  release(block);
+}
+
+void operator delete[](void* block, size_t) noexcept {
+  release(block);
+}
+
+void operator delete(void* block, const std::nothrow_t&) noexcept {
+  release(block);
+}
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept {
+  release(block);
+}
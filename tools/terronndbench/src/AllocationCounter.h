@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+/// <summary>
+/// Counts the heap allocations of the sections that run the gauge code
+/// </summary>
+/// <remarks>
+/// The global operator new of terronndbench marks every block whether it was allocated in a counted section. A counted
+/// block is released from the live bytes wherever it is deleted, so the live bytes are the memory that the gauge holds.
+/// </remarks>
+class AllocationCounter {
+ public:
+  struct Statistics {
+    uint64_t allocations = 0;
+    uint64_t releases = 0;
+    uint64_t allocatedBytes = 0;
+    uint64_t releasedBytes = 0;
+
+    uint64_t liveBytes() const { return allocatedBytes - releasedBytes; }
+  };
+
+  /// <summary>
+  /// Counts the allocations of its lifetime
+  /// </summary>
+  class Section {
+   public:
+    Section();
+    ~Section();
+    Section(const Section&) = delete;
+    Section& operator=(const Section&) = delete;
+
+   private:
+    bool counting;
+  };
+
+  /// <summary>
+  /// Does not count the allocations of its lifetime within a section, e.g. the textures of the simulated nanovg
+  /// </summary>
+  class Pause {
+   public:
+    Pause();
+    ~Pause();
+    Pause(const Pause&) = delete;
+    Pause& operator=(const Pause&) = delete;
+
+   private:
+    bool counting;
+  };
+
+  static Statistics statistics();
+
+  /// the resident memory of the process in bytes, 0 if the platform does not report it
+  static uint64_t residentBytes();
+};
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "FrameEncoding.h"
+#include "types/simbridge.h"
+#include "zlib.h"
+
+namespace {
+
+const uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
+const size_t MAX_RUN = 128;
+const size_t MAX_LITERALS = 64;
+const size_t MAX_PAIRS = 64;
+
+void appendBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+  out.push_back(static_cast<uint8_t>(value >> 24));
+  out.push_back(static_cast<uint8_t>(value >> 16));
+  out.push_back(static_cast<uint8_t>(value >> 8));
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t readBigEndian(const uint8_t* data) {
+  return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) |
+         data[3];
+}
+
+void appendChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& content) {
+  appendBigEndian(out, static_cast<uint32_t>(content.size()));
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), content.begin(), content.end());
+  appendBigEndian(out, static_cast<uint32_t>(crc32(0, &out[start], static_cast<uInt>(out.size() - start))));
+}
+
+uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+  int p = a + b - c;
+  int pa = std::abs(p - a);
+  int pb = std::abs(p - b);
+  int pc = std::abs(p - c);
+  if (pa <= pb && pa <= pc) {
+    return a;
+  }
+  return pb <= pc ? b : c;
+}
+
+/// appends the packets of the indices
+void appendPackets(std::vector<uint8_t>& out, const std::vector<uint8_t>& indices) {
+  size_t literalStart = 0;
+  auto flushLiterals = [&](size_t end) {
+    while (literalStart < end) {
+      size_t count = std::min(end - literalStart, MAX_LITERALS);
+      out.push_back(static_cast<uint8_t>(0x7f + count));
+      out.insert(out.end(), indices.begin() + literalStart, indices.begin() + literalStart + count);
+      literalStart += count;
+    }
+  };
+
+  size_t i = 0;
+  while (i < indices.size()) {
+    size_t run = 1;
+    while (i + run < indices.size() && run < MAX_RUN && indices[i + run] == indices[i]) {
+      run++;
+    }
+    if (run >= 3) {
+      flushLiterals(i);
+      out.push_back(static_cast<uint8_t>(run - 1));
+      out.push_back(indices[i]);
+      i += run;
+      literalStart = i;
+      continue;
+    }
+
+    size_t pairs = 0;
+    while (i + 2 * pairs + 1 < indices.size() && pairs < MAX_PAIRS && indices[i + 2 * pairs] == indices[i] &&
+           indices[i + 2 * pairs + 1] == indices[i + 1]) {
+      pairs++;
+    }
+    if (pairs >= 2) {
+      flushLiterals(i);
+      out.push_back(static_cast<uint8_t>(0xbf + pairs));
+      out.push_back(indices[i]);
+      out.push_back(indices[i + 1]);
+      i += 2 * pairs;
+      literalStart = i;
+    } else {
+      i += run;
+    }
+  }
+  flushLiterals(indices.size());
+}
+
+void appendPalette(std::vector<uint8_t>& out, const IndexedFrame& frame) {
+  for (const auto& color : frame.palette) {
+    out.insert(out.end(), color.begin(), color.end());
+  }
+}
+
+}  // namespace
+
+std::vector<uint8_t> encodePaletteRle(const IndexedFrame& frame) {
+  std::vector<uint8_t> out(sizeof(types::PaletteFrameHeader));
+  types::PaletteFrameHeader header = {frame.width, frame.height, static_cast<uint8_t>(frame.palette.size())};
+  std::memcpy(out.data(), &header, sizeof(header));
+  appendPalette(out, frame);
+  appendPackets(out, frame.indices);
+  return out;
+}
+
+std::vector<uint8_t> encodeTileDelta(const IndexedFrame* previous, const IndexedFrame& frame, uint8_t tileSize) {
+  bool full = previous == nullptr || previous->width != frame.width || previous->height != frame.height;
+  const size_t tilesPerRow = (frame.width + tileSize - 1) / tileSize;
+  const size_t tileRows = (frame.height + tileSize - 1) / tileSize;
+
+  std::vector<uint8_t> tiles;
+  std::vector<uint8_t> tileIndices;
+  uint16_t tileCount = 0;
+  for (size_t tile = 0; tile < tilesPerRow * tileRows; tile++) {
+    const size_t left = (tile % tilesPerRow) * tileSize;
+    const size_t top = (tile / tilesPerRow) * tileSize;
+    const size_t columns = std::min<size_t>(tileSize, frame.width - left);
+    const size_t rows = std::min<size_t>(tileSize, frame.height - top);
+
+    tileIndices.clear();
+    bool changed = full;
+    for (size_t row = 0; row < rows; row++) {
+      auto begin = frame.indices.begin() + (top + row) * frame.width + left;
+      tileIndices.insert(tileIndices.end(), begin, begin + columns);
+      changed = changed || !std::equal(begin, begin + columns, previous->indices.begin() + (top + row) * frame.width + left);
+    }
+    if (!changed) {
+      continue;
+    }
+
+    uint16_t index = static_cast<uint16_t>(tile);
+    tiles.insert(tiles.end(), reinterpret_cast<uint8_t*>(&index), reinterpret_cast<uint8_t*>(&index) + sizeof(index));
+    appendPackets(tiles, tileIndices);
+    tileCount++;
+  }
+
+  std::vector<uint8_t> out(sizeof(types::TileDeltaHeader));
+  types::TileDeltaHeader header = {frame.width, frame.height, tileSize, static_cast<uint8_t>(frame.palette.size()), tileCount};
+  std::memcpy(out.data(), &header, sizeof(header));
+  appendPalette(out, frame);
+  out.insert(out.end(), tiles.begin(), tiles.end());
+  return out;
+}
+
+std::vector<uint8_t> encodePng(const std::vector<uint8_t>& rgba, uint16_t width, uint16_t height) {
+  const size_t stride = static_cast<size_t>(width) * 4;
+  std::vector<uint8_t> filtered;
+  filtered.reserve((stride + 1) * height);
+  for (size_t y = 0; y < height; y++) {
+    const uint8_t* row = &rgba[y * stride];
+    filtered.push_back(1);
+    for (size_t x = 0; x < stride; x++) {
+      filtered.push_back(static_cast<uint8_t>(row[x] - (x >= 4 ? row[x - 4] : 0)));
+    }
+  }
+
+  z_stream stream = {};
+  deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+  std::vector<uint8_t> compressed(deflateBound(&stream, static_cast<uLong>(filtered.size())));
+  stream.next_in = filtered.data();
+  stream.avail_in = static_cast<uInt>(filtered.size());
+  stream.next_out = compressed.data();
+  stream.avail_out = static_cast<uInt>(compressed.size());
+  deflate(&stream, Z_FINISH);
+  compressed.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  std::vector<uint8_t> headerChunk;
+  appendBigEndian(headerChunk, width);
+  appendBigEndian(headerChunk, height);
+  // 8 bit, RGBA, deflate, adaptive filtering, no interlacing
+  headerChunk.insert(headerChunk.end(), {8, 6, 0, 0, 0});
+
+  std::vector<uint8_t> png(PNG_SIGNATURE, PNG_SIGNATURE + sizeof(PNG_SIGNATURE));
+  appendChunk(png, "IHDR", headerChunk);
+  appendChunk(png, "IDAT", compressed);
+  appendChunk(png, "IEND", {});
+  return png;
+}
+
+bool decodePng(const std::vector<uint8_t>& png, std::vector<uint8_t>& rgba, uint16_t& width, uint16_t& height) {
+  if (png.size() < sizeof(PNG_SIGNATURE) || std::memcmp(png.data(), PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0) {
+    return false;
+  }
+
+  std::vector<uint8_t> compressed;
+  size_t position = sizeof(PNG_SIGNATURE);
+  while (position + 12 <= png.size()) {
+    uint32_t length = readBigEndian(&png[position]);
+    const uint8_t* type = &png[position + 4];
+    const uint8_t* content = &png[position + 8];
+    if (position + 12 + length > png.size()) {
+      return false;
+    }
+    if (std::memcmp(type, "IHDR", 4) == 0) {
+      if (length != 13 || content[8] != 8 || content[9] != 6 || content[12] != 0) {
+        return false;
+      }
+      width = static_cast<uint16_t>(readBigEndian(content));
+      height = static_cast<uint16_t>(readBigEndian(content + 4));
+    } else if (std::memcmp(type, "IDAT", 4) == 0) {
+      compressed.insert(compressed.end(), content, content + length);
+    }
+    position += 12 + length;
+  }
+
+  const size_t stride = static_cast<size_t>(width) * 4;
+  std::vector<uint8_t> filtered((stride + 1) * height);
+  z_stream stream = {};
+  inflateInit(&stream);
+  stream.next_in = compressed.data();
+  stream.avail_in = static_cast<uInt>(compressed.size());
+  stream.next_out = filtered.data();
+  stream.avail_out = static_cast<uInt>(filtered.size());
+  int result = inflate(&stream, Z_FINISH);
+  inflateEnd(&stream);
+  if (result != Z_STREAM_END || stream.total_out != filtered.size()) {
+    return false;
+  }
+
+  rgba.assign(stride * height, 0);
+  std::vector<uint8_t> zeroRow(stride, 0);
+  for (size_t y = 0; y < height; y++) {
+    const uint8_t filter = filtered[y * (stride + 1)];
+    const uint8_t* in = &filtered[y * (stride + 1) + 1];
+    uint8_t* row = &rgba[y * stride];
+    // the row above the first one is zero, like in the PNG specification
+    const uint8_t* above = y > 0 ? &rgba[(y - 1) * stride] : zeroRow.data();
+    switch (filter) {
+      case 0:
+        std::memcpy(row, in, stride);
+        break;
+      case 1:
+        std::memcpy(row, in, 4);
+        for (size_t x = 4; x < stride; x++) {
+          row[x] = static_cast<uint8_t>(in[x] + row[x - 4]);
+        }
+        break;
+      case 2:
+        for (size_t x = 0; x < stride; x++) {
+          row[x] = static_cast<uint8_t>(in[x] + above[x]);
+        }
+        break;
+      case 3:
+        for (size_t x = 0; x < stride; x++) {
+          row[x] = static_cast<uint8_t>(in[x] + (((x >= 4 ? row[x - 4] : 0) + above[x]) >> 1));
+        }
+        break;
+      case 4:
+        for (size_t x = 0; x < stride; x++) {
+          row[x] = static_cast<uint8_t>(in[x] + (x >= 4 ? paeth(row[x - 4], above[x], above[x - 4]) : above[x]));
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "TerrainFrames.h"
+
+/// <summary>
+/// Encodes a frame in the PALETTE_RLE format of the terrain on ND (see types::PaletteFrameHeader)
+/// </summary>
+/// <remarks>
+/// Runs of at least three equal pixels become run packets, at least two repetitions of a pair pair packets, everything else
+/// literal packets.
+/// </remarks>
+std::vector<uint8_t> encodePaletteRle(const IndexedFrame& frame);
+
+/// <summary>
+/// Encodes the tiles of a frame that differ from the previous frame in the TILE_DELTA format (see types::TileDeltaHeader)
+/// </summary>
+/// <remarks>All tiles are encoded without a previous frame of the same size.</remarks>
+std::vector<uint8_t> encodeTileDelta(const IndexedFrame* previous, const IndexedFrame& frame, uint8_t tileSize);
+
+/// <summary>
+/// Encodes the RGBA pixels of a frame as PNG, the COMPRESSED_IMAGE format of the terrain on ND
+/// </summary>
+/// <remarks>Every row uses the Sub filter, the output is an 8 bit RGBA PNG.</remarks>
+std::vector<uint8_t> encodePng(const std::vector<uint8_t>& rgba, uint16_t width, uint16_t height);
+
+/// <summary>
+/// Decodes an 8 bit RGBA PNG the way the image loader of nanovg does it: inflate all IDAT chunks and undo the filters
+/// </summary>
+/// <remarks>
+/// The output buffer is resized per call like the loader allocates per image. Other color types and interlacing are not
+/// supported, encodePng does not produce them.
+/// </remarks>
+/// <returns>false if the data is not such a PNG.</returns>
+bool decodePng(const std::vector<uint8_t>& png, std::vector<uint8_t>& rgba, uint16_t& width, uint16_t& height);
@@ -0,0 +1,194 @@
+#include "SimBridgeProducer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "FrameEncoding.h"
+#include "SimulatedSdk.h"
+#include "navigationdisplay/configuration.h"
+#include "simconnect/clientdataarea.hpp"
+
+namespace {
+
+const char* AIRCRAFT_STATUS_NAME = "FBW_SIMBRIDGE_EGPWC_AIRCRAFT_STATUS";
+
+}  // namespace
+
+SimBridgeProducer::SimBridgeProducer(const Settings& settings)
+    : settings(settings), terrain(settings.width, settings.height, settings.seed), chunk(SIMCONNECT_CLIENTDATA_MAX_SIZE) {
+  displays[0].left = true;
+  displays[0].thresholdsName = navigationdisplay::ThresholdsLeftName;
+  displays[0].frameInfoName = navigationdisplay::FrameInfoLeftName;
+  displays[0].frameDataName = navigationdisplay::FrameDataLeftName;
+  displays[1].left = false;
+  displays[1].thresholdsName = navigationdisplay::ThresholdsRightName;
+  displays[1].frameInfoName = navigationdisplay::FrameInfoRightName;
+  displays[1].frameDataName = navigationdisplay::FrameDataRightName;
+}
+
+const std::vector<SimBridgeProducer::SentFrame>& SimBridgeProducer::update(double time_s) {
+  sentFrames.clear();
+
+  const auto* data = SimulatedSdk::instance().clientData(AIRCRAFT_STATUS_NAME);
+  if (data != nullptr && data->size() >= sizeof(status)) {
+    std::memcpy(&status, data->data(), sizeof(status));
+  }
+  // a gauge before the handshake publishes no protocol and gets the frames of version 0
+  const auto* protocol = SimulatedSdk::instance().clientData(navigationdisplay::ProtocolName);
+  if (protocol != nullptr && protocol->size() >= sizeof(gaugeProtocol)) {
+    std::memcpy(&gaugeProtocol, protocol->data(), sizeof(gaugeProtocol));
+  }
+
+  // a new range or mode restarts the display, the frame that is sent is dropped by the display
+  for (auto& display : displays) {
+    const bool active = display.left ? status.ndTerrainOnNdActiveCapt != 0 : status.ndTerrainOnNdActiveFO != 0;
+    const uint16_t range = display.left ? status.ndRangeCapt : status.ndRangeFO;
+    const uint8_t mode = display.left ? status.efisModeCapt : status.efisModeFO;
+    if (active != display.active || range != display.range || mode != display.mode) {
+      stats.abortedFrames += display.sending;
+      display.active = active;
+      display.range = range;
+      display.mode = mode;
+      display.firstFrame = true;
+      display.sending = false;
+      display.generation = 0;
+      display.frameTime_s = -1.0e9;
+    }
+  }
+
+  auto& left = displays[0];
+  auto& right = displays[1];
+  auto due = [&](const Display& display) {
+    return display.active && !display.sending && time_s - display.frameTime_s >= settings.frameInterval_s;
+  };
+
+  if (left.active && right.active && left.range == right.range && left.mode == right.mode) {
+    // both displays wait for each other, so they stay on the same frames
+    if (!left.sending && !right.sending && (due(left) || due(right))) {
+      renderStep(time_s);
+      const IndexedFrame* previous = left.generation != 0 && left.generation == right.generation ? &left.previous : nullptr;
+      encode(previous, left.data);
+      right.data = left.data;
+      const uint32_t frameId = ++lastFrameId;
+      startFrame(left, time_s, frameId);
+      startFrame(right, time_s, frameId);
+      stats.sharedFrames++;
+    }
+  } else {
+    for (auto& display : displays) {
+      if (due(display)) {
+        renderStep(time_s);
+        encode(display.generation != 0 ? &display.previous : nullptr, display.data);
+        startFrame(display, time_s, ++lastFrameId);
+      }
+    }
+  }
+
+  for (auto& display : displays) {
+    if (display.sending) {
+      sendChunks(display);
+    }
+  }
+  return sentFrames;
+}
+
+void SimBridgeProducer::renderStep(double time_s) {
+  auto start = std::chrono::steady_clock::now();
+
+  // the sweep runs from the left to the right of the arc
+  const double stepWidth_deg = 180.0 / settings.sweepSteps;
+  const double fromBearing_deg = -90.0 + (generation % settings.sweepSteps) * stepWidth_deg;
+  terrain.renderSweep(time_s, status.altitude, fromBearing_deg, fromBearing_deg + stepWidth_deg, picture);
+  generation++;
+
+  stats.renderTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint16_t SimBridgeProducer::protocolVersion() const {
+  return std::min(settings.protocolVersion, gaugeProtocol.version);
+}
+
+types::FrameFormat SimBridgeProducer::format() const {
+  if (protocolVersion() == 0 || (gaugeProtocol.capabilities & (1 << settings.format)) == 0) {
+    return types::FrameFormat::COMPRESSED_IMAGE;
+  }
+  return settings.format;
+}
+
+void SimBridgeProducer::encode(const IndexedFrame* previous, std::vector<uint8_t>& data) const {
+  switch (format()) {
+    case types::FrameFormat::TILE_DELTA:
+      data = encodeTileDelta(previous, picture, settings.tileSize);
+      break;
+    case types::FrameFormat::COMPRESSED_IMAGE:
+      data = encodePng(picture.toRgba(), picture.width, picture.height);
+      break;
+    default:
+      data = encodePaletteRle(picture);
+      break;
+  }
+}
+
+void SimBridgeProducer::startFrame(Display& display, double time_s, uint32_t frameId) {
+  display.frameId = frameId;
+  display.protocolVersion = protocolVersion();
+  display.frameTime_s = time_s;
+  display.sentBytes = 0;
+  display.sending = true;
+  display.previous = picture;
+  display.generation = generation;
+  display.rgba = picture.toRgba();
+
+  types::ThresholdData thresholds{};
+  thresholds.lowerThreshold = static_cast<int16_t>(status.altitude - 2000 > 0 ? status.altitude - 2000 : 0);
+  thresholds.lowerThresholdMode = 0;
+  thresholds.upperThreshold = static_cast<int16_t>(status.altitude + 2000);
+  thresholds.upperThresholdMode = types::ThresholdMode::WARNING;
+  thresholds.firstFrame = display.firstFrame;
+  thresholds.displayRange = display.range;
+  thresholds.displayMode = display.mode;
+  thresholds.frameByteCount = static_cast<uint32_t>(display.data.size());
+
+  if (display.protocolVersion != 0) {
+    types::FrameInfoData info{};
+    info.protocolVersion = display.protocolVersion;
+    info.frameFormat = format();
+    info.frameId = frameId;
+    info.transferId = ++display.transferId;
+    SimulatedSdk::instance().setClientData(display.frameInfoName, &info, sizeof(info));
+  }
+  SimulatedSdk::instance().setClientData(display.thresholdsName, &thresholds, sizeof(thresholds));
+
+  display.firstFrame = false;
+  stats.frames++;
+  stats.bytes += display.data.size();
+}
+
+void SimBridgeProducer::sendChunks(Display& display) {
+  using FrameData = simconnect::ClientDataAreaBuffered<uint8_t, SIMCONNECT_CLIENTDATA_MAX_SIZE>;
+
+  for (uint32_t i = 0; (settings.chunksPerFrame == 0 || i < settings.chunksPerFrame) && display.sentBytes < display.data.size(); i++) {
+    // the chunks of version 0 have no header
+    const size_t headerSize = display.protocolVersion != 0 ? sizeof(simconnect::ChunkHeader) : 0;
+    const size_t payloadSize = display.protocolVersion != 0 ? FrameData::PayloadSize : FrameData::HeaderlessPayloadSize;
+    size_t payloadBytes = display.data.size() - display.sentBytes;
+    if (payloadBytes > payloadSize) {
+      payloadBytes = payloadSize;
+    }
+
+    if (headerSize != 0) {
+      const simconnect::ChunkHeader header = {display.transferId, static_cast<uint32_t>(display.sentBytes)};
+      std::memcpy(chunk.data(), &header, sizeof(header));
+    }
+    std::memcpy(chunk.data() + headerSize, display.data.data() + display.sentBytes, payloadBytes);
+    SimulatedSdk::instance().setClientData(display.frameDataName, chunk.data(), chunk.size());
+    display.sentBytes += payloadBytes;
+    stats.chunks++;
+  }
+
+  if (display.sentBytes >= display.data.size()) {
+    display.sending = false;
+    sentFrames.push_back({display.left, display.frameId, &display.rgba});
+  }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TerrainFrames.h"
+#include "types/simbridge.h"
+
+/// <summary>
+/// Stand-in for the terrain on ND of the SimBridge: follows the aircraft status of the gauge and sends the frames of
+/// both displays in chunks through the simulated SDK
+/// </summary>
+/// <remarks>
+/// A display gets frames while the status reports its terrain as active. Every frame is the picture after the next step
+/// of the sweep, the tile deltas contain the tiles that changed since the last frame of the display. Displays with the
+/// same range and mode get their frames together with the same frame id. A new frame starts after the frame interval
+/// once the last one is sent, a change of the range or mode restarts the display with a first frame.
+/// The producer speaks the lower protocol version of its settings and the gauge. Version 0 is a SimBridge before the
+/// handshake, it sends compressed images in chunks without headers and no frame info.
+/// </remarks>
+class SimBridgeProducer {
+ public:
+  struct Settings {
+    types::FrameFormat format = types::FrameFormat::PALETTE_RLE;
+    uint16_t width = 768;
+    uint16_t height = 768;
+    uint32_t seed = 1;
+    double frameInterval_s = 2.5;
+    // the chunks per display and simulator frame, 0 sends a frame at once
+    uint32_t chunksPerFrame = 4;
+    uint32_t sweepSteps = 12;
+    uint8_t tileSize = 32;
+    // the highest protocol version that the producer speaks, see types::ProtocolData
+    uint16_t protocolVersion = 1;
+  };
+
+  struct Statistics {
+    uint64_t frames = 0;
+    uint64_t sharedFrames = 0;
+    uint64_t abortedFrames = 0;
+    uint64_t chunks = 0;
+    uint64_t bytes = 0;
+    double renderTime = 0;
+  };
+
+  /// <summary>
+  /// A frame of which the last chunk was sent in the last update
+  /// </summary>
+  struct SentFrame {
+    bool left;
+    uint32_t frameId;
+    const std::vector<uint8_t>* rgba;
+  };
+
+  explicit SimBridgeProducer(const Settings& settings);
+
+  /// <summary>
+  /// Reads the aircraft status of the gauge and sends the chunks of the simulator frame at the time
+  /// </summary>
+  /// <returns>the frames that are sent completely in this frame</returns>
+  const std::vector<SentFrame>& update(double time_s);
+
+  const Statistics& statistics() const { return stats; }
+
+ private:
+  struct Display {
+    bool left;
+    std::string thresholdsName;
+    std::string frameInfoName;
+    std::string frameDataName;
+    bool active = false;
+    uint16_t range = 0;
+    uint8_t mode = 0;
+    bool firstFrame = true;
+    double frameTime_s = -1.0e9;
+    uint32_t frameId = 0;
+    uint32_t transferId = 0;
+    uint16_t protocolVersion = 0;
+    size_t sentBytes = 0;
+    bool sending = false;
+    // the sweep step of the last picture of the display, 0 if the display has none
+    uint64_t generation = 0;
+    IndexedFrame previous;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> rgba;
+  };
+
+  Settings settings;
+  TerrainFrames terrain;
+  Statistics stats;
+  types::AircraftStatusData status{};
+  types::ProtocolData gaugeProtocol{};
+  Display displays[2];
+  IndexedFrame picture;
+  uint64_t generation = 0;
+  uint32_t lastFrameId = 0;
+  std::vector<uint8_t> chunk;
+  std::vector<SentFrame> sentFrames;
+
+  /// renders the next step of the sweep into the picture
+  void renderStep(double time_s);
+  /// the protocol version that the gauge and the producer speak
+  uint16_t protocolVersion() const;
+  /// the format of the settings if the protocol and the gauge support it, otherwise a compressed image
+  types::FrameFormat format() const;
+  /// encodes the picture in the negotiated format, the tile deltas against the previous picture if there is one
+  void encode(const IndexedFrame* previous, std::vector<uint8_t>& data) const;
+  /// sends the frame info and the threshold data of the encoded picture of the display
+  void startFrame(Display& display, double time_s, uint32_t frameId);
+  void sendChunks(Display& display);
+};
@@ -0,0 +1,444 @@
+#include "SimulatedSdk.h"
+
+#include <cstddef>
+#include <cstring>
+
+#include "AllocationCounter.h"
+#include "FrameEncoding.h"
+
+// the opaque context of the stand-in header, the renderer of its parameters is the simulated SDK
+struct NVGcontext {
+  void* userPtr;
+  int drawnImage;
+  NVGparams params;
+};
+
+namespace {
+
+int renderUpdateTexture(void* uptr, int image, int x, int y, int w, int h, const unsigned char* data) {
+  SimulatedSdk::instance().updateImageRegion(static_cast<NVGcontext*>(uptr), image, x, y, w, h, data);
+  return 1;
+}
+
+}  // namespace
+
+SimulatedSdk& SimulatedSdk::instance() {
+  static SimulatedSdk sdk;
+  return sdk;
+}
+
+void SimulatedSdk::setVariable(const std::string& name, double value) {
+  setNamedVariable(registerNamedVariable(name.c_str()), value);
+}
+
+double SimulatedSdk::variable(const std::string& name) const {
+  auto id = variableIds.find(name);
+  return id != variableIds.end() ? variables[id->second] : 0.0;
+}
+
+void SimulatedSdk::setSimVariable(const std::string& name, double value) {
+  simVariables[name] = value;
+}
+
+void SimulatedSdk::setClientData(const std::string& name, const void* data, size_t size) {
+  for (const auto& request : clientDataRequests) {
+    if (request.area == name) {
+      queue(SIMCONNECT_RECV_ID_CLIENT_DATA, request.requestId, 0, data, size < request.size ? size : request.size);
+    }
+  }
+}
+
+const std::vector<uint8_t>* SimulatedSdk::clientData(const std::string& name) const {
+  auto area = areas.find(name);
+  return area != areas.end() && area->second.written ? &area->second.gaugeData : nullptr;
+}
+
+void SimulatedSdk::beginFrame() {
+  for (const auto& request : simObjectRequests) {
+    simObjectValues.clear();
+    for (const auto& name : simObjectDefinitions[request.definitionId]) {
+      auto variable = simVariables.find(name);
+      simObjectValues.push_back(variable != simVariables.end() ? variable->second : 0.0);
+    }
+    queue(SIMCONNECT_RECV_ID_SIMOBJECT_DATA, request.requestId, request.definitionId, simObjectValues.data(),
+          simObjectValues.size() * sizeof(double));
+  }
+}
+
+const std::vector<uint8_t>* SimulatedSdk::drawnImage(FsContext context, int& width, int& height) const {
+  for (const auto* nvgContext : contexts) {
+    if (nvgContext->userPtr != context) {
+      continue;
+    }
+
+    auto image = images.find(nvgContext->drawnImage);
+    if (image == images.end()) {
+      return nullptr;
+    }
+    width = image->second.width;
+    height = image->second.height;
+    return &image->second.pixels;
+  }
+  return nullptr;
+}
+
+void SimulatedSdk::queue(SIMCONNECT_RECV_ID id, DWORD requestId, DWORD definitionId, const void* data, size_t size) {
+  if (queuedMessages == messages.size()) {
+    messages.emplace_back();
+  }
+
+  // the payload starts at dwData like in the messages of the simulator
+  const size_t headerSize = sizeof(SIMCONNECT_RECV_SIMOBJECT_DATA) - sizeof(DWORD);
+  auto& message = messages[queuedMessages++];
+  message.resize(headerSize + (size > sizeof(DWORD) ? size : sizeof(DWORD)));
+
+  SIMCONNECT_RECV_SIMOBJECT_DATA header{};
+  header.dwSize = static_cast<DWORD>(message.size());
+  header.dwID = id;
+  header.dwRequestID = requestId;
+  header.dwDefineID = definitionId;
+  header.dwentrynumber = 1;
+  header.dwoutof = 1;
+  std::memcpy(message.data(), &header, headerSize);
+  std::memcpy(message.data() + headerSize, data, size);
+}
+
+HRESULT SimulatedSdk::open(HANDLE* handle) {
+  connected = true;
+  *handle = &connection;
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::close(HANDLE) {
+  connected = false;
+  queuedMessages = 0;
+  nextMessage = 0;
+  clientDataNames.clear();
+  clientDataDefinitions.clear();
+  clientDataRequests.clear();
+  simObjectDefinitions.clear();
+  simObjectRequests.clear();
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::nextDispatch(SIMCONNECT_RECV** data, DWORD* size) {
+  if (!connected || nextMessage == queuedMessages) {
+    // the buffers are written again from the start in the next frame
+    queuedMessages = 0;
+    nextMessage = 0;
+    return E_FAIL;
+  }
+
+  auto& message = messages[nextMessage++];
+  clientDataStats.dispatchedMessages++;
+  clientDataStats.dispatchedBytes += message.size();
+  *data = reinterpret_cast<SIMCONNECT_RECV*>(message.data());
+  *size = static_cast<DWORD>(message.size());
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::addToDataDefinition(DWORD definitionId, const char* name) {
+  simObjectDefinitions[definitionId].push_back(name);
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::requestDataOnSimObject(DWORD requestId, DWORD definitionId, SIMCONNECT_PERIOD period) {
+  if (period != SIMCONNECT_PERIOD_VISUAL_FRAME) {
+    return E_FAIL;
+  }
+  simObjectRequests.push_back({requestId, definitionId});
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::mapClientDataNameToId(const char* name, DWORD clientDataId) {
+  clientDataNames[clientDataId] = name;
+  areas[name];
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::createClientData(DWORD clientDataId, DWORD size) {
+  auto name = clientDataNames.find(clientDataId);
+  if (name == clientDataNames.end()) {
+    return E_FAIL;
+  }
+  areas[name->second].gaugeData.resize(size);
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::addToClientDataDefinition(DWORD definitionId, DWORD size) {
+  clientDataDefinitions[definitionId] = size;
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::requestClientData(DWORD clientDataId, DWORD requestId, DWORD definitionId, SIMCONNECT_CLIENT_DATA_PERIOD period) {
+  auto name = clientDataNames.find(clientDataId);
+  auto definition = clientDataDefinitions.find(definitionId);
+  if (name == clientDataNames.end() || definition == clientDataDefinitions.end() || period != SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET) {
+    return E_FAIL;
+  }
+  clientDataRequests.push_back({name->second, requestId, definition->second});
+  return S_OK;
+}
+
+HRESULT SimulatedSdk::setGaugeClientData(DWORD clientDataId, DWORD size, const void* data) {
+  auto name = clientDataNames.find(clientDataId);
+  if (name == clientDataNames.end()) {
+    return E_FAIL;
+  }
+
+  auto& area = areas[name->second];
+  area.gaugeData.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+  area.written = true;
+  clientDataStats.gaugeWrites++;
+  return S_OK;
+}
+
+ID SimulatedSdk::registerNamedVariable(const char* name) {
+  auto id = variableIds.find(name);
+  if (id != variableIds.end()) {
+    return id->second;
+  }
+
+  variables.push_back(0.0);
+  return variableIds[name] = static_cast<ID>(variables.size() - 1);
+}
+
+double SimulatedSdk::namedVariable(ID id) const {
+  return id >= 0 && static_cast<size_t>(id) < variables.size() ? variables[id] : 0.0;
+}
+
+void SimulatedSdk::setNamedVariable(ID id, double value) {
+  if (id >= 0 && static_cast<size_t>(id) < variables.size()) {
+    variables[id] = value;
+  }
+}
+
+NVGcontext* SimulatedSdk::createContext(void* userPtr) {
+  NVGcontext* context = new NVGcontext{userPtr, 0, {}};
+  context->params.userPtr = context;
+  context->params.renderUpdateTexture = renderUpdateTexture;
+  contexts.push_back(context);
+  return context;
+}
+
+void SimulatedSdk::deleteContext(NVGcontext* context) {
+  for (auto it = contexts.begin(); it != contexts.end(); ++it) {
+    if (*it == context) {
+      delete context;
+      contexts.erase(it);
+      return;
+    }
+  }
+}
+
+void SimulatedSdk::beginDrawing(NVGcontext* context) {
+  context->drawnImage = 0;
+}
+
+void SimulatedSdk::drawImage(NVGcontext* context, int image) {
+  context->drawnImage = image;
+}
+
+int SimulatedSdk::createImage(NVGcontext* context, int width, int height, const unsigned char* rgba) {
+  // the texture is the memory of the renderer, not of the gauge
+  AllocationCounter::Pause pause;
+  auto& image = images[++lastImage];
+  image.context = context;
+  image.width = width;
+  image.height = height;
+  image.pixels.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+  imageStats.createdImages++;
+  imageStats.uploadedBytes += image.pixels.size();
+  return lastImage;
+}
+
+int SimulatedSdk::createImageFromMemory(NVGcontext* context, const unsigned char* data, int size) {
+  AllocationCounter::Pause pause;
+  compressedImage.assign(data, data + size);
+
+  // the image loader of nanovg allocates the decoded pixels for every image
+  std::vector<uint8_t> rgba;
+  uint16_t width = 0;
+  uint16_t height = 0;
+  if (!decodePng(compressedImage, rgba, width, height)) {
+    imageStats.failedImages++;
+    return 0;
+  }
+  imageStats.decodedImages++;
+  return createImage(context, width, height, rgba.data());
+}
+
+void SimulatedSdk::updateImage(NVGcontext* context, int image, const unsigned char* rgba) {
+  auto entry = images.find(image);
+  if (entry == images.end() || entry->second.context != context) {
+    return;
+  }
+
+  // nanovg updates the whole image through the renderer
+  updateImageRegion(context, image, 0, 0, entry->second.width, entry->second.height, rgba);
+}
+
+void SimulatedSdk::updateImageRegion(NVGcontext* context, int image, int x, int y, int width, int height, const unsigned char* rgba) {
+  auto entry = images.find(image);
+  if (entry == images.end() || entry->second.context != context || x < 0 || y < 0 || width <= 0 || height <= 0 ||
+      x + width > entry->second.width || y + height > entry->second.height) {
+    return;
+  }
+
+  // the data is the whole image, only the region is copied into the texture
+  const size_t stride = static_cast<size_t>(entry->second.width) * 4;
+  for (int row = y; row < y + height; ++row) {
+    const size_t offset = row * stride + static_cast<size_t>(x) * 4;
+    std::memcpy(entry->second.pixels.data() + offset, rgba + offset, static_cast<size_t>(width) * 4);
+  }
+  imageStats.updatedImages++;
+  imageStats.uploadedBytes += static_cast<uint64_t>(width) * height * 4;
+}
+
+void SimulatedSdk::imageSize(NVGcontext* context, int image, int* width, int* height) const {
+  auto entry = images.find(image);
+  if (entry == images.end() || entry->second.context != context) {
+    *width = 0;
+    *height = 0;
+    return;
+  }
+  *width = entry->second.width;
+  *height = entry->second.height;
+}
+
+void SimulatedSdk::deleteImage(NVGcontext* context, int image) {
+  auto entry = images.find(image);
+  if (entry != images.end() && entry->second.context == context) {
+    images.erase(entry);
+    imageStats.deletedImages++;
+  }
+}
+
+// the entry points of the stand-in headers
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char*, void*, DWORD, HANDLE, DWORD) {
+  return SimulatedSdk::instance().open(phSimConnect);
+}
+
+HRESULT SimConnect_Close(HANDLE hSimConnect) {
+  return SimulatedSdk::instance().close(hSimConnect);
+}
+
+HRESULT SimConnect_GetNextDispatch(HANDLE, SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  return SimulatedSdk::instance().nextDispatch(ppData, pcbData);
+}
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE, DWORD DefineID, const char* DatumName, const char*, SIMCONNECT_DATATYPE, float, DWORD) {
+  return SimulatedSdk::instance().addToDataDefinition(DefineID, DatumName);
+}
+
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE, DWORD RequestID, DWORD DefineID, DWORD, SIMCONNECT_PERIOD Period, DWORD, DWORD, DWORD,
+                                          DWORD) {
+  return SimulatedSdk::instance().requestDataOnSimObject(RequestID, DefineID, Period);
+}
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char* szClientDataName, DWORD ClientDataID) {
+  return SimulatedSdk::instance().mapClientDataNameToId(szClientDataName, ClientDataID);
+}
+
+HRESULT SimConnect_CreateClientData(HANDLE, DWORD ClientDataID, DWORD dwSize, SIMCONNECT_CREATE_CLIENT_DATA_FLAG) {
+  return SimulatedSdk::instance().createClientData(ClientDataID, dwSize);
+}
+
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, DWORD DefineID, DWORD, DWORD dwSizeOrType, float, DWORD) {
+  return SimulatedSdk::instance().addToClientDataDefinition(DefineID, dwSizeOrType);
+}
+
+HRESULT SimConnect_RequestClientData(HANDLE, DWORD ClientDataID, DWORD RequestID, DWORD DefineID, SIMCONNECT_CLIENT_DATA_PERIOD Period,
+                                     SIMCONNECT_CLIENT_DATA_REQUEST_FLAG, DWORD, DWORD, DWORD) {
+  return SimulatedSdk::instance().requestClientData(ClientDataID, RequestID, DefineID, Period);
+}
+
+HRESULT SimConnect_SetClientData(HANDLE,
+                                 DWORD ClientDataID,
+                                 DWORD,
+                                 SIMCONNECT_CLIENT_DATA_SET_FLAG,
+                                 DWORD,
+                                 DWORD cbUnitSize,
+                                 void* pDataSet) {
+  return SimulatedSdk::instance().setGaugeClientData(ClientDataID, cbUnitSize, pDataSet);
+}
+
+ID register_named_variable(const char* name) {
+  return SimulatedSdk::instance().registerNamedVariable(name);
+}
+
+double get_named_variable_value(ID id) {
+  return SimulatedSdk::instance().namedVariable(id);
+}
+
+void set_named_variable_value(ID id, double value) {
+  SimulatedSdk::instance().setNamedVariable(id, value);
+}
+
+NVGcontext* nvgCreateInternal(NVGparams* params) {
+  return SimulatedSdk::instance().createContext(params->userPtr);
+}
+
+NVGparams* nvgInternalParams(NVGcontext* ctx) {
+  return &ctx->params;
+}
+
+void nvgDeleteInternal(NVGcontext* ctx) {
+  SimulatedSdk::instance().deleteContext(ctx);
+}
+
+void nvgBeginFrame(NVGcontext* ctx, float, float, float) {
+  SimulatedSdk::instance().beginDrawing(ctx);
+}
+
+void nvgEndFrame(NVGcontext*) {}
+
+NVGcolor nvgRGBA(unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+  return {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+}
+
+void nvgFillColor(NVGcontext*, NVGcolor) {}
+
+void nvgFillPaint(NVGcontext* ctx, NVGpaint paint) {
+  SimulatedSdk::instance().drawImage(ctx, paint.image);
+}
+
+NVGpaint nvgImagePattern(NVGcontext*, float ox, float oy, float ex, float ey, float, int image, float alpha) {
+  NVGpaint paint{};
+  paint.xform[0] = 1.0f;
+  paint.xform[3] = 1.0f;
+  paint.xform[4] = ox;
+  paint.xform[5] = oy;
+  paint.extent[0] = ex;
+  paint.extent[1] = ey;
+  paint.innerColor = paint.outerColor = {1.0f, 1.0f, 1.0f, alpha};
+  paint.image = image;
+  return paint;
+}
+
+void nvgBeginPath(NVGcontext*) {}
+
+void nvgRect(NVGcontext*, float, float, float, float) {}
+
+void nvgFill(NVGcontext*) {}
+
+int nvgCreateImageMem(NVGcontext* ctx, int, unsigned char* data, int ndata) {
+  return SimulatedSdk::instance().createImageFromMemory(ctx, data, ndata);
+}
+
+int nvgCreateImageRGBA(NVGcontext* ctx, int w, int h, int, const unsigned char* data) {
+  return SimulatedSdk::instance().createImage(ctx, w, h, data);
+}
+
+void nvgUpdateImage(NVGcontext* ctx, int image, const unsigned char* data) {
+  SimulatedSdk::instance().updateImage(ctx, image, data);
+}
+
+void nvgImageSize(NVGcontext* ctx, int image, int* w, int* h) {
+  SimulatedSdk::instance().imageSize(ctx, image, w, h);
+}
+
+void nvgDeleteImage(NVGcontext* ctx, int image) {
+  SimulatedSdk::instance().deleteImage(ctx, image);
+}
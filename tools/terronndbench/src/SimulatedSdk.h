@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <MSFS/Legacy/gauges.h>
+#include <MSFS/Render/nanovg.h>
+
+/// <summary>
+/// The simulator behind the stand-in headers of the MSFS SDK: SimConnect client data and simulation variables of the
+/// user aircraft, the named variables and a nanovg that keeps the pixels of its images
+/// </summary>
+/// <remarks>
+/// The gauge connects with SimConnect_Open, the SimBridge side writes its client data areas through setClientData. Both
+/// sides run in the same thread: the messages are queued and dispatched in the next readData of the gauge like the
+/// simulator does it. The queue, the areas and the images keep their memory, so the simulated SDK does not allocate in
+/// the calls of the gauge once a flight runs.
+/// </remarks>
+class SimulatedSdk {
+ public:
+  struct ImageStatistics {
+    uint64_t createdImages = 0;
+    uint64_t deletedImages = 0;
+    uint64_t updatedImages = 0;
+    uint64_t uploadedBytes = 0;
+    uint64_t decodedImages = 0;
+    uint64_t failedImages = 0;
+  };
+
+  struct ClientDataStatistics {
+    uint64_t dispatchedMessages = 0;
+    uint64_t dispatchedBytes = 0;
+    uint64_t gaugeWrites = 0;
+  };
+
+  /// the simulator that the functions of the SDK use
+  static SimulatedSdk& instance();
+
+  /// sets a named variable, the name contains the prefix of the aircraft
+  void setVariable(const std::string& name, double value);
+  double variable(const std::string& name) const;
+
+  /// sets a simulation variable of the user aircraft, the requests send it in the unit of their definition
+  void setSimVariable(const std::string& name, double value);
+
+  /// <summary>
+  /// Writes a client data area from the SimBridge side
+  /// </summary>
+  /// <remarks>The requests of the gauge with the period ON_SET receive the data in the next dispatch.</remarks>
+  void setClientData(const std::string& name, const void* data, size_t size);
+
+  /// the last data that the gauge wrote into the client data area, nullptr if it never wrote it
+  const std::vector<uint8_t>* clientData(const std::string& name) const;
+
+  /// queues the simulation variables of the requests with the period VISUAL_FRAME, it is called before the gauges draw
+  void beginFrame();
+
+  /// <summary>
+  /// Returns the pixels of the image that the context drew in its last frame
+  /// </summary>
+  /// <returns>nullptr if the context drew no image</returns>
+  const std::vector<uint8_t>* drawnImage(FsContext context, int& width, int& height) const;
+
+  /// the number of images of all contexts
+  size_t imageCount() const { return images.size(); }
+
+  const ImageStatistics& imageStatistics() const { return imageStats; }
+  const ClientDataStatistics& clientDataStatistics() const { return clientDataStats; }
+
+  // the implementation of the SDK functions
+
+  HRESULT open(HANDLE* handle);
+  HRESULT close(HANDLE handle);
+  HRESULT nextDispatch(SIMCONNECT_RECV** data, DWORD* size);
+  HRESULT addToDataDefinition(DWORD definitionId, const char* name);
+  HRESULT requestDataOnSimObject(DWORD requestId, DWORD definitionId, SIMCONNECT_PERIOD period);
+  HRESULT mapClientDataNameToId(const char* name, DWORD clientDataId);
+  HRESULT createClientData(DWORD clientDataId, DWORD size);
+  HRESULT addToClientDataDefinition(DWORD definitionId, DWORD size);
+  HRESULT requestClientData(DWORD clientDataId, DWORD requestId, DWORD definitionId, SIMCONNECT_CLIENT_DATA_PERIOD period);
+  HRESULT setGaugeClientData(DWORD clientDataId, DWORD size, const void* data);
+
+  ID registerNamedVariable(const char* name);
+  double namedVariable(ID id) const;
+  void setNamedVariable(ID id, double value);
+
+  NVGcontext* createContext(void* userPtr);
+  void deleteContext(NVGcontext* context);
+  void beginDrawing(NVGcontext* context);
+  void drawImage(NVGcontext* context, int image);
+  int createImage(NVGcontext* context, int width, int height, const unsigned char* rgba);
+  int createImageFromMemory(NVGcontext* context, const unsigned char* data, int size);
+  void updateImage(NVGcontext* context, int image, const unsigned char* rgba);
+  void updateImageRegion(NVGcontext* context, int image, int x, int y, int width, int height, const unsigned char* rgba);
+  void imageSize(NVGcontext* context, int image, int* width, int* height) const;
+  void deleteImage(NVGcontext* context, int image);
+
+ private:
+  struct ClientDataArea {
+    std::vector<uint8_t> gaugeData;
+    bool written = false;
+  };
+
+  struct ClientDataRequest {
+    std::string area;
+    DWORD requestId;
+    DWORD size;
+  };
+
+  struct SimObjectRequest {
+    DWORD requestId;
+    DWORD definitionId;
+  };
+
+  struct Image {
+    NVGcontext* context;
+    int width;
+    int height;
+    std::vector<uint8_t> pixels;
+  };
+
+  // the gauge connection, there is only one
+  int connection = 0;
+  bool connected = false;
+
+  // the messages of the next dispatch, the buffers are reused
+  std::vector<std::vector<uint8_t>> messages;
+  size_t queuedMessages = 0;
+  size_t nextMessage = 0;
+
+  std::map<std::string, ClientDataArea> areas;
+  std::map<DWORD, std::string> clientDataNames;
+  std::map<DWORD, DWORD> clientDataDefinitions;
+  std::vector<ClientDataRequest> clientDataRequests;
+  std::map<DWORD, std::vector<std::string>> simObjectDefinitions;
+  std::vector<SimObjectRequest> simObjectRequests;
+  std::map<std::string, double> simVariables;
+  std::vector<double> simObjectValues;
+
+  std::map<std::string, ID> variableIds;
+  std::vector<double> variables;
+
+  std::map<int, Image> images;
+  std::vector<NVGcontext*> contexts;
+  int lastImage = 0;
+  std::vector<uint8_t> compressedImage;
+
+  ImageStatistics imageStats;
+  ClientDataStatistics clientDataStats;
+
+  SimulatedSdk() = default;
+
+  /// queues a message with the header and the payload at its dwData
+  void queue(SIMCONNECT_RECV_ID id, DWORD requestId, DWORD definitionId, const void* data, size_t size);
+};
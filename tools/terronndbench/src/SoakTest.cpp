@@ -0,0 +1,279 @@
+#include "SoakTest.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "AllocationCounter.h"
+#include "SimulatedSdk.h"
+#include "fmt/include/fmt/format.h"
+#include "navigationdisplay/collection.h"
+#include "types/arinc429.hpp"
+
+namespace {
+
+const double FRAME_RATE = 30.0;
+const double REPORT_INTERVAL_S = 600.0;
+// the live memory may grow by one-time allocations in the second half, a leak of a byte per frame exceeds it within an hour
+const int64_t MEMORY_GROWTH_TOLERANCE = 64 * 1024;
+const double GROUND_SPEED_KN = 450.0;
+const double TRACK_DEG = 55.0;
+// the captain selects the next range every five minutes and changes the mode after every cycle
+const double RANGE_INTERVAL_S = 300.0;
+const uint16_t RANGES[] = {10, 20, 40, 80, 160, 320};
+const uint16_t FIRST_OFFICER_RANGE = 40;
+
+/// <summary>
+/// Times of a measured section in us, the percentiles come from buckets of an eighth octave
+/// </summary>
+struct TimeStatistics {
+  static const size_t BUCKETS = 160;
+
+  uint64_t count = 0;
+  double total = 0;
+  double max = 0;
+  std::array<uint64_t, BUCKETS> histogram{};
+
+  void add(double time_us) {
+    count++;
+    total += time_us;
+    max = std::max(max, time_us);
+    const double bucket = time_us > 1.0 ? std::log2(time_us) * 8.0 : 0.0;
+    histogram[std::min(static_cast<size_t>(bucket), BUCKETS - 1)]++;
+  }
+
+  double mean() const { return count != 0 ? total / count : 0.0; }
+
+  /// the upper edge of the bucket of the percentile, at most the maximum
+  double percentile(double fraction) const {
+    uint64_t remaining = static_cast<uint64_t>(std::ceil(fraction * count));
+    for (size_t bucket = 0; bucket < BUCKETS; bucket++) {
+      if (histogram[bucket] >= remaining) {
+        return std::min(std::exp2((bucket + 1) / 8.0), max);
+      }
+      remaining -= histogram[bucket];
+    }
+    return max;
+  }
+};
+
+/// the named variable of the aircraft for a variable of terronnd
+std::string lvar(std::string_view name) {
+  return "A32NX_" + std::string(name);
+}
+
+/// encodes the value as ARINC 429 word with normal operation like the aircraft systems write it
+double arinc429(float value) {
+  uint32_t data = 0;
+  std::memcpy(&data, &value, sizeof(data));
+  return static_cast<double>((static_cast<uint64_t>(types::Arinc429SignStatus::NormalOperation) << 32) | data);
+}
+
+/// <summary>
+/// Writes the variables of the aircraft and the ND settings at the time of the flight
+/// </summary>
+void fly(SimulatedSdk& sdk, double time_s, double altitude_ft) {
+  using namespace navigationdisplay;
+
+  const double distance_nmi = GROUND_SPEED_KN * time_s / 3600.0;
+  const double latitude = 44.5 + distance_nmi * std::cos(TRACK_DEG * M_PI / 180.0) / 60.0;
+  const double longitude = 6.5 + distance_nmi * std::sin(TRACK_DEG * M_PI / 180.0) / 60.0 / std::cos(latitude * M_PI / 180.0);
+  // the aircraft weaves around its track, so the heading changes as well
+  const double heading = TRACK_DEG + 5.0 * std::sin(2.0 * M_PI * time_s / 300.0);
+
+  sdk.setVariable(lvar(EgpwcPresentLat), arinc429(static_cast<float>(latitude)));
+  sdk.setVariable(lvar(EgpwcPresentLong), arinc429(static_cast<float>(longitude)));
+  sdk.setVariable(lvar(EgpwcAltitude), arinc429(static_cast<float>(altitude_ft)));
+  sdk.setVariable(lvar(EgpwcHeading), arinc429(static_cast<float>(heading)));
+  sdk.setVariable(lvar(EgpwcVerticalSpeed), arinc429(0.0f));
+  sdk.setVariable(lvar(EgpwcDestinationLat), arinc429(60.0f));
+  sdk.setVariable(lvar(EgpwcDestinationLong), arinc429(25.0f));
+  sdk.setVariable(lvar(EgpwcGearIsDown), 0.0);
+  sdk.setVariable(lvar(EgpwcTerrOnNdRenderingMode), 0.0);
+  sdk.setSimVariable("PLANE LATITUDE", latitude);
+  sdk.setSimVariable("PLANE LONGITUDE", longitude);
+
+  const auto step = static_cast<size_t>(time_s / RANGE_INTERVAL_S);
+  const size_t rangeCount = sizeof(RANGES) / sizeof(RANGES[0]);
+  sdk.setVariable(lvar(EgpwcNdLeftRange), RANGES[step % rangeCount]);
+  sdk.setVariable(lvar(EfisNdLeftMode), (step / rangeCount) % 2 == 0 ? NavigationDisplayArcModeId : NavigationDisplayRoseNavModeId);
+  sdk.setVariable(lvar(EgpwcTerrOnNdLeftActive), 1.0);
+  sdk.setVariable(lvar(EgpwcNdRightRange), FIRST_OFFICER_RANGE);
+  sdk.setVariable(lvar(EfisNdRightMode), NavigationDisplayArcModeId);
+  sdk.setVariable(lvar(EgpwcTerrOnNdRightActive), 1.0);
+  sdk.setVariable(lvar(AcEssBus), 1.0);
+  sdk.setVariable(lvar(Ac2Bus), 1.0);
+  sdk.setSimVariable(LightPotentiometerLeftName, 1.0);
+  sdk.setSimVariable(LightPotentiometerRightName, 1.0);
+}
+
+const char* formatName(types::FrameFormat format) {
+  switch (format) {
+    case types::FrameFormat::TILE_DELTA:
+      return "tile delta";
+    case types::FrameFormat::COMPRESSED_IMAGE:
+      return "compressed image";
+    default:
+      return "palette RLE";
+  }
+}
+
+}  // namespace
+
+bool soakTest(const SimBridgeProducer::Settings& settings, double flightTime_s, double altitude_ft) {
+  SimulatedSdk& sdk = SimulatedSdk::instance();
+  SimBridgeProducer producer(settings);
+
+  // the gauge contexts only identify the displays
+  int leftGauge = 0;
+  int rightGauge = 0;
+  const FsContext gauges[] = {&leftGauge, &rightGauge};
+
+  // protocol version 0 only knows compressed images
+  const types::FrameFormat format = settings.protocolVersion != 0 ? settings.format : types::FrameFormat::COMPRESSED_IMAGE;
+  fmt::print("soak: {:.1f} h flight with {} frames of {}x{} pixels every {} s, {} chunks per display and frame, protocol {}\n",
+             flightTime_s / 3600.0, formatName(format), settings.width, settings.height, settings.frameInterval_s, settings.chunksPerFrame,
+             settings.protocolVersion);
+
+  simconnect::Connection connection;
+  if (!connection.connect("FBW_TERRONND_CONNECTION")) {
+    fmt::print("  unable to connect to the simulated SDK\n");
+    return false;
+  }
+  auto displays = std::make_shared<navigationdisplay::Collection>(connection);
+  displays->registerDisplay(navigationdisplay::DisplaySide::Left, gauges[0], connection);
+  displays->registerDisplay(navigationdisplay::DisplaySide::Right, gauges[1], connection);
+
+  sGaugeDrawData drawData{};
+  drawData.dt = 1.0 / FRAME_RATE;
+  drawData.winWidth = drawData.fbWidth = settings.width;
+  drawData.winHeight = drawData.fbHeight = settings.height;
+  // the steady clock of the host starts at an arbitrary point as well
+  const auto start = std::chrono::steady_clock::time_point(std::chrono::hours(1));
+
+  TimeStatistics receive;
+  TimeStatistics upload;
+  TimeStatistics draw;
+  TimeStatistics intervalReceive;
+  TimeStatistics intervalUpload;
+  uint64_t checkedFrames = 0;
+  uint64_t mismatches = 0;
+  uint64_t intervalAllocations = AllocationCounter::statistics().allocations;
+  uint64_t intervalFrames = 0;
+  uint64_t firstHalfPeakBytes = 0;
+  uint64_t secondHalfPeakBytes = 0;
+
+  const auto frameCount = static_cast<uint64_t>(flightTime_s * FRAME_RATE);
+  const auto reportFrames = static_cast<uint64_t>(REPORT_INTERVAL_S * FRAME_RATE);
+  for (uint64_t frame = 0; frame < frameCount; frame++) {
+    const double time_s = frame / FRAME_RATE;
+    fly(sdk, time_s, altitude_ft);
+    sdk.beginFrame();
+    const auto& sentFrames = producer.update(time_s);
+
+    const auto now = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(time_s));
+    drawData.t = time_s;
+    for (const auto gauge : gauges) {
+      // the gauge callback of PANEL_SERVICE_PRE_DRAW, the first gauge of the frame dispatches the messages
+      const uint64_t messages = sdk.clientDataStatistics().dispatchedMessages;
+      const uint64_t uploads = sdk.imageStatistics().updatedImages + sdk.imageStatistics().createdImages;
+      double receiveTime = 0;
+      double renderTime = 0;
+      {
+        AllocationCounter::Section section;
+        auto t0 = std::chrono::steady_clock::now();
+        connection.readData(gauge, now);
+        auto t1 = std::chrono::steady_clock::now();
+        displays->updateDisplay(gauge, connection.frameTime());
+        auto t2 = std::chrono::steady_clock::now();
+        displays->renderDisplay(&drawData, gauge);
+        auto t3 = std::chrono::steady_clock::now();
+        receiveTime = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        renderTime = std::chrono::duration<double, std::micro>(t3 - t2).count();
+      }
+
+      if (sdk.clientDataStatistics().dispatchedMessages != messages) {
+        receive.add(receiveTime);
+        intervalReceive.add(receiveTime);
+      }
+      if (sdk.imageStatistics().updatedImages + sdk.imageStatistics().createdImages != uploads) {
+        upload.add(renderTime);
+        intervalUpload.add(renderTime);
+      } else {
+        draw.add(renderTime);
+      }
+    }
+    intervalFrames++;
+
+    // a complete frame is drawn in the frame of its last chunk
+    for (const auto& sent : sentFrames) {
+      int width = 0;
+      int height = 0;
+      const auto* pixels = sdk.drawnImage(gauges[sent.left ? 0 : 1], width, height);
+      checkedFrames++;
+      if (pixels == nullptr || width != settings.width || height != settings.height || *pixels != *sent.rgba) {
+        if (mismatches++ < 10) {
+          fmt::print("  {:.2f} s: the {} display does not draw frame {}\n", time_s, sent.left ? "left" : "right", sent.frameId);
+        }
+      }
+    }
+
+    const uint64_t liveBytes = AllocationCounter::statistics().liveBytes();
+    if (time_s < flightTime_s / 2) {
+      firstHalfPeakBytes = std::max(firstHalfPeakBytes, liveBytes);
+    } else {
+      secondHalfPeakBytes = std::max(secondHalfPeakBytes, liveBytes);
+    }
+
+    if ((frame + 1) % reportFrames == 0 || frame + 1 == frameCount) {
+      const uint64_t allocations = AllocationCounter::statistics().allocations;
+      fmt::print(
+          "  {:6.0f} s  receive {:7.1f} us mean {:7.1f} us p99.9 {:7.1f} us max  upload {:7.1f} us mean {:7.1f} us max  "
+          "{:5.2f} allocations per frame  {:6} KiB live  {:6} KiB resident\n",
+          time_s + 1.0 / FRAME_RATE, intervalReceive.mean(), intervalReceive.percentile(0.999), intervalReceive.max, intervalUpload.mean(),
+          intervalUpload.max, static_cast<double>(allocations - intervalAllocations) / intervalFrames, liveBytes / 1024,
+          AllocationCounter::residentBytes() / 1024);
+      intervalReceive = TimeStatistics();
+      intervalUpload = TimeStatistics();
+      intervalAllocations = allocations;
+      intervalFrames = 0;
+    }
+  }
+
+  const auto& producerStatistics = producer.statistics();
+  const auto& imageStatistics = sdk.imageStatistics();
+  const auto& cacheStatistics = displays->frameCacheStatistics();
+  const auto& statusStatistics = displays->aircraftStatusStatistics();
+  const auto allocationStatistics = AllocationCounter::statistics();
+  fmt::print("  producer: {} frames, {} shared, {} aborted, {:.1f} chunks per frame, render and encode {:.1f} ms per frame\n",
+             producerStatistics.frames, producerStatistics.sharedFrames, producerStatistics.abortedFrames,
+             static_cast<double>(producerStatistics.chunks) / std::max<uint64_t>(producerStatistics.frames, 1),
+             producerStatistics.renderTime / 1000.0 / std::max<uint64_t>(producerStatistics.frames, 1));
+  fmt::print("  receive {:7.1f} us mean {:7.1f} us p99.9 {:7.1f} us max in {} frames with data\n", receive.mean(),
+             receive.percentile(0.999), receive.max, receive.count);
+  fmt::print("  upload  {:7.1f} us mean {:7.1f} us p99.9 {:7.1f} us max in {} draws, the other draws {:.1f} us mean\n", upload.mean(),
+             upload.percentile(0.999), upload.max, upload.count, draw.mean());
+  fmt::print("  displays: {} of {} complete frames drawn, {} images created, {} updated, {} decoded, {} MiB uploaded, {} images left\n",
+             checkedFrames - mismatches, checkedFrames, imageStatistics.createdImages, imageStatistics.updatedImages,
+             imageStatistics.decodedImages, imageStatistics.uploadedBytes / 1024 / 1024, sdk.imageCount());
+  fmt::print("  connection: {} of {} frames read\n", connection.frameCount(), frameCount);
+  fmt::print("  frame cache: {} decoded, {} shared, {} copied frames, {} failures\n", cacheStatistics.decodedFrames,
+             cacheStatistics.sharedFrames, cacheStatistics.copiedFrames, cacheStatistics.failures);
+  fmt::print("  aircraft status: {} updates, {} configuration and {} motion transmissions ({:.1f} per minute), {} skipped, {} deferred\n",
+             statusStatistics.updates, statusStatistics.configurationTransmissions, statusStatistics.motionTransmissions,
+             (statusStatistics.configurationTransmissions + statusStatistics.motionTransmissions) * 60.0 / flightTime_s,
+             statusStatistics.skippedUpdates, statusStatistics.deferredUpdates);
+  fmt::print("  memory: {} allocations, {} KiB live peak in the first half, {} bytes more in the second half\n",
+             allocationStatistics.allocations, firstHalfPeakBytes / 1024,
+             static_cast<int64_t>(secondHalfPeakBytes) - static_cast<int64_t>(firstHalfPeakBytes));
+
+  const bool framesRead = connection.frameCount() == frameCount;
+  displays->destroy();
+  connection.disconnect();
+  return framesRead && mismatches == 0 && checkedFrames != 0 && cacheStatistics.failures == 0 && imageStatistics.failedImages == 0 &&
+         static_cast<int64_t>(secondHalfPeakBytes - firstHalfPeakBytes) <= MEMORY_GROWTH_TOLERANCE;
+}
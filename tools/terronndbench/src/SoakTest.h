@@ -0,0 +1,15 @@
+#pragma once
+
+#include "SimBridgeProducer.h"
+
+/// <summary>
+/// Flies with the collection of terronnd and both displays against the SimBridge stand-in through the simulated SDK
+/// </summary>
+/// <remarks>
+/// The gauges draw 30 frames per second in simulated time, so hours of flight run in minutes. The aircraft cruises
+/// with 450 kn while the captain steps through the ranges and modes of the ND and the first officer stays in ARC 40 nm.
+/// Every frame that is sent completely has to be drawn with its pixels in the same frame. The receive, upload and
+/// allocation statistics are printed every ten minutes of the flight.
+/// </remarks>
+/// <returns>false if a display drew another picture, a frame failed or the live memory grew by 64 KiB in the second half</returns>
+bool soakTest(const SimBridgeProducer::Settings& settings, double flightTime_s, double altitude_ft);
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+
+#include "ElevationTileCache.h"
+#include "SyntheticElevation.h"
+
+namespace {
+
+// the mountain region, everything else is sea
+const double REGION_SOUTH = 44.0;
+const double REGION_NORTH = 50.0;
+const double REGION_WEST = 6.0;
+const double REGION_EAST = 14.0;
+const double COAST_WIDTH_DEG = 0.5;
+
+// the radius of the landmark peak, roughly 3 nm
+const double LANDMARK_SIGMA_DEG = 0.05;
+
+// the span of the tiles of level 0, every level doubles it
+const double FINEST_TILE_SPAN_DEG = 1.0;
+
+std::vector<uint8_t> deflateBytes(const std::vector<uint8_t>& data) {
+  z_stream stream{};
+  deflateInit(&stream, Z_BEST_COMPRESSION);
+  std::vector<uint8_t> compressed(deflateBound(&stream, static_cast<uLong>(data.size())));
+  stream.next_in = const_cast<Bytef*>(data.data());
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = compressed.data();
+  stream.avail_out = static_cast<uInt>(compressed.size());
+  deflate(&stream, Z_FINISH);
+  compressed.resize(stream.total_out);
+  deflateEnd(&stream);
+  return compressed;
+}
+
+double smoothstep(double value) {
+  value = std::clamp(value, 0.0, 1.0);
+  return value * value * (3.0 - 2.0 * value);
+}
+
+}  // namespace
+
+SyntheticElevation::SyntheticElevation(uint32_t seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> phase(0.0, 6.283185307179586);
+  for (double k : {3.0, 7.0, 17.0, 41.0}) {
+    waves.push_back({k * std::uniform_real_distribution<double>(0.7, 1.3)(generator),
+                     k * std::uniform_real_distribution<double>(0.7, 1.3)(generator), phase(generator), 6000.0 / std::sqrt(k)});
+  }
+}
+
+double SyntheticElevation::elevation_ft(double latitude, double longitude) const {
+  if (latitude <= REGION_SOUTH || latitude >= REGION_NORTH || longitude <= REGION_WEST || longitude >= REGION_EAST) {
+    return 0.0;
+  }
+
+  const double coast = smoothstep(std::min({latitude - REGION_SOUTH, REGION_NORTH - latitude, longitude - REGION_WEST,
+                                            REGION_EAST - longitude}) /
+                                  COAST_WIDTH_DEG);
+  double relief = 0.0;
+  double amplitude = 0.0;
+  for (const auto& wave : waves) {
+    relief += 0.5 * wave.amplitude_ft * std::sin(wave.kLatitude * latitude + wave.phase) * std::cos(wave.kLongitude * longitude);
+    amplitude += wave.amplitude_ft;
+  }
+  // the relief is scaled into [0, REGION_MAX_ELEVATION_FT]
+  const double regionElevation = std::clamp((relief / amplitude + 0.5) * REGION_MAX_ELEVATION_FT, 0.0, REGION_MAX_ELEVATION_FT);
+
+  const double dLatitude = latitude - LANDMARK_LATITUDE;
+  const double dLongitude = (longitude - LANDMARK_LONGITUDE) * std::cos(LANDMARK_LATITUDE * 3.141592653589793 / 180.0);
+  const double landmark = std::exp(-(dLatitude * dLatitude + dLongitude * dLongitude) / (2.0 * LANDMARK_SIGMA_DEG * LANDMARK_SIGMA_DEG));
+
+  return coast * std::max(regionElevation, LANDMARK_ELEVATION_FT * landmark);
+}
+
+uint64_t SyntheticElevation::write(const std::string& path, uint16_t tileSamples, uint8_t levelCount, bool compress) const {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return 0;
+  }
+
+  ElevationFileHeader header{};
+  std::copy(std::begin(ELEVATION_FILE_MAGIC), std::end(ELEVATION_FILE_MAGIC), header.magic);
+  header.version = ELEVATION_FILE_VERSION;
+  header.tileSamples = tileSamples;
+  header.levelCount = levelCount;
+  header.compression = compress ? ELEVATION_COMPRESSION_DEFLATE : ELEVATION_COMPRESSION_NONE;
+
+  std::vector<ElevationLevel> levels(levelCount);
+  uint64_t position = sizeof(header) + levelCount * sizeof(ElevationLevel);
+  file.seekp(static_cast<std::streamoff>(position));
+
+  std::vector<int16_t> samples(static_cast<size_t>(tileSamples) * tileSamples);
+  std::vector<uint8_t> stored;
+  for (uint8_t level = 0; level < levelCount; level++) {
+    const double span = FINEST_TILE_SPAN_DEG * static_cast<double>(1u << level);
+    auto& descriptor = levels[level];
+    descriptor.tileSpan = static_cast<float>(span);
+    descriptor.tilesLongitude = static_cast<uint32_t>(std::ceil(360.0 / span));
+    descriptor.tilesLatitude = static_cast<uint32_t>(std::ceil(180.0 / span));
+    descriptor.indexOffset = position;
+
+    std::vector<ElevationTileEntry> index(static_cast<size_t>(descriptor.tilesLongitude) * descriptor.tilesLatitude);
+    position += index.size() * sizeof(ElevationTileEntry);
+    file.seekp(static_cast<std::streamoff>(position));
+
+    for (uint32_t row = 0; row < descriptor.tilesLatitude; row++) {
+      for (uint32_t column = 0; column < descriptor.tilesLongitude; column++) {
+        const double south = row * span - 90.0;
+        const double west = column * span - 180.0;
+        auto& entry = index[static_cast<size_t>(row) * descriptor.tilesLongitude + column];
+        if (south + span <= REGION_SOUTH || south >= REGION_NORTH || west + span <= REGION_WEST || west >= REGION_EAST) {
+          entry = {0, 0, 0};
+          continue;
+        }
+
+        // the samples are taken in the center of their cells
+        const double spacing = span / tileSamples;
+        for (uint16_t sampleRow = 0; sampleRow < tileSamples; sampleRow++) {
+          for (uint16_t sampleColumn = 0; sampleColumn < tileSamples; sampleColumn++) {
+            samples[static_cast<size_t>(sampleRow) * tileSamples + sampleColumn] = static_cast<int16_t>(
+                std::lround(elevation_ft(south + (sampleRow + 0.5) * spacing, west + (sampleColumn + 0.5) * spacing)));
+          }
+        }
+        const auto* bytes = reinterpret_cast<const uint8_t*>(samples.data());
+        stored.assign(bytes, bytes + samples.size() * sizeof(int16_t));
+        if (compress) {
+          stored = deflateBytes(stored);
+        }
+        entry = {position, static_cast<uint32_t>(stored.size()), *std::max_element(samples.begin(), samples.end())};
+        file.write(reinterpret_cast<const char*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+        position += stored.size();
+      }
+    }
+
+    file.seekp(static_cast<std::streamoff>(descriptor.indexOffset));
+    file.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(index[0])));
+    file.seekp(static_cast<std::streamoff>(position));
+  }
+
+  file.seekp(0);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(levels.data()), static_cast<std::streamsize>(levels.size() * sizeof(levels[0])));
+  return file ? position : 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Synthetic elevation model of a mountain region in the sea, written as local elevation file of the terrain on ND
+/// </summary>
+/// <remarks>
+/// The region is covered by seeded waves that fade out to sea level at its borders. A single landmark peak towers
+/// above the rest of the region, so the renderer can be checked for the orientation of its picture.
+/// </remarks>
+class SyntheticElevation {
+ public:
+  // the landmark peak, no other terrain comes close to its elevation
+  static constexpr double LANDMARK_LATITUDE = 47.0;
+  static constexpr double LANDMARK_LONGITUDE = 10.0;
+  static constexpr double LANDMARK_ELEVATION_FT = 14000.0;
+  // the highest terrain of the region without the landmark
+  static constexpr double REGION_MAX_ELEVATION_FT = 8000.0;
+
+  explicit SyntheticElevation(uint32_t seed);
+
+  /// the elevation in ft, 0 in the sea
+  double elevation_ft(double latitude, double longitude) const;
+
+  /// <summary>
+  /// Writes the pyramid of the model to an elevation file
+  /// </summary>
+  /// <remarks>Tiles that do not touch the region are stored as uniform sea level tiles.</remarks>
+  /// <returns>the number of bytes of the file, 0 if it cannot be written</returns>
+  uint64_t write(const std::string& path, uint16_t tileSamples, uint8_t levelCount, bool compress) const;
+
+ private:
+  struct Wave {
+    double kLatitude;
+    double kLongitude;
+    double phase;
+    double amplitude_ft;
+  };
+
+  std::vector<Wave> waves;
+};
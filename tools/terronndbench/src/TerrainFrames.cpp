@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "TerrainFrames.h"
+
+namespace {
+
+// the display range of the picture, from the aircraft to the top of the arc
+const double RANGE_NMI = 40.0;
+
+const double GROUND_SPEED_KN = 250.0;
+
+enum Color : uint8_t { BLACK = 0, GREEN = 1, AMBER = 2, RED = 3, CYAN = 4, TRANSPARENT = 5 };
+
+const std::vector<std::array<uint8_t, 4>> EGPWC_PALETTE = {
+    {4, 4, 4, 255}, {0, 255, 0, 255}, {255, 255, 0, 255}, {255, 0, 0, 255}, {0, 255, 255, 255}, {0, 0, 0, 0},
+};
+
+/// dot patterns of the EGPWC, the densities are roughly 50 % and 25 %
+bool highDensity(int x, int y) {
+  return ((x + y) & 1) == 0;
+}
+
+bool lowDensity(int x, int y) {
+  return (x & 1) == 0 && (y & 1) == 0;
+}
+
+}  // namespace
+
+std::vector<uint8_t> IndexedFrame::toRgba() const {
+  std::vector<uint8_t> rgba(indices.size() * 4);
+  for (size_t i = 0; i < indices.size(); i++) {
+    for (size_t channel = 0; channel < 4; channel++) {
+      rgba[i * 4 + channel] = palette[indices[i]][channel];
+    }
+  }
+  return rgba;
+}
+
+TerrainFrames::TerrainFrames(uint16_t width, uint16_t height, uint32_t seed) : width(width), height(height) {
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> wavelength_nmi(3.0, 40.0);
+  std::uniform_real_distribution<double> angle(0.0, 2 * M_PI);
+  std::uniform_real_distribution<double> amplitude_ft(200.0, 1500.0);
+  for (int i = 0; i < 8; i++) {
+    double direction = angle(random);
+    double k = 2 * M_PI / wavelength_nmi(random);
+    waves.push_back({k * std::cos(direction), k * std::sin(direction), angle(random), amplitude_ft(random)});
+  }
+}
+
+double TerrainFrames::elevation_ft(double x_nmi, double y_nmi) const {
+  double elevation = 1500.0;
+  for (const auto& wave : waves) {
+    elevation += wave.amplitude_ft * std::sin(wave.kx * x_nmi + wave.ky * y_nmi + wave.phase);
+  }
+  return std::max(elevation, 0.0);
+}
+
+uint8_t TerrainFrames::color(int x, int y, double aircraft_y_nmi, double altitude_ft) const {
+  // distances from the aircraft in the bottom center of the picture
+  const double nmi_per_pixel = RANGE_NMI / height;
+  double dx_nmi = (x - width / 2.0) * nmi_per_pixel;
+  double dy_nmi = (height - y) * nmi_per_pixel;
+  if (dx_nmi * dx_nmi + dy_nmi * dy_nmi > RANGE_NMI * RANGE_NMI) {
+    return TRANSPARENT;
+  }
+
+  double elevation = elevation_ft(dx_nmi, aircraft_y_nmi + dy_nmi);
+  double relative = elevation - altitude_ft;
+  if (elevation <= 0) {
+    return lowDensity(x, y) ? CYAN : BLACK;
+  } else if (relative > 2000) {
+    return highDensity(x, y) ? RED : BLACK;
+  } else if (relative > 1000) {
+    return highDensity(x, y) ? AMBER : BLACK;
+  } else if (relative > -500) {
+    return lowDensity(x, y) ? AMBER : BLACK;
+  } else if (relative > -1000) {
+    return highDensity(x, y) ? GREEN : BLACK;
+  } else if (relative > -2000) {
+    return lowDensity(x, y) ? GREEN : BLACK;
+  }
+  return BLACK;
+}
+
+void TerrainFrames::render(double time, double altitude_ft, IndexedFrame& frame) const {
+  frame.width = width;
+  frame.height = height;
+  frame.palette = EGPWC_PALETTE;
+  frame.indices.resize(static_cast<size_t>(width) * height);
+
+  const double aircraft_y_nmi = time * GROUND_SPEED_KN / 3600.0;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      frame.indices[static_cast<size_t>(y) * width + x] = color(x, y, aircraft_y_nmi, altitude_ft);
+    }
+  }
+}
+
+void TerrainFrames::renderSweep(double time,
+                                double altitude_ft,
+                                double fromBearing_deg,
+                                double toBearing_deg,
+                                IndexedFrame& frame) const {
+  if (frame.width != width || frame.height != height) {
+    render(time, altitude_ft, frame);
+    return;
+  }
+
+  const double aircraft_y_nmi = time * GROUND_SPEED_KN / 3600.0;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      double bearing_deg = std::atan2(x - width / 2.0, height - y) * 180.0 / M_PI;
+      if (bearing_deg >= fromBearing_deg && bearing_deg < toBearing_deg) {
+        frame.indices[static_cast<size_t>(y) * width + x] = color(x, y, aircraft_y_nmi, altitude_ft);
+      }
+    }
+  }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// One terrain on ND picture as palette indices, rows from the top
+/// </summary>
+struct IndexedFrame {
+  uint16_t width = 0;
+  uint16_t height = 0;
+  std::vector<uint8_t> indices;
+  std::vector<std::array<uint8_t, 4>> palette;  // RGBA
+
+  /// expands the indices to RGBA pixels, the reference the decoders are checked against
+  std::vector<uint8_t> toRgba() const;
+};
+
+/// <summary>
+/// Stand-in for the SimBridge terrain renderer: the EGPWC picture of a synthetic terrain under an aircraft flying north
+/// </summary>
+/// <remarks>
+/// The terrain is a sum of seeded waves with lakes at sea level. The picture uses the EGPWC colors and dot densities
+/// relative to the aircraft altitude and is masked to the arc of the ND, the aircraft sits in the bottom center.
+/// </remarks>
+class TerrainFrames {
+ public:
+  TerrainFrames(uint16_t width, uint16_t height, uint32_t seed);
+
+  /// renders the picture at the time, the aircraft moves with 250 kn over the terrain
+  void render(double time, double altitude_ft, IndexedFrame& frame) const;
+
+  /// <summary>
+  /// Renders one step of the sweep of the EGPWC into the last picture
+  /// </summary>
+  /// <remarks>Only the pixels between the two bearings are updated, the bearings are in degrees from the nose.</remarks>
+  void renderSweep(double time, double altitude_ft, double fromBearing_deg, double toBearing_deg, IndexedFrame& frame) const;
+
+ private:
+  struct Wave {
+    double kx;
+    double ky;
+    double phase;
+    double amplitude_ft;
+  };
+
+  uint16_t width;
+  uint16_t height;
+  std::vector<Wave> waves;
+
+  double elevation_ft(double x_nmi, double y_nmi) const;
+
+  uint8_t color(int x, int y, double aircraft_y_nmi, double altitude_ft) const;
+};
@@ -0,0 +1,675 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "FrameEncoding.h"
+#include "SoakTest.h"
+#include "SyntheticElevation.h"
+#include "TerrainFrames.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/format.h"
+#include "navigationdisplay/configuration.h"
+#include "navigationdisplay/framebuffer.h"
+#include "navigationdisplay/framecache.h"
+#include "terrain/renderer.h"
+
+// the payload of a chunk of the frame data client area, SIMCONNECT_CLIENTDATA_MAX_SIZE without the chunk header
+const size_t CHUNK_PAYLOAD = 8192 - 8;
+
+/// decode statistics of one frame format
+struct FormatResult {
+  const char* name;
+  uint64_t bytes = 0;
+  uint64_t chunks = 0;
+  double decodeTime = 0;
+  double maxDecodeTime = 0;
+  uint64_t failures = 0;
+
+  void add(size_t frameBytes, double time, bool identical) {
+    bytes += frameBytes;
+    chunks += (frameBytes + CHUNK_PAYLOAD - 1) / CHUNK_PAYLOAD;
+    decodeTime += time;
+    maxDecodeTime = std::max(maxDecodeTime, time);
+    failures += !identical;
+  }
+};
+
+/// prints the statistics per frame of the formats
+void printResults(std::initializer_list<const FormatResult*> results, uint32_t frameCount) {
+  for (const auto* result : results) {
+    fmt::print("  {:<17} {:8.1f} KiB {:6.1f} chunks per frame  decode {:8.1f} us mean {:8.1f} us max  {} failures\n", result->name,
+               result->bytes / 1024.0 / frameCount, static_cast<double>(result->chunks) / frameCount, result->decodeTime / frameCount,
+               result->maxDecodeTime, result->failures);
+  }
+}
+
+/// <summary>
+/// Runs the callable once and returns the time it took in us
+/// </summary>
+template <typename Callable>
+double measure(Callable&& callable) {
+  auto start = std::chrono::steady_clock::now();
+  callable();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+/// <summary>
+/// Decodes full frames of the synthetic terrain as compressed image, as palette frame and progressively per chunk
+/// </summary>
+bool compareFormats(const TerrainFrames& producer, uint32_t frameCount, double altitude_ft, double frameInterval_s) {
+  IndexedFrame frame;
+  FormatResult png{"compressed image"};
+  FormatResult palette{"palette RLE"};
+  FormatResult progressive{"progressive"};
+  double maxChunkTime = 0;
+  std::vector<uint8_t> pngPixels;
+  navigationdisplay::FrameBuffer frameBuffer;
+  navigationdisplay::FrameBuffer progressiveBuffer;
+
+  for (uint32_t i = 0; i < frameCount; i++) {
+    producer.render(i * frameInterval_s, altitude_ft, frame);
+    std::vector<uint8_t> expected = frame.toRgba();
+    std::vector<uint8_t> pngData = encodePng(expected, frame.width, frame.height);
+    std::vector<uint8_t> paletteData = encodePaletteRle(frame);
+
+    uint16_t pngWidth = 0;
+    uint16_t pngHeight = 0;
+    bool decoded = false;
+    double time = measure([&]() { decoded = decodePng(pngData, pngPixels, pngWidth, pngHeight); });
+    png.add(pngData.size(), time, decoded && pngPixels == expected);
+
+    time = measure([&]() { decoded = frameBuffer.decodePaletteRle(paletteData.data(), paletteData.size()); });
+    bool identical = decoded && std::equal(expected.begin(), expected.end(), frameBuffer.rgba());
+    palette.add(paletteData.size(), time, identical);
+
+    // the chunks arrive one after the other, every chunk decodes the rows that it completes
+    progressiveBuffer.beginPaletteRle(false);
+    decoded = true;
+    time = 0;
+    for (size_t received = 0; received < paletteData.size() && decoded;) {
+      received = std::min(received + CHUNK_PAYLOAD, paletteData.size());
+      const double chunkTime = measure([&]() { decoded = progressiveBuffer.continuePaletteRle(paletteData.data(), received); });
+      maxChunkTime = std::max(maxChunkTime, chunkTime);
+      time += chunkTime;
+    }
+    identical = decoded && progressiveBuffer.complete() && std::equal(expected.begin(), expected.end(), progressiveBuffer.rgba());
+    progressive.add(paletteData.size(), time, identical);
+  }
+
+  fmt::print("formats: {} full frames of {}x{} pixels, raw RGBA {} KiB per frame\n", frameCount, frame.width, frame.height,
+             frame.width * frame.height * 4 / 1024);
+  printResults({&png, &palette, &progressive}, frameCount);
+  fmt::print("  palette RLE decodes {:.1f}x faster, progressively {:.1f} us mean {:.1f} us max per chunk\n",
+             png.decodeTime / palette.decodeTime, progressive.decodeTime / progressive.chunks, maxChunkTime);
+  return png.failures == 0 && palette.failures == 0 && progressive.failures == 0;
+}
+
+/// <summary>
+/// Sends frames whose header is larger than the display, every decoding path has to reject them before it allocates
+/// </summary>
+bool checkOversizedFrames() {
+  const uint32_t color = 0xff000000;
+  const uint8_t run[] = {0x00, 0x00};  // one pixel of the first color
+  const uint16_t tileIndex = 0;
+  const uint16_t sizes[][2] = {
+      {navigationdisplay::MaxFrameWidth + 1, 1}, {1, navigationdisplay::MaxFrameHeight + 1}, {UINT16_MAX, UINT16_MAX}};
+  bool rejected = true;
+  uint64_t allocations = 0;
+
+  for (const auto& size : sizes) {
+    const types::PaletteFrameHeader paletteHeader = {size[0], size[1], 1};
+    std::vector<uint8_t> paletteData(sizeof(paletteHeader) + sizeof(color) + sizeof(run));
+    std::memcpy(paletteData.data(), &paletteHeader, sizeof(paletteHeader));
+    std::memcpy(&paletteData[sizeof(paletteHeader)], &color, sizeof(color));
+    std::memcpy(&paletteData[sizeof(paletteHeader) + sizeof(color)], run, sizeof(run));
+
+    const types::TileDeltaHeader deltaHeader = {size[0], size[1], 32, 1, 1};
+    std::vector<uint8_t> deltaData(sizeof(deltaHeader) + sizeof(color) + sizeof(tileIndex) + sizeof(run));
+    std::memcpy(deltaData.data(), &deltaHeader, sizeof(deltaHeader));
+    std::memcpy(&deltaData[sizeof(deltaHeader)], &color, sizeof(color));
+    std::memcpy(&deltaData[sizeof(deltaHeader) + sizeof(color)], &tileIndex, sizeof(tileIndex));
+    std::memcpy(&deltaData[sizeof(deltaHeader) + sizeof(color) + sizeof(tileIndex)], run, sizeof(run));
+
+    navigationdisplay::FrameBuffer buffer;
+    const uint64_t allocationsBefore = AllocationCounter::statistics().allocations;
+    {
+      AllocationCounter::Section section;
+      rejected &= !buffer.decodePaletteRle(paletteData.data(), paletteData.size());
+      buffer.beginPaletteRle(true);
+      rejected &= !buffer.continuePaletteRle(paletteData.data(), paletteData.size());
+      rejected &= !buffer.patchTiles(deltaData.data(), deltaData.size());
+    }
+    allocations += AllocationCounter::statistics().allocations - allocationsBefore;
+    rejected &= buffer.width() == 0 && buffer.height() == 0 && !buffer.complete();
+  }
+
+  const bool passed = rejected && allocations == 0;
+  fmt::print("formats: frames larger than {}x{} pixels {}, {} allocations  {}\n", navigationdisplay::MaxFrameWidth,
+             navigationdisplay::MaxFrameHeight, rejected ? "rejected" : "ACCEPTED", allocations, passed ? "ok" : "FAILED");
+  return passed;
+}
+
+/// <summary>
+/// Sends the steps of the EGPWC sweep as full palette frames and as tile deltas
+/// </summary>
+bool compareSweep(const TerrainFrames& producer,
+                  uint32_t frameCount,
+                  double altitude_ft,
+                  double frameInterval_s,
+                  uint32_t sweepSteps,
+                  uint8_t tileSize) {
+  IndexedFrame frame;
+  IndexedFrame previous;
+  FormatResult palette{"palette RLE"};
+  FormatResult delta{"tile delta"};
+  navigationdisplay::FrameBuffer fullBuffer;
+  navigationdisplay::FrameBuffer deltaBuffer;
+
+  for (uint32_t i = 0; i < frameCount; i++) {
+    // the sweep runs from the left to the right of the arc
+    double stepWidth_deg = 180.0 / sweepSteps;
+    double fromBearing_deg = -90.0 + (i % sweepSteps) * stepWidth_deg;
+    producer.renderSweep(i * frameInterval_s, altitude_ft, fromBearing_deg, fromBearing_deg + stepWidth_deg, frame);
+    std::vector<uint8_t> expected = frame.toRgba();
+    std::vector<uint8_t> paletteData = encodePaletteRle(frame);
+    std::vector<uint8_t> deltaData = encodeTileDelta(i > 0 ? &previous : nullptr, frame, tileSize);
+    previous = frame;
+
+    bool decoded = false;
+    double time = measure([&]() { decoded = fullBuffer.decodePaletteRle(paletteData.data(), paletteData.size()); });
+    palette.add(paletteData.size(), time, decoded && std::equal(expected.begin(), expected.end(), fullBuffer.rgba()));
+
+    time = measure([&]() { decoded = deltaBuffer.patchTiles(deltaData.data(), deltaData.size()); });
+    delta.add(deltaData.size(), time, decoded && std::equal(expected.begin(), expected.end(), deltaBuffer.rgba()));
+  }
+
+  fmt::print("sweep: {} steps of {} per sweep, tiles of {} pixels\n", frameCount, sweepSteps, tileSize);
+  printResults({&palette, &delta}, frameCount);
+  fmt::print("  tile deltas send {:.1f}x fewer bytes\n", static_cast<double>(palette.bytes) / delta.bytes);
+  return palette.failures == 0 && delta.failures == 0;
+}
+
+/// <summary>
+/// Sends the tile deltas of the sweep to both displays with the same range and mode, once decoded per display and once
+/// through the shared frame cache
+/// </summary>
+/// <remarks>The displays receive the frames in alternating order, so the cache patches in place and copies shared frames.</remarks>
+bool compareShared(const TerrainFrames& producer,
+                   uint32_t frameCount,
+                   double altitude_ft,
+                   double frameInterval_s,
+                   uint32_t sweepSteps,
+                   uint8_t tileSize) {
+  IndexedFrame frame;
+  IndexedFrame previous;
+  FormatResult separate{"per display"};
+  FormatResult shared{"frame cache"};
+  navigationdisplay::FrameBuffer leftBuffer;
+  navigationdisplay::FrameBuffer rightBuffer;
+  navigationdisplay::FrameCache cache;
+  std::shared_ptr<navigationdisplay::FrameBuffer> leftFrame;
+  std::shared_ptr<navigationdisplay::FrameBuffer> rightFrame;
+
+  for (uint32_t i = 0; i < frameCount; i++) {
+    double stepWidth_deg = 180.0 / sweepSteps;
+    double fromBearing_deg = -90.0 + (i % sweepSteps) * stepWidth_deg;
+    producer.renderSweep(i * frameInterval_s, altitude_ft, fromBearing_deg, fromBearing_deg + stepWidth_deg, frame);
+    std::vector<uint8_t> expected = frame.toRgba();
+    std::vector<uint8_t> deltaData = encodeTileDelta(i > 0 ? &previous : nullptr, frame, tileSize);
+    previous = frame;
+
+    bool decoded = false;
+    double time = measure([&]() {
+      decoded = leftBuffer.patchTiles(deltaData.data(), deltaData.size()) && rightBuffer.patchTiles(deltaData.data(), deltaData.size());
+    });
+    separate.add(2 * deltaData.size(), time,
+                 decoded && std::equal(expected.begin(), expected.end(), leftBuffer.rgba()) &&
+                     std::equal(expected.begin(), expected.end(), rightBuffer.rgba()));
+
+    const navigationdisplay::FrameCache::Key key{40, 1, i + 1};
+    time = measure([&]() {
+      if (i % 2 == 0) {
+        leftFrame = cache.patchTiles(key, std::move(leftFrame), deltaData.data(), deltaData.size());
+        rightFrame = cache.patchTiles(key, std::move(rightFrame), deltaData.data(), deltaData.size());
+      } else {
+        rightFrame = cache.patchTiles(key, std::move(rightFrame), deltaData.data(), deltaData.size());
+        leftFrame = cache.patchTiles(key, std::move(leftFrame), deltaData.data(), deltaData.size());
+      }
+    });
+    shared.add(2 * deltaData.size(), time,
+               leftFrame != nullptr && leftFrame == rightFrame && std::equal(expected.begin(), expected.end(), leftFrame->rgba()));
+  }
+
+  const auto& statistics = cache.statistics();
+  fmt::print("shared: {} sweep steps to both displays, tiles of {} pixels\n", frameCount, tileSize);
+  printResults({&separate, &shared}, frameCount);
+  fmt::print("  {} decoded, {} shared, {} copied frames, {} failures, {} buffers in the pool\n", statistics.decodedFrames,
+             statistics.sharedFrames, statistics.copiedFrames, statistics.failures, cache.bufferCount());
+  return separate.failures == 0 && shared.failures == 0 && statistics.decodedFrames == frameCount;
+}
+
+/// <summary>
+/// Compares the min, max and percentile kernels of the renderer with a sorted copy of random samples
+/// </summary>
+bool checkKernels(uint32_t seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> elevation(-200.0f, 15000.0f);
+  std::vector<uint32_t> histogram;
+  uint64_t failures = 0;
+
+  for (size_t count : {1, 3, 4, 5, 17, 1000, 37001}) {
+    std::vector<float> values(count);
+    for (auto& value : values) {
+      value = elevation(generator);
+    }
+    std::vector<float> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    const float minimum = terrain::Renderer::minimum(values.data(), count);
+    const float maximum = terrain::Renderer::maximum(values.data(), count);
+    failures += minimum != sorted.front() || maximum != sorted.back();
+    for (float fraction : {0.0f, 0.25f, 0.5f, 0.9f}) {
+      // the percentile is the lower edge of the bucket of the sorted sample
+      const float expected = sorted[static_cast<size_t>(fraction * count)];
+      const float percentile = terrain::Renderer::percentile(values.data(), count, minimum, 100.0f, fraction, histogram);
+      failures += percentile > expected || expected - percentile >= 100.0f;
+    }
+  }
+
+  fmt::print("render: kernels {}\n", failures == 0 ? "match the sorted samples" : "FAILED");
+  return failures == 0;
+}
+
+/// <summary>
+/// Returns the center of the red pixels of the picture or a negative position if there are none
+/// </summary>
+std::pair<double, double> redCenter(const terrain::Renderer& renderer) {
+  double x = 0.0;
+  double y = 0.0;
+  uint64_t count = 0;
+  for (size_t i = 0; i < renderer.indices().size(); i++) {
+    // the last palette entry is red
+    if (renderer.indices()[i] == terrain::Renderer::PaletteSize - 1) {
+      x += static_cast<double>(i % renderer.width());
+      y += static_cast<double>(i / renderer.width());
+      count++;
+    }
+  }
+  return count == 0 ? std::make_pair(-1.0, -1.0) : std::make_pair(x / count, y / count);
+}
+
+/// <summary>
+/// Checks that the landmark peak of the synthetic model is drawn where the ND shows it
+/// </summary>
+bool checkOrientation(ElevationTileCache& cache, terrain::Renderer& renderer) {
+  // the aircraft is 18 nm south of the landmark, only the landmark is more than 2000 ft above it
+  const double distance_nmi = 18.0;
+  terrain::Renderer::Request request{};
+  request.latitude = static_cast<float>(SyntheticElevation::LANDMARK_LATITUDE - distance_nmi / 60.0);
+  request.longitude = static_cast<float>(SyntheticElevation::LANDMARK_LONGITUDE);
+  request.altitude = static_cast<float>(SyntheticElevation::REGION_MAX_ELEVATION_FT + 2000.0);
+  request.range = 40.0f;
+
+  struct Case {
+    const char* name;
+    bool arcMode;
+    float heading;
+    double expectedX;
+    double expectedY;
+  };
+  const double width = renderer.width();
+  const double height = renderer.height();
+  const double pixels_per_nmi = height / request.range;
+  const Case cases[] = {
+      {"ARC heading 0", true, 0.0f, width / 2, height - distance_nmi * pixels_per_nmi},
+      {"ROSE heading 0", false, 0.0f, width / 2, height / 2 - distance_nmi * pixels_per_nmi},
+      {"ROSE heading 90", false, 90.0f, width / 2 - distance_nmi * pixels_per_nmi, height / 2},
+      {"ROSE heading 180", false, 180.0f, width / 2, height / 2 + distance_nmi * pixels_per_nmi},
+  };
+
+  bool success = true;
+  for (const auto& test : cases) {
+    request.arcMode = test.arcMode;
+    request.heading = test.heading;
+    // the first picture queues the missing tiles, the second one is drawn from them
+    renderer.render(cache, request);
+    while (!cache.idle()) {
+      cache.update(SIZE_MAX);
+    }
+    renderer.render(cache, request);
+
+    const auto [x, y] = redCenter(renderer);
+    const double error = std::hypot(x - test.expectedX, y - test.expectedY);
+    const bool passed = x >= 0.0 && error < 8.0 && renderer.thresholds().upperMode == types::ThresholdMode::WARNING;
+    fmt::print("  {:<16} landmark at {:5.0f} {:5.0f} expected {:5.0f} {:5.0f}  upper {:5} ft mode {}  {}\n", test.name, x, y,
+               test.expectedX, test.expectedY, renderer.thresholds().upper, renderer.thresholds().upperMode, passed ? "ok" : "FAILED");
+    success &= passed;
+  }
+  return success;
+}
+
+/// <summary>
+/// Writes the synthetic elevation file and opens it in the cache
+/// </summary>
+bool openElevationFile(const SyntheticElevation& model, const std::string& path, ElevationTileCache& cache) {
+  const uint64_t fileSize = model.write(path, 128, 5, true);
+  if (fileSize == 0 || !cache.open(path)) {
+    fmt::print("unable to write the elevation file {}\n", path);
+    return false;
+  }
+  fmt::print("  {} KiB elevation file with {} levels, {} tile slots, {} KiB with the indices\n", fileSize / 1024, cache.levelCount(),
+             cache.capacity(), cache.memoryUsage() / 1024);
+  return true;
+}
+
+/// <summary>
+/// Renders the pictures of a flight over the synthetic elevation file in all ranges and both modes
+/// </summary>
+bool compareRender(uint32_t width, uint32_t height, uint32_t seed, uint32_t frameCount, double altitude_ft, uint32_t gridStep) {
+  const std::string path = (std::filesystem::temp_directory_path() / "terronndbench.fbwdem").string();
+  fmt::print("render: pictures of {}x{} pixels sampled every {} pixels\n", width, height, gridStep);
+  ElevationTileCache cache(64 * 1024 * 1024);
+  if (!openElevationFile(SyntheticElevation(seed), path, cache)) {
+    return false;
+  }
+
+  terrain::Renderer renderer(static_cast<uint16_t>(width), static_cast<uint16_t>(height), static_cast<uint16_t>(gridStep));
+  bool success = checkKernels(seed);
+  success &= checkOrientation(cache, renderer);
+
+  terrain::Renderer::Request request{};
+  request.altitude = static_cast<float>(altitude_ft);
+  request.heading = 45.0f;
+  for (bool arcMode : {true, false}) {
+    for (float range : {10.0f, 20.0f, 40.0f, 80.0f, 160.0f, 320.0f}) {
+      request.arcMode = arcMode;
+      request.range = range;
+      double renderTime = 0.0;
+      double maxRenderTime = 0.0;
+      double maxBandTime = 0.0;
+      uint32_t bands = 0;
+      bool bandsEqual = true;
+      const uint64_t decodedTiles = cache.statistics().decodedTiles;
+
+      for (uint32_t i = 0; i < frameCount; i++) {
+        // the aircraft crosses the region to the north east with 250 kn and a picture per second
+        const double leg_nmi = i * 250.0 / 3600.0 * std::sqrt(0.5);
+        request.latitude = static_cast<float>(45.0 + leg_nmi / 60.0);
+        request.longitude = static_cast<float>(7.0 + leg_nmi / 60.0 / std::cos(45.0 * 3.141592653589793 / 180.0));
+        const double time = measure([&]() { renderer.render(cache, request); });
+        renderTime += time;
+        maxRenderTime = std::max(maxRenderTime, time);
+
+        // the gauge renders the same picture in bands over several frames
+        const std::vector<uint8_t> indices = renderer.indices();
+        renderer.begin(request);
+        bool complete = false;
+        while (!complete) {
+          maxBandTime =
+              std::max(maxBandTime, measure([&]() { complete = renderer.advance(cache, navigationdisplay::LocalFrameGridRowsPerFrame); }));
+          bands += i == 0;
+        }
+        bandsEqual &= renderer.indices() == indices;
+        // the render time only covers the lookups, the tiles are decoded in between
+        while (!cache.idle()) {
+          cache.update(SIZE_MAX);
+        }
+      }
+
+      fmt::print(
+          "  {:<4} {:3.0f} nm  render {:8.1f} us mean {:8.1f} us max  {:2} bands {:7.1f} us max  {:6.1f} decoded tiles per picture  "
+          "thresholds {} {} ft  {}\n",
+          arcMode ? "ARC" : "ROSE", range, renderTime / frameCount, maxRenderTime, bands, maxBandTime,
+          static_cast<double>(cache.statistics().decodedTiles - decodedTiles) / frameCount, renderer.thresholds().lower,
+          renderer.thresholds().upper, bandsEqual ? "ok" : "FAILED");
+      success &= bandsEqual;
+    }
+  }
+
+  cache.close();
+  std::filesystem::remove(path);
+  return success;
+}
+
+/// statistics of one simulated flight with the elevation tile cache
+struct CacheResult {
+  uint64_t pictures = 0;
+  uint64_t picturesWithFallbacks = 0;
+  uint64_t lookups = 0;
+  uint64_t fallbacks = 0;
+  std::vector<double> updateTimes;
+
+  double percentile(double fraction) {
+    std::sort(updateTimes.begin(), updateTimes.end());
+    return updateTimes[static_cast<size_t>(fraction * (updateTimes.size() - 1))];
+  }
+};
+
+/// <summary>
+/// Flies across the synthetic region with 60 frames per second and two displays that are rendered once per second
+/// </summary>
+/// <remarks>Every frame decodes the queued tiles within the budget, the prefetch follows the track every two seconds.</remarks>
+CacheResult simulateFlight(ElevationTileCache& cache,
+                           terrain::Renderer& renderer,
+                           double flightTime_s,
+                           double altitude_ft,
+                           size_t decodeBudget,
+                           bool prefetch) {
+  const double frameTime_s = 1.0 / 60.0;
+  const double groundSpeed_kn = 480.0;
+  const double track_deg = 55.0;
+  const float ranges[] = {40.0f, 320.0f};
+
+  CacheResult result;
+  terrain::Renderer::Request request{};
+  request.altitude = static_cast<float>(altitude_ft);
+  request.heading = static_cast<float>(track_deg);
+
+  for (uint64_t frame = 0; frame * frameTime_s < flightTime_s; frame++) {
+    const double time_s = frame * frameTime_s;
+    const double distance_nmi = groundSpeed_kn * time_s / 3600.0;
+    request.latitude = static_cast<float>(44.5 + distance_nmi * std::cos(track_deg * 3.141592653589793 / 180.0) / 60.0);
+    request.longitude = static_cast<float>(6.5 + distance_nmi * std::sin(track_deg * 3.141592653589793 / 180.0) / 60.0 /
+                                           std::cos(45.0 * 3.141592653589793 / 180.0));
+
+    if (prefetch && frame % 120 == 0) {
+      for (float range : ranges) {
+        cache.prefetch(renderer.level(cache, range), request.latitude, request.longitude, static_cast<float>(track_deg),
+                       static_cast<float>(groundSpeed_kn), 180.0f, range);
+      }
+    }
+
+    if (frame % 60 == 0) {
+      for (float range : ranges) {
+        const uint64_t lookups = cache.statistics().lookups;
+        const uint64_t fallbacks = cache.statistics().fallbacks;
+        request.range = range;
+        request.arcMode = range == ranges[0];
+        renderer.render(cache, request);
+        result.pictures++;
+        result.lookups += cache.statistics().lookups - lookups;
+        result.fallbacks += cache.statistics().fallbacks - fallbacks;
+        result.picturesWithFallbacks += cache.statistics().fallbacks != fallbacks;
+      }
+    }
+
+    result.updateTimes.push_back(measure([&]() { cache.update(decodeBudget); }));
+  }
+  return result;
+}
+
+/// <summary>
+/// Compares the elevation tile cache with and without the prefetch along the flight path
+/// </summary>
+bool compareCache(uint32_t width,
+                  uint32_t height,
+                  uint32_t seed,
+                  double flightTime_s,
+                  double altitude_ft,
+                  uint32_t gridStep,
+                  uint32_t budget_kib,
+                  uint32_t decodeBudget_kib) {
+  const std::string path = (std::filesystem::temp_directory_path() / "terronndbench.fbwdem").string();
+  const SyntheticElevation model(seed);
+  terrain::Renderer renderer(static_cast<uint16_t>(width), static_cast<uint16_t>(height), static_cast<uint16_t>(gridStep));
+  bool success = true;
+
+  fmt::print("cache: {:.0f} s flight with 480 kn, {} KiB tile budget, {} KiB decoded per frame\n", flightTime_s, budget_kib,
+             decodeBudget_kib);
+  for (bool prefetch : {false, true}) {
+    ElevationTileCache cache(static_cast<size_t>(budget_kib) * 1024);
+    if (!openElevationFile(model, path, cache)) {
+      return false;
+    }
+
+    CacheResult result =
+        simulateFlight(cache, renderer, flightTime_s, altitude_ft, static_cast<size_t>(decodeBudget_kib) * 1024, prefetch);
+    const auto& statistics = cache.statistics();
+    fmt::print("  {:<11} {:5} of {:5} pictures with fallbacks ({:.3f} % of the lookups)  update {:6.1f} us p99.9 {:7.1f} us max\n",
+               prefetch ? "prefetch" : "on demand", result.picturesWithFallbacks, result.pictures,
+               100.0 * result.fallbacks / std::max<uint64_t>(result.lookups, 1), result.percentile(0.999), result.percentile(1.0));
+    fmt::print("  {:<11} {} decoded tiles, {} prefetched, {} evictions, {} failures, {} of {} slots resident\n", "",
+               statistics.decodedTiles, statistics.prefetchedTiles, statistics.evictions, statistics.failures, cache.residentTiles(),
+               cache.capacity());
+    success &= statistics.failures == 0 && cache.residentTiles() <= cache.capacity();
+    cache.close();
+  }
+
+  std::filesystem::remove(path);
+  return success;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  std::string mode = "all";
+  uint32_t frameCount = 50;
+  uint32_t width = 768;
+  uint32_t height = 768;
+  uint32_t seed = 1;
+  uint32_t sweepSteps = 12;
+  uint32_t tileSize = 32;
+  uint32_t gridStep = 4;
+  uint32_t cacheBudget_kib = 4096;
+  uint32_t decodeBudget_kib = 32;
+  double flightTime_s = 1800;
+  double altitude_ft = 3000;
+  double frameInterval_s = 2.5;
+  uint32_t chunksPerFrame = 4;
+  std::string encoding = "palette";
+  uint32_t protocolVersion = navigationdisplay::ProtocolVersion;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Compares the frame formats of the terrain on ND with a synthetic terrain");
+  args.addArgument({"-m", "--mode"}, &mode,
+                   "formats for full frames, sweep for tile deltas of the sweep, shared for the frame cache of both displays, render for "
+                   "the local renderer, cache for the elevation tile cache, soak for hours of flight with both displays through the "
+                   "simulated SDK or all without soak");
+  args.addArgument({"-f", "--frames"}, &frameCount, "Number of frames or sweep steps");
+  args.addArgument({"-x", "--width"}, &width, "Width of the frames in pixels");
+  args.addArgument({"-y", "--height"}, &height, "Height of the frames in pixels");
+  args.addArgument({"-s", "--seed"}, &seed, "Seed of the synthetic terrain");
+  args.addArgument({"-a", "--altitude"}, &altitude_ft, "Altitude of the aircraft in ft");
+  args.addArgument({"-i", "--interval"}, &frameInterval_s, "Time between two frames in s");
+  args.addArgument({"-w", "--sweep-steps"}, &sweepSteps, "Number of frames of one sweep");
+  args.addArgument({"-z", "--tile-size"}, &tileSize, "Size of the tiles in pixels");
+  args.addArgument({"-g", "--grid-step"}, &gridStep, "Distance between the elevation samples of the local renderer in pixels");
+  args.addArgument({"-b", "--cache-budget"}, &cacheBudget_kib, "Memory of the decoded elevation tiles in KiB");
+  args.addArgument({"-d", "--decode-budget"}, &decodeBudget_kib, "Decoded elevation bytes per frame in KiB");
+  args.addArgument({"-t", "--flight-time"}, &flightTime_s, "Duration of the flight of the cache and soak mode in s");
+  args.addArgument({"-c", "--chunks"}, &chunksPerFrame, "Chunks per display and simulator frame of the soak mode, 0 sends frames at once");
+  args.addArgument({"-e", "--encoding"}, &encoding, "Frame format of the soak mode: palette, delta or png");
+  args.addArgument({"-p", "--protocol"}, &protocolVersion,
+                   "SimBridge protocol version of the soak mode, 0 sends compressed images without frame info and chunk headers");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // check parameters
+  if (mode != "all" && mode != "formats" && mode != "sweep" && mode != "shared" && mode != "render" && mode != "cache" &&
+      mode != "soak") {
+    fmt::print("Unknown mode {}!\n", mode);
+    return 1;
+  }
+  if (width == 0 || height == 0 || width > navigationdisplay::MaxFrameWidth || height > navigationdisplay::MaxFrameHeight) {
+    fmt::print("The size of the frames must be between 1x1 and {}x{} pixels!\n", navigationdisplay::MaxFrameWidth,
+               navigationdisplay::MaxFrameHeight);
+    return 1;
+  }
+  if (tileSize == 0 || tileSize > 255 || sweepSteps == 0) {
+    fmt::print("The tile size must be between 1 and 255 pixels and a sweep needs at least one step!\n");
+    return 1;
+  }
+  if (gridStep == 0 || gridStep > 64) {
+    fmt::print("The grid step must be between 1 and 64 pixels!\n");
+    return 1;
+  }
+  if (encoding != "palette" && encoding != "delta" && encoding != "png") {
+    fmt::print("Unknown encoding {}!\n", encoding);
+    return 1;
+  }
+  if (protocolVersion > navigationdisplay::ProtocolVersion) {
+    fmt::print("The protocol version must be at most {}!\n", navigationdisplay::ProtocolVersion);
+    return 1;
+  }
+  if (((width + tileSize - 1) / tileSize) * ((height + tileSize - 1) / tileSize) > UINT16_MAX) {
+    fmt::print("Too many tiles, increase the tile size!\n");
+    return 1;
+  }
+
+  TerrainFrames producer(static_cast<uint16_t>(width), static_cast<uint16_t>(height), seed);
+  bool success = true;
+  if (mode == "all" || mode == "formats") {
+    success &= compareFormats(producer, frameCount, altitude_ft, frameInterval_s);
+    success &= checkOversizedFrames();
+  }
+  if (mode == "all" || mode == "sweep") {
+    success &= compareSweep(producer, frameCount, altitude_ft, frameInterval_s, sweepSteps, static_cast<uint8_t>(tileSize));
+  }
+  if (mode == "all" || mode == "shared") {
+    success &= compareShared(producer, frameCount, altitude_ft, frameInterval_s, sweepSteps, static_cast<uint8_t>(tileSize));
+  }
+  if (mode == "all" || mode == "render") {
+    success &= compareRender(width, height, seed, frameCount, altitude_ft, gridStep);
+  }
+  if (mode == "all" || mode == "cache") {
+    success &= compareCache(width, height, seed, flightTime_s, altitude_ft, gridStep, cacheBudget_kib, decodeBudget_kib);
+  }
+  if (mode == "soak") {
+    SimBridgeProducer::Settings settings;
+    settings.format = encoding == "delta" ? types::FrameFormat::TILE_DELTA
+                      : encoding == "png" ? types::FrameFormat::COMPRESSED_IMAGE
+                                          : types::FrameFormat::PALETTE_RLE;
+    settings.width = static_cast<uint16_t>(width);
+    settings.height = static_cast<uint16_t>(height);
+    settings.seed = seed;
+    settings.frameInterval_s = frameInterval_s;
+    settings.chunksPerFrame = chunksPerFrame;
+    settings.sweepSteps = sweepSteps;
+    settings.tileSize = static_cast<uint8_t>(tileSize);
+    settings.protocolVersion = static_cast<uint16_t>(protocolVersion);
+    success &= soakTest(settings, flightTime_s, altitude_ft);
+  }
+  return success ? 0 : 1;
+}